@@ -0,0 +1,77 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+// Measures multiexp on this machine and writes one tuning file per group, to be loaded at startup:
+//
+//     std::ifstream in("bls12_381_g1.multiexp_tuning");
+//     load_multiexp_tuning<curves::bls12<381>::g1_type<>>(in);
+//
+// Usage: multiexp_calibration [output directory] [log2 of the largest length]
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+#include <nil/crypto3/algebra/multiexp/calibration.hpp>
+#include <nil/crypto3/algebra/multiexp/tuning.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename GroupType>
+bool calibrate(const std::string &name, const std::string &directory, const multiexp_calibration_options &options) {
+    std::cout << "Calibrating " << name << std::endl;
+    const multiexp_tuning tuning = calibrate_multiexp<GroupType>(options);
+    tuning.write(std::cout);
+
+    const std::string path = directory + "/" + name + ".multiexp_tuning";
+    std::ofstream out(path);
+    out << "# " << name << ", written by multiexp_calibration\n";
+    tuning.write(out);
+    if (!out) {
+        std::cerr << "Cannot write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    const std::string directory = argc > 1 ? argv[1] : ".";
+    multiexp_calibration_options options;
+    if (argc > 2) {
+        options.max_log2_length = std::strtoul(argv[2], nullptr, 10);
+    }
+
+    bool ok = true;
+    ok = calibrate<curves::bls12<381>::g1_type<>>("bls12_381_g1", directory, options) && ok;
+    ok = calibrate<curves::bls12<381>::g2_type<>>("bls12_381_g2", directory, options) && ok;
+    ok = calibrate<curves::alt_bn128<254>::g1_type<>>("alt_bn128_g1", directory, options) && ok;
+    ok = calibrate<curves::alt_bn128<254>::g2_type<>>("alt_bn128_g2", directory, options) && ok;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,399 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CT_SCALAR_MUL_HPP
+#define CRYPTO3_ALGEBRA_CT_SCALAR_MUL_HPP
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/fp2.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/jacobian/add_2007_bl.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/jacobian_with_a4_0/add_2007_bl.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/jacobian_with_a4_minus_3/add_2007_bl.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective/add_1998_cmo_2.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_with_a4_minus_3/add_1998_cmo_2.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_complete_with_a4_0/add_2015_rcb.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_complete_with_a4_minus_3/add_2015_rcb.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended/add_2008_hwcd.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/add_2008_hwcd_3.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/element_g1.hpp>
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
+
+#include <boost/assert.hpp>
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                typedef multiprecision::limb_type ct_mask_type;
+
+                /** @brief All-ones mask if a == b, zero otherwise, without branches
+                 */
+                constexpr inline ct_mask_type ct_mask_eq(std::uint64_t a, std::uint64_t b) {
+                    const std::uint64_t x = a ^ b;
+                    return ct_mask_type(0) - static_cast<ct_mask_type>(((x | (std::uint64_t(0) - x)) >> 63) ^ 1);
+                }
+
+                constexpr inline ct_mask_type ct_mask_bit(std::uint64_t bit) {
+                    return ct_mask_type(0) - static_cast<ct_mask_type>(bit & 1);
+                }
+
+                /** @brief r = mask ? a : r on the limbs of a fixed precision cpp_int backend.
+                 *  All limbs up to the larger of both sizes are touched regardless of mask, but the
+                 *  backend keeps its numbers normalized, so the loop bound and the resulting size still
+                 *  reveal the limb counts of the operands: not constant time on this backend.
+                 */
+                template<typename Backend>
+                void ct_cmov(Backend &r, const Backend &a, ct_mask_type mask) {
+                    const unsigned r_size = r.size();
+                    const unsigned a_size = a.size();
+                    const unsigned size = r_size > a_size ? r_size : a_size;
+
+                    r.resize(size, size);
+                    typename Backend::limb_pointer rp = r.limbs();
+                    typename Backend::const_limb_pointer ap = a.limbs();
+                    for (unsigned i = 0; i < size; ++i) {
+                        const ct_mask_type ri = i < r_size ? rp[i] : 0;
+                        const ct_mask_type ai = i < a_size ? ap[i] : 0;
+                        rp[i] = ri ^ (mask & (ri ^ ai));
+                    }
+                    r.normalize();
+                }
+
+                template<typename Backend, multiprecision::expression_template_option ExpressionTemplates>
+                void ct_cmov(multiprecision::number<Backend, ExpressionTemplates> &r,
+                             const multiprecision::number<Backend, ExpressionTemplates> &a,
+                             ct_mask_type mask) {
+                    ct_cmov(r.backend(), a.backend(), mask);
+                }
+
+                // Montgomery representation is moved as is, the modulus is shared
+                template<typename FieldParams>
+                void ct_cmov(fields::detail::element_fp<FieldParams> &r,
+                             const fields::detail::element_fp<FieldParams> &a,
+                             ct_mask_type mask) {
+                    ct_cmov(r.data.backend().base_data(), a.data.backend().base_data(), mask);
+                }
+
+                template<typename FieldParams>
+                void ct_cmov(fields::detail::element_fp2<FieldParams> &r,
+                             const fields::detail::element_fp2<FieldParams> &a,
+                             ct_mask_type mask) {
+                    ct_cmov(r.data[0], a.data[0], mask);
+                    ct_cmov(r.data[1], a.data[1], mask);
+                }
+
+                template<typename GroupValueType>
+                void ct_cmov_point(GroupValueType &r, const GroupValueType &a, ct_mask_type mask) {
+                    ct_cmov(r.X, a.X, mask);
+                    ct_cmov(r.Y, a.Y, mask);
+                    ct_cmov(r.Z, a.Z, mask);
+                    if constexpr (has_t_coordinate<GroupValueType>::value) {
+                        ct_cmov(r.T, a.T, mask);
+                    }
+                }
+
+                /** @brief Addition formulas used by the regular-schedule ladder, without the
+                 *  special case branches of operator+.
+                 */
+                template<typename Coordinates>
+                struct ct_addition_processor;
+
+                /** @brief Incomplete short Weierstrass formulas with the P == +-Q detection switched off,
+                 *  the ladder never adds equal points and must not branch on intermediates.
+                 */
+                template<typename AdditionProcessor>
+                struct ct_incomplete_addition_processor {
+                    template<typename ElementType>
+                    constexpr static inline ElementType process(const ElementType &first,
+                                                                const ElementType &second) {
+                        return AdditionProcessor::template process<ElementType, false>(first, second);
+                    }
+                };
+
+                template<>
+                struct ct_addition_processor<curves::coordinates::jacobian>
+                    : ct_incomplete_addition_processor<
+                          curves::detail::short_weierstrass_element_g1_jacobian_add_2007_bl> { };
+
+                template<>
+                struct ct_addition_processor<curves::coordinates::jacobian_with_a4_0>
+                    : ct_incomplete_addition_processor<
+                          curves::detail::short_weierstrass_element_g1_jacobian_with_a4_0_add_2007_bl> { };
+
+                template<>
+                struct ct_addition_processor<curves::coordinates::jacobian_with_a4_minus_3>
+                    : ct_incomplete_addition_processor<
+                          curves::detail::short_weierstrass_element_g1_jacobian_with_a4_minus_3_add_2007_bl> { };
+
+                template<>
+                struct ct_addition_processor<curves::coordinates::projective>
+                    : ct_incomplete_addition_processor<
+                          curves::detail::short_weierstrass_element_g1_projective_add_1998_cmo_2> { };
+
+                template<>
+                struct ct_addition_processor<curves::coordinates::projective_with_a4_minus_3>
+                    : ct_incomplete_addition_processor<
+                          curves::detail::short_weierstrass_element_g1_projective_with_a4_minus_3_add_1998_cmo_2> { };
+
+                // Complete on odd order groups, see https://eprint.iacr.org/2015/1060
+                template<>
+                struct ct_addition_processor<curves::coordinates::projective_complete_with_a4_0>
+                    : curves::detail::short_weierstrass_element_g1_projective_complete_with_a4_0_add_2015_rcb { };
+
+                template<>
+                struct ct_addition_processor<curves::coordinates::projective_complete_with_a4_minus_3>
+                    : curves::detail::short_weierstrass_element_g1_projective_complete_with_a4_minus_3_add_2015_rcb { };
+
+                // Complete for square a and non-square d, e.g. jubjub and babyjubjub
+                template<>
+                struct ct_addition_processor<curves::coordinates::extended>
+                    : curves::detail::twisted_edwards_element_g1_extended_add_2008_hwcd { };
+
+                // Complete for a = -1 and non-square d, e.g. edwards25519
+                template<>
+                struct ct_addition_processor<curves::coordinates::extended_with_a_minus_1>
+                    : curves::detail::twisted_edwards_element_g1_extended_with_a_minus_1_add_2008_hwcd_3 { };
+
+                /** @brief Regular signed fixed-window recoding of an odd scalar k < 2^(Window * (N - 1)):
+                 *  k = sum d_i * 2^(Window * i) with every d_i odd, |d_i| < 2^Window and d_(N - 1) = 1.
+                 *  Every window is processed the same way, there are no zero digits to skip.
+                 */
+                template<std::size_t Window, std::size_t N, typename Backend,
+                         multiprecision::expression_template_option ExpressionTemplates>
+                void ct_recode(std::array<std::int32_t, N> &digits,
+                               const multiprecision::number<Backend, ExpressionTemplates> &k) {
+                    std::int32_t carry = 0;
+                    std::int32_t window = 0;
+                    for (std::size_t j = 0; j < Window; ++j) {
+                        window |= static_cast<std::int32_t>(multiprecision::bit_test(k, j)) << j;
+                    }
+
+                    for (std::size_t i = 0; i + 1 < N; ++i) {
+                        std::int32_t next = 0;
+                        for (std::size_t j = 0; j < Window; ++j) {
+                            next |= static_cast<std::int32_t>(multiprecision::bit_test(k, (i + 1) * Window + j)) << j;
+                        }
+                        // current window is odd, borrow 2^Window from it when the next one is even
+                        const std::int32_t next_is_even = (next & 1) ^ 1;
+                        digits[i] = window + carry - (next_is_even << Window);
+                        carry = next_is_even;
+                        window = next;
+                    }
+                    digits[N - 1] = window + carry;
+                }
+            }    // namespace detail
+
+            /** @brief Variable-base scalar multiplication with a regular schedule, meant for secret scalars.
+             *
+             *  The scalar is made odd by replacing an even k with q - k and negating the result, then
+             *  recoded into regular signed windows. Every window costs Window doublings, a scan over
+             *  the whole table of odd multiples with masked copies, a masked negation and one addition,
+             *  so the sequence of group operations and table accesses does not depend on the scalar.
+             *
+             *  This is a regular schedule, not constant time on this backend: cpp_int normalizes its
+             *  limb count, and the field arithmetic as well as the masked copies run over that count,
+             *  so timing still depends on how many leading zero limbs intermediate values have.
+             *
+             *  Short Weierstrass additions are incomplete, but for a base of prime order q and
+             *  0 < k < q the intermediate sums never hit P == +-Q, only the last addition goes
+             *  through the complete operator+. Twisted Edwards curves use complete formulas throughout.
+             *
+             *  Cost is close to the wNAF path: one addition per Window bits instead of per Window + 1.
+             *
+             *  @pre base lies in the prime order subgroup, scalar < q (group order)
+             *  @tparam Window width of the signed windows, table holds 2^(Window - 1) points
+             */
+            template<std::size_t Window = 5, typename GroupValueType, typename Backend,
+                     multiprecision::expression_template_option ExpressionTemplates>
+            GroupValueType ct_scalar_mul(const GroupValueType &base,
+                                         const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                typedef typename GroupValueType::group_type::curve_type::scalar_field_type scalar_field_type;
+                typedef typename scalar_field_type::integral_type integral_type;
+                typedef detail::ct_addition_processor<typename GroupValueType::coordinates> addition_processor;
+
+                static_assert(Window >= 2 && Window <= 8, "unsupported window size");
+                constexpr std::size_t table_size = 1ul << (Window - 1);
+                constexpr std::size_t digits_count = (scalar_field_type::modulus_bits + Window - 1) / Window + 1;
+
+                // Zero is not a valid secret, returning early leaks nothing useful
+                if (scalar.is_zero()) {
+                    return GroupValueType::zero();
+                }
+
+                integral_type k = integral_type(scalar);
+                BOOST_ASSERT(k < scalar_field_type::modulus);
+                integral_type k_negated = scalar_field_type::modulus - k;
+                const detail::ct_mask_type is_even = detail::ct_mask_bit(!multiprecision::bit_test(k, 0));
+                detail::ct_cmov(k, k_negated, is_even);
+
+                std::array<std::int32_t, digits_count> digits;
+                detail::ct_recode<Window>(digits, k);
+
+                std::array<GroupValueType, table_size> table;
+                table[0] = base;
+                const GroupValueType dbl = base.doubled();
+                for (std::size_t i = 1; i < table_size; ++i) {
+                    table[i] = addition_processor::process(table[i - 1], dbl);
+                }
+
+                // digits[digits_count - 1] == 1
+                GroupValueType result = base;
+                for (std::size_t i = digits_count - 1; i-- > 0;) {
+                    for (std::size_t j = 0; j < Window; ++j) {
+                        result = result.doubled();
+                    }
+
+                    const std::int32_t sign = digits[i] >> 31;
+                    const std::uint32_t index = static_cast<std::uint32_t>((digits[i] ^ sign) - sign) >> 1;
+
+                    GroupValueType selected = table[0];
+                    for (std::size_t j = 1; j < table_size; ++j) {
+                        detail::ct_cmov_point(selected, table[j], detail::ct_mask_eq(j, index));
+                    }
+                    detail::ct_cmov_point(selected, -selected, detail::ct_mask_bit(sign));
+
+                    result = i > 0 ? addition_processor::process(result, selected) : result + selected;
+                }
+
+                detail::ct_cmov_point(result, -result, is_even);
+                return result;
+            }
+
+            template<std::size_t Window = 5, typename GroupValueType, typename FieldValueType>
+            typename std::enable_if<is_field<typename FieldValueType::field_type>::value &&
+                                        !is_extended_field<typename FieldValueType::field_type>::value,
+                                    GroupValueType>::type
+                ct_scalar_mul(const GroupValueType &base, const FieldValueType &scalar) {
+                return ct_scalar_mul<Window>(
+                    base, scalar.data.template convert_to<typename FieldValueType::field_type::integral_type>());
+            }
+
+            /** @brief Montgomery ladder on x-only Montgomery points, RFC 7748 section 5.
+             *
+             *  Always runs bits steps of one differential addition and one doubling, the ladder
+             *  registers are exchanged with masked swaps, so the sequence of operations does not
+             *  depend on the scalar. Like ct_scalar_mul, a regular schedule, not constant time on
+             *  this backend.
+             *
+             *  @pre scalar < 2^bits
+             */
+            template<typename CurveParams, typename Backend, multiprecision::expression_template_option ExpressionTemplates>
+            curves::detail::curve_element<CurveParams, curves::forms::montgomery, curves::coordinates::xz>
+                ct_montgomery_ladder(
+                    const curves::detail::curve_element<CurveParams, curves::forms::montgomery, curves::coordinates::xz>
+                        &base,
+                    const multiprecision::number<Backend, ExpressionTemplates> &scalar,
+                    std::size_t bits) {
+                typedef curves::detail::curve_element<CurveParams, curves::forms::montgomery, curves::coordinates::xz>
+                    element_type;
+
+                element_type R0 = element_type::zero();
+                element_type R1 = base;
+                std::uint64_t swap = 0;
+                for (std::size_t i = bits; i-- > 0;) {
+                    const std::uint64_t bit = multiprecision::bit_test(scalar, i);
+                    const detail::ct_mask_type mask = detail::ct_mask_bit(swap ^ bit);
+                    element_type tmp = R0;
+                    detail::ct_cmov(R0.X, R1.X, mask);
+                    detail::ct_cmov(R0.Z, R1.Z, mask);
+                    detail::ct_cmov(R1.X, tmp.X, mask);
+                    detail::ct_cmov(R1.Z, tmp.Z, mask);
+                    swap = bit;
+
+                    R1 = R0.differential_add(R1, base);
+                    R0 = R0.doubled();
+                }
+                const detail::ct_mask_type mask = detail::ct_mask_bit(swap);
+                detail::ct_cmov(R0.X, R1.X, mask);
+                detail::ct_cmov(R0.Z, R1.Z, mask);
+
+                return R0;
+            }
+
+            /** @brief X25519 function of RFC 7748 on field elements: the u-coordinate of the clamped
+             *  scalar times the point with u-coordinate u. The final inversion is a fixed
+             *  exponentiation, the point at infinity maps to u = 0.
+             */
+            inline curves::curve25519::base_field_type::value_type
+                x25519(const curves::curve25519::base_field_type::integral_type &scalar,
+                       const curves::curve25519::base_field_type::value_type &u) {
+                typedef curves::curve25519::base_field_type base_field_type;
+                typedef curves::curve25519::g1_type<>::value_type element_type;
+
+                typename base_field_type::integral_type k = scalar;
+                multiprecision::bit_unset(k, 0);
+                multiprecision::bit_unset(k, 1);
+                multiprecision::bit_unset(k, 2);
+                multiprecision::bit_set(k, 254);
+
+                const element_type R = ct_montgomery_ladder(element_type(u), k, 255);
+                return R.X * R.Z.pow(base_field_type::integral_type(base_field_type::modulus - 2));
+            }
+
+            /** @brief X25519 function of RFC 7748 on 32 byte little-endian strings.
+             *  The most significant bit of u is ignored and non-canonical values of u are accepted.
+             */
+            inline std::array<std::uint8_t, 32> x25519(const std::array<std::uint8_t, 32> &scalar,
+                                                       const std::array<std::uint8_t, 32> &u) {
+                typedef curves::curve25519::base_field_type base_field_type;
+                typedef base_field_type::integral_type integral_type;
+
+                integral_type k = 0, x = 0;
+                for (std::size_t i = 32; i-- > 0;) {
+                    k = (k << 8) | integral_type(i == 31 ? scalar[i] & 0x7f : scalar[i]);
+                    x = (x << 8) | integral_type(i == 31 ? u[i] & 0x7f : u[i]);
+                }
+                if (x >= base_field_type::modulus) {
+                    x -= base_field_type::modulus;
+                }
+
+                integral_type result =
+                    x25519(k, base_field_type::value_type(x)).data.template convert_to<integral_type>();
+
+                std::array<std::uint8_t, 32> out;
+                for (std::size_t i = 0; i < 32; ++i) {
+                    out[i] = static_cast<std::uint8_t>(static_cast<unsigned>(result & 0xff));
+                    result >>= 8;
+                }
+                return out;
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CT_SCALAR_MUL_HPP
@@ -74,4 +74,7 @@ namespace nil {
     }            // namespace crypto3
 }    // namespace nil
 
+// Specializes wnaf_params for the groups above, so it has to come after them
+#include <nil/crypto3/algebra/curves/params/wnaf/alt_bn128.hpp>
+
 #endif    // CRYPTO3_ALGEBRA_CURVES_ALT_BN128_HPP
@@ -28,6 +28,7 @@
 
 #include <nil/crypto3/algebra/curves/detail/curve25519/types.hpp>
 #include <nil/crypto3/algebra/curves/detail/curve25519/g1.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/coordinates.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -45,8 +46,7 @@ namespace nil {
                     typedef typename policy_type::base_field_type base_field_type;
                     typedef typename policy_type::scalar_field_type scalar_field_type;
 
-                    template<typename Coordinates = coordinates::extended_with_a_minus_1,
-                             typename Form = forms::montgomery>
+                    template<typename Coordinates = coordinates::xz, typename Form = forms::montgomery>
                     using g1_type = typename detail::curve25519_g1<Form, Coordinates>;
                 };
             }    // namespace curves
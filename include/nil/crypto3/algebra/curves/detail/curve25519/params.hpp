@@ -51,6 +51,10 @@ namespace nil {
                         constexpr static typename curve25519_types::integral_type b =
                             typename curve25519_types::integral_type(
                                 0x01);    ///< coefficient of Montgomery curve $b*y^2=x^3+a*x^2+x$
+
+                        // Montgomery representation constants A and B, as used by the Montgomery form elements
+                        constexpr static typename curve25519_types::integral_type A = a;
+                        constexpr static typename curve25519_types::integral_type B = b;
                     };
 
                     template<>
@@ -123,6 +127,8 @@ namespace nil {
 #else
                     constexpr typename curve25519_types::integral_type curve25519_params<forms::montgomery>::a;
                     constexpr typename curve25519_types::integral_type curve25519_params<forms::montgomery>::b;
+                    constexpr typename curve25519_types::integral_type curve25519_params<forms::montgomery>::A;
+                    constexpr typename curve25519_types::integral_type curve25519_params<forms::montgomery>::B;
 
                     constexpr std::array<typename curve25519_g1_params<forms::montgomery>::field_type::value_type, 2>
                         curve25519_g1_params<forms::montgomery>::zero_fill;
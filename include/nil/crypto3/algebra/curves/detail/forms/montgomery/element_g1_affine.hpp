@@ -30,6 +30,7 @@
 #include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
 #include <nil/crypto3/algebra/curves/forms.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/montgomery/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/element_g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
 
 namespace nil {
@@ -164,21 +165,18 @@ namespace nil {
 
                         /*************************  Reducing operations  ***********************************/
 
-                        // /** @brief
-                        //  *
-                        //  * See https://eprint.iacr.org/2017/212.pdf, p. 7, par. 3.
-                        //  *
-                        //  * @return return the corresponding element from affine coordinates to
-                        //  xz coordinates
-                        //  */
-                        // constexpr curve_element<params_type, form, typename curves::coordinates::xz> to_xz() const {
-                        //     using result_type = curve_element<params_type, form, typename curves::coordinates::xz>;
-                        //
-                        //     return this->is_zero() ? result_type(result_type::field_type::value_type::one(),
-                        //                                          result_type::field_type::value_type::zero()) :
-                        //                              result_type(this->X,
-                        //                              result_type::field_type::value_type::one());
-                        // }
+                        /** @brief
+                         *
+                         * See https://eprint.iacr.org/2017/212.pdf, p. 7, par. 3.
+                         *
+                         * @return return the corresponding element from affine coordinates to
+                         xz coordinates
+                         */
+                        constexpr curve_element<params_type, form, typename curves::coordinates::xz> to_xz() const {
+                            using result_type = curve_element<params_type, form, typename curves::coordinates::xz>;
+
+                            return this->is_zero() ? result_type::zero() : result_type(this->X);
+                        }
 
                         /**
                          * @brief
@@ -0,0 +1,284 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_HPP
+#define CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_HPP
+
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/coordinates.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief A struct representing a group G1 of elliptic curve.
+                     *    @tparam CurveParams Parameters of the group
+                     *    @tparam Form Form of the curve
+                     *    @tparam Coordinates Representation coordinates of the group element
+                     */
+                    template<typename CurveParams, typename Form, typename Coordinates>
+                    class curve_element;
+
+                    /**
+                     * @brief A struct representing an element from the group G1 of Montgomery curve of
+                     *  XZ coordinates representation, x = X / Z. The y coordinate is dropped, so P and -P
+                     *  have the same representation and only differential addition is available.
+                     *  Description: https://hyperelliptic.org/EFD/g1p/auto-montgom-xz.html
+                     *
+                     */
+                    template<typename CurveParams>
+                    class curve_element<CurveParams, forms::montgomery, coordinates::xz> {
+                    public:
+                        using field_type = typename CurveParams::field_type;
+
+                    private:
+                        using params_type = CurveParams;
+                        using field_value_type = typename field_type::value_type;
+
+                    public:
+                        using form = forms::montgomery;
+                        using coordinates = coordinates::xz;
+
+                        using group_type = typename params_type::template group_type<coordinates>;
+
+                        field_value_type X;
+                        field_value_type Z;
+
+                        /*************************  Constructors and zero/one  ***********************************/
+                        /**
+                         * @brief
+                         *    @return the point at infinity by default
+                         *
+                         */
+                        constexpr curve_element() :
+                            curve_element(field_value_type::one(), field_value_type::zero()) {};
+
+                        /**
+                         * @brief
+                         *    @return the selected point $(X:Z)$ in the XZ coordinates
+                         */
+                        constexpr curve_element(const field_value_type &in_X, const field_value_type &in_Z) :
+                            X(in_X), Z(in_Z) {};
+
+                        /**
+                         * @brief
+                         *    @return the point with affine x coordinate in_x
+                         */
+                        explicit constexpr curve_element(const field_value_type &in_x) :
+                            X(in_x), Z(field_value_type::one()) {};
+
+                        /**
+                         * @brief Get the point at infinity
+                         */
+                        constexpr static curve_element zero() {
+                            return curve_element();
+                        }
+
+                        /**
+                         * @brief Get the generator of group G1
+                         */
+                        constexpr static curve_element one() {
+                            return curve_element(params_type::one_fill[0]);
+                        }
+
+                        /**
+                         * @brief (A - 2) / 4, the constant of the doubling in the RFC 7748 convention, which is
+                         * 121665 for Curve25519. EFD uses (A + 2) / 4 instead, see doubled()
+                         */
+                        static const field_value_type &a24() {
+                            static const field_value_type value =
+                                (field_value_type(params_type::A) - field_value_type(2)) *
+                                field_value_type(4).inversed();
+                            return value;
+                        }
+
+                        /*************************  Comparison operations  ***********************************/
+
+                        constexpr bool operator==(const curve_element &other) const {
+                            if (this->is_zero()) {
+                                return other.is_zero();
+                            }
+
+                            if (other.is_zero()) {
+                                return false;
+                            }
+
+                            /* now neither is O */
+
+                            return (this->X * other.Z) == (other.X * this->Z);
+                        }
+
+                        constexpr bool operator!=(const curve_element &other) const {
+                            return !(operator==(other));
+                        }
+
+                        /**
+                         * @brief
+                         *
+                         * @return true if element from group G1 is the point at infinity
+                         */
+                        constexpr bool is_zero() const {
+                            return this->Z.is_zero();
+                        }
+
+                        /**
+                         * @brief Check that x = X / Z belongs to a point of the curve b*y^2 = x^3 + a*x^2 + x,
+                         * i.e. that (x^3 + a*x^2 + x) / b is a square
+                         *
+                         * @return true if element from group G1 lies on the elliptic curve
+                         */
+                        constexpr bool is_well_formed() const {
+                            if (this->is_zero()) {
+                                return true;
+                            } else {
+                                // multiplied by Z^4 to stay projective
+                                const field_value_type XX = this->X.squared();
+                                const field_value_type ZZ = this->Z.squared();
+                                const field_value_type rhs =
+                                    this->X * this->Z * (XX + field_value_type(params_type::A) * this->X * this->Z + ZZ);
+
+                                return (rhs * field_value_type(params_type::B)).is_square();
+                            }
+                        }
+
+                        /*************************  Reducing operations  ***********************************/
+
+                        /**
+                         * @brief
+                         *
+                         * @return the same point with Z = 1
+                         */
+                        constexpr curve_element to_affine() const {
+                            if (this->is_zero()) {
+                                return *this;
+                            }
+
+                            return curve_element(this->X * this->Z.inversed());
+                        }
+
+                        /*************************  Arithmetic operations  ***********************************/
+
+                        /**
+                         * @brief x-only negation is the identity
+                         *
+                         * @return negative element from group G1
+                         */
+                        constexpr curve_element operator-() const {
+                            return *this;
+                        }
+
+                        template<typename Backend,
+                                 multiprecision::expression_template_option ExpressionTemplates>
+                        constexpr curve_element& operator*=(const multiprecision::number<Backend, ExpressionTemplates> &right) {
+                            (*this) = (*this) * right;
+                            return *this;
+                        }
+
+                        /**
+                         * @brief Doubling step of the Montgomery ladder, RFC 7748 section 5:
+                         *
+                         * A = X1+Z1, AA = A^2, B = X1-Z1, BB = B^2, C = AA-BB
+                         * X3 = AA*BB
+                         * Z3 = C*(AA+a24*C)
+                         *
+                         * with a24 = (A-2)/4. This is the doubling of ladd-1987-m (and dbl-1987-m-3), see
+                         * https://hyperelliptic.org/EFD/g1p/auto-montgom-xz.html, which writes
+                         * Z3 = C*(BB+a24'*C) with a24' = (A+2)/4; both agree since AA = BB+C.
+                         *
+                         * @return doubled element from group G1
+                         */
+                        constexpr curve_element doubled() const {
+                            const field_value_type AA = (this->X + this->Z).squared();
+                            const field_value_type BB = (this->X - this->Z).squared();
+                            const field_value_type C = AA - BB;
+
+                            return curve_element(AA * BB, C * (AA + a24() * C));
+                        }
+
+                        /**
+                         * @brief Differential addition formulas dadd-1987-m-3, P + Q given P, Q and P - Q:
+                         *
+                         * A = X2+Z2, B = X2-Z2, C = X3+Z3, D = X3-Z3, DA = D*A, CB = C*B
+                         * X5 = Z1*(DA+CB)^2
+                         * Z5 = X1*(DA-CB)^2
+                         *
+                         * where (X1:Z1) = P - Q, (X2:Z2) = P, (X3:Z3) = Q.
+                         * See https://hyperelliptic.org/EFD/g1p/auto-montgom-xz.html
+                         *
+                         * @pre difference is not the point at infinity, i.e. P != Q
+                         * @return P + Q
+                         */
+                        constexpr curve_element differential_add(const curve_element &other,
+                                                                 const curve_element &difference) const {
+                            const field_value_type DA = (other.X - other.Z) * (this->X + this->Z);
+                            const field_value_type CB = (other.X + other.Z) * (this->X - this->Z);
+
+                            return curve_element(difference.Z * (DA + CB).squared(),
+                                                 difference.X * (DA - CB).squared());
+                        }
+                    };
+
+                    /**
+                     * @brief Montgomery ladder on XZ coordinates. Keeps R1 - R0 = base, so every step is one
+                     * differential addition and one doubling.
+                     *
+                     * Branches on the bits of scalar, use ct_montgomery_ladder for secret scalars.
+                     */
+                    template<typename CurveParams, typename Backend,
+                             multiprecision::expression_template_option ExpressionTemplates>
+                    constexpr curve_element<CurveParams, forms::montgomery, coordinates::xz>
+                        montgomery_ladder(const curve_element<CurveParams, forms::montgomery, coordinates::xz> &base,
+                                          const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                        using element_type = curve_element<CurveParams, forms::montgomery, coordinates::xz>;
+
+                        if (scalar.is_zero() || base.is_zero()) {
+                            return element_type::zero();
+                        }
+
+                        element_type R0 = element_type::zero();
+                        element_type R1 = base;
+                        for (std::size_t i = multiprecision::msb(scalar) + 1; i > 0; --i) {
+                            if (multiprecision::bit_test(scalar, i - 1)) {
+                                R0 = R1.differential_add(R0, base);
+                                R1 = R1.doubled();
+                            } else {
+                                R1 = R0.differential_add(R1, base);
+                                R0 = R0.doubled();
+                            }
+                        }
+
+                        return R0;
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_HPP
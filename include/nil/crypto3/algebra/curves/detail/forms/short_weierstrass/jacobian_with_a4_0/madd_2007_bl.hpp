@@ -35,12 +35,14 @@ namespace nil {
                     /** @brief A struct representing element addition from the group G1 of short Weierstrass curve
                      *  for jacobian_with_a4_0 coordinates representation.
                      *  NOTE: does not handle O and pts of order 2,4
+                     *  P == Q and P == -Q are caught from H == 0 instead of an operator== pre-check,
+                     *  DetectEqualPoints = false drops the check for callers which exclude them.
                      *  http://www.hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-0.html#addition-madd-2007-bl
                      */
 
                     struct short_weierstrass_element_g1_jacobian_with_a4_0_madd_2007_bl {
 
-                        template<typename ElementType>
+                        template<typename ElementType, bool DetectEqualPoints = true>
                         constexpr static inline ElementType process(const ElementType &first,
                                                                     const ElementType &second) {
 
@@ -53,6 +55,14 @@ namespace nil {
                             const field_value_type U2 = second.X * Z1Z1;                  // X2*Z1Z1
                             const field_value_type S2 = second.Y * first.Z * Z1Z1;        // S2 = Y2 * Z1 * Z1Z1
                             const field_value_type H = U2 - (first.X);                    // H = U2-X1
+
+                            if constexpr (DetectEqualPoints) {
+                                // X1 == U2 means P == +-Q, S2 == Y1 tells doubling from P + (-P) = O
+                                if (H.is_zero()) {
+                                    return S2 == first.Y ? first.doubled() : ElementType::zero();
+                                }
+                            }
+
                             const field_value_type HH = H.squared();                      // HH = H^2
                             const field_value_type I = HH.doubled().doubled();            // I = 4*HH
                             const field_value_type J = H * I;                             // J = H*I
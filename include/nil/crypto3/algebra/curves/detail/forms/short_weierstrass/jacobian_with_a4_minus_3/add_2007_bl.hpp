@@ -35,12 +35,14 @@ namespace nil {
                     /** @brief A struct representing element addition from the group G1 of short Weierstrass curve
                      *  for jacobian_with_a4_minus_3 coordinates representation.
                      *  NOTE: does not handle O and pts of order 2,4
+                     *  P == Q and P == -Q are caught from H == 0 instead of an operator== pre-check,
+                     *  DetectEqualPoints = false drops the check for callers which exclude them.
                      *  http://www.hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-0.html#addition-add-2007-bl
                      */
 
                     struct short_weierstrass_element_g1_jacobian_with_a4_minus_3_add_2007_bl {
 
-                        template<typename ElementType>
+                        template<typename ElementType, bool DetectEqualPoints = true>
                         constexpr static inline ElementType process(const ElementType &first,
                                                                     const ElementType &second) {
 
@@ -54,6 +56,14 @@ namespace nil {
                             field_value_type S2 = (second.Y) * (first.Z) * Z1Z1;    // S2 = Y2 * Z1 * Z1Z1
                             field_value_type H = U2 - U1;                           // H = U2-U1
                             field_value_type S2_minus_S1 = S2 - S1;
+
+                            if constexpr (DetectEqualPoints) {
+                                // U1 == U2 means P == +-Q, S1 == S2 tells doubling from P + (-P) = O
+                                if (H.is_zero()) {
+                                    return S2_minus_S1.is_zero() ? first.doubled() : ElementType::zero();
+                                }
+                            }
+
                             field_value_type I = (H + H).squared();             // I = (2 * H)^2
                             field_value_type J = H * I;                         // J = H * I
                             field_value_type r = S2_minus_S1 + S2_minus_S1;     // r = 2 * (S2-S1)
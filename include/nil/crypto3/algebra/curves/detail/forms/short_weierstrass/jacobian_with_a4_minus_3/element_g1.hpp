@@ -265,10 +265,7 @@ namespace nil {
                                 return (*this);
                             }
 
-                            if (*this == other) {
-                                return this->doubled();
-                            }
-
+                            // P == Q and P == -Q are detected by the addition formula itself
                             return common_addition_processor::process(*this, other);
                         }
 
@@ -278,8 +275,6 @@ namespace nil {
                                 *this = other;
                             } else if (other.is_zero()) {
                                 // Do nothing.
-                            } else if (*this == other) {
-                                *this = this->doubled();
                             } else {
                                 *this = common_addition_processor::process(*this, other);
                             }
@@ -35,12 +35,14 @@ namespace nil {
                     /** @brief A struct representing element addition from the group G1 of short Weierstrass curve
                      *  for projective coordinates representation.
                      *  NOTE: does not handle O and pts of order 2,4
+                     *  P == Q and P == -Q are caught from v == 0 instead of an operator== pre-check,
+                     *  DetectEqualPoints = false drops the check for callers which exclude them.
                      *  http://www.hyperelliptic.org/EFD/g1p/auto-shortw-projective.html#addition-add-1998-cmo-2
                      */
 
                     struct short_weierstrass_element_g1_projective_add_1998_cmo_2 {
 
-                        template<typename ElementType>
+                        template<typename ElementType, bool DetectEqualPoints = true>
                         constexpr static inline ElementType process(const ElementType &first,
                                                                     const ElementType &second) {
 
@@ -52,6 +54,14 @@ namespace nil {
                             const field_value_type u = (second.Y) * (first.Z) - Y1Z2;    // u    = Y2*Z1-Y1Z2
                             const field_value_type uu = u.squared();                     // uu   = u^2
                             const field_value_type v = (second.X) * (first.Z) - X1Z2;    // v    = X2*Z1-X1Z2
+
+                            if constexpr (DetectEqualPoints) {
+                                // X1/Z1 == X2/Z2 means P == +-Q, u == 0 tells doubling from P + (-P) = O
+                                if (v.is_zero()) {
+                                    return u.is_zero() ? first.doubled() : ElementType::zero();
+                                }
+                            }
+
                             const field_value_type vv = v.squared();                     // vv   = v^2
                             const field_value_type vvv = v * vv;                         // vvv  = v*vv
                             const field_value_type R = vv * X1Z2;                        // R    = vv*X1Z2
@@ -0,0 +1,80 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_0_ADD_2015_RCB_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_0_ADD_2015_RCB_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief A struct representing element addition from the group G1 of short Weierstrass curve
+                     *  for projective_complete_with_a4_0 coordinates representation.
+                     *  Complete: handles O, doubling and P + (-P) without branches on odd order curves.
+                     *  Renes, Costello, Batina, "Complete addition formulas for prime order elliptic curves",
+                     *  https://eprint.iacr.org/2015/1060, Algorithm 7
+                     */
+
+                    struct short_weierstrass_element_g1_projective_complete_with_a4_0_add_2015_rcb {
+
+                        template<typename ElementType>
+                        constexpr static inline ElementType process(const ElementType &first,
+                                                                    const ElementType &second) {
+
+                            using params_type = typename ElementType::params_type;
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            field_value_type t0 = first.X * second.X;                  // t0 = X1*X2
+                            field_value_type t1 = first.Y * second.Y;                  // t1 = Y1*Y2
+                            field_value_type t2 = first.Z * second.Z;                  // t2 = Z1*Z2
+                            field_value_type t3 = (first.X + first.Y) * (second.X + second.Y);
+                            t3 -= t0 + t1;                                             // t3 = X1*Y2+X2*Y1
+                            field_value_type t4 = (first.Y + first.Z) * (second.Y + second.Z);
+                            t4 -= t1 + t2;                                             // t4 = Y1*Z2+Y2*Z1
+                            field_value_type Y3 = (first.X + first.Z) * (second.X + second.Z);
+                            Y3 -= t0 + t2;                                             // Y3 = X1*Z2+X2*Z1
+                            t0 = t0 + t0 + t0;                                         // t0 = 3*X1*X2
+                            const field_value_type bt2 = params_type::b * t2;
+                            t2 = bt2 + bt2 + bt2;                                      // t2 = b3*Z1*Z2
+                            field_value_type Z3 = t1 + t2;
+                            t1 -= t2;
+                            const field_value_type bY3 = params_type::b * Y3;
+                            Y3 = bY3 + bY3 + bY3;                                      // Y3 = b3*Y3
+                            const field_value_type X3 = t3 * t1 - t4 * Y3;
+                            Y3 = t1 * Z3 + Y3 * t0;
+                            Z3 = Z3 * t4 + t0 * t3;
+
+                            return ElementType(X3, Y3, Z3);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_0_ADD_2015_RCB_HPP
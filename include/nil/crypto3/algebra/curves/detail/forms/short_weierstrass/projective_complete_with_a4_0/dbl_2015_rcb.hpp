@@ -0,0 +1,73 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_0_DBL_2015_RCB_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_0_DBL_2015_RCB_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief A struct representing element doubling from the group G1 of short Weierstrass curve
+                     *  for projective_complete_with_a4_0 coordinates representation.
+                     *  Exception-free: doubles O to O.
+                     *  https://eprint.iacr.org/2015/1060, Algorithm 9
+                     */
+
+                    struct short_weierstrass_element_g1_projective_complete_with_a4_0_dbl_2015_rcb {
+
+                        template<typename ElementType>
+                        constexpr static inline ElementType process(const ElementType &first) {
+
+                            using params_type = typename ElementType::params_type;
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            field_value_type t0 = first.Y.squared();                   // t0 = Y^2
+                            field_value_type Z3 = t0 + t0;
+                            Z3 += Z3;
+                            Z3 += Z3;                                                  // Z3 = 8*Y^2
+                            const field_value_type t1 = first.Y * first.Z;             // t1 = Y*Z
+                            const field_value_type bZZ = params_type::b * first.Z.squared();
+                            const field_value_type t2 = bZZ + bZZ + bZZ;               // t2 = b3*Z^2
+                            field_value_type X3 = t2 * Z3;
+                            field_value_type Y3 = t0 + t2;
+                            Z3 = t1 * Z3;
+                            t0 -= t2 + t2 + t2;
+                            Y3 = t0 * Y3 + X3;
+                            X3 = t0 * (first.X * first.Y);
+                            X3 += X3;
+
+                            return ElementType(X3, Y3, Z3);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_0_DBL_2015_RCB_HPP
@@ -0,0 +1,78 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_MINUS_3_ADD_2015_RCB_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_MINUS_3_ADD_2015_RCB_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief A struct representing element addition from the group G1 of short Weierstrass curve
+                     *  for projective_complete_with_a4_minus_3 coordinates representation.
+                     *  Complete: handles O, doubling and P + (-P) without branches on odd order curves.
+                     *  Renes, Costello, Batina, "Complete addition formulas for prime order elliptic curves",
+                     *  https://eprint.iacr.org/2015/1060, Algorithm 4
+                     */
+
+                    struct short_weierstrass_element_g1_projective_complete_with_a4_minus_3_add_2015_rcb {
+
+                        template<typename ElementType>
+                        constexpr static inline ElementType process(const ElementType &first,
+                                                                    const ElementType &second) {
+
+                            using params_type = typename ElementType::params_type;
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            field_value_type t0 = first.X * second.X;                  // t0 = X1*X2
+                            field_value_type t1 = first.Y * second.Y;                  // t1 = Y1*Y2
+                            field_value_type t2 = first.Z * second.Z;                  // t2 = Z1*Z2
+                            field_value_type t3 = (first.X + first.Y) * (second.X + second.Y);
+                            t3 -= t0 + t1;                                             // t3 = X1*Y2+X2*Y1
+                            field_value_type t4 = (first.Y + first.Z) * (second.Y + second.Z);
+                            t4 -= t1 + t2;                                             // t4 = Y1*Z2+Y2*Z1
+                            field_value_type Y3 = (first.X + first.Z) * (second.X + second.Z);
+                            Y3 -= t0 + t2;                                             // Y3 = X1*Z2+X2*Z1
+                            field_value_type X3 = Y3 - params_type::b * t2;
+                            X3 = X3 + X3 + X3;                                         // X3 = 3*(Y3-b*t2)
+                            const field_value_type Z3 = t1 - X3;
+                            X3 += t1;
+                            t2 = t2 + t2 + t2;                                         // t2 = 3*Z1*Z2
+                            Y3 = params_type::b * Y3 - t2 - t0;
+                            Y3 = Y3 + Y3 + Y3;                                         // Y3 = 3*(b*Y3-t2-t0)
+                            t0 = t0 + t0 + t0 - t2;                                    // t0 = 3*X1*X2-t2
+
+                            return ElementType(t3 * X3 - t4 * Y3, X3 * Z3 + t0 * Y3, t4 * Z3 + t3 * t0);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_MINUS_3_ADD_2015_RCB_HPP
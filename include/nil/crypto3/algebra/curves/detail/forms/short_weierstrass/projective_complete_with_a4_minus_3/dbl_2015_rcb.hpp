@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_MINUS_3_DBL_2015_RCB_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_MINUS_3_DBL_2015_RCB_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief A struct representing element doubling from the group G1 of short Weierstrass curve
+                     *  for projective_complete_with_a4_minus_3 coordinates representation.
+                     *  Exception-free: doubles O to O.
+                     *  https://eprint.iacr.org/2015/1060, Algorithm 6
+                     */
+
+                    struct short_weierstrass_element_g1_projective_complete_with_a4_minus_3_dbl_2015_rcb {
+
+                        template<typename ElementType>
+                        constexpr static inline ElementType process(const ElementType &first) {
+
+                            using params_type = typename ElementType::params_type;
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            field_value_type t0 = first.X.squared();                   // t0 = X^2
+                            const field_value_type t1 = first.Y.squared();             // t1 = Y^2
+                            field_value_type t2 = first.Z.squared();                   // t2 = Z^2
+                            field_value_type t3 = first.X * first.Y;
+                            t3 += t3;                                                  // t3 = 2*X*Y
+                            field_value_type Z3 = first.X * first.Z;
+                            Z3 += Z3;                                                  // Z3 = 2*X*Z
+                            field_value_type Y3 = params_type::b * t2 - Z3;
+                            Y3 = Y3 + Y3 + Y3;                                         // Y3 = 3*(b*t2-Z3)
+                            field_value_type X3 = t1 - Y3;
+                            Y3 = X3 * (t1 + Y3);
+                            X3 *= t3;
+                            t2 = t2 + t2 + t2;                                         // t2 = 3*Z^2
+                            Z3 = params_type::b * Z3 - t2 - t0;
+                            Z3 = Z3 + Z3 + Z3;                                         // Z3 = 3*(b*Z3-t2-t0)
+                            t0 = t0 + t0 + t0 - t2;                                    // t0 = 3*X^2-t2
+                            Y3 += t0 * Z3;
+                            t0 = first.Y * first.Z;
+                            t0 += t0;                                                  // t0 = 2*Y*Z
+                            X3 -= t0 * Z3;
+                            Z3 = t0 * t1;
+                            Z3 += Z3;
+                            Z3 += Z3;                                                  // Z3 = 8*Y^3*Z
+
+                            return ElementType(X3, Y3, Z3);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_MINUS_3_DBL_2015_RCB_HPP
@@ -0,0 +1,291 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_MINUS_3_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_MINUS_3_HPP
+
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_complete_with_a4_minus_3/add_2015_rcb.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_complete_with_a4_minus_3/dbl_2015_rcb.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_complete_with_a4_minus_3/madd_2015_rcb.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/element_g1_affine.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing a group G1 of elliptic curve.
+                     *    @tparam CurveParams Parameters of the group
+                     *    @tparam Form Form of the curve
+                     *    @tparam Coordinates Representation coordinates of the group element
+                     */
+                    template<typename CurveParams, typename Form, typename Coordinates>
+                    class curve_element;
+
+                    /** @brief A struct representing an element from the group G1 of short Weierstrass curve of
+                     *  projective coordinates representation with complete addition formulas for a4 = -3.
+                     *  Addition handles O, doubling and inverse points by the formula itself, so there are
+                     *  no branches and no equality check on the addition path. Valid on odd order (sub)groups,
+                     *  e.g. secp256r1 and the other NIST P-curves.
+                     *  Description: https://eprint.iacr.org/2015/1060
+                     *
+                     */
+                    template<typename CurveParams>
+                    class curve_element<CurveParams, forms::short_weierstrass, coordinates::projective_complete_with_a4_minus_3> {
+                    public:
+
+                        using params_type = CurveParams;
+                        using field_type = typename params_type::field_type;
+
+                    private:
+                        using field_value_type = typename field_type::value_type;
+
+                        using common_addition_processor = short_weierstrass_element_g1_projective_complete_with_a4_minus_3_add_2015_rcb;
+                        using common_doubling_processor = short_weierstrass_element_g1_projective_complete_with_a4_minus_3_dbl_2015_rcb;
+                        using mixed_addition_processor = short_weierstrass_element_g1_projective_complete_with_a4_minus_3_madd_2015_rcb;
+
+                    public:
+                        using form = forms::short_weierstrass;
+                        using coordinates = coordinates::projective_complete_with_a4_minus_3;
+
+                        using group_type = typename params_type::template group_type<coordinates>;
+
+                        field_value_type X;
+                        field_value_type Y;
+                        field_value_type Z;
+
+                        /*************************  Constructors and zero/one  ***********************************/
+
+                        /** @brief
+                         *    @return the point at infinity by default
+                         *
+                         */
+                        constexpr curve_element() :
+                            curve_element(params_type::zero_fill[0],
+                                          params_type::zero_fill[1],
+                                          field_value_type::zero()) {}
+
+                        /** @brief
+                         *    @return the selected point (X:Y:Z)
+                         *
+                         */
+                        constexpr curve_element(const field_value_type& X, const field_value_type& Y, const field_value_type& Z) 
+                            : X(X), Y(Y), Z(Z) 
+                        { } 
+
+                        template<typename Backend,
+                                 multiprecision::expression_template_option ExpressionTemplates>
+                        explicit constexpr curve_element(
+                                  const multiprecision::number<Backend, ExpressionTemplates> &value) {
+                            *this = one() * value;
+                        }
+
+                        /** @brief Get the point at infinity
+                         *
+                         */
+                        constexpr static curve_element zero() {
+                            return curve_element();
+                        }
+
+                        /** @brief Get the generator of group G1
+                         *
+                         */
+                        constexpr static curve_element one() {
+                            return curve_element(params_type::one_fill[0], params_type::one_fill[1],
+                                                 field_value_type::one());
+                        }
+
+                        /*************************  Comparison operations  ***********************************/
+
+                        constexpr bool operator==(const curve_element &other) const {
+                            if (this->is_zero()) {
+                                return other.is_zero();
+                            }
+
+                            if (other.is_zero()) {
+                                return false;
+                            }
+
+                            /* now neither is O */
+
+                            // X1/Z1 = X2/Z2 <=> X1*Z2 = X2*Z1
+                            if ((this->X * other.Z) != (other.X * this->Z)) {
+                                return false;
+                            }
+
+                            // Y1/Z1 = Y2/Z2 <=> Y1*Z2 = Y2*Z1
+                            if ((this->Y * other.Z) != (other.Y * this->Z)) {
+                                return false;
+                            }
+
+                            return true;
+                        }
+
+                        constexpr bool operator!=(const curve_element &other) const {
+                            return !(operator==(other));
+                        }
+                        /** @brief
+                         *
+                         * @return true if element from group G1 is the point at infinity
+                         */
+                        constexpr bool is_zero() const {
+                            return (this->X.is_zero() && this->Z.is_zero());
+                        }
+
+                        /** @brief
+                         *
+                         * @return true if element from group G1 lies on the elliptic curve
+                         */
+                        constexpr bool is_well_formed() const {
+                            if (this->is_zero()) {
+                                return true;
+                            } else {
+                                /*
+                                  y^2 = x^3 - 3x + b
+
+                                  We are using projective, so equation we need to check is actually
+
+                                  z (y^2 - b z^2) = x (x^2 - 3 z^2)
+                                */
+                                const field_value_type Z2 = this->Z.squared();
+
+                                return (this->Z * (this->Y.squared() - params_type::b * Z2) ==
+                                        this->X * (this->X.squared() - (Z2 + Z2 + Z2)));
+                            }
+                        }
+
+                        /*************************  Reducing operations  ***********************************/
+
+                        /** @brief
+                         *
+                         * @return return the corresponding element from projective coordinates to
+                         * affine coordinates
+                         */
+                        constexpr curve_element<params_type, form, typename curves::coordinates::affine>
+                            to_affine() const {
+
+                            using result_type = curve_element<params_type, form, typename curves::coordinates::affine>;
+
+                            if (is_zero()) {
+                                return result_type::zero();
+                            }
+
+                            const field_value_type Z_inv = Z.inversed();
+                            return result_type(X * Z_inv, Y * Z_inv);    //  x=X/Z, y=Y/Z
+                        }
+
+                        /*************************  Arithmetic operations  ***********************************/
+
+                        constexpr curve_element& operator=(const curve_element &other) {
+                            this->X = other.X;
+                            this->Y = other.Y;
+                            this->Z = other.Z;
+
+                            return *this;
+                        }
+
+                        template<typename Backend,
+                                 multiprecision::expression_template_option ExpressionTemplates>
+                        constexpr const curve_element& operator=(
+                                  const multiprecision::number<Backend, ExpressionTemplates> &value) {
+                            *this = one() * value;
+                            return *this;
+                        }
+
+                        /** @brief
+                         *
+                         * Complete addition, O and P == Q are handled by the formula itself.
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr curve_element operator+(const curve_element &other) const {
+                            return common_addition_processor::process(*this, other);
+                        }
+
+                        constexpr curve_element& operator+=(const curve_element &other) {
+                            *this = common_addition_processor::process(*this, other);
+                            return *this;
+                        }
+
+                        constexpr curve_element operator-() const {
+                            return curve_element(this->X, -this->Y, this->Z);
+                        }
+
+                        constexpr curve_element operator-(const curve_element &other) const {
+                            return (*this) + (-other);
+                        }
+
+                        constexpr curve_element& operator-=(const curve_element &other) {
+                            return (*this) += (-other);
+                        }
+
+                        template<typename Backend,
+                             multiprecision::expression_template_option ExpressionTemplates>
+                        constexpr curve_element& operator*=(const multiprecision::number<Backend, ExpressionTemplates> &right) {
+                            (*this) = (*this) * right;
+                            return *this;
+                        }
+
+                        template<typename FieldValueType>
+                        typename std::enable_if<is_field<typename FieldValueType::field_type>::value &&
+                                                !is_extended_field<typename FieldValueType::field_type>::value,
+                                                curve_element>::type
+                            operator*=(const FieldValueType &right) {
+                                return (*this) *= right.data;
+                        }
+
+                        /** @brief
+                         *
+                         * @return doubled element from group G1
+                         */
+                        constexpr curve_element doubled() const {
+                            return common_doubling_processor::process(*this);
+                        }
+
+                        /** @brief
+                         *
+                         * “Mixed addition” refers to the case Z2 known to be 1.
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr curve_element mixed_add(const curve_element &other) const {
+
+                            // O can not have Z = 1, the formula handles every other case
+                            if (other.is_zero()) {
+                                return (*this);
+                            }
+
+                            return mixed_addition_processor::process(*this, other);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_COMPLETE_WITH_A4_MINUS_3_HPP
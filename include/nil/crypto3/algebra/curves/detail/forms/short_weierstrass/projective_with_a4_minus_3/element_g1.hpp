@@ -34,6 +34,7 @@
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_with_a4_minus_3/add_1998_cmo_2.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_with_a4_minus_3/dbl_2007_bl.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_with_a4_minus_3/madd_1998_cmo_2.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/element_g1_affine.hpp>
 
 namespace nil {
@@ -66,6 +67,7 @@ namespace nil {
 
                         using common_addition_processor = short_weierstrass_element_g1_projective_with_a4_minus_3_add_1998_cmo_2;
                         using common_doubling_processor = short_weierstrass_element_g1_projective_with_a4_minus_3_dbl_2007_bl;
+                        using mixed_addition_processor = short_weierstrass_element_g1_projective_with_a4_minus_3_madd_1998_cmo_2;
 
                     public:
                         using form = forms::short_weierstrass;
@@ -217,10 +219,7 @@ namespace nil {
                                 return (*this);
                             }
 
-                            if (*this == other) {
-                                return this->doubled();
-                            }
-
+                            // P == Q and P == -Q are detected by the addition formula itself
                             return common_addition_processor::process(*this, other);
                         }
 
@@ -247,46 +246,16 @@ namespace nil {
                          */
                         constexpr curve_element mixed_add(const curve_element &other) const {
 
-                            // NOTE: does not handle O and pts of order 2,4
-                            // http://www.hyperelliptic.org/EFD/g1p/auto-shortw-projective_with_a4_minus_3.html#addition-add-1998-cmo-2
-
+                            // handle special cases having to do with O
                             if (this->is_zero()) {
                                 return other;
                             }
 
                             if (other.is_zero()) {
-                                return (*this);
-                            }
-
-                            // Because for some reasons it's not so
-                            // assert(other.Z == field_value_type::one());
-
-                            const field_value_type &X1Z2 =
-                                (this->X);    // X1Z2 = X1*Z2 (but other is special and not zero)
-                            const field_value_type X2Z1 = (this->Z) * (other.X);    // X2Z1 = X2*Z1
-
-                            // (used both in add and double checks)
-
-                            const field_value_type &Y1Z2 =
-                                (this->Y);    // Y1Z2 = Y1*Z2 (but other is special and not zero)
-                            const field_value_type Y2Z1 = (this->Z) * (other.Y);    // Y2Z1 = Y2*Z1
-
-                            if (X1Z2 == X2Z1 && Y1Z2 == Y2Z1) {
-                                return this->doubled();
+                                return *this;
                             }
 
-                            const field_value_type u = Y2Z1 - this->Y;                  // u = Y2*Z1-Y1
-                            const field_value_type uu = u.squared();                    // uu = u2
-                            const field_value_type v = X2Z1 - this->X;                  // v = X2*Z1-X1
-                            const field_value_type vv = v.squared();                    // vv = v2
-                            const field_value_type vvv = v * vv;                        // vvv = v*vv
-                            const field_value_type R = vv * this->X;                    // R = vv*X1
-                            const field_value_type A = uu * this->Z - vvv - R - R;      // A = uu*Z1-vvv-2*R
-                            const field_value_type X3 = v * A;                          // X3 = v*A
-                            const field_value_type Y3 = u * (R - A) - vvv * this->Y;    // Y3 = u*(R-A)-vvv*Y1
-                            const field_value_type Z3 = vvv * this->Z;                  // Z3 = vvv*Z1
-
-                            return curve_element(X3, Y3, Z3);
+                            return mixed_addition_processor::process(*this, other);
                         }
                     };
 
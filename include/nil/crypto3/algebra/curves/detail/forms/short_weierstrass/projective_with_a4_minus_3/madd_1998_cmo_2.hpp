@@ -0,0 +1,81 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_WITH_A4_MINUS_3_MADD_1998_CMO_2_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_WITH_A4_MINUS_3_MADD_1998_CMO_2_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief A struct representing element mixed addition from the group G1 of short Weierstrass
+                     *  curve for projective_with_a4_minus_3 coordinates representation.
+                     *  NOTE: does not handle O and pts of order 2,4
+                     *  P == Q and P == -Q are caught from v == 0 instead of an operator== pre-check,
+                     *  DetectEqualPoints = false drops the check for callers which exclude them.
+                     *  http://www.hyperelliptic.org/EFD/g1p/auto-shortw-projective-3.html#addition-madd-1998-cmo
+                     */
+
+                    struct short_weierstrass_element_g1_projective_with_a4_minus_3_madd_1998_cmo_2 {
+
+                        template<typename ElementType, bool DetectEqualPoints = true>
+                        constexpr static inline ElementType process(const ElementType &first,
+                                                                    const ElementType &second) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            // Because for some reasons it's not so
+                            // assert(second.Z == field_value_type::one());
+
+                            const field_value_type u = (first.Z) * (second.Y) - first.Y;    // u = Y2*Z1-Y1
+                            const field_value_type v = (first.Z) * (second.X) - first.X;    // v = X2*Z1-X1
+
+                            if constexpr (DetectEqualPoints) {
+                                // X1/Z1 == X2 means P == +-Q, u == 0 tells doubling from P + (-P) = O
+                                if (v.is_zero()) {
+                                    return u.is_zero() ? first.doubled() : ElementType::zero();
+                                }
+                            }
+
+                            const field_value_type uu = u.squared();                       // uu = u^2
+                            const field_value_type vv = v.squared();                       // vv = v^2
+                            const field_value_type vvv = v * vv;                           // vvv = v*vv
+                            const field_value_type R = vv * first.X;                       // R = vv*X1
+                            const field_value_type A = uu * first.Z - vvv - R - R;         // A = uu*Z1-vvv-2*R
+                            const field_value_type X3 = v * A;                             // X3 = v*A
+                            const field_value_type Y3 = u * (R - A) - vvv * first.Y;       // Y3 = u*(R-A)-vvv*Y1
+                            const field_value_type Z3 = vvv * first.Z;                     // Z3 = vvv*Z1
+
+                            return ElementType(X3, Y3, Z3);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_WITH_A4_MINUS_3_MADD_1998_CMO_2_HPP
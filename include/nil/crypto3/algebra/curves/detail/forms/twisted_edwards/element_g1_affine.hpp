@@ -195,6 +195,21 @@ namespace nil {
                                 result_type::field_type::value_type::one());    // X = x^(-1), Y = y^(-1), Z = 1
                         }
 
+                        /** @brief
+                         *
+                         * @return return the corresponding element from affine coordinates to
+                         * extended coordinates
+                         */
+                        constexpr curve_element<params_type, form, typename curves::coordinates::extended>
+                            to_extended() const {
+
+                            using result_type =
+                                curve_element<params_type, form, typename curves::coordinates::extended>;
+
+                            return result_type(X, Y, X * Y,
+                                               result_type::field_type::value_type::one());    // x=X/Z, y=Y/Z, x*y=T/Z
+                        }
+
                         /** @brief
                          *
                          * @return return the corresponding element from affine coordinates to
@@ -0,0 +1,128 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_CACHED_HPP
+#define CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_CACHED_HPP
+
+#include <type_traits>
+
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief Cached ("Niels") form (Y+X, Y-X, 2*d*T, 2*Z) of a point in extended coordinates,
+                     *  for repeated additions of the same point.
+                     *  See https://eprint.iacr.org/2008/522.pdf, section 3.1
+                     */
+                    template<typename FieldValueType>
+                    struct twisted_edwards_extended_cached_point {
+                        FieldValueType Y_plus_X;
+                        FieldValueType Y_minus_X;
+                        FieldValueType T2d;
+                        FieldValueType Z2;
+
+                        /** @brief -(x, y) = (-x, y)
+                         */
+                        constexpr twisted_edwards_extended_cached_point operator-() const {
+                            return {Y_minus_X, Y_plus_X, -T2d, Z2};
+                        }
+                    };
+
+                    /** @brief A struct representing addition of a cached point to an element of the group G1 of
+                     *  twisted Edwards curve in extended coordinates. Unified, like add-2008-hwcd.
+                     *
+                     *  A = (Y1-X1)*(Y2-X2), B = (Y1+X1)*(Y2+X2), C = T1*2*d*T2, D = Z1*2*Z2
+                     *  E = B-A, F = D-C, G = D+C, H = B+A
+                     *  X3 = E*F, Y3 = G*H, T3 = E*H, Z3 = F*G
+                     *
+                     *  For a = -1 this is add-2008-hwcd-3 with 8M. For other a, B+A = 2*(Y1*Y2+X1*X2) is
+                     *  corrected to 2*(Y1*Y2-a*X1*X2) by subtracting (1+a)*X1*2*X2, two more multiplications,
+                     *  one of them by the constant 1+a. 2*X2 comes for free as (Y2+X2)-(Y2-X2).
+                     */
+                    struct twisted_edwards_element_g1_extended_add_cached_2008_hwcd {
+
+                        /** @brief 1+a in the base field, computed once at compile time
+                         */
+                        template<typename ElementType>
+                        struct a_correction {
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            constexpr static const field_value_type a_plus_one =
+                                field_value_type(ElementType::params_type::a) + field_value_type::one();
+                            constexpr static const bool is_needed = !a_plus_one.is_zero();
+                        };
+
+                        template<typename ElementType, typename CachedType>
+                        constexpr static inline ElementType process(const ElementType &first,
+                                                                    const CachedType &second) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            field_value_type A = (first.Y - first.X) * second.Y_minus_X;    // A = (Y1-X1)*(Y2-X2)
+                            field_value_type B = (first.Y + first.X) * second.Y_plus_X;     // B = (Y1+X1)*(Y2+X2)
+                            field_value_type C = first.T * second.T2d;                      // C = T1*2*d*T2
+                            field_value_type D = first.Z * second.Z2;                       // D = Z1*2*Z2
+                            field_value_type E = B - A;                                     // E = B-A
+                            field_value_type F = D - C;                                     // F = D-C
+                            field_value_type G = D + C;                                     // G = D+C
+                            field_value_type H = B + A;                                     // H = B+A
+
+                            if constexpr (!std::is_same<typename ElementType::coordinates,
+                                                        coordinates::extended_with_a_minus_1>::value) {
+                                if constexpr (a_correction<ElementType>::is_needed) {
+                                    // H = H-(1+a)*X1*2*X2
+                                    H -= a_correction<ElementType>::a_plus_one *
+                                         (first.X * (second.Y_plus_X - second.Y_minus_X));
+                                }
+                            }
+
+                            field_value_type X3 = E * F;    // X3 = E*F
+                            field_value_type Y3 = G * H;    // Y3 = G*H
+                            field_value_type T3 = E * H;    // T3 = E*H
+                            field_value_type Z3 = F * G;    // Z3 = F*G
+
+                            return ElementType(X3, Y3, T3, Z3);
+                        }
+                    };
+
+                    template<typename ElementType>
+                    constexpr typename twisted_edwards_element_g1_extended_add_cached_2008_hwcd::a_correction<
+                        ElementType>::field_value_type const
+                        twisted_edwards_element_g1_extended_add_cached_2008_hwcd::a_correction<ElementType>::a_plus_one;
+
+                    template<typename ElementType>
+                    constexpr bool const
+                        twisted_edwards_element_g1_extended_add_cached_2008_hwcd::a_correction<ElementType>::is_needed;
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_CACHED_HPP
@@ -0,0 +1,276 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_HPP
+#define CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_HPP
+
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended/add_2008_hwcd.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended/add_cached_2008_hwcd.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended/dbl_2008_hwcd.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended/madd_2008_hwcd.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/element_g1_affine.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing a group G1 of elliptic curve.
+                     *    @tparam CurveParams Parameters of the group
+                     *    @tparam Form Form of the curve
+                     *    @tparam Coordinates Representation coordinates of the group element
+                     */
+                    template<typename CurveParams, typename Form, typename Coordinates>
+                    class curve_element;
+
+                    /** @brief A struct representing an element from the group G1 of twisted Edwards curve of
+                     *  extended coordinates representation, for any a. x = X/Z, y = Y/Z, x*y = T/Z.
+                     *  The addition formulas are complete when a is a square and d is not, as for
+                     *  jubjub and babyjubjub.
+                     *  Description: https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html
+                     *
+                     */
+                    template<typename CurveParams>
+                    class curve_element<CurveParams, forms::twisted_edwards, coordinates::extended> {
+                    public:
+
+                        using params_type = CurveParams;
+                        using field_type = typename params_type::field_type;
+
+                    private:
+                        using field_value_type = typename field_type::value_type;
+
+                        using common_addition_processor = twisted_edwards_element_g1_extended_add_2008_hwcd;
+                        using common_doubling_processor = twisted_edwards_element_g1_extended_dbl_2008_hwcd;
+                        using mixed_addition_processor = twisted_edwards_element_g1_extended_madd_2008_hwcd;
+                        using cached_addition_processor = twisted_edwards_element_g1_extended_add_cached_2008_hwcd;
+
+                    public:
+                        using form = forms::twisted_edwards;
+                        using coordinates = coordinates::extended;
+
+                        using group_type = typename params_type::template group_type<coordinates>;
+
+                        using cached_type = twisted_edwards_extended_cached_point<field_value_type>;
+
+                        field_value_type X;
+                        field_value_type Y;
+                        field_value_type T;
+                        field_value_type Z;
+
+                        /*************************  Constructors and zero/one  ***********************************/
+
+                        /** @brief
+                         *    @return the point at infinity by default
+                         *
+                         */
+                        constexpr curve_element() :
+                            curve_element(params_type::zero_fill[0],
+                                          params_type::zero_fill[1],
+                                          field_value_type::zero(),
+                                          field_value_type::one()) {}
+
+                        /** @brief
+                         *    @return the selected point (X:Y:T:Z)
+                         *
+                         */
+                        constexpr curve_element(const field_value_type &X, const field_value_type &Y,
+                                                const field_value_type &T, const field_value_type &Z) :
+                            X(X), Y(Y), T(T), Z(Z) {}
+
+                        /** @brief
+                         *    @return the point with affine coordinates (x, y)
+                         *
+                         */
+                        constexpr curve_element(const field_value_type &x, const field_value_type &y) :
+                            X(x), Y(y), T(x * y), Z(field_value_type::one()) {}
+
+                        template<typename Backend,
+                                 multiprecision::expression_template_option ExpressionTemplates>
+                        explicit constexpr curve_element(
+                                  const multiprecision::number<Backend, ExpressionTemplates> &value) {
+                            *this = one() * value;
+                        }
+
+                        /** @brief Get the point at infinity
+                         *
+                         */
+                        constexpr static curve_element zero() {
+                            return curve_element();
+                        }
+
+                        /** @brief Get the generator of group G1
+                         *
+                         */
+                        constexpr static curve_element one() {
+                            return curve_element(params_type::one_fill[0], params_type::one_fill[1]);
+                        }
+
+                        /*************************  Comparison operations  ***********************************/
+
+                        constexpr bool operator==(const curve_element &other) const {
+                            // X1/Z1 = X2/Z2 <=> X1*Z2 = X2*Z1
+                            if ((this->X * other.Z) != (other.X * this->Z)) {
+                                return false;
+                            }
+
+                            // Y1/Z1 = Y2/Z2 <=> Y1*Z2 = Y2*Z1
+                            return (this->Y * other.Z) == (other.Y * this->Z);
+                        }
+
+                        constexpr bool operator!=(const curve_element &other) const {
+                            return !(operator==(other));
+                        }
+
+                        /** @brief The neutral element is (0, 1), i.e. X = 0 and Y = Z
+                         *
+                         * @return true if element from group G1 is the point at infinity
+                         */
+                        constexpr bool is_zero() const {
+                            return this->X.is_zero() && this->Y == this->Z;
+                        }
+
+                        /** @brief
+                         *
+                         * @return true if element from group G1 lies on the elliptic curve
+                         *
+                         * A check, that (a*X^2 + Y^2)*Z^2 = Z^4 + d*X^2*Y^2 and X*Y = T*Z
+                         */
+                        constexpr bool is_well_formed() const {
+                            if (this->Z.is_zero()) {
+                                return false;
+                            }
+
+                            const field_value_type XX = this->X.squared();
+                            const field_value_type YY = this->Y.squared();
+                            const field_value_type ZZ = this->Z.squared();
+
+                            return (field_value_type(params_type::a) * XX + YY) * ZZ ==
+                                       ZZ.squared() + field_value_type(params_type::d) * XX * YY &&
+                                   this->X * this->Y == this->T * this->Z;
+                        }
+
+                        /*************************  Reducing operations  ***********************************/
+
+                        /** @brief
+                         *
+                         * @return return the corresponding element from extended coordinates to
+                         * affine coordinates
+                         */
+                        constexpr curve_element<params_type, form, curves::coordinates::affine> to_affine() const {
+                            using result_type = curve_element<params_type, form, curves::coordinates::affine>;
+
+                            if (is_zero()) {
+                                return result_type::zero();
+                            }
+
+                            const field_value_type Z_inv = Z.inversed();
+                            return result_type(X * Z_inv, Y * Z_inv);    //  x=X/Z, y=Y/Z
+                        }
+
+                        /** @brief
+                         *
+                         * @return cached form (Y+X, Y-X, 2*d*T, 2*Z) for repeated additions with add_cached
+                         */
+                        constexpr cached_type to_cached() const {
+                            return {Y + X, Y - X, field_value_type(2) * params_type::d * T, Z + Z};
+                        }
+
+                        /*************************  Arithmetic operations  ***********************************/
+
+                        template<typename Backend,
+                                 multiprecision::expression_template_option ExpressionTemplates>
+                        constexpr const curve_element& operator=(
+                                  const multiprecision::number<Backend, ExpressionTemplates> &value) {
+                            *this = one() * value;
+                            return *this;
+                        }
+
+                        /** @brief The formulas are unified, the neutral element and doubling need no special case
+                         */
+                        constexpr curve_element operator+(const curve_element &other) const {
+                            return common_addition_processor::process(*this, other);
+                        }
+
+                        constexpr curve_element& operator+=(const curve_element &other) {
+                            *this = common_addition_processor::process(*this, other);
+                            return *this;
+                        }
+
+                        constexpr curve_element operator-() const {
+                            return curve_element(-X, Y, -T, Z);
+                        }
+
+                        constexpr curve_element operator-(const curve_element &other) const {
+                            return (*this) + (-other);
+                        }
+
+                        constexpr curve_element& operator-=(const curve_element &other) {
+                            return (*this) += (-other);
+                        }
+
+                        template<typename Backend,
+                             multiprecision::expression_template_option ExpressionTemplates>
+                        constexpr curve_element& operator*=(const multiprecision::number<Backend, ExpressionTemplates> &right) {
+                            (*this) = (*this) * right;
+                            return *this;
+                        }
+
+                        /** @brief
+                         *
+                         * @return doubled element from group G1
+                         */
+                        constexpr curve_element doubled() const {
+                            return common_doubling_processor::process(*this);
+                        }
+
+                        /** @brief
+                         *
+                         * “Mixed addition” refers to the case Z2 known to be 1.
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr curve_element mixed_add(const curve_element &other) const {
+                            return mixed_addition_processor::process(*this, other);
+                        }
+
+                        /** @brief
+                         *
+                         * @return addition of an element in cached form, see to_cached
+                         */
+                        constexpr curve_element add_cached(const cached_type &other) const {
+                            return cached_addition_processor::process(*this, other);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_HPP
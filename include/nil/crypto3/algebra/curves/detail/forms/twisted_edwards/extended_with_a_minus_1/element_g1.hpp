@@ -33,6 +33,7 @@
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/add_2008_hwcd_3.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/dbl_2008_hwcd.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/madd_2008_hwcd_2.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended/add_cached_2008_hwcd.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/element_g1_affine.hpp>
 
 namespace nil {
@@ -69,6 +70,7 @@ namespace nil {
                             twisted_edwards_element_g1_extended_with_a_minus_1_dbl_2008_hwcd;
                         using mixed_addition_processor =
                             twisted_edwards_element_g1_extended_with_a_minus_1_madd_2008_hwcd_2;
+                        using cached_addition_processor = twisted_edwards_element_g1_extended_add_cached_2008_hwcd;
 
                     public:
                         using form = forms::twisted_edwards;
@@ -76,6 +78,8 @@ namespace nil {
 
                         using group_type = typename params_type::template group_type<coordinates>;
 
+                        using cached_type = twisted_edwards_extended_cached_point<field_value_type>;
+
                         field_value_type X;
                         field_value_type Y;
                         field_value_type T;
@@ -159,12 +163,12 @@ namespace nil {
                         constexpr bool operator!=(const curve_element &other) const {
                             return !(operator==(other));
                         }
-                        /** @brief
+                        /** @brief The neutral element is (0, 1), i.e. X = 0 and Y = Z
                          *
                          * @return true if element from group G1 is the point at infinity
                          */
                         constexpr bool is_zero() const {
-                            return (this->X.is_zero() && this->T.is_zero() && this->Z.is_zero());
+                            return this->X.is_zero() && this->Y == this->Z;
                         }
 
                         /** @brief
@@ -195,6 +199,15 @@ namespace nil {
                             return result_type(X / Z, Y / Z);    //  x=X/Z, y=Y/Z
                         }
 
+                        /** @brief
+                         *
+                         * @return cached ("Niels") form (Y+X, Y-X, 2*d*T, 2*Z) for repeated additions with
+                         * add_cached
+                         */
+                        constexpr cached_type to_cached() const {
+                            return {Y + X, Y - X, field_value_type(2) * params_type::d * T, Z + Z};
+                        }
+
                         /*************************  Arithmetic operations  ***********************************/
 
                         constexpr curve_element operator=(const curve_element &other) {
@@ -291,6 +304,14 @@ namespace nil {
 
                             return mixed_addition_processor::process(*this, other);
                         }
+
+                        /** @brief
+                         *
+                         * @return addition of an element in cached form, see to_cached
+                         */
+                        constexpr curve_element add_cached(const cached_type &other) const {
+                            return cached_addition_processor::process(*this, other);
+                        }
                     };
 
                 }    // namespace detail
@@ -0,0 +1,187 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_ELL2_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_ELL2_HPP
+
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_suites.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_m2c.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_expand.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_cofactor.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_batch.hpp>
+
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+
+#include <type_traits>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    using namespace nil::crypto3::multiprecision;
+
+                    /**
+                     * @brief hash_to_curve for the Elligator 2 suites over curve25519 and edwards25519.
+                     * https://datatracker.ietf.org/doc/html/rfc9380#section-8.5
+                     *
+                     * Both suites map to edwards25519 in extended coordinates, where the point addition and the
+                     * cofactor clearing need no inversion. The curve25519 suite converts the final point with
+                     * to_montgomery(), so the whole hash costs two exponentiations and one inversion.
+                     */
+                    template<typename GroupType>
+                    struct ell2_map {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+                        typedef typename suite_type::modular_type modular_type;
+                        typedef typename suite_type::modular_backend modular_backend;
+
+                        typedef nil::crypto3::multiprecision::modular_params<modular_backend> modular_params_type;
+
+                        typedef typename suite_type::hash_type hash_type;
+
+                        typedef typename ed25519::g1_type<> edwards_group_type;
+                        typedef typename edwards_group_type::value_type edwards_value_type;
+
+                        constexpr static std::size_t m = suite_type::m;
+                        constexpr static std::size_t L = suite_type::L;
+                        constexpr static std::size_t k = suite_type::k;
+                        constexpr static const modular_params_type p_modulus_params = suite_type::p;
+
+                        typedef expand_message_xmd<k, hash_type> expand_message_ro;
+
+                        static_assert(m == 1, "underlying field has wrong extension");
+
+                        template<typename InputType, typename DstType,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputType::value_type>::value &&
+                                     std::is_same<std::uint8_t, typename DstType::value_type>::value>::type>
+                        static inline group_value_type hash_to_curve(const InputType &msg, const DstType &dst) {
+                            return hash_to_curve(msg, typename expand_message_ro::dst_context(dst));
+                        }
+
+                        template<typename InputType,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputType::value_type>::value>::type>
+                        static inline group_value_type
+                            hash_to_curve(const InputType &msg,
+                                          const typename expand_message_ro::dst_context &dst_ctx) {
+                            auto u = hash_to_field<2, expand_message_ro>(msg, dst_ctx);
+                            return from_edwards(clear_cofactor(map_to_edwards(u[0]) + map_to_edwards(u[1])));
+                        }
+
+                        /// @brief hash_to_curve for a message already expanded to 2 * L uniform bytes
+                        static inline group_value_type
+                            hash_to_curve_from_uniform_bytes(const std::uint8_t *uniform_bytes) {
+                            auto u = hash_to_field_from_uniform_bytes<2>(uniform_bytes);
+                            return from_edwards(clear_cofactor(map_to_edwards(u[0]) + map_to_edwards(u[1])));
+                        }
+
+                        /**
+                         * @brief Hashes a range of messages, see detail::hash_to_curve_batch. With normalize set
+                         * edwards25519 points are returned with Z = 1 using a single batched inversion per chunk,
+                         * curve25519 points are affine anyway.
+                         */
+                        template<typename InputRange, typename DstType, typename OutputIterator>
+                        static inline OutputIterator
+                            hash_to_curve_batch(const InputRange &msgs, const DstType &dst, OutputIterator out,
+                                                bool normalize = false,
+                                                thread_pool &pool = thread_pool::default_pool()) {
+                            return detail::hash_to_curve_batch<ell2_map>(msgs, dst, out, normalize, pool);
+                        }
+
+                        template<std::size_t N, typename expand_message_type, typename InputType, typename DstType,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputType::value_type>::value &&
+                                     std::is_same<std::uint8_t, typename DstType::value_type>::value>::type>
+                        static inline std::array<field_value_type, N> hash_to_field(const InputType &msg,
+                                                                                    const DstType &dst) {
+                            return hash_to_field<N, expand_message_type>(
+                                msg, typename expand_message_type::dst_context(dst));
+                        }
+
+                        template<std::size_t N, typename expand_message_type, typename InputType,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputType::value_type>::value>::type>
+                        static inline std::array<field_value_type, N>
+                            hash_to_field(const InputType &msg,
+                                          const typename expand_message_type::dst_context &dst_ctx) {
+                            std::array<std::uint8_t, N * m * L> uniform_bytes {0};
+                            expand_message_type::process(N * m * L, msg, dst_ctx, uniform_bytes.begin());
+                            return hash_to_field_from_uniform_bytes<N>(uniform_bytes.data());
+                        }
+
+                        template<std::size_t N>
+                        static inline std::array<field_value_type, N>
+                            hash_to_field_from_uniform_bytes(const std::uint8_t *uniform_bytes) {
+                            static_assert(L <= field_value_type::wide_bytes_max, "L exceeds two Montgomery words");
+
+                            std::array<field_value_type, N> result;
+                            for (std::size_t i = 0; i < N; i++) {
+                                result[i] = field_value_type::from_wide_bytes(uniform_bytes + L * i,
+                                                                              uniform_bytes + L * (i + 1));
+                            }
+
+                            return result;
+                        }
+
+                        static inline edwards_value_type clear_cofactor(const edwards_value_type &R) {
+                            return cofactor_clearing<edwards_group_type>::process(R);
+                        }
+
+                    private:
+                        static inline edwards_value_type map_to_edwards(const field_value_type &u) {
+                            // both suites share the Elligator 2 constants, see h2c_suite_curve25519_ell2
+                            return map_to_curve<edwards_group_type>::process(u);
+                        }
+
+                        static inline group_value_type from_edwards(const edwards_value_type &P) {
+                            if constexpr (std::is_same<group_value_type, edwards_value_type>::value) {
+                                return P;
+                            } else {
+                                if (P.is_zero()) {
+                                    return group_value_type();
+                                }
+                                const auto P_affine = P.to_affine();
+                                group_value_type R = P_affine.to_montgomery();
+                                // to_montgomery() takes whichever square root of -486664 the field returns, the
+                                // suite pins the one with sgn0 = 0: v * x = c1 * u
+                                if (R.Y * P_affine.X != suite_type::ell2_edwards_c1 * R.X) {
+                                    R.Y = -R.Y;
+                                }
+                                return R;
+                            }
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_ELL2_HPP
@@ -29,6 +29,8 @@
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_suites.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_m2c.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_expand.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_cofactor.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_batch.hpp>
 
 #include <type_traits>
 
@@ -69,12 +71,46 @@ namespace nil {
                                      std::is_same<std::uint8_t, typename InputType::value_type>::value &&
                                      std::is_same<std::uint8_t, typename DstType::value_type>::value>::type>
                         static inline group_value_type hash_to_curve(const InputType &msg, const DstType &dst) {
-                            auto u = hash_to_field<2, expand_message_ro>(msg, dst);
+                            return hash_to_curve(msg, typename expand_message_ro::dst_context(dst));
+                        }
+
+                        /**
+                         * @brief Same as above with the DST state prepared once by the caller, so that hashing many
+                         * messages under one DST does not rebuild it every time.
+                         */
+                        template<typename InputType,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputType::value_type>::value>::type>
+                        static inline group_value_type
+                            hash_to_curve(const InputType &msg,
+                                          const typename expand_message_ro::dst_context &dst_ctx) {
+                            auto u = hash_to_field<2, expand_message_ro>(msg, dst_ctx);
+                            group_value_type Q0 = map_to_curve<GroupType>::process(u[0]);
+                            group_value_type Q1 = map_to_curve<GroupType>::process(u[1]);
+                            return clear_cofactor(Q0 + Q1);
+                        }
+
+                        /// @brief hash_to_curve for a message already expanded to 2 * m * L uniform bytes
+                        static inline group_value_type
+                            hash_to_curve_from_uniform_bytes(const std::uint8_t *uniform_bytes) {
+                            auto u = hash_to_field_from_uniform_bytes<2>(uniform_bytes);
                             group_value_type Q0 = map_to_curve<GroupType>::process(u[0]);
                             group_value_type Q1 = map_to_curve<GroupType>::process(u[1]);
                             return clear_cofactor(Q0 + Q1);
                         }
 
+                        /**
+                         * @brief Hashes a range of messages, see detail::hash_to_curve_batch. With normalize set
+                         * the points are returned with Z = 1 using a single batched inversion per chunk.
+                         */
+                        template<typename InputRange, typename DstType, typename OutputIterator>
+                        static inline OutputIterator
+                            hash_to_curve_batch(const InputRange &msgs, const DstType &dst, OutputIterator out,
+                                                bool normalize = false,
+                                                thread_pool &pool = thread_pool::default_pool()) {
+                            return detail::hash_to_curve_batch<ep_map>(msgs, dst, out, normalize, pool);
+                        }
+
                         // template<typename InputType, typename = typename std::enable_if<std::is_same<
                         //                                  std::uint8_t, typename InputType::value_type>::value>::type>
                         // static inline group_value_type encode_to_curve(const InputType &msg) {
@@ -90,27 +126,38 @@ namespace nil {
                                      std::is_same<std::uint8_t, typename DstType::value_type>::value>::type>
                         static inline std::array<field_value_type, N> hash_to_field(const InputType &msg,
                                                                                     const DstType &dst) {
+                            return hash_to_field<N, expand_message_type>(
+                                msg, typename expand_message_type::dst_context(dst));
+                        }
+
+                        template<std::size_t N, typename expand_message_type, typename InputType,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputType::value_type>::value>::type>
+                        static inline std::array<field_value_type, N>
+                            hash_to_field(const InputType &msg,
+                                          const typename expand_message_type::dst_context &dst_ctx) {
                             std::array<std::uint8_t, N * m * L> uniform_bytes {0};
-                            expand_message_type::process(N * m * L, msg, dst, uniform_bytes);
+                            expand_message_type::process(N * m * L, msg, dst_ctx, uniform_bytes.begin());
+                            return hash_to_field_from_uniform_bytes<N>(uniform_bytes.data());
+                        }
+
+                        /// @brief Second half of hash_to_field: reduces N * m * L already expanded bytes to N elements
+                        template<std::size_t N>
+                        static inline std::array<field_value_type, N>
+                            hash_to_field_from_uniform_bytes(const std::uint8_t *uniform_bytes) {
+                            static_assert(L <= field_value_type::wide_bytes_max, "L exceeds two Montgomery words");
 
-                            cpp_int e;
-                            std::array<modular_type, m> coordinates;
                             std::array<field_value_type, N> result;
                             for (std::size_t i = 0; i < N; i++) {
-                                for (std::size_t j = 0; j < m; j++) {
-                                    auto elm_offset = L * (j + i * m);
-                                    import_bits(e, uniform_bytes.begin() + elm_offset,
-                                                uniform_bytes.begin() + elm_offset + L);
-                                    coordinates[j] = modular_type(e, p_modulus_params);
-                                }
-                                result[i] = field_value_type(coordinates[0]);
+                                result[i] = field_value_type::from_wide_bytes(uniform_bytes + L * i,
+                                                                              uniform_bytes + L * (i + 1));
                             }
 
                             return result;
                         }
 
                         static inline group_value_type clear_cofactor(const group_value_type &R) {
-                            return R * suite_type::h_eff;
+                            return cofactor_clearing<GroupType>::process(R);
                         }
                     };
                 }    // namespace detail
@@ -0,0 +1,156 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_BATCH_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_BATCH_HPP
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/multiexp/thread_pool.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_expand.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief Brings Jacobian or extended twisted Edwards points to Z = 1 with Montgomery's trick:
+                     * one inversion for the whole range plus 3 multiplications per point. Points at infinity are
+                     * left untouched.
+                     */
+                    template<typename InputIterator>
+                    void h2c_batch_normalize(InputIterator first, InputIterator last) {
+                        typedef typename std::iterator_traits<InputIterator>::value_type group_value_type;
+                        typedef typename group_value_type::field_type::value_type field_value_type;
+
+                        std::vector<field_value_type> prefix;
+                        prefix.reserve(std::distance(first, last));
+
+                        field_value_type acc = field_value_type::one();
+                        for (InputIterator it = first; it != last; ++it) {
+                            if (!it->is_zero()) {
+                                acc *= it->Z;
+                                prefix.emplace_back(acc);
+                            }
+                        }
+                        if (prefix.empty()) {
+                            return;
+                        }
+
+                        field_value_type acc_inv = acc.inversed();
+                        std::size_t i = prefix.size();
+                        for (InputIterator it = last; it != first;) {
+                            --it;
+                            if (it->is_zero()) {
+                                continue;
+                            }
+                            --i;
+                            const field_value_type z_inv = i > 0 ? acc_inv * prefix[i - 1] : acc_inv;
+                            acc_inv *= it->Z;
+
+                            if constexpr (algebra::has_t_coordinate<group_value_type>::value) {
+                                it->X *= z_inv;
+                                it->Y *= z_inv;
+                                it->T *= z_inv;
+                            } else {
+                                const field_value_type z_inv2 = z_inv.squared();
+                                it->X *= z_inv2;
+                                it->Y *= z_inv2 * z_inv;
+                            }
+                            it->Z = field_value_type::one();
+                        }
+                    }
+
+                    /**
+                     * @brief Hashes every message of the range with the same dst and writes the points to out
+                     * in input order.
+                     *
+                     * Messages are split into one contiguous chunk per thread of pool. For SHA-256 and SHA-512 suites
+                     * a chunk is first expanded with expand_message_xmd_batch, which needs the messages to be
+                     * contiguous byte ranges. What is shared across a chunk is the message expansion and, with
+                     * normalize set, the one inversion of h2c_batch_normalize. The field work of the map itself,
+                     * i.e. the square root or sqrt_ratio exponentiation and the isogeny, is still done point by
+                     * point: it is inversion-free already, and exponentiations do not batch like inversions do.
+                     */
+                    template<typename H2CType, typename InputRange, typename DstType, typename OutputIterator>
+                    OutputIterator hash_to_curve_batch(const InputRange &msgs, const DstType &dst, OutputIterator out,
+                                                       bool normalize, thread_pool &pool) {
+                        typedef typename H2CType::group_value_type group_value_type;
+
+                        const std::size_t total_size = std::distance(std::begin(msgs), std::end(msgs));
+                        std::vector<group_value_type> result(total_size);
+
+                        const std::size_t chunks_count = std::max<std::size_t>(std::min(pool.size(), total_size), 1);
+                        const std::size_t chunk_size = (total_size + chunks_count - 1) / chunks_count;
+
+                        // the DST state is read-only once built and is shared by all threads
+                        const typename H2CType::expand_message_ro::dst_context dst_ctx(dst);
+
+                        pool.run(chunks_count, [&](std::size_t chunk) {
+                            const std::size_t begin = std::min(chunk * chunk_size, total_size);
+                            const std::size_t end = std::min(begin + chunk_size, total_size);
+                            auto msg_it = std::next(std::begin(msgs), begin);
+                            if constexpr (xmd_batch_lanes<typename H2CType::hash_type>::is_supported) {
+                                // expand all messages of the chunk with the multi-buffer SHA-2 kernel first
+                                typedef expand_message_xmd_batch<H2CType::k, typename H2CType::hash_type>
+                                    expand_message_batch;
+                                constexpr std::size_t len_in_bytes = 2 * H2CType::m * H2CType::L;
+
+                                std::vector<std::uint8_t> uniform_bytes((end - begin) * len_in_bytes);
+                                expand_message_batch::process(len_in_bytes, msg_it, std::next(msg_it, end - begin),
+                                                              dst_ctx, uniform_bytes.data());
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    result[i] = H2CType::hash_to_curve_from_uniform_bytes(uniform_bytes.data() +
+                                                                                         (i - begin) * len_in_bytes);
+                                }
+                            } else {
+                                for (std::size_t i = begin; i < end; ++i, ++msg_it) {
+                                    result[i] = H2CType::hash_to_curve(*msg_it, dst_ctx);
+                                }
+                            }
+                            // affine points, e.g. of the curve25519 suite, have nothing to normalize
+                            if constexpr (!std::is_same<typename group_value_type::coordinates,
+                                                        coordinates::affine>::value) {
+                                if (normalize) {
+                                    h2c_batch_normalize(result.begin() + begin, result.begin() + end);
+                                }
+                            }
+                        });
+
+                        return std::copy(result.begin(), result.end(), out);
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_BATCH_HPP
@@ -0,0 +1,236 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_CLEAR_COFACTOR_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_CLEAR_COFACTOR_HPP
+
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_suites.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief Generic cofactor clearing by multiplication with h_eff
+                     *  https://datatracker.ietf.org/doc/html/rfc9380#section-7
+                     */
+                    template<typename GroupType>
+                    struct clear_cofactor_h_eff {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+
+                        static inline group_value_type process(const group_value_type &R) {
+                            return R * suite_type::h_eff;
+                        }
+                    };
+
+                    /** @brief Cofactor clearing for prime order groups, h_eff = 1
+                     */
+                    template<typename GroupType>
+                    struct clear_cofactor_one {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+
+                        static inline group_value_type process(const group_value_type &R) {
+                            return R;
+                        }
+                    };
+
+                    /** @brief Cofactor clearing for edwards25519, h_eff = 8: three doublings
+                     */
+                    template<typename GroupType>
+                    struct clear_cofactor_edwards25519 {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+
+                        static inline group_value_type process(const group_value_type &R) {
+                            return R.doubled().doubled().doubled();
+                        }
+                    };
+
+                    /** @brief Multiplication by the curve parameter z of the suite (the BLS z or the BN x),
+                     *  sign included. z has 64 bits at most, so plain double-and-add is cheaper than
+                     *  any precomputation.
+                     */
+                    template<typename GroupType>
+                    struct mul_by_curve_z {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+
+                        static inline group_value_type process(const group_value_type &P) {
+                            group_value_type R = P;
+                            for (std::size_t i = multiprecision::msb(suite_type::z); i-- > 0;) {
+                                R = R.doubled();
+                                if (multiprecision::bit_test(suite_type::z, i)) {
+                                    R = R + P;
+                                }
+                            }
+                            return suite_type::z_is_neg ? -R : R;
+                        }
+                    };
+
+                    /** @brief Cofactor clearing for BLS12 G1: h_eff = 1 - z, so [h_eff]R = R - [z]R.
+                     *  Costs 63 doublings and 6 additions instead of a generic scalar multiplication.
+                     *  https://datatracker.ietf.org/doc/html/rfc9380#section-8.8.1
+                     */
+                    template<typename GroupType>
+                    struct clear_cofactor_bls12_g1 {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+
+                        static inline group_value_type process(const group_value_type &R) {
+                            return R - mul_by_curve_z<GroupType>::process(R);
+                        }
+                    };
+
+                    /** @brief The untwist-Frobenius-twist endomorphism psi of a G2 twist over Fp2 = Fp[I],
+                     *  I^2 = -1, with the suite constants psi_c1, psi_c2 and psi2_c1.
+                     *  https://datatracker.ietf.org/doc/html/rfc9380#appendix-G.3
+                     */
+                    template<typename GroupType>
+                    struct twist_psi {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        // Frobenius on Fp2 with non-residue -1
+                        static inline field_value_type frobenius(const field_value_type &x) {
+                            return field_value_type(x.data[0], -x.data[1]);
+                        }
+
+                        // psi on Jacobian coordinates: (c1 * X^p, c2 * Y^p, Z^p), Frobenius commutes
+                        // with the division by Z^2 and Z^3
+                        static inline group_value_type psi(const group_value_type &P) {
+                            return group_value_type(suite_type::psi_c1 * frobenius(P.X),
+                                                    suite_type::psi_c2 * frobenius(P.Y),
+                                                    frobenius(P.Z));
+                        }
+
+                        // psi(psi(P)) = (psi2_c1 * X, -Y, Z), psi2_c1 lies in Fp
+                        static inline group_value_type psi2(const group_value_type &P) {
+                            return group_value_type(suite_type::psi2_c1 * P.X, -P.Y, P.Z);
+                        }
+                    };
+
+                    /** @brief Cofactor clearing for BLS12 G2 using the endomorphism psi, Budroni-Pintore
+                     *  method. Result equals [h_eff]R.
+                     *  https://datatracker.ietf.org/doc/html/rfc9380#appendix-G.3
+                     *  https://eprint.iacr.org/2017/419
+                     */
+                    template<typename GroupType>
+                    struct clear_cofactor_bls12_g2 {
+                        typedef twist_psi<GroupType> psi_type;
+
+                        typedef typename psi_type::group_value_type group_value_type;
+
+                        static inline group_value_type process(const group_value_type &P) {
+                            group_value_type t1 = mul_by_curve_z<GroupType>::process(P);
+                            group_value_type t2 = psi_type::psi(P);
+                            group_value_type t3 = psi_type::psi2(P.doubled());
+                            t3 = t3 - t2;
+                            t2 = t1 + t2;
+                            t2 = mul_by_curve_z<GroupType>::process(t2);
+                            t3 = t3 + t2;
+                            t3 = t3 - t1;
+                            return t3 - P;
+                        }
+                    };
+
+                    /** @brief Cofactor clearing for BN254 G2 with the method of Fuentes-Castaneda, Knapp and
+                     *  Rodriguez-Henriquez, "Faster hashing to G2", section 6.1:
+                     *  [z]P + psi([3z]P) + psi^2([z]P) + psi^3(P) for the BN parameter z. This is the map used
+                     *  by gnark-crypto; it sends the twist onto G2, but is not a multiplication by 2p - r.
+                     */
+                    template<typename GroupType>
+                    struct clear_cofactor_bn_g2 {
+                        typedef twist_psi<GroupType> psi_type;
+
+                        typedef typename psi_type::group_value_type group_value_type;
+
+                        static inline group_value_type process(const group_value_type &P) {
+                            group_value_type t0 = mul_by_curve_z<GroupType>::process(P);
+                            group_value_type t1 = psi_type::psi(t0.doubled() + t0);
+                            group_value_type t2 = psi_type::psi2(t0);
+                            group_value_type t3 = psi_type::psi(psi_type::psi2(P));
+                            return t0 + t1 + t2 + t3;
+                        }
+                    };
+
+                    template<typename GroupType>
+                    struct cofactor_clearing : clear_cofactor_h_eff<GroupType> { };
+
+                    template<>
+                    struct cofactor_clearing<typename bls12_381::g1_type<>>
+                        : clear_cofactor_bls12_g1<typename bls12_381::g1_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename bls12_381::g2_type<>>
+                        : clear_cofactor_bls12_g2<typename bls12_381::g2_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename secp_k1<256>::g1_type<>>
+                        : clear_cofactor_one<typename secp_k1<256>::g1_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename pallas::g1_type<>>
+                        : clear_cofactor_one<typename pallas::g1_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename vesta::g1_type<>>
+                        : clear_cofactor_one<typename vesta::g1_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename alt_bn128<254>::g1_type<>>
+                        : clear_cofactor_one<typename alt_bn128<254>::g1_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename alt_bn128<254>::g2_type<>>
+                        : clear_cofactor_bn_g2<typename alt_bn128<254>::g2_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename ed25519::g1_type<>>
+                        : clear_cofactor_edwards25519<typename ed25519::g1_type<>> { };
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_CLEAR_COFACTOR_HPP
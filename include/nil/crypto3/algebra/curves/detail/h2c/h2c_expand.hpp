@@ -28,6 +28,7 @@
 
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_suites.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_sgn0.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_sha2_lanes.hpp>
 
 #include <nil/crypto3/algebra/algorithms/strxor.hpp>
 
@@ -40,6 +41,7 @@
 #include <boost/static_assert.hpp>
 #include <boost/concept/assert.hpp>
 
+#include <algorithm>
 #include <array>
 #include <type_traits>
 #include <iterator>
@@ -67,6 +69,118 @@ namespace nil {
                         constexpr static const std::array<std::uint8_t, r_in_bytes> Z_pad {0};
 
                     public:
+                        typedef accumulator_set<HashType> accumulator_type;
+                        typedef typename HashType::digest_type digest_type;
+
+                        /**
+                         * @brief Per-DST state of the expander: DST_prime = DST || I2OSP(len(DST), 1) kept in a fixed
+                         * buffer, and the hash state after absorbing the Z_pad block, which is the same for every
+                         * message. Build it once per DST and reuse it for every message hashed with that DST.
+                         * A DST longer than 255 bytes is replaced by H("H2C-OVERSIZE-DST-" || DST) (RFC 9380,
+                         * section 5.3.3).
+                         */
+                        class dst_context {
+                            friend class expand_message_xmd;
+
+                            BOOST_STATIC_ASSERT_MSG(b_in_bytes <= 255, "oversize DST digest does not fit DST_prime");
+
+                            std::array<std::uint8_t, 256> dst_prime;
+                            std::size_t dst_prime_size;
+                            accumulator_type z_pad_acc;
+
+                        public:
+                            template<typename InputDstType,
+                                     typename = typename std::enable_if<
+                                         std::is_same<std::uint8_t, typename InputDstType::value_type>::value>::type>
+                            explicit dst_context(const InputDstType &dst) {
+                                BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputDstType>));
+
+                                std::size_t dst_size = std::distance(dst.begin(), dst.end());
+                                // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
+                                BOOST_ASSERT(dst_size >= 16);
+
+                                if (dst_size <= 255) {
+                                    std::copy(dst.begin(), dst.end(), dst_prime.begin());
+                                } else {
+                                    // https://www.rfc-editor.org/rfc/rfc9380#section-5.3.3
+                                    static const std::array<std::uint8_t, 17> oversize_prefix = {
+                                        'H', '2', 'C', '-', 'O', 'V', 'E', 'R', 'S',
+                                        'I', 'Z', 'E', '-', 'D', 'S', 'T', '-'};
+                                    accumulator_type dst_acc;
+                                    hash<HashType>(oversize_prefix, dst_acc);
+                                    hash<HashType>(dst, dst_acc);
+                                    const digest_type digest = accumulators::extract::hash<HashType>(dst_acc);
+                                    std::copy(digest.begin(), digest.end(), dst_prime.begin());
+                                    dst_size = b_in_bytes;
+                                }
+                                dst_prime[dst_size] = static_cast<std::uint8_t>(dst_size);
+                                dst_prime_size = dst_size + 1;
+
+                                hash<HashType>(Z_pad, z_pad_acc);
+                            }
+
+                            const std::uint8_t *dst_prime_data() const {
+                                return dst_prime.data();
+                            }
+
+                            std::size_t dst_prime_length() const {
+                                return dst_prime_size;
+                            }
+                        };
+
+                        /**
+                         * @brief Streaming expand_message_xmd: the pieces of msg_prime and b_i_str are absorbed one
+                         * after another without being concatenated, and len_in_bytes bytes are written to out.
+                         */
+                        template<typename InputMsgType, typename OutputIterator,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputMsgType::value_type>::value>::type>
+                        static inline OutputIterator process(const std::size_t len_in_bytes, const InputMsgType &msg,
+                                                             const dst_context &ctx, OutputIterator out) {
+                            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputMsgType>));
+
+                            // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
+                            BOOST_ASSERT(len_in_bytes < 0x10000);
+
+                            const std::array<std::uint8_t, 3> l_i_b_str = {
+                                static_cast<std::uint8_t>(len_in_bytes >> 8u),
+                                static_cast<std::uint8_t>(len_in_bytes % 0x100), 0};
+                            const std::size_t ell = static_cast<std::size_t>(len_in_bytes / b_in_bytes) +
+                                                    static_cast<std::size_t>(len_in_bytes % b_in_bytes != 0);
+
+                            // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
+                            BOOST_ASSERT(ell <= 255);
+
+                            const auto dst_prime_begin = ctx.dst_prime.begin();
+                            const auto dst_prime_end = ctx.dst_prime.begin() + ctx.dst_prime_size;
+
+                            // b_0 = H(Z_pad || msg || I2OSP(len_in_bytes, 2) || I2OSP(0, 1) || DST_prime)
+                            accumulator_type b0_acc = ctx.z_pad_acc;
+                            hash<HashType>(msg, b0_acc);
+                            hash<HashType>(l_i_b_str, b0_acc);
+                            hash<HashType>(dst_prime_begin, dst_prime_end, b0_acc);
+                            const digest_type b0 = accumulators::extract::hash<HashType>(b0_acc);
+
+                            // b_i = H(strxor(b_0, b_(i - 1)) || I2OSP(i, 1) || DST_prime), b_1 = H(b_0 || 1 || ...)
+                            digest_type bi = b0;
+                            std::size_t remaining = len_in_bytes;
+                            for (std::size_t i = 1; i <= ell; i++) {
+                                if (i > 1) {
+                                    strxor(b0, bi, bi);
+                                }
+                                accumulator_type bi_acc;
+                                hash<HashType>(bi, bi_acc);
+                                hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(i)}, bi_acc);
+                                hash<HashType>(dst_prime_begin, dst_prime_end, bi_acc);
+                                bi = accumulators::extract::hash<HashType>(bi_acc);
+
+                                const std::size_t chunk = std::min(remaining, b_in_bytes);
+                                out = std::copy(bi.begin(), bi.begin() + chunk, out);
+                                remaining -= chunk;
+                            }
+                            return out;
+                        }
+
                         template<typename InputMsgType, typename InputDstType, typename OutputType,
                                  typename = typename std::enable_if<
                                      std::is_same<std::uint8_t, typename InputMsgType::value_type>::value &&
@@ -74,86 +188,122 @@ namespace nil {
                                      std::is_same<std::uint8_t, typename OutputType::value_type>::value>::type>
                         static inline void process(const std::size_t len_in_bytes, const InputMsgType &msg,
                                                    const InputDstType &dst, OutputType &uniform_bytes) {
-                            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputMsgType>));
-                            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputDstType>));
                             BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<OutputType>));
                             BOOST_CONCEPT_ASSERT((boost::WriteableRangeConcept<OutputType>));
 
-                            // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
-                            BOOST_ASSERT(len_in_bytes < 0x10000);
-                            BOOST_ASSERT(std::distance(dst.begin(), dst.end()) >= 16 &&
-                                         std::distance(dst.begin(), dst.end()) <= 255);
                             BOOST_ASSERT(
                                 std::size_t(std::distance(uniform_bytes.begin(), uniform_bytes.end())) >= len_in_bytes);
 
-                            const std::array<std::uint8_t, 2> l_i_b_str = {
+                            process(len_in_bytes, msg, dst_context(dst), uniform_bytes.begin());
+                        }
+                    };
+
+                    /**
+                     * @brief Multi-buffer kernel used by expand_message_xmd_batch for HashType. Hashes without one
+                     * are expanded message by message.
+                     */
+                    template<typename HashType>
+                    struct xmd_batch_lanes {
+                        constexpr static const bool is_supported = false;
+                    };
+
+                    template<>
+                    struct xmd_batch_lanes<hashes::sha2<256>> {
+                        constexpr static const bool is_supported = true;
+                        typedef sha256_lanes_policy policy_type;
+                        typedef sha256_default_lanes default_lanes;
+                    };
+
+                    template<>
+                    struct xmd_batch_lanes<hashes::sha2<512>> {
+                        constexpr static const bool is_supported = true;
+                        typedef sha512_lanes_policy policy_type;
+                        typedef sha512_default_lanes default_lanes;
+                    };
+
+                    /**
+                     * @brief expand_message_xmd for many messages at once. Messages are taken Ops::lanes at a time
+                     * and every b_i of the group is computed by one call of the multi-buffer SHA-256 or SHA-512
+                     * kernel (AVX2, SSE2 or the portable fallback, see h2c_sha2_lanes.hpp). The output is byte
+                     * for byte the one of expand_message_xmd.
+                     */
+                    template<std::size_t k, typename HashType,
+                             typename Ops = typename xmd_batch_lanes<HashType>::default_lanes>
+                    class expand_message_xmd_batch {
+                        BOOST_STATIC_ASSERT_MSG(xmd_batch_lanes<HashType>::is_supported,
+                                                "multi-buffer expansion is only implemented for SHA-256 and SHA-512");
+
+                        typedef sha2_multibuffer<typename xmd_batch_lanes<HashType>::policy_type, Ops> kernel_type;
+                        typedef typename kernel_type::message_type message_type;
+                        typedef typename kernel_type::digest_type digest_type;
+
+                        constexpr static const std::size_t b_in_bytes = std::tuple_size<digest_type>::value;
+
+                    public:
+                        typedef expand_message_xmd<k, HashType> expand_message_type;
+                        typedef typename expand_message_type::dst_context dst_context;
+
+                        constexpr static const std::size_t lanes = kernel_type::lanes;
+
+                        /**
+                         * @brief Expands every message of [first, last) to len_in_bytes bytes, message i being
+                         * written to out + i * len_in_bytes. Messages have to be contiguous byte ranges.
+                         */
+                        template<typename InputIterator>
+                        static inline void process(const std::size_t len_in_bytes, InputIterator first,
+                                                   InputIterator last, const dst_context &ctx, std::uint8_t *out) {
+                            // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
+                            BOOST_ASSERT(len_in_bytes < 0x10000);
+
+                            const std::array<std::uint8_t, 3> l_i_b_str = {
                                 static_cast<std::uint8_t>(len_in_bytes >> 8u),
-                                static_cast<std::uint8_t>(len_in_bytes % 0x100)};
+                                static_cast<std::uint8_t>(len_in_bytes % 0x100), 0};
                             const std::size_t ell = static_cast<std::size_t>(len_in_bytes / b_in_bytes) +
                                                     static_cast<std::size_t>(len_in_bytes % b_in_bytes != 0);
-
-                            // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
                             BOOST_ASSERT(ell <= 255);
 
-                            // TODO: use accumulators when they will be fixed
-                            // accumulator_set<HashType> b0_acc;
-                            // hash<HashType>(Z_pad, b0_acc);
-                            // hash<HashType>(msg, b0_acc);
-                            // hash<HashType>(l_i_b_str, b0_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {0}, b0_acc);
-                            // hash<HashType>(dst, b0_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(dst.size())},
-                            // b0_acc); typename HashType::digest_type b0 =
-                            // accumulators::extract::hash<HashType>(b0_acc);
-                            std::vector<std::uint8_t> msg_prime;
-                            msg_prime.insert(msg_prime.end(), Z_pad.begin(), Z_pad.end());
-                            msg_prime.insert(msg_prime.end(), msg.begin(), msg.end());
-                            msg_prime.insert(msg_prime.end(), l_i_b_str.begin(), l_i_b_str.end());
-                            msg_prime.insert(msg_prime.end(), static_cast<std::uint8_t>(0));
-                            msg_prime.insert(msg_prime.end(), dst.begin(), dst.end());
-                            msg_prime.insert(msg_prime.end(),
-                                             static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end())));
-                            typename HashType::digest_type b0 = hash<HashType>(msg_prime);
-
-                            // TODO: use accumulators when they will be fixed
-                            // accumulator_set<HashType> bi_acc;
-                            // hash<HashType>(b0, bi_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {1}, bi_acc);
-                            // hash<HashType>(dst, bi_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(dst.size())},
-                            // bi_acc); typename HashType::digest_type bi =
-                            // accumulators::extract::hash<HashType>(bi_acc); std::copy(bi.begin(), bi.end(),
-                            // uniform_bytes.begin());
-                            std::vector<std::uint8_t> b_i_str;
-                            b_i_str.insert(b_i_str.end(), b0.begin(), b0.end());
-                            b_i_str.insert(b_i_str.end(), static_cast<std::uint8_t>(1));
-                            b_i_str.insert(b_i_str.end(), dst.begin(), dst.end());
-                            b_i_str.insert(b_i_str.end(),
-                                           static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end())));
-                            typename HashType::digest_type bi = hash<HashType>(b_i_str);
-                            std::copy(bi.begin(), bi.end(), uniform_bytes.begin());
-
-                            typename HashType::digest_type xored_b;
-                            for (std::size_t i = 2; i <= ell; i++) {
-                                // TODO: use accumulators when they will be fixed
-                                // accumulator_set<HashType> bi_acc;
-                                // strxor(b0, bi, xored_b);
-                                // hash<HashType>(xored_b, bi_acc);
-                                // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(i)}, bi_acc);
-                                // hash<HashType>(dst, bi_acc);
-                                // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(dst.size())},
-                                //                bi_acc);
-                                // bi = accumulators::extract::hash<HashType>(bi_acc);
-                                // std::copy(bi.begin(), bi.end(), uniform_bytes.begin() + (i - 1) * b_in_bytes);
-                                strxor(b0, bi, xored_b);
-                                std::vector<std::uint8_t> b_i_str;
-                                b_i_str.insert(b_i_str.end(), xored_b.begin(), xored_b.end());
-                                b_i_str.insert(b_i_str.end(), static_cast<std::uint8_t>(i));
-                                b_i_str.insert(b_i_str.end(), dst.begin(), dst.end());
-                                b_i_str.insert(b_i_str.end(),
-                                               static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end())));
-                                bi = hash<HashType>(b_i_str);
-                                std::copy(bi.begin(), bi.end(), uniform_bytes.begin() + (i - 1) * b_in_bytes);
+                            std::array<message_type, lanes> msgs;
+                            std::array<digest_type, lanes> b0, bi;
+                            std::array<std::uint8_t, 1> i_str;
+
+                            while (first != last) {
+                                // b_0 = H(Z_pad || msg || I2OSP(len_in_bytes, 2) || I2OSP(0, 1) || DST_prime),
+                                // Z_pad being already absorbed into zero_block_state()
+                                std::size_t count = 0;
+                                for (; count < lanes && first != last; ++count, ++first) {
+                                    msgs[count] = message_type();
+                                    msgs[count].prefix_size = message_type::block_bytes;
+                                    msgs[count].append(std::data(*first), std::size(*first));
+                                    msgs[count].append(l_i_b_str.data(), l_i_b_str.size());
+                                    msgs[count].append(ctx.dst_prime_data(), ctx.dst_prime_length());
+                                }
+                                kernel_type::process(kernel_type::zero_block_state(), msgs.data(), count, b0.data());
+
+                                // b_i = H(strxor(b_0, b_(i - 1)) || I2OSP(i, 1) || DST_prime)
+                                std::size_t offset = 0;
+                                for (std::size_t i = 1; i <= ell; i++) {
+                                    i_str[0] = static_cast<std::uint8_t>(i);
+                                    for (std::size_t l = 0; l < count; ++l) {
+                                        if (i == 1) {
+                                            bi[l] = b0[l];
+                                        } else {
+                                            strxor(b0[l], bi[l], bi[l]);
+                                        }
+                                        msgs[l] = message_type();
+                                        msgs[l].append(bi[l].data(), bi[l].size());
+                                        msgs[l].append(i_str.data(), i_str.size());
+                                        msgs[l].append(ctx.dst_prime_data(), ctx.dst_prime_length());
+                                    }
+                                    kernel_type::process(kernel_type::initial_state, msgs.data(), count, bi.data());
+
+                                    const std::size_t chunk = std::min(len_in_bytes - offset, b_in_bytes);
+                                    for (std::size_t l = 0; l < count; ++l) {
+                                        std::copy(bi[l].begin(), bi[l].begin() + chunk,
+                                                  out + l * len_in_bytes + offset);
+                                    }
+                                    offset += chunk;
+                                }
+                                out += count * len_in_bytes;
                             }
                         }
                     };
@@ -31,12 +31,85 @@
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_sgn0.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace curves {
                 namespace detail {
+                    /**
+                     * @brief sqrt_ratio subroutine of the simplified SWU map.
+                     * https://datatracker.ietf.org/doc/html/rfc9380#appendix-F.2.1.1
+                     *
+                     * Returns true and sqrt(u / v) if u / v is square, false and sqrt(Z * u / v) otherwise.
+                     * Only one exponentiation is performed and v is never inverted. Constants c1, c3, c6, c7
+                     * are taken from the suite; for q = 3 (mod 4) c1 == 1 and the loop is empty.
+                     */
+                    template<typename GroupType>
+                    struct sqrt_ratio {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        static inline bool process(const field_value_type &u, const field_value_type &v,
+                                                   field_value_type &result) {
+                            constexpr std::size_t c1 = suite_type::sqrt_ratio_c1;
+
+                            field_value_type tv1 = suite_type::sqrt_ratio_c6;
+                            // tv2 = v^c4, c4 = 2^c1 - 1
+                            field_value_type tv2 = v;
+                            for (std::size_t i = 1; i < c1; ++i) {
+                                tv2 = tv2.squared() * v;
+                            }
+                            field_value_type tv3 = tv2.squared() * v;
+                            field_value_type tv5 = (u * tv3).pow(suite_type::sqrt_ratio_c3) * tv2;
+                            tv2 = tv5 * v;
+                            tv3 = tv5 * u;
+                            field_value_type tv4 = tv3 * tv2;
+                            // tv5 = tv4^c5, c5 = 2^(c1 - 1)
+                            tv5 = tv4;
+                            for (std::size_t i = 1; i < c1; ++i) {
+                                tv5 = tv5.squared();
+                            }
+                            const bool is_qr = tv5 == field_value_type::one();
+                            tv2 = tv3 * suite_type::sqrt_ratio_c7;
+                            tv5 = tv4 * tv1;
+                            if (!is_qr) {
+                                tv3 = tv2;
+                                tv4 = tv5;
+                            }
+                            for (std::size_t i = c1; i >= 2; --i) {
+                                tv5 = tv4;
+                                for (std::size_t j = 2; j < i; ++j) {
+                                    tv5 = tv5.squared();
+                                }
+                                const bool e1 = tv5 == field_value_type::one();
+                                tv2 = tv3 * tv1;
+                                tv1 = tv1.squared();
+                                tv5 = tv4 * tv1;
+                                if (!e1) {
+                                    tv3 = tv2;
+                                    tv4 = tv5;
+                                }
+                            }
+                            result = tv3;
+                            return is_qr;
+                        }
+                    };
+
+                    /**
+                     * @brief Simplified SWU map, straight-line version.
+                     * https://datatracker.ietf.org/doc/html/rfc9380#appendix-F.2
+                     *
+                     * The result is returned in Jacobian coordinates (x = X / Z^2, y = Y / Z^3) on the curve
+                     * y^2 = x^3 + Ai * x + Bi, so no field inversion is needed.
+                     */
                     template<typename GroupType>
                     struct m2c_simple_swu {
                         typedef h2c_suite<GroupType> suite_type;
@@ -47,35 +120,35 @@ namespace nil {
                         static inline group_value_type process(const field_value_type &u) {
                             // TODO: We assume that Z meets the following criteria -- correct for predefined suites,
                             //  but wrong in general case
-                            // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-6.6.2
+                            // https://datatracker.ietf.org/doc/html/rfc9380#section-6.6.2
                             // Preconditions:
                             // 1.  Z is non-square in F,
                             // 2.  Z != -1 in F,
                             // 3.  the polynomial g(x) - Z is irreducible over F, and
                             // 4.  g(B / (Z * A)) is square in F.
-                            static const field_value_type one = field_value_type::one();
+                            field_value_type tv1 = suite_type::Z * u.squared();
+                            field_value_type tv2 = tv1.squared() + tv1;
+                            field_value_type tv3 = suite_type::Bi * (tv2 + field_value_type::one());
+                            field_value_type tv4 = suite_type::Ai * (tv2.is_zero() ? suite_type::Z : -tv2);
+                            field_value_type tv6 = tv4.squared();
+                            // gx1 numerator: tv3^3 + Ai * tv3 * tv4^2 + Bi * tv4^3
+                            tv2 = (tv3.squared() + suite_type::Ai * tv6) * tv3;
+                            tv6 *= tv4;
+                            tv2 += suite_type::Bi * tv6;
 
-                            field_value_type tv1 =
-                                (suite_type::Z.pow(2) * u.pow(4) + suite_type::Z * u.pow(2)).inversed();
-                            field_value_type x1 = (-suite_type::Bi / suite_type::Ai) * (one + tv1);
-                            if (tv1.is_zero()) {
-                                x1 = suite_type::Bi / (suite_type::Z * suite_type::Ai);
-                            }
-                            field_value_type gx1 = x1.pow(3) + suite_type::Ai * x1 + suite_type::Bi;
-                            field_value_type x2 = suite_type::Z * u.pow(2) * x1;
-                            field_value_type gx2 = x2.pow(3) + suite_type::Ai * x2 + suite_type::Bi;
-                            field_value_type x, y;
-                            if (gx1.is_square()) {
-                                x = x1;
-                                y = gx1.sqrt();
-                            } else {
-                                x = x2;
-                                y = gx2.sqrt();
+                            field_value_type x = tv1 * tv3;
+                            field_value_type y1;
+                            const bool is_gx1_square = sqrt_ratio<GroupType>::process(tv2, tv6, y1);
+                            field_value_type y = tv1 * u * y1;
+                            if (is_gx1_square) {
+                                x = tv3;
+                                y = y1;
                             }
                             if (sgn0(u) != sgn0(y)) {
                                 y = -y;
                             }
-                            return group_value_type(x, y, one);
+                            // x = x / tv4, tv6 = tv4^3
+                            return group_value_type(x * tv4, y * tv6, tv4);
                         }
                     };
 
@@ -92,6 +165,150 @@ namespace nil {
                         }
                     };
 
+                    /**
+                     * @brief Shallue-van de Woestijne map, straight-line version.
+                     * https://datatracker.ietf.org/doc/html/rfc9380#appendix-F.1
+                     *
+                     * Works for any Weierstrass curve, in particular for A == 0 curves without a known isogeny
+                     * of small degree. Needs one inversion and one square root plus two squareness tests; the
+                     * result is returned with Z = 1.
+                     */
+                    template<typename GroupType>
+                    struct m2c_svdw {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        static inline field_value_type g(const field_value_type &x) {
+                            return (x.squared() + suite_type::A) * x + suite_type::B;
+                        }
+
+                        static inline group_value_type process(const field_value_type &u) {
+                            field_value_type tv1 = u.squared() * suite_type::svdw_c1;
+                            const field_value_type tv2 = field_value_type::one() + tv1;
+                            tv1 = field_value_type::one() - tv1;
+                            field_value_type tv3 = tv1 * tv2;
+                            // inv0: 0 is mapped to 0
+                            if (!tv3.is_zero()) {
+                                tv3 = tv3.inversed();
+                            }
+                            const field_value_type tv4 = u * tv1 * tv3 * suite_type::svdw_c3;
+
+                            field_value_type x = suite_type::svdw_c2 - tv4;
+                            field_value_type gx = g(x);
+                            if (!gx.is_square()) {
+                                x = suite_type::svdw_c2 + tv4;
+                                gx = g(x);
+                                if (!gx.is_square()) {
+                                    x = (tv2.squared() * tv3).squared() * suite_type::svdw_c4 + suite_type::Z;
+                                    gx = g(x);
+                                }
+                            }
+
+                            field_value_type y = gx.sqrt();
+                            if (sgn0(u) != sgn0(y)) {
+                                y = -y;
+                            }
+                            return group_value_type(x, y, field_value_type::one());
+                        }
+                    };
+
+                    /**
+                     * @brief Elligator 2 map for curve25519, straight-line version.
+                     * https://datatracker.ietf.org/doc/html/rfc9380#appendix-G.2.1
+                     *
+                     * The square root of g(x1) and, when that one does not exist, of g(x2) are both derived from
+                     * a single exponentiation. x is returned as the fraction xn / xd, the denominator of y is 1.
+                     */
+                    template<typename GroupType>
+                    struct m2c_elligator2_curve25519 {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        static inline void process(const field_value_type &u, field_value_type &xn,
+                                                   field_value_type &xd, field_value_type &y) {
+                            field_value_type tv1 = suite_type::Z * u.squared();
+                            // nonzero: -1 is square mod p, tv1 is not
+                            xd = tv1 + field_value_type::one();
+                            const field_value_type x1n = -suite_type::J;
+                            field_value_type tv2 = xd.squared();
+                            const field_value_type gxd = tv2 * xd;
+                            // gx1 = x1n^3 + J * x1n^2 * xd + x1n * xd^2
+                            const field_value_type gx1 = (suite_type::J * tv1 * x1n + tv2) * x1n;
+                            field_value_type tv3 = gxd.squared();
+                            tv2 = tv3.squared();
+                            tv3 *= gxd * gx1;
+                            // y11 = gx1 * gxd^3 * (gx1 * gxd^7)^((p - 5) / 8)
+                            const field_value_type y11 = (tv2 * tv3).pow(suite_type::ell2_c4) * tv3;
+                            const field_value_type y12 = y11 * suite_type::ell2_c3;
+                            const field_value_type y1 = y11.squared() * gxd == gx1 ? y11 : y12;
+
+                            // x2 = 2 * u^2 * x1, g(x2) = 2 * u^2 * g(x1)
+                            const field_value_type x2n = x1n * tv1;
+                            const field_value_type y21 = y11 * u * suite_type::ell2_c2;
+                            const field_value_type y22 = y21 * suite_type::ell2_c3;
+                            const field_value_type y2 = y21.squared() * gxd == gx1 * tv1 ? y21 : y22;
+
+                            const bool e3 = y1.squared() * gxd == gx1;
+                            xn = e3 ? x1n : x2n;
+                            y = e3 ? y1 : y2;
+                            if (e3 != sgn0(y)) {
+                                y = -y;
+                            }
+                        }
+                    };
+
+                    /**
+                     * @brief Elligator 2 for curve25519, result in affine Montgomery coordinates. Costs one
+                     * inversion on top of m2c_elligator2_curve25519.
+                     */
+                    template<typename GroupType>
+                    struct m2c_elligator2_montgomery {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        static inline group_value_type process(const field_value_type &u) {
+                            field_value_type xn, xd, y;
+                            m2c_elligator2_curve25519<GroupType>::process(u, xn, xd, y);
+                            return group_value_type(xn * xd.inversed(), y);
+                        }
+                    };
+
+                    /**
+                     * @brief Elligator 2 for edwards25519: curve25519 map followed by the rational map
+                     * (x, y) = (c1 * u / v, (u - 1) / (u + 1)), c1 = sqrt(-486664).
+                     * https://datatracker.ietf.org/doc/html/rfc9380#appendix-G.2.2
+                     *
+                     * The result is returned in extended coordinates, no inversion is needed.
+                     */
+                    template<typename GroupType>
+                    struct m2c_elligator2_edwards25519 {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        static inline group_value_type process(const field_value_type &u) {
+                            field_value_type xMn, xMd, yM;
+                            m2c_elligator2_curve25519<GroupType>::process(u, xMn, xMd, yM);
+
+                            const field_value_type xn = xMn * suite_type::ell2_edwards_c1;
+                            const field_value_type xd = xMd * yM;
+                            const field_value_type yn = xMn - xMd;
+                            const field_value_type yd = xMn + xMd;
+                            // exceptional points of the rational map go to the identity
+                            if ((xd * yd).is_zero()) {
+                                return group_value_type::zero();
+                            }
+                            // x = X / Z, y = Y / Z, T = X * Y / Z
+                            return group_value_type(xn * yd, yn * xd, xn * yn, xd * yd);
+                        }
+                    };
+
                     template<typename GroupType>
                     struct map_to_curve;
 
@@ -102,6 +319,34 @@ namespace nil {
                     template<>
                     struct map_to_curve<typename bls12_381::g2_type<>>
                         : m2c_simple_swu_zeroAB<typename bls12_381::g2_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename secp_k1<256>::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename secp_k1<256>::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename pallas::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename pallas::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename vesta::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename vesta::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename alt_bn128<254>::g1_type<>>
+                        : m2c_svdw<typename alt_bn128<254>::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename alt_bn128<254>::g2_type<>>
+                        : m2c_svdw<typename alt_bn128<254>::g2_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename curve25519::g1_type<coordinates::affine>>
+                        : m2c_elligator2_montgomery<typename curve25519::g1_type<coordinates::affine>> { };
+
+                    template<>
+                    struct map_to_curve<typename ed25519::g1_type<>>
+                        : m2c_elligator2_edwards25519<typename ed25519::g1_type<>> { };
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
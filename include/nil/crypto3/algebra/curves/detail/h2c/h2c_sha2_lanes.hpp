@@ -0,0 +1,594 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SHA2_LANES_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SHA2_LANES_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief Lane operations for the multi-buffer SHA-2 kernels: every operation is applied to
+                     * Lanes independent words. This is the portable fallback; written as plain loops it is left to
+                     * the compiler to vectorise.
+                     */
+                    template<typename WordType, std::size_t Lanes>
+                    struct sha2_portable_lanes {
+                        constexpr static const std::size_t lanes = Lanes;
+                        typedef WordType value_type;
+                        typedef std::array<WordType, Lanes> word_type;
+
+                        static inline word_type load(const WordType *p) {
+                            word_type r;
+                            std::copy(p, p + Lanes, r.begin());
+                            return r;
+                        }
+                        static inline void store(WordType *p, const word_type &a) {
+                            std::copy(a.begin(), a.end(), p);
+                        }
+                        static inline word_type set1(WordType v) {
+                            word_type r;
+                            r.fill(v);
+                            return r;
+                        }
+                        static inline word_type add(const word_type &a, const word_type &b) {
+                            word_type r;
+                            for (std::size_t i = 0; i < Lanes; ++i) {
+                                r[i] = a[i] + b[i];
+                            }
+                            return r;
+                        }
+                        static inline word_type bxor(const word_type &a, const word_type &b) {
+                            word_type r;
+                            for (std::size_t i = 0; i < Lanes; ++i) {
+                                r[i] = a[i] ^ b[i];
+                            }
+                            return r;
+                        }
+                        static inline word_type band(const word_type &a, const word_type &b) {
+                            word_type r;
+                            for (std::size_t i = 0; i < Lanes; ++i) {
+                                r[i] = a[i] & b[i];
+                            }
+                            return r;
+                        }
+                        // ~a & b
+                        static inline word_type bandnot(const word_type &a, const word_type &b) {
+                            word_type r;
+                            for (std::size_t i = 0; i < Lanes; ++i) {
+                                r[i] = ~a[i] & b[i];
+                            }
+                            return r;
+                        }
+                        template<unsigned N>
+                        static inline word_type rotr(const word_type &a) {
+                            word_type r;
+                            for (std::size_t i = 0; i < Lanes; ++i) {
+                                r[i] = (a[i] >> N) | (a[i] << (8 * sizeof(WordType) - N));
+                            }
+                            return r;
+                        }
+                        template<unsigned N>
+                        static inline word_type shr(const word_type &a) {
+                            word_type r;
+                            for (std::size_t i = 0; i < Lanes; ++i) {
+                                r[i] = a[i] >> N;
+                            }
+                            return r;
+                        }
+                    };
+
+                    template<std::size_t Lanes>
+                    using sha256_portable_lanes = sha2_portable_lanes<std::uint32_t, Lanes>;
+
+                    template<std::size_t Lanes>
+                    using sha512_portable_lanes = sha2_portable_lanes<std::uint64_t, Lanes>;
+
+#if defined(__AVX2__)
+                    /// @brief 8 32-bit lanes in one AVX2 register
+                    struct sha256_avx2_lanes {
+                        constexpr static const std::size_t lanes = 8;
+                        typedef std::uint32_t value_type;
+                        typedef __m256i word_type;
+
+                        static inline word_type load(const std::uint32_t *p) {
+                            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+                        }
+                        static inline void store(std::uint32_t *p, const word_type &a) {
+                            _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), a);
+                        }
+                        static inline word_type set1(std::uint32_t v) {
+                            return _mm256_set1_epi32(static_cast<int>(v));
+                        }
+                        static inline word_type add(const word_type &a, const word_type &b) {
+                            return _mm256_add_epi32(a, b);
+                        }
+                        static inline word_type bxor(const word_type &a, const word_type &b) {
+                            return _mm256_xor_si256(a, b);
+                        }
+                        static inline word_type band(const word_type &a, const word_type &b) {
+                            return _mm256_and_si256(a, b);
+                        }
+                        static inline word_type bandnot(const word_type &a, const word_type &b) {
+                            return _mm256_andnot_si256(a, b);
+                        }
+                        template<unsigned N>
+                        static inline word_type rotr(const word_type &a) {
+                            return _mm256_or_si256(_mm256_srli_epi32(a, N), _mm256_slli_epi32(a, 32 - N));
+                        }
+                        template<unsigned N>
+                        static inline word_type shr(const word_type &a) {
+                            return _mm256_srli_epi32(a, N);
+                        }
+                    };
+
+                    /// @brief 4 64-bit lanes in one AVX2 register
+                    struct sha512_avx2_lanes {
+                        constexpr static const std::size_t lanes = 4;
+                        typedef std::uint64_t value_type;
+                        typedef __m256i word_type;
+
+                        static inline word_type load(const std::uint64_t *p) {
+                            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+                        }
+                        static inline void store(std::uint64_t *p, const word_type &a) {
+                            _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), a);
+                        }
+                        static inline word_type set1(std::uint64_t v) {
+                            return _mm256_set1_epi64x(static_cast<long long>(v));
+                        }
+                        static inline word_type add(const word_type &a, const word_type &b) {
+                            return _mm256_add_epi64(a, b);
+                        }
+                        static inline word_type bxor(const word_type &a, const word_type &b) {
+                            return _mm256_xor_si256(a, b);
+                        }
+                        static inline word_type band(const word_type &a, const word_type &b) {
+                            return _mm256_and_si256(a, b);
+                        }
+                        static inline word_type bandnot(const word_type &a, const word_type &b) {
+                            return _mm256_andnot_si256(a, b);
+                        }
+                        template<unsigned N>
+                        static inline word_type rotr(const word_type &a) {
+                            return _mm256_or_si256(_mm256_srli_epi64(a, N), _mm256_slli_epi64(a, 64 - N));
+                        }
+                        template<unsigned N>
+                        static inline word_type shr(const word_type &a) {
+                            return _mm256_srli_epi64(a, N);
+                        }
+                    };
+
+                    typedef sha256_avx2_lanes sha256_default_lanes;
+                    typedef sha512_avx2_lanes sha512_default_lanes;
+#elif defined(__SSE2__) || defined(_M_X64)
+                    /// @brief 4 32-bit lanes in one SSE2 register
+                    struct sha256_sse2_lanes {
+                        constexpr static const std::size_t lanes = 4;
+                        typedef std::uint32_t value_type;
+                        typedef __m128i word_type;
+
+                        static inline word_type load(const std::uint32_t *p) {
+                            return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+                        }
+                        static inline void store(std::uint32_t *p, const word_type &a) {
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(p), a);
+                        }
+                        static inline word_type set1(std::uint32_t v) {
+                            return _mm_set1_epi32(static_cast<int>(v));
+                        }
+                        static inline word_type add(const word_type &a, const word_type &b) {
+                            return _mm_add_epi32(a, b);
+                        }
+                        static inline word_type bxor(const word_type &a, const word_type &b) {
+                            return _mm_xor_si128(a, b);
+                        }
+                        static inline word_type band(const word_type &a, const word_type &b) {
+                            return _mm_and_si128(a, b);
+                        }
+                        static inline word_type bandnot(const word_type &a, const word_type &b) {
+                            return _mm_andnot_si128(a, b);
+                        }
+                        template<unsigned N>
+                        static inline word_type rotr(const word_type &a) {
+                            return _mm_or_si128(_mm_srli_epi32(a, N), _mm_slli_epi32(a, 32 - N));
+                        }
+                        template<unsigned N>
+                        static inline word_type shr(const word_type &a) {
+                            return _mm_srli_epi32(a, N);
+                        }
+                    };
+
+                    /// @brief 2 64-bit lanes in one SSE2 register
+                    struct sha512_sse2_lanes {
+                        constexpr static const std::size_t lanes = 2;
+                        typedef std::uint64_t value_type;
+                        typedef __m128i word_type;
+
+                        static inline word_type load(const std::uint64_t *p) {
+                            return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+                        }
+                        static inline void store(std::uint64_t *p, const word_type &a) {
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(p), a);
+                        }
+                        static inline word_type set1(std::uint64_t v) {
+                            return _mm_set1_epi64x(static_cast<long long>(v));
+                        }
+                        static inline word_type add(const word_type &a, const word_type &b) {
+                            return _mm_add_epi64(a, b);
+                        }
+                        static inline word_type bxor(const word_type &a, const word_type &b) {
+                            return _mm_xor_si128(a, b);
+                        }
+                        static inline word_type band(const word_type &a, const word_type &b) {
+                            return _mm_and_si128(a, b);
+                        }
+                        static inline word_type bandnot(const word_type &a, const word_type &b) {
+                            return _mm_andnot_si128(a, b);
+                        }
+                        template<unsigned N>
+                        static inline word_type rotr(const word_type &a) {
+                            return _mm_or_si128(_mm_srli_epi64(a, N), _mm_slli_epi64(a, 64 - N));
+                        }
+                        template<unsigned N>
+                        static inline word_type shr(const word_type &a) {
+                            return _mm_srli_epi64(a, N);
+                        }
+                    };
+
+                    typedef sha256_sse2_lanes sha256_default_lanes;
+                    typedef sha512_sse2_lanes sha512_default_lanes;
+#else
+                    typedef sha256_portable_lanes<4> sha256_default_lanes;
+                    typedef sha512_portable_lanes<2> sha512_default_lanes;
+#endif
+
+                    /**
+                     * @brief One message of a multi-buffer SHA-2 call, given as up to max_pieces pieces which are
+                     * hashed as if they were concatenated. prefix_size is the number of bytes already absorbed into
+                     * the initial state; it only enters the length encoded in the padding.
+                     */
+                    template<typename WordType>
+                    struct sha2_lane_message {
+                        // 16 words per block, the bit length takes the last two
+                        constexpr static const std::size_t block_bytes = 16 * sizeof(WordType);
+                        constexpr static const std::size_t length_bytes = 2 * sizeof(WordType);
+
+                        constexpr static const std::size_t max_pieces = 4;
+
+                        std::array<const std::uint8_t *, max_pieces> data;
+                        std::array<std::size_t, max_pieces> size;
+                        std::size_t pieces = 0;
+                        std::size_t prefix_size = 0;
+
+                        void append(const std::uint8_t *piece_data, std::size_t piece_size) {
+                            if (pieces == max_pieces) {
+                                throw std::length_error("sha2_lane_message: too many pieces");
+                            }
+                            data[pieces] = piece_data;
+                            size[pieces] = piece_size;
+                            ++pieces;
+                        }
+
+                        std::size_t length() const {
+                            std::size_t result = 0;
+                            for (std::size_t i = 0; i < pieces; ++i) {
+                                result += size[i];
+                            }
+                            return result;
+                        }
+
+                        std::size_t blocks() const {
+                            return (length() + 1 + length_bytes + block_bytes - 1) / block_bytes;
+                        }
+
+                        /// @brief Writes the padded block number index as 16 big-endian words.
+                        template<typename OutputWordIterator>
+                        void fill_block(std::size_t index, OutputWordIterator words) const {
+                            std::array<std::uint8_t, block_bytes> block {0};
+                            const std::size_t begin = index * block_bytes, end = begin + block_bytes,
+                                              total = length();
+
+                            std::size_t offset = 0;
+                            for (std::size_t i = 0; i < pieces && offset < end; offset += size[i], ++i) {
+                                const std::size_t from = std::max(begin, offset);
+                                const std::size_t to = std::min(end, offset + size[i]);
+                                if (from < to) {
+                                    std::copy(data[i] + (from - offset), data[i] + (to - offset),
+                                              block.begin() + (from - begin));
+                                }
+                            }
+                            if (total >= begin && total < end) {
+                                block[total - begin] = 0x80;
+                            }
+                            if (index + 1 == blocks()) {
+                                // the high bytes of a 128-bit length stay zero
+                                const std::uint64_t bit_length = static_cast<std::uint64_t>(prefix_size + total) * 8;
+                                for (std::size_t i = 0; i < 8; ++i) {
+                                    block[block_bytes - 1 - i] = static_cast<std::uint8_t>(bit_length >> (8 * i));
+                                }
+                            }
+
+                            for (std::size_t t = 0; t < 16; ++t, ++words) {
+                                WordType word = 0;
+                                for (std::size_t i = 0; i < sizeof(WordType); ++i) {
+                                    word = (word << 8) | block[sizeof(WordType) * t + i];
+                                }
+                                *words = word;
+                            }
+                        }
+                    };
+
+                    typedef sha2_lane_message<std::uint32_t> sha256_lane_message;
+                    typedef sha2_lane_message<std::uint64_t> sha512_lane_message;
+
+                    /**
+                     * @brief SHA-256 constants and rotation amounts.
+                     * https://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.180-4.pdf, sections 4.1.2, 4.2.2, 5.3.3
+                     */
+                    struct sha256_lanes_policy {
+                        typedef std::uint32_t word_type;
+
+                        constexpr static const std::size_t rounds = 64;
+
+                        // rotations of Sigma_0 and Sigma_1, rotations and shift of sigma_0 and sigma_1
+                        constexpr static const std::array<unsigned, 3> big_sigma0 = {2, 13, 22};
+                        constexpr static const std::array<unsigned, 3> big_sigma1 = {6, 11, 25};
+                        constexpr static const std::array<unsigned, 3> small_sigma0 = {7, 18, 3};
+                        constexpr static const std::array<unsigned, 3> small_sigma1 = {17, 19, 10};
+
+                        constexpr static const std::array<std::uint32_t, 8> initial_state = {
+                            0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                            0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+                        constexpr static const std::array<std::uint32_t, rounds> round_constants = {
+                            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+                            0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+                            0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+                            0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+                            0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+                            0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+                            0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+                            0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+                            0xc67178f2};
+                    };
+
+                    /**
+                     * @brief SHA-512 constants and rotation amounts.
+                     * https://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.180-4.pdf, sections 4.1.3, 4.2.3, 5.3.5
+                     */
+                    struct sha512_lanes_policy {
+                        typedef std::uint64_t word_type;
+
+                        constexpr static const std::size_t rounds = 80;
+
+                        constexpr static const std::array<unsigned, 3> big_sigma0 = {28, 34, 39};
+                        constexpr static const std::array<unsigned, 3> big_sigma1 = {14, 18, 41};
+                        constexpr static const std::array<unsigned, 3> small_sigma0 = {1, 8, 7};
+                        constexpr static const std::array<unsigned, 3> small_sigma1 = {19, 61, 6};
+
+                        constexpr static const std::array<std::uint64_t, 8> initial_state = {
+                            0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+                            0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179};
+
+                        constexpr static const std::array<std::uint64_t, rounds> round_constants = {
+                            0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc,
+                            0x3956c25bf348b538, 0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
+                            0xd807aa98a3030242, 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
+                            0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235, 0xc19bf174cf692694,
+                            0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+                            0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
+                            0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4,
+                            0xc6e00bf33da88fc2, 0xd5a79147930aa725, 0x06ca6351e003826f, 0x142929670a0e6e70,
+                            0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
+                            0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
+                            0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30,
+                            0xd192e819d6ef5218, 0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8,
+                            0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8,
+                            0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3,
+                            0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+                            0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b,
+                            0xca273eceea26619c, 0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178,
+                            0x06f067aa72176fba, 0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b,
+                            0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c,
+                            0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817};
+                    };
+
+                    /**
+                     * @brief SHA-2 compression over Ops::lanes independent messages in lock-step.
+                     * https://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.180-4.pdf, sections 6.2 and 6.4
+                     *
+                     * The state and the message words are stored word-major (one row of lanes per word), so a
+                     * row maps to a single vector register of the lane operations.
+                     */
+                    template<typename Policy, typename Ops>
+                    struct sha2_multibuffer {
+                        static_assert(std::is_same<typename Ops::value_type, typename Policy::word_type>::value,
+                                      "lane operations of another word size");
+
+                        constexpr static const std::size_t lanes = Ops::lanes;
+
+                        typedef typename Policy::word_type value_type;
+                        typedef typename Ops::word_type word_type;
+                        typedef sha2_lane_message<value_type> message_type;
+                        typedef std::array<value_type, 8> state_type;
+                        typedef std::array<std::uint8_t, 8 * sizeof(value_type)> digest_type;
+                        typedef std::array<std::array<value_type, lanes>, 8> lanes_state_type;
+                        typedef std::array<std::array<value_type, lanes>, 16> lanes_block_type;
+
+                        constexpr static const state_type initial_state = Policy::initial_state;
+
+                        static inline void compress(lanes_state_type &state, const lanes_block_type &block) {
+                            constexpr const auto &S0 = Policy::big_sigma0;
+                            constexpr const auto &S1 = Policy::big_sigma1;
+                            constexpr const auto &s0 = Policy::small_sigma0;
+                            constexpr const auto &s1 = Policy::small_sigma1;
+
+                            word_type w[Policy::rounds];
+                            for (std::size_t t = 0; t < 16; ++t) {
+                                w[t] = Ops::load(block[t].data());
+                            }
+                            for (std::size_t t = 16; t < Policy::rounds; ++t) {
+                                const word_type sigma0 = Ops::bxor(Ops::bxor(Ops::template rotr<s0[0]>(w[t - 15]),
+                                                                             Ops::template rotr<s0[1]>(w[t - 15])),
+                                                                   Ops::template shr<s0[2]>(w[t - 15]));
+                                const word_type sigma1 = Ops::bxor(Ops::bxor(Ops::template rotr<s1[0]>(w[t - 2]),
+                                                                             Ops::template rotr<s1[1]>(w[t - 2])),
+                                                                   Ops::template shr<s1[2]>(w[t - 2]));
+                                w[t] = Ops::add(Ops::add(sigma1, w[t - 7]), Ops::add(sigma0, w[t - 16]));
+                            }
+
+                            word_type a = Ops::load(state[0].data()), b = Ops::load(state[1].data()),
+                                      c = Ops::load(state[2].data()), d = Ops::load(state[3].data()),
+                                      e = Ops::load(state[4].data()), f = Ops::load(state[5].data()),
+                                      g = Ops::load(state[6].data()), h = Ops::load(state[7].data());
+
+                            for (std::size_t t = 0; t < Policy::rounds; ++t) {
+                                const word_type sum1 = Ops::bxor(
+                                    Ops::bxor(Ops::template rotr<S1[0]>(e), Ops::template rotr<S1[1]>(e)),
+                                    Ops::template rotr<S1[2]>(e));
+                                const word_type ch = Ops::bxor(Ops::band(e, f), Ops::bandnot(e, g));
+                                const word_type t1 = Ops::add(Ops::add(Ops::add(h, sum1), Ops::add(ch, w[t])),
+                                                              Ops::set1(Policy::round_constants[t]));
+                                const word_type sum0 = Ops::bxor(
+                                    Ops::bxor(Ops::template rotr<S0[0]>(a), Ops::template rotr<S0[1]>(a)),
+                                    Ops::template rotr<S0[2]>(a));
+                                const word_type maj =
+                                    Ops::bxor(Ops::bxor(Ops::band(a, b), Ops::band(a, c)), Ops::band(b, c));
+                                const word_type t2 = Ops::add(sum0, maj);
+                                h = g;
+                                g = f;
+                                f = e;
+                                e = Ops::add(d, t1);
+                                d = c;
+                                c = b;
+                                b = a;
+                                a = Ops::add(t1, t2);
+                            }
+
+                            const word_type result[8] = {a, b, c, d, e, f, g, h};
+                            for (std::size_t i = 0; i < 8; ++i) {
+                                Ops::store(state[i].data(), Ops::add(Ops::load(state[i].data()), result[i]));
+                            }
+                        }
+
+                        /**
+                         * @brief Hashes count <= lanes messages starting from the chaining value iv. Lanes whose
+                         * message is shorter than the longest one keep their state while the others finish.
+                         */
+                        static inline void process(const state_type &iv, const message_type *msgs, std::size_t count,
+                                                   digest_type *digests) {
+                            lanes_state_type state;
+                            for (std::size_t i = 0; i < 8; ++i) {
+                                state[i].fill(iv[i]);
+                            }
+
+                            std::array<std::size_t, lanes> blocks {0};
+                            std::size_t max_blocks = 0;
+                            for (std::size_t l = 0; l < count; ++l) {
+                                blocks[l] = msgs[l].blocks();
+                                max_blocks = std::max(max_blocks, blocks[l]);
+                            }
+
+                            lanes_block_type block {};
+                            std::array<value_type, 16> words;
+                            for (std::size_t j = 0; j < max_blocks; ++j) {
+                                for (std::size_t l = 0; l < count; ++l) {
+                                    if (j < blocks[l]) {
+                                        msgs[l].fill_block(j, words.begin());
+                                        for (std::size_t t = 0; t < 16; ++t) {
+                                            block[t][l] = words[t];
+                                        }
+                                    }
+                                }
+
+                                const lanes_state_type previous = state;
+                                compress(state, block);
+                                for (std::size_t l = 0; l < lanes; ++l) {
+                                    if (l >= count || j >= blocks[l]) {
+                                        for (std::size_t i = 0; i < 8; ++i) {
+                                            state[i][l] = previous[i][l];
+                                        }
+                                    }
+                                }
+                            }
+
+                            constexpr std::size_t word_bytes = sizeof(value_type);
+                            for (std::size_t l = 0; l < count; ++l) {
+                                for (std::size_t i = 0; i < 8; ++i) {
+                                    for (std::size_t k = 0; k < word_bytes; ++k) {
+                                        digests[l][word_bytes * i + k] =
+                                            static_cast<std::uint8_t>(state[i][l] >> (8 * (word_bytes - 1 - k)));
+                                    }
+                                }
+                            }
+                        }
+
+                        /// @brief Chaining value after one all-zero block, the Z_pad prefix of expand_message_xmd
+                        static inline const state_type &zero_block_state() {
+                            static const state_type result = []() {
+                                lanes_state_type state;
+                                for (std::size_t i = 0; i < 8; ++i) {
+                                    state[i].fill(initial_state[i]);
+                                }
+                                compress(state, lanes_block_type {});
+                                state_type r;
+                                for (std::size_t i = 0; i < 8; ++i) {
+                                    r[i] = state[i][0];
+                                }
+                                return r;
+                            }();
+                            return result;
+                        }
+                    };
+
+                    template<typename Ops = sha256_default_lanes>
+                    using sha256_multibuffer = sha2_multibuffer<sha256_lanes_policy, Ops>;
+
+                    template<typename Ops = sha512_default_lanes>
+                    using sha512_multibuffer = sha2_multibuffer<sha512_lanes_policy, Ops>;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SHA2_LANES_HPP
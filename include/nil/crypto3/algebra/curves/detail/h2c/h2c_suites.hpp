@@ -27,9 +27,16 @@
 #define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SUITES_HPP
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/blake2b.hpp>
 
 //#include <nil/crypto3/algebra/curves/detail/h2c/h2c_utils.hpp>
 //#include <nil/crypto3/algebra/curves/detail/h2c/h2c_iso_map.hpp>
@@ -74,6 +81,21 @@ namespace nil {
                             0x12e2908d11688030018b12e8753eee3b2016c1f0f24f4070a0b9c14fcef35ef55a23215a316ceaa5d1cc48e98e172be0_cppui381);
                         constexpr static inline const field_value_type Z = field_value_type(11);
                         constexpr static integral_type h_eff = 0xd201000000010001_cppui381;
+
+                        // sqrt_ratio constants, https://datatracker.ietf.org/doc/html/rfc9380#appendix-F.2.1.1
+                        // c1 = 2-adicity of p - 1, c3 = (c2 - 1) / 2 with c2 = (p - 1) / 2^c1, c6 = Z^c2,
+                        // c7 = Z^((c2 + 1) / 2)
+                        constexpr static std::size_t sqrt_ratio_c1 = 1;
+                        constexpr static integral_type sqrt_ratio_c3 =
+                            0x680447a8e5ff9a692c6e9ed90d2eb35d91dd2e13ce144afd9cc34a83dac3d8907aaffffac54ffffee7fbfffffffeaaa_cppui379;
+                        constexpr static inline const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0x1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaaa_cppui381);
+                        constexpr static inline const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x15a003e9fdac3a056b72834a0a3e325ed0514982620f6df530c37281c2bd61b5dfd8686a3df7c7ce5c77b43e28f972e8_cppui381);
+
+                        // BLS parameter z = -0xd201000000010000, h_eff = 1 - z
+                        constexpr static integral_type z = 0xd201000000010000_cppui64;
+                        constexpr static bool z_is_neg = true;
                     };
 
                     template<>
@@ -107,6 +129,323 @@ namespace nil {
 #endif
                         constexpr static inline auto h_eff =
                             0xbc69f08f2ee75b3584c6a0ea91b352888e2a8e9145ad7689986ff031508ffe1329c2f178731db956d82bf015d1212b02ec0ec69d7477c1ae954cbc06689f6a359894c0adebbf6b4e8020005aaa95551_cppui636;
+
+                        // sqrt_ratio constants over p^2, https://datatracker.ietf.org/doc/html/rfc9380#appendix-F.2.1.1
+                        constexpr static std::size_t sqrt_ratio_c1 = 3;
+                        constexpr static inline auto sqrt_ratio_c3 =
+                            0x2a437a4b8c35fc74bd278eaa22f25e9e2dc90e50e7046b466e59e49349e8bd050a62cfd16ddca6ef53149330978ef011d68619c86185c7b292e85a87091a04966bf91ed3e71b743162c338362113cfd7ced6b1d76382eab26aa00001c718e3_cppui758;
+                        constexpr static inline field_value_type sqrt_ratio_c6 = field_value_type(
+                            0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09_cppui379,
+                            0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09_cppui379);
+                        constexpr static inline field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x13dc0969311e2ba565924cb0b6f7bb9857f157e17f0c8db4e484fcb27b8be0b36dfa0340c422fb7efe9d9a3234336d5e_cppui381,
+                            0x71d42ac9c54001a21acf9187d469d919a830a2c969128d22659dc2f8263f1ca73c5b0e02c05ec381b8684a676a81381_cppui379);
+
+                        // BLS parameter z = -0xd201000000010000
+                        constexpr static integral_type z = 0xd201000000010000_cppui64;
+                        constexpr static bool z_is_neg = true;
+
+                        // https://datatracker.ietf.org/doc/html/rfc9380#appendix-G.3
+                        // psi_c1 = 1 / (1 + I)^((p - 1) / 3)
+                        constexpr static inline field_value_type psi_c1 = field_value_type(
+                            0,
+                            0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaad_cppui381);
+                        // psi_c2 = 1 / (1 + I)^((p - 1) / 2)
+                        constexpr static inline field_value_type psi_c2 = field_value_type(
+                            0x135203e60180a68ee2e9c448d77a2cd91c3dedd930b1cf60ef396489f61eb45e304466cf3e67fa0af1ee7b04121bdea2_cppui381,
+                            0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09_cppui379);
+                        // psi2_c1 = 1 / 2^((p - 1) / 3)
+                        constexpr static inline field_value_type psi2_c1 = field_value_type(
+                            0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaac_cppui381,
+                            0);
+                    };
+
+                    template<>
+                    struct h2c_suite<typename secp_k1<256>::g1_type<>> {
+                        typedef secp_k1<256> curve_type;
+                        typedef typename secp_k1<256>::g1_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // secp256k1_XMD:SHA-256_SSWU_RO_
+                        // https://datatracker.ietf.org/doc/html/rfc9380#section-8.7
+                        constexpr static std::array<std::uint8_t, 30> suite_id = {
+                            0x73, 0x65, 0x63, 0x70, 0x32, 0x35, 0x36, 0x6b, 0x31, 0x5f, 0x58,
+                            0x4d, 0x44, 0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f,
+                            0x53, 0x53, 0x57, 0x55, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        // A' and B' of the 3-isogenous curve E', Z = -11
+                        constexpr static inline const field_value_type Ai = field_value_type(
+                            0x3f8731abdd661adca08a5558f0f5d272e953d363cb6f0e5d405447c01a444533_cppui256);
+                        constexpr static inline const field_value_type Bi = field_value_type(1771);
+                        constexpr static inline const field_value_type Z = field_value_type(
+                            0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc24_cppui256);
+                        constexpr static integral_type h_eff = 1;
+
+                        constexpr static std::size_t sqrt_ratio_c1 = 1;
+                        constexpr static integral_type sqrt_ratio_c3 =
+                            0x3fffffffffffffffffffffffffffffffffffffffffffffffffffffffbfffff0b_cppui256;
+                        constexpr static inline const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2e_cppui256);
+                        constexpr static inline const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x31fdf302724013e57ad13fb38f842afeec184f00a74789dd286729c8303c4a59_cppui256);
+                    };
+
+                    /**
+                     * Pallas and Vesta suites use the map of the Zcash/halo2 instantiation: simplified SWU onto an
+                     * isogenous curve y^2 = x^3 + A' * x + 1265, Z = -13, followed by a 3-isogeny. Messages are
+                     * expanded with the RFC 9380 expand_message_xmd over BLAKE2b-512, L = 64.
+                     * https://github.com/zcash/pasta_curves/blob/main/src/hashtocurve.rs
+                     */
+                    template<>
+                    struct h2c_suite<typename pallas::g1_type<>> {
+                        typedef pallas curve_type;
+                        typedef typename pallas::g1_type<> group_type;
+                        typedef hashes::blake2b<512> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // pallas_XMD:BLAKE2b_SSWU_RO_
+                        constexpr static std::array<std::uint8_t, 27> suite_id = {
+                            0x70, 0x61, 0x6c, 0x6c, 0x61, 0x73, 0x5f, 0x58, 0x4d, 0x44, 0x3a,
+                            0x42, 0x4c, 0x41, 0x4b, 0x45, 0x32, 0x62, 0x5f, 0x53, 0x53, 0x57,
+                            0x55, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 256;
+                        constexpr static std::size_t L = 64;
+
+                        constexpr static inline const field_value_type Ai = field_value_type(
+                            0x18354a2eb0ea8c9c49be2d7258370742b74134581a27a59f92bb4b0b657a014b_cppui255);
+                        constexpr static inline const field_value_type Bi = field_value_type(1265);
+                        constexpr static inline const field_value_type Z = field_value_type(
+                            0x40000000000000000000000000000000224698fc094cf91b992d30ecfffffff4_cppui255);
+                        constexpr static integral_type h_eff = 1;
+
+                        constexpr static std::size_t sqrt_ratio_c1 = 32;
+                        constexpr static integral_type sqrt_ratio_c3 =
+                            0x2000000000000000000000000000000011234c7e04a67c8dcc969876_cppui255;
+                        constexpr static inline const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0x3532c03204fba871900f0174278bfa48a84bde8a976e4e47a58f2ab23e9ea126_cppui255);
+                        constexpr static inline const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x3dc271c8308fca72f0b7a1a19440ccc7325f98710655bac58f7f70a4ccefc9e9_cppui255);
+                    };
+
+                    template<>
+                    struct h2c_suite<typename vesta::g1_type<>> {
+                        typedef vesta curve_type;
+                        typedef typename vesta::g1_type<> group_type;
+                        typedef hashes::blake2b<512> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // vesta_XMD:BLAKE2b_SSWU_RO_
+                        constexpr static std::array<std::uint8_t, 26> suite_id = {
+                            0x76, 0x65, 0x73, 0x74, 0x61, 0x5f, 0x58, 0x4d, 0x44, 0x3a, 0x42,
+                            0x4c, 0x41, 0x4b, 0x45, 0x32, 0x62, 0x5f, 0x53, 0x53, 0x57, 0x55,
+                            0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 256;
+                        constexpr static std::size_t L = 64;
+
+                        constexpr static inline const field_value_type Ai = field_value_type(
+                            0x267f9b2ee592271a81639c4d96f787739673928c7d01b212c515ad7242eaa6b1_cppui255);
+                        constexpr static inline const field_value_type Bi = field_value_type(1265);
+                        constexpr static inline const field_value_type Z = field_value_type(
+                            0x40000000000000000000000000000000224698fc0994a8dd8c46eb20fffffff4_cppui255);
+                        constexpr static integral_type h_eff = 1;
+
+                        constexpr static std::size_t sqrt_ratio_c1 = 32;
+                        constexpr static integral_type sqrt_ratio_c3 =
+                            0x2000000000000000000000000000000011234c7e04ca546ec6237590_cppui255;
+                        constexpr static inline const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0x16915a9e3a85ecaa11685fd036be6bf8870326a1c5e594f7be27d905dd4b42e0_cppui255);
+                        constexpr static inline const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x2f5b4405e8f664f4cc83ce90eb785a677d2c72c8b07779a471604d7507c718f6_cppui255);
+                    };
+
+                    /**
+                     * BN254 suites use the Shallue-van de Woestijne map, since no isogeny of small degree to
+                     * a curve with AB != 0 is known. Z is the first candidate returned by the procedure of
+                     * https://datatracker.ietf.org/doc/html/rfc9380#appendix-H.1
+                     */
+                    template<>
+                    struct h2c_suite<typename alt_bn128<254>::g1_type<>> {
+                        typedef alt_bn128<254> curve_type;
+                        typedef typename alt_bn128<254>::g1_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // BN254G1_XMD:SHA-256_SVDW_RO_
+                        constexpr static std::array<std::uint8_t, 28> suite_id = {
+                            0x42, 0x4e, 0x32, 0x35, 0x34, 0x47, 0x31, 0x5f, 0x58, 0x4d, 0x44,
+                            0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x56,
+                            0x44, 0x57, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        constexpr static inline const field_value_type A = field_value_type(0);
+                        constexpr static inline const field_value_type B = field_value_type(3);
+                        constexpr static inline const field_value_type Z = field_value_type(1);
+                        constexpr static integral_type h_eff = 1;
+
+                        // SvdW constants, https://datatracker.ietf.org/doc/html/rfc9380#appendix-F.1
+                        // c1 = g(Z), c2 = -Z / 2, c3 = sqrt(-g(Z) * (3 * Z^2 + 4 * A)) with sgn0(c3) = 0,
+                        // c4 = -4 * g(Z) / (3 * Z^2 + 4 * A)
+                        constexpr static inline const field_value_type svdw_c1 = field_value_type(4);
+                        constexpr static inline const field_value_type svdw_c2 = field_value_type(
+                            0x183227397098d014dc2822db40c0ac2ecbc0b548b438e5469e10460b6c3e7ea3_cppui254);
+                        constexpr static inline const field_value_type svdw_c3 = field_value_type(
+                            0x16789af3a83522eb353c98fc6b36d713d5d8d1cc5dffffffa_cppui254);
+                        constexpr static inline const field_value_type svdw_c4 = field_value_type(
+                            0x10216f7ba065e00de81ac1e7808072c9dd2b2385cd7b438469602eb24829a9bd_cppui254);
+                    };
+
+                    template<>
+                    struct h2c_suite<typename alt_bn128<254>::g2_type<>> {
+                        typedef alt_bn128<254> curve_type;
+                        typedef typename alt_bn128<254>::g2_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // BN254G2_XMD:SHA-256_SVDW_RO_
+                        constexpr static std::array<std::uint8_t, 28> suite_id = {
+                            0x42, 0x4e, 0x32, 0x35, 0x34, 0x47, 0x32, 0x5f, 0x58, 0x4d, 0x44,
+                            0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x56,
+                            0x44, 0x57, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 2;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        // twist y^2 = x^3 + 3 / (9 + I)
+                        constexpr static inline field_value_type A = field_value_type(0, 0);
+                        constexpr static inline field_value_type B = field_value_type(
+                            0x2b149d40ceb8aaae81be18991be06ac3b5b4c5e559dbefa33267e6dc24a138e5_cppui254,
+                            0x9713b03af0fed4cd2cafadeed8fdf4a74fa084e52d1852e4a2bd0685c315d2_cppui254);
+                        constexpr static inline field_value_type Z = field_value_type(1, 0);
+
+                        constexpr static inline field_value_type svdw_c1 = field_value_type(
+                            0x2b149d40ceb8aaae81be18991be06ac3b5b4c5e559dbefa33267e6dc24a138e6_cppui254,
+                            0x9713b03af0fed4cd2cafadeed8fdf4a74fa084e52d1852e4a2bd0685c315d2_cppui254);
+                        constexpr static inline field_value_type svdw_c2 = field_value_type(
+                            0x183227397098d014dc2822db40c0ac2ecbc0b548b438e5469e10460b6c3e7ea3_cppui254, 0);
+                        constexpr static inline field_value_type svdw_c3 = field_value_type(
+                            0x29fd332ab7260112b801fa95b21af64e2e6da55f90a3e510fcbe57377b5ca1ec_cppui254,
+                            0x303d1eff1426764bf8408aee24ba0b865e76f77b1267a846b1e9154d01565034_cppui254);
+                        constexpr static inline field_value_type svdw_c4 = field_value_type(
+                            0x17365bbe63b1d2078632fe0eb2ac5a41b4e6a9c08b98676721010b008d4eaf99_cppui254,
+                            0xf57ffe5fc79e19cd689d7aa4209cad8fe164d7f4694786b388732a995d03755_cppui254);
+
+                        // BN parameter z = 0x44e992b44a6909f1, cofactor clearing is not a multiplication by
+                        // h_eff for this suite, see clear_cofactor_bn_g2
+                        constexpr static integral_type z = 0x44e992b44a6909f1_cppui63;
+                        constexpr static bool z_is_neg = false;
+
+                        // psi_c1 = (9 + I)^((p - 1) / 3)
+                        constexpr static inline field_value_type psi_c1 = field_value_type(
+                            0x2fb347984f7911f74c0bec3cf559b143b78cc310c2c3330c99e39557176f553d_cppui254,
+                            0x16c9e55061ebae204ba4cc8bd75a079432ae2a1d0b7c9dce1665d51c640fcba2_cppui253);
+                        // psi_c2 = (9 + I)^((p - 1) / 2)
+                        constexpr static inline field_value_type psi_c2 = field_value_type(
+                            0x63cf305489af5dcdc5ec698b6e2f9b9dbaae0eda9c95998dc54014671a0135a_cppui251,
+                            0x7c03cbcac41049a0704b5a7ec796f2b21807dc98fa25bd282d37f632623b0e3_cppui251);
+                        // psi2_c1 = (9 + I)^((p^2 - 1) / 3)
+                        constexpr static inline field_value_type psi2_c1 = field_value_type(
+                            0x30644e72e131a0295e6dd9e7e0acccb0c28f069fbb966e3de4bd44e5607cfd48_cppui254, 0);
+                    };
+
+                    /**
+                     * Elligator 2 constants shared by the curve25519 and edwards25519 suites.
+                     * https://datatracker.ietf.org/doc/html/rfc9380#appendix-G.2
+                     */
+                    struct h2c_suite_curve25519_ell2 {
+                        typedef hashes::sha2<512> hash_type;
+
+                        typedef typename curve25519::base_field_type field_type;
+                        typedef typename field_type::integral_type integral_type;
+                        typedef typename field_type::modular_type modular_type;
+                        typedef typename field_type::modular_backend modular_backend;
+                        typedef typename field_type::value_type field_value_type;
+
+                        constexpr static integral_type p = field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        // curve25519: v^2 = u^3 + J * u^2 + u, Z = 2
+                        constexpr static inline const field_value_type J = field_value_type(486662);
+                        constexpr static inline const field_value_type Z = field_value_type(2);
+                        constexpr static integral_type h_eff = 8;
+
+                        // c2 = 2^((p + 3) / 8), c3 = sqrt(-1) with sgn0(c3) = 0, c4 = (p - 5) / 8
+                        constexpr static inline const field_value_type ell2_c2 = field_value_type(
+                            0x2b8324804fc1df0b2b4d00993dfbd7a72f431806ad2fe478c4ee1b274a0ea0b1_cppui255);
+                        constexpr static inline const field_value_type ell2_c3 = field_value_type(
+                            0x2b8324804fc1df0b2b4d00993dfbd7a72f431806ad2fe478c4ee1b274a0ea0b0_cppui255);
+                        constexpr static integral_type ell2_c4 =
+                            0x0ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffd_cppui255;
+                        // sqrt(-486664) with sgn0 = 0, fixes the rational map between curve25519 and edwards25519
+                        constexpr static inline const field_value_type ell2_edwards_c1 = field_value_type(
+                            0x0f26edf460a006bbd27b08dc03fc4f7ec5a1d3d14b7d1a82cc6e04aaff457e06_cppui255);
+                    };
+
+                    template<>
+                    struct h2c_suite<typename curve25519::g1_type<coordinates::affine>> : h2c_suite_curve25519_ell2 {
+                        typedef curve25519 curve_type;
+                        typedef typename curve25519::g1_type<coordinates::affine> group_type;
+
+                        typedef typename group_type::value_type group_value_type;
+
+                        // curve25519_XMD:SHA-512_ELL2_RO_
+                        constexpr static std::array<std::uint8_t, 31> suite_id = {
+                            0x63, 0x75, 0x72, 0x76, 0x65, 0x32, 0x35, 0x35, 0x31, 0x39, 0x5f,
+                            0x58, 0x4d, 0x44, 0x3a, 0x53, 0x48, 0x41, 0x2d, 0x35, 0x31, 0x32,
+                            0x5f, 0x45, 0x4c, 0x4c, 0x32, 0x5f, 0x52, 0x4f, 0x5f};
+                    };
+
+                    template<>
+                    struct h2c_suite<typename ed25519::g1_type<>> : h2c_suite_curve25519_ell2 {
+                        typedef ed25519 curve_type;
+                        typedef typename ed25519::g1_type<> group_type;
+
+                        typedef typename group_type::value_type group_value_type;
+
+                        // edwards25519_XMD:SHA-512_ELL2_RO_
+                        constexpr static std::array<std::uint8_t, 33> suite_id = {
+                            0x65, 0x64, 0x77, 0x61, 0x72, 0x64, 0x73, 0x32, 0x35, 0x35, 0x31,
+                            0x39, 0x5f, 0x58, 0x4d, 0x44, 0x3a, 0x53, 0x48, 0x41, 0x2d, 0x35,
+                            0x31, 0x32, 0x5f, 0x45, 0x4c, 0x4c, 0x32, 0x5f, 0x52, 0x4f, 0x5f};
                     };
                 }    // namespace detail
             }        // namespace curves
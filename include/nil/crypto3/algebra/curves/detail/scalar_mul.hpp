@@ -28,17 +28,26 @@
 #define CRYPTO3_ALGEBRA_CURVES_SCALAR_MUL_HPP
 
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/coordinates.hpp>
 
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <type_traits>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace curves {
                 namespace detail {
+                    /** @brief Variable-base scalar multiplication.
+                     *  Uses wNAF with a table of odd multiples of base, the window is taken from
+                     *  wnaf_params of the group (or the default table when the group has none).
+                     *  x-only Montgomery XZ points have no general addition and use the Montgomery ladder.
+                     */
                     template<typename GroupValueType,
                              typename Backend,
                              multiprecision::expression_template_option ExpressionTemplates>
@@ -48,21 +57,18 @@ namespace nil {
                         if (scalar.is_zero()) {
                             return GroupValueType::zero();
                         }
-                        GroupValueType result;
-
-                        bool found_one = false;
-                        for (auto i = static_cast<std::int64_t>(multiprecision::msb(scalar)); i >= 0; --i) {
-                            if (found_one) {
-                                result = result.doubled();
-                            }
-
-                            if (multiprecision::bit_test(scalar, i)) {
-                                found_one = true;
-                                result = result + base;
-                            }
-                        }
 
-                        return result;
+                        if constexpr (std::is_same<typename GroupValueType::coordinates, coordinates::xz>::value) {
+                            return montgomery_ladder(base, scalar);
+                        } else {
+                            const std::size_t window_size =
+                                algebra::detail::wnaf_window_size<typename GroupValueType::group_type>(
+                                    multiprecision::msb(scalar) + 1);
+
+                            // window 1 is plain NAF, still cheaper than binary double-and-add
+                            return algebra::fixed_window_wnaf_exp(std::max<std::size_t>(window_size, 1), base,
+                                                                  scalar);
+                        }
                     }
 
                     template<typename GroupValueType,
@@ -71,7 +77,8 @@ namespace nil {
                     constexpr GroupValueType
                         operator*(const GroupValueType &left,
                                   const multiprecision::number<nil::crypto3::multiprecision::backends::modular_adaptor<Backend, SafeType>, ExpressionTemplates> &right) {
-                        return scalar_mul(left, right);
+                        // Leave Montgomery form once, the recoding then reads plain bits
+                        return scalar_mul(left, right.template convert_to<multiprecision::number<Backend>>());
                     }
 
                     template<typename GroupValueType,
@@ -78,4 +78,7 @@ namespace nil {
     }            // namespace crypto3
 }    // namespace nil
 
+// Specializes wnaf_params for the groups above, so it has to come after them
+#include <nil/crypto3/algebra/curves/params/wnaf/edwards.hpp>
+
 #endif    // CRYPTO3_ALGEBRA_CURVES_EDWARDS_HPP
@@ -74,4 +74,7 @@ namespace nil {
     }            // namespace crypto3
 }    // namespace nil
 
+// Specializes wnaf_params for the groups above, so it has to come after them
+#include <nil/crypto3/algebra/curves/params/wnaf/mnt6.hpp>
+
 #endif    // CRYPTO3_ALGEBRA_CURVES_MNT6_HPP
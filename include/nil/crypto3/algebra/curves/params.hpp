@@ -26,6 +26,9 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_PARAMS_HPP
 #define CRYPTO3_ALGEBRA_CURVES_PARAMS_HPP
 
+#include <array>
+#include <cstddef>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
@@ -34,8 +37,24 @@ namespace nil {
                 template<typename GroupType>
                 struct multiexp_params;
 
+                /**
+                 * wNAF window thresholds: window i + 1 is used for scalars of at least wnaf_window_table[i]
+                 * bits. Curves specialize it in curves/params/wnaf, which the curve headers include.
+                 */
+                template<typename GroupType>
+                struct wnaf_params {
+                    constexpr static const std::array<std::size_t, 4> wnaf_window_table = {11, 24, 60, 127};
+                };
+
                 template<typename GroupType>
-                struct wnaf_params;
+                constexpr std::array<std::size_t, 4> const wnaf_params<GroupType>::wnaf_window_table;
+
+                /**
+                 * Compiled-in multiples of the generator, specialized in curves/params/generator. Never picked
+                 * up implicitly, it is passed to mul_generator as a template argument.
+                 */
+                template<typename ParamsType>
+                struct generator_table_params;
 
             }    // namespace curves
         }        // namespace algebra
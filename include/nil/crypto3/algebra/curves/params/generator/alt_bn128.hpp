@@ -0,0 +1,1118 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_ALT_BN128_GENERATOR_TABLE_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_ALT_BN128_GENERATOR_TABLE_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/params.hpp>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+
+                template<typename ParamsType>
+                struct generator_table_params;
+
+                /************************* ALT_BN128-254 ***********************************/
+
+                /**
+                 * Affine multiples (j + 1) * 2^(window * i) * G of the generator for j < 2^(window - 1),
+                 * i < windows_count, as consecutive x, y pairs. Generated by
+                 * "python3 scripts/generator_tables.py include/nil/crypto3/algebra/curves/params/generator",
+                 * do not edit.
+                 */
+                template<>
+                struct generator_table_params<detail::alt_bn128_g1_params<254, forms::short_weierstrass>> {
+
+                    using field_type = typename detail::alt_bn128_g1_params<254, forms::short_weierstrass>::field_type;
+
+                    constexpr static const std::size_t window = 4;
+                    constexpr static const std::size_t windows_count = 65;
+
+                    constexpr static const std::array<typename field_type::value_type,
+                                                      2 * windows_count * (std::size_t(1) << (window - 1))>
+                        table = {
+                            typename field_type::value_type(0x0000000000000000000000000000000000000000000000000000000000000001_cppui254),
+                            typename field_type::value_type(0x0000000000000000000000000000000000000000000000000000000000000002_cppui254),
+                            typename field_type::value_type(0x030644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD3_cppui254),
+                            typename field_type::value_type(0x15ED738C0E0A7C92E7845F96B2AE9C0A68A6A449E3538FC7FF3EBF7A5A18A2C4_cppui254),
+                            typename field_type::value_type(0x0769BF9AC56BEA3FF40232BCB1B6BD159315D84715B8E679F2D355961915ABF0_cppui254),
+                            typename field_type::value_type(0x2AB799BEE0489429554FDB7C8D086475319E63B40B9C5B57CDF1FF3DD9FE2261_cppui254),
+                            typename field_type::value_type(0x06A7B64AF8F414BCBEEF455B1DA5208C9B592B83EE6599824CAA6D2EE9141A76_cppui254),
+                            typename field_type::value_type(0x08E74E438CEE31AC104CE59B94E45FE98A97D8F8A6E75664CE88EF5A41E72FBC_cppui254),
+                            typename field_type::value_type(0x17C139DF0EFEE0F766BC0204762B774362E4DED88953A39CE849A8A7FA163FA9_cppui254),
+                            typename field_type::value_type(0x01E0559BACB160664764A357AF8A9FE70BAA9258E0B959273FFC5718C6D4CC7C_cppui254),
+                            typename field_type::value_type(0x09F4CA411A3F52F4E0792FD9E792779856719215D3B32A762AFE3D5B8C684AF9_cppui254),
+                            typename field_type::value_type(0x0D8EF3D795ACD4B35D4366AB22E4AD335273AA59429E26929D0F64583474D9C8_cppui254),
+                            typename field_type::value_type(0x17072B2ED3BB8D759A5325F477629386CB6FC6ECB801BD76983A6B86ABFFE078_cppui254),
+                            typename field_type::value_type(0x168ADA6CD130DD52017BB54BFA19377AADFE3BF05D18F41B77809F7F60D4AF9E_cppui254),
+                            typename field_type::value_type(0x08B1D51D23480C10F472F5E93B9CFEA88238C121FE155AF7043937882C306A63_cppui254),
+                            typename field_type::value_type(0x299836713DAD3FA34E337AA412466015C366AF8EC50B9D7BD05AA74642822021_cppui254),
+                            typename field_type::value_type(0x17F485337F6E10FCA0E385F7A93D1AC0A977E43995C3E4D9B8F89DAA6A183F44_cppui254),
+                            typename field_type::value_type(0x05CCDC1561DB963516DA62C66EDD39D1BB9C6C4674990C4440403C88025C95AD_cppui254),
+                            typename field_type::value_type(0x0AC610B573E9FB98DEAF5AA48FEB447536418DDC4CEFD17C277C852A2A02A413_cppui254),
+                            typename field_type::value_type(0x1940E395F5EEAAF3B73A54A9DB9910C3B7F907CAD7F55137FB0C3847A682D315_cppui254),
+                            typename field_type::value_type(0x1774C9824D457FCDCDBBE9679BD152D351A7597B49C9F69BB2467A6328B7B406_cppui254),
+                            typename field_type::value_type(0x0AA49FB46445CF3AA565CEF7D4040B4C60D3E4F866E8C90A876F9D7F4D0ADFD9_cppui254),
+                            typename field_type::value_type(0x06B7C24035A06C42BCB47D54DF4104CD8880F68263AFCE13250ECC65F7669D1E_cppui254),
+                            typename field_type::value_type(0x2179E38C6E6341D1C80B4ED2AD6D43188C01C2F70A8093B37FC02F9FD9E5F12F_cppui254),
+                            typename field_type::value_type(0x0D47C71C5FB6E7B498A6E6E3CB971AA9C144DAF57D31979B7D372A15E1933F80_cppui254),
+                            typename field_type::value_type(0x08D2672127A9B79EA005703933D7BF7D4746CC1B30284F933844ACB708E89613_cppui254),
+                            typename field_type::value_type(0x2947E347A1B83971790018D5FA3A3C691F0DC720E0CD494A6C5F860A58CCF953_cppui254),
+                            typename field_type::value_type(0x1143F0155E0F21C29867070064AC3778983F0D47ABA2EE9EB64DC3F0E22A2B67_cppui254),
+                            typename field_type::value_type(0x059D1464318CB84E2F7C390BDEA32721006723BC4E7333D529E877B8AC1650B2_cppui254),
+                            typename field_type::value_type(0x1EABFDAEBCEC3DA68EF11AF7459E90F8A369DF383DE8B37169E2365BF884AC36_cppui254),
+                            typename field_type::value_type(0x2295215C9285BDC4F6BEEFDECCC5CCB67BBB9959F05F4C2A716A8F442FA69498_cppui254),
+                            typename field_type::value_type(0x10174283CBB851EAF5F64A278B0FE58FB9B3B0B6A31439012EBE8D731BCDF851_cppui254),
+                            typename field_type::value_type(0x2B9CD0BAE01DFEFDB859F3FBACBC897D6174D717103BF3B64DC43276541A2034_cppui254),
+                            typename field_type::value_type(0x13B64ED1D986A508CBE5B28CA1429210B9C1AFF6FB358AF406159FF2773181CE_cppui254),
+                            typename field_type::value_type(0x0B0543208DEA7CF4A213340EA328FE41297A9ADAE0D846BDBA6A63682164520E_cppui254),
+                            typename field_type::value_type(0x11FC9D481C85491A1C76370C03ABB451EDAAD8D165909FD8BCEF0B0523EA1598_cppui254),
+                            typename field_type::value_type(0x1643AAE0D6C69870CBE6136F6A62A1CA3410C18C4A5C58151B3F34C715BFB4DB_cppui254),
+                            typename field_type::value_type(0x2F124021E0F8CB7CCEAB32D5FF3F9D1D0BB66DD9EA90F03EAACDE0CDF27D9B71_cppui254),
+                            typename field_type::value_type(0x24236C8EAD13686698F502D88CED24D4A4F4D97D857F7A404DAB22A7D7010281_cppui254),
+                            typename field_type::value_type(0x14F25DA82ADF5997CD262A35F883666CD8FB73558E864094F04CAFD100D70121_cppui254),
+                            typename field_type::value_type(0x2EF018F9DD01BDE761D3FC22747F42086E97409D51AEF9525B56A10C9D3972F1_cppui254),
+                            typename field_type::value_type(0x1C8095DC9FB17CFED54982ED7A978AE38C9B4B99C704D029CF88B011288A980F_cppui254),
+                            typename field_type::value_type(0x0448459A8FB74CA900860E661EFAFEB33B02B843B32ECC9A37A7E57AF3231A60_cppui254),
+                            typename field_type::value_type(0x011FDC7F96F9AE0E94233A3FA9B9E26A8820490F966D46AE02C6971339A446E9_cppui254),
+                            typename field_type::value_type(0x0781572C9614E22B4C5FE96AA8299740A9E11006121F853B4F1B9A5AE6D63684_cppui254),
+                            typename field_type::value_type(0x303741171FDF614A311A7A2F4078016449BD1A0C64AFF72B60AA59A0DC5E4B6A_cppui254),
+                            typename field_type::value_type(0x042075949FD411801CDB82E636CBAEBA5913EE29901D9294E4EC8016FED7DE8D_cppui254),
+                            typename field_type::value_type(0x18CD5594FBF0DAEC1813CBBE6752EC1FC46F951B26C19031466364B772F37F47_cppui254),
+                            typename field_type::value_type(0x1E55DDFD2BC59EED77164FE02D0232B3D497792EC225376F3C3F5EC2F731FCF9_cppui254),
+                            typename field_type::value_type(0x24B3E64690C93B37546ABDC4EE90B916E2D3605EB218CF26EF5868D2B666072B_cppui254),
+                            typename field_type::value_type(0x133B598ECF07B15B4BADC0AF8B67D74F574A29C1EF79A426FE1271E235E61E00_cppui254),
+                            typename field_type::value_type(0x065BAB42B71A49A87EA2B1E39D69612DAF58372130AF040F503B71B689AC9B8D_cppui254),
+                            typename field_type::value_type(0x1476047A47C9D20E77D191B0174690F1F518A9556BADC1992E5AA800321CD9B4_cppui254),
+                            typename field_type::value_type(0x0CD3B460E85EC613AF6E12C215C22634BE82830C9ACBE9C2A43E87EF2465F8B9_cppui254),
+                            typename field_type::value_type(0x15DAB2550A7D9679F0A528CDE54154B2D9EBD399A16691E13F3F28B17F72F7D6_cppui254),
+                            typename field_type::value_type(0x178CE9329C1A5914A6561C281C981810A1554BE17533BF6E7CE5A03E18F67889_cppui254),
+                            typename field_type::value_type(0x09DCD574F86BD074DAE1EAF8B5D47E215B7F4CE60518D12AE87C3219557660FE_cppui254),
+                            typename field_type::value_type(0x0C8A7ACDDFA2465EC8F771A0749905D43CB2C4B4F09E2440297A242794C24081_cppui254),
+                            typename field_type::value_type(0x2643CD09108964BD2B1F844584E82024C4237AF7852DB4E83532E7BBDA056252_cppui254),
+                            typename field_type::value_type(0x269BAFC1A78298947413924B1CA04DFD6A80EB0A037B1CFD565FFD69CFB263DB_cppui254),
+                            typename field_type::value_type(0x1A7C4F5BA6728F7A97861787ECE77D0B264F3802BD551047E8FA5DDF03659F88_cppui254),
+                            typename field_type::value_type(0x2ADCB2654BFAC7A3E946C70948FD01204A90BA1685FDB1922E03792265DB0973_cppui254),
+                            typename field_type::value_type(0x145BC328B9B296659851F12D70E35A9CA48CBDE2AF8A8AD8C9F2B3E0DFF32306_cppui254),
+                            typename field_type::value_type(0x29556D2E78AC6045E5DD6D555EC184C802C9E0599A8D5173103841CAAF829633_cppui254),
+                            typename field_type::value_type(0x26E06BE6332F9F22B10167247F35F7805A11658A38DBB75D480AF28117A525C5_cppui254),
+                            typename field_type::value_type(0x05E492D706A927C51E6180228D8BE86D15017D61160867D231101E2790E2F451_cppui254),
+                            typename field_type::value_type(0x173562CCF10ECD0D4FA859860FDA7FBD91089FA60E69DC72FAFDD35516EA77AF_cppui254),
+                            typename field_type::value_type(0x2ECF52567DA025409374E147A7E63641B341B7B0E90104D86688D1C244890FCE_cppui254),
+                            typename field_type::value_type(0x16EC65556A336332E7D6CA1E62BD91DC8F61082CE853847071DFA77E52A8D948_cppui254),
+                            typename field_type::value_type(0x2104B0B106D8FBD745C65F0910DDD36165D31D5008CC0342691994937A9461B3_cppui254),
+                            typename field_type::value_type(0x1F2434B943605601A75D294ABA1BF13F0FF5DB8D7E0A3500B5F4C1BC41E786DC_cppui254),
+                            typename field_type::value_type(0x00262DB6CAEADC85809EEC6EAEC5A25CF46CC7C753A1E28313321FCDBAAB1C38_cppui254),
+                            typename field_type::value_type(0x0E6030B3D3717E09D4CE4793C974DAC15C365F275697466080574541E08B1ED3_cppui254),
+                            typename field_type::value_type(0x0DFAA08D8471F58D25E8D32588291F87DAE2E97351EF34728B4DC941ABB38252_cppui254),
+                            typename field_type::value_type(0x035BAA0F41119BE68885F987620F7D9F11A34A7E336E41AB6F1BB5282FAC21E1_cppui254),
+                            typename field_type::value_type(0x1DD60DDBDA3CA5A7CDB69AE5458033D69D00B7DA4D44ACEC978E46F70D06F7A6_cppui254),
+                            typename field_type::value_type(0x048BFF67DC7EF505F820E1B99C6B3AE10C93CAB73E179DFD8BAB89EB53D64C89_cppui254),
+                            typename field_type::value_type(0x19B6E0555E266650E74FD91A1312D2580E6100020D1449DF1554EC1DCE68BF0C_cppui254),
+                            typename field_type::value_type(0x03762E07278AE0306A4C00F906F8F2E4D59373BFE860160C0FD9C5E77C46BE52_cppui254),
+                            typename field_type::value_type(0x25537898872F823D23934C27F897AD4F40773D14B4FD32BC0CDE718AA9CB87B9_cppui254),
+                            typename field_type::value_type(0x2CBFB0FE6C22C116187EF88CAB54AE9612BCA6CC0738379098E3F0C4A4FFE44D_cppui254),
+                            typename field_type::value_type(0x18E367E3D08DB17CE4FA3E487E6268C2BA168DA6B239A84BF2EA8F2FF0F4C469_cppui254),
+                            typename field_type::value_type(0x055C8D5787694C618D99A4A31E6B68173176FD3EE152AA0BC009E99279A9B348_cppui254),
+                            typename field_type::value_type(0x0CB17A49107A9CFBE06478A33BA7E48E279BB9904EE0D6681CC72EDEA5B984E9_cppui254),
+                            typename field_type::value_type(0x17EA271295AC000CE0B87ABE0613221A7D547DDCF405705963CA857BD91F478F_cppui254),
+                            typename field_type::value_type(0x179206E24FA29E315C34DEBA1BB199CF4909DFADA681A994BE5D297FF2A2924E_cppui254),
+                            typename field_type::value_type(0x1F4465D62AAC0C486D54B87E00F9EA1454AEA3F1B0807C471FC172383B0886C8_cppui254),
+                            typename field_type::value_type(0x2FEE931883B4BF0D0D2E303BC10317533E6C974D3D884F9315F8D78840E1363C_cppui254),
+                            typename field_type::value_type(0x09F3DB3C4019792F1DEC78749B5D215C8E67F6E90D1DB9634D8A92A383848BAE_cppui254),
+                            typename field_type::value_type(0x19BABBBC018D25047A0AD1B2123153CD9523DD4074D7FCC9E6DEA756BCAC148A_cppui254),
+                            typename field_type::value_type(0x190A50BA2CB9B393BC465319EC95FAB03BF47C9D16E0CAF3516C4405B23C3A90_cppui254),
+                            typename field_type::value_type(0x12A9786427D489BB193E1012D2DCE5222ABAF18494E730D627B4EF12E8F0E757_cppui254),
+                            typename field_type::value_type(0x13BCD828F159B4789C315A1D23DAE14200B7A86F772BC40EE208897C70225B78_cppui254),
+                            typename field_type::value_type(0x1FB8390719106E54ED9B4BCD8EE718A30A8FFE5A151773AD87609F69F741FEB4_cppui254),
+                            typename field_type::value_type(0x127B3AB3EE067A5C41553648568B7882CE8CED215BFA190979668B3BC81EB1FC_cppui254),
+                            typename field_type::value_type(0x05E5A09C5AE9DE4C0492A8033CF035672A55797CADFC1E6860AAB21C32A78112_cppui254),
+                            typename field_type::value_type(0x035B261363AFC5E03923315A3DFDFBC2C932D94BC19320F3AB411A203DF4B44F_cppui254),
+                            typename field_type::value_type(0x057DF51FA44DEB6F13412A77FD4325ACEEC98DFE6036CF74C71A5675F7FE1342_cppui254),
+                            typename field_type::value_type(0x154ACEB2BAD07CDC9E1E0239E75F74D2B63A297881F9ADCB166EDB88FE076F4C_cppui254),
+                            typename field_type::value_type(0x2F7568BF2FA097D86B7858E8701480E26D6D42FC819858B2137A427EE5B9A1DA_cppui254),
+                            typename field_type::value_type(0x070BC3BDD7769991AA3C1C18B8452D06ED524C8E9F390CF5C18A698E4358EC60_cppui254),
+                            typename field_type::value_type(0x2DCB2DEBDD577D59578B59809AB58498B040B653E52033105DD7ECA1533F0F81_cppui254),
+                            typename field_type::value_type(0x09A6E5836835DD5677AA892580F15382DA285A1B1379A67FD54D21664FE5681D_cppui254),
+                            typename field_type::value_type(0x29F5850D45DFC5F3126FD0DA3EA2C23AE965655112B9C2771CF2E73A2861AC5D_cppui254),
+                            typename field_type::value_type(0x0DDB148E9A29C024A93A75E798D0C845A1F0EAFD2B79FE1899D6D50ACE74F96A_cppui254),
+                            typename field_type::value_type(0x2809617170B9507B2F394B6A5B353726A64F04AD0F69BD9A8AE84A3C0BCA0CC2_cppui254),
+                            typename field_type::value_type(0x2BFCDEB875808B60C9FC157C01CB039401A4C66A82AAD59026D3CEA3573E06DD_cppui254),
+                            typename field_type::value_type(0x1D9D9468A5DA700E29896EED242721FD123B75F7300980F6D2BF26FC36AE8010_cppui254),
+                            typename field_type::value_type(0x09E7A9F5037D28DB9898F88B535156CD8FF49890700695BB6C624127E385F2D7_cppui254),
+                            typename field_type::value_type(0x0D8DEC5599F6DEDB8F3939D74AAFCEE7B9D1185C7CC88ED4F32B011D1B1E03F3_cppui254),
+                            typename field_type::value_type(0x2566879CA48921F6FE14DF4D20D2F9E24024C9D438B131BC30B06EFC35DEE0F9_cppui254),
+                            typename field_type::value_type(0x2DDF0F6CD3E69D0A018BB01BF69EDE7299A90EB9E40EE68DC50FC1B57F42011F_cppui254),
+                            typename field_type::value_type(0x08C4DE3BB9284981741584663FF2B08AD9FEA7B6FD7F867F558D768CAB6683F0_cppui254),
+                            typename field_type::value_type(0x0F9C2BD3727428ED114CD7860E28DAF81CB9CB7DCDD26BB704DCC13B4314DD6A_cppui254),
+                            typename field_type::value_type(0x0A9CFE416626F75B3BE8249CBCB7F3732BC7601CF581F774EBEA4254DD06A31E_cppui254),
+                            typename field_type::value_type(0x2F37ADE304C81412D4AE613BF6D46DB48B794A815BFFC4413FC4872FD3E54E15_cppui254),
+                            typename field_type::value_type(0x2EDCD491A9BA6028C3D57E4F8FEE10C2DF2399ADADBDB7AE4EBE445BB0E4FF9E_cppui254),
+                            typename field_type::value_type(0x11C6DDD5A45E9AAE6F320985453763BB5F65F5C9BDD49021848582AD0D9C3718_cppui254),
+                            typename field_type::value_type(0x258872F55CB9B9D5085401F6DFD3AE97C4ADF21C3F5A391EE055FBBD9DC4754E_cppui254),
+                            typename field_type::value_type(0x0537CFE016384089D64F027080A6061DC147732E6CD9C5BC1818D20CCF9958CC_cppui254),
+                            typename field_type::value_type(0x280A3C77300D3626692A772543220D1F155B76F57530797EE6AEBA3090C3D55B_cppui254),
+                            typename field_type::value_type(0x29FE5A632B32C9BBEDD87B646B48C2D97DEE8FFD17931292772526C5FD0834C9_cppui254),
+                            typename field_type::value_type(0x1F50E45017757D62D20D4E63A47BF9AF06C53579EC3D7209336C7EBEF565A293_cppui254),
+                            typename field_type::value_type(0x2CBE2A62064D1ED164F4B19D046FD405B572A1169737EBAF73C2DD4810B6A97F_cppui254),
+                            typename field_type::value_type(0x0CF68A9AD922E39DD4A57B3C12EB929DE504593A237017F15544D19DA07AE372_cppui254),
+                            typename field_type::value_type(0x212F765C1E92C7B9023A68F784298290A2950C4994C582193EFF3F19226AAA09_cppui254),
+                            typename field_type::value_type(0x1E46FFD3559B30F6D101A2B49BE6D213A9C40979CE8CB6B3C30AC308259BB5F4_cppui254),
+                            typename field_type::value_type(0x08C2C33416234B10C20E4B8BF0A1C1AF83B964DF68EDA56ADF0DAE561518F704_cppui254),
+                            typename field_type::value_type(0x08D1B64842BC402BF13683A6C6F35B5C3D20BC295B2B29547889ABB503000938_cppui254),
+                            typename field_type::value_type(0x08DD9DA05595BB2F247F8254C0B5C522610EF4FF6DE3397D6A35C2CD57D5FF0A_cppui254),
+                            typename field_type::value_type(0x17CE741466BFE6B7DDD079FC1B829FC11C670AE647603CC16F07EC4EE9907076_cppui254),
+                            typename field_type::value_type(0x135C40E7AE971F4F02715E9EACFB0EDD48544329E207DCD9E09E3A1D6A7EF9D3_cppui254),
+                            typename field_type::value_type(0x2CADC6D549B83B6E5F0B5A049EBC81C77D63782B7AD1D8A807981390B46CC89F_cppui254),
+                            typename field_type::value_type(0x1BFBAFD0C178ABFA505619AEE97080DCE47F92B20E4769C51FE8B30305FE4929_cppui254),
+                            typename field_type::value_type(0x2560DE7EC1FCE358673F10C20B44AD547058E357B6ABCAD273E4DE32F8901926_cppui254),
+                            typename field_type::value_type(0x1CE0ED3C1313830BBF40FE0D7843C66DC5A67680004DF9BAC115C39AD61A6434_cppui254),
+                            typename field_type::value_type(0x2BBCD98A82B9137458FF260CEA3029508DEB00EFA0126DD72212A48B8E2F53D4_cppui254),
+                            typename field_type::value_type(0x2CA3367EF9197DB8AB4C43354B957552EEBC7B14FBBD69AC854AA043F9D60E49_cppui254),
+                            typename field_type::value_type(0x269A380B79577C7867D4ABAE6F98A6C2ACB14BC39DC2082C844F8AF839A47957_cppui254),
+                            typename field_type::value_type(0x0779070DD958CCF8B347D402EA9B83CF1D70F2CCC670A23C095E50B3F8B3397D_cppui254),
+                            typename field_type::value_type(0x03924B9A01D962CC50ECECDA6C6A18CF5AAEF87170C28DC11BFB5810B50CE5AD_cppui254),
+                            typename field_type::value_type(0x12761D176DA38E2CA3DDD1A797044B7616BAB3F5B7F6ED5662563342C55A0D8C_cppui254),
+                            typename field_type::value_type(0x1D0AB19190A9EEA7211606A352BC936D6605A190090AC0843A8BEEDB54BFCD60_cppui254),
+                            typename field_type::value_type(0x11013587E7511D4A0D9511B142867820CEA6CB9C3D7A8DB3AC3230521BFDBB98_cppui254),
+                            typename field_type::value_type(0x0CE765D04F6147D2EC7FD6B47A674FE19734BA8732F9F5B2201FCED57EAC06D1_cppui254),
+                            typename field_type::value_type(0x17E32BC3032CE94020638E7D2AB3CB5CCBE6F0B06FAF6821FA8E3E4401A5C5F3_cppui254),
+                            typename field_type::value_type(0x0F4DC779722C9006A9C18EDB82B48827E1620600EC0D8BF5EA38A9AFF00B2FAD_cppui254),
+                            typename field_type::value_type(0x085E58B989C3118DA095B0E96FE2B07080D4A7A2C1E68B00DE0A673D6BA338C1_cppui254),
+                            typename field_type::value_type(0x031D1BBA1A16D0C697D9A3F2BB6C657AB768037BA1C51786C2AF23C4C6E6D6C4_cppui254),
+                            typename field_type::value_type(0x281E5C31F01498643A190CC547D671988CA89D5AC18A3839B357946B1FCAF784_cppui254),
+                            typename field_type::value_type(0x2732BBE06B941C9E2D5B43837D8C5D9C23B7D9E8D5E623427FF3B61F2F5A5A07_cppui254),
+                            typename field_type::value_type(0x2B591B8A3C2BFE17BD639FC6A77244AA8629ABE4BEE101A444E4F24F36F1CEF4_cppui254),
+                            typename field_type::value_type(0x0C3443913C9353E1712052BBA63F8EAFBD3195C6F97B8F830DEDE5145C98B210_cppui254),
+                            typename field_type::value_type(0x1015A70A8548D0239AEB1E72B490DCA2C904E5BC9F70174F444AAADAD2611BEC_cppui254),
+                            typename field_type::value_type(0x0B952CF14328C43567B170176D408855980F92B141C262CA55FC8211408ED3BA_cppui254),
+                            typename field_type::value_type(0x22F611B7B94133B999BAFBE69731B2A6214D9555878819F6A3D993F48FD3041B_cppui254),
+                            typename field_type::value_type(0x296BF4B8870C93B583121A0A3D4B93BC89A99A5E8C0B317B4A8C97B605D46928_cppui254),
+                            typename field_type::value_type(0x1CC26E0E77CB4A4DC3D68DC58D45A417E88F0E91E67D9C674CAB1F19894B76E6_cppui254),
+                            typename field_type::value_type(0x27E2E192F061B31A05A77BF2EF3197550A6A3D87137F94166EAD6C6BC962DD79_cppui254),
+                            typename field_type::value_type(0x2D6ED80F66DCBA2FA0170B308717DD966F6F290ACBF61AFFD81681234C8C2C06_cppui254),
+                            typename field_type::value_type(0x2B74BC4A2F94E7EE3305368999840142E80348E9464CAEF350C14219ABE982BA_cppui254),
+                            typename field_type::value_type(0x28ECE478E5BEF9A805431237214101DD7E42D6619D13344FB5F38CFCA35BE682_cppui254),
+                            typename field_type::value_type(0x22C175E3C8487841F7E95A1448695383526F6B54FA1BD5DC08ABC316E31E3517_cppui254),
+                            typename field_type::value_type(0x149630C26A8011EFF9EF41663B42CB704DA419E23B884B7B24414A6561BFF9AB_cppui254),
+                            typename field_type::value_type(0x2BAA8244BE503149A4D115C9BAECE8340D5BC0EDFB37D9DD936C268AC4432371_cppui254),
+                            typename field_type::value_type(0x04A0C6667A0F48F7294520637EF33E1DB8F65182021036B0043EE7798483B352_cppui254),
+                            typename field_type::value_type(0x1B05155447AAA6FA1EA292A769950CFDBF195DABB8101A25902B5DA432322076_cppui254),
+                            typename field_type::value_type(0x10575AFE16844A09FE4B002623C91F29E52BDEBBE29E235F2090C39A930E8C2C_cppui254),
+                            typename field_type::value_type(0x09343BB3444154EEFDA9DCB880F82B5FBD6F871F09B473B031A171AEA6B3785A_cppui254),
+                            typename field_type::value_type(0x10D72102222CC571449C1F6A653679C3F405CF7EB06A7C5073CD4055BB703D74_cppui254),
+                            typename field_type::value_type(0x12207C7EA2F481A31A2E0A0D4612B8D209C0DC32B5D7BBF21164C30C45322F4E_cppui254),
+                            typename field_type::value_type(0x14E1864DF410947551E0F19E29990D06F6D1CC5500F515354F7B4E2F56CB75C1_cppui254),
+                            typename field_type::value_type(0x0CE51028D1A2F1052EAB22EAE5C53D66E39FE6D22D7184BA7207A75D7F6F8FD6_cppui254),
+                            typename field_type::value_type(0x08F1E0121E287EEF560FCFE0DDBB98672895B8440A138DDEF48830D5EC2E2BF6_cppui254),
+                            typename field_type::value_type(0x2A8577ED48DB5AC9E9FA8DFA247F27B3E60D89F1827647685799666C97F1A833_cppui254),
+                            typename field_type::value_type(0x0902486BD83FD098AA054FFC4CB97AB085CC2F16AC36046994CC30A023107B1D_cppui254),
+                            typename field_type::value_type(0x1D9A6BE49FB8D2AC15DC3D5C94E14A1503AB0B3CA6A21CAD875D6B1A79FAA9AE_cppui254),
+                            typename field_type::value_type(0x28026C4FE5E3BEECFEFCFC52D868EC17888E6B9E926ECFEBEA979F4DA743E98C_cppui254),
+                            typename field_type::value_type(0x0732FAB1B46A9D2F5D4E4C0AE76B33D747B97FD120D5A48B403368C0CA59E3E0_cppui254),
+                            typename field_type::value_type(0x010EE4D49117FC0C55FAEE5550615AB0E2020D1CFFE21A9138B45BE3861386F7_cppui254),
+                            typename field_type::value_type(0x02DBB3A3D9C926C2BFB474A4ABDCF379AD91F12BD9E661296ACD07DFD5868AF6_cppui254),
+                            typename field_type::value_type(0x0FACFA99854B783022B6D59E9FB43F6176FBCCB509F7C0A1E3673FF8AC8C47F8_cppui254),
+                            typename field_type::value_type(0x1781EE986BD68597BF4D4D208C4288599DE61E144C3BDC0400D099816411CD05_cppui254),
+                            typename field_type::value_type(0x2AB3082B4EE85457502BFD2C20B89DF4181ECD32ABA9F00D68A92D8F081C1846_cppui254),
+                            typename field_type::value_type(0x0971429BE6A1E1B152787CDEED265F3125DDA327CF59D380E1FBC87D2861618C_cppui254),
+                            typename field_type::value_type(0x0ABC9652F436876F50AA32EC9BF01AEA9A3B1DA8879C99932ABD6DE38D0ED96C_cppui254),
+                            typename field_type::value_type(0x1B63952DDD499AAA36FDA66E58D7127567D9221AEDEB68934D06F33A1F4465BC_cppui254),
+                            typename field_type::value_type(0x1A305DA003682A00FA8BAAD04D6B6723E1D6988B550F890C4234AD4CE54E3D6B_cppui254),
+                            typename field_type::value_type(0x29271FFFEFF824A19AE6B44BAE4BBC4CE59DE198F7B29D28591B620F88230CF3_cppui254),
+                            typename field_type::value_type(0x0FF5D9C5639159873CD8156DF89B011EFD62A5C7C57E0DBC0F2C7A3E22545B18_cppui254),
+                            typename field_type::value_type(0x2EF769820679D51C8AD33309549D630A069C2E0BEDD5F6408BC7932F8BD47FC8_cppui254),
+                            typename field_type::value_type(0x06ABD56E6A2300623D6945F2F2E965836E0EA9518549579AE5626FBEE7A98B01_cppui254),
+                            typename field_type::value_type(0x0C56565B409D0661559F47150ADB952432A186BA0C316D0360DB359B32B7B05A_cppui254),
+                            typename field_type::value_type(0x1D312504121F5A89E8ABC692156492AB42ADE35FBEEF59B84A720513F9407F51_cppui254),
+                            typename field_type::value_type(0x2BD2E4FCC5E329AC6859E2BED1443604639C50181B461499A1FF41D65948615E_cppui254),
+                            typename field_type::value_type(0x0C6B0AAF39AB436C4D8245CCE97C862198C92AF61BCFA8E260B78F8B3125609F_cppui254),
+                            typename field_type::value_type(0x0AA6436A9336490D1BBAFA8F9CF65833582469393938F361E9B1232119896B9E_cppui254),
+                            typename field_type::value_type(0x1B596FA23CD51F9ADFD8CA7588F89DAA47745F9364201CABF70AEFE807950E14_cppui254),
+                            typename field_type::value_type(0x111E14C693B4E2F022CD64A6FB0A9A2C30A43EB830AF2D536D47D65E31621B35_cppui254),
+                            typename field_type::value_type(0x2556301D79A6B88A9EE4E0C6C7CBF32C998DE755F5229CAE477B9AE2A688F6EA_cppui254),
+                            typename field_type::value_type(0x2B3B866DCF944434734786B6CEBD1475F28677F14608466F87B98CF8A92D9DA7_cppui254),
+                            typename field_type::value_type(0x155C773A1ACE86A6D08BF33B8456A962D0C62857C0E8C7443F005801302BF69D_cppui254),
+                            typename field_type::value_type(0x2EE45CA050372017EA3A5D3C8B5BAB2825E418DD8000F096CA73740EB9D03BA2_cppui254),
+                            typename field_type::value_type(0x0771EE34CFD499013C8A1E13CB1232291327EC4052A02F3FCF29B7D76B75752C_cppui254),
+                            typename field_type::value_type(0x1829889F5A912A3B3E067EC9760FCEA66F991CE48AE32B52307AA7F5667EDECA_cppui254),
+                            typename field_type::value_type(0x0D89B1AB0C9CB034FAB5A3D92672BC45DBDCF0F7C6A7FC8A11346C941FC10F76_cppui254),
+                            typename field_type::value_type(0x061D62988EBD3A3A643E088F5A5117B03E3342EB44AEADE5BE5E769C8EC5471C_cppui254),
+                            typename field_type::value_type(0x0FD8ED00F9E0D1A9B4CE715D06E3A592A38E60E80BC6102764A208F72BAB79CB_cppui254),
+                            typename field_type::value_type(0x2BCB97ABADF5CC9EBB2146867D6F7451DB29FBA33DFE8A34AB680DEAD115E00A_cppui254),
+                            typename field_type::value_type(0x08CF030BDC7A851154CDCD01609D064C93B03AD7808E8F306AB488261DB73320_cppui254),
+                            typename field_type::value_type(0x1D174577A9C53CEFD85D6BBBDCB5B8F292A884B26F0EA403DD10DB43ED6F9A8B_cppui254),
+                            typename field_type::value_type(0x07BB9915573EE3BF341981F4905A2D96167E228B90C8D9DD430530574CF75899_cppui254),
+                            typename field_type::value_type(0x2EA6C522326FD4BA9A4EEF08060DE74B69B45A16A01F4F1D501DAF74EDC19B95_cppui254),
+                            typename field_type::value_type(0x011E4E8B7B6D5AE9F9141A549950C27AFC038F72F7D48AE1692DDB97F626FF13_cppui254),
+                            typename field_type::value_type(0x0591F4466B7A4BA962D097BEAECDB6BD8D17CBEA3BD5FB9CC8E166322755869F_cppui254),
+                            typename field_type::value_type(0x1B1808E9FC843A9EFE02F7493CECB95C608C316D4ED98F194003CA292A8BBE89_cppui254),
+                            typename field_type::value_type(0x205359FF4A65FFF5247003F1BDFB14C3A2184A03E238FAD8624F9B965B0A5940_cppui254),
+                            typename field_type::value_type(0x168730EA739577A57F44987FE5F3298940D75DE023A444CAD6CB59980C2C0798_cppui254),
+                            typename field_type::value_type(0x15E6243505F14C8965306493AE3D94FF10CAB8343CD88CC74E7E665AE3E347F5_cppui254),
+                            typename field_type::value_type(0x0E5D01EBBDD6B7C0C72C29994C65A60844444C37EE546A0059BC520FF86AFDDE_cppui254),
+                            typename field_type::value_type(0x163ADE1532368C1C2F8FF2A6FC53E6A1C74A1DDCF660D034370076AB0EF1B60C_cppui254),
+                            typename field_type::value_type(0x1BA07E9D655A09E6842D2E87A3EA3E34D7B26FA80B350F02A1D0D9A21713D405_cppui254),
+                            typename field_type::value_type(0x033A47533BABBE960C581D996A10C697EFEECFCD62B36B6124F5D3C793348962_cppui254),
+                            typename field_type::value_type(0x2F7A4FF5AAA8A0E2CFCA3A1401601A52B80AA7CBA4991B380F429D26D940924A_cppui254),
+                            typename field_type::value_type(0x1425B11B4FE47A394DBFC0AD3E99DC93C3E1C0980B9BCB68529BA9DE33DBF585_cppui254),
+                            typename field_type::value_type(0x168B8CDFF7AE7D084FD111608FA03E018B415FD4F0755F7E8F039A2D852BDA0E_cppui254),
+                            typename field_type::value_type(0x01281E1B4AE3AA4404C0181F688FECB6C0C4449EE646C0438702EAB87F4B7DD1_cppui254),
+                            typename field_type::value_type(0x18D37F7E79D7DFDD82187CC71E706EBE6353499493E23FB8AE536E47DB8CE60A_cppui254),
+                            typename field_type::value_type(0x2EFE45A85A8FD32BC6145D92CB800FD85EFF6808DB7E5B25CA3B018403B4D7C2_cppui254),
+                            typename field_type::value_type(0x1C1A60253CE3B6078A23825A01B1158C13BD2DD64AFD826ACCDDCE57D004A3C5_cppui254),
+                            typename field_type::value_type(0x03FD1C6811ABA796990BEC7A6E1C93456BC73BD41B090D6BE589826E49B1AE21_cppui254),
+                            typename field_type::value_type(0x269F5D44435FD8DEA26779B7F46C23B4BED44FA1D9863C9880F010959BB4AA88_cppui254),
+                            typename field_type::value_type(0x0E01FDDCF7B352263F09FC01E20849707118B48AFABB9A0A6851BA9B299F36FF_cppui254),
+                            typename field_type::value_type(0x019C367FC186A365FDCA6DF0D2AFDE84B2F587E3DC7559ADA29F8690D4BA49B3_cppui254),
+                            typename field_type::value_type(0x28A0DDF14CC9B39C1E9CBEFC6AE9DFEABCD35F22BF9B19FF8EE04EF9F2B677B4_cppui254),
+                            typename field_type::value_type(0x0C9EB453ED821FE397EAA079286C10B55699C7DB82C63B0145E5958A299A1277_cppui254),
+                            typename field_type::value_type(0x03C47962C075EAD071D9736819402900811A1D8A5BB4AFC2B964C1A048987DAD_cppui254),
+                            typename field_type::value_type(0x1A59E19930333A6EE3F54B74E138B25F64C55C7A3FD5BE7DB7EA75E27FAE5649_cppui254),
+                            typename field_type::value_type(0x0EC6FC4A5B4E315512F882A012443A460F0AD440410931B3D2F16125B5E08B17_cppui254),
+                            typename field_type::value_type(0x13D2044189630ABD18C6A3D7DAD67C97B771597BE79693A5DE68DA0FFA2676D3_cppui254),
+                            typename field_type::value_type(0x1FD5DDC117799EAC4054D556EA4DD922AE145542D5524A29A0CAD3EC7EC810E8_cppui254),
+                            typename field_type::value_type(0x27BB413910EF0B9339D3262CDE13E189D0B2E64F0C073FC81DA5747676CA645E_cppui254),
+                            typename field_type::value_type(0x2D1B7DB11118809263C79240DF010A2415ABAFCA8D4248788158BFD6F2141969_cppui254),
+                            typename field_type::value_type(0x075158F7B9C5890A51D5B46A86E6E3F04F20DC8CAFCA5E5C3772EB508E2390F1_cppui254),
+                            typename field_type::value_type(0x0A147EC47C2218E10E0F47D14566B76DFED01F5498EF2A13D8428E502641368C_cppui254),
+                            typename field_type::value_type(0x152BB7636E9829820DBA43EA2DF3ADBCA5A6E5411FC3A97C5E753955BE496D1C_cppui254),
+                            typename field_type::value_type(0x02DD2737976A05341DEF306C8899CF11D24B52F3230F36B6CDBBA3FB971CFDE1_cppui254),
+                            typename field_type::value_type(0x1A15E9C72C124E695B6FE0C535BC1C0265EC884CF74B53DE358DE6D5C956ED73_cppui254),
+                            typename field_type::value_type(0x05B8015A154680D68AE6D7481CC3BD1F5790C888350B17F934BC957C6825FCD1_cppui254),
+                            typename field_type::value_type(0x2AF69EE9B7309C06F466F7076ECCA8159FAC50A82554B28AD0E6E818A444CF26_cppui254),
+                            typename field_type::value_type(0x121A9517BC65431E9486879068B6A625EC461FA8CF2B8900E6BA0ABA97827652_cppui254),
+                            typename field_type::value_type(0x0CB1AE9121E4B2212BF19E3F5A80D16CC4E620FB072A7F56C2D4493693C6E512_cppui254),
+                            typename field_type::value_type(0x1FC7582116024B5DB50A8BEC41C7ED2DEE99118415D635608CF0E0B0C6503C6C_cppui254),
+                            typename field_type::value_type(0x180BB05FEBC59F4C332FB637A4D46EA255BE0D79BEE1A947440A1813A852E841_cppui254),
+                            typename field_type::value_type(0x1DF18F1F725582B96A446CD7FB021D67A357626FBC37E35599ED2D117359D294_cppui254),
+                            typename field_type::value_type(0x2110263F391B92233267E75EC5641BE7385DA935A46F8CCCD0698A584C70848A_cppui254),
+                            typename field_type::value_type(0x0457CAFDA1576B6F5FEA6125056E6D52C4B01DE7B44AE5AAE162E83C9FE86928_cppui254),
+                            typename field_type::value_type(0x16471C8DAD2CB3EA4C4645D8B108ABFB95FDB1C87485A1D78A3D158E529AAABC_cppui254),
+                            typename field_type::value_type(0x0A431193EDB58ABF0DF45B4BBD6CFC43BF2E39093EC0FD195F3120344B3AC3A0_cppui254),
+                            typename field_type::value_type(0x0B1261FE08F29CC99A084CDA6E12F384E7A11F3FA0F75DFCD21005D951FDFC2B_cppui254),
+                            typename field_type::value_type(0x0FFC0F0A78A02838E917CF6CC41FD0DFD306ECFDB801A63ADD9EEAD77CF88521_cppui254),
+                            typename field_type::value_type(0x20BE379CA07058ACD0C39F7AF41871F92BFA319260D4440DCAE271F9CFFC137A_cppui254),
+                            typename field_type::value_type(0x1542E37F2C64D816C9DDE4CDFEFF540680CC90B767294BA9937A0DE230676B4B_cppui254),
+                            typename field_type::value_type(0x1717EFCB51F08CCCDBFE3E4A2DA92E000A45A3E3D9EB40F9B9A2041DCBF14D3A_cppui254),
+                            typename field_type::value_type(0x14FA08D6772233081DBBBDC9E0183FF516B377C061AA287626D762DB11D739F4_cppui254),
+                            typename field_type::value_type(0x248C760160D93383B4D5375EBCC7216DB0C48F87223E754DC8D904FEC4AC3C23_cppui254),
+                            typename field_type::value_type(0x076D859A52C2123FB2C3F4CAE158BDF51FE2DA5B741E3A4F518BD31389F9659B_cppui254),
+                            typename field_type::value_type(0x0BA46A3E6F89462CFECC5E7230E0D3B615D3E8D6232C535B022CE79E537E9527_cppui254),
+                            typename field_type::value_type(0x0BC0D10CD76E02A83A4AAB9E7DF35A3AB624283B3D1A3F4CA87F0C1D984D8680_cppui254),
+                            typename field_type::value_type(0x267FBFAC8E65714BA3E7493F07991F0AD478DBC9C600C10406979B817B1DA604_cppui254),
+                            typename field_type::value_type(0x0F39F1EE90EB802366254BF2555173A1BD988E09F8C5AD7BEBFDB8D14D88B064_cppui254),
+                            typename field_type::value_type(0x2CBBD9234AB4F9FD74DEFB1512B86385B038EA5AE995449B813235E047876986_cppui254),
+                            typename field_type::value_type(0x250A8A1B9EDCECC5F25879262EF2962FDF8499F60E8131C6C33320FD8C98ED15_cppui254),
+                            typename field_type::value_type(0x1924E2B0B5E2C49449C5EF9B62C2D01207E012A0BC70B219AB44F026CE7E43B8_cppui254),
+                            typename field_type::value_type(0x239AEE62596123C53859DC2937EA9257E52034311BB81519B7F45330C5C883DA_cppui254),
+                            typename field_type::value_type(0x151F09F672DB228C74304A2F68F65A7B586F93913B97B6D7DFD638B99571B7F3_cppui254),
+                            typename field_type::value_type(0x2EE5DCEFE632FD834F536835A933804BBD14EEA9F33145A61D3E3181E1DAA73D_cppui254),
+                            typename field_type::value_type(0x235F69A722901DE3B69A3A77610F82439FC18A26AD689CB71DB38318ED8CCFA2_cppui254),
+                            typename field_type::value_type(0x1EC491FBE90A222ADEC9C417CD9C39393BF0E9FD4618F8688F20B587E10A92EC_cppui254),
+                            typename field_type::value_type(0x2AD8DE9952064D982BE63F71A172DFDDC4DAF430BB5C7A0C0D3A53FF776B8474_cppui254),
+                            typename field_type::value_type(0x06B75908BC6A2094E011F998F147E9F556C746BE7569B01A85FCFDBB89FA6FFA_cppui254),
+                            typename field_type::value_type(0x26F049EF34F48732C0657950A941FC8095C68704F85FD4F1FA1D4C93B3B42DFF_cppui254),
+                            typename field_type::value_type(0x046F55BFA7CA1B4723C0C0D1E7CCB17925EAB0CE4491D73281545BE737CDE7BD_cppui254),
+                            typename field_type::value_type(0x257A2FF20BCDF78D0C28B81B07C8C4C153835D6EA81B4CF42FD83E81D2D94418_cppui254),
+                            typename field_type::value_type(0x2BBDB7A9D036C6201D4C7B54DE84C8A797F08BD48A9512F8F25479F1E3140B3D_cppui254),
+                            typename field_type::value_type(0x0DB32A7ECAC1DFCDB1BA27687BD4284B8B2425C17E9421CAC571F002C0A51CC8_cppui254),
+                            typename field_type::value_type(0x2E5001CEE2FAA644502BBBA6BF6B07E3B7CEF0392326B48F300FC56F6982026E_cppui254),
+                            typename field_type::value_type(0x180E823C991AF5044DDE58A9E671FA092D3BA5DB98CC7E0376DD079323F80764_cppui254),
+                            typename field_type::value_type(0x2715E750E68B52FAA68B293DA254E1B0049B5825804F4C2700ADF08A0214E529_cppui254),
+                            typename field_type::value_type(0x03921D1862445F32FB5AFE510E7C4E23F41E4BAD15C090B1DE77447950003FC9_cppui254),
+                            typename field_type::value_type(0x0B4AE2BE8E83C897E6D3AA46F67058F07E0D29EDBE4EB1B6C1E325C737AF51F7_cppui254),
+                            typename field_type::value_type(0x0CEA4F5B9BC8E843C26CD4E67DA727FE9CD09CA8E07B60410602C63C3B0BAEE6_cppui254),
+                            typename field_type::value_type(0x194123B364689C7BEF26835D80614B62C7370900C80E4C04862411D43F1D36F3_cppui254),
+                            typename field_type::value_type(0x12BCA70DE0C7283C187FB6AB35590539885BF79DD4939DF3888466143B22BB8E_cppui254),
+                            typename field_type::value_type(0x252B5BF255B06EADE647646139359221099916D1BE9AA6A7EDC3F7C9C6B3BAA3_cppui254),
+                            typename field_type::value_type(0x12F7F9B3871CD66F99E976138EEDC4FAAEC30A67CE3C67D867999CE814F7644D_cppui254),
+                            typename field_type::value_type(0x1C83FF8749AF807A0DA9F4DD5A8B2CB27D8DC7782260F826B237D54D0D626455_cppui254),
+                            typename field_type::value_type(0x0700E4C5C6D12946BA78A2517A3140FB1A95F7831F7057A4EC4429ACA58D1A25_cppui254),
+                            typename field_type::value_type(0x1DDA90F1981EF2F238DF568360120C31C583AA59E2EE4951171BDAEB0A2BF39A_cppui254),
+                            typename field_type::value_type(0x03F6DA3C38816202587DB03C55C3870011368BEAE631D43395B50C2B02E2DFC9_cppui254),
+                            typename field_type::value_type(0x0F70137A0D60DE061C985F599D187FDB9CEF6F15E2C62429330BEDEEFC797238_cppui254),
+                            typename field_type::value_type(0x1447D4508A30C2044A402594AE3B640CC3475AAAB880050F16F11155CC501AE1_cppui254),
+                            typename field_type::value_type(0x1977739937A75442BA424943233BB2BA55F9D4C62148285873A658581D5114FF_cppui254),
+                            typename field_type::value_type(0x178EE53B5E50CC2078544A9CBD11841C47854FE604388A5DEFEAC56CE805BFE6_cppui254),
+                            typename field_type::value_type(0x0E6581BF922D94D7079FA4B753F3ECEDC525F516643A6BC894C5AB191FBF676B_cppui254),
+                            typename field_type::value_type(0x160642BDF146CC3F6630CFA5C115629055AB653C0E7F2414391F22B25D6720F6_cppui254),
+                            typename field_type::value_type(0x0D4DA3F9398685005D391D7C328EC8DC2ECAB18C7D451901725375B1C373D860_cppui254),
+                            typename field_type::value_type(0x1609E3EC29EFD4ABF1629BE26B772EF4B8490BCEDFAE621851E413E84C513135_cppui254),
+                            typename field_type::value_type(0x18B3F80481C8B758D287167EFFC43775781679E61331F62719D8E68F4C11F0A9_cppui254),
+                            typename field_type::value_type(0x154BA141E302DA384FBB2660A2A46DDE95DA386D2CBDFBF421F587D8784509B5_cppui254),
+                            typename field_type::value_type(0x03A781E0964591A816D07C8D6AA23D23B2AD50AE3ACC529F877ABF4D13E3F35E_cppui254),
+                            typename field_type::value_type(0x20A1F12EA58910335687316CF47761991BAD8F11E109095279C05E14B370C876_cppui254),
+                            typename field_type::value_type(0x09BDB483274654CC548FD87F0091E6B3FD418D7066C39CEDF10418FED42776C8_cppui254),
+                            typename field_type::value_type(0x1DD59789CD79DC5F266FA4FE2470F20E2CA27D802A41DA5ACA700EB8EA03D85F_cppui254),
+                            typename field_type::value_type(0x17D27B2EB06F178CD4115D183DDEDF1FA016608DD5DA12B6B4A47C8B54DBE191_cppui254),
+                            typename field_type::value_type(0x07E28540AE03B77E0AC98F7AD3E1DBC6F3B2AC67A1188DB1B9D1AD3A3FD295C5_cppui254),
+                            typename field_type::value_type(0x2117479E94D410DFB32ED01CCD1EAAC67DAFBFDEB3AF2BB3C229FC28BF6C9B30_cppui254),
+                            typename field_type::value_type(0x2716C315434C76AA5C17C88875630F9BE869509CF0F94C09BA18104A5C18EBD2_cppui254),
+                            typename field_type::value_type(0x02DB5BDA50B8B265684BB6E9C7AF58513E9AA23ABD3FA2A3CFC88DD057F90BEF_cppui254),
+                            typename field_type::value_type(0x103C36BD9EB69B53205B7FAE6224BB36B5A50451261CF87128953B489594B6D8_cppui254),
+                            typename field_type::value_type(0x0513DFDF79CA36C0D5E56DE067033A42D9E13CE86F261D9081A2DDDBDB88127C_cppui254),
+                            typename field_type::value_type(0x02902F0BA36CAC9E8A907AE91F2486316258B0B9B3B2C5262AB965004167BFA0_cppui254),
+                            typename field_type::value_type(0x00BD86FA4E2F2DA10F54C62D2F996D7813D6548785F88386B0286BA719DC973A_cppui254),
+                            typename field_type::value_type(0x2495AED3FF4E37C6D20A260F9847FE15D2BB5C2B788454BBB6E450EFFAFA8BEA_cppui254),
+                            typename field_type::value_type(0x2750F7758C34C6F38EBE5EE9C20320D458E734F1C0FB3D1507DC3E88FE28D95C_cppui254),
+                            typename field_type::value_type(0x11B653BBF1F258A071C1F9A4651CDD4456BC65B1FF119E996EC91956A69BED50_cppui254),
+                            typename field_type::value_type(0x18F64E4337EF0A3732BE36CA6CF72393B821FE4914EC78B311CA3A343CE7B15C_cppui254),
+                            typename field_type::value_type(0x0021C0913EDE0F09B5920B629B891A95A30AED5DD6001EDA274649363D1877DA_cppui254),
+                            typename field_type::value_type(0x00BD7259B570E622AB126BCBE4C295620E010C0DBFC84BC7DCB57F6C0A9ADDA7_cppui254),
+                            typename field_type::value_type(0x12C7254A24F719A7C697A8079FDB0C799643299A70DC6B593D754950303B68B6_cppui254),
+                            typename field_type::value_type(0x0F30135EC5DC260BA2208762733F4E05C25FBB7D1B594B7EE4AE5C0CCF21C65A_cppui254),
+                            typename field_type::value_type(0x1788DDAD2D4D0E10F02A1048C2CC6FF7F0A53C489D1D24467EEA04BFF5C49650_cppui254),
+                            typename field_type::value_type(0x184D65E6A1522A09E2463BB146CEAD0BCB77DBCE2AF582C88646769CA581499B_cppui254),
+                            typename field_type::value_type(0x0322B2CB8A8155E922CB1FD00ADE09BC0D2A07F91A63340220F15989D5EB6E7D_cppui254),
+                            typename field_type::value_type(0x046CC874785E387F35FBC3278C63A7D66E89F4642AB9056EC3D0B8D26EB21EC4_cppui254),
+                            typename field_type::value_type(0x1B759AD99B33626516327FBEBF9C232E0FCA6555B084EE311F62366D7D5F86B7_cppui254),
+                            typename field_type::value_type(0x064FCC679F04E762D783F5B39E9BC9832D06A6809D8C101A216431F1DC792CFD_cppui254),
+                            typename field_type::value_type(0x216690982D703EB77E4EA5A7DD74C7C00FB98033D17EC825CA4950F6C40AEB80_cppui254),
+                            typename field_type::value_type(0x148B2E63D2D3D87F364F35C47D7CF6C006506CF224AAC6F208C559A2ED58D834_cppui254),
+                            typename field_type::value_type(0x2727C32AF57DEBC90F6FC9EB1607F72E8180068D6D12C02C38498DDF0A998506_cppui254),
+                            typename field_type::value_type(0x0B74A6A81C7324B8EF9646A9140C43872A831AE43845C2A8898615E56562FF3D_cppui254),
+                            typename field_type::value_type(0x04D74F918B5D30A25E0C1D63B1F2438092C601E20FDB958492F65AEECF200AFD_cppui254),
+                            typename field_type::value_type(0x213B9A87905003543236FF3EB6B232083378CD7A9EED91EB78F2C60FA85A3AD2_cppui254),
+                            typename field_type::value_type(0x28E04E92B62096E8D23915D545982855C21BE5B3A1193E6E34C43DB01192453B_cppui254),
+                            typename field_type::value_type(0x19FA369A498AED7AA60B2FFAEBFDED42DE368DFD0A104280CB7781565D51EDDC_cppui254),
+                            typename field_type::value_type(0x18B39C653A64512B7E03FA0EF40AF8C25909BAC23D16D8CA5B6E844187BE5F99_cppui254),
+                            typename field_type::value_type(0x178D209B78542BE5C14C0865E2859027E04E71B7AEECBE984F8952137EE297F7_cppui254),
+                            typename field_type::value_type(0x09897F71799BC8A4D11A29AA911D5D2FC36BC50B04489B9AC659BDBE85FDE9A8_cppui254),
+                            typename field_type::value_type(0x15A639910E2DF500F0299CB6E2EFEBF8775C225067A69B38095A8DB37B968B90_cppui254),
+                            typename field_type::value_type(0x224410F4EBA22128492DAD3042192C879FB8727462B2A999A0A79234720B315B_cppui254),
+                            typename field_type::value_type(0x2A4825BEA894AE814C1678BBFF2FE7C99CD63A77A0C703B2825A5F19B2D98FAD_cppui254),
+                            typename field_type::value_type(0x2A127B6261BC7A4F6E76E082D980D0AF0BD0F5E0FD9CDB342BF9BBB7694A929D_cppui254),
+                            typename field_type::value_type(0x2257C2E4B41831DD8D36AACA1AB106C26C796F1C8E0A2998431F9D4125D740EB_cppui254),
+                            typename field_type::value_type(0x07B7ED1EDBB583F469367AE24BF8E49C1FF6731DFFF4ABF92E163E595187203C_cppui254),
+                            typename field_type::value_type(0x0A8D78AB8A1FB7388787EECA33F3FE251AE93F28AC1FEF89DAE84057B55436FF_cppui254),
+                            typename field_type::value_type(0x1AEF7BD255BAB9AE1A74C2B7CB61CB0C22F8C6C0A7DA5D9D4753779F9FC3D456_cppui254),
+                            typename field_type::value_type(0x144DB17100D9295C1A3A14874939036BBC240E2C931F17A948F68DA1C92D1CD6_cppui254),
+                            typename field_type::value_type(0x0B27B92B9AC9A94D875DCAD76CA1A571CCAE9AD2A447E6D2453128F89748830F_cppui254),
+                            typename field_type::value_type(0x1BCA13199961EC30B02A2E464AFEF42AB60EF11B26573E11E22A1028AFACD288_cppui254),
+                            typename field_type::value_type(0x0AD9FF00A04B9CBEBCD54D75A6DB4C6042799D29BF0E0D0FAE7438C89233850C_cppui254),
+                            typename field_type::value_type(0x27D08D91D1B675FAC52670898520A6CCC8DE11D610984FE4D8C16DD191776920_cppui254),
+                            typename field_type::value_type(0x1A7ED7BE913B2E0628116317954051CF4CC21E0A237AB8D4C212FA7EEC052CEE_cppui254),
+                            typename field_type::value_type(0x0C3ADC1764069CC5BCE2A42363D30328D93AE0C943DEE73DCEC03EDAFE0D43EA_cppui254),
+                            typename field_type::value_type(0x27B9D0A06BE43AEB1EF288E47C7B3CAD189BB0FE4BD6B6214B4C88B3395B608F_cppui254),
+                            typename field_type::value_type(0x10BCA14C7DD4F00988FADF5C949E4F223E49967323C6F65F889E180E3ED7FEB2_cppui254),
+                            typename field_type::value_type(0x08591107EDF415912CE9B694F2FA8769D87E9A19DC414A3E165F65F78C5A51CA_cppui254),
+                            typename field_type::value_type(0x06236320CF783A01E2B8BE7816A84671DE9E8BEBDA0E8F957809EE1253565BAE_cppui254),
+                            typename field_type::value_type(0x0A4CE1AC405B9974E4EAF9342C2A43BD1FDC4EDC2BD18235249BF51EC4328744_cppui254),
+                            typename field_type::value_type(0x107A0928F1BBD09F3710BA91EA9D69152E2A2DE8EB21984EC9CADDB69AB37A8A_cppui254),
+                            typename field_type::value_type(0x28C0D2C1D2B4DD590537FA55A7838A2BBD7AA7F2C0E91B36927B731752C34192_cppui254),
+                            typename field_type::value_type(0x04C02961CF949CD155F736FDC4C29E4FE409C37994AEF1B16CD170CC65B1B2EE_cppui254),
+                            typename field_type::value_type(0x0A92DA6A165896CDB685AFB42E80BEC10097BC2083BC938550706FC5BC355795_cppui254),
+                            typename field_type::value_type(0x10592B179E15F95955CED76E6690A4FCBDA8A9B83273BB366FFDAED506A71615_cppui254),
+                            typename field_type::value_type(0x291FABBAF15C9DCE4D474C59F3D47E2BBD8D868015CFA483DAADBC1E0C8C6297_cppui254),
+                            typename field_type::value_type(0x165AABCF0D07544D16F06389EF1D3BD5AE9C4BDBB0F53065B64BC53346C75897_cppui254),
+                            typename field_type::value_type(0x09DBC96D154F3FB8324230033265A8D5A31C9B88B5104CA5F56C714AC2E6A534_cppui254),
+                            typename field_type::value_type(0x1551983727963C391FAFB262DF980CBB5F58FB026A7B75A91C7E12191D4222D2_cppui254),
+                            typename field_type::value_type(0x09BFBC94650FD899CA5291EE7BE346AAEC8477A82F3F0606496234319E06F594_cppui254),
+                            typename field_type::value_type(0x0ED4FF64868F998A5D6482F9CC22FAA6A98A0B37C30248E445CA94FD9445EC73_cppui254),
+                            typename field_type::value_type(0x0CB15D59E697CB2C1C8BA0635671D27BF15E8E17918039FCE88F0AA7645AC67F_cppui254),
+                            typename field_type::value_type(0x0F3655A12A92E716CF64437A8599BE23090C98C09D72DA8233DF9D701A21DF06_cppui254),
+                            typename field_type::value_type(0x17B849A95233048AE7D5F6F4C9C07E27F406FD34E147596BF5093112D7AFF25F_cppui254),
+                            typename field_type::value_type(0x1BAFC8265A8FB16E346E57060848C3AE00B0E2D8520FF8D287CD002705C4C1AB_cppui254),
+                            typename field_type::value_type(0x03A87183D670BF95439912A7FCE6570C957A4D5ECAA722ED50E7D7C55DC55D0A_cppui254),
+                            typename field_type::value_type(0x1B5B281FACFE95FB1144E0F7D0484D119EBE0DCA0355E63EC70E5F94CD64E3E9_cppui254),
+                            typename field_type::value_type(0x10E9C2DFD3E452F067FC71C60A08200402F8F4E5E8DAD63E462BA1597A20C615_cppui254),
+                            typename field_type::value_type(0x18DD61A6D1A9C55B35D048FFB667E7F05EE657481BDB86800E89AA48DF541143_cppui254),
+                            typename field_type::value_type(0x147653157294E50892424EDB123CA14F08AE7DA80350B6FFDF582AA7A939E371_cppui254),
+                            typename field_type::value_type(0x260D5F5BDBE7B4FA4B9300491556581FF455F94A0FB27F3B1D1C4D61D94596C8_cppui254),
+                            typename field_type::value_type(0x006A91E11702AF013B4E56D120E6691D8518A6BAACD04189BA0D9D314B21EB86_cppui254),
+                            typename field_type::value_type(0x24FE3FB77D48EA49E4C1B91C61B634DBD9525B20167226B19D7C603AC36C3D4C_cppui254),
+                            typename field_type::value_type(0x2A4768C15D9B9C746E253EB271B28AFAB89DA5412565D93C6220A5B14CFBA611_cppui254),
+                            typename field_type::value_type(0x2B4070D9217CCCFF79EB2A6E3B00138E43E67D07E3423100B0E9D49ACFA2C8F7_cppui254),
+                            typename field_type::value_type(0x2A4DE746EC74276E353826D757B852764BBBAB53513BB5D4BFEFFBAA7ED76100_cppui254),
+                            typename field_type::value_type(0x16072EBBCD9FAF8DE4DE31AE72E118C816205400FDBC15B2CAD6A331A17247FC_cppui254),
+                            typename field_type::value_type(0x0905178023E39B258C67C7D4E27CE7D112C5CD3CA6914A348CAF7C0CF6612194_cppui254),
+                            typename field_type::value_type(0x19740A242DAACC11732C287DE5B7E98C605D749CC3D6B79C752AE04E5DDC76D8_cppui254),
+                            typename field_type::value_type(0x087FDC02EA90CF255F21A6824766022E55D27AC79C89AB8492A55056DBE059C7_cppui254),
+                            typename field_type::value_type(0x119BA66C94AEB05B2309953C35DF696CE195BF7D959770BB9B99AB944DB0AF91_cppui254),
+                            typename field_type::value_type(0x29C96C201B71F6540F084E2FB6D4EB8A52B940C0C5585F258ABA521311B805D1_cppui254),
+                            typename field_type::value_type(0x15856673FF5B68543C671CBE735D53376DCFEA3EEF0EC5FB3A1AE3C37F5683BC_cppui254),
+                            typename field_type::value_type(0x012224ED590244E93F1C6B7ABFF01B64DAC0BB8BF14AE8E3D825322B6623D082_cppui254),
+                            typename field_type::value_type(0x253EA43BA2E8C14DA0DF002C96422FB3234310A5774D8EC6CC9C1796DF1789FF_cppui254),
+                            typename field_type::value_type(0x234267257E751A5FCEBB1E295B774700FCC16B5F270AC8720F4376DBC18281B3_cppui254),
+                            typename field_type::value_type(0x2F55D2ADB7712C490BF8D2418D83840D6FFCBE7442F4B903BFADE9D3B3CCE4A8_cppui254),
+                            typename field_type::value_type(0x103661851707D5C92415B88BD8C49518317B51F89BA2CE00E49D6959DD215671_cppui254),
+                            typename field_type::value_type(0x2825AFE1D583957680DB4456ECE011C28A7A5E2021A69A1BDB69707D944268E4_cppui254),
+                            typename field_type::value_type(0x2870101FE628A0D69A362A7F52D4F57093ACEFFA7AEA51A4544C3033109A05F9_cppui254),
+                            typename field_type::value_type(0x0DE00358E185AD0064B5071FE30543CA1A0FE6D00116BA7036ED1927AADD8A06_cppui254),
+                            typename field_type::value_type(0x1E89392B72431FD535B618AA044505BE0970A6B6F8078E2E159A75D8D0E5B1F1_cppui254),
+                            typename field_type::value_type(0x1238FAFE71A7C65DE0914F5FC643788800AC9F5402231C7A4A1347EF1810AB0A_cppui254),
+                            typename field_type::value_type(0x14FAB2D6AE5AB1250239E2B21AAF2E2D3B1B4D1BCBE8EF201EEEC59F659491B6_cppui254),
+                            typename field_type::value_type(0x05BB72E68B5259C0C9004DD4E3B9082829A26D14AD984B2EFB9BE3CFC0504E48_cppui254),
+                            typename field_type::value_type(0x11C1A7BFB1844EFC386BD486FDFEB7907D6903D4F4913F7C83C1609A826A6C8D_cppui254),
+                            typename field_type::value_type(0x0F29F472F3B04C24A5ED6675F5FF33720A10826FE53CEF56B2C9313B2BD31523_cppui254),
+                            typename field_type::value_type(0x2483C78FB7A925E79BF63BB20E9198E12B41429B23FE8E2CE29F91F1112159BE_cppui254),
+                            typename field_type::value_type(0x28B2E5FDC60E4FA83C1FB52DB348434F08B850CC205F98431DEEA3E8FE209AD8_cppui254),
+                            typename field_type::value_type(0x0FE1AE72D3F07FEF610C96A45CADF362C41F3F902B7B81A735B2A98333F54F47_cppui254),
+                            typename field_type::value_type(0x2267C8D0582C04E9568E83BB9155FD9FAC11D9C0672455F63FC14112297855DA_cppui254),
+                            typename field_type::value_type(0x1A13B6E83105BEB7164721A03AA0635D2214C68C0CE68C5737FF618F02F62BCC_cppui254),
+                            typename field_type::value_type(0x247CC468097C742353DDF2ABF5AB6129D6966BC4A99039ECECE47B047DF4DB2B_cppui254),
+                            typename field_type::value_type(0x2C480804E5FE7814807E4A1BECE1A6B87581EB971A4AE59658FDC49F5B6051FA_cppui254),
+                            typename field_type::value_type(0x2A3E86AF529FB07CADAC27F9EB5683ABBDACAC22E8E55A4B96C61249CB3CE975_cppui254),
+                            typename field_type::value_type(0x1EEA66C26412CD33E47D7745AA76F7251EFDD09BF220E09889675D9896BD1772_cppui254),
+                            typename field_type::value_type(0x197FD1797A399251A2E8DDB8A12695D2D260A20302623CB6E6BFE8CA1CCAF45D_cppui254),
+                            typename field_type::value_type(0x289746C5C937B606F302B498C6CE25360D1868443AB6EFE72F9D41A39DD6331E_cppui254),
+                            typename field_type::value_type(0x03551D995B89232A20F081CCD659C12405B83F9C5B6BD1BF2329D76A5CD2B0B0_cppui254),
+                            typename field_type::value_type(0x24369CA329C8033560292C94FC14A78668675968D3A9236176C9FA58EFB0B309_cppui254),
+                            typename field_type::value_type(0x2B0ECEEA6AE7EC075C6C0BD1CC42DE512E6B9D5B27140FDC72D8C9D0E03227E9_cppui254),
+                            typename field_type::value_type(0x2CAFC4CDBCC7FDC1CB9406031BBE43B7BC3E5EDDEFEB5C78C507B6C98CAFC575_cppui254),
+                            typename field_type::value_type(0x0C5111956406A1CE31B50A0D90FDCA236871C353E3F75250304B08CEF557B588_cppui254),
+                            typename field_type::value_type(0x2B4948845AE79D5803BC258BCD951D476247EB24EBE416A89AD8FD9F465FE8B6_cppui254),
+                            typename field_type::value_type(0x2854FFC7B3E8214133FEBA8D6EB09B263690572A3022B7FCF2871AB9219CDBAD_cppui254),
+                            typename field_type::value_type(0x0106DE3ACC6519FE5E79D178C2C86ABDED16F791C8EF4D9335D97862A68F5590_cppui254),
+                            typename field_type::value_type(0x24C6A00E705DB722A2952DB86BBE7F08CAC7B6C3B50D023F24A3DE1EA736074D_cppui254),
+                            typename field_type::value_type(0x0DC43ED6B87676E8DD55E167471A55F2EEF0968E310767659123E48B357903A4_cppui254),
+                            typename field_type::value_type(0x047F07B2945394A4228F4D125E0D0278D49348A54C2FF6467BCF8665C8DDB0DA_cppui254),
+                            typename field_type::value_type(0x1059182C92269565B2581BA82C7E900B57A61AE0672DD4DD79DFC1746E69D6EB_cppui254),
+                            typename field_type::value_type(0x2644642AD942CFBD4736A0F7F18FC0197E029521EE087615E04A49E5F8FBB66E_cppui254),
+                            typename field_type::value_type(0x22B30468BD6ABB89A23A5DCE7E57AE96E25E0417937368F6760147AF32C7A7EF_cppui254),
+                            typename field_type::value_type(0x273406F7BE99E15ED909F0692F85980069DBB1C1D34D3AA366AF8028DBFE8451_cppui254),
+                            typename field_type::value_type(0x145B29FDDC4FFDFE0425FD3D88DD2901F6E78327ABD2B3AA23BBC635D266C721_cppui254),
+                            typename field_type::value_type(0x0D2840D13BD34BFDFEC1CDC4A844E0CBBC5A6BBA682AF0B495866B7B09965889_cppui254),
+                            typename field_type::value_type(0x1342CF8B8A823D0AF45698789AC82954F4C82F5A6729B872A39BC5C1E4166E9A_cppui254),
+                            typename field_type::value_type(0x0A6B9D0F5143D8FE0B187F4FB7AF3423D79676B79B6F030961937DED10C7C7BD_cppui254),
+                            typename field_type::value_type(0x012C3C3B016786FFC36E8E9DF6D2B0FA919FBC95FB166518EA7C7AA0014E8C1F_cppui254),
+                            typename field_type::value_type(0x139BC1DD75B831294BF28F4030675C0E05AB4F44F87A639B04228814B6CD5531_cppui254),
+                            typename field_type::value_type(0x18C670606F2E48D361C347C0219AE8E678759C0B22C01A1756B6B0E3C679EF33_cppui254),
+                            typename field_type::value_type(0x2699EB06108602CF13980E2B6E4F48C6D90F46DE7EAE60457E4D1019A4F3B9BD_cppui254),
+                            typename field_type::value_type(0x0626C5F10D9F788BA433F2BE9AC352B4298ECD2CEA3CFFF1E15E9D48FBAA113C_cppui254),
+                            typename field_type::value_type(0x1F4479F765EE101DFEDCBB07E9033604DA94DBBE5B781331484321AF5B253DCD_cppui254),
+                            typename field_type::value_type(0x21623C9B390BABF2397D31CA4AF79148AD304A121AE5EDC1723C994D2828F444_cppui254),
+                            typename field_type::value_type(0x12C9F04A3DFD3D3A6700786E35D77D8BED554A3EFD32E6A52E530B78B859704D_cppui254),
+                            typename field_type::value_type(0x000BC91851EFBCAFC0981A843E6990126A29657F7126F37EA305BD101BC0CE83_cppui254),
+                            typename field_type::value_type(0x2855725B3E68975EBE53642831AE4D5D2D7B4B137B95EB96E8151BC61F1BF053_cppui254),
+                            typename field_type::value_type(0x0CA0E44E2FD18EC91840CCFE99C3049DE88D1CB70C63633B7AA4416B92B0336D_cppui254),
+                            typename field_type::value_type(0x0A2A1278C86117B029B7326D166C19148E03E57CEF8D0398AE8C4E62410F25D9_cppui254),
+                            typename field_type::value_type(0x2BFEA8E123C62B9D1BEEA64AA3F38C09D1957C0774518AF8AC530E579E68AAC1_cppui254),
+                            typename field_type::value_type(0x15A9926DECF4507DEE8A44513F027E28C90AD7CB20251B61B027590C149A5B87_cppui254),
+                            typename field_type::value_type(0x00B335A0806960DA1353D0FABE4C4CC0381FA82E67FCD992D91E3ECA1AE61645_cppui254),
+                            typename field_type::value_type(0x21B79E068F26EC7AB54F56E6461F4A9045C74CE6AB09A9BC1FB57F9786AE0AD2_cppui254),
+                            typename field_type::value_type(0x260F81CCE3BBD00B21509BE1A926FFF83F7578B03FD39C3CC6FCF28FB0F3448B_cppui254),
+                            typename field_type::value_type(0x136DEDCFF58A79EF53DF43747AB531FF7D38D5C7D2F7A6D652F57B415B808C10_cppui254),
+                            typename field_type::value_type(0x108956DF051470607A649A39F14EA5CF95A904A406CA3123EEBE60A0EB4300FE_cppui254),
+                            typename field_type::value_type(0x0D744FEEDE2A6BD63F61403043B33F81F56A61AE58C43E8B771EE0CF5F0DFDEA_cppui254),
+                            typename field_type::value_type(0x07EDB65778A0AA859B8947EF31E601C311B25AA1BD2A5CCC3225CAC13BFC1D18_cppui254),
+                            typename field_type::value_type(0x23ECD41F06EB8051F907D416C36A9A6691DC87CC64DE02261C7EACAF70B82BEB_cppui254),
+                            typename field_type::value_type(0x0CAF2DE20986119D958E6DE7C3F6CD4F8B38645C9E59A12F46003AA5625C1EDB_cppui254),
+                            typename field_type::value_type(0x02D46DA3F064D87A6AC0C21597BC4A321B0558DEC7DB3F2B6C654F5843C6EB3B_cppui254),
+                            typename field_type::value_type(0x0260651E42D36802CEE64BD3BCB3348815CDE1B2DFD62DA92CA6BAEE9430F2DC_cppui254),
+                            typename field_type::value_type(0x15B08DB406565282B6A0D3FC8022EADD2B61A559F3C92CC91521C45C6661A82F_cppui254),
+                            typename field_type::value_type(0x037803C869368190F0443820670330B14439832989F2345A36E5A48B2C59E543_cppui254),
+                            typename field_type::value_type(0x28B9F3268128CCBC1897FF292C8748DF7D224C7A87F9C965845B69ED1DC75B92_cppui254),
+                            typename field_type::value_type(0x19BAC52852CE550C81A2C34BF7276416B9D0866F15653564F06C3DC483DD400B_cppui254),
+                            typename field_type::value_type(0x1E4A04D223A43E4FB1B985C82BC1AEE975095D3FA352EEDF374AAE37698477FA_cppui254),
+                            typename field_type::value_type(0x1CC5F283BCA27B442694A510C5822516AD35E6D18819AE97C383A79213F0F912_cppui254),
+                            typename field_type::value_type(0x275D300FAF172A4ED395B4A4EABC558600D6066DAEBDAF7A621A810F62B4D256_cppui254),
+                            typename field_type::value_type(0x2DD5A12A62C88B609767A06F233BDB62A812F0CC30CFB2BF35F632C4C9C9636B_cppui254),
+                            typename field_type::value_type(0x0E1ECA77E1FDFBC7A151ED32732CBBE093978B5D8724324D73929A30E58BE078_cppui254),
+                            typename field_type::value_type(0x2E23A2F478EFF00D8F0C0D7EC3C2C76467AEB2CA3D26EF49ED19EF1A8CCCF8FF_cppui254),
+                            typename field_type::value_type(0x0E16C46D7F01CD14637900379058CDE52352483F90EBA6350DEA325A183E4C8E_cppui254),
+                            typename field_type::value_type(0x2BC5983FAD220B58189C50BE25B200C54E70D0529E3DC96DECBE801F0420786F_cppui254),
+                            typename field_type::value_type(0x1ECF556E4EA1A22B395060ED7C79A79AD9AF43103B935CAF9D410AAF61CE4E9A_cppui254),
+                            typename field_type::value_type(0x1AC123A28245DE45FD811267A8E343A1B035E77ACA8B4614D09722CAFF12B0EB_cppui254),
+                            typename field_type::value_type(0x04E29EA8C8C9649D72F560DE75D227858CA8D9D90CF10C42D9857193F417D9F2_cppui254),
+                            typename field_type::value_type(0x1F69213821FA0402FFDBD464926F1EB8AD6B3109A837932A9EA86C2F1CA2EEB1_cppui254),
+                            typename field_type::value_type(0x1211F23E5E92C74A454701BF173AAF1EA12F7042E85859C468D94974EAAD551C_cppui254),
+                            typename field_type::value_type(0x165D5F2FFF807855A18513EBDB932DEE6BFCB8293383F7B7BC5196D737053F73_cppui254),
+                            typename field_type::value_type(0x15F4376AC1C94C68EF3C0F7D12269445B7E2C662A98D825A1B8E1F4A87F4A4E2_cppui254),
+                            typename field_type::value_type(0x17FED6C46212799C4C59FC78DD5F5507310A0DFD8FB38A0BF7960A3EC6A1AC93_cppui254),
+                            typename field_type::value_type(0x128858CCF4428BB3E64266C0330966F140CB62E39866ACFA6A4E7558F66FBE70_cppui254),
+                            typename field_type::value_type(0x1667A029D6C621895221AB2E7AC113B9482137346F94655E1239531115876CAD_cppui254),
+                            typename field_type::value_type(0x1F141ACB1422CD0AA36A066378E3A743C8DFF622C398BE5F46087928C79D5AAF_cppui254),
+                            typename field_type::value_type(0x2B6340F19577DE1547871D1CB3D0EBB02953AE21743F50ADF97150AFCAC25611_cppui254),
+                            typename field_type::value_type(0x2B9FCF34BF541A48EC88D66CF5BFC89700211AE76A79551757DFC50F41288227_cppui254),
+                            typename field_type::value_type(0x0CED96282D5EDC9CBC32B1C16E750DA8CF3237E07E3625D85BEDAECFCD12C9C4_cppui254),
+                            typename field_type::value_type(0x2F9EA4E44871CF87CFA80F71560253DC13AB58F9728495FDDB4B9BDD11628735_cppui254),
+                            typename field_type::value_type(0x28DADEE7C5D2A42CD524D8396F69EE363AA95F85C98C3C836004589B6D73084B_cppui254),
+                            typename field_type::value_type(0x15530BD41A96A8A225DB6640075AECD1884A06BBAC5F98C51E5A487BFEDC8D70_cppui254),
+                            typename field_type::value_type(0x1C86DA90E9556705A7476BFF65B8F53425E3D129DB8F179AD6E4B033E0495A20_cppui254),
+                            typename field_type::value_type(0x15169ACCB31E7C7459EDC24B11C933BC3938DD82A98C289709906270B882B310_cppui254),
+                            typename field_type::value_type(0x012C38CBE056FC15EAC36508B8236A8AF8055570824926B7F070691023ADFC63_cppui254),
+                            typename field_type::value_type(0x0DA53EF60FD433FE0EE377BEDC0E2F7239B514BBA5CAA80C52991C619A029559_cppui254),
+                            typename field_type::value_type(0x1E1A37D1BF9F0EB8677BB0FD215C26CECFB350AD226F42D569BB040234DA117E_cppui254),
+                            typename field_type::value_type(0x10A818E628FB77FD8077D4378EC54A705F20A60A5D686EF420BF5394B2038E8D_cppui254),
+                            typename field_type::value_type(0x0E0B778453FEE1191E15464A2806F8827E78469757EE6B714E874764169718C0_cppui254),
+                            typename field_type::value_type(0x238A9E7EBA25F95E35ADF87607E601827C215180D6954DFBF2B59FA5526F40A3_cppui254),
+                            typename field_type::value_type(0x1D3972E8FA3219C751582A8B4AB7D13B1149284CEFE83B333FC19A67C1C1D082_cppui254),
+                            typename field_type::value_type(0x1F63E30217194871FD3FE3E9BAEB6DE7524D884FA09E7399C2067D1CDDEAA24B_cppui254),
+                            typename field_type::value_type(0x30189E0D959E4E5DD9679C40D103E296D6E0997BE3205782500E5A607FBCB7F0_cppui254),
+                            typename field_type::value_type(0x25D8A9BA3266BD80AF59395320E940663AB8C05932A4280B42BFCD0EC4F69D62_cppui254),
+                            typename field_type::value_type(0x2FC95ABFE6BE50F1ADD78A03A9B4E60931AC358A132AD5EF5076C4894FB14AAB_cppui254),
+                            typename field_type::value_type(0x13B8FEC4A1EB2C7E3CCC07061AD516277C3BBE57BD4A302012B58A517F6437A4_cppui254),
+                            typename field_type::value_type(0x224D978B5763831DFF16CE9B2C42222684835FEDFC70FFEC005789BB0C10DE36_cppui254),
+                            typename field_type::value_type(0x2D035CD6CD9CA06A9AECEE6826E38A30DD6FA18A9F139179142782803A05E6A4_cppui254),
+                            typename field_type::value_type(0x0BCBE75D48AF9E7D4A45EF21E0348411BDF99BE154FCC82ECEFC6CBAB8157291_cppui254),
+                            typename field_type::value_type(0x0F4B809805BC55DB503EB1E2A8543DCD2C7A1417463A6AEB23687E5E824A3168_cppui254),
+                            typename field_type::value_type(0x2890B136B1EFA421D541FE456FC7EC2E44ED3A9424F7C03A5D5B36B1793694CE_cppui254),
+                            typename field_type::value_type(0x1096E761836E74C5C654DF817B4ACE41E55CD812E97D2D0AF5E2EA6F24DFD392_cppui254),
+                            typename field_type::value_type(0x21FF527613E48F4A5E3548AF70EC2C1076B85506CF767ACEB570EE83983AC6CE_cppui254),
+                            typename field_type::value_type(0x221A3577763877920D0D14A91CD59B9479F83B87A653BB41F82A3F6F120CEA7C_cppui254),
+                            typename field_type::value_type(0x2752C7F64CDD7F0E494BFF7B60419F242210F2026ED2EC70F89F78A4C56A1F15_cppui254),
+                            typename field_type::value_type(0x16A7DCF1C28AA403A66CAAD9BA884B44660F41D654F63ECBE8E5873584229D57_cppui254),
+                            typename field_type::value_type(0x0F30859ED09E209692EC1BBBE78985B58D866DE81639C7EA33E8E47A60490B82_cppui254),
+                            typename field_type::value_type(0x2A515FF59472544F316C9228711BFE8AC20369FEDB4A0CCD339F221691C8940E_cppui254),
+                            typename field_type::value_type(0x0E68173CB235E6AC79FEC7E61030AFC39FB67AEB038DB30DD0E15B18A5247AF2_cppui254),
+                            typename field_type::value_type(0x292C4A9EBFC080016A973AC9E24FB4B356C69DB30308202A31D0BFB2E85443BE_cppui254),
+                            typename field_type::value_type(0x2D378FEF5D7B4B008DA52D0C98BB8DAA702109AA7D5DA477107D9F9559DD6EAB_cppui254),
+                            typename field_type::value_type(0x1D316FBE5C0CCEF4CAF35A917244FF619D92D4FBEDC80B970205508E4B570595_cppui254),
+                            typename field_type::value_type(0x22B85BD410A73800D3610F05DEA0BC7D82960D317602CF44BF77AD8F8F254F79_cppui254),
+                            typename field_type::value_type(0x2C961C9D2AD66F1049FDD0E8D7337E3449E8774836BB9981B56FC6E7385CD7E8_cppui254),
+                            typename field_type::value_type(0x06BD01A16056ED018B2394A0EC6897CFBEB20A18C606B0D78BC78D1D84A6B892_cppui254),
+                            typename field_type::value_type(0x105E126F90AB76E6FD2492508D7454B66171D86030B83717424DACA5A70CD716_cppui254),
+                            typename field_type::value_type(0x2F0F2013231A149E71E5D72D983131F0BB0252F5A4FFAE8DF0B4A54AB19E2020_cppui254),
+                            typename field_type::value_type(0x2E8A8414AFFE97ED11410C27AC23B1F54B6A621BA39A9FD7F1685F9DB88343A7_cppui254),
+                            typename field_type::value_type(0x1EFBC6E7CB379B246AD9278606EA10B7C74F52769C615CD67B833C5016AC7DB4_cppui254),
+                            typename field_type::value_type(0x02961337529A11CD5C22E18F2FE7A2C9FF8AB70822F21CE5D1A1D31CDE70AEE9_cppui254),
+                            typename field_type::value_type(0x1B42B46E88306BBF5A3793849F02EFF11C0A3CD4FA60E3E8C634F83B96660DF5_cppui254),
+                            typename field_type::value_type(0x2EAADE74BB23952409361097840525AA1082C3055D475AF271BD8CA791E4AC60_cppui254),
+                            typename field_type::value_type(0x2D8B49B9056B35FCE88D784D039521A784C513BAAADF4EC6830E5798175B19A7_cppui254),
+                            typename field_type::value_type(0x0DB2C2647675EE51C08AE719A27B887767585FE7CF1F8C377F9B14C626E31C6F_cppui254),
+                            typename field_type::value_type(0x2F7D1EA9785D559FA5F4CE44F6ECEF1D740ED0B6FEE26922B8A20056AA2B8E8A_cppui254),
+                            typename field_type::value_type(0x2ED01ED41EC147EC1EBA42D4B3C921568944E9A0D8A498706F99EC15D0CCC511_cppui254),
+                            typename field_type::value_type(0x1DCC8B5251AA1008C792AC420BC9BE5F1870042D0210FF8AE96804DDFFC721AD_cppui254),
+                            typename field_type::value_type(0x194C79506A89EA907A1E6777926F317F7231EA49BBDE362689477B6EE04E9613_cppui254),
+                            typename field_type::value_type(0x026C94FBFB503010B9CAC6A4B4E8E5FE29553E60128E05CDBF5546CB7BCB34D7_cppui254),
+                            typename field_type::value_type(0x0277AC3A2889CEA8FEBFA02110307C50B7D8DA14E50ADC4E86DC8D0AA73251DD_cppui254),
+                            typename field_type::value_type(0x17EB791ABC2495F664FFB38442265281A6F9A91C6169EC5A6E7365DCD3C64871_cppui254),
+                            typename field_type::value_type(0x25D7B0C56A4D2B1C66A4ADA931D50B89F6441A3F17F4FBB47F89C193D6328507_cppui254),
+                            typename field_type::value_type(0x066630E38896CF86302F6644F0D731C6C6E07C167F7F0655552D3DEC385503B4_cppui254),
+                            typename field_type::value_type(0x0D3C84C79E806FDA93EE88A7887B9DAAFA47969DAD98217AB2BC82BDFF4FBC25_cppui254),
+                            typename field_type::value_type(0x213F847FFC2EB33FBB7A5FE6F9E52D792095FFD8C8EBCCC3CAF9ECFD610CF1B2_cppui254),
+                            typename field_type::value_type(0x24F0493CAB22766260A18A26015E2BDA13D1146C6E7C951BF31BB50C35AA3378_cppui254),
+                            typename field_type::value_type(0x30409F14DB2D8BA2A733FD9205CE4DC5F2884CA1C56C39A1EF3A03C7DF28D9CA_cppui254),
+                            typename field_type::value_type(0x1F9FD4D738393638BF0148D6AA82F257CE1C62ACE8D8AD04B9E48CC116A5921F_cppui254),
+                            typename field_type::value_type(0x0B9E5A21A162D49DB00D59DD25D62003DA4C9E1A44BC2A368205D99C13FF9142_cppui254),
+                            typename field_type::value_type(0x1D42B7F339A9F4A670EE69305594C2EE745C77B933231F987F269BA8F3B9D26C_cppui254),
+                            typename field_type::value_type(0x10CA5470BAD3DF9289F48F4BF46E31E441BBAE633B287B4EDFB86E279BFC5637_cppui254),
+                            typename field_type::value_type(0x21D9001150F189E28D9E194E98BC5AC761EDA5D600D7EF517983AF606C5548B9_cppui254),
+                            typename field_type::value_type(0x1E2FFF3D9CD1F421A57FF2DADE55AB4CE3B4628A60480CCE558D3A77B8FD5227_cppui254),
+                            typename field_type::value_type(0x008C4343A41A1DAE81A6276852D405ACD87E81FF4B1D190482B5718A6E31A761_cppui254),
+                            typename field_type::value_type(0x12B4CA0371B8EE1BD20A1D65277BAB81E59F6E5CE60CCC6B82C722CC29D07FA7_cppui254),
+                            typename field_type::value_type(0x2BF8FAC78021AC7B2753B1ECB80FB30160B6B3250B5CF0EC9AD46F7801E759B8_cppui254),
+                            typename field_type::value_type(0x2C0016ACF87D3833C0FB9709392747265F4202151C050427B3B5913FF39DE477_cppui254),
+                            typename field_type::value_type(0x2EFE2D270CAA6CF0484D66B8EFD273E06607E1E9E8BEAA232F03B836113F7959_cppui254),
+                            typename field_type::value_type(0x237EB45CB181FD369E288A0F24FE0282294080597676B860042AAE735CE06BC3_cppui254),
+                            typename field_type::value_type(0x1CF7146B4C1D2EA113417938E790A96FE811CD3DFEF48DDF27DCBA7CD820F6CF_cppui254),
+                            typename field_type::value_type(0x2A5ED72CBB62AC7046EDFDCF9D1B47368FB3E2291E1E85E26C4E8CD35E401EF5_cppui254),
+                            typename field_type::value_type(0x1C563B12CF7A045CAE933F65BC5B8F69E59369B49F64D0227C5F1ECFECCC2552_cppui254),
+                            typename field_type::value_type(0x01BDD82181637EEC4FA1D91C4774DE5AC31A0CD12089DABACEC35E521726E3C8_cppui254),
+                            typename field_type::value_type(0x09433DA09081E1DAA579161235EDDAD4940BF06634EFCA0688A8F7951AE767F0_cppui254),
+                            typename field_type::value_type(0x170311DC95FB099612BB52025516928DC6D417479C95D65E7AF16CAC3490112C_cppui254),
+                            typename field_type::value_type(0x068212B42557EC73E1B61F7F0C3A7EB0F79ED9C0C1190FB79CF99A2B57C32DC6_cppui254),
+                            typename field_type::value_type(0x0AB9BD3B6B7D645D344178CB2838F392E6576EF0794D44CA06971187FE658E0A_cppui254),
+                            typename field_type::value_type(0x05E61BBCBC655464BA1FD215E04FCF949939DE110F05722431CD5084968D6DB9_cppui254),
+                            typename field_type::value_type(0x13E15F844FA2767FAC2DAAE3FB818E93CF95082EFD681DEBB31574DEFACAD671_cppui254),
+                            typename field_type::value_type(0x034BF641F495A59E3D28DC3163A1C74AEC7F7EF60030C8614C193F7AE2281A96_cppui254),
+                            typename field_type::value_type(0x08B45E915673D26D8C5C5258A951FCF9B439D6833E12D2C301DC2EABE23E3F61_cppui254),
+                            typename field_type::value_type(0x2960A0634103632555B7ED048B833D198C75536BDFCE550988DEA08D1B2A4B69_cppui254),
+                            typename field_type::value_type(0x1F29D4CDDFDBBB9A3AAE3C862DEF08730C9563529B888E065F77604D012C194E_cppui254),
+                            typename field_type::value_type(0x166C3562A0832ADB5A67B134858CEE9B5E5D5358431A19BA86FE9D0967A54539_cppui254),
+                            typename field_type::value_type(0x0CCC4AF1EE0BCC9C37D6F500DF8BDE3101BC0C3DA2022A3A8A8C38901F78045C_cppui254),
+                            typename field_type::value_type(0x2BED31E2B3EE10FA9CFEA431196DB0B201587E2E68EE74DC466450053177C5FD_cppui254),
+                            typename field_type::value_type(0x22C3F8FB3346540004DF204600E2A60F2B5232A3FCCE889962561E1C98A80146_cppui254),
+                            typename field_type::value_type(0x0D7728D23FAF28D4B5D975853C663CBDB350D0566E62CAEE8271F934E6001334_cppui254),
+                            typename field_type::value_type(0x244206DA4BC1DDECD6C431D6E06D4DF305E10923263B41E560EACF70BEDBCEFF_cppui254),
+                            typename field_type::value_type(0x29C7301B23EBAD298BBD4AC04FE014D9DA74C7831CC44DDBA4B6B393640C883B_cppui254),
+                            typename field_type::value_type(0x209FDB40C6298DA273F92CDD90A963E08774457532A878D173853011893A49BC_cppui254),
+                            typename field_type::value_type(0x28AF4AF2355317960A27814FD7226940550DC62377F9A6261B07275B4A61F687_cppui254),
+                            typename field_type::value_type(0x298A8C2BE43F0CD0AB5471CA8888EB8E0548731E2D4D4FA68AF4CC2349FC9C66_cppui254),
+                            typename field_type::value_type(0x0D452F069C9EB613854442C5E9830FFF0CCCBB7A0C37BB8FA9A81C242933B54E_cppui254),
+                            typename field_type::value_type(0x1C8331A53DA629B28D02F6BA74B52CAF67C4418E22FD6CAF57D627E110451251_cppui254),
+                            typename field_type::value_type(0x0F055C21E2D7E8617B71BABC6B770FC9A7EF74C3913FCF610D599414096B700D_cppui254),
+                            typename field_type::value_type(0x1EBEB82F257DB891825C55B2C909F0210DBE84616C0F5A867AA9F380A9171929_cppui254),
+                            typename field_type::value_type(0x21907AFEBC2ECFB8C7C376A0DB9958B35A6540103391EFA541A28B82F472F48A_cppui254),
+                            typename field_type::value_type(0x27C5A8CF6FA01B72D31AC50942838B8362D01E25C82B2D9C4A0F231441DE4197_cppui254),
+                            typename field_type::value_type(0x1BFA93EE2A17F24CB70834F1CD8C7EDDB432BF436ACDF89898149A98FDC7F878_cppui254),
+                            typename field_type::value_type(0x17C5ED3CE8715621C7F6B97BC8D7B7CD89731C0D4FB49C120849FFD2AEB881DA_cppui254),
+                            typename field_type::value_type(0x205BA2FCCB49FB5023E5114F84E961B9237B49CA8F5610BEBB995B33EE249369_cppui254),
+                            typename field_type::value_type(0x0B388977D2E0A8FC0E63A06375D9FE19FC7B798B8B0F2C8B0885920CB5BAE45E_cppui254),
+                            typename field_type::value_type(0x064B27B0F21CD7083851471818036F14DDC27D6725897711699AF7D96FB7560E_cppui254),
+                            typename field_type::value_type(0x100CA42932EC504831FC490DDDD32C13381655C3C446319EAACBF792046843F1_cppui254),
+                            typename field_type::value_type(0x2811A7DD4B4EC4AC1CB1C94BA4EAA6A74D3D7638144630263160D36E5AECE06E_cppui254),
+                            typename field_type::value_type(0x2E4F5257A290AED71DC5ABA7B690191780D10444EAB17EE2EA032BE820B30577_cppui254),
+                            typename field_type::value_type(0x0EC744281E5F92B3F0BCB5504FE393EFC147578D1C9DA3D3206B63B2555BD6A2_cppui254),
+                            typename field_type::value_type(0x1B72AFE1CA35396CF83C49CCF1342BCB73BEE3EBCDF8AB5805DF190254DB0AC4_cppui254),
+                            typename field_type::value_type(0x2BB165EE76D92F26BDCBD9897C6519B8D89EEEF2EFC0C9521497068C735A54D2_cppui254),
+                            typename field_type::value_type(0x152704FE7AFC78056EE79211313A0B23B71DE06863C6102E0F8DAEFC0F2E85DF_cppui254),
+                            typename field_type::value_type(0x0F34D4D950BEF2EE3B8E924B0183CA4E00AED6EA9209BC37C4E2202EB5BD7666_cppui254),
+                            typename field_type::value_type(0x0D676A2DAC5FCAB3731AF3283D9C22989889FAD53465781A73EA5AA81274798B_cppui254),
+                            typename field_type::value_type(0x042FDCACA97128FD28B1CA4C90EAF39378D673AF8D9F789D33B88C8284C1E4C7_cppui254),
+                            typename field_type::value_type(0x0C5F60E7EAF108AF711035A4CA219DA7C7926C882D40373D76D9FC5DC05BF2D6_cppui254),
+                            typename field_type::value_type(0x085C3A11DA737E3FA622FFABF685505DE1BF4C7FEE7393BA42AC6010E3E6E063_cppui254),
+                            typename field_type::value_type(0x0BE6830A305F4843E7BF227E4D3D95C70B95944BA0A250DEAF658282FC0BD13B_cppui254),
+                            typename field_type::value_type(0x15F74BF25691E3205D87C4EE7B798F00097551D1A14E732F8EC16BE2C2B15424_cppui254),
+                            typename field_type::value_type(0x0E917F31FACEF054212B2376C65779119A28CF490A506E66D48DD45117BA7CAB_cppui254),
+                            typename field_type::value_type(0x0067092ECE3460732B848208687E125BF1324E11B4BB9A4FE144419CF5C73BD4_cppui254),
+                            typename field_type::value_type(0x0942E1577E63B0FB2ED5BBC9250E4F7AF69AC37E517AF056FF633AFFD15804C2_cppui254),
+                            typename field_type::value_type(0x1FE516383BE6AA5F84BECCB8DD47013DD50F16A259B97298D03A6CF8C511D2D1_cppui254),
+                            typename field_type::value_type(0x28762DBDCA20D4B608F40DE9EBB74933260E3B97C5BD0A610EC8DF3DB0A955F5_cppui254),
+                            typename field_type::value_type(0x10FBFFF9AE9200E5FDB5A27508A2797B1BE92D8BCB3ABBF5E60F5277609D891C_cppui254),
+                            typename field_type::value_type(0x01BD158DB5200DDA49322AF80681CD400EBA80033DB96CB66FD85F0C7F997D69_cppui254),
+                            typename field_type::value_type(0x08BD6A57EC62543E02F6FC7D0C3E832C7B7FC579D180A91071FAA3D3EE9419D4_cppui254),
+                            typename field_type::value_type(0x1BC48805B6F1636FBB3FCD6DA38AAFEAD46D19C009893B19CBEEEAE7937A68B5_cppui254),
+                            typename field_type::value_type(0x0022D27FB14085110CB59094144FC0B73878D88C64957112740A8559878D34FC_cppui254),
+                            typename field_type::value_type(0x08E1197FB288DBDFC3C45E74C7362E8D24EB51A66E6F601E078713114BE490F2_cppui254),
+                            typename field_type::value_type(0x1B9F573652906BD22AE891E98F72B280AA9F086974561858B06E57325BDA14DB_cppui254),
+                            typename field_type::value_type(0x12AEC4B8476606D47B077DE794BE45C888600E94486A93B3560D82C80BC5F8A8_cppui254),
+                            typename field_type::value_type(0x152621C7E021CC39051B6E1ED3B961D81585815291EAEC27BBB86E4331969FF9_cppui254),
+                            typename field_type::value_type(0x0F84664D02C5C3B826F0BECC8E96005346F047C9748E21C99A376CF165992AA3_cppui254),
+                            typename field_type::value_type(0x2548E5CA7207FC244A56030FDEE8726891F78B31B786050B01F535872604FEF9_cppui254),
+                            typename field_type::value_type(0x040F0788FAD8EF4ECA110681D934BC1875CCE24D4B79708F50C5C5ADE76284E5_cppui254),
+                            typename field_type::value_type(0x0B113EF991275E84302CD00CE5195D5594049C1B1B93F64B952C9CCF323A86C3_cppui254),
+                            typename field_type::value_type(0x188DBA123D7BF6519C468A927F8A2832CD1E455370164E4608B35531EF7C2A04_cppui254),
+                            typename field_type::value_type(0x13EF7BD0C2A7BB6DE0E3A15F7CF4CD82F055424BDA15E9BE92CA06729F655B03_cppui254),
+                            typename field_type::value_type(0x2F6F3FE50318B2911280DD5858F5E079652F20B5E7BD498F39C0EB88A447C6B6_cppui254),
+                            typename field_type::value_type(0x2DBE1F040704EFFB33108E84EE0D2693DA8FD2B3C5D54F6B88CCA6B0FBEDEB7D_cppui254),
+                            typename field_type::value_type(0x1A626E74B2D2262B30CB13311A150C31ED05AA9E97994BC502CC5A449D104C16_cppui254),
+                            typename field_type::value_type(0x08E2DCB5D0B19B7B0FD7B371BC43C5756F0377132CEF98DF0DB4DD9EB393ADCA_cppui254),
+                            typename field_type::value_type(0x2FE5E5EA9FB4E811DA5043DE233B0B4E971DA2DD38941C5033DE0AFE61E945B5_cppui254),
+                            typename field_type::value_type(0x1D4F9E8484DADC0B72B38138CAAD649253A61A9BF5AD2D9AFE7330BF839FCBEE_cppui254),
+                            typename field_type::value_type(0x09BB9BBAFBFBF4038EE64E73EBBB0975DB22EDCD2D1C1C6E83ECA2672FAB780B_cppui254),
+                            typename field_type::value_type(0x0FDBF5656758CF6806E65B7800BE3B7C039ED1FE181A0D4B50FABCEC79F0DF5B_cppui254),
+                            typename field_type::value_type(0x173A2BD7EAB80C0E2C4CF6ABB5B659D289DE53889C437EF553167ECFDDAD034F_cppui254),
+                            typename field_type::value_type(0x0B103FE811C91EA4E6803798C93CE041E503DFADBE57570B8FC82E9A02EE0F5E_cppui254),
+                            typename field_type::value_type(0x15EB3A3D6E62E058E7F72EF30913C4A24FBDBF73036A122A3ACCCF7AB77F2F73_cppui254),
+                            typename field_type::value_type(0x0F1CA7AA3DD35F558481EA63CF19D446200C77835C45C63954770AD12616DADE_cppui254),
+                            typename field_type::value_type(0x06E0F716D88E8041C0021DD736593A6A3FA501E33FAA9A6510B71467D749498E_cppui254),
+                            typename field_type::value_type(0x135C9A56C832C9CC877C0A05DF172E27317578306BC1295944F01FD2CD4978DC_cppui254),
+                            typename field_type::value_type(0x22589ACB7C49092ACFD1019210B7DF1A420745DA6CA324BBEDCF4C049155EBD9_cppui254),
+                            typename field_type::value_type(0x0256EEFA9455BE29257C42723F53F47BA893ABE0658C9112EE983023265D9EDB_cppui254),
+                            typename field_type::value_type(0x213944EE00A2611A0828499EF4E909F6A41355BC62C0E282B392FC59DB9848DC_cppui254),
+                            typename field_type::value_type(0x2954DF4FF10509DC34B8FF83D8C5E038FAE8021BA2AAA0AF90AAC6D6FD01251E_cppui254),
+                            typename field_type::value_type(0x1AB6A6D14369914D3ECCF8E67BFDC24AB2CDB1A175A3B5002DB3D7ACBBBC58CA_cppui254),
+                            typename field_type::value_type(0x2EB10A9A90309B08DEE4CFA8070265358C54B21572D914C9E8FD36A959304D24_cppui254),
+                            typename field_type::value_type(0x03B4EC52766AD398C08539C6F8ACB2B39874F0E0B994010EFA873CFDF680A88C_cppui254),
+                            typename field_type::value_type(0x1B94BE21F1FB7228D3F3D44204F4F3CAC13090D7C5C2AF9AC82F0475F5CF39B4_cppui254),
+                            typename field_type::value_type(0x27E9D41EF829511094B2AF4473637E9375EDA5F9E914CF55AAC02D9B4A969755_cppui254),
+                            typename field_type::value_type(0x25710E3A7246B1E76B8D6FBE6FF44AFD9FD30C9585351398C15D050238D3C2D6_cppui254),
+                            typename field_type::value_type(0x01C855E42168E00CD947DF9D3A268F0DB1F8E471F730CA88D84E1C2DE7083E4D_cppui254),
+                            typename field_type::value_type(0x23416B0552BB9EF74E5959D164DF433264A320B7AA149FCE40F9C123EBA8C5D3_cppui254),
+                            typename field_type::value_type(0x0C2F7CAC2D56CD13925334614E02AAFDBBB09C0285E6F4BCB278082C79228BCC_cppui254),
+                            typename field_type::value_type(0x2B144261F16985C75BFF2B9D0796D0BBB63BA9C927669E3839710EEA66A8EFA5_cppui254),
+                            typename field_type::value_type(0x2BB766BC6B62691154FAB15CC24CE09D7D0A86F180F7CFC60B459CCFE2BC1842_cppui254),
+                            typename field_type::value_type(0x21677A9A24375A6D1B4197931B3DBCD9BA9B45C9791D7BD018CEEB9639B4C0B9_cppui254),
+                            typename field_type::value_type(0x07FE73713DB56CF5E74B3606BCECCE09E62071EF0C84FAA5FDBA1ECA277D107E_cppui254),
+                            typename field_type::value_type(0x0DBD83BB0A83CC251A94931EEFA31B5B58C6335CFA35F0D8F0F01D75C8BCCBDC_cppui254),
+                            typename field_type::value_type(0x0529058C39101624A46042E9153FCDE08241C790AB1E6B93D0EAD0B2ECCDFB4E_cppui254),
+                            typename field_type::value_type(0x08EE93A1342F1669E8A338881236BED757CFD8E91682E8E498EF1F3C91210F50_cppui254),
+                            typename field_type::value_type(0x0DA2AEC7224472234F6BB6DDC4333404925643F4BB928953FDC46EE4A8A85984_cppui254),
+                            typename field_type::value_type(0x26B93A6DE603F0CB5900242713C98A4690D087EE2701F953C81F562A0BCF691A_cppui254),
+                            typename field_type::value_type(0x1F275BB2C0D7F2E06D4D3D7718AD405914E62AF9DD182C0F3D8CF5BD436EF483_cppui254),
+                            typename field_type::value_type(0x0F43E8A6E923598AB55483D1CB864AA57273DD9173B898DAAE6C753E403D80A5_cppui254),
+                            typename field_type::value_type(0x14351AD715D016D31BFA656C62512AAEEAF2DCAF8918BB24B379CF035722757C_cppui254),
+                            typename field_type::value_type(0x13971D545D04B5639A6BD48A583D0E02BD46B717AE6404589D09DDCF8E0E1664_cppui254),
+                            typename field_type::value_type(0x0D9E7A36118A844D63B5778975A157E06F444516A730E37EE575079115E1A51A_cppui254),
+                            typename field_type::value_type(0x107453DED40996A65C603C1F9244F55B6439E36BD8E77D9541FD0A8854F0978F_cppui254),
+                            typename field_type::value_type(0x2AE50E3F54316D31C5BA98990A11B8BE428B8237E48404E4DC96B738D93F46F5_cppui254),
+                            typename field_type::value_type(0x2B6126F3432D0AB7149133ED284DC4B8F4C690A15D24A2012DF8EAFD1E584102_cppui254),
+                            typename field_type::value_type(0x2FFED8DFEBA141FB9D2EC5F5C4EA602A5DDA428B2ADBB7FDB83DBFD3CBE3EA36_cppui254),
+                            typename field_type::value_type(0x050B5DE8FCE87595ED0692638576AA64D4B2833559D292812E359BF95ADBD65C_cppui254),
+                            typename field_type::value_type(0x07790896E86DCAB5C0910A1F73474CFC440075ED34121A4CBDABB93A7221928E_cppui254),
+                            typename field_type::value_type(0x2E2847513814BD96A927EBF5CB502CDCE790EA150DE4FA7FCE2BF676F09484F2_cppui254),
+                            typename field_type::value_type(0x11F12F51C8AAEFEC56132EC85AF709C3E49127E20D4289D2CE0968307F6552E7_cppui254),
+                            typename field_type::value_type(0x2E9855FBFAB7CDBBD37839A5DA9CDAA13AD2FDB500301EB1B7AD17D372CCFD1A_cppui254),
+                            typename field_type::value_type(0x046BC64F547A1A0F0D483400B1105BB1278D8C5C44C59B4BED0DAA18D54FDCC5_cppui254),
+                            typename field_type::value_type(0x0F8EBFF21F4475980919B8BF3A07E2BC3276C32AA8CC9BE0D2B9E6ECDA1EAC62_cppui254),
+                            typename field_type::value_type(0x2D5D4034FFBC3503E76DBFAAB4569192BDC22C3297C74CBFC9FAA36A1B168A61_cppui254),
+                            typename field_type::value_type(0x0F89469183D268E35A4E05882DBE1A6718F5246A18948C8BC421B21E2A1A8F90_cppui254),
+                            typename field_type::value_type(0x0C501E43476B33EC702B4A4CB163B64B2077F52E73FA21CF24C1D31E96A88C87_cppui254),
+                            typename field_type::value_type(0x2A49DC5C6E7FE74FF00AAAE703C26FE0916B22A76B66F11EB2F1C97A145C2FB9_cppui254),
+                            typename field_type::value_type(0x0A3D9ACD50D6E2F9032D7708FFCC17A60BA20F887EFAF42856B039CBC0A32483_cppui254),
+                            typename field_type::value_type(0x1B99049AE7479AB236A1300B14BC5DD1A0DFBF9BDD3C9A8C3AA8E48AB3021AC0_cppui254),
+                            typename field_type::value_type(0x037D08C7A6E560C8E2D0E3AB8161946BF9FC86F5E193CB5C13CCC2ADDE3322AD_cppui254),
+                            typename field_type::value_type(0x195CDBDDB30680997CFB2D5471C87C76F7CB4E61797EF85EC2C6F2D883B018F7_cppui254),
+                            typename field_type::value_type(0x1BF08F1D94D1EEB02F28B7A1AE77F739697DE40B672743DE45182203B0FA20E0_cppui254),
+                            typename field_type::value_type(0x1C0AA9902B751FF452DD57148B5B02B0B7738FD3E955C9217E40F207CBC6BFE0_cppui254),
+                            typename field_type::value_type(0x135E328EB54BB610E9C3A8453F6F659E0D070C476241075289C2934E10793E0A_cppui254),
+                            typename field_type::value_type(0x1333291A980A40AC9C59782314BCF888B0AA0F32334963FAA6492FF2F0299F25_cppui254),
+                            typename field_type::value_type(0x28A32D354011C8CBE98055FF6AB529A62C73BE5E9A3BCB72A5A49436880F42A3_cppui254),
+                            typename field_type::value_type(0x0D973B61A825018ADD5C55DBBA57329C02036D5D61799B9696F90E7EC58D3959_cppui254),
+                            typename field_type::value_type(0x246336D0B83D2907950DB3F95F1E1C466D2BA676A82CA2A7BD7474AC5012BDB2_cppui254),
+                            typename field_type::value_type(0x19D00E5A8576BD737351C55095A19E59A94E4B7EBB3A505C54C194609719FF04_cppui254),
+                            typename field_type::value_type(0x139CD47BAAE2140EE687714A64063DBCD8EE9C5BA41E8ABEC89D55EEE1018D16_cppui254),
+                            typename field_type::value_type(0x2F9E7F7800C6A9C653F48D4636D9DFAD6E122C48C2ED4AD2E59551956563BE7A_cppui254),
+                            typename field_type::value_type(0x2414DA5E0CD90394BD984C6886C3B7FC7D34A8418CC6898578EC0540D1D3BD48_cppui254),
+                            typename field_type::value_type(0x2B2B8F5E7F644EE1C00937DC227DA2E3DE69762726D86036F4807B6AAAE36C31_cppui254),
+                            typename field_type::value_type(0x047853A419BB6B761E2BF666D6CA8F90E93EC84A6E5B425D5B74DAF76EF9CCBA_cppui254),
+                            typename field_type::value_type(0x0B4E3485B52DC7C51660FA1CF4D542469E0C787C82AEF4E1DF424A5FDC726FA4_cppui254),
+                            typename field_type::value_type(0x27D11DE117F5AB285285199462175260FAD48FBAE370D24727C514F52F451655_cppui254),
+                            typename field_type::value_type(0x17B3259210A9A0E4339A3FE1CAA896E56306745007E783373D47FE37C800B974_cppui254),
+                            typename field_type::value_type(0x1AD16B73E4B32F988F8D9EEBBEE03224FE7BCBABBCEB02973CD2E159C3A58E35_cppui254),
+                            typename field_type::value_type(0x152338557558979CCD9A22491B3F9B999B4C870FB15C0222ED7D8149E0BBE072_cppui254),
+                            typename field_type::value_type(0x297B591779EAA7D8DB6A4D228DE4FF48A81DAE3721D861F241ABC1F6067B187D_cppui254),
+                            typename field_type::value_type(0x212EE7CE29F4A1EEF08693DB78D322BD870B882C4D6CB8863F71A7787A3330F7_cppui254),
+                            typename field_type::value_type(0x1AC86A62097F1A41D2579CC9DC166D71379F886AAE362DFEA73484E25D04B878_cppui254),
+                            typename field_type::value_type(0x23A4487E1C50549F8800EAC40BB6CFCA866B01CC6280EE44A58CCC10F1042279_cppui254),
+                            typename field_type::value_type(0x1B941439933BCD5F26507152EBA835FD47FABC81B38A06DE0A9B0022D27CA963_cppui254),
+                            typename field_type::value_type(0x020BE897F06FAD7A92EDF423DB7ED12CB2BD2F6CB29C6BB8C6E394FF1AA3B3E9_cppui254),
+                            typename field_type::value_type(0x07958A3FEC65B6DF34911A018AAC0FA72CE89D92BA4BC67DCD06D1B4DB184B90_cppui254),
+                            typename field_type::value_type(0x0253EBA1D7CF606254ED9CFF7613788A6D055495B779D9947A9CF46B9C1DA311_cppui254),
+                            typename field_type::value_type(0x1CABC4E498A23C3F5FCFCB887629459666B7513AC8C70EE43BE83A8B4F5C4090_cppui254),
+                            typename field_type::value_type(0x085FAD322FC02EF1CD3E8473C56C6A1A26ECABADCCF845A914D79C83BEEB318A_cppui254),
+                            typename field_type::value_type(0x03146780190BE66EB78F6D6A2150DA305D044739434F4D56DDCCD160DAFD43B1_cppui254),
+                            typename field_type::value_type(0x2F67A3314F4F08D969FD48A65D987E15BFF909E93230B6204C0EEB58C18A307C_cppui254),
+                            typename field_type::value_type(0x1A1605D1D7DDACCA75A742AD2C77ABAE5D1445F6078F57FDCF966C5F6C3143AA_cppui254),
+                            typename field_type::value_type(0x22C33C8C594BF804B9C5A96835ED929DC99711327D5DC3723BB2BCFBB56F7FC4_cppui254),
+                            typename field_type::value_type(0x2BC57D10207CA4AF29F3A0A8EB864D8989E89371936E4544626FB999BF7A4FE2_cppui254),
+                            typename field_type::value_type(0x2232BA8E174FF03862720F64C5B4D61FA78BA4BED94CAA98626DC8857C118ABA_cppui254),
+                            typename field_type::value_type(0x0B8374CD591936C96D3857CD94440A5655CF7B3B714B49BA889DA4C82DD57D4D_cppui254),
+                            typename field_type::value_type(0x2A2102EA3D78BBB60CE850C0B5930DE209AE7066A19B510A081E9AA25B20EC99_cppui254),
+                            typename field_type::value_type(0x21A955D5B43D3D949D440F256F55D7E5CFE813B980F414FAD34926C9BF734985_cppui254),
+                            typename field_type::value_type(0x12A37FD172BA92BD82EADC3EB8CC107E32C721B9139C9A016A4FBA6ECEE0E872_cppui254),
+                            typename field_type::value_type(0x03060307C62CDC00A7795EBCA9CB21B60D9C4589784E278CE7058DEE36070DDB_cppui254),
+                            typename field_type::value_type(0x225FDAB8FE6CD876363D27075CDF0D01C209DA61B1634B574A5D811CFAE40700_cppui254),
+                            typename field_type::value_type(0x1216B7C3E2ADC07C3BEF31771C7BB9E1D02F07FF3A5B74953C4FD5BF9A7A6DFF_cppui254),
+                            typename field_type::value_type(0x2A365A9299DA85372EE0455DE645CC2330E4C315D6250E3C0C72F10D77AC40E4_cppui254),
+                            typename field_type::value_type(0x0E54618EC8951F6B8BE014E3F3BD12802B037AC48C2D0FD983F2343C5759C3DB_cppui254),
+                            typename field_type::value_type(0x2F31EE57EC760885E1E943C7D1602BFF848DFDE5CEA6A4EDF03476AD213591CC_cppui254),
+                            typename field_type::value_type(0x0BEBF1D735E3ABA48854ADA67731601A179CD76B2BB690E6AED56A2FD963E9AA_cppui254),
+                            typename field_type::value_type(0x22C63C3E0A1CEFFD83AF26673066AE0B6BA74198C47092EF2AA481107B3093A8_cppui254),
+                            typename field_type::value_type(0x26B832894412FB1174E6A72CBC90E5B6695128B2C59DF6087A6D04624987F9AE_cppui254),
+                            typename field_type::value_type(0x242A698649332113B115EB3982FA5E454576BC05886F71489A31113FD737FEB8_cppui254),
+                            typename field_type::value_type(0x2E98AF3E21C2FB8ECACD092858DC5EA8671F81867D371C9B1A010801CED7AE94_cppui254),
+                            typename field_type::value_type(0x1B27A492872BDFC576F55B42395E1140FB167FC083812442DBC1968B576C7929_cppui254),
+                            typename field_type::value_type(0x0DCF300D3F815DFB8EA3EDD0F2066BF53A989FE053B12C34EF921CD9DC4ED803_cppui254),
+                            typename field_type::value_type(0x0F9428F0F543DB7C1FBBC0DD296CF621455E5E314118E6975C8DE1ABF37ADD02_cppui254),
+                            typename field_type::value_type(0x13739DB359B77575024B45A9602B18EB50C25E60F73FCF3155DE9A62683710EF_cppui254),
+                            typename field_type::value_type(0x1A87CAC458AA04AC436B4B17478971D8A7FA55407B85B709C2061003E9073EFA_cppui254),
+                            typename field_type::value_type(0x01AF11F18A5A082B104A6C2387E6E193A947A9DBB5E2B42AB3619710D0D4D3FD_cppui254),
+                            typename field_type::value_type(0x0DE2DCE497FC378CF9875EA34483653AD21B40050A2BE9F32713978FAD365B6F_cppui254),
+                            typename field_type::value_type(0x18818ED119E67E54970494BA4F5C5FEB75FB8047779F910713AF5793062885B1_cppui254),
+                            typename field_type::value_type(0x143A5A6A69B89A9BAF10BAB59C62DDF7A747A8439541FEBE0964E2EA6E35147F_cppui254),
+                            typename field_type::value_type(0x0ACE7C02BCDB98CE30C3B6C4B9D399287EBC911E8D44226BAB0C3F06C1E7E717_cppui254),
+                            typename field_type::value_type(0x18A2A13576DF7D0BE0DAA67EEA762A6894FC88A47A4B5D26BF6AF3C826C91677_cppui254),
+                            typename field_type::value_type(0x0FC68277F2370379225A32315A25607A6341A371091589EDEABDA88ECC3D2A18_cppui254),
+                            typename field_type::value_type(0x1B20BFE67288186C86FFAA77C1F5AEA96549B7BF958E754C8B58BF9F6162EF88_cppui254),
+                            typename field_type::value_type(0x230C6988596E57EE04F3A803F92672134B20DD2D3B4787E6DB1D6A7243B97E56_cppui254),
+                            typename field_type::value_type(0x245CA02F753E3DCAE81462215695192BB8DE0EE8A3C195C1E2F735FB5510C791_cppui254),
+                            typename field_type::value_type(0x22DFA007006C664C55102BFD2A79E5E79D89F3947B9F4556DC1AD20B80FF74D6_cppui254),
+                            typename field_type::value_type(0x115B704200CB8B78DC575C68FA494838EE8C5FA205785D6A29DE16FDD18D07C0_cppui254),
+                            typename field_type::value_type(0x14C06AB76F676BB90153AAEB6743B0CCDD798E00FD48937B335190D746B16D91_cppui254),
+                            typename field_type::value_type(0x18B1700D759EBC8C9B33A14B38FB47E756059BE3C5B21FBDE91AEEBB299B72A1_cppui254),
+                            typename field_type::value_type(0x080F202E422023AEBD9F1B2942EC6B4D994235ABBBE0511B3FF04C2434D61CF1_cppui254),
+                            typename field_type::value_type(0x1C8B433969038D5EEEE19E529C223F7A3BB546B5BA88336F81566FB9607B61D6_cppui254),
+                            typename field_type::value_type(0x2A411FA9F657B377E5577CB0195B4050FA697D04AB5B3742A6C904DAC40B4107_cppui254),
+                            typename field_type::value_type(0x1AE696C232847D27E7B00F3FFEB36076D50514C4EE68BDCB08A892BCE08F3AE9_cppui254),
+                            typename field_type::value_type(0x01396047D0E2300586624C149388740F5C00E7CF4A7213598D8CA634CB7DF215_cppui254),
+                            typename field_type::value_type(0x2642B0D7D17B3AE1C6C1DDC1B018ECFF936F658D2ACC47474A330C8D6CD2D5F7_cppui254),
+                            typename field_type::value_type(0x0AF05FFE2AA2CF4F27DB4FC64B9BDC681E15F4FC2BB57F6CE23E2E1F89003C72_cppui254),
+                            typename field_type::value_type(0x29D2B27D8D6DB3791B3C64B2F61F5B2AB00D7F1EBC252CB97A9896A83C0E5D61_cppui254),
+                            typename field_type::value_type(0x12A4333ADD04E8AAD8478E3046268D23ED55292A96D7921460CE3D1F52CE28C6_cppui254),
+                            typename field_type::value_type(0x2BDA3A7C7E998425653A1D50A6E33CE9B574328966DD93316AE67B38553E24F8_cppui254),
+                            typename field_type::value_type(0x117CEC47663BA3C3080E6D8FBED07E7E4DED4C17DC37C977AD8D7883253D247F_cppui254),
+                            typename field_type::value_type(0x252D6852ED68F5FF4420BF4AE9E5900A65FA7B2993DD3745E8DBCEB436C5B94C_cppui254),
+                            typename field_type::value_type(0x21DF15AAFA8DBC395E66F7BBF004139EB5B5BC1BCC071D61B02096CABCDC010E_cppui254),
+                            typename field_type::value_type(0x19305CE2F9335F5B81E72F666C059466118D1109883B8527EEE0F6208A6069C6_cppui254),
+                            typename field_type::value_type(0x0BF463D5B03EBE4081A69DDF10CC6A434EC7AAF477D6333F30A9E10A707BCE38_cppui254),
+                            typename field_type::value_type(0x1360DA593DACD4CF367D817E38F546133CEADD8CF8BEE71F80F3B406082378B1_cppui254),
+                            typename field_type::value_type(0x1DE517C9B2B488890C3685DCD79C79AB2922656A0D525A1FE0697C3A448E09BE_cppui254),
+                            typename field_type::value_type(0x09CF29F5B5A6F60F4E9283F8D0780BB023BD4A86D40606ED96EFCE05B2920897_cppui254),
+                            typename field_type::value_type(0x00CF5720F2FB6501FA50B74E9F80D1F0EC5CE69CD1EF8847D44EE524CC48F250_cppui254),
+                            typename field_type::value_type(0x1D115DF69BE93CF70619B0F005A92968A5EE561161A3DD3CC963C243447F391B_cppui254),
+                            typename field_type::value_type(0x1555DA4CF093578BC7A49518F3A49A24F57760186FD02A3EEC3749EC72CF7AD1_cppui254),
+                            typename field_type::value_type(0x2AD97C4B04758DF61BF424363BD78665CBD24E20C13125BA2FC618312635A5DB_cppui254),
+                            typename field_type::value_type(0x0F6B80288F228AE9B8CBFDB06A1362C5B4A4FA81CFF38DFFB36585B871AD747D_cppui254),
+                            typename field_type::value_type(0x1385C47FCD92B51986C4EBF480519229AD13BB04255B24FFADF0D64A47C9C56C_cppui254),
+                            typename field_type::value_type(0x1B5E107AC4E88BA1F6FE66FD02DFFA0211CF505D105647ADF3ECBCD475E22840_cppui254),
+                            typename field_type::value_type(0x0050DFB3D23FCC83FFDC70E887F8099F9FC591467A67EB7102DCDBD40490E48C_cppui254),
+                            typename field_type::value_type(0x1A9949143AB3DD3BF9D5683F5B5600A0E90C266F5B91634A9A2AFD8D523428DB_cppui254),
+                            typename field_type::value_type(0x194ED40353D0E3FB0983152B872766AE5F1B4843CCDF294212A22AF910755911_cppui254),
+                            typename field_type::value_type(0x267AFF505F0D68A76EBCB094B24DF86EC272309368B812AF86FA0BF390D148A9_cppui254),
+                            typename field_type::value_type(0x2E41949408BF7787F362438D69E85ABF41E7D01C0A34854337AE88CE9F7D5340_cppui254),
+                            typename field_type::value_type(0x1A22CCC9A618A7BC4AE95AF6616D8BFABBE854193488EDC94FB4E9B843E261D2_cppui254),
+                            typename field_type::value_type(0x0AD763895EF6E7B6109953670EA24673C561C9D674756B9FE54EAC90283A2020_cppui254),
+                            typename field_type::value_type(0x0A91710EDA06952B66B197854E163636212FFAC5C2028C698E8D626F2B4564AB_cppui254),
+                            typename field_type::value_type(0x2988A100D6206783918F60942552366B19A5BB333F3681A753847629D349DC4E_cppui254),
+                            typename field_type::value_type(0x1EAAD7216D6AD125184996B7BCE5B6999E7E8D0725E5F729F496DD1E3117D652_cppui254),
+                            typename field_type::value_type(0x2C87079E8DB3EBA1A27B14612B8F160B5A9452AF0E76B942F61259A4119665CB_cppui254),
+                            typename field_type::value_type(0x0A26589E75263127C006B16E4C34DB58765013D73C48A13C269B75E0FC34DAC5_cppui254),
+                            typename field_type::value_type(0x04F1CB752254CE1C92B01B10A5AF73B1854C2C62841DC824781CAAA56DDB87F1_cppui254),
+                            typename field_type::value_type(0x2511226C45E2074E814BEFCA9728E74AFCBE0A2DBB8DA9B61497527F7DC16FC7_cppui254),
+                            typename field_type::value_type(0x1726C1DF54AD0C394C53DBB2DAA6B525D5337201F18CE540686AF4310676A873_cppui254),
+                            typename field_type::value_type(0x1EC01458207DA40EB3B8483934F1281939E93FCBF8727A81EB45584ED2A3F61C_cppui254),
+                            typename field_type::value_type(0x0E91046D817FAB00D906A1444270CA97F33F44B8D065003114ABD8743E2844D5_cppui254),
+                            typename field_type::value_type(0x1D8571D3FB3684EEF59B4E8CDAA8960AFA776A2A609914C22E14BFC22BC074DC_cppui254),
+                            typename field_type::value_type(0x226C0947127B57567BC20C26508A688B2361F752EAFE0072C005E589D8B9EF58_cppui254),
+                            typename field_type::value_type(0x2DCFD6B7A3CB9423A68CA27D4E288F84067D1BCA27AB18FA9A7B1C3CDC0876C3_cppui254),
+                            typename field_type::value_type(0x04B7A8CFDE262951707A6A8094579FD67917C376C6D205CAD273B3C8B5674078_cppui254),
+                            typename field_type::value_type(0x03C286AA526B8C88972C8ABF103BE8B38EFE23C8FD99F09CCE780D1656B4D637_cppui254),
+                            typename field_type::value_type(0x2D4601B78ED24B2A6DCB7579116BB0A8E76637B7F4648327B091DA7401FCE984_cppui254),
+                            typename field_type::value_type(0x05E7918FF23864CF49F9E1032FA632CBD2868E6F1FE483726DB27C53B1FD2038_cppui254),
+                            typename field_type::value_type(0x12F4C31125704A75DA3689B39EE5EED11B62BD3CFDBAF9328E1DD12A3A3B9C32_cppui254),
+                            typename field_type::value_type(0x1CC0FFB74FB1E75C067061A35B0685A53C5B8471EBD9CBD79B532249E02DFEF1_cppui254),
+                            typename field_type::value_type(0x1144EED8752DAAD82CE8C81C75D13E91C2D8A1368D8B7AECE378BDB8F553F7D1_cppui254),
+                            typename field_type::value_type(0x04D8B0B771A46FF8F2E0C18454B643F8908A5B96DA44713263EAA0E7609149CB_cppui254),
+                            typename field_type::value_type(0x01E6C7691756045003FD35CF5D449F1BF0C68B45B34905ABD5FBF2D944251616_cppui254),
+                            typename field_type::value_type(0x2C808764B3C2D8BA8B949A9F00EFB3BAC79481195CA7E34A146E913AFF89859C_cppui254),
+                            typename field_type::value_type(0x2846B54C3B22668DCBB8CCCAAE457E53D8B6F5CCAC2B48128FC73C254C5E59B0_cppui254),
+                            typename field_type::value_type(0x276F519936BE5B3E2F91AFC073E810E20473B09E963BE92FE55AA82400EB9CFE_cppui254),
+                            typename field_type::value_type(0x0A245EEA0E49FC2465F2B7CBF900B1D7BAFD5621EE61A0FD1ACE3804F16F07A8_cppui254),
+                            typename field_type::value_type(0x1702AA25BE49F75A0E44540748353DA79B4D44ED6FE4D94276F0092AB33FA311_cppui254),
+                            typename field_type::value_type(0x009BA7FC0C9257B32D14EF83B0B43EE1B4C875D4DDB70A1F8DFF121BB0738D5F_cppui254),
+                            typename field_type::value_type(0x0E3B10575559F366D81F1B0076B0F2A8E57C4D11D5DABA688A1926E17F22054B_cppui254),
+                            typename field_type::value_type(0x13C40459671661009D3C4B96656D1B45323F55B2FFDB3955ABB87FBDA4EC58C3_cppui254),
+                            typename field_type::value_type(0x0F9DFBEFB0E64CD8A8F1F7115F559204D9BFF59DC41AAA443286B464E4A4B3B8_cppui254),
+                            typename field_type::value_type(0x03BC470972607ABAEA6CC1E2E03D13FC3CEAD183982EF5F10C11442586EE87BC_cppui254),
+                            typename field_type::value_type(0x0F1BC66F6E1ECE1FE8BBC4B450C3D1F649D5AF6981BB9C85091A8A46D4A1DB25_cppui254),
+                            typename field_type::value_type(0x2767D4152E3B2A1EDA07E6F24B7BA67D74FC4A4EF600E73D5C9804013607B3FF_cppui254),
+                            typename field_type::value_type(0x025D70D9EF2434AFF33E7B2360D96D53D555591F58320B4D5AEB29499356155D_cppui254),
+                            typename field_type::value_type(0x2C8474246FB806DFD385F8358E4FE95F68FAE97018D7DB1A3FE43B670197D296_cppui254),
+                            typename field_type::value_type(0x2D8AC3B14579252521443A0709069529E88578810F1C6CF4167F595F17C301E4_cppui254),
+                            typename field_type::value_type(0x1CE9E693F0718940F328281F33872BF77E5160C73C0A6068E8855E4716316099_cppui254),
+                            typename field_type::value_type(0x0869D2297C13D0E7ED693BB3EF7CF72BADE1C34DC9936633B458571BF7231764_cppui254),
+                            typename field_type::value_type(0x25EF45E9014757EE53971D76A5C50E5B57B3DAEE31AF4BE46C9CD3D7A382068B_cppui254),
+                            typename field_type::value_type(0x286B42C7D1CFC3387BB75355B59ECCCCDDC593BA7C375C5AC7E8286AE03843E0_cppui254),
+                            typename field_type::value_type(0x0BBFCC7B5EE3C594A56C5E614F998109479C608303B52D08ACB977979B764688_cppui254),
+                            typename field_type::value_type(0x2FDE747E0860311BC0827CD74427942325F7EC514365F6E16CDFC3DACEEAFFC4_cppui254),
+                            typename field_type::value_type(0x19BAB36BE51F69EF46DB70C779126DADF51C2C4E31ED48A1623CEBDCE336B5D4_cppui254),
+                            typename field_type::value_type(0x2854D9E8B595428C2ACCEF0239BD031A4A2F37D751F1A992DAF66E653B585686_cppui254),
+                            typename field_type::value_type(0x1CBD278367DB3E2BD258342277EF0D6ED0B53A3C061EB834F33003EEC9D8CA2F_cppui254),
+                            typename field_type::value_type(0x0158A7DC85CE07E5740953FD24BEFF782BA56E454FABA47446B7E531DF13A00A_cppui254),
+                            typename field_type::value_type(0x12567BDF221A80B16EF51BC0CFA9DB5B9E906A9495C147923515814BDEED2400_cppui254),
+                            typename field_type::value_type(0x2C13612CF5EAC20A37D72B54F73B0D2D3EBF53DF11EA6BF269492733BD593336_cppui254),
+                            typename field_type::value_type(0x093327E4F4A8DFF95DC43D5E0A52D98F8346901170BF79567BCE0E7F0B597191_cppui254),
+                            typename field_type::value_type(0x2CB192CD5D5B62BD23AC0AA2B7C12F597DB41B87B05B92C655FA4CEA4DAE0628_cppui254),
+                            typename field_type::value_type(0x1CBC558D34B723EBFA07C9630C96E81C74576D141801165E4710B5B0262C84DB_cppui254),
+                            typename field_type::value_type(0x2D4D9BFE1A7006A4EAF94FD681F467719A68A8231B6B46B496601A34CD8749EE_cppui254),
+                            typename field_type::value_type(0x22E1B18187F92EAB791A18A17BAE522F674D76EFD8C7188A18C9397350D25421_cppui254),
+                            typename field_type::value_type(0x0AD500831E4522A7FE456BD44967DBB8F56B3A7F36AC51AE95C3CBEBD4E0CA7F_cppui254),
+                            typename field_type::value_type(0x06B3C6BEC4D1982470C5F1A033E43FCA9CF142639D8D8C1E08E0390A4C5A7DA4_cppui254),
+                            typename field_type::value_type(0x1DE78DA2BA6A6E08B0B7F5A22BD59FE91ABC05909196640E50E1D21741A4286D_cppui254),
+                            typename field_type::value_type(0x047BCBE78CB3E97285171C7684145530E6D7959CBF0E79E65A034E1F2D1AC655_cppui254),
+                            typename field_type::value_type(0x0597DF8D7C34651F98D830C1F2E0517E006FE977E205187ED739F9CF3A532F78_cppui254),
+                            typename field_type::value_type(0x18AFA4A6BF750334EAC73D2F93349A25819827C4F2E3B42CE8144F0C090E1B12_cppui254),
+                            typename field_type::value_type(0x2BDE7825DCE391B931CA81EE1139E6D76760072C81BA53DD2DB24DDC28694E92_cppui254),
+                            typename field_type::value_type(0x0E076E309F6DD06234A8F993970799B481DC08D2386AB695AD2D1967C670E73C_cppui254),
+                            typename field_type::value_type(0x04F6CB15833B7E499D06E5BF7DD24C878067938896B095C47B9A1CA11DBB08EE_cppui254),
+                            typename field_type::value_type(0x278BA2ACF542780385C3B974800FBC69381B36319D51B2258224F6AD80B31FC8_cppui254),
+                            typename field_type::value_type(0x12ABDC166F0FFE9127706627F2D10ECD824DF3FB737D54F1D0363EFF9E3B7ECA_cppui254),
+                            typename field_type::value_type(0x1BB309B0A6AF82B049A4EA3E04EE0EEB30C557AA736090A32E574F58DFD595F1_cppui254),
+                            typename field_type::value_type(0x0493E88193D00824DEFE26B1C527BEBD734A2C3A6F723DA9CFD948B6B9E928F6_cppui254),
+                            typename field_type::value_type(0x28234F55A1EF2D10C29341F59BE69A2090C49B57BBC64A58809D4D4B9A050326_cppui254),
+                            typename field_type::value_type(0x0F0D1A871D0F58AE80723F19ADF08B8B04A9B11A1F0FB7C38C1DFB3B830939AB_cppui254),
+                            typename field_type::value_type(0x1F87EB4ECF4979737F4CE5493A5D744349F50675C1E169BBF31689C3E8C04308_cppui254),
+                            typename field_type::value_type(0x23D45D0CC26F83DA885D957417F958F48D15AFE583412DF36FF2C46B0FAE6198_cppui254),
+                            typename field_type::value_type(0x265FE341276BA4EF03A3E1632E3EACC3C77AF43355915017604E3297A2575E0D_cppui254),
+                            typename field_type::value_type(0x2D96EBC6D29672F1FC80D5F711EFC24B099D9E5805D6052DB96DC6BFE58E8516_cppui254),
+                            typename field_type::value_type(0x195FF47A5BFA22EF899D6EC9A7AA8CAEFF7A211A28347BA49A994FD436175C01_cppui254),
+                            typename field_type::value_type(0x1DF839472E127AC2476882F51AD200ACC02C50DFD39113D22BC3C2208295BFD2_cppui254),
+                            typename field_type::value_type(0x20ADF422BB92E8EBCA244338030FFF6E5750B73E3B59BEF4CF27F9B8B43D86CC_cppui254),
+                            typename field_type::value_type(0x046D604BB8BA0F91062A910941F8640C12FEE8AED73E49F47364DE3375B82881_cppui254),
+                            typename field_type::value_type(0x181684169436082DC4EA9918EB0CC87B2B8CCC230D78D50D8F1FDBFF6A37C445_cppui254),
+                            typename field_type::value_type(0x29C7B02D035DB0D3D1895DBF8F2BA8CE38B18756BA54821C95511A96DC2DB335_cppui254),
+                            typename field_type::value_type(0x134B67C1908FB07CF662248C59B6BAFA1258AF4BF7EEC0310D5F2920ADBE59DF_cppui254),
+                            typename field_type::value_type(0x11F2C57C462F2F785EFCE7FA3D627C3143F6B3E7365969C5ED2D72FB2C2B3CAD_cppui254),
+                            typename field_type::value_type(0x1424F43F285B8D9F4EEE88E5EED41B988FF83E2BB0213896B48DDF0724E2D137_cppui254),
+                            typename field_type::value_type(0x0454C73F69F0A585D1C3E1731856A04D5D9AB605E0FEC145FFD2A754444C6D21_cppui254),
+                            typename field_type::value_type(0x1B8B0974839D00FCB8CE8411303DE0A7C1EB3A4FEE51CFC81BC5555CF11E72D1_cppui254),
+                            typename field_type::value_type(0x10F9785ECC740F71E35AC4BB5667D868C7E0F41D7AC008FE1002B98C74A13550_cppui254),
+                            typename field_type::value_type(0x17804F51D82CCACB1F5C235F9229729042BBA8586CF4439B4DA2BF3CE9E3C6B4_cppui254),
+                            typename field_type::value_type(0x04F911EF9571AD0F05275041C06FB56DD3AE9D6CA9FAF59A98329140274DD0E3_cppui254),
+                            typename field_type::value_type(0x02FCF22A313B481313F27289A45680AAF8805FE788FBDEA9964BEE963B47BBD6_cppui254),
+                            typename field_type::value_type(0x29A1C6FA0C3CC610D930EF1748FECC57AAE4D9B73762168AF70432D5300ACC6C_cppui254),
+                            typename field_type::value_type(0x1F64BD8377040C444F5B9536A798DF2093D5AD49F579DD6297FF8C5937966875_cppui254),
+                            typename field_type::value_type(0x09167914D3D2A70FDDADCC56AD6A38789B18543EC9DCD793F8D2AF6D53A00A78_cppui254),
+                            typename field_type::value_type(0x19D7F00E9DA0FF3C5E36640D537DC9D8B297918680F8EF92EC5FB5C237E71D94_cppui254),
+                            typename field_type::value_type(0x2B1AAAB94D44134F97E647D973EC4F5DB5627E6FD219F3F3F1E08F487F0B088E_cppui254),
+                            typename field_type::value_type(0x1FB346F073ADE80FD3E818E928D4E799CF15F660D08C024DF6B35A9537525F7D_cppui254),
+                            typename field_type::value_type(0x06960F0264D32B68392926344332B7D19CF2810D737D1337D898EAD6761B41B0_cppui254),
+                            typename field_type::value_type(0x1388295FC1B525032430515B0D062FB5C0AEF4B8F890F5DE8B469C1E7E596718_cppui254),
+                            typename field_type::value_type(0x12BDDFB87974999901BA6A5A8E82608DAB01460FB128A67BC6E3B227A99BCFA9_cppui254),
+                            typename field_type::value_type(0x19A3A471AD5C866C9D047B7E0F480C484C5BA91D00535A19D88BD8A01791C14E_cppui254),
+                            typename field_type::value_type(0x1549A68F4650BD7537A3A51D953FBBD5D1FC13EA862E8D526DF39331305A478C_cppui254),
+                            typename field_type::value_type(0x1F84C3BE21EEDC0A6F3A0E8ED81866D2517D1EE09FB86A51601354CBC282C9AE_cppui254),
+                            typename field_type::value_type(0x08B172A26E838681D0C4D3CFB013ABF392141EE2F871903F94966AB2E7C67995_cppui254),
+                            typename field_type::value_type(0x1803F42B6154C73DF3776A86DA598B72C820E0A39058A6272C97EC432746A253_cppui254),
+                            typename field_type::value_type(0x11E4372B105BBBC4EE89496343EDDD5F299CA4199190455953E6A4D5D0331172_cppui254),
+                            typename field_type::value_type(0x13B103F06DEC9EB67EEB1252F52E8FF88C2164C330742569BA6C0C1D79B43D58_cppui254),
+                            typename field_type::value_type(0x24983F8C5D29BE49C03A61673AA24B73B20F790D821A1832B61276203854ED41_cppui254),
+                            typename field_type::value_type(0x2713A8BD2723B905705CCFB3CD75B56CC502A285FAAF4C43205C9F92E72E8FA1_cppui254),
+                            typename field_type::value_type(0x0D378F0B85040D27DE641D40B61D89E027D7C05E2254B9CA3F225F0C330B4823_cppui254),
+                            typename field_type::value_type(0x2E1389CF976EE7D9CE2992C62C6BBD5268B1096F6E89C6870C25A4737C154FD4_cppui254),
+                            typename field_type::value_type(0x2026565ADD482C9E333BF0F03CC1A0E6DE8A45E2FCC79F298F1588852EBC239B_cppui254),
+                            typename field_type::value_type(0x07DADED2E506E59C22C6CE5006B5F3DCDD7905C422E1A84BB9362F9097DD145B_cppui254),
+                            typename field_type::value_type(0x2677B3FD9A60B4B66BF979229EDCBC0746114EBC6B1BF5B716D9C00BA62560C5_cppui254),
+                            typename field_type::value_type(0x0823BF09A4457C6C2459D4D3DA532DD5B8FF800224F23DFB7C99A437864F1164_cppui254),
+                            typename field_type::value_type(0x03C8E5BF55B05E8ADB224E74C980F3298031503664DC6DB15ADB8CC922DFD9F1_cppui254),
+                            typename field_type::value_type(0x2AA6614C1E3D8EFEEDB615D988D9BDB9F4C791FCF9640FDEFA4A822E47327703_cppui254),
+                            typename field_type::value_type(0x06349A25491F17258A72D87AEDB0B0B8A103FA61D9F1D80CCF178168B650C1A3_cppui254),
+                            typename field_type::value_type(0x27816D71C08DDC593972E5D647880EB1C9FBA52DDC130629A4867EC559903E7A_cppui254),
+                            typename field_type::value_type(0x2D4342A5B94A716D13DDC4E034263D2526FA8F9DC4672B0490D326A0B2C24104_cppui254),
+                            typename field_type::value_type(0x03E8748E8AA834F74F78325F4CADE8BEB5B2CD987E003DD2E01CA1E507B882EA_cppui254),
+                            typename field_type::value_type(0x14E84A9B617BC3BBC51C7580AED6AF624F108084AAA51C57C0F6BB42966A06E3_cppui254),
+                            typename field_type::value_type(0x2E0333E017005D5580D8F37930910E83A4EC1CBB81513D5C4497E07BB4759AC3_cppui254),
+                            typename field_type::value_type(0x2EFA0D2056E33484BFD0D28038A697B52071AE3DAAD55E734C4F1788BE4E26E0_cppui254),
+                            typename field_type::value_type(0x0D6D0D071E4E0BFC592A5B2CCCDB0A26105387C373440CDD24B7DD545CB17071_cppui254),
+                            typename field_type::value_type(0x0A7CDF1674FDE22AE3880C2ED553EE3CA1AE44B9C8BD6FC7ABCD5CE18D9714CD_cppui254),
+                            typename field_type::value_type(0x066DD4F74BDE89AF1E484EE7999209DEEC62204F6FADFE137A007BD1B8A41322_cppui254),
+                            typename field_type::value_type(0x1FAFE097739D80D7254BCB0604D47A42A19606E61A5C9464B74C343740615C6D_cppui254),
+                            typename field_type::value_type(0x2EE84770C1E2D06D9E6E097B8FE947A0CC08DCE9756A2E9D9DBE08136550D3B8_cppui254),
+                            typename field_type::value_type(0x1E5E606AF401C29D6EFB6E6A363D30764617CF03A1CA704BBF4F67FA61D57113_cppui254),
+                            typename field_type::value_type(0x0F332DAE76F658808442827049F0F8C0734865DD291C1A54B97E23C538895D3A_cppui254),
+                            typename field_type::value_type(0x174469B5B7902F5050FF4FEBD3E8E014251117BEE0B299E72F7630544A4A93F4_cppui254),
+                            typename field_type::value_type(0x1C4112F5EABD70085A048762EFB7496D043EFC1E1AE5A844E18C2611CBF7647D_cppui254),
+                            typename field_type::value_type(0x2D9EC039EE9899BD3FDC3756ADA1E433BA2F27AF324C744C85C06C1854CEC6ED_cppui254),
+                            typename field_type::value_type(0x0D3ABC9D71DD3D76EC536FDD34C3D535CCD3B2C92E344B04EA63E7A95BF1D40D_cppui254),
+                            typename field_type::value_type(0x004E2D118CD7C19F8B38B28570D982BDF9398EC57FB2BB0D7E8F31E4C8EA3A7E_cppui254),
+                            typename field_type::value_type(0x17A6C2B336D61BF255AF78C33A67CF1DE2896995DF7E83F8241109A184DBBEA7_cppui254),
+                            typename field_type::value_type(0x123D241884DE16C8078118CF8168546668A7C354C1AADC61505121F1C69318EE_cppui254),
+                            typename field_type::value_type(0x0A86BD18C2E2DC328A7FFF99345D131988BDB003F53487DA1D9AFFD07DFA4CAA_cppui254),
+                            typename field_type::value_type(0x270232B8AA979307CEF134BE75F5D025D01C3C6BA2F66499E3615E5B2DD00781_cppui254),
+                            typename field_type::value_type(0x0BCAE083291104DA390253F9CACDD4DD56DEFA3CA2E81B6F09B99A05C25A2296_cppui254),
+                            typename field_type::value_type(0x1E06BF56A7F6347B82795DEE05F866114F2B45C6367E1A4A4EA04EDB25FC252C_cppui254),
+                            typename field_type::value_type(0x1E355FCAB47DD4264A85652319A0DDDF1BA3889EAAA9E05F21247E4202BDA1A5_cppui254),
+                            typename field_type::value_type(0x0D60A88EB2F714752B7AECDEB65939828FAA6E1E38E8EA1606A7A15E71E7A194_cppui254),
+                            typename field_type::value_type(0x1D678F7B16A958CC0C67473C1C4BB0624196E50B7295611351C0883888A73FC7_cppui254),
+                            typename field_type::value_type(0x038EFC5DCADE061BD177CA43227123B32807A9508A4BC8E7BC3890E9CB0A5252_cppui254),
+                            typename field_type::value_type(0x19C824D79C760BA2D0D27E8F543D1FBA7A484258EB1AC0A98350750A296E889F_cppui254),
+                            typename field_type::value_type(0x1C929C023377E5E4656C17A827A9EBC1575753C2C63026EBCAED1F97B074E6E8_cppui254),
+                            typename field_type::value_type(0x14D980D95908E9C75B4479B8A080D8FDFECB5B2BBA8A5C80FF802263243C6640_cppui254),
+                            typename field_type::value_type(0x2032C5FDFBC8D86801D7EE742496DBF85B1A0518FE4CA245BE2F598BD70F306B_cppui254),
+                            typename field_type::value_type(0x1EB1BA9D3CB37F1E320B57A13707F1B4B40333E1D9893D2D9C6012F5667001C9_cppui254),
+                            typename field_type::value_type(0x0C1DEA44B0E7BA28967FE607C50F983C3BDEC527612E81245029958308F7CBBB_cppui254),
+                            typename field_type::value_type(0x00DCD731A87DFAC8E27719ECBE1098C415477FEBD6F06A227FB45F0B8B0B16D9_cppui254),
+                            typename field_type::value_type(0x27218920B62EB55167704AA95C9929A79EAD041E57E1F26D5F2B3AFFA474655B_cppui254),
+                            typename field_type::value_type(0x3058FE52FD5EA77191ABA39E84854D7D3F317390B1D869536D81544FAD1A7E7F_cppui254),
+                            typename field_type::value_type(0x1F64FD77C47FAD6766218A0CA3E9B34B6207ED59F8EB2F902E1548D156584A90_cppui254),
+                            typename field_type::value_type(0x1809DA3601C46BA59DE5FE42E07B91652F04A7E773D0AD7D9FF77AC4FD98720C_cppui254),
+                            typename field_type::value_type(0x285AFF2EE43A3C5D32A06683D6E410810B16D6FE2D2C6D5D339E0B331DF06874_cppui254),
+                            typename field_type::value_type(0x1B5956DEED90482C1CC4989E936CA265252D6DD8159A13270B78248B30843363_cppui254),
+                            typename field_type::value_type(0x072FF5F961D1D225DEC43BFFD5F031562C9087A3A032305B1B716CDD158DA5CA_cppui254),
+                            typename field_type::value_type(0x2D56A24584F64ADB487D3B22D20BE25B0FEAD092BC22974CD55D405F0E893019_cppui254),
+                            typename field_type::value_type(0x04478073FA9B5A4016A9DDF4B3790406B9291AF002796ACE0FBA4A6991866A4E_cppui254),
+                            typename field_type::value_type(0x0561A978DE4CB86DA62179A78AB65F31852E41FBD245EC0DEEF8AD6B5B56C0F9_cppui254),
+                            typename field_type::value_type(0x24254BFC587342CB3D705C31B46B3353A1E2F72073811750D36F726CFA8FAB59_cppui254),
+                            typename field_type::value_type(0x1F57501EE2295EB90A7AD72FFA73433BF13BDEB153FA05C848F12DE2AADD3A57_cppui254),
+                            typename field_type::value_type(0x2D882AF317FFD9BC3EC258500697939ABADBFE4A93951B1C4170F8BCADC0CBD6_cppui254),
+                            typename field_type::value_type(0x1EE79768B58B0BBEBF614D41FCFD9E17A88C38B41D697A2104A931A3CF3106D6_cppui254),
+                            typename field_type::value_type(0x2AC2A26C534A3A84F696DD581EE7063F8910CA58954E436470D1FCC17DBBAAD2_cppui254),
+                            typename field_type::value_type(0x013932BE07D7EF64690655FE3541D25B47CAA20F0DBA7E5843DC309E47FD4036_cppui254),
+                            typename field_type::value_type(0x068DAA9F3433EA9CFE8AB217593263464D3F3796D224D0C837CEB1BA5A388B5C_cppui254),
+                            typename field_type::value_type(0x28982C2DB4C7CC3F0AC38AE0D7A1774E276872FC2FC9BE7B97038D1B7DEEADAD_cppui254),
+                            typename field_type::value_type(0x00FCD19A4ED741EAC34E323909B7407F5A612A101C0D5687EA381BD36FD92D2C_cppui254),
+                            typename field_type::value_type(0x1DD91743FBF961091F53CD0ED3D5B4A25311C972964946D0E0BACD6480FF3656_cppui254),
+                            typename field_type::value_type(0x1433932BC97CC106A9E8521E7F364AD85BEF4FA4CCE6B086EA08AAB8386820D1_cppui254),
+                            typename field_type::value_type(0x233BAEE1BAE9440F6456B6172B7B08E3B659265362D198E5196EF41D3A2D4B5A_cppui254),
+                            typename field_type::value_type(0x2EAE64AE6C81702E537C49C50C434556A49E9C734BF59580C86F19F2A0FB3374_cppui254),
+                            typename field_type::value_type(0x1DFB73B21D54701FCB4BC042FDDF84707C359B901744314608F2C0D3626A899C_cppui254),
+                            typename field_type::value_type(0x286C31A3953B927AEF3A17593E9693E2794CD653A59E9D232A798796EDAB03EC_cppui254),
+                            typename field_type::value_type(0x153C627915A904F05776B9844FFB029D5F05CA4700354BFC08595F2423BE4D18_cppui254),
+                            typename field_type::value_type(0x20310CD1B43AAB7D4B58FA0D698972808089ADCEE446FDFD93A9FD6502DF3076_cppui254),
+                            typename field_type::value_type(0x1A5A0A187E4E4227EE4EC14CC0721172ED49CA6B93E6247D3E001E55FB8412CE_cppui254),
+                            typename field_type::value_type(0x246EE7D08118A4E2D6A00149135A8713D6A0532B1398048DDDF646C97DBBA1D8_cppui254),
+                            typename field_type::value_type(0x2D5968F58C658153EE254D4BDED6784E5E057251477B539A6D91F087985338EA_cppui254),
+                            typename field_type::value_type(0x0E0D8224D8090E8F7958BF46EA5F8D2D02370BBAB1F4A449E50FEE36E3F70773_cppui254),
+                            typename field_type::value_type(0x282BA63C4D8D5C9D2477AF22FA57CBB3618501DD22727C2A3244988179C98D2D_cppui254),
+                            typename field_type::value_type(0x17957E0D498BD3694C8E62242BC37535CD445BF2A773AD9443CB3771FE113854_cppui254),
+                            typename field_type::value_type(0x156E5523EFB7270E38E80E154849F705A6184365B2261F3DB870014428425D83_cppui254),
+                            typename field_type::value_type(0x2A5E19CD3FAF740E1F3EC427897C8DA2804B0479BAD28CE00AE15B088B04038B_cppui254),
+                            typename field_type::value_type(0x0CA244FF2509E32D00B949A0D9A1EE3FBF7BEA1F4FEAC762F56A457B9CE1E30D_cppui254),
+                            typename field_type::value_type(0x00DA0914CE27DE483F0338AF35B9E110A78F3F6C7A620344C7E5482DCBF19868_cppui254),
+                            typename field_type::value_type(0x07EDFBD9CB99499052ADA8D94E740625888F260ADC45FCB5FE9BE555B3221D74_cppui254),
+                            typename field_type::value_type(0x1FD8C3A97911B6EAC726E002FD3B84ECEAA2B08A57E3DF4227067FB5896AAED0_cppui254),
+                            typename field_type::value_type(0x14892D88613BC7DC3B09FC7125A188FCFA5941DC3B2D90F5F3735D965C03F420_cppui254),
+                            typename field_type::value_type(0x23EFEF7D4AD61BF42F5F983D2155CF533FF4808DD53E94F8AAC160C0E4AEA3BD_cppui254),
+                            typename field_type::value_type(0x23173C72A07638938CB81A62D1E5CBFF91215D64DAC3B0B7174B65A57BBF4910_cppui254),
+                            typename field_type::value_type(0x0AFB226A547937B8D1E929CA0C7DE68E4FD691BA018BDAD0FD3A471A5FC591F7_cppui254),
+                            typename field_type::value_type(0x07DBD38FBF5B3EAAB70E86644CFE733D0A0059C09182C73C77E6B0D215F28087_cppui254),
+                            typename field_type::value_type(0x1678361A42071AE8713B6AEF9FAD1CD834CB591FD3DC1928EC0C5D3841B492D6_cppui254),
+                            typename field_type::value_type(0x1725B4A59EA736EC816444DC53DBDF7E78D9194D537FA199C2883A38C60A06ED_cppui254),
+                            typename field_type::value_type(0x249E0D5A519EF3F2AB6240ABA00E912927AD4151BE494765E2E31A1566828B06_cppui254),
+                            typename field_type::value_type(0x05483B9DFBEB5B9FB31FD52B885335DA4B23CDF83F2607D37E3FCBE112A85365_cppui254),
+                            typename field_type::value_type(0x24E0BA9901789EAA6A0DC74BBF22DEBF9891BC5C03991DB95F69DF9C25CA6FCF_cppui254),
+                            typename field_type::value_type(0x065A6B8B56220596AD72F24AEA44C1D62F4C1544F23D4E968112D3D57F76C9B5_cppui254),
+                            typename field_type::value_type(0x2D8D82657D6F9F9D5676CECE3B7547BE1B2AB34879690CD1D231716891525CF7_cppui254),
+                            typename field_type::value_type(0x06EB1A9A19E51D943AB9FC17DCE04FEBFE78262AA03CC1BE31524C0CE6F21AC8_cppui254),
+                            typename field_type::value_type(0x17A9EB0C1DE0729D14109C86AE1D8FE800F3AA57C86E98120B5AB94991BA32FF_cppui254),
+                            typename field_type::value_type(0x21F2133247EE84C3BD8C96271B6AD6482744B3367A13F0260535A908CAEA1D20_cppui254),
+                            typename field_type::value_type(0x085B3A99F7D8418907DC897428443FAE817137980FE5195974B11D212C6F2171_cppui254),
+                            typename field_type::value_type(0x27B2F4E5647C1192AB4D0B72A8BB6C5E84860D352974ED0BC11DF12288E6638A_cppui254),
+                            typename field_type::value_type(0x0B163E1EF2B9F4EA5CE342E166E05D88138AF074C2D33BEBD66D147950B6BF38_cppui254),
+                            typename field_type::value_type(0x194680013E0651292BF5E3504CBDCE31BA0D625DE486BFC2FC89590440D0631E_cppui254),
+                            typename field_type::value_type(0x0095985002AFDE44191D5930BAB4598F635A2E311E80653E1F71E9F29AAA4970_cppui254),
+                            typename field_type::value_type(0x2C8B83FD4E309F588BD8BDCFB29BDB43AD046458020B979C12D0655B07BB2400_cppui254),
+                            typename field_type::value_type(0x03917690D73BA7798957A84781B49A0E4DE3D2537E647ADA0BC1A4A87CC10A15_cppui254),
+                            typename field_type::value_type(0x29EED773ADAE30E41534A519179A5193ACE5C32048775A50D6E1A7F998C5636B_cppui254),
+                            typename field_type::value_type(0x187868B2AC41A139F3563229E0EE02D65D27E38DE3276AD2A4FD503C4F920010_cppui254),
+                            typename field_type::value_type(0x0EBF18CFFD536C5521028AEAB7AFB898BF91D8ABDE80F16A70AB404B49DDE064_cppui254),
+                            typename field_type::value_type(0x2558D4421DDF231CF775888494C86AC8883A92DF8B171DBC7E0F26978C2F1533_cppui254),
+                            typename field_type::value_type(0x09A5C6756CFC787C9DF52F40FA211EDFED26F0303BB2E404FA53D486A8EC7963_cppui254),
+                            typename field_type::value_type(0x28E47C414278B7F61D2E58077A5D6F12EBCD88950385108A733284E2861B8F81_cppui254),
+                            typename field_type::value_type(0x29A6ABB653B0249D6E9C1DED4EC818D609F4970D62D4DED56994EBBB74CD5478_cppui254),
+                            typename field_type::value_type(0x1A453097CCD3A3AFF6C81EBC3823FAD3EE54D1C297E47BE3D1AF4631CAD97900_cppui254),
+                            typename field_type::value_type(0x03D541EFE3A8777FD5CD6AEA697DC2F83706644289ADAA9380E68BC150476B0B_cppui254),
+                            typename field_type::value_type(0x23FD426DAA5672681E63F3C44963A131182EA5F8B9DFFC4E4067F321B77648A2_cppui254),
+                            typename field_type::value_type(0x0F34106838CA67637185034E741F59F5016B1CDDA98A1923136EE1AE018F2F27_cppui254),
+                            typename field_type::value_type(0x16DF1485208C3EDE9992413128552EAF6FFAA9FFA77FC728DAE15F5597507A83_cppui254),
+                            typename field_type::value_type(0x04E5E8708B5D101AC9231D42E09FE3F45940FEC3F82462322C79C8E42558EA70_cppui254),
+                            typename field_type::value_type(0x2ED91AD14B44A1C19643EF1DDB57D3ED68585B737BF42A3FEAEB1B485592FDD8_cppui254),
+                            typename field_type::value_type(0x1FAE38B4235827A7CE3FA2A47EEF7C4DC1C8EE3E1BC81E2E038D168D18141CFA_cppui254),
+                            typename field_type::value_type(0x254FF1C8B67D295F66DAC6536477D769FCD88A9FF17D50947799FD226325776C_cppui254),
+                            typename field_type::value_type(0x18BA548C687CB306F9996E95EBFF7530528177141EBD26680D2D994EA1F5B4DD_cppui254),
+                            typename field_type::value_type(0x1A34EBD78433B90B62760D37F89AE069A85651A109939E329A4F266CE94C9D64_cppui254),
+                            typename field_type::value_type(0x1D78954C630B3895FBBFAFAC1294F2C0158879FDC70BFE18222890E7BFB66FBA_cppui254),
+                            typename field_type::value_type(0x20481B2BF7A68CBF47D796F93F038986340F3D19849A3239F93FCC1A1192AFF1_cppui254),
+                            typename field_type::value_type(0x0D04E86A78A6BDB973E89C9B0826AA0D9186E806CEBE7812661AFD05FF82E351_cppui254),
+                            typename field_type::value_type(0x043057932C8628FD5077057EC8F60E8B13450A391B80D3A5D7BB825D71F11583_cppui254),
+                            typename field_type::value_type(0x2826A2DF82CD1E9BBBFEBB7A2AE28ABADBAF650552714A778BB2374AED76583E_cppui254),
+                            typename field_type::value_type(0x12C69208AEFE3A16DEA2B4E32C19153366267CDDCCAB22D7C78DD891B497AB00_cppui254),
+                            typename field_type::value_type(0x0074A13E640AD260A9757F6D4BABB3E21F1EBF2231B3FB3D3A83A415195B1E8B_cppui254),
+                            typename field_type::value_type(0x19A1200E86F5915BB4C16F3273D2F19A5BAE6FB80C300552AC594B5A039B6092_cppui254),
+                            typename field_type::value_type(0x125C2882514181C16CB993DCF5CC94CBECA77C6A0C7D4DBE35EF15535B8CEC56_cppui254),
+                            typename field_type::value_type(0x110DD535244E129107C71D69355B2233A3214285435EFAFFD657C5A262831C38_cppui254),
+                            typename field_type::value_type(0x12436D4A2DFCE19B97E1618C0AC96A31CDDC5C345F46FD999310C4E20CE409A5_cppui254),
+                            typename field_type::value_type(0x02B2B32ADBA075FE62FDC9D7B33B1E0BAF45D9AE17E0B20B6839BFED2E7D5ED4_cppui254),
+                            typename field_type::value_type(0x2A6E28E95DDB5A21D93896B0636103F6EB58CC221D45FBD3FDBE4C589B0AC3BB_cppui254),
+                            typename field_type::value_type(0x03DC566557A11C9B07F759D066B865C44A6DB77043C15DC26141025A6AA8CB88_cppui254),
+                            typename field_type::value_type(0x0FD5E76E51AE349F7CD5EC333B0E190B0B858EFEC89878D0E43ECEF8D9BCB9C2_cppui254),
+                            typename field_type::value_type(0x2993C2D3D6C91B49D79403B7360354FD5AFDC39813EB15EC47ECC78DFA6DA034_cppui254)};
+                };
+
+                constexpr std::size_t const generator_table_params<detail::alt_bn128_g1_params<254, forms::short_weierstrass>>::window;
+                constexpr std::size_t const generator_table_params<detail::alt_bn128_g1_params<254, forms::short_weierstrass>>::windows_count;
+                constexpr std::array<
+                    typename generator_table_params<detail::alt_bn128_g1_params<254, forms::short_weierstrass>>::field_type::value_type,
+                    2 * generator_table_params<detail::alt_bn128_g1_params<254, forms::short_weierstrass>>::windows_count *
+                        (std::size_t(1) << (generator_table_params<detail::alt_bn128_g1_params<254, forms::short_weierstrass>>::window - 1))> const
+                    generator_table_params<detail::alt_bn128_g1_params<254, forms::short_weierstrass>>::table;
+
+            }    // namespace curves
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_ALT_BN128_GENERATOR_TABLE_PARAMS_HPP
@@ -0,0 +1,1118 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_GENERATOR_TABLE_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BLS12_GENERATOR_TABLE_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/params.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+
+                template<typename ParamsType>
+                struct generator_table_params;
+
+                /************************* BLS12-381 ***********************************/
+
+                /**
+                 * Affine multiples (j + 1) * 2^(window * i) * G of the generator for j < 2^(window - 1),
+                 * i < windows_count, as consecutive x, y pairs. Generated by
+                 * "python3 scripts/generator_tables.py include/nil/crypto3/algebra/curves/params/generator",
+                 * do not edit.
+                 */
+                template<>
+                struct generator_table_params<detail::bls12_g1_params<381, forms::short_weierstrass>> {
+
+                    using field_type = typename detail::bls12_g1_params<381, forms::short_weierstrass>::field_type;
+
+                    constexpr static const std::size_t window = 4;
+                    constexpr static const std::size_t windows_count = 65;
+
+                    constexpr static const std::array<typename field_type::value_type,
+                                                      2 * windows_count * (std::size_t(1) << (window - 1))>
+                        table = {
+                            typename field_type::value_type(0x17F1D3A73197D7942695638C4FA9AC0FC3688C4F9774B905A14E3A3F171BAC586C55E83FF97A1AEFFB3AF00ADB22C6BB_cppui381),
+                            typename field_type::value_type(0x08B3F481E3AAA0F1A09E30ED741D8AE4FCF5E095D5D00AF600DB18CB2C04B3EDD03CC744A2888AE40CAA232946C5E7E1_cppui381),
+                            typename field_type::value_type(0x0572CBEA904D67468808C8EB50A9450C9721DB309128012543902D0AC358A62AE28F75BB8F1C7C42C39A8C5529BF0F4E_cppui381),
+                            typename field_type::value_type(0x166A9D8CABC673A322FDA673779D8E3822BA3ECB8670E461F73BB9021D5FD76A4C56D9D4CD16BD1BBA86881979749D28_cppui381),
+                            typename field_type::value_type(0x09ECE308F9D1F0131765212DECA99697B112D61F9BE9A5F1F3780A51335B3FF981747A0B2CA2179B96D2C0C9024E5224_cppui381),
+                            typename field_type::value_type(0x032B80D3A6F5B09F8A84623389C5F80CA69A0CDDABC3097F9D9C27310FD43BE6E745256C634AF45CA3473B0590AE30D1_cppui381),
+                            typename field_type::value_type(0x0C9B60D5AFCBD5663A8A44B7C5A02F19E9A77AB0A35BD65809BB5C67EC582C897FEB04DECC694B13E08587F3FF9B5B60_cppui381),
+                            typename field_type::value_type(0x143BE6D078C2B79A7D4F1D1B21486A030EC93F56AA54E1DE880DB5A66DD833A652A95BEE27C824084006CB5644CBD43F_cppui381),
+                            typename field_type::value_type(0x10E7791FB972FE014159AA33A98622DA3CDC98FF707965E536D8636B5FCC5AC7A91A8C46E59A00DCA575AF0F18FB13DC_cppui381),
+                            typename field_type::value_type(0x16BA437EDCC6551E30C10512367494BFB6B01CC6681E8A4C3CD2501832AB5C4ABC40B4578B85CBAFFBF0BCD70D67C6E2_cppui381),
+                            typename field_type::value_type(0x06E82F6DA4520F85C5D27D8F329ECCFA05944FD1096B20734C894966D12A9E2A9A9744529D7212D33883113A0CADB909_cppui381),
+                            typename field_type::value_type(0x17D81038F7D60BEE9110D9C0D6D1102FE2D998C957F28E31EC284CC04134DF8E47E8F82FF3AF2E60A6D9688A4563477C_cppui381),
+                            typename field_type::value_type(0x1928F3BEB93519EECF0145DA903B40A4C97DCA00B21F12AC0DF3BE9116EF2EF27B2AE6BCD4C5BC2D54EF5A70627EFCB7_cppui381),
+                            typename field_type::value_type(0x108DADBAA4B636445639D5AE3089B3C43A8A1D47818EDD1839D7383959A41C10FDC66849CFA1B08C5A11EC7E28981A1C_cppui381),
+                            typename field_type::value_type(0x085AE765588126F5E860D019C0E26235F567A9C0C0B2D8FF30F3E8D436B1082596E5E7462D20F5BE3764FD473E57F9CF_cppui381),
+                            typename field_type::value_type(0x19E7DFAB8A794B6ABB9F84E57739DE172A63415273F460D1607FA6A74F0ACD97D9671B801DD1FD4F18232DD1259359A1_cppui381),
+                            typename field_type::value_type(0x073EB991AA22CDB794DA6FCDE55A427F0A4DF5A4A70DE23A988B5E5FC8C4D844F66D990273267A54DD21579B7BA6A086_cppui381),
+                            typename field_type::value_type(0x1825BACD18F695351F843521EBEADA20352C3C3965626F98BC4C68E6FF7C4EED38B48F328204BBB9CD461511D24EBFB3_cppui381),
+                            typename field_type::value_type(0x072841987E4F219D54F2B6A9EAC5FE6E78704644753C3579E776A3691BC123743F8C63770ED0F72A71E9E964DBF58F43_cppui381),
+                            typename field_type::value_type(0x0D6A2B27F2DC2F80885D7B3679D718C03978C664236CEAE4BDB8A1A1F61D5C1433B538DDB43FEF229CF4B0B03FAD72E7_cppui381),
+                            typename field_type::value_type(0x131BEA4BC76FAD23BA9C339622DDC0E7D28904A71353C715363AA9E038F64E990EF6EF76FC1FC431B9C73036DD07B86C_cppui381),
+                            typename field_type::value_type(0x064BEF67CFEF93C7C9D3F971969F26E3983E9053BDDAD86E4A062D0AC52BA72EBE4C43DFB9B91C1860E1AD0346A34037_cppui381),
+                            typename field_type::value_type(0x111BB496153AA457E3302EA8E74427962C6EB57E97096F65CAFE45A238F739B86D4B790DEBD5C7359F18F3642D7D774C_cppui381),
+                            typename field_type::value_type(0x05120BF6ABDB2AA0B467BA483DF88A0745BFFEEFD606B6126813BC54A2ACD1A57612C32B3E7329A1E163F782A75A291D_cppui381),
+                            typename field_type::value_type(0x0856C31A50097C2CC0C9A09F89E09912C83B9C7838B2C33D645E95D0F35130569A347ABC4B03F0CB12A89397B899D078_cppui381),
+                            typename field_type::value_type(0x0333FB113323DBE3AACD477B9F49069A6380EC97482E5529F968F90ABA12050EF8F6C2639364C728DC1633151ADC38C4_cppui381),
+                            typename field_type::value_type(0x0FF7CC69F007F11481C91C6F9B20698998A0C2E9A2928BEC8EEA7507C7AD73A9D1D218CFDB279C4D2132D7DA6C9E513E_cppui381),
+                            typename field_type::value_type(0x0678D18594FC81D6AF7D3D86072EAA327D9D1599475C504ABA5033D99D55E0C84B9BE8CE0FD63DAE5EEF3EAFA55E8519_cppui381),
+                            typename field_type::value_type(0x154D0E0F7D368CD60BC3F47E527E59EF5161C446320DA4ED80B7AF04A96461B2E372D1A1EDF8FE099E40BFF514A530AF_cppui381),
+                            typename field_type::value_type(0x177AC96F93B81D6D60BC98CFCE18F2665CECA502A0E3F1225F52E00DA50C8550078614BBE02BCAB0ACE01C2DC31ECE53_cppui381),
+                            typename field_type::value_type(0x0B737F47D5B2794819B5DC01236895E684F1406F8B9F0D9AA06B5FB36DBA6C185EFEC755B77D9424D09B848468127559_cppui381),
+                            typename field_type::value_type(0x0048BA1134D9FFEB5EB19F7006B3C7F64704674DE5C9F2CBB52AD0278FF9D46E495B89DBB3189CD567D6FD160C676282_cppui381),
+                            typename field_type::value_type(0x0025CDADF2AFC5906B2602574A799F4089D90F36D73F94C1CF317CFC1A207C57F232BCA6057924DD34CFF5BDE87F1930_cppui381),
+                            typename field_type::value_type(0x00D39B79486E185B221147B7D85EAF2238D756842BD84F57C6F37542A047A44D0C06B5DE39F22721D14E54ADDECAEA80_cppui381),
+                            typename field_type::value_type(0x09843DC6497BB8028CDBAEA5C085B8E8C28BB5182CE691FA9AB5303B6792B2F5AF0FC8FE52ABB92C07AD5F4CF586C400_cppui381),
+                            typename field_type::value_type(0x1706760B494640DD33FA5A9A078727A04C402F1714071BF2ADA62EB4131718FC34864AEB9C27EEF1475DE5DD810D57BF_cppui381),
+                            typename field_type::value_type(0x11A18959B4F3C0B3DB6B411048D8B18EFE616C59255C6DC094B87921B5C3AC6A39E36AB3467C4E90DE42439A710F5835_cppui381),
+                            typename field_type::value_type(0x0FF2B9FD31ED9A6BA3B24C9B73841AB89CE95B417A64B935740F4DCB8ADD1DAE2A8DA3F64D6D503D47EDF022BEE3CF72_cppui381),
+                            typename field_type::value_type(0x0E0031515253249CC68E8FF6381C85231781F9BA5C251F8D663D634B461BC6A35ECCCD2938704D36CFD7EB7BCF843B82_cppui381),
+                            typename field_type::value_type(0x18A3F54484C881F70B94919888AB5546CFAC6E9CE1D3959EFAC2B2F53A5DA350016C10B1C3905CBE7A2DA5AEF1FE77B9_cppui381),
+                            typename field_type::value_type(0x0E595B79C88960452E56767F06DA82720800C888096ED9E5B6ED21E66AFDB847F165D63A2CD7A29FE8291A0C0CA5DAEE_cppui381),
+                            typename field_type::value_type(0x08B911C4165AA9BCB8CEB4E1D2AD2F42D76CFB10BAB56BB141D1D1FF085966FB2C8B6B82B6D8308DA4F3CE25B06DD5A9_cppui381),
+                            typename field_type::value_type(0x0AC41E01273BBAE5812D1B405CAEB37901BE626CA0DC544490E60BF4A9F6D31E1915D9AE88D8A5CA983F977EC4721A69_cppui381),
+                            typename field_type::value_type(0x06C65E30800A6245F0780CF57C104ECE2898C6B5949106B7C8ADAF90D3A83AA904E10A5BF974A8D30A4FCF8DA5BA9E97_cppui381),
+                            typename field_type::value_type(0x1242D6CCAA96691CA8266EB23F8F4C6A813F0F0323E3E99C459DE8E45B57D221A1711BD8C919234D2CF8BED8B098ACF8_cppui381),
+                            typename field_type::value_type(0x1100BF3DC5D06839F076E007B5C42DC0014A2235912799C1CEF1AB6187750C5A69F6382309933CD3B57FB192500F48B4_cppui381),
+                            typename field_type::value_type(0x0DEC245E630CDF805C86F14258CA0E24C8016EC11DEFB065D70AD9A8C6DEE38B26B2499A5CF1931EC65A2640ECD8424B_cppui381),
+                            typename field_type::value_type(0x0DD6493B2ADF30A6B449DA9DA51B3D00164D8329DCD3033791604B44173656FE41DBDC0E3BD50CDC00FA379D0BBE1420_cppui381),
+                            typename field_type::value_type(0x156F2F510D8E6ACF438600F0BBBF8B6C96E31183ABADAB8ADB864D76DFB209BD3CEDAD07D188BC53EBCAEF76EEB368B1_cppui381),
+                            typename field_type::value_type(0x041430E5A4FB1337D1E4ED56D68C874AEDEABDE84302BE3D1D9E67F5CDEFE0CFDD299ED3AAADAE7C0D0D534CA8108A7F_cppui381),
+                            typename field_type::value_type(0x1664301DFCB940539B336E6B21C156CDA3C8A63847727D37491A892DB7F4F2BB9FC9730163254E8BD028B730C8B39309_cppui381),
+                            typename field_type::value_type(0x078660AD0DC67D15BAE92E76CDFF8B8262CF78C7180A7F1817FAAB792EE7A8B309150DDF84D53B9CC9301AA8B5EE76BD_cppui381),
+                            typename field_type::value_type(0x05831CD33EAFFB906BEB312DFB6344F3566B3A130E0E8485B7B7B4DFC37B735B43ECCAB8E5E1F362B4764836AAA80ED2_cppui381),
+                            typename field_type::value_type(0x147FA7EA3A19C4A5D1E91E8FC89D4AD80E9BED9B57007CA58F5684F7ED72D27B836C6E54EBD090F0E728BFFC33312CD5_cppui381),
+                            typename field_type::value_type(0x05B360B364F081836261542B2B89EFFD6A596EC8B34FD330A80446D64329BCC8C74BCE9DB9B5C6ADCAD5F70E3B631BB0_cppui381),
+                            typename field_type::value_type(0x0D2C03C36EC4CAEC31697BD5FE24707C38C1FD9272BCCE9DAD6EE56225F43CA45B3E73EB9038A38723264B2C2CE68B9F_cppui381),
+                            typename field_type::value_type(0x102B380B6B7D0430B350B9E98DF880B4C4F14555F5F5CD5BD2580A4F04C774257E7192D58B54AAF24FD68F205850E84E_cppui381),
+                            typename field_type::value_type(0x02E8933A8CB42489173CB0AC446BCFB6E05B7F63B260AF13D1C24CAB251409F17C3DDEFB4BCBBD8A10F705283BA19B40_cppui381),
+                            typename field_type::value_type(0x1606CF1802BE2719A43757D30E089B897C523454D55EA62CD4D565D93893F5DCD2B97B31F9D4A5490D70B928AADD9736_cppui381),
+                            typename field_type::value_type(0x09DEC351ED48154D2F3950CBDD91153E7828EEE5CB75BDCF5E18A47DCC29CCC9CE68594FF4C2FEF8F061F8094553E2A4_cppui381),
+                            typename field_type::value_type(0x004EE0C8104F1C13D1029F14DB60AEB8626F54DD782E36BF5350755283C464FC4A9F62FF9BB789837CA934FF942023DE_cppui381),
+                            typename field_type::value_type(0x05BFC9CE3F103D60C42D7DD3EE7C2E70B6904D9CC9585195B66537A033F9CA6BD1D7402A32A01D80EDA66AE53BCC83B4_cppui381),
+                            typename field_type::value_type(0x05680DCFA6FE6F7878132DF80664232F847E03748B6383A3255C019C45BC9299835562B0B288FA1282C267A94A6DAF00_cppui381),
+                            typename field_type::value_type(0x175EFBC875231C8854EAB920B56EB9DBA762F6A55516D550D8B9C58EE3818D2FF05D82F470EDF4B9D9188E3DAFC2000C_cppui381),
+                            typename field_type::value_type(0x0494BFF563FD1259A04B868F64E0472E2D1F48FF0A02A3142EFFE17DF01F8611146E1218235837868B42963637A4E769_cppui381),
+                            typename field_type::value_type(0x04577345056006F7DDE74849E1E18A57965E1C2D6612461787C870CDFE8D14C51F7B749495AE5C5EABD03E1286A1A437_cppui381),
+                            typename field_type::value_type(0x16FD045ABFDA74406E9626CB18B8DAC331D2AC3B37D8429E16A2F08415E128BE210FF16C47C8958043A9812CD78159D9_cppui381),
+                            typename field_type::value_type(0x086913EC33C69A6E74DD4CDE78BAC8343BF7AFB679AC8ED95EFB3833B79F17B243106ADCED318C5B19A965AAB9DF0585_cppui381),
+                            typename field_type::value_type(0x0F2B39E327EC6A03E1B3E5908F038790FA3C995F38C7400057C9F9C5F09B2ACCD7F45F4B1551C46ECAB9DDE71E932A30_cppui381),
+                            typename field_type::value_type(0x0D44E0C497E8707DAD98BD0CDE51466B64B321864B97E861DC876AE4A95686B94AE4C87641B8327F005BBC01536C70A2_cppui381),
+                            typename field_type::value_type(0x15F5E6BB054D785FAB30756D542E9CD9461B286FC75F09C6368B577F9E3B486D4D1B11FE4C60B3EC838421276B78E55A_cppui381),
+                            typename field_type::value_type(0x133BA030FCF1C888E2ED35995176F37DC761A9026BCDC4C1563376C549CD21CAAE803EAA76F5411B9B16FE5C68F5EC55_cppui381),
+                            typename field_type::value_type(0x1364D521C500CCBCEDABE591457A5D0FCD0E939BE73F83D8CAB70EA05518C37D0506725D9E115107F04D2965E8667364_cppui381),
+                            typename field_type::value_type(0x0B589386C55DCB59934B0CC04371B2DE1717A67F25526263612653C45466FF19F593937068A116B4998595D50AA32362_cppui381),
+                            typename field_type::value_type(0x107B188D9C8E5EB5991C8C2D1A3FAEC2D5215E89B70BDA0EED700C9D3ED6AFAE40A16981B4EF73167E5BFC44A798017E_cppui381),
+                            typename field_type::value_type(0x1874261827B7B1B9143A4258764809B3A6084BD3463494253893167A383DA97F87316118DF637A821CFD23F7F1919C09_cppui381),
+                            typename field_type::value_type(0x17BCCB43E8CC1FFA4F6BFB8788CFC8A286CA89E5F5F488DD55A5E42E3932E61706D57F7EF7D8D8CAFAF122BDEA06806D_cppui381),
+                            typename field_type::value_type(0x06DCA71FB16FB8FE00525FE66742CBCE949E93184AA9E86FDDAC436212984B2BE117C145A547DA25D33465EC8FBF93C3_cppui381),
+                            typename field_type::value_type(0x0B3BA6CCB6CE819329A40ED6C804622423DFF836F618A364F1B6ABFAFCF979014CC628C795A65F777EF73DE1B60BB9EB_cppui381),
+                            typename field_type::value_type(0x09B4D499FB9631D608E9C885D48F3F914C759B5CADCBCBD5C1CBD0D1A5DC5A6778F31E96FFD7C536E727C0D08460DD24_cppui381),
+                            typename field_type::value_type(0x006ED227D708D67E14DFB5062211B1EE95FD7AF61989297E08BC0EB1A9B3C5A9ECA256F181B59D09C86746ACEA06D5E0_cppui381),
+                            typename field_type::value_type(0x1786D9083D1F0A529C222CC5BA6320FCB34D3EEDE8B9F9356158A63ABC1BEAE0B6DCC56593DA246EB7354EBA1867DA06_cppui381),
+                            typename field_type::value_type(0x0CFAED1A56F5709324661A8E98718AE1B1A556839D622D473852283887E44AA197C75787D67EC2D1E6FF06A88E4087E4_cppui381),
+                            typename field_type::value_type(0x04608E9F3099A24ABAB06383F7AE63DD7C67DC415648838E7D4E92174E619712A67DFB052F9BBF5084D0EEC78013B3E4_cppui381),
+                            typename field_type::value_type(0x059DAC1216901AE7CDC4A1EC88D9E6E1CA03A689EF287441E173C38C2EA002AF3DCD9B7E80B7284437C947FA232C3C0A_cppui381),
+                            typename field_type::value_type(0x1135EB7B41071B366D9CCC11E1FEB9642B2FC9D7C6012C8ACFED157E02F513A4B00A4CD445DB33781FC0767792EC7B55_cppui381),
+                            typename field_type::value_type(0x10ACB49B847D2DC727499C14D667EFC7788BFAF12736B80DF4AE28C505037E7ACF22936964A7A5E75B78D6FDAFF196FA_cppui381),
+                            typename field_type::value_type(0x01B0F3CD6150B986870E48DB381A77D93D03D2C1F40B879D80690B7782AFB7077366627EA9888C77F716ECD144B93A92_cppui381),
+                            typename field_type::value_type(0x0812556968B6E34D2B113A9D501D486402B93FD8A44886F529CC8959BBAD166199B629B9700CA2A363B4A646171EA3B3_cppui381),
+                            typename field_type::value_type(0x0495B7AA39F9E16EB12DD06CD733B1FD87259B0821EE772FC3FA224B3C4A6EC264673C69045B4B002A3A3151E1EF605E_cppui381),
+                            typename field_type::value_type(0x1793A628A335B05A34B3C7A5FA9612115C469EC3178AF8446EDD6B03F4C04CEA806AA37356024617EB528185F7F1D2EE_cppui381),
+                            typename field_type::value_type(0x18C614EBAE99E2FDAD508C92285FDBDA54BCC4CA219F63B3672D3B548B0AC32D6BD189A801FF7DED6CC5C52581244CFB_cppui381),
+                            typename field_type::value_type(0x027D4749375E1CA7E6F9042B5D70D3440A798586B49C53542C26203AA5531ECC63DF9BAD3DF3758F2879A412000E2963_cppui381),
+                            typename field_type::value_type(0x161F7848E5A50975830565D3010E279889624552B8711081F186B558FF5BBD205253896B1D7821C75304D33952914CE8_cppui381),
+                            typename field_type::value_type(0x0468BD3B3C8E5D281EE78EE82A79FE8A92FA29161A52E9FAB6F89D5B504D79BF0A1839262C3ECDEF123830A8AC31BB03_cppui381),
+                            typename field_type::value_type(0x176A991443613BB21BB0BB0FB5679CE8AD50BC39FB321E61361A120707824BB0C6B6294F93033CD45F778948DA8E3730_cppui381),
+                            typename field_type::value_type(0x14D042A6A4098D9E08BC71EF6BE948B6281F0F5A0F827924D367A97DEDFD7AD900041DC0DBF45C97908A6B7E7B8DE2C1_cppui381),
+                            typename field_type::value_type(0x0F7A658181DF622A3DB2A8D7C15B7D5E40974F12376124210301705F20E205D02446A4D63E55A05103876213F70F60CE_cppui381),
+                            typename field_type::value_type(0x0AE77052DE5F10B669565187EA3C65FFB21FFB71268B11D1E27EC0E8DED8DEE8DE2A8316A91D4004D31126BD7E09E0B8_cppui381),
+                            typename field_type::value_type(0x187CE7FAD40DF59FD862DA49DD12526C703349689CA9418784AA59D5D77A606DB7777C84101044D19D66C1CFCABD686C_cppui381),
+                            typename field_type::value_type(0x0F00BD7EACF24671F885B6E7446063D570C1A170C743810341A920A2B4B108F621C3DEC8E6A817E32577275671FCF909_cppui381),
+                            typename field_type::value_type(0x13A0DE4D6D57451DD6D4A5B5139F52C055CAB2ED1424AF90D753A216F979356FFE5699FCFA268C245F289844AA780BF7_cppui381),
+                            typename field_type::value_type(0x12F3447EE96702A908269EB79948537C86A1D1E425C191A012C5A869EA7AA5D7EF90BEA26111D265C8623017B8CB3359_cppui381),
+                            typename field_type::value_type(0x198B27A5544F8A1EC93D32708CC10BDF305347751165DDD34DB78018D97D76FF9E38B3DF348C2A029A24A7E9DA189A75_cppui381),
+                            typename field_type::value_type(0x02C04B47E073B6AB24FB1BC6B24BC38CC0025096B3F8787C948D24C99444CA39678A14B7C61E2FD24F375D0CA9BE62F0_cppui381),
+                            typename field_type::value_type(0x0BA19C4936FC0CC494D8F3DD76E4EEABAAB67D2F711D08F518C3606EF4BF6145DA4665698ECD3DDE431435695DB69558_cppui381),
+                            typename field_type::value_type(0x18F4BE4AF32CEC5731C16AEAC6921F6BEFD65F5B9586ACF8C1CF6A332CC9B156D3791B0057E8123EB6474EAE26D582ED_cppui381),
+                            typename field_type::value_type(0x03E9D58660C8C6A49241EC53BE3E6367F3C3AFACCBE4103A0DFA9C4AD07657EB24E4AB5A6739DB7BAC3256B718F484EE_cppui381),
+                            typename field_type::value_type(0x008862A5E8E19E8125F57B42895131255DC39FA9409D99490A89264F715061570699C3BF8C6470254696310A56E2FA1E_cppui381),
+                            typename field_type::value_type(0x151186247D07867C3113C72E24C63CCEA89BFBDF34700D02C7AE104E62D7807BC5CA4868DD09EB6881F04B0D1E06D08C_cppui381),
+                            typename field_type::value_type(0x16F370CBD771A847FF9D37D000037D18DDA7D113649036A403842C09E610606AC04217AD651C66EDB3E66A8D65E66AD2_cppui381),
+                            typename field_type::value_type(0x050261CB1664D2C623E9256A8F955D5A8E7FFCBF7899316693C3EB1905391239A8F8AD719909542221707E306ABAE220_cppui381),
+                            typename field_type::value_type(0x0CC9E9DC5D1498C1A5CF2FA977298BB04B16D1FFE38F9ED7CA076FD55BD5BB2A2DBDC21D03640763A90CA66CED3A29AA_cppui381),
+                            typename field_type::value_type(0x141DE241D5D45A826957FC66B85D15464D473F1C65A0ADE15641966C58EECA227DC632202E4E87772E8AA33378321475_cppui381),
+                            typename field_type::value_type(0x0BE35CD7D9D7081147EACE4EA3A41609F65FCAD2677DBE659A2B2F7673CB9B986531817C314B0D9D1F93A5EE7C176B1E_cppui381),
+                            typename field_type::value_type(0x01F8C25E6A6B7CD6E462598CBD7C03BE032E153E77DD07394DBA2311C12FFC6DE52FB60499FBDD6AA54DF21AF96D6538_cppui381),
+                            typename field_type::value_type(0x0D36192E8173BA965CD0F7355F46616504AACEB2996FCF18132804933F2182C4CA899567384003026B07503D598C2BAD_cppui381),
+                            typename field_type::value_type(0x120EA90CA838E8992D6811955095556008A45DEEF55F0F7FE9374EBB0575A71CFA3B9CFF8BEECD38FFC12CECAE9B6459_cppui381),
+                            typename field_type::value_type(0x038E6999E280483328B0893B74AC34268ED6D4C1C291CD6212F155CF959FFE96F4ED1C7DBEC093125C5FF60CAD253AB3_cppui381),
+                            typename field_type::value_type(0x07D9E6D82707F3C0C387E96AE13835532874B7B75855154EF8442CDE3EE6099E3E4B09A34AD58375ED95D0709261CE61_cppui381),
+                            typename field_type::value_type(0x0DD56F771F1D975384FD3B80E2BBF201D7BBD0A5A067AE933206E0A1E595CB7D62EB35B256A81E5085EB67621BF44ED4_cppui381),
+                            typename field_type::value_type(0x0562F23D21FCFF959C2D217186F0CFEB4861A738F9E84D9BF204F501C6336AABDF9CD28EBE46B811AA6265E34AF5A570_cppui381),
+                            typename field_type::value_type(0x0C0A3BA903AB0EC5797C3734FCB459A040FB79AA43E39FA893557D8A433EFFA4E1CC4C197A6BEAA9AF98E7EEFBE42C53_cppui381),
+                            typename field_type::value_type(0x09F9C90F3AA9E1E8CC9D1A399D9FEEB865DA1C867980BDD742239557F8EDD37F3FB12E97961BC5F9795388A0E95447D2_cppui381),
+                            typename field_type::value_type(0x08111C16FF56D497A319C0BC02AE7941C83697A66A78AF2F6EE4DD293A366B1727BBD4C8AD6276D8EA9A904DD909F636_cppui381),
+                            typename field_type::value_type(0x1579F012A6FC033BB6A630B894BC7A437FB48162AE09DC87953579BAC20054021F57CCC5087815095DECABE9D6AE3E1F_cppui381),
+                            typename field_type::value_type(0x01598AE491EFA7DC792DA276F90C055DBFE54684E0718ED34F829BBF62966FDC177464C3611C81C5C912261D2F70814F_cppui381),
+                            typename field_type::value_type(0x06C865F674E1CB788D741629CCE3FBB105D5458839DDB3680F8705EFF3EC7EA3A82347F0D0A05CDF02D25AD5A13DC268_cppui381),
+                            typename field_type::value_type(0x1962157960A16461B89C06AAF91D0E0817A650DFFF74F041FE9100288769489E6CEFE0AA501F2F165A53E5E5BA986F18_cppui381),
+                            typename field_type::value_type(0x03D19DDE411BBE01757252B58D502181F825D93BBC888C63F2B414BC80B6350F4EBDA87C22667484E1F22A96E18C1A2A_cppui381),
+                            typename field_type::value_type(0x13595A99565EFDF519DFACFB0682654A2652A53756DB3ECF213CF28FAAAFD96BDF48450667690C48B9CC9A7FF08314E0_cppui381),
+                            typename field_type::value_type(0x062FA2021FE33FA499F67AEE7BD2BBFA60432CA152A67CC1ACFE237381280FCA5AA0EF0000DDF6F19D514283D766E24A_cppui381),
+                            typename field_type::value_type(0x171AFD4D8BE70B421AE821FB88ABEACA17C96A94F2435710358150B759B42572113CBDC6CEC57B9C4C118C4E6FB6535B_cppui381),
+                            typename field_type::value_type(0x19FDA780643940E3E4BB6913B51CFADC53F1AF692A78D09C5D16D6607EA272F4E0AAC9E425C8F8D7ED16B685977E568B_cppui381),
+                            typename field_type::value_type(0x01CF17ED4079B9C601ACCEC23F87414CEE32BAF86EDFB8050FB8D980D0CD346767190F8735CDE6BE587C0CAE6DE25F29_cppui381),
+                            typename field_type::value_type(0x07C74C482D285B273E998210DF6B41C1CE16CADEBF0D3DAED5DB4BFD42711E0D1FA9CF59779C92E1BA398A54BE5F5247_cppui381),
+                            typename field_type::value_type(0x023F12CD6A0C95A40FDD38C330B15DA61EDF0358AA5C475FC400A006341EBD2EF2AA7A855F916AA10E1670906157540C_cppui381),
+                            typename field_type::value_type(0x066DCD456DFCF56217FE6025FE53BB435A043AFC4FF45932C0AD1A1B03B7C93F7EC3EABF1C5F9A279BD6BCB46B79C199_cppui381),
+                            typename field_type::value_type(0x167D667C6BEAA34FBF77F241073C0B1ACCA14B934FDE95DBE0857E48CD879ABD86CCE1EA0193C799CEA57F8DE57EFC3F_cppui381),
+                            typename field_type::value_type(0x0105ADBA2E7B2D1C9214FAF852FAC381412E9631817A718FB8EE6847C129D9985708983F1FAC4C7B625328A1123714A6_cppui381),
+                            typename field_type::value_type(0x09E25A736AAA3480A90A1275630805BE291E9873B9565A5376C63E780315C469702FE4046254241E591EDFA37C89CE4C_cppui381),
+                            typename field_type::value_type(0x153E0581F5A1B52D7854172162BC9A027B9A0E65778116081D6E90A34281013675A59A1F08E405AAA284EDA86D61CB8C_cppui381),
+                            typename field_type::value_type(0x0BA9F2F9F74BF3CF053A18C2B4F1AC5A3CDF23AE9E45901A30385B765E1ED2ECD1E41EDF89DE5BC9FEE777FEC3B49971_cppui381),
+                            typename field_type::value_type(0x13DAD77CC7DB896C7696BDA5A6F79EA4824DE073892EF46165789D54379DAB72A049603852ABCA9824ED3B4F44EBA7E1_cppui381),
+                            typename field_type::value_type(0x0ED3DD2DC68B43A35CE6900EEDA5382CE9DD71FD821A6375739EE07DE8D3674D8E263C760986396822F4D9F14043C3FE_cppui381),
+                            typename field_type::value_type(0x070F67EC42C4D8EA50275CF7D54F629C7A4C3E705FEB8EAB0D200906208E3CAEC7E5AA6C3D92E36F2778C954469A23FA_cppui381),
+                            typename field_type::value_type(0x168DD494A35BB87CB047D87E72AD575DE648A6CF7B556774E5A6D555222F3233D8E659970A49EA4F47494BC2AA317442_cppui381),
+                            typename field_type::value_type(0x17B047DD10D7AB1FAB6D302A12F9FAC929B032F46E100B8E93AACD05287A5037BD35B8710060357522E715D354ED8BBA_cppui381),
+                            typename field_type::value_type(0x0691E2D8449ADC3239D413769972A938A5176CFAECCA01D68F107421763972C26942037A09FAF94359EBC7A361592D2D_cppui381),
+                            typename field_type::value_type(0x17E461C266122B2CD8E33965AAE15C96BF964D1579EAF3918BD243AFAB0E63335426F3613FE03AD797AE9B530862D499_cppui381),
+                            typename field_type::value_type(0x0A46D7AD828715F4B0CF1569D2E2E6C2295BF6CD9D0BE41C12216F94FA3B15892F31378E71D83CA5C4D0BDF5D499D00A_cppui381),
+                            typename field_type::value_type(0x124AABB01C8F2E25F9E5C286F8F677D90387C639FA780BFD2E723BC2CFF331F619499BCD03A55B3078F8F25F1E7F929B_cppui381),
+                            typename field_type::value_type(0x18F80DDC6585DF3396E0918FAD95C2919F9D3BC7399201922469BA786DA01DC468B00F5BCAA990C6725A54FC75D4D418_cppui381),
+                            typename field_type::value_type(0x06C1CE07B9801D22B9E9E7DFB5FF922332D153361D4B3F10451D9EF909251421E0AC134B371B1B28F38099D4BEBF6595_cppui381),
+                            typename field_type::value_type(0x0C623A446CE9DA88372E767B28C27376165ADCDB0013CF567D56E2323D048586A11582ECB932372C9CD32430CABA6123_cppui381),
+                            typename field_type::value_type(0x14BBCE72337449445345B62E02C5A2A954BE69A1E4D5B647742C05E0F1BEC5DDF47FBAF76AA3ECE5C1853908B698E2D8_cppui381),
+                            typename field_type::value_type(0x0E4B866692EEBBA48028DD444071353C377D1C5A2CBBB0B0A336950D73203B81BEE7611DCE414CA4DF4A4FB4D0DCFB03_cppui381),
+                            typename field_type::value_type(0x171E882EA627349C5974D25282B73BE04D19587ABE589E3FB8292185061CC2957733A54DCD8505960DA36E09DF6E8EF6_cppui381),
+                            typename field_type::value_type(0x06DE4853510DCB06A0A090F60144367A52EF3A03C3EE8E85C7D44A57E0126FE039D573E5362F1CDAA321F864411E75A4_cppui381),
+                            typename field_type::value_type(0x0E1D46780257F9B46AAC596BAA5A0CF90EF4482A7F38F7587BADCA61AFF4A5947587DD8447874B7FC7C2D4540B51DFC3_cppui381),
+                            typename field_type::value_type(0x0221D4F8F33B4536D420F431408C99A9BB892D7DC6828F0D4480D057180AA5EFA5A16CF0DF6E42AA91ED749BA477AFE9_cppui381),
+                            typename field_type::value_type(0x112773C94240F4DC2580E5BC35AE1BE6CE04BD7D323E77B5CF46A9561A48C92D49C5B5FF644EB64A38578026EBE8A486_cppui381),
+                            typename field_type::value_type(0x0B9EAA1569897ED7B0E8B5101EEE59A151D6831539BDC6C5EE963172E6ECA0128A85F3BFE2EAD63C6D82B5E18AB1BA6C_cppui381),
+                            typename field_type::value_type(0x0D2F3768125906C64BBF24A5E7B24B51931BBF6F20E4B4F4A79803FDD8388D9B612B909A9A35987E8E2C9633189CEDE2_cppui381),
+                            typename field_type::value_type(0x1839815EF1706D978DE35FB219F5B5B12F9A9594E2B35F4F7C5DD5624C0053F44EFED3FAA7908A6DC6E9E8FBA58FE061_cppui381),
+                            typename field_type::value_type(0x09EEF52FE874743EE3A0744C9AF51C18CA6EA2A41FFDF7E1CA4D88720C2A1D1CCD52ADAE18035EB5D38EBDB402D471C7_cppui381),
+                            typename field_type::value_type(0x1721A05BF7B4ECF2B0B0C3941397C6348966878EF958B493A1385824853FB2666B93CEC4A12A218795C9A772E61B8F67_cppui381),
+                            typename field_type::value_type(0x0583359095650A45A3D6FA146B6B70EFFC8B6C7A1FD75A1A317099D224B47D35B113567DC861B9B5E46DE875EA583735_cppui381),
+                            typename field_type::value_type(0x166421F3059A278DD9F9D2FB6F60CBB68C1A85EB374A4AD722E08AD905A758DB7FBDE02B5950DC526532109EF025B56D_cppui381),
+                            typename field_type::value_type(0x01634FAD543502754F501EC0B40D959714C26809583D5EC86DF7397632ED5CCFF145C2E8DA44CBB8E469730D6CFF5EAC_cppui381),
+                            typename field_type::value_type(0x047645FC67532A565C488B68FE306CAB00725140C9BF76990CE599308FE844A03E9DBA12C27BB19091E9C30CACCB5F30_cppui381),
+                            typename field_type::value_type(0x18C94124E790C4057719EE35E6D7697082EB93CB24B0F34C51BDE013EB0F0EAF09DF22DA70756625518C1AFF0F771730_cppui381),
+                            typename field_type::value_type(0x006566BB0815C8EDEDDD691D80B17B629BC54C7DF74A2A6065B8892E938294DFB571AE4B8ABA50A3B73ED2045272E4D2_cppui381),
+                            typename field_type::value_type(0x021C8900AF57683247B66FF7C868511DD32D1972236B2741D50C0C8F87678EAAC079015B5E09CAD3611A093742F1E92D_cppui381),
+                            typename field_type::value_type(0x07EE041A89F349B421FDB832DEE4BC0F2661772A6CC38EF53BFBE2DCD677346863372E07187567BC576218436876F22D_cppui381),
+                            typename field_type::value_type(0x11E0F5426EEC4A105BFE22B81D5BA2E665B4D0F25ACD9C88593EB081F500CD4CAE75CC2C049A475225DA8A480D80D3E2_cppui381),
+                            typename field_type::value_type(0x13DC7F6E963AA8DAF98E8703602ED700B895F508E73F4B2EA50AE2763A6F2CEEC5E3032408A4DCF303B46B9C94360A5C_cppui381),
+                            typename field_type::value_type(0x1141289C0B86728D7A09A0A0260D99E9367F97AE852D95742ED6AD5D1E11459E0E8A64AF0B1637B061225080732AB1A7_cppui381),
+                            typename field_type::value_type(0x14E973C8410CCC315CBCD5B8BED877E4955B17A0C189654133E27756443D975A3166286C109B6A5D89787A147B678E69_cppui381),
+                            typename field_type::value_type(0x0508A94B4633C9CCAD9E3191B99E82D52A9402150920978C0FB4C428E4DD8FA18E21D47A65A33E88F1095DB8F67EB85E_cppui381),
+                            typename field_type::value_type(0x17CF410D9BAC752B55D96D5A4FD877D8EDE32E591CBCE05CE8FD42310558D2910D6CD5DA270B03192E1976326008EE94_cppui381),
+                            typename field_type::value_type(0x1704CE73FCBD3DF05005F20A8CA61BB5E1FBE005BD38FEA2885E85256034E041553D0F0F90C37014733A572462337249_cppui381),
+                            typename field_type::value_type(0x117576DFA3B891D906EF5638DD66B50471CE5363822F226A35A9E3D5F902155878936D9B7715F759B18A2029869C1D86_cppui381),
+                            typename field_type::value_type(0x08E74B0E1D1C1DC468B737C04B53A4FB598B6C85032F8989CB1A51DEB240CF6266590869D823B15D23B90901CB408607_cppui381),
+                            typename field_type::value_type(0x005126D45AE7EB3DE960F2E59240F4AAE11B931B20514E9566A669C2E17998EC3087ACF36107445E2C55850171FECA7E_cppui381),
+                            typename field_type::value_type(0x08D9F8B699D9967840DE564CF0FFEBDA7E5432BD566241D3DE9DDD7A7D22C4AE73C70CD5ED91144E93B6B2A6A87D50FD_cppui381),
+                            typename field_type::value_type(0x07751728EE7FCD8DFF58FE2EAF783B5A3EB20D30170D9D2FAE8312EA153770121E2A94F62851E27BB937B0F11C9592E9_cppui381),
+                            typename field_type::value_type(0x0A0B1D1750AEDA054597E3FE1279A8FA898A85EC002E23D0F3FE87D9126D4C01DC10CE1AE50CD4D1D39B597BB2858E98_cppui381),
+                            typename field_type::value_type(0x0AA1294A26D07D90FAF6F3B586C97E7C4C18A2EEF555AD863C7C9077595A44B3F7FDA39403485DC08F522CF4F2B902B1_cppui381),
+                            typename field_type::value_type(0x19EC6BE5151EC012BC99408C4C6B2441FF45A54AB897D55C38C0917DDFCF94DC6DBD1C014C56ED99FD7592473137B39E_cppui381),
+                            typename field_type::value_type(0x0FFCABA212211B41ED2AD32300EFEEDC6BF8D6D5C0C5383331D75FF3B1AD8AAB1805594080CD6D810A94EEB67EF06CED_cppui381),
+                            typename field_type::value_type(0x0FB38D0EB9368C84A6921273EAAD02309141D9BDA55CC1B83623577DC65226005F30A8688DBD06E8B2540DCA946671DD_cppui381),
+                            typename field_type::value_type(0x1561EC5922F56B65EF63BA2CAC01E47E82ADD1C909C73884F7E53379FA30AE35B8B2EA37CCCF7BAFD70949502BA5B01A_cppui381),
+                            typename field_type::value_type(0x0D33A1AB220A51A38790BBFBA3FB6087676C8D8E06A3EA40F596761A7A1575E1F73BAEF6C45033625BE9C641858A67EC_cppui381),
+                            typename field_type::value_type(0x140CBAB1FD9F832FB86F29B214FC0269EDC59460498070490322158B036EE68931E84BA305851A6D8D2A0816CB3E2BF8_cppui381),
+                            typename field_type::value_type(0x16FD598387DD266F356C1F05E31498CCBB7E773488C090DDAE8DAB6C1A7095C64B9CE63C2076471361C3EB4BAB452EA8_cppui381),
+                            typename field_type::value_type(0x0F9D878B3B4FADAE7D312C9CE83849C3C7E63F0BF4F7AD54673B9B1CFF7D39AC564365E75630CEEA6A045A26BF321941_cppui381),
+                            typename field_type::value_type(0x18B99A37BB85390E4CD95C508042363CE9BA98F1DCE7D25DF72981C15309D492C65FF46ABF59A13C267E02F74FF1E3B2_cppui381),
+                            typename field_type::value_type(0x0FDEAD70D2396D5177A3666AC80B689403EBBC5E6D9D5BCFB3AA3B8310FFB2C0E7CEDCCF096550D9ADBD55EDF681974B_cppui381),
+                            typename field_type::value_type(0x18E4B7899294472F9824067D7B844BCE0A72E22E6BE3BB52E33E5F741A5FEAAE3A63DF295C5DD51CE8AB37800078B5FB_cppui381),
+                            typename field_type::value_type(0x164459BD8409D9366CF8500050E41312ECB4BAA9361BB6B75130917046EEBB8BB1F653E9FC392FC9D41FF92155FB9756_cppui381),
+                            typename field_type::value_type(0x17E2CCF48E5ECA0680DD20E58A3260FA3C05C56623AF23934467E02E2C1976E73BD4DE3F3F0D339BE924741516295135_cppui381),
+                            typename field_type::value_type(0x157BB19C3FA1E5C4AEF406D17306EF7F903FE13EBFDCC373D79D6B6EC03503B2900B8B7BC40128B54F7AC5156DE826F0_cppui381),
+                            typename field_type::value_type(0x13A8170A88461258D2E09EB2D4AF3D4CDAF4B91EDAF31D2415DC6EA4AB64FF65A64122E8F6E1427B5054CCEA3AB1769E_cppui381),
+                            typename field_type::value_type(0x0E6EA406428D7D4A3523E5480D9B2185E29428BDA3A1C3DB9DEA9E9DDDEBC02288C8C8B51D55FA77D8AC18D3D69227AF_cppui381),
+                            typename field_type::value_type(0x10005399627DA815E333DA7C1D3394C5E2F83724FE9E8FE2A0655D04A53279560E4D8E16D1EADDB2D647374440139C19_cppui381),
+                            typename field_type::value_type(0x0EB5CB28D05C4DCEA36B047A94C7542BC1043CB36BC5A3C5E8E158B3AED441C723061A256BC5A51C32B1F4D75B50440A_cppui381),
+                            typename field_type::value_type(0x0BFC0B52DD90B7A31F943D9A11E507DF3386297F81F087BEE9408B42B85EB784A22CA79282430696FEF39C71E2589BBC_cppui381),
+                            typename field_type::value_type(0x107A37BBAA0404791A7E35DF9D88A491D096004461AE82C452D2C03A866FFD62C14FF2D66E5BDA245126FD1124205BA9_cppui381),
+                            typename field_type::value_type(0x043C9BB725F638DD08EC778CB3808EC2CA226BF70397225E69E5F6CAA58FA4D06A72B6CA389A45E0D5FB18FB7143F4AE_cppui381),
+                            typename field_type::value_type(0x0889073F601C573E596D10E203C01F793C1EA39406F9D6014AC4C5931EE19A467ADA74562B787BFED5989BBF9290AC05_cppui381),
+                            typename field_type::value_type(0x0DB921499A925E4EE95C5C9F423E2FCDE65E6F65E3A7A28F48B7C74EF2A537C50EFDEF6E2A93EAC7802185E81048E2C2_cppui381),
+                            typename field_type::value_type(0x11D0C1FBC3EA76341358D45C5AF03CAD3DDFFD80FF3F61C72929AD517CB8C4337EE1B45CFFB07A5A3B4BE1E7B66C96FA_cppui381),
+                            typename field_type::value_type(0x09C6ABC9759F4097CD56C1A45467842F9BBA172BA4E43EBA13CF97710158DC8C30DAD5D69EE0EDBBD4016988C7DD04F6_cppui381),
+                            typename field_type::value_type(0x00FCF75BE569EB58BCE7EB94A35CBF12034804690F9B33BF148B81E0821665B23BE368B295DCC6060D74EFBF6BAF37B7_cppui381),
+                            typename field_type::value_type(0x0CC6FFE6FFE8F44CBFBACDCFA00923BA2AF776DB5592594DC1C6826ADA5848CA033405B513860556E6E0DCA1F53E604C_cppui381),
+                            typename field_type::value_type(0x18A0DF1520FE535AFBB66B6CF46C3BD95315B9D773E8F6F2BDAE87E2F71D5B2AD548D64F25FB2394BD5B87FF53B3FC47_cppui381),
+                            typename field_type::value_type(0x08A3447003B7C3A970EC7F42DC125200ABA16DD3E4114AB8C54EA324EF2FFADA9D055BEC1450ED7E428DEF6C3D67194E_cppui381),
+                            typename field_type::value_type(0x1358F750B78BF396A0619C5D307DA3CEC6DD6015968D2277C635DCECE779A12454B760DC07A2E97607704AC3E2B856F9_cppui381),
+                            typename field_type::value_type(0x1444D43FE29B634856343993BFF67D79E768C8D59BEDD7F07A3E2E7F15ABBC05152D2EF42D2285324043DD9C7FDB81BB_cppui381),
+                            typename field_type::value_type(0x0D1D4EFD7495E463BD0554E787B9A05BA5D754CA7D9B140A0EBAD33820F09B58DA2F7ADBF638A411CC8698F6AA5BD5A4_cppui381),
+                            typename field_type::value_type(0x06C57BF7CD0E47857BC0774FEEFF8CF0DCAB12768B252025E7D67FF4AB7BD309302865456450645434C6381CCED7FA3F_cppui381),
+                            typename field_type::value_type(0x095F0488BDD058DF7C788F696D45545A50849F52C8FD50F1A1F75181D797A9ADB3EBEFCC12AF83B66066470E90294FC6_cppui381),
+                            typename field_type::value_type(0x03FAAFA08711F58422CFBA7BD3580EA76486BA322E3BC121E454E3EB0E84CAAE2D143BECF32473FA4A5A1EAAB4EF82E2_cppui381),
+                            typename field_type::value_type(0x161214722A3D06E81515A445E3C786E750FE377B73CD7BB6923D3A62C2AD7BAF47314C9BAE1F31697C2D7E2B7630B623_cppui381),
+                            typename field_type::value_type(0x17F7BCEEA6E9B76804C3CA30D10A62C8C20CBB272ACBC1C38BD21E5104BD408596D0E883A1F7B63607EFBDBA0570FFB1_cppui381),
+                            typename field_type::value_type(0x174A7C292B4484751F728C8D7F911E6CD0B78CFF289923DAFB9021A9334F0C79637EC5BE115EA24717C88952F95C3A50_cppui381),
+                            typename field_type::value_type(0x0E58B0AC3AE77A5CDEF1E945520928F023AB02B97FA668D6E526B9D47FF1F0DDA2271FCBB22D08D6CEC370BB9C47BA32_cppui381),
+                            typename field_type::value_type(0x0D956A20511AE8F017DFACB6627D2B758956F1BE97F6535B1296343E668D86E1E798305EDFB8496C4231CCC58A05EC02_cppui381),
+                            typename field_type::value_type(0x113DFB832F2669C5A296D9BBD8CFFA3D2C58EEC046514EEC003D0E44007C2210C6CD71A19522458CD93C873759D4715D_cppui381),
+                            typename field_type::value_type(0x06E04697941A53043321EA118CEBB78DC3FAE7B456D609DF68E529FB1EE55D1B5AE0C95C8E2F77AD6EE7595F442030C5_cppui381),
+                            typename field_type::value_type(0x0A1880C993B39E825C13F9E863CA5A5E2BE82686983F2D73331E345695C544FD56E444DE9E5D3575CB3B1D7A687BABD0_cppui381),
+                            typename field_type::value_type(0x14B28ACA59F3E76A3B097D7817EB4E890224DFEF5CAFC4260884C4C5290CCBB955E06F0A1C2ADBD56CD1967F17DCF8E7_cppui381),
+                            typename field_type::value_type(0x156BAB1887E92AA70D861757A1E93AA7AAAC6EE7016D481E4E12005CB9C2BDB32045C4A5BA5DF2C8C4976592FAD740BC_cppui381),
+                            typename field_type::value_type(0x13BDEEA916898B1B14BD4728790AEC94DC8A2A6CBB34332597A2B951C00DC10865D196393CC1A5224A2D7FA345EBC6A3_cppui381),
+                            typename field_type::value_type(0x0180674B786FBD93B500E8C74E47EC85386FC56CE72C120073A69FEF38973E3AE6676CE2C4753DC5FA25F38879D48060_cppui381),
+                            typename field_type::value_type(0x088B70821F233A1939B3697ADCF3CC42EBB95A45527B79F92E3DED530DF9CC74B75AE562206ECC5B215D81F834C74FB3_cppui381),
+                            typename field_type::value_type(0x11F41DF00E3A60DD7B6DA6B20D30524FB8D3AA6F2A357345DD06F31C9C78EBCA54D5D4605019882E01291D63190D6FAD_cppui381),
+                            typename field_type::value_type(0x10F5682DCAE083882C8900DACAE5AD172E80C7F05E35AAB48A3FA6660EF01AB690FC935FE38B2660BA36796B7BAA6122_cppui381),
+                            typename field_type::value_type(0x0FEC69364E959D54A4ED7D3D78836E80639A76FD2CC3F58E4D499C33B65CD37B5FF4603125BDBAF785517DA9E009C3D9_cppui381),
+                            typename field_type::value_type(0x0006AC05E8BD66612470DA61255F08CC4CDEE7C67EBF32C1581DFD77F8E931EB79265D6842DCC76A590C82383689DD2D_cppui381),
+                            typename field_type::value_type(0x05B684F29148398C8FAFFAB58960C7BECC01ED5635FEF1FB500BC3309F88FFAD9BE8080518F083A52A9B928EE991D9F7_cppui381),
+                            typename field_type::value_type(0x1645776DA9577A5BBA177EEF60EE791566FD068E970AF7C22A655A2DAB656130FD90B088016D39BC8C2DB8D6792254AB_cppui381),
+                            typename field_type::value_type(0x0E55D780072F153D412F2C822D60D150FE095D59BCB41954B18D774E63A54692CD0BE65013AE6875B37544B8D48E75C0_cppui381),
+                            typename field_type::value_type(0x084EA04D50FECAA1B01C688204702BC2A98079092A30CE0D7E07E158EB441679DF29F2518E978F0C81F84244A9B9A26D_cppui381),
+                            typename field_type::value_type(0x19F4FFDBA931FD6A9420E5C93EC672761AB3538DBC39850C23ADF1B311695F63B3795B270DD4FAF7E1E774ED1579E29A_cppui381),
+                            typename field_type::value_type(0x105B98B8EF7ABEB852809B9B63EFC22AAF0E3D042071CD003D0F9921962FFD26ED38CF6A4C7E3F9D3643544CB49B37FC_cppui381),
+                            typename field_type::value_type(0x0DBEB38527AE757A485608D0418C08B58F2C200F9F17BB136CB3CD02D53695980174D42F5105A560B75959CFC164A1A6_cppui381),
+                            typename field_type::value_type(0x12C1A74E7099C281EEEB41647B01FBF96D0868C94C6AB3E0B05772D92CC0BB1D1639DEA1FDB0BC7BC163E262E6143DDD_cppui381),
+                            typename field_type::value_type(0x0D35DA035484015CD112C7EFD674156178E7DDA80FA761F3BDCBB3D216CD1089AE8E8ADF8D4E79FFB39FBEB1C273CA94_cppui381),
+                            typename field_type::value_type(0x00969813B032A92FE93CBC6A3B335FD671A512FC5142751D32EEDB78C3C01EE16F3978E31C07D6DC8D3ACFB151F0B629_cppui381),
+                            typename field_type::value_type(0x043312C782BD750AFD6EF146859A4DC8CF3B72ECD0DA2C48DB176D62CC0031A0BE2C2BE885BD7FE35176E37C6583FAFF_cppui381),
+                            typename field_type::value_type(0x05B45CCEFE0D76F33E0D3E529E0FA1994FBF3D5CDEC55EDB7D53CC1B512EB7BBEA351A5B2B10FC0FD3E4BA2FE7D3F1C8_cppui381),
+                            typename field_type::value_type(0x020A63CD59E26108C717E058F3CE38E65A2BAD06B30BD439775FAE5C31AB144AF32354FB164D12CE1094FDC2A1DA77E3_cppui381),
+                            typename field_type::value_type(0x12EEAC34480FAC83A32DFC044CBFDC9C40A99D20083EE918EA5A569674C3013437FB5CFA6AA76F3AFA8C64AF01DA0D18_cppui381),
+                            typename field_type::value_type(0x163188D2D578E3F8AD7EBE349D140C709D8E46D7CEC4149E35569C6E2C01A4051A8A5B42BB83BA8CF0774FD41B186E4E_cppui381),
+                            typename field_type::value_type(0x014857E17B2A0EAA5AA6E4F7FC894C8437BD537EFB294E79FD253EC4D3FBE3B3D10F142E687325506111F54E8C78162C_cppui381),
+                            typename field_type::value_type(0x007604CA8889836E156C56B05815F5283A411DBD44972EC4529CF1E00E8B2EFB95B5546BD599922405AAC7E07FA2432E_cppui381),
+                            typename field_type::value_type(0x1039996CD20E7C643C50FBF8018593C506A2D8EEA53C7283A81CD7349F9A8688515E717F2DE7D8E4940FEECE69BE4B38_cppui381),
+                            typename field_type::value_type(0x049F27266D075931BB1AAF08EBA68DC10C59BB0A954E5D4EF1C335548675CFE4DE555899EB3E7BD5C2C5FD691698A5C2_cppui381),
+                            typename field_type::value_type(0x014799716EFE8DE165DD546C23429990C3624EF38420056A30D824FBA2ED66F32D53CF22E107942790D30C374F84E7C4_cppui381),
+                            typename field_type::value_type(0x11B5EFC9F901338F239F0A6F4BD419F4730167118238A0D4D4F178DF3976BB025B6092B48AB54C0344399982B7587F26_cppui381),
+                            typename field_type::value_type(0x012ABE96060FFB93E5FE6DC2CDA1C311E142AB8E0813364C90CFA679D62607B90AFA3E4A241EE93431D8D650802C7675_cppui381),
+                            typename field_type::value_type(0x0D845E72242F91BAA9C81E1BCDE640D5310C4381F32C8C31491675C234CFCEDF219D339B1C33D6FBB5472A3B16A692E8_cppui381),
+                            typename field_type::value_type(0x0904D8FF393372F4EA43B95F8D32BE8B18516B797A7A40302213E244F08224921A33F41408754457AABE598E2770A135_cppui381),
+                            typename field_type::value_type(0x1933F548DD701ABEBE73E0C67310DA62F07703501AB56EC034657821353AC38BE5E024168DB4947531D052BB220B882D_cppui381),
+                            typename field_type::value_type(0x03820056ADFC1355B45B23AFC75F986F1628CEEC77DBD3C5809204711CE4D8429166D950BF6D1C2029BAA7C1C75034D1_cppui381),
+                            typename field_type::value_type(0x136516942DE87C40C09741CE65D2973E75CDFE21DDEDDA5A2CD3F2ECAE4494C69945851FD872A3034CAAA506776D8AC1_cppui381),
+                            typename field_type::value_type(0x154B3260AC2819454C8EC0AE790E644726D11700F9D5F80531D1622B93F6B76C1314C65C116F865A760799A0AD933DA6_cppui381),
+                            typename field_type::value_type(0x0EECF0BA44F6485F536B698D49EA1704D3D8BBF07869FF31995A4D6521E145C845B5B03D973EBD5B5756EFDDC7F4F0B4_cppui381),
+                            typename field_type::value_type(0x0E8BD19BC84B4EA9ACB9B657D7E45932DA268C70C4B34FDA06F6259040923133E453FBBB0CE01F59B3D0B899C46065BC_cppui381),
+                            typename field_type::value_type(0x141CC0ED3FE9F7AEA5AD94ED8CED2CCFD275C7B5E848D590DC626F557D5E9B80B0C8BA99E86C533684D9BC3C3D3F3441_cppui381),
+                            typename field_type::value_type(0x0F914BF119A21C0876DC6B8F915A624F6F57695F7D40EF54A909D2C52A8C2A3BE149812577BA93D401A862E3874F1562_cppui381),
+                            typename field_type::value_type(0x03DB060DCE7743A6BAE7D1BE2140C42D5A9002796FB0D81B74ECFE2797C18801337F3623F23D107F39428C9D9583319B_cppui381),
+                            typename field_type::value_type(0x0E2E8553E79CBFA501BF7B02E412FD06466695D36ACED47666220DA549AA217C0BB0C8DEED16C4698FAA6FC320D418C8_cppui381),
+                            typename field_type::value_type(0x196DF16A15B4BE57200D6CEB56DF4C3C9F9E52431A82EF8A5F311AEB3BA31511B393D90EBB585EB63006F19FCAB8EF5B_cppui381),
+                            typename field_type::value_type(0x14F0952401AD61098D7B205FB7394DD86A61E7781AAEA0955CD32114D2140533711FE216DBFCACEAA90000B8AEDBD446_cppui381),
+                            typename field_type::value_type(0x06A9F2DDB203B6CA30BED8EEBD42453DAD99DDE54371C9F47A8647114EA6809C51DCEACD4601E60F15B2D54ADDF7A4E4_cppui381),
+                            typename field_type::value_type(0x0170BCF105A2C95ADE043ED57A49FEC99F20B610AEC00D3DB9E0912BA0965773A275D9102CB40C6757FE7EF9CC7AD6F9_cppui381),
+                            typename field_type::value_type(0x05DA0DDE23E353D6EC23C8C800713C4E0A33A55CA85FA4152986734BEC073BDC66F04F2374E7E8AFC2D2EDBB544E300F_cppui381),
+                            typename field_type::value_type(0x05B43DF0733775C15F83B41CEF6EF79D0E625C25285F61DFDDAF983B86811635E96F5E1AC8BA1168F01470F6CB66B01E_cppui381),
+                            typename field_type::value_type(0x15B5ACF7FCDE62D1206BC7EDD2BAF4C130929FE5D9B10D43EC17AA85389DADC4990616E94D6048093EAD55A7D2C6120A_cppui381),
+                            typename field_type::value_type(0x070F87C50E2CD28D65D6346B744E6FF4FB15B7D857B70E94A4B4F95F58EF1174758FE1DDE08616F587DB08ACC638F40A_cppui381),
+                            typename field_type::value_type(0x15944EA71940E58644332C697B5EEBB1DA2BE3B254F4996E7277DEF5E01D19F907A53C7729122C2A65BE97323CAEF113_cppui381),
+                            typename field_type::value_type(0x188EC0F6C214482600BC5AFC3FF0F542EE8D079ECA78CFC9E0CEFD7BC5E3E8620A8BAA2AB5BE49703239E72540B9BAB1_cppui381),
+                            typename field_type::value_type(0x0F471BE023372E3C5062AF8FBA42D138819DFAAD04D5ACA6EDFDA641E43D1205E3899C73D4421C65D8C2F59B4C5F2662_cppui381),
+                            typename field_type::value_type(0x113518A56ED2BC43D8673D10E3AA9975F1D5A589B04D183F965A736BA5D1D0CD30A1A120673917F8969D906FA8042A5B_cppui381),
+                            typename field_type::value_type(0x0C2D434E06EBE212CB59DDDDB6FF3F432523E67BCD95559E44404F9354BDDAAB9D0495695FCAC5B51D50E598880F3B6D_cppui381),
+                            typename field_type::value_type(0x060AA1307100D28A9C44CC5144F04A3EE426074A0864FC6E1C2B3F4BB7A8579E7473612DCF4357BD59D6560F96D34480_cppui381),
+                            typename field_type::value_type(0x031152C621AB7CA0E5A2AB1CBAAA2BE88AE9A807B36465B8A456DE882C324863CDFCF5B5365913FECD5EB4667FE5E1EA_cppui381),
+                            typename field_type::value_type(0x0CD6AADAA1D0C97319755DE1A1F51C338614E44DDDC6AE7A4ED73767C669604EAE8C69C568F188040A4F13E758DDFD23_cppui381),
+                            typename field_type::value_type(0x14FD89DA1DC8913403E97E758E4BB16F613CE63F27F846396065D8641C7B26E95D2FE95E7BB0053B59094152DA71AB45_cppui381),
+                            typename field_type::value_type(0x1401A3BB2AFD556E38BE93151A63E0B57466396DBBE1B7FA30D18D1446432790AC356C04F0BC209F99ADC1172E1CB7C5_cppui381),
+                            typename field_type::value_type(0x136AC7B2F24A0DDD46AD5466977C003465C3CA893F838BC338223EBF6F052863FBDFC149A3D1EB189C5DD6EC0D0432F0_cppui381),
+                            typename field_type::value_type(0x14608153254E937E7A487258B28873D791947FA757E5E7DD5695F082E89E342285BD8E16081962EA1D8BF9C52FC11785_cppui381),
+                            typename field_type::value_type(0x042612CD5F16A8FFC1B9BE225413BC8384C98B8664DA02D6475788B017649991CDE840E63FF4CEA2278262BF6FA3E93A_cppui381),
+                            typename field_type::value_type(0x190219B6D9B91FE2BDA5A62FC0B2EF0EA85409A61E8D4D28FBC9BCA551E083D81EA384A429351816C1B91B3697BD24C1_cppui381),
+                            typename field_type::value_type(0x0783B0793BD9132F5CB122350EB23413B3FCBFD53BD5A9938C573F44DBDA6B02AE8BFE480B466D5A66B77077999391D2_cppui381),
+                            typename field_type::value_type(0x19C9673CD3054F34A98ED03D7FFE056FDE038CC0CDDF364F2FC8C146B6556A88192E48527F260EADDE1695860A8954D1_cppui381),
+                            typename field_type::value_type(0x186FF0CFD988056BEBD93FF295C92261E8F124A0322C34ADB6165DE6ABA0BD39D2597FB8FCF1E5C7EEF647313FF9CC1B_cppui381),
+                            typename field_type::value_type(0x0020779B48546E091872ABE854A0DF7700A47E60BB98F3BC1FE22FC2FAA0C413D396A6B727A5F7C4D1D52AF68856A2DD_cppui381),
+                            typename field_type::value_type(0x0A1374F5B02A3409E4B4B5906CB5B69C13E18DE042876C1EF9E332394ACD7B7605F42E9F8F7C705BBDE80E8F83A879D4_cppui381),
+                            typename field_type::value_type(0x0C1D556949B6BE9DBBDD340BE745822EA63A2CF0FC8CDD98852153119F436F395D275258AF238C5FF90664CAA219068D_cppui381),
+                            typename field_type::value_type(0x037C862766E73694F77FCCBD45DA218D0364D8D3800F42BC6056FDB291FC812BD73EF134A0037DD157DD0A7859EA3D25_cppui381),
+                            typename field_type::value_type(0x1395C50A8BBF4B92C185CBD4893691716AACB5CCB04BA2365562265519946E40F8F9F85C610E2DCEF27BB3BB7CA6E58E_cppui381),
+                            typename field_type::value_type(0x0AE43299DA926FD7B251652C466982BF1C04C97A6809AD80068649DCCBA90A952089E31DDC151A35A16BB18A92573155_cppui381),
+                            typename field_type::value_type(0x0B00E0EF0A8671DC4CA5405F2E1148C3F6D0B2EC05D4CA259EA0BE447D7294DD7C428323D1E8C35DE8AA14300AA93128_cppui381),
+                            typename field_type::value_type(0x14296D0DD945A1C212B6707EEFAEAADA986FF056F1C2283D47D3E9C52BF93BF9CACA0AAA3E5341CE2731595C844415CF_cppui381),
+                            typename field_type::value_type(0x112E5433D1AE0ED73DAA8BE9AB8A1F5380510ACFCAFA07862D845C50572638CDBD7861DFC2C6EEA8A138A19296151201_cppui381),
+                            typename field_type::value_type(0x10627A51E4B668A67520E7EDCD9C4349735CCAEC4491A4AD0A71EC0938EC9804EF58C727DC2E05CF6D3E88AEC7C50805_cppui381),
+                            typename field_type::value_type(0x0E896C950980F95F27E07382407B3E2E80777D84FF39607F415FBDFD38FCA2B6283BF6AC439402B7406B9F3BCC03A157_cppui381),
+                            typename field_type::value_type(0x004B7743F99CFCA5011AF175C6670954DF1152361EE4FEF17742CEF799554E705A007E8A15475E15B0A508C8A5E76E5C_cppui381),
+                            typename field_type::value_type(0x032E2802689391E1DC8C1F63190F004D920B5B41D495F4776C92E53D18F77289E4D2F43630E3810EA6C9016CB3328C36_cppui381),
+                            typename field_type::value_type(0x09223F5A00F28129165C37B560A994381B05C225A67B8F6C71AD89D19643864EB6893751084F8B1F8434D47C93AB6749_cppui381),
+                            typename field_type::value_type(0x027519279AEAB6586B85502CC6AA8EDA4C1168497D622C4BE9F8FF1AD6989C528145A5EEC8FD0C7D5168CFC86F388FFC_cppui381),
+                            typename field_type::value_type(0x0A031843DE2290376C2F0305333C489699FF3D9BBFD29702975A94B5AAD88E9C18B3F3662F94CB20D3F39F8F8F561FCC_cppui381),
+                            typename field_type::value_type(0x0EED0C2D077D1B9B451F4E46A035FBB80196AB30F8AD8C6404F08167E067C396946B05F3349BD18010E253A7112512DD_cppui381),
+                            typename field_type::value_type(0x0907188717F949A97E5EDB2CA0C527D89AB255ED29A535B5859F3A2518B4083027B9CD2C54038DE3DD47BF5C8233BBAB_cppui381),
+                            typename field_type::value_type(0x1201BE6BAF9BB80FBFA7EBC2981DC2CD9254A59FC4E0A6543D5AE49987898B7469A3C82EDD612DDE54CE20D57C22C40F_cppui381),
+                            typename field_type::value_type(0x033ADA0F87C1AB8470BDF43413665B397C0C9A0AED67496911CB636104632A83D48059C0A933893C0EC818F40B17DFF5_cppui381),
+                            typename field_type::value_type(0x0916AB4162E0EC64E23818635CC051AC4DFBC33094F054553290ED9AF2F42DE1FC5C95B11DE952152F7A7063E82FE42F_cppui381),
+                            typename field_type::value_type(0x043683C9BF6223E7AAAE707F2CE381BC73ACEC9112037FB2DD2E1EB510E06D928DFD1AF2511224AC7FFDB86AED4096F6_cppui381),
+                            typename field_type::value_type(0x0388FAC3702958236D888A1A3ECDD9D431E865A1B2CA3A742D720A706C7C8EC52430E0B915C2E81976D30D85396E6D53_cppui381),
+                            typename field_type::value_type(0x133BBB713358A28C40B998D16B3E00FD967F60DEEAB1FFA819CE21D630F18EBC38EBA6473253A911C9F4667C36B7E7E2_cppui381),
+                            typename field_type::value_type(0x09C2416B5F25EBCD1FF693241FBD29BCCA40F79E3BE53A3176806CC0E6D5C6E49150E472FC464E9E444D075DE16C7F09_cppui381),
+                            typename field_type::value_type(0x0BB92CBFB5824326BF8863C6378CEF35E3F1A1CDD5923B1F4CDA5B24D29473C39F15B75C60D9D840F12C49823ACE0222_cppui381),
+                            typename field_type::value_type(0x12A826652AB208B93FA6357A0D83CFD834864B99DD3FAC1831EF16D17EBB85381B881604521012FBB8E147F372350444_cppui381),
+                            typename field_type::value_type(0x133894CF98407126532AF16E811C26C0E4D2A0E83979294BEED90776CA652B97506DB4508E86E0F919FDB39CDC2FFBD1_cppui381),
+                            typename field_type::value_type(0x080722F1FE8A2980E67644DBAFA9A4B02F67925FAC2272DD01F9D9B5D4A56AD65B46FCD7DA668C38461327B518DCE65C_cppui381),
+                            typename field_type::value_type(0x1769E4644DF2C11DA60BBB6B25C9439EFB3DFB7F8184EF4D05E5D23EDDCC5932AC84F3A7F0D3CA44C26ED2914022CB94_cppui381),
+                            typename field_type::value_type(0x196E2214D88BB43DDD5D05D4D4F77545360DA4042736C9508CB6B42A257BDE070E2866E2E9E9246AA975E95F410B4AC4_cppui381),
+                            typename field_type::value_type(0x1307738A7C34DC6EDEF6E90BA2ACD259C2E86AFB060A2D54E7E34B94F066B8733C6FFB764742702B98C6E3F83F723FD8_cppui381),
+                            typename field_type::value_type(0x1782DE702431D5AE1FC883D1359338EDEDDC551014DD25AAAEAAA911ED5092C65F7F81A9C457DBF5C3871A59F53F112D_cppui381),
+                            typename field_type::value_type(0x159C01813801BD3594CD3BB79D91A97C36D3B5826316945C365AF7AD46F841E3575BDEFCD28FC9F4E0A09D744698D6CB_cppui381),
+                            typename field_type::value_type(0x0A5154EC390033EC78CC79584004DEDE9FF49B4E41197D6445441D7F31D2236F3939FDA0E0373285EC1AC641252F941D_cppui381),
+                            typename field_type::value_type(0x0B118BF4F4B769609EC60C352DF70D23DF26F87BA2078F657593692D67FCD9664B1C749BEF8608858AB939CA50CEB856_cppui381),
+                            typename field_type::value_type(0x09CFCE6ADEFF4CC6BCA9B8DD690D85DE27EBE12EED2FDB484AC1C781894F63147FCEC4BFACC8B1C9D8BE60B1E3915623_cppui381),
+                            typename field_type::value_type(0x17A38508E506022FB76DB2C8F0EB1C1D710906618742B239F99F10211EDB0A21F397029F9C5B6F63F98FA5E90533AAF7_cppui381),
+                            typename field_type::value_type(0x157FCAAB055E2D13398B11EB4FD83EBF4DE0F1B89D0E549DF3856EF4C3CF9C89AE0965C17A49465ED8004627607E6CC4_cppui381),
+                            typename field_type::value_type(0x04B4981B06E9A58139045B2674B24C40A31200C06E623B9010D78004FA53F45407709DF7679477716507B362EE3D74EA_cppui381),
+                            typename field_type::value_type(0x0822FCC22576CED2EB329304EEDD940093A31E9C88CAFCF127C3A67C690C877D8D98D7701B40E2952CEA2C0909B62057_cppui381),
+                            typename field_type::value_type(0x0DD6963A71B01ABD4FDD72C255C68A031CC215E719365783D32263E365098086BF9BE8E920C3F88752EC4C29B234E393_cppui381),
+                            typename field_type::value_type(0x01AB48B49DF0DD884BBC57052E787D7DD05346EB153E067F4DD9BAA1E18D93133A5431301DA13C241E37EE5FAB6909C7_cppui381),
+                            typename field_type::value_type(0x19B31CF9227CA1E7BA56797B571CBDDED6E3B573028926AC5104554E8AAAA3876E82FC99C30DADA8EADEFA1B2A698875_cppui381),
+                            typename field_type::value_type(0x037194203791C9EAE22B1B345B70E223233230C5E5721CC25EE5FF2EB336F9701276748787D0BB41DB5E67A524871849_cppui381),
+                            typename field_type::value_type(0x09A90969BF61776A9A785DF0D35C6F21F3985D850CE1F0F11A90DB0DF141523E1C3B98A1355368A3D27B04AF0DD2D7F2_cppui381),
+                            typename field_type::value_type(0x083A215E06DA1603792BA00D148F600D160AC1734774A894E86E3241D5E7933366B0F6B00541916035453ACC27BD7D62_cppui381),
+                            typename field_type::value_type(0x0104FA818E66F5D348F09EB27E1EAC02A9E00E80149048DB9200B5A5CAEB8AA8A6F272C3F2E13C2424983C17A73A8214_cppui381),
+                            typename field_type::value_type(0x10F3F7B44F2AE63CC0AE7A21F226999C9E02E08DC92E23DC0EB430E1C5AA48B11CC582AC9EE758924FBCC0B1EC1AE43E_cppui381),
+                            typename field_type::value_type(0x056CC1EECE52D5CF77B33D4889E3FDDE845FB28582855F52F8D190CBFFCEBC1F39529C9ECA28DCE4F8E517DD130FB797_cppui381),
+                            typename field_type::value_type(0x0263D488E99EA018733CE1012E7B8C15278BCBEB0A77696EA4589C439874AC08811083B00441F08EE6AC5250D1655F54_cppui381),
+                            typename field_type::value_type(0x01B6BE4C00A2C9669F05F9D28F59676CBB7D575C802B7167C7092AB6522838E442BB3F6EF6266F1F0E8EAB905D872C8F_cppui381),
+                            typename field_type::value_type(0x0CFD73EFFDBF9105E5A679040466280F03C02DA94368222A05D83FD756D4C2AE341B73039CFE60746CD384599B850214_cppui381),
+                            typename field_type::value_type(0x018A3F2B2B21C8BF271EAA9A0D8F74E8F963246207CA5C1A7CC4BB97218F229A5AC04B3854DC41271A481FFA990CEF09_cppui381),
+                            typename field_type::value_type(0x0260A905558E367E64EE72FD5CD751B36582FAB1E9545A1C8D5E01FF0C2E4CE4C5CB3D9BCC7EA6A9F95B8B275C58E9F0_cppui381),
+                            typename field_type::value_type(0x003E34433446135E6B481F1B7DAF690158142AAB4C3E47FDE9B012E4AD0E9C40680F687CE8740A9AB622A146049572CF_cppui381),
+                            typename field_type::value_type(0x04D9399CC0132BCF18F653D3BD45FCF37EF576F72913C82140446E043B275B62D968FF37304B6D74BA4612677223D732_cppui381),
+                            typename field_type::value_type(0x006B099FB4E1865A7346F3026CCFF6E91812D9E36E567925F7D2F69A7059886AB27FFC90DDFCB42B1F37F76BF54A765A_cppui381),
+                            typename field_type::value_type(0x09276FCF28F2F0A898E10ACF96010714A09DB508A10FCE3A598BC0A55A6ECC9244FDE28DF1DD12FA1C5F5B844C58BEEE_cppui381),
+                            typename field_type::value_type(0x14479A959CBA76595C41505759C0067183C2167D725F55A0B41B1DC2921BACE443C1BC9494ABFCC98A00989923A5175E_cppui381),
+                            typename field_type::value_type(0x199162F07A6BFC61310F23ECB0F68D370A7B34EBB110AA48AD0F392CB7CEFA3126AC0F65CB439196CEF2FD692831DC66_cppui381),
+                            typename field_type::value_type(0x0204F0956ECB5CD00E1D21DD98450977D4966F670526F2758277192740CA9E6F7E35D959A58E66FB53AB1A233FD9A628_cppui381),
+                            typename field_type::value_type(0x08E79DD88D43FCA78ADF7EDADFB106945C41A2E3B4D79349DDBE36C4E42A6CA3758BEC6BC37FEB5D62030ABE699332C7_cppui381),
+                            typename field_type::value_type(0x190E9E459AB8432D46F17AD2CB0FDAEFFD5A7303BEC686550A5548572E7A573D1A20B715DFDD68B658232B5405A475F5_cppui381),
+                            typename field_type::value_type(0x0082AC968AD7EBAFB37CB27119E2AC5D36FC5D9564D4520AC1D0D5F833BFD040B3DFBE851CC0D43698E96C0155035C22_cppui381),
+                            typename field_type::value_type(0x18CDB809C9E337C916110A48BF005B4B0B3C64E6AE162BD35A5F25CFE1D0C1C04CAA0691047BF48036C1C305508B09E9_cppui381),
+                            typename field_type::value_type(0x104B41FB22534C6EF5130AF51F7727E99C8A498E89DB9795154A15853A2B46F21E6F5FFACDF60149BB791BD4ED813045_cppui381),
+                            typename field_type::value_type(0x17AA1B089420001C60EF62D1A294BFD3B1DEF00FD7E9C3341609FE2570A031106A5E4A13D8389E27D38CC5AA1AC08824_cppui381),
+                            typename field_type::value_type(0x0D576E25E30C0C6F3440D317B08CD765985A84DC5ADC5544FB2F24210FFA5F8B3322EDD66F3BE0FD940D0D9D1A39333F_cppui381),
+                            typename field_type::value_type(0x1511900BD11EF8322936525CB3946BA4DCB3D573D61A72373E652B3E74259385D1118871589870A32096C4CEBF3D6DF3_cppui381),
+                            typename field_type::value_type(0x17AE568D5726ED1DE5C9314F2A5C00623226C944B764782130B67BF59C4B0055FB052AD0736B5A9BB094608302DF396D_cppui381),
+                            typename field_type::value_type(0x00630566008C7E16B2612CC4DB001FB95FDE532294448CAB2E00A760917B361E92905B01777D173B4A84E4EB1EB60AC9_cppui381),
+                            typename field_type::value_type(0x0E9CA36FB88E14034B2F36F637CC995D6FE1C84A369EA158778A1AFB7440F1B96F8830E729062D7944541740B714D08A_cppui381),
+                            typename field_type::value_type(0x0B1BE0E3C8D3079E10BD008F92AF3DE3DDC12E4002CC0BBDECF2086B5E08C26C6C68A868D8E1D91884193ED69590A9EA_cppui381),
+                            typename field_type::value_type(0x0B637092659202CE77A3214F71DA8DC030A97F9744A2537057696515D2A44DA2D78B2C326A2624E9D5D9377D6DB7A885_cppui381),
+                            typename field_type::value_type(0x007847ABD2BAAC5F646F86859C4BA3156F0B7FBBECFF4B065855035FB053DEA52EA01E2138F41BD8A0409ECBB0445632_cppui381),
+                            typename field_type::value_type(0x1650AB6F3C8978028ED0C7137D25000A843029C19404CD1DD66C076DC73F16CF9E628E31DFDCE93B0FAFFE6E7B4BDDBB_cppui381),
+                            typename field_type::value_type(0x14A064780183F86596B764C8C21A1F9C72DB82C47C30B4D314A10AB37759B5F5020BFE88E8F8B023C467F63C5AEDA7FB_cppui381),
+                            typename field_type::value_type(0x01DA0FDF1159ECCDA730125D3C191C1A112F6D1ECA71C584E804780A878CB3C49A13CA95DFBAEBFE45849B87EEAAF523_cppui381),
+                            typename field_type::value_type(0x0A4436AC7FB7FA3725BD2EB15EF164DC96306E22171F0F281A74263BE150898653D7830BAD34756D0EB5B7DA427A64C1_cppui381),
+                            typename field_type::value_type(0x16CFAA9A18E4F2AD779F0768ECE048EA1E811AFB6E7AAD88E54F4128035C2D611C1E73AA0C61D5196A325BDF2E043152_cppui381),
+                            typename field_type::value_type(0x095B38CE9E01B02E6E98B632C2DE7AB6319CD96AF7BD885D6D1E16F689181880874ED0FE524454EBF12591A1E20368F7_cppui381),
+                            typename field_type::value_type(0x10F170FD80F236E8DD9ED7795128CCD91C34A42D602B3284B3E562DF995AF4C46323A0568C72CDD98565396F4BB24B3C_cppui381),
+                            typename field_type::value_type(0x161A01ED3BA68842903CB9F69A052C1E4EE415DAB54E9A43CD6017EDE7F967D82E36D277728D9C060B4EAFF99EFA1AD9_cppui381),
+                            typename field_type::value_type(0x18CAD0F66815B6D2BDAC76A93E0B15AAA74B87F7B53967EB8EFCFB714F326B149AA01B57B5D6B41DAA4266A54BAA3DAE_cppui381),
+                            typename field_type::value_type(0x146BAC2FDE2C57A2E761D153D1744427B4C0C6F7ECB514C019D3FE35572A729F1C2AB9190B2BC6465FC10ADEF120074C_cppui381),
+                            typename field_type::value_type(0x0BB3972FCA3444EE8109CA8C4F5F370F596A2E1D9D2BADAF7B643E6894CD11DCDEEC8F9B3A46554FC27069BC45604AA2_cppui381),
+                            typename field_type::value_type(0x14F8339197F977A511F65FE7B62951AF1531D3C06F064484CB1545D8358BFC176DE9D57701C800B1509258C30177C1D4_cppui381),
+                            typename field_type::value_type(0x014AF6C9BA554F4C73357D0E3C947E6267834383469F40F7B96B6130699F7E00CF2CDB1C8F2ADD4887F3E8B93A0A8BF3_cppui381),
+                            typename field_type::value_type(0x0FC19D90471A8532B787E5B143C1FE6B27F8AD66AB2E621D05A4F71EAC660295CB7E84121FDB830676CEC721D7C12804_cppui381),
+                            typename field_type::value_type(0x03FAED8ABBC86FC218C3FEC62C34EBE10D967FAC6F441C082FF61D4656B548E2A09C474541C8DFBE8793CA3C2D406EF2_cppui381),
+                            typename field_type::value_type(0x0458AD64A335AA3A5B751E8BFE02D0266825D1821B9693FE559AFF6A7A704AB3293DF14BF31ACAF7EBA48885BFDBCC94_cppui381),
+                            typename field_type::value_type(0x05BBD5E14C75FCC6508318600B69D52DA01B169B08D2F66BC458DFFCA74A4C7863C740CAF3D9B7F719487F2EFA4F89B2_cppui381),
+                            typename field_type::value_type(0x17253BDCB84BB3DBF0CD9CB07E59B19D0DF3C324AE983BDB9998C15FB8DDC971CF9778CA1AFB302961739176851C8D57_cppui381),
+                            typename field_type::value_type(0x10399875CF5F9B54308D6BD9AB385AD7204D147AD972022E30D2E5E8F31099328251B587FB0F3F84AFB5C588872569EE_cppui381),
+                            typename field_type::value_type(0x06B07E620FCAD7C8878963E1F322683D68845776B1D02A1DF2C5E35699399AC262F76B5B410798012DD6A15C78F59C58_cppui381),
+                            typename field_type::value_type(0x13ECE2FEE8B5596FC960CD3E02DF5D3A43AAA28505576ABF06BA39E37D65F93CB55300FB1DE1A885413375AB66019001_cppui381),
+                            typename field_type::value_type(0x11939887CDF5BF42701FF4109C4064A803C889C9CBDC54962F9F0F8E4914EE067694B443C4065E9F99A4FB789246A421_cppui381),
+                            typename field_type::value_type(0x0CC8C55B2E751FBF6DBE203192F8A0964234C197232EBDE2AA27AB57F703545550E192376A58BB7D3D29FBD7F5C25673_cppui381),
+                            typename field_type::value_type(0x137A27E38426506BD82917240557AA0B7F461C210C6E043BFB469BE4789F66648654D8998920843655778FED28B86A23_cppui381),
+                            typename field_type::value_type(0x1403372AFDF553222382E762CF0E5742D7BE6B4A07E4197D03FFB0580DDCB3E764F671A4FCB9270ED6FFF3512CF6DEBB_cppui381),
+                            typename field_type::value_type(0x187B18B56CB85EBDAAC591894F05D03E50745A9DE4190FFB9D8EC451F014FC73A62F5F16D2AF55C57EFF50CE63ADA1F3_cppui381),
+                            typename field_type::value_type(0x11AA03C6C50D98CC69CD832274F8990B0EA67ADB1BED7D26EE8B9E6EBDD995E7EB6887FABEC2DE6F0372AA847C3AC8F1_cppui381),
+                            typename field_type::value_type(0x0F69ECFB9FCA47F00E03C0FD5DC57C5879D7ECADFE91950502A45BB69390B2FD933C692FEF098A095E1D39A815238B2E_cppui381),
+                            typename field_type::value_type(0x01344657597969F64BF65D7AB666B1EAA93320DBF80CE5AC5C0312F2F1C19E98D7589E8F4CEA9D91D73E3FFBDF646A8C_cppui381),
+                            typename field_type::value_type(0x0D282DB403AB6917796BF1BA8A192306448E38CA23C655918D876B728650254C77EF15EFEF18E146D94A2180E8E74230_cppui381),
+                            typename field_type::value_type(0x008B6556A0AB5402AF3521ADEED650ED4B4AAB888CA89E1C38AF41B8DAF572760E3A14C217DD040BD206A84EF0C30E85_cppui381),
+                            typename field_type::value_type(0x007EE14D477D826E466E4B3EB72657415D03CAEA83EEF1D4EAEDB8F80907B724E82E1B3942BD3341A6045783144B6B12_cppui381),
+                            typename field_type::value_type(0x00A89D2692EE2A876CA80B9BC7303F8BADBE2415E71ADABA2CAB3245651E8503811DB8410133291AB102AEA128A21F81_cppui381),
+                            typename field_type::value_type(0x050EE77650319B1911188A7439FB08F50BC2A569BA60D8BD82171289A4EB7FA848DBD77ED1B5F458E4C197678F3AC530_cppui381),
+                            typename field_type::value_type(0x081783E0E0B599B5620F0A3E104E7E6486060F1701CB6620798ACEEB0992D5199BB778DE8D3E49CC01480DB8D10B3629_cppui381),
+                            typename field_type::value_type(0x0E0ADD2B7CE3B02E051CC0008BE91B12273614F172349E710E8FDE15883AFDF430D69A277DA4666B4AA52D1D325D9706_cppui381),
+                            typename field_type::value_type(0x17F51009929AFA911C524AF9C0354FAC7A1049550AD1E8A1670174BD5EAC661EBBCD51CCE5F63D30A9C7D5B1714362FD_cppui381),
+                            typename field_type::value_type(0x0F2E7E8F39F26AED5C33DED7D5DD7DDD6B4C4697E2126D2211541E6439AE516D962C7EB5816AE5A4B63708E251948524_cppui381),
+                            typename field_type::value_type(0x0E5A1923048A15A942B2B8816CF9AF87F93E3B244CE69F128458C1E20F79165404A0F16FABB21263049E5ACC7467B00B_cppui381),
+                            typename field_type::value_type(0x11696DF723B559FDB194B655CFDEDDF9C7D520BB705E5BA0A4B4DB9CFD907D468C2B7148939E2EAE6D151FB13DDCE6F3_cppui381),
+                            typename field_type::value_type(0x179FCF94471D5D9AB1DDFAA88E2D54E8D8D37F64088B06A32A13B45E59F94AEBDCC9208459653F0FEF79FEF4CC328D06_cppui381),
+                            typename field_type::value_type(0x15BFEB45153EF2F184C3F642D0028A36CDE672FC74D0999B293721511D654617850FB1AC6ADCE73468C15F2E179F601B_cppui381),
+                            typename field_type::value_type(0x06E9096082383543139D9499BCC944AB6C7264F5ABC94C70680FC9570D25427F9F409B6E5A95AE56DB80C426F42C87BA_cppui381),
+                            typename field_type::value_type(0x1494CBD57BEA27BB3A9766D78579885F343C944AF1A86CC67EE8AC9DFC872888A44C46A0AD70B1D183B6BA9C2627F631_cppui381),
+                            typename field_type::value_type(0x0E888C7163F404F96CD3F27D4995D8CACD26A00A2463F781E08FA210E19E68E1E50E780DDD01BA500F41CD4CEF5A5E01_cppui381),
+                            typename field_type::value_type(0x191D57464E5AF96C02A27851314C65A76CF20F401EC01579D72B704C9E5FC6BB55889876E777C9AAF07461F8DD63DE47_cppui381),
+                            typename field_type::value_type(0x06FA1A699843C8385E49FE822DCFA01A1EE992659C70869C8BA6643A48F7A4EA9ABB82CB1BBC7CE841A5600733B2740B_cppui381),
+                            typename field_type::value_type(0x13A83B5686881F94114BA3E9A3275966BEE92489995D1026D5167310C6110467C79FB8ADBA3F7C0CB917A5D049672DB1_cppui381),
+                            typename field_type::value_type(0x0CD299B7499E9D12CD1333214BF6AB02A4EF83A7D16EAEFB8D1B9F36A35A29F3E9C64B83EE06223ABBA21BFD1A9D9058_cppui381),
+                            typename field_type::value_type(0x17CEB22AC4F087C66A367944AC77DEA8B2D21020330B5690899A8108AA57E582BBD3CC8914AA7ED9DD7568476AD16BEB_cppui381),
+                            typename field_type::value_type(0x1159ADFCA14335C0F5A55CB0281C6749EE5F29396729DA8C714A82F9C85556D738F1DD37CF8C650263D7869669B61DDA_cppui381),
+                            typename field_type::value_type(0x1746D3072EA4CDDEB524D1A34ABC76A203837939F0BEF8CAE13D4B840743823037C68F0DC60AD46618A2AE0014D1582C_cppui381),
+                            typename field_type::value_type(0x095A11348D02D4CE453C67BD2162F2D6CE71908360F347564F3983850F7D284F9C69670919387C3454705FF4275F3286_cppui381),
+                            typename field_type::value_type(0x06A0D9A0D7066FB760E61A4C9C4CA233ECE03AE115E3E22C9FE0E2CE171EA38EAA9090B66EC8D7E57E7191737C688152_cppui381),
+                            typename field_type::value_type(0x00AAAB032BE9A50D64572CE869886071855332FE313C42A004CE21D7A6311A1494270A5245787B4E10650FC58CC53DB6_cppui381),
+                            typename field_type::value_type(0x04017EA54CF336B3389201FADD4286DAB43C011C2F269D2EEFE182A9D99CC495B584586C7C1C94501918D8982C86B649_cppui381),
+                            typename field_type::value_type(0x160C7289A8F0D35BAFAA59EF3AF422ABA5DB09C5654D5070C94B4D17BBE6165BCA5A4FA69E28F590A26A89976A2081F7_cppui381),
+                            typename field_type::value_type(0x0BA00AD1A2F79520F7B684F0771A22E99CDDA5602CBB56F2DB997BEA0C02471AC1C2EBE0EA22CA1D37B0C32AA720CB20_cppui381),
+                            typename field_type::value_type(0x027B4D8CCE11DF6E162402F9F6FDE9E4BE7D81A18EB6BC6ED4DB2F987A00121CED0956AF3E90FCC28DD3314A1484A805_cppui381),
+                            typename field_type::value_type(0x1468A9956FA34C3D145E493FB1E7E642042DE9FBDA38755049FAFD8BE4EA31751DA31E8CD6CAAE287A388C29202FCE5C_cppui381),
+                            typename field_type::value_type(0x05DDD61556ABA68C6737446DD43D6E9402271BE6A531539D183FCB396BBA5E679B557635DF8F96D623054295E84DEBB5_cppui381),
+                            typename field_type::value_type(0x06B7AC96A54C50EE33E03882082A9D0CCA0B1D85E28608D762A987195A5B9331931B023568EECF05AE04DE39F79826DD_cppui381),
+                            typename field_type::value_type(0x0C44316DF72A9038C945986C6AC26FB1CDC6CEEF178756666831668338A76090B9BEB92DC24BEF77C08D016E3A00FD72_cppui381),
+                            typename field_type::value_type(0x0C2C029180C1927417F29DE0175B9FC92E42290305AE100479E5B31E846419B843F865FC443CFBC2F6FB45D7103AE150_cppui381),
+                            typename field_type::value_type(0x0E05C81B2172DACAFE897FA955CB836BE447F0227D6714F9D13F18920FFD6A867AA747EA74FCC985421F492689D9CA3E_cppui381),
+                            typename field_type::value_type(0x0E2319E5BA171DBC7732330DB9C26AF61DA1909A444748B3402DAB6704233C5DFC48F2892C16AC03362DFF8F78BD995A_cppui381),
+                            typename field_type::value_type(0x07506E73B76A08FDCE1A2148714BC65DAFA486F9F44F66612F9A400767B1B783B7F1AEE740046BAA4C50CD1F688BFFFA_cppui381),
+                            typename field_type::value_type(0x11142620DED1A1C1EC850C62677100535E5F53D72FB6E07E9B6B93EA17E7CB0A822D8CED25B54A4970951665AE99F995_cppui381),
+                            typename field_type::value_type(0x19CB82146F999F8075AB9F3EFC73AFD461C0DDB44A3B836EA0CEF566BF1CFE8237F8CCED3E58A51711E93A83D41859E5_cppui381),
+                            typename field_type::value_type(0x0723907F746F08BC497AA73C786EEB30B975AEA22C860DB88BB53795C7D7622CCB4E2858CC5B984F00088EC784A53559_cppui381),
+                            typename field_type::value_type(0x0675671D93C9E15A29BC36605562CDCE8CB332216E74DB570237E1C1F82B5B87F1265DCCB16D38444984EC739CCA219F_cppui381),
+                            typename field_type::value_type(0x17B431939CB5F66C007C145AFF43828FC5D3D252BCD03CDEE4DDF6ABF12E08AF5953969539F782B66120EC3AC753A2FF_cppui381),
+                            typename field_type::value_type(0x1508085AEC653EFB627AA0D8A1DC4BA6900FF963F46C8BC9D83F4D7854A0824ACEE5E12C23EFADB559B04C8514E93AC9_cppui381),
+                            typename field_type::value_type(0x0ADDD396276978B986630A7E3F1110F29CAC5CDE20A93C37D3656EE5B926965489DC086738C6DB607C3CDDB7F468AA55_cppui381),
+                            typename field_type::value_type(0x04303331C1F05150C9FC0A0BCC1108E163083BBE1A660F7206182AFBA9310DE91A11A129B3154C79791C5421066C1C05_cppui381),
+                            typename field_type::value_type(0x0F5FA45C8C4A69157C40A1E17CEFD53EFBDBD422C93159EDFD2D62CBCB043EF778DD2E894EF2C818F86F84DD935A68A4_cppui381),
+                            typename field_type::value_type(0x0F67272A548D8998BDBA5937113BDB25FB962B89DE5F16B4958840870172C22262D3CED5A4B9064E3154B0AA5A1EC7F5_cppui381),
+                            typename field_type::value_type(0x1760A549CED9D35B6CAECB72925557C6B98ADCC02ADA31B25A615ABA340933ECF79D157F01DF68C6C7349522AA1DB336_cppui381),
+                            typename field_type::value_type(0x0C881E0E5255F290D04A0A3231AEBA8B5B41BEE12FF3A29AE6CDF09AAA5895D18E8E4C26632077C627020238461F8730_cppui381),
+                            typename field_type::value_type(0x07820A16B7DE1A88E244418B1C760ACC64310590DE426E43D14C958F4BE0F946C58282415965665AA6FB29558E759768_cppui381),
+                            typename field_type::value_type(0x136E8A06D723B211775B749C4E9AED83BF0AFF899C09965EEBD82492A678370191E0FDCD0FEBB2D31FD0EE71B6A6C005_cppui381),
+                            typename field_type::value_type(0x00A347DFCEF2C25D09486240108293BF35B71B5E5C182C5051BD891C9AAA7AF78672B5AB4FDB9DC8BCAB3174E66DFE80_cppui381),
+                            typename field_type::value_type(0x1837986FB013B2F75C87EE18474CE2293E32B94AF2A4EB79570AC1ED570FDEE1C5C66CFA6EF6202561171B38463F9082_cppui381),
+                            typename field_type::value_type(0x0EE0AD5D1292FF1E2F41FCE76EA162B682EB259101B89C09C64027582303D57B40ED1EC145C39629119278D950373253_cppui381),
+                            typename field_type::value_type(0x09202FA26B7BF3C61BBCD52E6600B48E6EE7DCFB8D9D218309E455CF22200E90BD3940DA98BBD388233A4E6C988C5960_cppui381),
+                            typename field_type::value_type(0x05D8DF76BE5A2C929BD3BC081688F1060D9D72C333E5116B12E7578450B8E66659869F919905196A07F616255940B229_cppui381),
+                            typename field_type::value_type(0x0DC0D2AE26B4940862E4D86AEE85CDEB75B7DBC0DAD46A0A5F725C5C0D2A4F8731812A09FDDCABB8B82A77CA41A20A25_cppui381),
+                            typename field_type::value_type(0x18F65BA01DC0D5F5AB335C7FAA0B3A1A80A6594437991C1BECC3D6DBB19FCC2691434B0238BBC42D04D1C73176190F23_cppui381),
+                            typename field_type::value_type(0x0BA9B24D62688CDA2785087D9436C40900670919D020C52FCA7D51CC1B73EA08A561119EAFF0D6ED8DA8FB9E4C1CAF27_cppui381),
+                            typename field_type::value_type(0x05205AE9A63E961A7DC39DC40E1C3D83F7D7FC4DEC25E760FB3CE1EA32FE8C2883F069F8F94813BBAE2BC3A67D988A45_cppui381),
+                            typename field_type::value_type(0x0C57144B96CBB52EBBB9E90B86D4BB2466ADF592DCED45293DB8DC64734788ED2B84943955882CCCF406AB7D808EBC1A_cppui381),
+                            typename field_type::value_type(0x07879B361442E6548503B7FB7DE8BF9215E755C3E71431F19D0C9675A28AA5F1C20C427402209DA04C86A16426C4598D_cppui381),
+                            typename field_type::value_type(0x04365ACADDD6E3343CFCE6235AAB33BC31F8EFCF4CEF274650808BB9B5466342D53D86978D6605EA26AC89AA6D056123_cppui381),
+                            typename field_type::value_type(0x0A25F678D0091CC582BDD49E98CE93CCB11307A6DC03F3153A279E127E7466A4589B86F245D5D8F200F73C6090394165_cppui381),
+                            typename field_type::value_type(0x0B6432941AB2A61640DFB85B31B4D45AD9409933BAB096F72806C0DE3EB3FB8B64609582A1C5D3257F975FDD86DC0008_cppui381),
+                            typename field_type::value_type(0x0F6B565D74264879B651DE34E86C0C0F07993B10093C6C19ACD07BC7D2EC3C9B68FC8F6FACF7B901BFAC52C194053999_cppui381),
+                            typename field_type::value_type(0x0AE1CE0017D59209FB8A7022BA2BCFF12E722168F2F7B48734808631F592081C636DBE0613288C0135783CC6C81743D2_cppui381),
+                            typename field_type::value_type(0x08645E2E081294503E84E18EF8365B481D38C900EBC6E53D0E209DB0BA6DFC8834CD47CBECBBE694A4748401E8043637_cppui381),
+                            typename field_type::value_type(0x0A9E675CFF4FB36F98DE8119F7FDF69990EC43148C8BD883A55384D203F2072997ED32561C472570D2CDE8A61596BB16_cppui381),
+                            typename field_type::value_type(0x0F2A6BC37F3760AE893FBD1E2A89BD622D990062C5237C2B15A5992BE03585A0A3B2B516ABB9CEA432D7E81D7C1C7EE7_cppui381),
+                            typename field_type::value_type(0x138A1A4C41B028CF0BD8F8907CF980D7A99FB19388FB1E116D6A903053E54F7D2BBFD45E2FD236CC7036BD2D7C1FAD57_cppui381),
+                            typename field_type::value_type(0x140260861EB8152545F510759ABDF9AD92FB78C9E22550974F427545F4ADFB92386AC68888B80E2DE88FE676BC03834D_cppui381),
+                            typename field_type::value_type(0x0BFF5BE0BBE4E24E91BCAE9B75735899E7CEC1F2F98D40A6344C97A56E2B61CE098851390322A6196B74A668EAD2F552_cppui381),
+                            typename field_type::value_type(0x0F01EEE2A201A09DA7A893FC1B246096B358EBDCCA2FD089A64403DEBE130424084C8FE7FADCA7C325F8D5D04D6680EB_cppui381),
+                            typename field_type::value_type(0x17BB19D59372704B153644C512DE79490F2BE11D631D102D0A9618AF411BD8244FB4C64E66F04B5DD57F0150069ED7C8_cppui381),
+                            typename field_type::value_type(0x06A716118DB356E7AE8F50739B210E9677C289A3014DF9F5462E35D6EDBDFB4549DB8FD3F3DFBF4B2A1F302D5CFD7C44_cppui381),
+                            typename field_type::value_type(0x113753ADD5EDD34AC71C08257A9D7F07C02FF12F53C056A19EDC2A52F630E912B9FD56E4558D777B1B83D3448B662642_cppui381),
+                            typename field_type::value_type(0x0D3CB4C97E13EA8500D96DD0482F6A8B666FA63A4C60C71C9FFADDE00B9A1587CC120607EE5C30826D4F656C7A1CEDD0_cppui381),
+                            typename field_type::value_type(0x027D4B886A1E24D9C600B2BCD0B0DF6E57082BFB287F806987A84791E27F117937A1A547E4775FC8CDA786A26448D825_cppui381),
+                            typename field_type::value_type(0x17EE26E01F2EC45BF11830BED021A85BE7B174E043036400A43DE75FC2E1DBB1CD71D0C8D15A76F13CA1C616E640FA99_cppui381),
+                            typename field_type::value_type(0x058BEBEDBA6A94A4A822E0D11BB5616241357378FCFB8774948F86B523FDB2D7ACA554037CFFEF681953B4AB807AC6A0_cppui381),
+                            typename field_type::value_type(0x02AAEC815676D77446E7B9B531DF3EDD6E9B0B9C588AE74C5C29CC80FFEA0497AC60C247E650552DC368B92EA10AD447_cppui381),
+                            typename field_type::value_type(0x0B40F0CF9C1AD00F91DADAD49CAB53E864D1D80DD1DD46D853A751A6218B3C4E865B22015FEE2C131A3EB11E30637A28_cppui381),
+                            typename field_type::value_type(0x0BF480CDB1D66F52287A9E05CB59B7BCFED238A3D8E08D39CDFA1F8F1ABF8510B4217C6FDAE2D4F46D442689DC07B7EE_cppui381),
+                            typename field_type::value_type(0x051F12E4CBF1874A2551763D6FEF94F3EE0A3B767CF4AF9766F89CED10FADC70389799EAC43FFBB5DA0CE5DF0C4F5277_cppui381),
+                            typename field_type::value_type(0x0A96B9FCA4D71766E8F9B8A6624412FCA0E4E3B1598448C4D0E357E541554FD8DD9FDD6634B003387017852DC4B4FDF8_cppui381),
+                            typename field_type::value_type(0x161D0C70DFD7AC81A6A2E2FF4FCC20C17E2AB0DFAA1CDBB983DDA3AFC23F4B926BF9EBA0AAF90A65B318E02052BB027B_cppui381),
+                            typename field_type::value_type(0x18B59F9D04E4EBC4BEBBCAA7BF1A406A88D03ED32514CFC32935E51A8BCEA9C844CEEAE2D1FE145579DB3DF1F8569470_cppui381),
+                            typename field_type::value_type(0x1885D324F486DB62980D9BA07EAFE3BBAA171C3C37DECB50684B5F128D82FDEA809B6FBBF36AB2542394D65098984439_cppui381),
+                            typename field_type::value_type(0x0340A39521DEE8592E66250D06EF30620D6E5602906BE478C032E5B11EBD97652BD762BC00EE0C995A9CE09C34665573_cppui381),
+                            typename field_type::value_type(0x036583C0DD14D2D1904D5DD070C9C38A7D4D7B8752A4347CD2D26B0FB06291E19120B777B384AE29F91F6B9C10A42E70_cppui381),
+                            typename field_type::value_type(0x0E60E2E6B73382794DAD217E1C8F5D5CFC2860326FB3F45AF344B4ABCE9C046EFD7EFF2822BCEFED862F8380DBA20B19_cppui381),
+                            typename field_type::value_type(0x0FC446B01226C9FEA21280A9D2D345F7B2EECE0D6B36CD6757C558CF368D4C5AE122F60916D59CB90018BA54BA9FFCB4_cppui381),
+                            typename field_type::value_type(0x0E9140863D51050BC51B4D60085E412BF180BF07B858E7C399343465269A10B6F541474EF7A6C09E7C33D0DE86B82CBB_cppui381),
+                            typename field_type::value_type(0x01EF906BE452B4170D6339BD2EDB2C3A0A11B3A6C1E52641F5E03A21F53345759B1B507BCCF3DFCEE342B38531152971_cppui381),
+                            typename field_type::value_type(0x01CD675CA75B5704050A2EE39EF8E333051A04104CBF00F5B272FBB5DF22A96455C1F6E3F9833519A05D769CDFFBD078_cppui381),
+                            typename field_type::value_type(0x1045720639115CED7D441D293484DE005AFD0BE98827E39677ACC31BAA92CA4A7AE5BB234EBE79ACAE873B0606A87080_cppui381),
+                            typename field_type::value_type(0x184C9A1214E5CC624E2E44BF9F17429F2DB25EA9DE71D1C542B711D0DE45CA77ED0639B45FEB93F77ED22345F088BCAD_cppui381),
+                            typename field_type::value_type(0x1807899EEB5EA394DDA39BA9089952C781BA4E94AD6B87781FED86A36BC6A56C86EDD30935BD1EDC85FAD30F3BAE0033_cppui381),
+                            typename field_type::value_type(0x12344FE90BCDDA519F2E0EDB10B88B36782FA307B2B205A18240072D257408D57436BFDB29045C3BAAF12532B7F04850_cppui381),
+                            typename field_type::value_type(0x044D8C300E8353495108AFCC1A7AA5E207BD18A76517228F35AEB84EF05ECA1E77BD951282148C593CB3DB5CDC0CED13_cppui381),
+                            typename field_type::value_type(0x06BD515BA7582928DF84468F8D80140D560F5DEFC0D308C707E1282FF51890E4DF6287EBC5CE00DF0F40CB4D6D4A83E5_cppui381),
+                            typename field_type::value_type(0x04AE601681CA5186175B02102F29DEBAAC7396F39F8ADC48D06B82CE3255BE0B8C0365A085AF51FCD2513AEA3EAB735C_cppui381),
+                            typename field_type::value_type(0x13014E38F7AD905339D3C18B4C152020E8C2A7661853872CEA1009352370BDD4002BEEF982A7737468F720CC736A8BA9_cppui381),
+                            typename field_type::value_type(0x08CC6952B404DDBE124DF0981617BB5B5B0E633D71A9573193EE0946DA0512F0F2FBBCF574C8F88B7EF6837F5CCCC487_cppui381),
+                            typename field_type::value_type(0x11D6E82701B32DFDD40A7EC3F62B4EBA0BF37BFB51A4EE11B233242FD493AB7872A3AC20CF48D798F42BABFA7DE5D1B2_cppui381),
+                            typename field_type::value_type(0x01BF5306C66B2A7A583E7C573146FF639AB1000BEB9F86C3D0A7E79B3009884D2CF15D868E7F0D3AF1C43C35FFA3097F_cppui381),
+                            typename field_type::value_type(0x1606087BDCFF82227AEC52DA855457214E2220B069E7BAEE0BC00C1EFA32877A3035618ED5014FC2D9AF4F3E77C24F6E_cppui381),
+                            typename field_type::value_type(0x118855231FFA9EA32D432474859804DC47BC8DEACCBCBA79CD5705FAE319632B061F809A539EDD85A5919CF62BCC5269_cppui381),
+                            typename field_type::value_type(0x11F077E11AC1DDFD3373B0BD33C2D1683DB58F94530F78E498DA640D362F3205636B3164147E8D83533F9BDD089BF660_cppui381),
+                            typename field_type::value_type(0x01FCE1ADAD9ED3F8A78B615E7B025AD9164FDDF5548F5E3A07E23079BC34A3FCFEDC8FDF573D22B466CC0B80F2431BE2_cppui381),
+                            typename field_type::value_type(0x13B433237DE035822870911EA6B5F1DED501FFEC303B932C48EFF3A976BECB78F552915250A12F2A7CC400772D6E71A4_cppui381),
+                            typename field_type::value_type(0x0A99BA4F9C1A7E6C42FA9B8B5FA3E74388B35E8C5C2D82AB0B7290B30CB662359D34853A442ABC78FFB43615C5F0FEDA_cppui381),
+                            typename field_type::value_type(0x177EBEDD0F52CDA0505FFDF1B1EA4ACC330BBC2BB7E3F335A90F39E785564549F5269E1FD1F604B96895D91C471F8AC3_cppui381),
+                            typename field_type::value_type(0x0012A7FEAC19591475433EC4E1270E6F83B12DEF7111BE64489676922A89BB2DAA1B5AEC5A343B3E6B722B36CFC8476C_cppui381),
+                            typename field_type::value_type(0x09CDA348CB5C445FFF26EDC0E39AC1A6357AE351F341E8BC15E99F95F0936855F9CFB90FAACE4626BEEC6D5D1304C14A_cppui381),
+                            typename field_type::value_type(0x1001A8A8D22ADF6F845074BDEF190E58B98A69737E10981B702BDA32408252B0CE6E9DD1F9360A2C30F1D080F57F132E_cppui381),
+                            typename field_type::value_type(0x0F1A4AF5F1F751298DC06BD8C907C705CF22ABC154097C873FE9A9AC97BE4B6BD688BEFB56ED13D021281872C2EF6101_cppui381),
+                            typename field_type::value_type(0x12EF1020C55AA0160F252283B448C1AC7C8E43CEB11C3893D7223D1E559FAC3E0A9044C41ACF7128A1C22555B55AFC8C_cppui381),
+                            typename field_type::value_type(0x0275EBCDF347ED13F65665C52C735274503E67B293B0220A4757C95E1C0AA686FEF279AC4A54F085806B9472259F7693_cppui381),
+                            typename field_type::value_type(0x19C893B658F9F865EAD5457ED1CA36829AAD8D4752BDE004F465F5E86D2FE4D6FC97722D99CF3E10DA18F40930757326_cppui381),
+                            typename field_type::value_type(0x011EF4B5BED7ACFABF27F96AD4B94C26BA417F7F555796D6D861A70DB5AD2FFBEEA2F296E99098D55575299CEF9FF158_cppui381),
+                            typename field_type::value_type(0x029147D95814AEEDF3B5397004C8D32FEE3A440F6D1C51383422C92F96014F0CAA8333B476B98FB184A50F14312E2CDA_cppui381),
+                            typename field_type::value_type(0x09C38822447BAFDD580FD310D18B2EB2F922839B10BFE562B5BE1F3EA6946EF7B162802A95CA613257BEDC14AF8A189A_cppui381),
+                            typename field_type::value_type(0x1926F58ED049EBCF4CB1DA2B35840F085D0603B5D6838DC640E2C9754E21B7E22B837BEC6BD4880FC7E6F5E00EF1E247_cppui381),
+                            typename field_type::value_type(0x08F70C933A0F93CCD50F4EF3CEB7381151D243169B006F61166644F4FBC2C1573FE157EB873BF0A4B602EFDF518142C0_cppui381),
+                            typename field_type::value_type(0x16930578BC4D47587BA190523EB7A2A754B085274B8DB4092C693AC591EA6475BEFC8AD1CDA8F8D4C7FC9F5E142A3961_cppui381),
+                            typename field_type::value_type(0x0AD6844D4D75509D8CA49BB77ED19BCB9BBED8C1E57C9F2CF9484DB0BB4A560E96C046B0CFD394BCDC28F395B3BA2EF5_cppui381),
+                            typename field_type::value_type(0x090C769944B512D4090F7ABAF88039784DB490D9CA95A3BEC26989DD0ADF7C4DA0FB76B1CADB526FAB690A68D5B4C948_cppui381),
+                            typename field_type::value_type(0x0971B983FC2D86523B5A68D37E9175D71B22E132F91F522382C1239F51230B3D91A7EE13E6CA5040279960CBA3CC0DAD_cppui381),
+                            typename field_type::value_type(0x0BB0A288055FC9567F44B1E43AFBA6286C7209E2BDF80BDA5A3DA1E8FF9CC9803A3F340F9D5314CD6FF31CD0400614D2_cppui381),
+                            typename field_type::value_type(0x08502DB0E800BDEF28036EF17865A6832E7B93F1397663010C1FB7CD316A9A06D80A528CBA3B83247D0943AFB9C5C0D9_cppui381),
+                            typename field_type::value_type(0x11BB815851D2603338C969CBBB0193D385463077BB99E18F4C3F97A5BBD6315531F31BF6022FB31E1B3BA864FBCB9FB0_cppui381),
+                            typename field_type::value_type(0x16718E3669652AA00C0E6DD0E6860F64DCC2C463518A82197CC7FF907F5DF9946D9E2A6C9334D07ADC22D255F6F2EC5F_cppui381),
+                            typename field_type::value_type(0x104464491DC3E32A4A504FFDA3B5370C844B6A403B744974EAA5C537B3D51E8954BA25E0BDCC091351AEBAAB1729E50D_cppui381),
+                            typename field_type::value_type(0x019E70EA8538525EE17C0C25D95A3E508908DC546A8678BDDF24DE26BF5A8A3316B296D161EE5BB7F78EFA07F52B0D52_cppui381),
+                            typename field_type::value_type(0x16FEFD521F5238E8FE8379A94F2FD8B3D95FF5FC784F7FD84E11E77A5F0255A26BEDDCDF3A82A8322E3C915EF2CB26BF_cppui381),
+                            typename field_type::value_type(0x032168AE82C37667A40C8E6F09AC98835420AEB86FE649086688F46A9D40F25671F687BAC1C264CE1A41847459787F26_cppui381),
+                            typename field_type::value_type(0x16B0B23085935782FC03A47C3D956B60F9F283856987E88206DACE1C05A32CDE63A44064C10A3ED82CE2EE218934F5AC_cppui381),
+                            typename field_type::value_type(0x08CA18FE2017C6CE0F13673849104AF21D60225D270B9948CEEB6F2185203DBC5494D7DA87983B8FFAE205B08121E9EB_cppui381),
+                            typename field_type::value_type(0x14A2E321CB3DA2DBF9A850269F4301FCB72CFA889EFA4558A4C9B07C8646F227BE10159D176E68D9659487756281D741_cppui381),
+                            typename field_type::value_type(0x0B8AB06DEB7B97D56872E754578E6FA3E0983E9445AB7273789C80949982F227629E37489BF69DD105D8CCE1F39BDF59_cppui381),
+                            typename field_type::value_type(0x14D24E9899379B070D230DF79FCF1D72764102B9688298C4E049FB33E239722D178471CFC9FFCB58A948D7B232639964_cppui381),
+                            typename field_type::value_type(0x03982959F7B71EC36DF93F3F28D344955C5436EAE127901CEA36212CF67F9A66E79820A2FE2E34553A03766DEE977B65_cppui381),
+                            typename field_type::value_type(0x10FB4518054E4EAD446618AE4ADC87395B9A6BC224D4068A18B8497353A3BA94AD4FE5B921EF5B5C621947732272CE0A_cppui381),
+                            typename field_type::value_type(0x084300691AF253BFF42C6610F30C0D9027D8A1CBD92884F85E13FC03FE9B306455BE1E0EAB67037E1F88EA29425D5C6B_cppui381),
+                            typename field_type::value_type(0x1133E25B3D6A63702B98B4C1A20878636171543D93DD5BC8DF8C0F4849B8543F8929E8BA40ACC9B687DB7D431789FF40_cppui381),
+                            typename field_type::value_type(0x0615E3CF4FE8AD30C9565F69FB4ADF8A6F41F34185AE4DEB424A89FF7B07F12551300F7123A63E9E378FEC50DBED41B0_cppui381),
+                            typename field_type::value_type(0x18B79C4E82FAC7E55614999A8DCFB5B1E703BB39FE0ACBFEE302D0E5C7C6C39BABBD11FEDED027847824430E8C817E15_cppui381),
+                            typename field_type::value_type(0x078E0020F12AA9AB755F24C49F1EEF3678F62E21727EB2FBDC08A1251E4D0B536FA35CF8FA48C34A8CB1E665E6068416_cppui381),
+                            typename field_type::value_type(0x0F628FDCD554D4A50D0AC7115898D94B23B437B5FE9FB36804DF472FF3B672B2B65398B709B7A4193901E7BCA3BD2A66_cppui381),
+                            typename field_type::value_type(0x0699F1C8891C85B30FDD27CC4D8AB019A3FA5EAABBB66405326A5DC12286B4E95D66DC960AAE4B07BB2A63FBD1391690_cppui381),
+                            typename field_type::value_type(0x0084DC7578362F14C98417818BF8F28DCD529E8FF320CE394E00C5ECD1DE2E7FA8A18CE886FF770E9FFE66D07D9BF3FE_cppui381),
+                            typename field_type::value_type(0x05ADB5CAB453FBEAE7EC3D38B28374F792383C0076205367E1D9995978E07782DCB74A46E4EE2C4A2B77B238EA3E9EF4_cppui381),
+                            typename field_type::value_type(0x0A0EC5DC33A939D286760A91FF1C25550735BBB2E7E64E8A2EC40F318B615B98C8E34410423C1DED69E7D1EED85C86AF_cppui381),
+                            typename field_type::value_type(0x082C51E14EB34E5D622A95FFB7B37C08F976BF1EC2DEF777C847FDFEF9D354EE153988361C97F80E735D5B7B94E1A038_cppui381),
+                            typename field_type::value_type(0x19120C0F240D69DBCF13A715B622FF19920E92FF65B46456E6CEB338EE1B8E331CA7163A34DD065037AEB89EFDAB8288_cppui381),
+                            typename field_type::value_type(0x0D9C1BDA9D56D9B592A113AD7644EA8232EDBD2EF53A2BAF6D1CACE75BFA3137AD842D77CFCD75DE44B9C61876F122BF_cppui381),
+                            typename field_type::value_type(0x0749BFC51911320BFC07AE11DBD804DB8AAAB0C81DCA5D4F8FBD6A360C7DDF9734219EDB821BECD753B7F301252F32B6_cppui381),
+                            typename field_type::value_type(0x0F7A41FD14F2E43CFA4C1302E6CA8790937661309EC5429782281086858697587A13F32B36699FD7D072F96D37FA269F_cppui381),
+                            typename field_type::value_type(0x07F60DD4731BEF95889F845B2114CF1F0CE175A8AE8ADC62231EC06A471E22436262DF39562C0479527D3865D08374D9_cppui381),
+                            typename field_type::value_type(0x08247CF911B562217D91417CE76DE82921CC73EE7177A32A9C1166A2AE85B5F53AD714C9B265C486AF7A472CF21BE58B_cppui381),
+                            typename field_type::value_type(0x0AFA2A01A2884CD1D36ACF91BDA04E490E38232ECF14460EF6FB5900206E4A43CA52A74E402ACD1C528890AD4551D251_cppui381),
+                            typename field_type::value_type(0x17AFE37BAA7546D560B1FD5E8D4F9383CACEFA1B363B0ED58871DFC4C30A81DF7DA7645B6614C9104CBBC59B0253A557_cppui381),
+                            typename field_type::value_type(0x00BFBF5F21B0DD3C2C453C22B94FCCECE8D86D782E0AA39127B0E25C7426A046A13E41AE25DB116E06C0C0C021D7B0F3_cppui381),
+                            typename field_type::value_type(0x1772966CDEB1BAA638FC4EE1AFA94DE55CE5860830C2BE4CF3A1362C84D22BC0D4B80BD3563253ED49C0CC2F141F68CF_cppui381),
+                            typename field_type::value_type(0x0D35B566E305D6F3DF79258B762F5303406964F3292D29B1FA38013E878E9173309FB3D29A2BC2A37760B7DC9FF59B1B_cppui381),
+                            typename field_type::value_type(0x18411F8F46E980156E04EA46AE270E8E223EC67AC4B1EDF0244324CA39ED603FD2385012A6B3478192C998BBD7574123_cppui381),
+                            typename field_type::value_type(0x17F89198FF49AEA63FC9CB54788D6C0EB70E651CBB09F1A61AC18EDA5C144D5AAB354EE3F88B69EC83B3606ED713D165_cppui381),
+                            typename field_type::value_type(0x05A1A462E2A0D219720E68140CD69632B190EA9C2C8E07DCE94E0C8F28518CFDB982FB6A04EE1595E09B2382A3628D18_cppui381),
+                            typename field_type::value_type(0x05B3A839D6CE26B82E0ED59A2E4A5DE115918DB377E4B2D958C20201F69D6468A87CFF7EAC511376D92834466DBE719A_cppui381),
+                            typename field_type::value_type(0x057365D82BABF3FBDD4DB67DC491667745512999DB9ACCF3DC99B00E5E32FA621636963110D09D20075023D20B4F1966_cppui381),
+                            typename field_type::value_type(0x034190AB81E24D87D1A2417CF532A1B728BDC51C27A2CF1B0A85D619A0372E44A180B25D66EFDF00C88B6EB0951C1803_cppui381),
+                            typename field_type::value_type(0x02D1EBE88620BEAB41DC198661DF4CA64E58EFBD807267D0E34074F184BE9A82A39936872C6153D898A6B8BE696C6FAE_cppui381),
+                            typename field_type::value_type(0x17CE67E313A031F2319F4B623910063CFC72E44B388895FFBBFA4C6733D46E9D6D3299D15B9D391E92CE493EADC7B877_cppui381),
+                            typename field_type::value_type(0x075C9369DC4AB9A50C5D1883FACB002486E45D83FF393795CD5E1AE5A2FB51E809B03F65CA640B08E70898E14E2D974A_cppui381),
+                            typename field_type::value_type(0x0A7881AE244E7307EC22236C4E47DBE183535634801772C490D9197F7AD96B3A0F0D5C6E719D71B0AAC21A8F279EBD84_cppui381),
+                            typename field_type::value_type(0x105D690B502AD65BCE4E8455782935832A3205A77571E9B942214613B8040EC0292B20473D26F4C1DC13971567AEB09C_cppui381),
+                            typename field_type::value_type(0x1729A36365B786E27EBABA55EC475652D5B080034B22F60CD50C47340CE6DE9FA4648ACCDBBF145C04F770CA46E57C50_cppui381),
+                            typename field_type::value_type(0x0ACF61589AEF2AC8EB4249D4B84A69FF68352301C25D4EE626BF22CBFBC7A112B9C6822AEC27F0873BC0F0B1AA611018_cppui381),
+                            typename field_type::value_type(0x07840B83B696A63EF63666AE81CD273962DBD921C14B24C27585DB7E55FA0890D011768F727186F028EA1AAB1B4DB4F5_cppui381),
+                            typename field_type::value_type(0x0069B1339278B3C705AB5D3CA37646708E8B23E81CD5C4A42E6ED055A4F3EA3038741C9A989CBE488A95AC642B44945D_cppui381),
+                            typename field_type::value_type(0x033BCCF2C8812544426B9B19DD916953A45EB9F806B2F1967C380605F6CB1ECE0B33858A67D2C96268711DE28C8C3346_cppui381),
+                            typename field_type::value_type(0x09A757F87A30F6DC3BB44FCD504A4EFCA503B69B1304A65F0F2978302D17B7075C5A49ECBB443D85BBD0806B8922EFBA_cppui381),
+                            typename field_type::value_type(0x117E078D78BE598612701464CB0FA7BB31FC65075084DC6540BDD2299CE83E80E3FA1B312BE4DAF11F6959EBAB785A01_cppui381),
+                            typename field_type::value_type(0x0509887D279F9D17A3547A1809315DDE42545F3801F8677F5CDBBAA92D228BC27A6204E51CE124DD2447C2DAEE850126_cppui381),
+                            typename field_type::value_type(0x0F8BE242D2808AF4F987B73095A4F916A4672C52EF7E02CD27FC8EB0488B2A0B0476324C7FEBAE9F8FE478766D14E023_cppui381),
+                            typename field_type::value_type(0x1661605E3AF6E3E7191546306B284EE1D5817A47DCB55DA38337934784E3774E6F2320649916F266CEEBA53DD48D5B11_cppui381),
+                            typename field_type::value_type(0x016097B10489E301347E026A38F7A55ACD7E4C075AC00A41403B925BB5D02EF86460116D2B42440E6DD6FF7BCB0FEF5C_cppui381),
+                            typename field_type::value_type(0x0B2A4F33D1459908D364DEC70FB5EA18D73970E7199CA87FD23D278778CBB34577B5C44264407AF8509CBE16BC2E871B_cppui381),
+                            typename field_type::value_type(0x17EAC0A5EC23B7C0FD7F13E44D9124C8F763439D945C548537CCABEB24FC7AF19A5D954C5E70CC1E82E81DD80F598999_cppui381),
+                            typename field_type::value_type(0x161D53326665EC161A7AFAF4214BCFB61A784CFC3383F54062FAF11875489E0C4DC181663D6E1C03556C1655411248DD_cppui381),
+                            typename field_type::value_type(0x0F36539D5838FE9FB2DD0EC74F29F783DEA67B86B23AF53BA9663DDFB322642BF28097E45D50F07E4843B0F8D9FD999F_cppui381),
+                            typename field_type::value_type(0x07587DE2085902079AC6FBA55DB28221419ACA0DE62B6C1FDD2AF4E1DE497AA38F894A7D0960516FB06A0AE0AF2C5103_cppui381),
+                            typename field_type::value_type(0x0B940D4EF0CEB2AFA63A282B7E8C37A4EA9C0B22E526EBF629AFD54D0F52C1299DD8431AE486501013910F5BBF0F551C_cppui381),
+                            typename field_type::value_type(0x0CE3D33C41C93EE09EDF81B154423B2401C16EE113F5732148F0D955C4ADEAF2EF1D1851FB465472101156DF004EF611_cppui381),
+                            typename field_type::value_type(0x0A63E7E2F5FD0B8F1F03A8A5ADDA6AF75E5664CF5DA8D9FA4341CA1A4FD6F2CF45B9D42FA18CE7A09D1E6171A5689E55_cppui381),
+                            typename field_type::value_type(0x040865D46D8DDA2DBB9F8B8F27C75DC16C00A43A05A6D49244E54B5255D41CDB7EC5A1E33958682ED440949EB98A80AF_cppui381),
+                            typename field_type::value_type(0x0E3FFAE8C3FF99B84401F35AAE008E1F64C83850B9AD472CDC3C71984BD8E4049BABBD723A90DD81BE68B19F91707BEF_cppui381),
+                            typename field_type::value_type(0x09746E9C90E0779EB35EDB1A552D0C38C016ABFE59ABF82FB410B251EA4BD6DD737B6F8D1709177869208B328C78DEE1_cppui381),
+                            typename field_type::value_type(0x0F38972C4F538536BBD30EB5A3449D1AF651A8B0899D715DBBA13DEF7F445DF0FB39A795D583218A7D160B8D0A3E3E68_cppui381),
+                            typename field_type::value_type(0x026B4C73CD6FFDB3A5FB70BFFA75F2280FB47FB393C0376A69F444198945F0AF75D3F876E679894A2421DE25A0E2D02A_cppui381),
+                            typename field_type::value_type(0x0539DA0FA1841A2DFFF7AF2B913CEEE55E8F11A9DEE165FC4236EEEADB7DE597A568A59241E55D91CF3C3529FEF03E9C_cppui381),
+                            typename field_type::value_type(0x086352FE9DE727E075FA3DA69AC2527A0CAE06C7E03E72F27181FBB4D21522C47D65871547BF827665194D3FE30C1253_cppui381),
+                            typename field_type::value_type(0x034EE85CEF695CBB5DAEF88DF8A7B2ADED1DFAF0ADAC4DE674F121B0AA5154C2A777A972A105BB9F7DE4BB7DE7A695FA_cppui381),
+                            typename field_type::value_type(0x191707BA811B92B8476D38C31E8966E843178902266D9BDDB5287BCBF327E04405EFE7B38251F8B4AB94E8A45EF44A45_cppui381),
+                            typename field_type::value_type(0x0D0BAA8EA8F44BD430C78EECECA455510FD13B3A47E5B244CA0427AE691E5A3121CCF41D27513E5773E0648C5B2B8A1C_cppui381),
+                            typename field_type::value_type(0x182C20C6BBD6DF3394ADE21814DFFF091BC592528140E22695D429F5FFF4E7FB15A3EF145ABE0493635EE5E80C9FFE2F_cppui381),
+                            typename field_type::value_type(0x107D5D63CBE88E62E6992C1F7D7F4E1D633065CF16C6B61826DDF3D34B7A54C36F5AAC194BDB14F70E089E5B15C77B51_cppui381),
+                            typename field_type::value_type(0x02D655E8A7ED76E9423F5E7445516AB4D352FF5134E8E4AA018C727BC85B7298CAA9D66EBB988384702D4257854507AB_cppui381),
+                            typename field_type::value_type(0x01F28EB99166BD49173950B31213311CC5DCEAB0D76D87803F780DE0F84BAD440F1399E0F0E21DAE6FFF6279C16FF629_cppui381),
+                            typename field_type::value_type(0x13470FC217880FB676659134B991B8066AE6FB1CC992697E234E0CC5373E2837DF221024153ED713704614938407E014_cppui381),
+                            typename field_type::value_type(0x0DDD7333DBC3BFDD970CFDA187F20A9F6EFBABC6390AD7884916F2CB43F4EEE066DDCF251EF722AB1992FB44BB9D5AF9_cppui381),
+                            typename field_type::value_type(0x16F33FA217C5D743F2D91D6B39FDCBDD418AEFD0549F7BD827A8656F01081F129CA83AA78F70FAF452D2F9A0DC71E618_cppui381),
+                            typename field_type::value_type(0x0EA57742D181E891BCE8183E5ADB98DD54A194503AA66E1E82635C4FD93EDC47ED21FE682CC6CABFCEA6F74F7AF8C108_cppui381),
+                            typename field_type::value_type(0x04AC4E982CDF13530A17C61887239AFC91EFCFB9006D65E393D3B7471818812F2D97B657821413B02DF90008CD4A5408_cppui381),
+                            typename field_type::value_type(0x129328CD73652C872B60B23B84D36C4546F213DDE2975E09DBB3671383973FFB1F5B76AD828263F651DFC526C4F1A5BF_cppui381),
+                            typename field_type::value_type(0x14EBBD61FE0DDE9DA2EDEB6BA4C1EF84F0C83836E3973A1953B73C9753D6D99E7B064ADBDA06CE46F302981B7029EAB1_cppui381),
+                            typename field_type::value_type(0x0B99C07A4782954FE60A72478C1B4494026C86E6BC02BEF3359EA3B564FB7EEAB62100724FBA841C7DE7BA1F1E8F8B43_cppui381),
+                            typename field_type::value_type(0x0CE358CFB4B09DBF0054B70D8C0D715A967F6CF547265BBD2842631694DEBB0BDA4073B944BE64F29ED2E10366D8F43A_cppui381),
+                            typename field_type::value_type(0x0B9FD57D9E8784E9911336B40D770C75A0F29DE8852466708AC32B655C5525A1BD75CAF2F3211625D64A49D042E22A96_cppui381),
+                            typename field_type::value_type(0x08D9C045CFD9036B519AD122FBBE17AF2BC3FC08070A1DDB985F1179DADA1421190179D3FDDC82C868B572BA3F73CD9C_cppui381),
+                            typename field_type::value_type(0x1553301888471CA231A8F37111EB3F0010C3ACF4238C3BC5DA98D6CCC5BEA4F7926C5F748EFDE753586451BC6DAD1457_cppui381),
+                            typename field_type::value_type(0x11B230060E609CAE704875E82E8D5CD14B4CB96C352E6F0469D0A0F0C7E0C6C92791EA92F96F25E33E3CE1BCFA201C70_cppui381),
+                            typename field_type::value_type(0x0D8EA219A0558D1575665B7EAED2683966BDF9D653E155E40609560E15C7619E4E43F13F6434FA26711AB1875AC23B41_cppui381),
+                            typename field_type::value_type(0x01AA736F7B14A7C0AAB22CABEB5B3FD05F9A9C6F280BC758CD0F4CAB4C0E0CD9BC6FF81C3B77DF71ECBFD7553EF2A1B8_cppui381),
+                            typename field_type::value_type(0x0E5662C8279A07A71E86C8BC9B2059F4D43056089288A5CAADF888D5002D27988BE96FFF546F7E6D73BA70A28BE2CC73_cppui381),
+                            typename field_type::value_type(0x0B9F4BDBA4913D0123F3B0B6FF478EA08D20A0317CABB332C6EF44802AEDCB1D5FE4CC8A1FD96787A8B8F29D868D24B1_cppui381),
+                            typename field_type::value_type(0x0B2BC5D463793DF0E152FE346C6E73623F5C60692F80CD8F5A2BD66B274E8D96AA8BC93141BD8EEACDC52938D65ED278_cppui381),
+                            typename field_type::value_type(0x05442F5E07E391D8209D1DB9A2CDC6EBF4597F3C75D68944AE3C04BA0A59875E71B3C922C40B5D07A08EA7B9C93E5BB9_cppui381),
+                            typename field_type::value_type(0x1680C3632753823C5B9DEE5B541A98A4AB458C31D8F08B9AA21011DEB3BFA5378A9194511B634ADE854EB469B98AB336_cppui381),
+                            typename field_type::value_type(0x1163A200E0B444A241E075D0B880E6D81319FF3ED2ECED042FD6FBB91D4A14AC18E9D1A8BA72A12D94D0985D5EEEAA48_cppui381),
+                            typename field_type::value_type(0x0121163B6D4450B6C6929EEF4D97248A947CF573BDAA3CF409ADC697873A9FF07BA99CD924D8A6CBD031B13115F3DBBF_cppui381),
+                            typename field_type::value_type(0x07ED5D9BE0BEBF4421E9876FE59A728D2129C4B5DCFE5D18A5B602124BDC8B16AD431D778D724FAB12DBF328247332C6_cppui381),
+                            typename field_type::value_type(0x0109C8C7975A0C88C89895B6EB1F1AC2D396160A6B11245E8A6139DE1979230DF4313A62CB257BD866DFE929C9FB2B65_cppui381),
+                            typename field_type::value_type(0x0CCA716485360EB2381AAA0553C68AB16C05C394559CAB0EE48E3059554350A6499F659A021B85219A96A247ABA23DDD_cppui381),
+                            typename field_type::value_type(0x0E608ECEA09410A4C8936E848A52461925381E3B51232F349D87D3AB22C83A44297DF99837971819BB4A0883559FD458_cppui381),
+                            typename field_type::value_type(0x17D27900F82CE51136DDE518489E9D6011617F27F56EF31B7CD698770C686E51D6ED6DB3FEEAF74A2A32A8A8CA0850B5_cppui381),
+                            typename field_type::value_type(0x18ECF7F006F88E3AB3405A8D591E743AE8D9B03B8D8691905FF2494B50AA30B0A81474CF75F5084528DE608B98591581_cppui381),
+                            typename field_type::value_type(0x02E8C02C842ACBE974EAC29631BF16DE1E7AD12C922D9E384B8841FB48A5CEFAD24CCC141DC98BFB5EE9521BFA55BEE8_cppui381),
+                            typename field_type::value_type(0x13B37FD1EFE33FFFEDF61710F70E84053273D5B21E17F2C0C539B089CCAA0897CF75A82F13B83713CBC0D9B250C767F3_cppui381),
+                            typename field_type::value_type(0x018BC13837775600CABFA1127584C20438C102B203975916F7915FA2E7A48295FD1EF3DD881CD22E613D0E7CAC49B406_cppui381),
+                            typename field_type::value_type(0x049C1329FA81BBA0CC0423F628201F5A01A98486D5951A8E494F08DF983E7771476D1778C9AC5EE858209FAA05727BAE_cppui381),
+                            typename field_type::value_type(0x0799FA3543475948A55AA25D0ED788CB946F681AF005839F051AC70E5502F494058853F6D52D58691155214379D5030C_cppui381),
+                            typename field_type::value_type(0x1944AA5CA159E024AEEBB8AF59870771394F405034A174F38A16850D3B633F792DDDD5747C06C1C9904EA8DACD658517_cppui381),
+                            typename field_type::value_type(0x15F8A7E3CA801298359891971D0D011AF5EDAAB19B94D1717DF415DEE93DBC05BB8743579AC27FDDE735E1E27AB0BC7D_cppui381),
+                            typename field_type::value_type(0x16BF2697741AC8FCD60F7C815C71BF9F5D7EA6C71B7C49329DBD9A6D507EEE879FEB134A454DBFF9417D4399FE2FE8CF_cppui381),
+                            typename field_type::value_type(0x0392F1E1A2678377BEC23F6EA87DC29D8A7AD237A39F0BE92560D3B3E2F44616E6FB47F04C8ECF0E4BEF6B482F70E55E_cppui381),
+                            typename field_type::value_type(0x0F810C4D964C7229684FBBC962955F0FDF87967E2D0D6061A9110194366C1DEC3EE0D782AFB1623254D0EB5E51A1DE3A_cppui381),
+                            typename field_type::value_type(0x018AF844F24CDF72E2F059259122A6C7D594F83AE615D1962A9D1BFBB1EE0E24CAA233EB698522AB34E4450F896DF920_cppui381),
+                            typename field_type::value_type(0x0DCCC9DA7CB3454779280C69F67DDD08A80351F127ACAABFDD02FA1B97B7FBD649AD02B55E48630AF16827D8A1F72801_cppui381),
+                            typename field_type::value_type(0x17BC5538797FA98919DE94163087543BED01EF99949621787F8A7BA034A6DFB5DB7DDB610D8BAEE1E069F3E3017A98E4_cppui381),
+                            typename field_type::value_type(0x07A2C82209DE0F7581FBAD29E429DBBE740280C863D92EA41934CFBB68D0DC2AE74B09568101CA3647932A8972172882_cppui381),
+                            typename field_type::value_type(0x07D54158C4076D425A7D31EF60FFF286B6433EE0750A1B3715F802FF357CFC6BB0D4203F3991DED4F7DB4C57EDD64723_cppui381),
+                            typename field_type::value_type(0x090D814053688D8522BC7B14D1709C5E2703B812305BB6C83ADFB73CEC67F564DE4FD15C5E82B2CBD50938400484CCB3_cppui381),
+                            typename field_type::value_type(0x19420AACC60A683DA05949F80E46EFB2F52E3DF9408A5A7E2764B9A6B79702670AB795BB1CD7AF35933DDDCC9C4884A3_cppui381),
+                            typename field_type::value_type(0x0F5A7AC7932C5A612AFD79F9815A6CF949E6BA0CF75547116CC115ECEF4667CFB268A59B79EC950969304F0181A2CC78_cppui381),
+                            typename field_type::value_type(0x1246CBCA82393AD9930C9258DFA2F442740B5C3744581B780A2E50BEDD44434D916C6D05A1BCB7EF3E5F87A7E223C991_cppui381),
+                            typename field_type::value_type(0x10A38128B0FA1C66792EE74F30F2AFE8BA3FED14C3E1BCA442F4E7B4B5B5EFE609E98B2C1CD243863B48232A2921E0BD_cppui381),
+                            typename field_type::value_type(0x0E09EBD0776B26F6BB2F5140B916FE22718AC0DF6A5DC6CFE4402086712090F384A5809C53801023F5DF367B5D2FFEBC_cppui381),
+                            typename field_type::value_type(0x00AD69934FA485BAAFD836930C04F89F953408733B5A2EC0EDE98A6568A86D14407EF44162E39FB5F140224190575BC6_cppui381),
+                            typename field_type::value_type(0x18D6D463E421D38621D2573EA1C6135B72E5576C4B89AD61FBFC9CEACC6C1A42DBAF36301DD43949D5439A6A65EF5780_cppui381),
+                            typename field_type::value_type(0x043874275D3EDCDB6853B2188ACD0C49BB970563333BA441B5E98D6409257F2D4140BB9447828FDFBF08ED5AF02A3C03_cppui381),
+                            typename field_type::value_type(0x082AF3873EEE6850B7049691C33AC811A6590F64CF7ACFD15175BC9A2B6E2AEE3A3649BBB1BC5E621FEEFF987271EB8A_cppui381),
+                            typename field_type::value_type(0x14B9BD27C8705EBD0E5FA1135943C3E639F574ED99590F2A9DD49595FBB2E4CA909D2B3048B24A9B24D2A2B012A61010_cppui381),
+                            typename field_type::value_type(0x0D350F3BF6C321A561EA3154E12EB9FAF589C06E7ADFC881C7389C187DA098C1151E95416EB40E4772CCA4A7881749CB_cppui381),
+                            typename field_type::value_type(0x0097AA55FC6A9ACC5BCC2DA6AC4D8B2724CE40C77F5DD24DB6F26C95AD37521D9EC47E489400A5621770878AE672C9B8_cppui381),
+                            typename field_type::value_type(0x13EE35389A3BEA272A7CC6F942D2D40C410A38BDD8CA6B54101E762EFE0E2EBEEFA0CA4139DF4DC549CE89D9E1E1E359_cppui381),
+                            typename field_type::value_type(0x13F43405345D6721F0E264FB9A1C71EE7FB7E5C7D8F71348C13B6CAA5988B23D4957721D829132649CB0F0A770FBDCC9_cppui381),
+                            typename field_type::value_type(0x049ED76AE0F837089A51BF285924EF9894ACCE36508CD057CE487C6602558EC8764664F35FA92CCE55BAB95FCE533217_cppui381),
+                            typename field_type::value_type(0x045D9B930A011A7AA7D297E56ED9836262CEAE204DD95528BA34E95F385E66F53B8684700DA456C71D80B2D8866C20EC_cppui381),
+                            typename field_type::value_type(0x149DCBC6F3A92AAC18B0EF9FA7B7B85C6E161E8D635D62AD4A3238304289E286D15AE368490A413128A00819D71F15CB_cppui381),
+                            typename field_type::value_type(0x00F12F0693C1CF454E420433240F3A9CFFFBE5B4AC803E9356136D60782FC53DA9215F0D7851572E115DCD0DD57E7504_cppui381),
+                            typename field_type::value_type(0x00DCD62E4A9F09B479A845F801987974C53FC8C3FA5C1A128993537D3A23CFB8258953CF367929A306692612FE16CDBD_cppui381),
+                            typename field_type::value_type(0x0FC596EBA75427E838F242294349ED9C23B9F02588C29930CC247E4E5D88C4B70079D141F372C598797BF0567FF7E2ED_cppui381),
+                            typename field_type::value_type(0x10D578653574C02D2AF42CC6C2EB4744C3D5F724B01839988D955A3B2D3110F15F2BAAA22193B8F07E88B7337C27E10F_cppui381),
+                            typename field_type::value_type(0x17A015180D1615EC9571E8C8004CF5EDF3218D7678AAA708CB9AE0D9D495FDE8D9B79DD54518AB92C79172B6A1360D4F_cppui381),
+                            typename field_type::value_type(0x18756C601247158F11DB2FDDFF59124E2CC33DECC478D0BE149D425570CEDC801A70746BB8B5E3EEAA6570E3F709A3F3_cppui381),
+                            typename field_type::value_type(0x0B51219D840B9C640AE21CBFFE28E82D5E4BA89DDF62FB1B1FEC164D4EE04F4694DDB36FC98D338B2A393992F8341A83_cppui381),
+                            typename field_type::value_type(0x18D34A7710623597BF4606AE021C6EEBD8EFBE7743A240FD7544386BA2B9762DF856490E41AC03CCDADFF5BC651554DE_cppui381),
+                            typename field_type::value_type(0x19D47F2BBB27F43AFC6A71AC770663C4B31FF17EAAB439AE7A5BEB4E22149DA062AA78B2916A24667F30C3280FB48BC2_cppui381),
+                            typename field_type::value_type(0x14F89FD156829F53818160C54BCB4E87A04C40AB5F341EC99DEEEDDAB74AFC13481437A6CFC92EA4CCB61288296CB21A_cppui381),
+                            typename field_type::value_type(0x19C03A2A81C20742283F8DB978846E28AEC2081622584019424F075DD3A8D73158521E709204AB725011EF518607AE61_cppui381),
+                            typename field_type::value_type(0x1572DA40796EAAACFB6CD6731E442192A0E2C281891F94A1369AF0F3DDCB80FCDEA9C9DCED57A4D321CC7020ECFACD15_cppui381),
+                            typename field_type::value_type(0x12B046E1495A725CDE40A9268EAEF3F99DB5ED6BF38AA6FE3626C59A2FF7A2EF0E424446B08F65FDF00CA413D3C692F0_cppui381),
+                            typename field_type::value_type(0x149A0383C9BA90586A5CEDE9340C44C886095A03000C9CAD4DA3BA8F90CB3C9205EF1DD815C908941FC2C7B642613EB9_cppui381),
+                            typename field_type::value_type(0x17374696173E59132D7D1D04945F346CDD28E57968421C67738684D98BD8F01BD91DB7554C6AAFF7ABCD452ABED360E0_cppui381),
+                            typename field_type::value_type(0x01134E68D5698FEC61E2C781F749A179CFCEE8CC89CCA9A016CCE2F53D78866C5235BE327055BDB058DC6CAE042A8445_cppui381),
+                            typename field_type::value_type(0x085630B4AE6EB315D6DE5E96752A0DE5E17124BACECC8B29C2C4E176047F63FE2DB8FE1CE6AE2FB7A4116C1273C0E557_cppui381),
+                            typename field_type::value_type(0x1810192E51935C73C177129B74894772EDADF1400EBD00B30432D104285AC4B42AFAE52C9D8DED7A33436C4006885600_cppui381),
+                            typename field_type::value_type(0x179B87CD3FFBDB5440031B17BAFDB217B9A9945133331B8E65AF49556683BCF66FCB52C73F70D5F64B526BDE37F5D046_cppui381),
+                            typename field_type::value_type(0x0432FD3F4FAA15DA234F892712C9D9266C2B170E7EB07E4CFC6C00E37E961B90C7A7927F9A0A8D9C1EC67E3D163505E5_cppui381),
+                            typename field_type::value_type(0x0C2520C59484A70BE63696DA8F18537C70097951E84E9FF9C31EAE40AB9446BAA73E68B858FF029C7E533D06670954EA_cppui381),
+                            typename field_type::value_type(0x0C0A0B1B29C8200809CA7FFCCFDE97171FD48605428C2411815AF05FA88552A122362D239AA14209269B8E0B5B86881A_cppui381),
+                            typename field_type::value_type(0x034B2AD3B402530985E12CFFA9C36BE9926C6FC1BC3FD98A914D4918136CBF20CFA8AB1AC3102BCDF7960B852160D057_cppui381),
+                            typename field_type::value_type(0x0507B93312CE77AB44A8485FC46C05D6B3B4396B948F7720A394A3324CBA60B4295BDBE5EF95E51AA559ACA4661F3417_cppui381),
+                            typename field_type::value_type(0x16019E7DB041EAB62F21922837524F122337DFA9C4B241C8718949694415DFD0D17452951348F273717A82E58728D02C_cppui381),
+                            typename field_type::value_type(0x192C525ED55FA1C9CBC9D0FB1D8880B4FCD45EA0D2FF12EC6C9346D65FAF1F0C3B589D22B015077B0DBBA7C3127163E4_cppui381),
+                            typename field_type::value_type(0x10729A79EC1E45831B81B79FCEB93C18891867804747309563D46916F321F13FA1A511109636D459B15A156652677FDB_cppui381),
+                            typename field_type::value_type(0x0DB75AF57BE53D7ADFD555B0A14C6CAF6038E3EE61A8095E1F37247D36ADA94EE49850A773AAF79541026DE686FE1884_cppui381),
+                            typename field_type::value_type(0x0E2A22EA32611AA1FBF8C8DD50CCB142276489AB75648565A05B325F4656854914D7D3708AF05D99F727BB5F3A3A965A_cppui381),
+                            typename field_type::value_type(0x162DF9713229FF1307CD00CF8422CEA2E9E9C1BF4373B3CBFEB03B469F8FDF01E83ADDD7E5FBE0E6DE6CD85B57871E56_cppui381),
+                            typename field_type::value_type(0x101635B90C3A13279A86DA06FF7537FA4398D9A72DAABBD01217580C5EE5A028CABB07FC5112B04C22321F480CE54AFF_cppui381),
+                            typename field_type::value_type(0x07923D3873B364DA4665C92B21A2CF7AC0531DB15FE11F345F1C07ED84103E0E4D12E45E1B3524FFC427E27AC94F6461_cppui381),
+                            typename field_type::value_type(0x19919EEAA43A6ADF3486FBFCA2A66BB2FB249C784BEAFCE850AE792F79ECFF54875225940E9C5703DD6D2FA83AC44C45_cppui381),
+                            typename field_type::value_type(0x077C11EC30C72875DE6C065EA23219CB57E209003A4AB7D1CE4A6F9B1C546CBB036AADCEB5AF7B99848634262F186484_cppui381),
+                            typename field_type::value_type(0x0FD0059B047A71C7853EFA22FBD1312797E433374D08EE1B8EED80E1E0002CDBF4272A9964E9F937117257FB2028784A_cppui381),
+                            typename field_type::value_type(0x1229A19E92FCBB65A6BE3EBA402B18AC85E01D2BE8963613BD406BB254589273946957E45953983A504F5608E6287618_cppui381),
+                            typename field_type::value_type(0x1852C1367B16F8C3BEF9E5EBA278C59564403C14A7E25C451034BBF13C34AE3EE36E52E2E785077F65243A953013E449_cppui381),
+                            typename field_type::value_type(0x08395C6CAB9897E7AF7C36AB6BF8E0F5E25CD083AA61F06062ACDC72703E30AD8659D8F51E22BD0D8AC6942ED52C15A2_cppui381),
+                            typename field_type::value_type(0x16934BFE76B763FE55841ABB4C247277510B4DACA7451DC3C178DEC4D808AF7DECF405D29CDF7081481CA517176A7DC1_cppui381),
+                            typename field_type::value_type(0x0E917D91914FAFC1F643FA096B22406997B223F5DA38C45BB554A4B11AE184969BA60D69848DEB2B8C2D0EA497A881BF_cppui381),
+                            typename field_type::value_type(0x12FC6D68FBE3C6A31A0105C2C1875E4BCF86E206A68290903E35E5E545C7D3C763D8B480B3E614833ED3E413C3DF8690_cppui381),
+                            typename field_type::value_type(0x07AD0817D6553F36F7C574739E576DFB3657F83428859DFB446092A6A7D5039E7F575E7865592CD8E02EAD5E965B3705_cppui381),
+                            typename field_type::value_type(0x10F30D7248F4C12FC5AC6A2140A2FD04208ADB185916BC9CED8A70421E1D6161C2ACFDB25BF0AE522D555A9278649F19_cppui381),
+                            typename field_type::value_type(0x1925030D4FF4924EBDD4F5C66C693DA37B6351E8B079822153C3057025884B21C5B578D268E5FCF66E598EF3F30B80A8_cppui381),
+                            typename field_type::value_type(0x19C1BCEF27B5E42572ABD902A21A616897F5A9AE533AE4BE32F478DA32B8792FDF037D6D09FB983A4F013A4641133E32_cppui381),
+                            typename field_type::value_type(0x07585D765F387A53E206B1BF1645DF51B305B7BF08378EF89C0E11679868CA452D471E2C5006B66095540B24FF5A758E_cppui381),
+                            typename field_type::value_type(0x0711E473D5D10DFA139032FCA9C7AC91FB6EB67D1CB32F4C3CD87BCAA2779CD8E0492CB404128F26E73702F4BB1E3424_cppui381),
+                            typename field_type::value_type(0x18B214AB5050DA49A9CBFD027B379ECC2BCC68AF47302D57974EE61E05A94514532FA6DA1302836BBB5DE16B23A0CEB3_cppui381),
+                            typename field_type::value_type(0x04274BF44FC628FD91D243B1AD03931F21AFF6F838F8C9B17EAF194CC3A7FA87489BECC8BF5182046B7EE677B6F61A23_cppui381),
+                            typename field_type::value_type(0x17FE0EE49FC39807A0F0B4D003C40A909C11F0CEE62866ECD16C6472E27730698E3C2C1B217E97147EDD6F321CB98E6F_cppui381),
+                            typename field_type::value_type(0x0981EB887A37B78197DA8B0FB754FA8940D459623CE793B630A902350D1AFE8B473E2577FF648257C1422658A386A75F_cppui381),
+                            typename field_type::value_type(0x125DFC3C510AB8C675673CD0F1FC1AE56CE0C0EA384702F046204DCBE1970E3E09D928E87E9202D5249E5139C52E2C4F_cppui381),
+                            typename field_type::value_type(0x045FC5503D6848A51CDAEC64DEE9A1A2A47D21C8C350E176543E0FE9483E5E625C72AFDC567D70C2F1062C0EF257A327_cppui381),
+                            typename field_type::value_type(0x1334146CAE20B5E6630D551240B32EABE3C9213C7F32B4FF747BC7B2F6722AA973CA405D60DD06DD1E484EF029E933DE_cppui381),
+                            typename field_type::value_type(0x017A05DC9A9D6AC98E94947A364AE65F75055EF6855D787A62C2D27A1E772BAF663FB90704816381A909C35DD3588FF3_cppui381),
+                            typename field_type::value_type(0x022FF2F9F46C4032FA7463237CCAA246455793704ED99E7C60893D44E4CAFDF9906DAD806D46BBDEEBF2CC2129B8AA13_cppui381),
+                            typename field_type::value_type(0x0B25C2BC1EF4D8966DE6B76BE86AC7D08F062FC8976A6BA746761457097D8899042B81630650B0D4A43EBC58F69201D5_cppui381),
+                            typename field_type::value_type(0x1860A7BE957941857E1C65D973984592F9E5BD918951BE787D7658B67996B9D555B380B43F07A804FD099E07E7A2AEDB_cppui381),
+                            typename field_type::value_type(0x0DFF942AADFC5E947AC32FA7369A6971A87E50805E9A801F3403A778059C9A2ADE71C526EB33F3C913DD345A26662359_cppui381),
+                            typename field_type::value_type(0x17EE22A0BF4B17B50E8DF7FF2B26AEDA074CE81EF0F4ED5DA792868BBD8065B6CE816870AA5C6E3D21E62F3E01B6D8E0_cppui381),
+                            typename field_type::value_type(0x09A1DA44704B62573B53425DC199B555B17F2A7E2643A42F6D7A6A7E07BF51F0F91DDB31BA1D34B7F7E9384063BFE731_cppui381),
+                            typename field_type::value_type(0x0BDABAE9DA3BC294A2BDE4C4F3FCA9B3400E18522F93DE1BE169D61D0FA7478D8BACE65A0AFEB6247CC2F44956A29E69_cppui381),
+                            typename field_type::value_type(0x1156851831126B566F4E22C642C7A2123E69C6F34876BB2DB69BC8586169EFDB0BFF89EE20D9293FE75E1434CDAFF3F9_cppui381),
+                            typename field_type::value_type(0x179DE78C21F65FFDC30256A3C8A8B02F18B6C6DA9B005B4AD5F20703279BE063FA0A2359A03EF779E488EDBC4198F474_cppui381),
+                            typename field_type::value_type(0x154A3D21F8EAB9F72DF5C18F3D4F718B2B59DE7FB7249EF95AF2F37D86024859E5C2FC032693FE3C9016EC03F5D83A88_cppui381),
+                            typename field_type::value_type(0x17A9E201331BF4F9C710414C877140279E2CFFDDA77A6B359D73F5178A7BBA85523BB573F5419B195EFCCD1AF7F4BCED_cppui381),
+                            typename field_type::value_type(0x1960C9F5D2B8E3E76F51851BCE522AFA2E78175A6A3A7D13ED78D6CD9F5F949E900960F9763DE22EA3A7D3EB8965BD95_cppui381),
+                            typename field_type::value_type(0x051F9BF2A1AB87412AE619EC8C6D0D5E0CBC58DCF5C0BDB92495632B9AB8E2272E9400B82DB2E325A512C25F0905ADE4_cppui381),
+                            typename field_type::value_type(0x03BB067C93BABD2A599CA5912EB2CD59B1E59D84D8D7473794DFC39A1239A5FC6A6AB05215210746B889C30B3FD0C907_cppui381),
+                            typename field_type::value_type(0x038C60C217A129325071509153D868544BF11EEA5B7B60DDE1ECC62A5BB6BA2C978AECA42969AF2487884D482F1B3B2C_cppui381),
+                            typename field_type::value_type(0x043AD35400B8464E0E2917D7B12C458508D7CC0A5D5164A3F4FC674010DA4870FB01EEDAC45D21D61AB7C3F2CBAB0418_cppui381),
+                            typename field_type::value_type(0x0B6B7D23A1DC670730B0D6FEA12A80E3095AC908C1BCC22C5B4B5B188BAF0C1711CCCD2376EC556B63E7958C0F51E45E_cppui381),
+                            typename field_type::value_type(0x01C049C38F4A1E12E1C15FC6721B127728183F03B740106B8A2AA1886F66931EA9C8DA73A1F6545DD93AD5448411E7E8_cppui381),
+                            typename field_type::value_type(0x130296A75FD94A201B5733913C08841D6970A9A9A44CC8E4E5C0A289039501DE315EF151E05AFB63FACB1C9E2B53C127_cppui381),
+                            typename field_type::value_type(0x0008C25ECB5DA320642FEE8C5774DA01695C0A8EBDA2E1AA06274D0D0C299C2773F144882744535BF4216F51C849AFA5_cppui381),
+                            typename field_type::value_type(0x137254434BBF822CE5CFB9E7D10BDD1879E75390146CAE89DB13038367A3173569EF7692950D2B0B631E0F63CF864E97_cppui381),
+                            typename field_type::value_type(0x0CA304523E9A2E472C0D36032AA04442B7DA35BA45975004593A5570DB755F786ABDE44D091D5B1233F986C3FE3F16EA_cppui381),
+                            typename field_type::value_type(0x173BD1701EFC9AF613F67B7CFF222B9F69CE1AA50CD1C90451D9D35BD87A672940C669DEBC7A012CAF0C1011557AE0AB_cppui381),
+                            typename field_type::value_type(0x0C37764BB6956EBBF6B336F9B15DCF7172385C49F6EC635BF2B7197448073A9962D7A8DE314EE7ECE0D62FD429FEAD98_cppui381),
+                            typename field_type::value_type(0x16ABA2863F4E7268BFA4E162C6CD3750907DACC1957BEA5441E9C01EB80C021A208AB270D0D6AA30E7CBD1D9385113E2_cppui381),
+                            typename field_type::value_type(0x0295CB901D2C0D26FA290403350072AC7439FD941F66D87CF327061A166208620BFEADE1250BA5F72813CF6907AFAF37_cppui381),
+                            typename field_type::value_type(0x00D6261DC428E7431D3271C92FAF0F785E2F408F19985C69ECFD017B06010897CE578633415AB008287C63849DC50254_cppui381),
+                            typename field_type::value_type(0x04D14D638F6A9ABDEE0792B78DF18F1BDAD8A5B753BACBFA2115C377E5D16CBDF00F00CB0E0D6FBB0B2663D97BAA78A3_cppui381),
+                            typename field_type::value_type(0x020340898E4F6718BC1DBA6965A69ABA9D59468909DE8FBBD8EBFC59A6F301A067487CE6E094A1686B9F73E9E1FF9191_cppui381),
+                            typename field_type::value_type(0x142F8E1B750AD249492B4286002A9D38B6A4AAEB85F64402DA17EEFDCECF44C77CD46E240A1F5A87E53323FE09C947FC_cppui381),
+                            typename field_type::value_type(0x09467AA7E6CECB0D3BE7EA4776F056353AC31DA7C54BCB93125CDB64C312F3240041E55024F5EA3673E9FC46942497E4_cppui381),
+                            typename field_type::value_type(0x09D84FD9F079A421B557C437C815DC124E7F0F05F88F86BE74C46494F1BD027EF9EDB5092A4251D423AF475B80660944_cppui381),
+                            typename field_type::value_type(0x066998633BE44D6B0228B31CAFF5D6D394C9EFFF569641018CEE94F197788E430135EB4FE9F8CE4E55189C02AC84E0CB_cppui381),
+                            typename field_type::value_type(0x0E94B4A47793D3801896664A0A6680FB8B24E2F970A2A6D69635D6842901D2FB5E84FF6BE8F30F39DF226753B04F4B1D_cppui381),
+                            typename field_type::value_type(0x1461B50DADF8C524A0F67AED97F078FB8E974D70FFE1DDDBF81E8F5C32F608C94CB65BB4D4A7F44A918AC009B38C8125_cppui381),
+                            typename field_type::value_type(0x054176E8CADD89461AF2E044A47DA9BC5646AB24A3204DD16A5F1E3315B39B88B26CC1D552D01A0B8D1BC26D8570646D_cppui381),
+                            typename field_type::value_type(0x09F7EE08FBF5F5105D9BCC9B6F602C7A3D9429FE6BF8DEC8B1B8D44C6552AFB64944C3840D1BDFBDD311C0DD8EC43714_cppui381),
+                            typename field_type::value_type(0x04D6549E5D0A674A7DDDD9AF48BBBC86AF752F671D2E3C390449207742E3B1A0217E367DB08382C2442E2A57B8DF569B_cppui381),
+                            typename field_type::value_type(0x1099338126A9BD95345D048E0719C93ED7423B6E0E259C70E6BA5B890E86CB142216A6B5CF2882C2D172AF5BA8C0FF63_cppui381),
+                            typename field_type::value_type(0x09DEA446B3105EA146C3BA17BFBC63B48870AD076877E8189E492D33BDCD682A094ADF359CDEBE3BC51C6FCDF9FD580C_cppui381),
+                            typename field_type::value_type(0x0D7A8A897C3A8039DB049BAC6AE1C88E85A9A2C3714D66633C3BB9E019404DE8407B5DB4609841D76149435AB470996A_cppui381),
+                            typename field_type::value_type(0x17611BFDAA863BB2462FAF5EFA43C47BAED0E6495AB987F9FC907FEF772F0CFD373FE9C33719B4EBF14E294F7C648A29_cppui381),
+                            typename field_type::value_type(0x045BD93448FB05971A9B2EB0FF8BCC4A746AD61C5764CB742FA0BBAA8A35C7CAAD46C35E433D8DEE65E4399D95DB6C95_cppui381),
+                            typename field_type::value_type(0x0FB66A82EEBF8DF20D40838C35C3F685A6B80564646E53D0F8ACE436177A1E4FF3DF3DC04752A978D9221C9B2E5AD12E_cppui381),
+                            typename field_type::value_type(0x166BE26EE3240973028B452F5BE05153F8FF96539BEBBF356D9708DD0932EDBF5FDA85940AB1CC59ACE989BF528AED8E_cppui381),
+                            typename field_type::value_type(0x10956C72C458B6EC0D4E2235C290F5D337292E9C5A34E182067BF7264480F4C5AD738330C16223A6787B40B1E6B0BF73_cppui381),
+                            typename field_type::value_type(0x17AFC6469C2D9C8E78714ED4DC2C04E0823273733E557EF14E4E4AD11C7E055611BF60691C1B171424BBCEFAFC1CB096_cppui381),
+                            typename field_type::value_type(0x17851DBAA3674A31F520E81E2544512A082F26ACE367753C03E95CC36D77998B83E8C7E2EF0ED3B8433AA41A7375198B_cppui381),
+                            typename field_type::value_type(0x0BCFD93EEEE5843B044F36596773FB99A6F95B85BCE01F585BA3C5C543CE775C00BD29FFB1C983E72757BD333B659BB0_cppui381),
+                            typename field_type::value_type(0x01A083A108ED3D397727AE3DAA0D8E0C10BE8AF37C11AA5DDA96027ED416C4BBCFD371AE85D47927E376D7A16005C5C9_cppui381),
+                            typename field_type::value_type(0x0256A024BDA3B832897083C858CA46E7908D75EFF9B4E13BE13638BB00CA2CD7EED9438C93859B0847B42779A56ED963_cppui381),
+                            typename field_type::value_type(0x027C26A10E27C122F157C10457988BBA3658E5BB19240EFA69853A46D83734C7380AD39938860CBC57373695C5C4E413_cppui381),
+                            typename field_type::value_type(0x0E6BF61D0F185156C51A53503BF7F7FBA8233DCC74AF9BFF583C8B82FF44ACA93B90746B9D614349050149BDAD36E804_cppui381),
+                            typename field_type::value_type(0x0A104FE5B8D3C0E3A9FA7BE3EFB23EAD7FC50B2F2B233A29B98AD44960E194E49D368457A0C0B498DB992621D4765CD1_cppui381),
+                            typename field_type::value_type(0x00C1B7447E0EAF5EAFDDA32561A8E4C466598FC072737EF3D57168B24A48395CA4CB3AFB1C42880288180FD50CF87391_cppui381),
+                            typename field_type::value_type(0x15F4F873B05190A17AF9F0B01439944445F1F9ED11926745C1EBDC2307F927BDCA9E354BC4530A8928EB904459C4DEC9_cppui381),
+                            typename field_type::value_type(0x01A85AAB339A625BC5BA1B6BCED674A4939B2684169D992A6CF0CE06B751037C6B3B4B32DD7FF715596A204C8A30252B_cppui381),
+                            typename field_type::value_type(0x10D3117F9DFBD75AA6185833935562801E70365D5BC4FDE714A0AA0D2D691387024F22133C0A7C53F8A2F48B2E1119B0_cppui381),
+                            typename field_type::value_type(0x191A46526388F01471BB314AC9ACD663AF1B42CBB53356C29FDA6F62B26E046A3F97561C93990D54045886156362360E_cppui381),
+                            typename field_type::value_type(0x01E62B49AEF6635B7E43D6622AF87E0DCC09D74181D0810EAB7DD5751A3EE9A0C9DC1CF209A099F4F78B32859D40F1BB_cppui381),
+                            typename field_type::value_type(0x1687DC4D01F671415BB62B0F3A5F3519E51D6C280D9182E2DD9DADCFDDC943B074A2330B1D31AF40606BF16229E5209C_cppui381),
+                            typename field_type::value_type(0x06E1639446026A337F079152B8262AC1588CB95A6D5C914ABD0BDB290D269A221A503027EAD4227E692D372F928E0E95_cppui381),
+                            typename field_type::value_type(0x083D7161BEFD5FDEDE4897C91171477424EC4EFC47B8F8A097CAAC2460686E94CBDC9D2BA3C7E0DE3AE98B9C419121B4_cppui381),
+                            typename field_type::value_type(0x0C50A0FAAFADC28244C9570BC6FB84003D2030BEB1CF95F5D6A94CCA682E9EE8C89D04FA888A5F67CEB81EEE50AC7831_cppui381),
+                            typename field_type::value_type(0x0EDBDAF35DE28E51C0606DA0EF92496A1615058EC7EE09972BFEBEC34966C6BB67A19C80F6A5FFC504281FAADA148D61_cppui381),
+                            typename field_type::value_type(0x096747E1CB6F9134AC1B86CC4D580676DBEC8D287243CA74DB9EA94E574977E05C1C05847DC5FB60C2BC23A92E252B08_cppui381),
+                            typename field_type::value_type(0x0C085EA32DBBA3D2ECA5D8BBDDF6BC9D4BCE65894CFFD99DAF320F8CF4A70302CE30AED5FB60FEFE24F83E6CF73170D3_cppui381),
+                            typename field_type::value_type(0x07EDDE9D5738F1A3E8DF13397695C444A722C048C83F0F8B88BE164D5A2E8F30B5AE4C4282399495E04154FCBED921EB_cppui381),
+                            typename field_type::value_type(0x0BAD6580DA991C5DF6C0BEF2C73DC1551B68764F90B183FFA014E65010F7FC4483AB72C24F7750101BF99E74A3157F95_cppui381),
+                            typename field_type::value_type(0x0C8BA13E379D3E7F7823EE134C15D309D67AA5521DD2FA43B3ACEBAE33E82D8495C6598B257DE00E77F46B1E7A73F265_cppui381),
+                            typename field_type::value_type(0x0F86F7DEC1F25FA467C26443FDBCB35049CFEFC8E003C55FB2DF5ED34A4894351D3573A70843DE8F065F214F39856E58_cppui381),
+                            typename field_type::value_type(0x19618C979E4323E3D351D37FE69452B41BCDC5CAF73886E62B5BA708F9152E95FF54CDED47D6140627DB4E6C6A3C16F3_cppui381),
+                            typename field_type::value_type(0x09AF66B04369229EE2170585200A2AFC7F89FB7739ED8A9DF910AD8FD429F2364368A637FCC8554CB25868FDF66CC5C0_cppui381),
+                            typename field_type::value_type(0x14B446F07CBC7FD1B0DC85681505C29610410886116A1AD62564FCB501D543173F6F17062CF564F63629245F4CCAE9AD_cppui381),
+                            typename field_type::value_type(0x0ECCE903437E95F43927AE6FED18E26E3808B79CDA1B4A3BEE2C7FD3CC4E732B92EC196CA2FECDDEBDC7BE7CB17EAB7B_cppui381),
+                            typename field_type::value_type(0x07A30954037E651ED39FA6E5A19630203F0CE13A8EBD152AB8F6A7DE43F04B300900F216044F1735EB97C16C309DD6C2_cppui381),
+                            typename field_type::value_type(0x1807E84290E82B20F43C0EEB5329F451ADD2C7BC23D68C04A0728741AA8EB3E624439D4CA698FD27139D1B8A38465B0D_cppui381),
+                            typename field_type::value_type(0x197607CCEE0D0B65D1F9BED6B6FB72934B8A3EC6DE4DBEC24CB2CE520C4747FC319F27F4C78255FE608267F5E004058B_cppui381),
+                            typename field_type::value_type(0x11CF5EDB84A90A84367C455B53B7F785E3566218E52A1AB6548B862BE65582C70529F2810368B2511E1FBF654A664E58_cppui381),
+                            typename field_type::value_type(0x10ED1630A0FC41C43F2B52F92FB6BD9F6E10163C2FE4940A50C830C68695EC38FC3A0BD218435A44A1279EB1FEC25992_cppui381),
+                            typename field_type::value_type(0x148807B9C78791DF77B049C1B013F2F328F55CC8006473262AA70A48D7839B95B145BD5355A9AB12BB4836455D97498A_cppui381),
+                            typename field_type::value_type(0x04123C18FBC3323AABB95108EF4CC4C124A6D0C3316EF07903CD43F12CFFCDD33176B7C227C9A9F26A12DEEF8362E593_cppui381),
+                            typename field_type::value_type(0x08197F24CB6D0DCFBCC6911F12CD907AA8651E4F9EA3CB2A833B59F601636DA4625CAF07BDDCF0B1BFB03E7F3A90A01A_cppui381),
+                            typename field_type::value_type(0x04D8B7236B677B4315D4AE15A7E41C058EFBF6739C55C09F488F37F40A20F08EE1B77D6EE324185B4D9FDE20FE4E4722_cppui381),
+                            typename field_type::value_type(0x19E9412B8FB8ABAB15A274946899E067EA94951FFDAB806C6B932D575C99D648022DBD28FCDA3DE74050E825C9CD174F_cppui381),
+                            typename field_type::value_type(0x0D31FC5A6EC86CF06FE14D5988162F1B64E1215F8171B637C357EDC442B93BC512FC183020B079DE64229360CB7CCD74_cppui381),
+                            typename field_type::value_type(0x0F84F02754A8B9CD40D788CD31FAE7763B758C985881AD5E73A19AE09C972B86CDA15E33F2C17B71A0B9E44709373CD1_cppui381),
+                            typename field_type::value_type(0x05C833200C64CEF7FB075F361E41105BE6C5631AAB3BDE327369ACBB00F3DB124EB0B8D49C7E3AF6803AA34F0BDB3ED6_cppui381),
+                            typename field_type::value_type(0x13EF455A90AE21CD1E6FE74AA1A2447CCBE6B764838562F6F16C572FBF0F6094F0AD2E321489D0535DDBF8AF66DC4AB4_cppui381),
+                            typename field_type::value_type(0x0C40D1B4405D216770675028467887B117272E962C35647A16B9C2DA99BCCD8776175076E00346F4E8D7BF6C8283EF28_cppui381),
+                            typename field_type::value_type(0x1394CF6AE45C04F4B5D30AECE90136675EC1C7E5C0C249970DCDD5F21A0C5D8C665F8B0A3BD2200C425C0207F730E842_cppui381),
+                            typename field_type::value_type(0x0FDDCE17332AAED52565D3D8C1D5F4F24BDE7419F8746D792A6A79F91B8A6D1AAA4E0F4FFF0B2459DDC71B035FEDBE8F_cppui381),
+                            typename field_type::value_type(0x141BE236C04EB0E444A1AEC451A96F4DCC1AF686DD9968C38CFA9CD5AC90EEB3E580841F253908B7A830E83C9B115C0B_cppui381),
+                            typename field_type::value_type(0x1857825B3EAD1A016D3560FFC4A72171697F53653AAFBBEB2533F9659F54910765493EC78D9BF78B791543FF721D2CEA_cppui381),
+                            typename field_type::value_type(0x14CBC4475BBA74EDA580A14BDB1A41D906329C96E25DA155EAA47ECC36B7E50FB1B756DB53B70A86642826E0C84FD1F9_cppui381),
+                            typename field_type::value_type(0x0EEB45D8D37E685CDC33C1A92F39C3D16A4258BADA0838423A06B14DD6CD74B1FBAF2725887C03F162852037082FB23E_cppui381),
+                            typename field_type::value_type(0x0A13EF7B1262D4312833CE888F777764DEE1BAEAA560057C4973E75696CEB11186AEB99F094A3051D0DDA0E420D5D1DA_cppui381),
+                            typename field_type::value_type(0x0710EA01F26004EDC004ED462E27E81B4DE5EE0AFEE312C8FDA57871CCC85DB304F4BF8E1F4D7800B0A31ECF3DF098E4_cppui381),
+                            typename field_type::value_type(0x01A40FB4F6EDCF835FBCCD23909DA4A6631608365BAA57E6A61A0F037F9D3AAD6F632AB437BEDD835D5571C4A78FA46A_cppui381),
+                            typename field_type::value_type(0x085961AF77E207720E0C80A954234CC3540ACD60321C3C88D478610259257C0F7D57F9EDCB42BD2ABE3DCFEF0B35C2D8_cppui381),
+                            typename field_type::value_type(0x1592889850AAFB9F5E30B1A083007747F058AAB2998587255786A46762370F710C1E4339ECEBBD2BA5302FE3026DDBDC_cppui381),
+                            typename field_type::value_type(0x0486FB40910C63807B1B0D183299369446D4D25A326FD2F167D49A43951004240C4CACDAF44FADDE5AEA876EFA24CDE7_cppui381),
+                            typename field_type::value_type(0x141EC0C15C2E9D8606BAFFDF56695AA3422524D9E9C781BA09813B5AA343B119020F6144ADEA5A8571F5937F4082D74D_cppui381),
+                            typename field_type::value_type(0x0B8F37A7F0D406B212CC07134E964AE088A022CA6DC45C2DEF7D2CDB4A3B2878FAD776F88DE023D9A421753740FEFCD9_cppui381),
+                            typename field_type::value_type(0x15C81D07869ACBC5A75D3FD94404A1268B5976D964972D04BD3849D2E26BAC5CEA35B8A6A24AE6E37386B7CA6D9E6E80_cppui381),
+                            typename field_type::value_type(0x0794724A4C2A5254832E9A40465093EE2B059AA01C67FDE40ECDD26099FC97AE4B4811F9EEA212CE0C869FEC1AF41BF6_cppui381),
+                            typename field_type::value_type(0x0C8C6075C3613F3E72ACDF49F0A6C6A679FAFEB1B8F5F4B7D0EEE0F1B2A13A8F2C3076C96AE93F873983DB7E83A144A1_cppui381),
+                            typename field_type::value_type(0x174CB5B8BC770302FFCC5295101EB32974059D29F5A8EB835B81002EF7A3D66C93BE6093ED26499213C6FC3C706F1AB1_cppui381),
+                            typename field_type::value_type(0x0FEE28ACAC99B6A5091742CF2B8AA9892CE66C6A58356FDDFBEA22B4717A09B2B9EC36151164FB40B2366328E3A55A92_cppui381),
+                            typename field_type::value_type(0x0FCA77E49DD8970D181DB79271D1FD3291F1E5797AF2150F0413B7F40118CDE1EC69C79D730B6BB25DA9E5274E15C8D8_cppui381),
+                            typename field_type::value_type(0x070E58CAACF7488FCB1057F1A70F7A2E35A1B74B28ED61C706CAEB42298ED6FBFBD9B8DCAA36CC0828B8AF26B4084A04_cppui381),
+                            typename field_type::value_type(0x1075B85C728114044F69697CBB26EF802019EC90CFB34789BF6BFA7E533DA81555E3C64B5D54A5A72A40F910C55F744D_cppui381),
+                            typename field_type::value_type(0x04556423D222C74B922807F1046637D6AB51C4F8EC2BE2D0657ED413DFAC4992E47041332FBCA87D9CFFE31F13854627_cppui381),
+                            typename field_type::value_type(0x067720462BCBCC8F87EFA2D6369A98A61F70B280F2C39C13D32199B9B7D1EBDB6175EB053E64332DC495DF7150DB4403_cppui381),
+                            typename field_type::value_type(0x0DE515F1A50479ACE0C8BE2A2F608A0009EB35B3CB211D4E4EF9ED607E5C1A7D8960C73041BEDEA8512897AAB5B8AFB8_cppui381),
+                            typename field_type::value_type(0x0CF548C4F88E0EB5D0ECC120FB63708D6404824EE62BB61432AD8ABCD7445930605C53A0CEF6C67A97CA3F37660D094A_cppui381),
+                            typename field_type::value_type(0x108DC2853407F18F2BACEBC2F99738DDC0841E7F508B92985BD3B65292663F790472020F7004B57E66CCAC302205B3BA_cppui381),
+                            typename field_type::value_type(0x0C3D2C83D869A569D4E46D72AD36AA9DD0AD3536A3BD3A9C9B909F80DBABEBD48B84D211C50ED72DA4C3CE908D0825D7_cppui381),
+                            typename field_type::value_type(0x08CDBC9E7FF45606BEAC4C520D4D32D391D7FCF816F903B30FCE0F49B3AB1D7EDB5DF552D6996F015E08A70F5AB83907_cppui381),
+                            typename field_type::value_type(0x10A9BAD9ED59405EEA02C117812C1BD48C54E91142A0649E04E7794C9CE012B1FB5459A4E939B0BCCBDC23FBFC5B006F_cppui381),
+                            typename field_type::value_type(0x1709262099881557A0AFEEA19D9FB6F4864337101B7D3220C09257D7A79DA6B1C60AE6509146063BDE03468C74109B20_cppui381),
+                            typename field_type::value_type(0x0CA8538422C2C66CF6C09DE91FE5DA9E41A6329B0954EAE180124EC059D76FA3EB6FBFDC9483415807ECCD3355923FAD_cppui381),
+                            typename field_type::value_type(0x0B131684F7BF5246B85DF2F3B17C7B25D4929AD2D1D399E32E8A8970BACA576F463EB81385A648472789B11AFC135622_cppui381),
+                            typename field_type::value_type(0x04D75CC75A68BCB1C2AB648DAE8A212947DCF5E0D636817B4ADDBB8DD61C8E8AF0FACBDF63ABDC42BF64A453AE7992C1_cppui381),
+                            typename field_type::value_type(0x09C4DDE54159D4F0D93FD72C0CCC86A8C9AFD6C9D7CCAB3942322FA9628C8C9EEB020E5C5990D6BF8D857AD224822FBF_cppui381),
+                            typename field_type::value_type(0x033448D03448A7F0B23E3A6769CE2B80326BA38C307FB3B8D6D78B21CAA5DD265175CC96CB21C24542AFAECB7F4D4797_cppui381),
+                            typename field_type::value_type(0x0E59485DAFF1750912F2D00A6E6E54BF0AF608C94CD46375613A18E6CF88DA0FF5299ADBF8F3CE96BBA76BA12A7B0874_cppui381),
+                            typename field_type::value_type(0x092BE071F34E60FC6B5EE62C2B18E4BF1FB00F98BE9D236F03C3C6315434226C64F6F40125E68FA99349D3993E22E8A1_cppui381),
+                            typename field_type::value_type(0x0E10926D91B0A4A18397EC6AFA99A16E26F02167E5F63ADBD0E18D92BA499E0F6AF826FF725BD2802BB25807BEE2C78C_cppui381),
+                            typename field_type::value_type(0x0FFBE598793F5368676E44239A584C113F570B4F959ECE8C9BC6BBB8499FFDDD3DC6E03B0C13A6C7B164E8F790EC57FC_cppui381),
+                            typename field_type::value_type(0x032E36639FDAB57B99027875F759434BC86B7E3BA74F02094BDE19E9D95A385970F1BEB802E3ACFFC33EF9C2B2873699_cppui381),
+                            typename field_type::value_type(0x0580791351324A391E323606B2F2B15FED55B3DACDDFF896BBC960CA0C45EFB9402AD1CD6D36977189443F9AD3168B03_cppui381),
+                            typename field_type::value_type(0x158098A75B3938C20D17AFD710658892E54DEB837E5889A0B50922E9DFD4834DD5A730925E25D1E9802B276EB240529A_cppui381),
+                            typename field_type::value_type(0x0A6F2A7366B96E14E616572224C8E5B092994E91A45117F85C18E94D67BA0AD9C3C75579F53FC03E7E9F02A343112739_cppui381),
+                            typename field_type::value_type(0x047FDA65B67CF72149EB0D58F2CAD9EB376AF1C54709C8520447D30249E86B37E68E3EEBAD647266F03EB33B5B199927_cppui381),
+                            typename field_type::value_type(0x0FA2097745273DB45EBCFA99AAE1695F9C93584FD1715699C565031E207ABF8F399A51DE71EB7B078C48F46D9CDC0E5A_cppui381),
+                            typename field_type::value_type(0x198E819CED7BBE892A560559088F16EA6CD47BA0BE019F1BD1665176FCC6053B91688A20101BF662AFE5D4236AF6C551_cppui381),
+                            typename field_type::value_type(0x09BA1A1DDD2798A8E8EE490F8B407D9ECBAB765163DFFF3DA3F1E7152E7AEA4E6CB115821C0EC671327EF2043CC9ED86_cppui381),
+                            typename field_type::value_type(0x15624E2504991882A12C9EEB4D4B2DA8C7582F058B7ADED1EE54CFFCDD60491BE1751DC13D6BA1E2F34759C3F5BB9F44_cppui381),
+                            typename field_type::value_type(0x073AF52B004AC80C0D5BC5E15341110C26C780287B6BFCC20DEC7A88E5891169E9876EFC1A8B17424A82CDD44F3A5E40_cppui381),
+                            typename field_type::value_type(0x0980F91A0B8F69DA885DBB78C46EF59A2D513327771BAA056CAC4F86917FE65CB110AE5DE381ADAEF90E582F3ACC8B04_cppui381),
+                            typename field_type::value_type(0x189732A11F7B45D04734420C8084634D51892AC4D7CE997ED00B939F7A4EBBF043928D095749A37EC8AF28E3E0E64C0C_cppui381),
+                            typename field_type::value_type(0x019D8CE5C700B0A8DB317DAA7EFD8511E4D7CFA4D459A234BB18A52014A814B8640433EFBFAD11A821EAFA45EEA37B8B_cppui381),
+                            typename field_type::value_type(0x051FF2370FBF022E139121B2CD67A3DB316691023136B4C1B5C30917D1156CBC62D1923F26A9887E8B89EBAADEF25CDA_cppui381),
+                            typename field_type::value_type(0x0FD3ABDE66326716C57F5EF503B09C1327D2059C865E108A0952ABA447E5AC4F453B680BF7B83A0462E50FB126375EDD_cppui381),
+                            typename field_type::value_type(0x18685B6277E95BA42A5D8BB9F4025726648403DCDAB1D88974AC8486B3A56066B5EF3977CF38A963CD64D176AA9BBF4A_cppui381),
+                            typename field_type::value_type(0x11A5ED8C0516566D7BFBEDBB692FCC6D37F072CEED5159C800FFF938DF61848D1D8F9CCFC4946796F826E6684ED60B06_cppui381),
+                            typename field_type::value_type(0x18230708A034280D33F9B22F50D6A0DCC7B5F754184250EA134B224785A95EE494A6CFD4EA481A620B9D10BAA573F082_cppui381),
+                            typename field_type::value_type(0x1337A63A3FC4323C2314CD9F052972009021E37851910D457588BD4751C3CBEEE39E0EAA9EDF5BEF7E6EDAB4865373D8_cppui381),
+                            typename field_type::value_type(0x0FD11FBCCB298B9B254112111C864179F643E7741D601A542B7A212FFA8592EF802CFDF19D371B777283F844E4791A38_cppui381),
+                            typename field_type::value_type(0x03B463BDAE3C9906C0B33AC6417EAC250909A568858C40C04B80B335A16AE34556A1974ECB6ABDCD4DB48766204CE3B5_cppui381),
+                            typename field_type::value_type(0x0014266D9BF279990483FEF4D5C3CB51BA8F984A7A8E94B4886E87757F549CEE38CCC1C1797248072E6B9E95C409B7BD_cppui381),
+                            typename field_type::value_type(0x0A977724306C4081EC56F05AA8F66AD858A49A9BBBFEC383A4D238D9C794FC3427C82352209E622616454F08C7AA7CBC_cppui381),
+                            typename field_type::value_type(0x0EE0E256712625D1AFF4D0258E3F2255A311E2A9532C9ABD4370BE57C347481A6B54CA73FEB194583923CD2CB0B4B84D_cppui381),
+                            typename field_type::value_type(0x175D618F2A82EC4883F7292273B01577A3CAD2A462A6038830B14D8F792D00E7DCEB5EBDBF37475C84EFA2E7B9910027_cppui381),
+                            typename field_type::value_type(0x08973647A8546A237DB5ACED219A3B0CFB3A16253F67574BA7C8A669AF428E923C6468016CEC2C4C3C6EBFCAAF82F7D4_cppui381),
+                            typename field_type::value_type(0x0278A7A8E8A0B3184E412C80782B21C61B8BF38E96485A380E2EA94BB3F35A49CA99D8897256915A688640719F7E2B53_cppui381),
+                            typename field_type::value_type(0x1094AA0E8C2497CF2AA4157635E3E55E68453CFB39398368049C23B3D127EC8FF9CC0028DA267F3335EE81320CF5D37A_cppui381),
+                            typename field_type::value_type(0x07F7171EDC0C186654A46D7F0254BC88995213693200441DB914D68BD0DE9B93CA0008387C5FA7B26DF11E1108F9AFC9_cppui381),
+                            typename field_type::value_type(0x04C6A55AA9D9F0ED182FDAF60ACEBE0E0E6EE7F38884333857A387B015A8EB398F9A8F50B9174617E39B09049CB52274_cppui381),
+                            typename field_type::value_type(0x0B7345B98A3FF4F4CED428F0758D76EE6368F315172670DA13587D988DA87C3238C4AAEF9D3D2D9530868F12F2D5E611_cppui381),
+                            typename field_type::value_type(0x0980FDF2084F606F62D7A9E2F947E6D3DDD192A6142D52E3D781BA4397B48B5E226637EAFDD9816BDF7D5BC8734C8352_cppui381),
+                            typename field_type::value_type(0x00464E6316B9363EDADC4BA5356F4492AD0E04A3794EC008D10417891D6AC3B3CE605891C2CE8E9307F59A0F2AD29F39_cppui381),
+                            typename field_type::value_type(0x0A25D708F7776E8857ED818C99E9BFB4DAB71FFDBD0CF269B7173077D6DD2208A842E3BA215B2B3334F812E9E4E36707_cppui381),
+                            typename field_type::value_type(0x19395BEE01B492A5CD9D2A155AB3A4993EF71536D9CF89A9CC2E657B2ADE399449936E9656A0BB2E50D40813A5110047_cppui381),
+                            typename field_type::value_type(0x06DEE9AD2EE2683D446F91BD7870C595572D7E009A40CADD072F4233253A519498E1EDC2BF63B7A1C062543F61FBBC21_cppui381),
+                            typename field_type::value_type(0x01782B6B38B90BC7E70904C5E5AE8F85F9C9A8B10E0FA6568E65AF4436DFA0C70A0BC54175CF01B2DC976AD87938445E_cppui381),
+                            typename field_type::value_type(0x014F3B200E4BD0A31356A24B81784F7DE1BEBA7CD255CF4B0651D6844A76C9857413E3C6AC873EDE63C78AAA26C88634_cppui381),
+                            typename field_type::value_type(0x15009EBBD07347F891327B3E00E301737EC22A88B79D7DD098B34D051A39C50D36604A391859DBBAB866C81689CC48FC_cppui381),
+                            typename field_type::value_type(0x03543484C4409667CDF3814C06D5F9F5F7A36FBFDDFD0883FAA63D55B48BD1630255BEB266ED3EA568DC24A33F3BE2EE_cppui381),
+                            typename field_type::value_type(0x02397E91D1563FE78F707A7E15C0BDB87E6A4359D496049E766034A7C282646A46781714B5739D70D4DB3451A5F069D4_cppui381),
+                            typename field_type::value_type(0x0154DE14143904D1A26E0BE0A30BDB7EA01CAE0295A862CC20F62DFE9922B31B49F45119D19FB9C3376D97D816CFC3D4_cppui381),
+                            typename field_type::value_type(0x125A15E9884C2C4FA8C4B854604872D701AE8291711A778CD49A2C3C85044E0BA5473891F97C92C4C02BED2B949CDDA0_cppui381),
+                            typename field_type::value_type(0x0B13644990BF926062EA764852FA193E2380DE0C0ABE1C56040073F0D27EEB0BD8DD3776E08AF451D3FC843EB2083CFD_cppui381),
+                            typename field_type::value_type(0x10027A0ED7BF2C649654E2D27983177817CE43C7BA3D526E78BD8540CF14AB3F421061F6D32079688326E46241A16CB6_cppui381),
+                            typename field_type::value_type(0x166C512B98020F7D2A0235ACB3C718D64520F0C4F54DF1C4E7C0189F00EECF0779CF834FF1671C137D3CE37B37BC65CB_cppui381),
+                            typename field_type::value_type(0x0FDCB22770ADB141E25D3C7326738ECCA6BB8675D6BAB48A723D8AEDA94180AB26DF33F1EDACCA9DF4C8883AA4C4F40C_cppui381),
+                            typename field_type::value_type(0x0884BE52ECE6856E2B326505EA4C7C861FC1EB7EA0512E4EAA55726DAD51E03D9425B6136A9FA9D06F50F4565A9C795D_cppui381),
+                            typename field_type::value_type(0x10C1C98314B5E939B74ABFD32444E1646998F512AC977501EBDFBFB31C81136EBCCB0DE76ECB42BFAE01AC7C399558A0_cppui381),
+                            typename field_type::value_type(0x05498BB0C63440BBC13D37250328D8D16FDF05C462A3BB1AC5827BDC6AE35F4CFFB653FF217C38C4C11FD83C1DC78FD2_cppui381),
+                            typename field_type::value_type(0x0AC6A18486CC80E90828B3E119DB531DD24E6469A1669C24797B3F097605DEFC17F8C32D5045D9383CAC0A43083BDEF0_cppui381),
+                            typename field_type::value_type(0x047165D19CE1F2889447A19189F155DEC664F616FFD310719F1238F6978A40D2ED9148DF81B54C5F749D51B3C148E07A_cppui381),
+                            typename field_type::value_type(0x00DB6BEC7EBA4F10D9959F99D0CCAB59752B20D469E638889ACAE570B8FF50FDE03B1BA41E13FEE9FABE510D7599D4EF_cppui381),
+                            typename field_type::value_type(0x021C0D48BE26464287A66C6DD006C13487464AC583F38ACE7E2168A762F8E841DD303D4642B5FA7E3FEBC4F686CE9587_cppui381),
+                            typename field_type::value_type(0x0C5A6350F7CD736664FCBC2397C78791905D3A97D71A821B46A18593D4E06D524E6E2966541B8CFAA95D91F4D661ACF1_cppui381),
+                            typename field_type::value_type(0x0CB0B0B755C22A38A313BF646833FD29F68D474CE7D5C88295A2BE7186681C02851C01A931E34CB94CA99BE4875812B5_cppui381),
+                            typename field_type::value_type(0x01C678E5D1F54CCB6C21E7106F7578CD397A3A15DF23E1BEE57E6A7A809E63419273DF46536F0DFC634E6611702F46B9_cppui381),
+                            typename field_type::value_type(0x0035A0602946215FF0B0CA9A971E2734AEA5B216B795FAC588B5889CE60DE01DA1849630D3C9045EE398B25A3ADC17C3_cppui381),
+                            typename field_type::value_type(0x03250D9982284F07F82F70FB6796ECE116A1889934589200F1CA9FDD6533488A44BB5C85DF802DA7A067A593AD35DEA6_cppui381),
+                            typename field_type::value_type(0x0DE8D41E367ED8F943FD739AC5CB9B6DBFEA8C3136D6B0DB72169D4B2BF8647B5CBFAB9315C7F5DBBD50FA0590813901_cppui381),
+                            typename field_type::value_type(0x0E27150ABECBC2CD5EAEB49AE3D5C3434063CBFB9E5C7E84C77F86D947B54E0B9983F4773AC79F80C324DC9F8FF83DE1_cppui381),
+                            typename field_type::value_type(0x0F517344836A35FD6F4EE8590E45F0611BD6C2E497B6339056E62414D2D2DBCB56895B51415C1EA02AEFDD608B269075_cppui381),
+                            typename field_type::value_type(0x0065485A0F5BF2EE2BF1872FFB32067DFC3AEA67161765F7A0A211FF86E59F5FF9774746984CE2E62BB97FA6D20F63FF_cppui381),
+                            typename field_type::value_type(0x15F4546B50F8E245B0C0CB563D487D04FB1702AA3254BE1497FAA3094C4CD4BEDCC94285B98F0DB472C138CFC584C832_cppui381),
+                            typename field_type::value_type(0x079E6E38D0C83D5C250076879D46F4A229BC98FE17C8135EA4415F07C5CEE3AF8073AC7FB50FC78926BC5444B767F922_cppui381),
+                            typename field_type::value_type(0x097213D0BD5D4576210832245954041B5CFFCD669AF179560CC72D48F633BBF578F6DBA136ACC6183D42666EC4DD0B69_cppui381),
+                            typename field_type::value_type(0x0B09F88C783A7752F2808845C51D650B1AE1270020400752D8AE45E47155F59F3FBAD89AB278255D3F3BFA4D9E1BAA2A_cppui381),
+                            typename field_type::value_type(0x02D689B954DD6264E68E59B838CD582CE8294732D3D2067A72A9D4700021C3BD151CC2C2C4C2D23EAF7F6A6F80CB3BDB_cppui381),
+                            typename field_type::value_type(0x142D01719875D32893E08EA540CFC3E0B592223DE6CCBBC59BAD7B2642F1EAE67F81BE69DE47629C30C405FCDFDB0107_cppui381),
+                            typename field_type::value_type(0x0378A0D23897E4E5E10CB052F55994354A8B15832376BF022567C92B8BFCEBD21D8AAFAE6306E3343AC1622AD63A2FAE_cppui381),
+                            typename field_type::value_type(0x0E631A9CBEAB67FFE37E5BDD565991DEB5DB12B43B74500DA2AAD737FD00B9C887A1B926297CED3BD02F824927871CE9_cppui381),
+                            typename field_type::value_type(0x0AB15F7DB49F2003219A7D96518793641EDA297648B4367B6DD90427E81760EB651BC6FBC1361D30F64BC05120CA7C94_cppui381),
+                            typename field_type::value_type(0x09B5966E12064FDB07B32D98E3B81CC41384A569156DA3E47E261A9FF0625FF0589DE291B197B836B174375FD22A74F6_cppui381),
+                            typename field_type::value_type(0x0AC87A22E3B7825617C2A0F9C81B449518C2BA64E472D69722BBF60F95B998876392C23F7056B300204472F3F246E543_cppui381),
+                            typename field_type::value_type(0x0C47C0E3D60404E6EF7B868AB13478F2B260DEA2498E4A667396916F1AA8DC01F0ABB13382C605E7D1B9CBB34ED3DBD4_cppui381),
+                            typename field_type::value_type(0x08C058EC0DBA9FB2BF43FE94E259120DA350B304C304939CC4D32DC8B9A1C68CDD37990E13339BC4E5C9780465658918_cppui381),
+                            typename field_type::value_type(0x0A5198323331204E4FA2B7952821E96766E66F721B2C44192674B737068CABC5B57D86B8021F1DE9B32A6F46DF07AD2D_cppui381),
+                            typename field_type::value_type(0x125462CE4823263FFFED91C8D92C425BA09045A2BB28826C05C4F56E21952872F012BD5CBD178519E0ADF6BBA35C8DC9_cppui381),
+                            typename field_type::value_type(0x0837CF9ADE0889520B6BC920A5C36112BADC2D70780A2A44B0A9EBF67D424D11A1A3F4D301236E113BBAF11AD881FFE8_cppui381),
+                            typename field_type::value_type(0x15DDE09BEDB734A7CF0983C4E68DFA07F91793B125101A727DE48931B812941FDB4036A809238343A1EAB1AA6FF0A41D_cppui381),
+                            typename field_type::value_type(0x14ACAAD328462C8058228C04E773A163F32E648291567D2EED48D71D29B06FF045347AD3671FA177A780E0E34EE3870D_cppui381),
+                            typename field_type::value_type(0x0A096C85D7D88AF3A8D571D75CCBAA6D602CB558BCF1B4D21EE92E12A03F39A6ECBE82C38F7B64F26D81F2363D9F76CF_cppui381),
+                            typename field_type::value_type(0x0A109F806E28D044625CDFBCDEEC519FAC733ED59A2C323D2BD60C2FADE2210E91C3F43B139F6FB9E1763A1952EADCBA_cppui381),
+                            typename field_type::value_type(0x03DCC22E851B132E853FCF9D6E1E57C4ADA0A3BD8C4749DB0DC12C66B249A4904141F0C29FE2A594453E348E8162C447_cppui381),
+                            typename field_type::value_type(0x041240F8DBC58C8F7FD1CB6448AC5CCC8527D1DB5497CFFA71224C78D5E19A44347D3FEA98D50FC3BEC1F6ECDD135DA7_cppui381),
+                            typename field_type::value_type(0x0A080540E11E4E13113398140BC78C1A5F690742A637351B31F02D475B8AC9F76B4F1845C58EBE7143D0C9CEFC0088BF_cppui381),
+                            typename field_type::value_type(0x08E13133A648E38783D170D27393A26CA9E829B4A964E509209CEDA202F7989846E638E3802BC436F4A9F8342C976C92_cppui381),
+                            typename field_type::value_type(0x015E2DF18FA2934A2E92A366EADBF83931745F54D0E4D17AB744932E55485FBD181403CB60005E7DFDE47D18E24A48E9_cppui381),
+                            typename field_type::value_type(0x13B937326932BF692354A09690CD8C7633F39A1BDA038829C7CE4A2FA82F0CCBD62B30F7B01AEED39EA263EA834814FD_cppui381),
+                            typename field_type::value_type(0x063F9A58378730E902C2AAC86C85E12288613E7E624B787D7DF4474581178D1EAA105F5A530438AA4F37DC16E0407678_cppui381),
+                            typename field_type::value_type(0x037215ADC607FB1BF725A00403828285845DC5C9F126FBB05645469A3C3A3ADACACA70D81541916A490447EFCAF5A5A7_cppui381),
+                            typename field_type::value_type(0x04294B3F55A87D14F96C50E7D7F78C89C3B0D4ACC834131EEC835EAB987D5C426D4E86EF1523FBB53CB160CB44F8E21F_cppui381),
+                            typename field_type::value_type(0x152F80624B248635AC0572E84958C6E3C098F93456671951C3E1002B010962176A42E2DCF21F95A850F5E7C662831339_cppui381),
+                            typename field_type::value_type(0x188B118BF6E5E707250D31DD95A2816CB0A3042B2808EEA4FA7DE80781588D287A351EF38BFADF6CFAC5C5A946DCF39A_cppui381),
+                            typename field_type::value_type(0x0A8B21A01B731E173271CE4DC551B870E776FAF7360A3134610CAEB7905E07C9D503CFEF77ECC5B46DE5C6CA37FD35EF_cppui381),
+                            typename field_type::value_type(0x0758EF790757E666F9EDE6C14519E78F4123F68A7B1CF48400FC94A9386447864A491C79717618ADBF469926A24A9E5E_cppui381),
+                            typename field_type::value_type(0x1085DC9EE2905412CAAC290C90B5207F28351F76F074B4EE4224272CA5262F9A4D8B9EA2A346D594ADF025D9CEE746F3_cppui381),
+                            typename field_type::value_type(0x0E3088535C337E19FAC62E53005C4E55D9AAD49AA9ABE31691A7BAF3FE9BA902806BDEBC0472AFFD9114A4C453755BDE_cppui381),
+                            typename field_type::value_type(0x0206A4DCE2DEAE4AA7C425AFF27D3FD6E4B7799A7592A45405D6134F3FC4CDF495435625925F091AF3ABA98D06556662_cppui381),
+                            typename field_type::value_type(0x0B372446B9A41B4EB5F225C809A30CB74508F3F202AD18ED3AE770D7E6F1F2F40FC7AE27C0F11677A8E461CF94AD1D42_cppui381),
+                            typename field_type::value_type(0x08EEBBFEA68D88D376A88F05B2A56A0B7C6B61428DE6306F5208C5302CDC44E8EC06B2ED8A0FCD1F1CB915D6F3E4601A_cppui381),
+                            typename field_type::value_type(0x035B55C5CD24875742D50237F1516CEFDFE5622E51598041590B630F3F8B54F2CA63B8EC30A0DDC8F6F0D17F474C1611_cppui381),
+                            typename field_type::value_type(0x17BA8977B8D9798C90B637D84D34F5DFDD2344DF5A9B22C33A44EDDAB1789C6D1C206A69A4E7944CD33ECFE409141ED1_cppui381),
+                            typename field_type::value_type(0x02135C0FBC2FCD68C89C2147314A25A51D642F2ABBFF61C22EC37E0158E57D0FA9391554F9B3C23B9AD59174B3D78376_cppui381),
+                            typename field_type::value_type(0x0FE9461022E2C15D67F28B529FFC0DB0FB2A664D0266DB971013E4CB9F7577B99568004E3F9B2FBD4DF5D330FC1A4D74_cppui381),
+                            typename field_type::value_type(0x0805B55540A0298F3B350EF2D7D559E344EE93BE61CFE9051AB6716CAFA4E8E804CB21ACD1E9571C84B16C96158A4762_cppui381),
+                            typename field_type::value_type(0x1666F87843C1FBE7BABEB4BBEFE48C90D3102ED3DD4F8858607CE0EC532A59B5EF4AD631F956C8FC890F1F0573FDB2E3_cppui381),
+                            typename field_type::value_type(0x00ED2DD7A2899D7CF08BAD239B272D1D7148EE3B017EF95273EB137E03E57BF59DDCCAC8BB71F5A3509BE708CC80F0E7_cppui381),
+                            typename field_type::value_type(0x0C9C6499F8DFD8C8024BD1E89DDAD29DD14F9292F57A2806EDDE015BEE47E2CAD01799FA942C2ADDFFB480791433F334_cppui381),
+                            typename field_type::value_type(0x189473A53A2AC54A8DD1A0D4270E59C379865FFE67D3FFF970DEE4CAE74E46B5EDDB7C02D612A2241F11AA82D699166B_cppui381),
+                            typename field_type::value_type(0x0B41994877EAA324D327F8F47609CADCD1441572643E04335995E81FAA05D071DBDF145D13779AD4F94813291AC0E816_cppui381),
+                            typename field_type::value_type(0x136B4C848502C4300C0F85FA50A558E9496CE993F3561456FA2E21E51663CE712804A297235F5D5019818F1F2FFDE6A3_cppui381),
+                            typename field_type::value_type(0x175BEF506D797D754684567F1B397FC966248BAFE66B8A04BC22283438DB6A1C117F54D90027394052B25EA0D30F60BA_cppui381),
+                            typename field_type::value_type(0x0642A2CA2AA15E7C5D0B6DDFF9852C407C47713A12C89FE2B48028B373F79D06D1D5E14D372176426F9B89046B0F8221_cppui381),
+                            typename field_type::value_type(0x0BA7260D4C019A8F536BECE2C62391F5D2C40012B47664E692C83CB1D3B9FB184C8F10F2591B7BCAF81783765044BDBC_cppui381),
+                            typename field_type::value_type(0x141A11CF683AC73910BB924D41613FD0A71E726A928A459219C620829838F58522EA629D45F84C9171E6590568787EE3_cppui381),
+                            typename field_type::value_type(0x058E2DEB940F9B80C26B9C179173BC856E940F4F6589D75F7B576B0150E0D7B78CAB3998EAD56EAF90DD7319F7F77CD5_cppui381),
+                            typename field_type::value_type(0x193A0B0A388F7112CCC9D109087F550FF7D1619C72F429E2541BDCDDEABBA65869BF8341CFF09165FEC34224A311896E_cppui381),
+                            typename field_type::value_type(0x061397F18BF6B772162D5308499C143EB1A1FE73066D6B46D9ECCA73CBEA12C8B42B704952486E6D893261281DD5ECD9_cppui381),
+                            typename field_type::value_type(0x1216AAAB2DBEB84EACB042852C143CF786A297B298C846F95C3D7AE3414A2CED1A1430496AD51F03776B5D1312443B71_cppui381),
+                            typename field_type::value_type(0x001D2C4A7F9744520FC3A936158FE73F0E867CAD9A4123652C789F6810BA0D5E48946012A5830056741E5DA93589FFA7_cppui381),
+                            typename field_type::value_type(0x11208EB26D4DFB8DB27246F2FFB2EECA3B3B6F88709D563E682AFB9ACF22D30788272FB61F7FC8CD01BB67B351488E8B_cppui381),
+                            typename field_type::value_type(0x048CB5F6AB092365B0813CD1F3CA0AD64BCF02D38FBF15473468744A69700DC3FC9F0067B62FA6850F1BE1CAEB72ECD1_cppui381),
+                            typename field_type::value_type(0x19A5903CCB6073E7A2112749BDE36422159C23AA627C794B93B03A51D8BE26AD040480B48E4E6BBE5D35B90ABC991F2D_cppui381),
+                            typename field_type::value_type(0x091192EA0EB8EB99BD88C0C64CF4A7DD1572B7116B4EFA89E51A0D2611EDF9132A340163B6C0484C07637CDA38B58904_cppui381),
+                            typename field_type::value_type(0x0FE0A3D29BC18590447FFF052B5CC1D9843E40B8AAD64CD5447F51AF2D1902194D767D14E4DC9DAF0CF6087ACEA76B95_cppui381),
+                            typename field_type::value_type(0x162B802447CE97B2E65FA44DA0756A4617FF7041F7670C14562BE88C59686C728BEFE37D8A33826643200696742E5A08_cppui381),
+                            typename field_type::value_type(0x0FD3D6BA04DC4E2398F5623D0C71D1A5D07E7342F16CF12208BAD42D1C998BA5DDEEFA857490B12D91937E8940E7E5BD_cppui381),
+                            typename field_type::value_type(0x0361394A581A6EB1E12F60385A275359AD8F194B5D3A0487FBEB6A58C643BF7FE5C1F1A5E3B1896F3679D50FB4C787F8_cppui381),
+                            typename field_type::value_type(0x01FC56C400756E2F053EA015D7A61606F668A10F5EE0808F86DF9443778021B802174B1D9CDB0CDE3C3A4FE5803D02B5_cppui381),
+                            typename field_type::value_type(0x0D3E97B3AFEBA35CAA9F3113C1FB2FE538548524325A29FA46ACA54EB48A19A120BC14BAAE5756DFAE10AE4D12901A1B_cppui381),
+                            typename field_type::value_type(0x14D1B65F578D88762686BE66526FB646C6633F3B0F94CF242B6F99EC1F4BD27DFBC8966865EC548642994F552F4CCF1F_cppui381),
+                            typename field_type::value_type(0x16D3F522E31237DD870362EA7F330EE062AC58AECDB8B45385D540B9833FBDFA5C0EDB11472BB52926036D59FF82DBFB_cppui381),
+                            typename field_type::value_type(0x0E8E746C281E151F60E2242AC348AE2A8618BCB79E93F8599083626251F21395D52034CE863B4F4A563AF55B7802CF3D_cppui381),
+                            typename field_type::value_type(0x0F44D694E97B97E0C48303E5CD4A2D697F83D34FED20242B96A542670894FE7ACAB59F8982FF4BFA42C46CC1817CB181_cppui381),
+                            typename field_type::value_type(0x12A966944C688559CFE3F28ACA9AA626B442DC4BB507670A1AB02795D397EF6AA1C1F57DBC5B0B1E9DD733D3C2B8623B_cppui381),
+                            typename field_type::value_type(0x0FFDF0514A35D0B995F748E153BF6CB91187117D11442ED6FA99EDBAF9009C1108DACD3BFC23823251C6EAE3BB2AE6B7_cppui381),
+                            typename field_type::value_type(0x0AF86A598D2D39412C1C35E458938DC965DE475FE6CA5872C5533425D7602DA45CA17C0E9EA6E74A00C50AE99FFF1921_cppui381),
+                            typename field_type::value_type(0x022D950AC05EFF395E7879EAF4C878A9685D485324C6593C2D98BE9619CA894DCB2D0CF8373A1B5C1858697BD079B8C0_cppui381),
+                            typename field_type::value_type(0x0CDE8C12693642604B23D14F8D300BCA62783D054BD6E856037155046F57F7753FF9129BED5A85471DE55011756F5381_cppui381),
+                            typename field_type::value_type(0x0433063F11E94BF1737A1AD62FEBADA2BB5F03A4CDE8EAECCC708F183F0975642079501651AB0611103B6DA8A452EDDA_cppui381),
+                            typename field_type::value_type(0x10A085450A88E359B47DAA6FDD49DAA7607D6315863DB1B68FB6A7083DE7D34753621C6BA949258E3AFE492D054C91F5_cppui381),
+                            typename field_type::value_type(0x1571501A02A56320BEFBDAC761D0B94691B31D7A91D8BDB9E7116171AD0F5103B85CE3FB96674553A3C2B46928A7FDED_cppui381),
+                            typename field_type::value_type(0x16F73D53F6A4F1239713E45716F347DBA9566937430C21B849F5E1FA028E5D0BAD2BD7B65719356ECE764DAD57FDABE4_cppui381),
+                            typename field_type::value_type(0x0329203C86C50FF1E64665BBF1BDBF53A57EDA95E64C583285302FFBD2AC79D4805051596E595E22EE32939913E3C0B0_cppui381),
+                            typename field_type::value_type(0x10C832C51489AB7D2C23316C824CB2F7E137084613425BEDBC24C1BE5942EC67B7B1235CCF80C5993F2117BD4E54099E_cppui381),
+                            typename field_type::value_type(0x18F786121DAF887F4B186D42EA182BCB5550AFA40B4D62947330C5D98AA34ABB182854B60AB73874D5F98F3B6F877D62_cppui381),
+                            typename field_type::value_type(0x1160A90BB86D156603AF7483095FAF814DBB737B1935E9445A9AD4356FB454867991B350465B7FAA69FD63D2684CD2F6_cppui381),
+                            typename field_type::value_type(0x069C5A0442223C6D03B1BCABE9C81CC78576C7D12524344A8CC2EC53333B746D7A56A32D0507D7E802642E8F72D14C0E_cppui381),
+                            typename field_type::value_type(0x0D50731719751371BC3633A018927CD6A6DB4F241E2D6F221FF88C76190D898753AEBABEA138C3270BBD48B68AE2B09A_cppui381),
+                            typename field_type::value_type(0x0D1D1789401A7E22AC3CCF5B022427F83AB4E476B778D50AF74F28B2EF54D7536CC1D698F9B069968755DC0DF657E156_cppui381),
+                            typename field_type::value_type(0x076072F7A9319CD7DCA9F2D4DCB26A17ACB8A245EACF79E0C783938AFB7689D64744E713946E0505A3031F047CF133FC_cppui381),
+                            typename field_type::value_type(0x05BDDEAF335001BE3925DD07A0DF2B5D630F970B667766B1A4BDA9C56210338677A953968431EDA9D04BFF55B8BE038F_cppui381),
+                            typename field_type::value_type(0x0FCF8188467D6CE593194EFDA94A047EF8B40FA708C59D3DD00F1A4704FF685BE0314BC1046CCEDEB9D5AF02842E195A_cppui381),
+                            typename field_type::value_type(0x118606D3EB282C871CDE174DA9459E64106E884988FDEBBFD4CDC77DB87E7F5E184C388E83F026DEDAAA94E07B92EE8F_cppui381),
+                            typename field_type::value_type(0x00EFFBE2DD2EF4A2B4E89068612EC57B4EBD9E07865C2066BA735320B4012DFA971E4DCCF85E194E2AA2E4C17E03DE7A_cppui381),
+                            typename field_type::value_type(0x172F0E09FA6EF1850B765A75599E1DB3260485522FE0A15796716D58CE8F7DED726DC40B371DF5A01B43F5ACC3D1EFD6_cppui381),
+                            typename field_type::value_type(0x093ED3B695713BC608B102494A5BCCD40191B059F8244021FCD63039613D80BCEC7948E624FFFF725DEF11F7E643E8F5_cppui381),
+                            typename field_type::value_type(0x04F6E2D1BE162248B624EEBAC7C766B0847EE56F6BCFBF2324193DABE1C82516231F8FBA62593A079B31F4F1F5633ABF_cppui381),
+                            typename field_type::value_type(0x01B89C058519BB1CBB500CD1D4C8DC20706A7475F1B89E838CD5E27C4D1160A377D60FD310B8944AA3880504DFB2C9ED_cppui381),
+                            typename field_type::value_type(0x142DC4DCD21CB8CE9E779802C14C6E5EF62C454288526AA2FEBB5A1992719C08069A5E353AED217B7D3F1894B08F5D2E_cppui381),
+                            typename field_type::value_type(0x0587D03D614EC37130F856DB786CF02BC9656742FA909CB0F10B7889FCD77658ED8DC7670BA2268AE42A726916F4B1ED_cppui381),
+                            typename field_type::value_type(0x08C207EAD02D50099008C9B1CF9D6E12CBD8617F82DF9EC7A29C8BD91D0418E2F80C39E3CD513EBCF058EA0FCFCC8EC6_cppui381),
+                            typename field_type::value_type(0x081A55CB07DA1F409D2C0AB00352209201D5EDE7F6186C2DD68D77C3398654036CD7A1BCBB5355A8FB524F8CE014BA04_cppui381),
+                            typename field_type::value_type(0x0D13ADE395A61B90834373B2E002628F15D3C91F9C29079D0A8302199B97E213ABF42E807F21CDF221F8862F67C6D3FC_cppui381),
+                            typename field_type::value_type(0x089EE6C1D4509FEE3F8B0EB545A0EB4E1C3F4C2F8E921A88367C634936B873DC99F091FF79BCF50795B2F44597964212_cppui381),
+                            typename field_type::value_type(0x0822B3F5691E0CF901441AD1645427AA41DBCB1A533EFDF99ADE7C0B3F406687710775A05D353FB7B8E9E3624E4F037E_cppui381),
+                            typename field_type::value_type(0x136792D748B6019F93CD5D032A1AD53E8DAD1662EC1FD2FC59C3480D9BE99CB8AC37914ADC9EE600D4718AB9EEA8D333_cppui381),
+                            typename field_type::value_type(0x08BF199D9F4CEFB8EADE555CB90CF9BE7F46FB77D539F503E6DFAF8CCF7ECD49808552BC5C9E05632FE4F9945E950386_cppui381),
+                            typename field_type::value_type(0x15D9CDDE01EBB2FBAEE19227CF70A8200CA1A100B8CA9548D2BBB7F9707B6101F5A3A04FBBA2E08B20CBE23597DD79BF_cppui381),
+                            typename field_type::value_type(0x163F518738A33514D137D51BEB472A59C1EBF8B787AFCED4F03C45F4BA1FA83C47F4135934BD93A155A82D704FED303B_cppui381),
+                            typename field_type::value_type(0x10C911594199E22BE7B320D25168E878AB8BE70FA352D3D8E6F06DE2447CE08765338BD9E946DE6DC993EC07E9FD37CB_cppui381),
+                            typename field_type::value_type(0x0B8C0F1A74E7363E44637C0E3C2B72817E72C099038825DD3E3AFD059DB3086E9559AF308AF414505E3FF4E32B5565B9_cppui381),
+                            typename field_type::value_type(0x0AF608396C373F4AFFC6B63048D296D93EFBE6807B71217BA37F40EE34E021445D91DFEC906B7C9372C3B6AFCFB190FE_cppui381),
+                            typename field_type::value_type(0x0D58DF3231DF089B317765C71E2708E188E16E4D5FBA85AA1CE17D8BC7566D1D2385434DF0633E442C43CFBAD98CF5A8_cppui381),
+                            typename field_type::value_type(0x09DE453F5A6CEB2E36C69618157DCAA816A9722230E9DB39F0F61DFBF9275689470D3EF67246BFA048B81CF2728784BA_cppui381),
+                            typename field_type::value_type(0x0BA78CCD525DF73A1EAEE88732507D2BF27396E4AF8239A74ECCBB8183F5F183E777A8E21B414E9063684F3164FAF3DC_cppui381)};
+                };
+
+                constexpr std::size_t const generator_table_params<detail::bls12_g1_params<381, forms::short_weierstrass>>::window;
+                constexpr std::size_t const generator_table_params<detail::bls12_g1_params<381, forms::short_weierstrass>>::windows_count;
+                constexpr std::array<
+                    typename generator_table_params<detail::bls12_g1_params<381, forms::short_weierstrass>>::field_type::value_type,
+                    2 * generator_table_params<detail::bls12_g1_params<381, forms::short_weierstrass>>::windows_count *
+                        (std::size_t(1) << (generator_table_params<detail::bls12_g1_params<381, forms::short_weierstrass>>::window - 1))> const
+                    generator_table_params<detail::bls12_g1_params<381, forms::short_weierstrass>>::table;
+
+            }    // namespace curves
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_BLS12_GENERATOR_TABLE_PARAMS_HPP
@@ -0,0 +1,1118 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_ED25519_GENERATOR_TABLE_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_ED25519_GENERATOR_TABLE_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/params.hpp>
+
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+
+                template<typename ParamsType>
+                struct generator_table_params;
+
+                /************************* ED25519 ***********************************/
+
+                /**
+                 * Affine multiples (j + 1) * 2^(window * i) * G of the generator for j < 2^(window - 1),
+                 * i < windows_count, as consecutive x, y pairs. Generated by
+                 * "python3 scripts/generator_tables.py include/nil/crypto3/algebra/curves/params/generator",
+                 * do not edit.
+                 */
+                template<>
+                struct generator_table_params<detail::curve25519_g1_params<forms::twisted_edwards>> {
+
+                    using field_type = typename detail::curve25519_g1_params<forms::twisted_edwards>::field_type;
+
+                    constexpr static const std::size_t window = 4;
+                    constexpr static const std::size_t windows_count = 65;
+
+                    constexpr static const std::array<typename field_type::value_type,
+                                                      2 * windows_count * (std::size_t(1) << (window - 1))>
+                        table = {
+                            typename field_type::value_type(0x216936D3CD6E53FEC0A4E231FDD6DC5C692CC7609525A7B2C9562D608F25D51A_cppui255),
+                            typename field_type::value_type(0x6666666666666666666666666666666666666666666666666666666666666658_cppui255),
+                            typename field_type::value_type(0x36AB384C9F5A046C3D043B7D1833E7AC080D8E4515D7A45F83C5A14E2843CE0E_cppui255),
+                            typename field_type::value_type(0x2260CDF3092329C21DA25EE8C9A21F5697390F51643851560E5F46AE6AF8A3C9_cppui255),
+                            typename field_type::value_type(0x67AE9C4A22928F491FF4AE743EDAC83A6343981981624886AC62485FD3F8E25C_cppui255),
+                            typename field_type::value_type(0x1267B1D177EE69ABA126A18E60269EF79F16EC176724030402C3684878F5B4D4_cppui255),
+                            typename field_type::value_type(0x203DA8DB56CFF1468325D4B87A3520F91A739EC193CE1547493AA657C4C9F870_cppui255),
+                            typename field_type::value_type(0x47D0E827CB1595E1470EB88580D5716C4CF22832EA2F0FF0DF38AB61CA32112F_cppui255),
+                            typename field_type::value_type(0x49FDA73EADE3587BFCEF7CF7D12DA5DE5C2819F93E1BE1A591409CC0322EF233_cppui255),
+                            typename field_type::value_type(0x5F4825B298FEAE6FE02C6E148992466631282ECA89430B5D10D21F83D676C8ED_cppui255),
+                            typename field_type::value_type(0x4C9797BA7A45601C62AEACC0DD0A29BEA1E599826C7B4427783A741A7DCBF23D_cppui255),
+                            typename field_type::value_type(0x054DE3FC2886D8A11DB709A7FD4F7D77F9417C06944D6B60C1D27AD0F9497EF4_cppui255),
+                            typename field_type::value_type(0x14568685FCF4BD4EE9E3EE194B1D810783E809F3BBF1CE955855981AF50E4107_cppui255),
+                            typename field_type::value_type(0x31C563E32B47D52F87CE6468DD36AD41F0882B46F7ABF23D12C4C4B59F4062B8_cppui255),
+                            typename field_type::value_type(0x6742E15F97D771B642862D5CF84ECF93EB3AC67B80698B993B87FDBC08A584C8_cppui255),
+                            typename field_type::value_type(0x21D30600C9E573796EAD6F09668AF38F81783CFC621EE4931E2F5BA9FC37B9B4_cppui255),
+                            typename field_type::value_type(0x23A4860627E53AEEB8E22B1508249C9109578D33E7BF237459B2596D6C28F9F8_cppui255),
+                            typename field_type::value_type(0x709696F2827FC3729F980F2E3AAD6E78B06A11FF8E079C27D87AAB37C16727EB_cppui255),
+                            typename field_type::value_type(0x39CF6C6917421AF98582561D0B39567DE6033190F97852FC4FDD40F6977E4F26_cppui255),
+                            typename field_type::value_type(0x4434A90EE12CCE6B7ADE93ECC0F88B78B41205E74C8C4038F92D394F3A06D269_cppui255),
+                            typename field_type::value_type(0x4D6204A526DEC7D09F148A93137704532E8A41AE27BD0F58CF2D0F6F7BA4D779_cppui255),
+                            typename field_type::value_type(0x654330726D32AAA4A89784E2141FD21A8BE67387882B44A38745EA7BA206DF11_cppui255),
+                            typename field_type::value_type(0x05FA64200BF829139CF290F9871D79A8B8E846FD6AD9D678F1517A0FB03CA40B_cppui255),
+                            typename field_type::value_type(0x3D199EEAF926002872F486796FA8AA4C99F1125E6E0D196AFBD695AF17DA0926_cppui255),
+                            typename field_type::value_type(0x78B43CC5BC020E13514EDD21E5A56E1A1912C615029152A13CDFE8D7F6425311_cppui255),
+                            typename field_type::value_type(0x75358A782E64B36E2F8762960F215646A01FBC926F27D6AC7E188D0CD2FB4DB9_cppui255),
+                            typename field_type::value_type(0x003B5C6A2E0D4CB9CBDD2DA21EBF38F0159C0B57FDB7E632CCF56D4FC15B1416_cppui255),
+                            typename field_type::value_type(0x1BD9006846ACB57C1348639768D984736AEDBDDAE41BC81393449FBAFC243D1E_cppui255),
+                            typename field_type::value_type(0x384BD69CA7D69CB9DC7DAB338F67D336867B24F2D91ECFA3D7E3380B3E48F8EA_cppui255),
+                            typename field_type::value_type(0x121351D79352D734A46A16B1B8BCAACABEBA9C9FF30A0841703124B6DEC0A6E5_cppui255),
+                            typename field_type::value_type(0x379DBEB1A97B5F082402EABF1AD28BB78A837AA426237A405DA2495BF0CFDD87_cppui255),
+                            typename field_type::value_type(0x28EB9FE001CE99D063F7995348559BFC233261C134094521FDA0E7EE084B86FC_cppui255),
+                            typename field_type::value_type(0x5E7E07ED4E1DECBFE6E9CBC126905449D4B578FBB561576D20B8BCDD0CC2A556_cppui255),
+                            typename field_type::value_type(0x0F55755C51F102796BF5EBAA81D3260E7D1B3D9AC127D9A80E142031566CF6C7_cppui255),
+                            typename field_type::value_type(0x2EECBF81B3D084733331F9EEFA70D42621EFFD9B303961D25409333C82CD340A_cppui255),
+                            typename field_type::value_type(0x54D2DC2DA137827C4132D9B740A119B6484D4D4849E6E074B89CF764008B93E8_cppui255),
+                            typename field_type::value_type(0x70B225147463BE28A5AA7B1879CD8DBE57EADD2AA53D51B94566CEF314CC93BB_cppui255),
+                            typename field_type::value_type(0x244980DED32FF401C2606727F94D609A147934004DD9160A5B9E7392B18D9C02_cppui255),
+                            typename field_type::value_type(0x6B113A52F9F3FD0590AC7CB6C8CBB37ABCF147C44B2AE11D9151C7D55B4A2B68_cppui255),
+                            typename field_type::value_type(0x1AEB017159697E792EB8DA1805519C06296595F4F57996C590954359F327C13D_cppui255),
+                            typename field_type::value_type(0x661B75757ABBC179AD6A11DD399040591E057EE83FE6428719C2FDE6E9A95BD2_cppui255),
+                            typename field_type::value_type(0x05DA1AE1B5D4BB12F0CE022F4F807C07D10C9557D6DB12AE497D97E42A7B09BE_cppui255),
+                            typename field_type::value_type(0x603BA4ADC34A9FEB3B4B4DE22065BD3E2CAFD6AAC31420342FEA3C8AB6490615_cppui255),
+                            typename field_type::value_type(0x1FDBAF2C3482CCD90FACD46AE046C50CBC48BE06D2F37A9A812A2A95C0E658BC_cppui255),
+                            typename field_type::value_type(0x3D718E644BF2D3A45D1E15AF3AF9E330EBD6A85BD12C1693369D40310B391D99_cppui255),
+                            typename field_type::value_type(0x320D055DBBA3F4142F2288113A22A8925F902AC77F1F7280A88E3BF5A23600F9_cppui255),
+                            typename field_type::value_type(0x3C1AE7527612D38BB541F511FCC6283D8482AFE93115B345ECD2BCFBBD1317F7_cppui255),
+                            typename field_type::value_type(0x051C91C3F9D7E57EB786116C8545F90FA67F5E8B62C32AC4512015A20711364E_cppui255),
+                            typename field_type::value_type(0x7D13C0248B891B47EB524F2692008E2F97B199BAC426CB5902B9003A29DED6EA_cppui255),
+                            typename field_type::value_type(0x59A976AB2C01A81A91F1A56C75CCC77A9E1E9E878E9FE9C3952080A6805B20D5_cppui255),
+                            typename field_type::value_type(0x17D5A9FF7F338D8EE53C26531F9A5D4AD2718234B5D46A1435AA161031B1C9DE_cppui255),
+                            typename field_type::value_type(0x73022287D3B73F6C43C3F9071CF0A87AAC83DABD44EFAD1DE010D564A4F6AF89_cppui255),
+                            typename field_type::value_type(0x086F2F768EEC289D7B7D2F8CBDBF7B56EDE3EC13EE42D08769EC712F13491D64_cppui255),
+                            typename field_type::value_type(0x72945A90338F3CA0EC52EEA501CAE2D6915BEBF0893603574EFCEF154D5FF522_cppui255),
+                            typename field_type::value_type(0x07A8BC68BF5F3ED3BED79C11BF2D6B20CB84442DFE4AE185B0C2DABC38E74B8A_cppui255),
+                            typename field_type::value_type(0x7249D7C47AFD427018B32D20A2A81307BDDC3E039574C80329AA786A22288901_cppui255),
+                            typename field_type::value_type(0x4026046D777A6C850919C5BAED487322C0BF25654E448CE23F9D7EB877D92BC3_cppui255),
+                            typename field_type::value_type(0x59C711B1D9136C1B747AD31ABA2CA8CD510F84B34109984FDA6A253C1EDA97C1_cppui255),
+                            typename field_type::value_type(0x34F4C8C35F88733DF177ED7CE5464AF3B8EC996AE115A57FEE2B9EFB16D2C34D_cppui255),
+                            typename field_type::value_type(0x677B89CD3D6F143C138864ECC92952B0C95BA4DB171ADA60E8A3AE0F9E07BD96_cppui255),
+                            typename field_type::value_type(0x43AEE427724E5652957C7F03388B160B9022280BCACAA197F713AD74CCFEF7F9_cppui255),
+                            typename field_type::value_type(0x4356A646EBA89FB7B3E71A1A74E139607098BFED183F60EA94CB7244F18D16BC_cppui255),
+                            typename field_type::value_type(0x5B4FD9F4A9A79B1F34A4C426C1A467D36560338B1A5457E83254935C2B32FF02_cppui255),
+                            typename field_type::value_type(0x40EBD1230468FBF85A49AA47278EC1375A3CF9C2ECC5BBDF685B265433B08D46_cppui255),
+                            typename field_type::value_type(0x5DE7FAA2EE4E70132F541F79CA07CD54A39FE1347A6844D19E9D678A8411A565_cppui255),
+                            typename field_type::value_type(0x2C9F23641E1C2E0AAB8EA9926B432D92C0E8BC08901D6FF6DF85E4CEF854EC36_cppui255),
+                            typename field_type::value_type(0x74E337A01C13B537323663602811D1D532D8747E81489415271411B172D04F27_cppui255),
+                            typename field_type::value_type(0x08648F02B3A4DAF96ECFFABDBAF3599FB2EE85DAE253B2C21CE66796114E25F1_cppui255),
+                            typename field_type::value_type(0x73CE78C748A872F2A197A7A16FFFC81C8814E07E49379EEB4DD94E4390D7C290_cppui255),
+                            typename field_type::value_type(0x33C172E606062EC6FE3963CBF960E070CEAE653D3FBBA994947DE13A0A0CB2CA_cppui255),
+                            typename field_type::value_type(0x6A6FBD51EFA6A855E82CB0142325BA473FD7554ABA208A400737475464F29434_cppui255),
+                            typename field_type::value_type(0x16F5F8529F55FC2B7CF811161D7870ADE1D1617E52C3C4F579EA06B27616D671_cppui255),
+                            typename field_type::value_type(0x455D905F52D04B5FF74BEEBB11D774B2C5764A4DFACC3BCA3445532A8F320CA8_cppui255),
+                            typename field_type::value_type(0x033DBF271D5FC72B69BC227BB0C7913B1EEF9BACA6C02854657460470FE6A8B5_cppui255),
+                            typename field_type::value_type(0x584E7F2A5E3671737F705F1A906DAB675706549E0491E9AAF264643DCA20439A_cppui255),
+                            typename field_type::value_type(0x2E5327982A30DFE81232F3DBC0E9B8843347320EC0F65D9622F8FE4E547C1381_cppui255),
+                            typename field_type::value_type(0x7783D619F52F8BD4E0C839D8C7E2085D11CE2FED6ABDA9A6666E57C725DE8FCE_cppui255),
+                            typename field_type::value_type(0x7B87C33701D609FE8342123D99E9EBFD4453AC1A100D8238B005CFC4600C5C4D_cppui255),
+                            typename field_type::value_type(0x243EB188DE73A5549B32C39D2EF1B29623709A9EAD4C0E240314E0C5F69A9634_cppui255),
+                            typename field_type::value_type(0x3779298951F452D801EB7A0B7EB224CCA2DBEF041081CFA582AFB25B1F4CE2F6_cppui255),
+                            typename field_type::value_type(0x06B349EEBFED4DAD4A805B63A6ED2231A565CDA752D9477FF427DD9A8C9AB5ED_cppui255),
+                            typename field_type::value_type(0x07A09289FF3E1F9AAB68AA374C48DF65F550C2323607B97744DEE990608B64F8_cppui255),
+                            typename field_type::value_type(0x482A4CDF57D9EADAAB1C92B8EDD4D15F66A39C16B2EBAAF9EC314AC0199C4F7D_cppui255),
+                            typename field_type::value_type(0x7391DE4381C2F7A80B3C5FC6145192983F115FA525E4FD6ABD513B116E4EB04B_cppui255),
+                            typename field_type::value_type(0x3010B9CF5773822513850E1BF10181DA70E1A9B124E80BEA80AE65BF751E85A7_cppui255),
+                            typename field_type::value_type(0x20B530D1F5061DB77A697677472A344668F34B3BD113BFA4BA17CC63E268DA41_cppui255),
+                            typename field_type::value_type(0x3BAD86DEFE0D244DCC4B246C137DCC68BF6B733D1FFF688F33431F2A339F8F3C_cppui255),
+                            typename field_type::value_type(0x2DE3CDF2FA86BA8C2B899F9FC04B8D5384145C3F68EA9B6EE05373DC01815179_cppui255),
+                            typename field_type::value_type(0x5C08C8A6BCE542E148F24F20DD227EA2CAA34A438392D153C59AD2CCC866B208_cppui255),
+                            typename field_type::value_type(0x5A2179B1E69C866BD91D686942AF57BF43766F5D9BC399C4A99D20C62BDC8C2B_cppui255),
+                            typename field_type::value_type(0x287CE53C7DCF4E8997B095A0AD9163360E4AB79D606BCCAB52843DDB5A29F906_cppui255),
+                            typename field_type::value_type(0x2DE90989B74E58B52B0046CDF8C227BF6D89CA9D7E449ADFCACCBDC6FD98692E_cppui255),
+                            typename field_type::value_type(0x67833164294B32A9CECEC520B4E9B3FDA0DAA1D11005634A65973A8D2B1EBF8C_cppui255),
+                            typename field_type::value_type(0x6215FB622515FA2E8AF4F29161BBA964A3B2C3D9313CA0DDBA356EB7EB9E72EA_cppui255),
+                            typename field_type::value_type(0x45AFC85DC571ED1BD5E8115A9622D44627CF19FC4A8626E7B754B005CB75BE54_cppui255),
+                            typename field_type::value_type(0x6C0C8ABFA60BFC771E39A18F57B8142F7ADBCF220B81EE2339809E4957777B40_cppui255),
+                            typename field_type::value_type(0x0AF367956AF630266B1CC760154256ED79DA960DDDCA9D72A1E8CF27D8D43A77_cppui255),
+                            typename field_type::value_type(0x21108D900134D3B3708DD28ACE96B0B23DDA9100E4B6A62A8131BD2F2BA408C5_cppui255),
+                            typename field_type::value_type(0x2B760154FC5CEB5A64141345F55B1B57E5B0B1D6C5A07DEA8DDF074FBAE70D33_cppui255),
+                            typename field_type::value_type(0x7DC81AF96FED42E0373411203FA2CED7629FB2EB6A2054E24AFE3696AFC20C02_cppui255),
+                            typename field_type::value_type(0x4535C89311D604F3AAA0E4D88D9D7B514F3D23C8F1D3DCCAC1423F36E811B9D8_cppui255),
+                            typename field_type::value_type(0x69DD3661BA84B8E1AAA20A3D90806AC9372D33D5840F6C977AA7BF9008D63661_cppui255),
+                            typename field_type::value_type(0x67DBC33418BBCD3878489398639484B6D6FA42F875B8C5AF23BC92C69C5BDB6B_cppui255),
+                            typename field_type::value_type(0x38436FDF8589A33059FC92E7CA7AA2250CC9EA48391B1E517C6FB056093AF396_cppui255),
+                            typename field_type::value_type(0x69F0B68125B9AB0C6EBCF63389C5CFD7621379497A1BD8BDA3AA49B3EBDD1011_cppui255),
+                            typename field_type::value_type(0x0D2A89A19C28174690ECCAC4FBE32DFE444E1AD763C55233D46B7A47DC3669D6_cppui255),
+                            typename field_type::value_type(0x34D9729A3945D42CD08C6CD2C09F8F53DFCA8D55031FEA67189D5FFA5112F8EB_cppui255),
+                            typename field_type::value_type(0x65EFEF05BD03D24EB46154EE50E168707C01553364E760370DB3CF404C6279B1_cppui255),
+                            typename field_type::value_type(0x271B64006D3D0282832762A869C867F449F0888797E6108A58E30403C96F4E4C_cppui255),
+                            typename field_type::value_type(0x6E0746310B9C01C2FC648F1039D803B053EF2E7903EDECAB328045DF50BDD7D9_cppui255),
+                            typename field_type::value_type(0x29EA44A50A4B47B8B3DFFA01DC5F2271D5439BA8A82A6EC0C454E9BD19448479_cppui255),
+                            typename field_type::value_type(0x6C775AC8AB2EDA8CBBDB4BD1196AB24630AC6C1F97389DE19E9D5F63AF509005_cppui255),
+                            typename field_type::value_type(0x1E45A60140A3B2DEE9B8DC6FF307154A1B410BCD38E0E38FB10B2F6DA1AFBE2B_cppui255),
+                            typename field_type::value_type(0x0E730DA473DFFD60D2F3241A85E68ACB47D26E5043AD047D893F072C8DDA0A76_cppui255),
+                            typename field_type::value_type(0x61708161CB4660FF22C3C1EAAFB1414244579864B07E73FB9BCD90AABEC9935D_cppui255),
+                            typename field_type::value_type(0x38D6936D12E8157C0621BD2D8FDF95A1F84987EE724E0C98F5C4CD21FEB9820D_cppui255),
+                            typename field_type::value_type(0x1DD4F67CA8332CBA428EE98C75AD78121582B23B1CE267CAD8F84EE3D2A0A1CF_cppui255),
+                            typename field_type::value_type(0x54551DCA553D2D3BA1FA3F3710560DFA9043A0324C2EA3E6A0F4C5131BD34CF1_cppui255),
+                            typename field_type::value_type(0x48F451397792915909604C632C838021641749A67FB8E91301427DEFD951F791_cppui255),
+                            typename field_type::value_type(0x315385D3BD5A22B69068DE89E52A3126525BE7DA886D693E99FF2F088322D560_cppui255),
+                            typename field_type::value_type(0x70E7D5A62D4E8466B89B4F1FA767C6D8BF15573328028FB35F088ED3387D5650_cppui255),
+                            typename field_type::value_type(0x0A2A397784BFD78604F821C33A1678A2463D80A10B111C1FE81706DD036D3D67_cppui255),
+                            typename field_type::value_type(0x048040D8DC65AECCF8523EAC0EE614A4BADF28301F56D8C9877513F842FCCE62_cppui255),
+                            typename field_type::value_type(0x33FB866F754319009ECD13C7F6CC276CAEE18C7724FF992C1F002826BA79535F_cppui255),
+                            typename field_type::value_type(0x6E9BB2B90BC98C486743BAF914DE6CFB302383806A7C5CA3088F0F9FC17F2E7C_cppui255),
+                            typename field_type::value_type(0x51D3DAF8B8B95542C80A11040370E133D502D3612A6F3DCF371E2EA053103AAE_cppui255),
+                            typename field_type::value_type(0x7956A04DF862178EE4C705FFBD30F9DCBCCDFC7ABE362F2C1DA24B3CF9DCCED8_cppui255),
+                            typename field_type::value_type(0x5EEAC17F2E772F551E761978B395B6DDEA37A16AA33CFF34A30A8453BAF6E782_cppui255),
+                            typename field_type::value_type(0x4D1E116D136158C5DDABD4276832800F2C081C1072DE6F2D931797A46ABC0CBB_cppui255),
+                            typename field_type::value_type(0x6D415BE49D4E35B65CC51354B5008F8C43E84B7B5E8A4B84F44E1EFB10C9B91A_cppui255),
+                            typename field_type::value_type(0x4B5BAE5A77A867DDBEE3944524F8E2EC8C2A6172C14BD432CD42148248127D15_cppui255),
+                            typename field_type::value_type(0x739476E0B38471219875A4580E6742ECB6AECBA57B8C0FA0D923B8DE209A77CB_cppui255),
+                            typename field_type::value_type(0x28E01E9EEBE624F050385A759882D4F1AE61AB87C739BA5F1F167E5A18ECC8F9_cppui255),
+                            typename field_type::value_type(0x34A3EF208089429B6293A7C1AB71048DD3A1B4F69B645E2A7B7682A0A58A68C1_cppui255),
+                            typename field_type::value_type(0x33BFA90CC1B9DF13E106FFCF6CA898D06B22D51DF337243BF85B3F232869FCDF_cppui255),
+                            typename field_type::value_type(0x53B120DB6327CAE59FA5FFF109017D2DF4ACEF01D2F10981439D824FB2DA81D9_cppui255),
+                            typename field_type::value_type(0x6759A4F961D6AC87116FF682CCA6BB2AF36CE2BBDA2202C694F70B4A1110CC99_cppui255),
+                            typename field_type::value_type(0x7E6C7C2DCA5F44C7B2591211600036D4B1011A2605BE16633CA43F61ECF8AF35_cppui255),
+                            typename field_type::value_type(0x56BEC703109151E787690E04944CE775EA94874DC7AA8115F0D434A9ADE80267_cppui255),
+                            typename field_type::value_type(0x6AB2DDD0750778CCDCA656B4F3710C05CE7E47706CFAC82B512E6B33EC86FB32_cppui255),
+                            typename field_type::value_type(0x4BBEFBDC2C60867DADF3A817A029C56305DAE0A7B5EB28D0420BD6530A7C82BC_cppui255),
+                            typename field_type::value_type(0x6EB85CC89C0C2DC979D1CE5DCC3E74F7AC3547E10708A095040E3F6849538107_cppui255),
+                            typename field_type::value_type(0x444929347C2DED029BC19558B0F69A4492017A9C35B370711E08222BC0B9EFC6_cppui255),
+                            typename field_type::value_type(0x77785EC5CBBDABD645A3251E7DA57C8FFC39158C0D7B25A4211C2AFF2E1D6245_cppui255),
+                            typename field_type::value_type(0x2B6B892AE94B454B2C2D92BB947FC4D506D173D281779C2C153C001DED42D3D0_cppui255),
+                            typename field_type::value_type(0x7F1CF64E0E180FC4D6E12C1B5C5285F376E979616A52C94A0DEA4D48C5880CD2_cppui255),
+                            typename field_type::value_type(0x1B9175B7FC19A618D5848C5761C2B760529E3EAAAC087B51112B1FCB422E04B4_cppui255),
+                            typename field_type::value_type(0x1730A59FFF4717E258CC853DECE7C5F70ECB52CC35320A53CC3838C844CA68E8_cppui255),
+                            typename field_type::value_type(0x378C491D1E893D0A64EEF25B6C3697C7A073DA390E5C413700317571C1C8AEE3_cppui255),
+                            typename field_type::value_type(0x5C956929821B07BF5511CA937F397CD7C1F9F6569C79AD0809822AA5C1B0E64C_cppui255),
+                            typename field_type::value_type(0x01371CF67FE47F8EF91246AE0485874D601E31984D854224569AC29E56A6EE87_cppui255),
+                            typename field_type::value_type(0x71CAD7D8350661CE798E332A98EE5B62F8431FD9AC5A4A48856CE9C4C5B64C73_cppui255),
+                            typename field_type::value_type(0x627108C7E3189385C8167AF1C2B563B74B392C3078CDA32B57E2BB87F45E696E_cppui255),
+                            typename field_type::value_type(0x6A4C37AE8DFA37E377D23FD7310B8A079780A27E3837E68C7FD849C3AE93A88A_cppui255),
+                            typename field_type::value_type(0x3E3382852761E503F26214E01EE1325D7FC89F0EEF289284A71A527C67B2F758_cppui255),
+                            typename field_type::value_type(0x30B4871C89D0C351A4FDE82AA9B550FC5AC26232EB11FA428BE492F49485741B_cppui255),
+                            typename field_type::value_type(0x6E73D4734F2405867BA03BD7DBBFA60BA68176ACF6BE4CCC278A347B5A4CBDA3_cppui255),
+                            typename field_type::value_type(0x305C444300649F36876B5CFF89D1D1A08BDAAE847896F783FAB58153C3AE076B_cppui255),
+                            typename field_type::value_type(0x63BD671ECA1E6ACCD0F980845B163CA4E927D2A74D198E78CCCD8FCAA6AED372_cppui255),
+                            typename field_type::value_type(0x0460CC32F5D27A15F4294FAA20A99112392CDBDC8515E9CAA1FF4887D22A6E7B_cppui255),
+                            typename field_type::value_type(0x0F6C3A96E0032A9394337A02FFB2C83BA70EFB8F566FEAB530FC90FA3B4710E5_cppui255),
+                            typename field_type::value_type(0x3D4E97E286378675038A4B58E84224EE515E1D6697AC79389F78479BE167635A_cppui255),
+                            typename field_type::value_type(0x3B13C71C2A90BD24C51DF6BD138C5D16208A9CEAAA8EB34A69469FADE6ABB440_cppui255),
+                            typename field_type::value_type(0x14890A7AB24817B2BBA826792E8FD342A6F705AF800252616435BE180D16DC54_cppui255),
+                            typename field_type::value_type(0x7983FCCB8FDFFD787F669568B35189D08FCC6194C31874EDDF3320F5FD1D642B_cppui255),
+                            typename field_type::value_type(0x3C0FCDB8F1B0CCCC2927571DAEBA50483DE19EE5579AB5ABBBD963226A436855_cppui255),
+                            typename field_type::value_type(0x184B48CB455000542259174DA9A6EB83A928B2835182278ABB6EC091E388A820_cppui255),
+                            typename field_type::value_type(0x3EE0E07A03DC33A9DD60C2682380EF736679A5E383FAF453FE324DBA26E77C33_cppui255),
+                            typename field_type::value_type(0x5D17BC7AE6348FF1D88F460EB1A18752C3FF569529FCAC8F4D862364B859C113_cppui255),
+                            typename field_type::value_type(0x53DAA8C1F06682F6163309ADD59E196F440503B0A5514F1785CFF1ED5765A23D_cppui255),
+                            typename field_type::value_type(0x2D86E1368AB546C9547C0E0E1A73691984C2208A53B4CBA3F48747AD656376CE_cppui255),
+                            typename field_type::value_type(0x0B2538616310B0BB96559890A1E5F8488214951A9E1F77433BC14429F04394F2_cppui255),
+                            typename field_type::value_type(0x5260385BE84291557508C683F0E59B8940AAAA4692CF5B1AE4884369A69769D1_cppui255),
+                            typename field_type::value_type(0x3D894F1C3C8B531D0473EC10231031A8EE3910A63F8A9E4E7264164A69A476BD_cppui255),
+                            typename field_type::value_type(0x5A04AE1195EDF508262196E9D23C259C937F81769B2258542B78E3C0FB135C34_cppui255),
+                            typename field_type::value_type(0x676667092118ACCCECE87E75F0A6825C5952F92DD499943EFE831F9712C5E8B9_cppui255),
+                            typename field_type::value_type(0x52EE53B981DFBC41DDAA5DDC2754C4175F4811AA45F8E2B19A425657C238A83E_cppui255),
+                            typename field_type::value_type(0x7EB0A1BE3400DEC87B388CAD51613957643CDF0595B891CC6F925FB36DA7F1C3_cppui255),
+                            typename field_type::value_type(0x501FE138924E05CC1A05129D241E6B5E9D46CD8B0BED38EB42EE20678A1D2425_cppui255),
+                            typename field_type::value_type(0x2F8022ECEDE0189C215882CA856DAE0F7B4DAF6675181A558EBD11E6911CEE4E_cppui255),
+                            typename field_type::value_type(0x055004F7D6A76CFAB88AA522F9F84A43911E5E5835B4A446ED5613F381F3DD9D_cppui255),
+                            typename field_type::value_type(0x476824E0CB7AF9F4C939B9BE68ABF7F128E7FB38CE9E2FD902AEAA6F20596340_cppui255),
+                            typename field_type::value_type(0x2D8294FD94996032B73B4F09A0FF645CE8DB39DB5463F0FC57156A1D390A3B68_cppui255),
+                            typename field_type::value_type(0x3A8A6FAA67C6DD905A4FDEB95AC127C9FDE3AC017C847CEADB2C55F1445AF624_cppui255),
+                            typename field_type::value_type(0x7D63770BA4E4F2A72B3716F2898FF63A3B4E6E14B1922A5B3F8777B793ABA7FD_cppui255),
+                            typename field_type::value_type(0x544E04BD2B43F9E9E779DA4EC2C62931A5B44EC3A551DA7CEBC979A9A452C416_cppui255),
+                            typename field_type::value_type(0x2A374C17088711D1DD19A6CBD48288A3A8A606F1F8C15F54DDB16397C9875278_cppui255),
+                            typename field_type::value_type(0x5AB35FCE03931CB376E1B54EB9E21B8D4769BDCA91DFA7831E24D94308F30CA1_cppui255),
+                            typename field_type::value_type(0x3DEA4B8A91A1BEC78199D6DFD4A49F3D9AAE5872508A3C27C70D1C85CC105E02_cppui255),
+                            typename field_type::value_type(0x3479286BE4D044E73BDA8CF964A04C114C093BDF91A6EA79CA49E1E5BDC88CCA_cppui255),
+                            typename field_type::value_type(0x56857D02674276AF0099D63B04A39544A23B841CB2EF18688BA9500361E4DA1D_cppui255),
+                            typename field_type::value_type(0x0B543A6720E318D2647915BCD619EFCDEDCF7FED0657BE45D27DB284290E72CE_cppui255),
+                            typename field_type::value_type(0x52A837BC7A7BC9459BCC2ECF80F74D9ED99DEF0342E18CFBE8E799FBC504FD52_cppui255),
+                            typename field_type::value_type(0x50D6460185D8924E5485F23F36A98C86053514D163547ADAB6FE91478A411196_cppui255),
+                            typename field_type::value_type(0x3F30EE695B236BC74620AFB10469324B45C8201A45CBD6954239E64086F3CD53_cppui255),
+                            typename field_type::value_type(0x414231531DD52E5555640FAEAE608C4A0C205A04F56D187BA80855DBC0478370_cppui255),
+                            typename field_type::value_type(0x4FBFDBAB005592C2C974A2CC3FD1B4EF7F8DB640AFBCDC838B0A78966B88FCCA_cppui255),
+                            typename field_type::value_type(0x68FFB955A83A0CE5A55313F837BFC1CEEC03ABE700FD1897A40265662D061C93_cppui255),
+                            typename field_type::value_type(0x0EBC38C54FD6AA12DCC60CA5C72ED865B7C35A6BFCF98778C235307D306DE6E4_cppui255),
+                            typename field_type::value_type(0x04B3A1D9F2EF40FDB3E31DDD56A08526DBDA15A4F58D78162C7BF23886763CE2_cppui255),
+                            typename field_type::value_type(0x14C053B040DFEB348AD42BB65738AE4B07EA830EFD00A617A93185647241A6AC_cppui255),
+                            typename field_type::value_type(0x7EC77091BC60573797E7D29C6759CC88A8795B8FC77CFE47F428EB9CD0EED3C0_cppui255),
+                            typename field_type::value_type(0x6518BAEDFBA8E047C2A5FD2DD7AB3603D3A1AE44FA7D61EBFE6F43240D99FD8B_cppui255),
+                            typename field_type::value_type(0x07388F75389963A211FBFB657C328754D31D66911CF34305A79E74B4A4F04A46_cppui255),
+                            typename field_type::value_type(0x78AD307EA1D917594E22F8C331222FEEF87D6A4C60846AB2D315C77BB5D37D53_cppui255),
+                            typename field_type::value_type(0x601B077B6CB162507FD2BFCC034047BDA0C48F978EBD175341E055E212791A2D_cppui255),
+                            typename field_type::value_type(0x3B75696730DC8D8CFB7DDB23241CC7CE78A13E6A377DB5DA527A1058E60E49DB_cppui255),
+                            typename field_type::value_type(0x34D031744CD2D9CFEF9F9EA654000016FB3E8B4A8C44198760F46016166DEAA9_cppui255),
+                            typename field_type::value_type(0x006B2BD5D00FAB38CECA21A27D6AAEC82626B14B555D859527718F8CA404EBA4_cppui255),
+                            typename field_type::value_type(0x727340C27A15F6AB3D80547F0827C56AB1BA33BC30D1EF3909EA9A3AF10C67E5_cppui255),
+                            typename field_type::value_type(0x1F4E8938DCF3A6D5907D88572BFB36A8191AA9D05BAE8F68D3F120EA165B2BD8_cppui255),
+                            typename field_type::value_type(0x5A8B0C6F649F8E191AEECA653774A6DDFC8CF8AE3D4D232E2148433B9BDA19CC_cppui255),
+                            typename field_type::value_type(0x3A2CF75FF2E2A20222CBBB6534DAEF682F1CB4569E9139A07FAF8757D0DE3126_cppui255),
+                            typename field_type::value_type(0x1435AC618E304887EE632D511082A5BB888CB2FD7611BC6BB5524FA044601692_cppui255),
+                            typename field_type::value_type(0x08FE8DF51B345989553484E20F600C2E46F4ED256F3C8DCC1615B872F0C2B925_cppui255),
+                            typename field_type::value_type(0x2738E06810F4CEC5D894C91432EDEAB5BA632E54D06F494B751BBA44BC93ABF8_cppui255),
+                            typename field_type::value_type(0x26CD260BDDCD53A33E16F8CB2C32623D6FBB5D8308F6A1ACA66EF7F5F4322AED_cppui255),
+                            typename field_type::value_type(0x286E66059B8C5AF632E2E9F46F28603DBD05D11250E04B5EF31633CD90FAD2C3_cppui255),
+                            typename field_type::value_type(0x2953A3C30B742507D8B13D52EA6CC12764C6E1300E85864C810C8D54B75B3021_cppui255),
+                            typename field_type::value_type(0x7D4C51196D280823573ECECA7CC809FE66C1A2672920BA5C1660AF774377CD9D_cppui255),
+                            typename field_type::value_type(0x3BDCEF7307883008A38B4DF6A28B8F7FBAADF2437F317ECEB35729ED536EE0FA_cppui255),
+                            typename field_type::value_type(0x674A478F5A68E7C92DA87321F7E6CD988BACF85D48D7A3822C5B08188749D491_cppui255),
+                            typename field_type::value_type(0x1A2403CC5EF2AD62B4F09AFAC79A48A5BA8EF74F3321B65A716164D49B141C74_cppui255),
+                            typename field_type::value_type(0x7779FBCD8BE50C9B021180AC97A544AD0C21CD1F3BD263CE5903B9AFE4FD76F5_cppui255),
+                            typename field_type::value_type(0x71DD75FE35761C01A48597EC730BC33237902FD4AD8612CBED1031EEBDF40DE4_cppui255),
+                            typename field_type::value_type(0x39674A4532078E34378667BEAE5CB55F814EAD9BBAF7E01B3B69533E9F88A411_cppui255),
+                            typename field_type::value_type(0x300D6B0BD6734E6170B814D2F28C82DE4A2DEBB1C5589BC8B2671E0320587090_cppui255),
+                            typename field_type::value_type(0x40CA073D0343190C7F042B83C7BCABD3FA997DE98F4BF0E2BDC4A7BF5C55FC81_cppui255),
+                            typename field_type::value_type(0x0CEB59A95601DD68D84A34CF289BA4BF943583E7113FC3374433B7ED36905232_cppui255),
+                            typename field_type::value_type(0x1A781B6DE1C34CED784426CCE7055D4FC9A4F977B025F8A0F993582B61615A85_cppui255),
+                            typename field_type::value_type(0x42545A6A59885C28266AE07652D24503C2FB5830C85817F6963981168CBEC8F9_cppui255),
+                            typename field_type::value_type(0x706406CDBD1CE0BDBD9EA269BAB2E060B129D6DA0F1E6983FB9B15672C2EB507_cppui255),
+                            typename field_type::value_type(0x60FBA0618AB41287A32799F605665A8E8FF9F9F986E51D362C1ECF68A8476FF2_cppui255),
+                            typename field_type::value_type(0x50FEE504978DAFFE84637A29AE6D339127F584BCCEB8B9A6B88F645080245D2F_cppui255),
+                            typename field_type::value_type(0x7E97763970E96E86FD444E2B16752F6D95DEF8555F6F8F25C8278F89E18CFA41_cppui255),
+                            typename field_type::value_type(0x0E85B4C08F01EE8F8C01916E8D44EC3FD2938C6DA58AD86E79D07CA1146B6217_cppui255),
+                            typename field_type::value_type(0x0208622A2F72F9FB6C09D6F4C647AF6698CDBA3B5DAF6D302B3D2A0B25764CB8_cppui255),
+                            typename field_type::value_type(0x14467120E8A31D04AAD8776DDCFB459DFC13E47201E1918A9E1C9CBA531169F5_cppui255),
+                            typename field_type::value_type(0x6C1262E3F8A43B517673A0CE209F76CB22D7CD7E54FCE6AC235711E441703A02_cppui255),
+                            typename field_type::value_type(0x193841CF1E0F528B9A8D508A276202A84F1FB096C5ED013A7F486F0D269C007F_cppui255),
+                            typename field_type::value_type(0x57426AEFC21BE9CCF162E23D25AC3002BA8534351E65613F870F690F2FD46CF5_cppui255),
+                            typename field_type::value_type(0x6B45B002FB4E8A6F59A6FFB006ED71F75434217333B266325204C7D1AC2E1F34_cppui255),
+                            typename field_type::value_type(0x205AA3463E7E41AF60F5CFF4853FBD6F748AA1B132FE5308807D22C5030B48F5_cppui255),
+                            typename field_type::value_type(0x320B08E8EC6153E2BE9955058BD26993BF50353E040C556EF8976663448735AA_cppui255),
+                            typename field_type::value_type(0x68FC29A1AA948157D1AD9165ED3C62D5C4DC8025DBF864D9972E5969024510B3_cppui255),
+                            typename field_type::value_type(0x5DE15DE41A8B7A671125E884E90988200C0CA8D10D7917BB5341215AAB7DB5DD_cppui255),
+                            typename field_type::value_type(0x592C8B8843CA1F7D9EE692D5E29BC1612B0A98BEA402C5C2E1E8253B65FEEA37_cppui255),
+                            typename field_type::value_type(0x42A352D8DC52FEF9017CBE617CDBEE3AAEFED1935AA62F8679AF6F2A1D00B5E0_cppui255),
+                            typename field_type::value_type(0x5171A309062D41C411CAB8C1E0F20B16B8D9A67C9565B998661319A89AB8A220_cppui255),
+                            typename field_type::value_type(0x1022927FEEBFF7E6CB7D3185F63ACB8CB1D47036E4B31562A96DA559F10F60E3_cppui255),
+                            typename field_type::value_type(0x548CD2FD1081F7FE451619E91FC77D80267B8C5044575394BEDEF01847B02103_cppui255),
+                            typename field_type::value_type(0x0BCE664E505AAB6BE5B1BDD392A0A4444426C7BFFA7AFC24FE7C1B76E84FBFD6_cppui255),
+                            typename field_type::value_type(0x634D610A2AC90D2ABE1DC8F4AE902432CABE3176F144C1207CF1781F55B9202E_cppui255),
+                            typename field_type::value_type(0x17DF063F2D3E3CF834A6FCC7F6297B86677281BF5356412FAE63B481522131FC_cppui255),
+                            typename field_type::value_type(0x041C030FBCA90151CE0D0064A815E03825ED77A4AC634604AC7137BD3713AF22_cppui255),
+                            typename field_type::value_type(0x72467625EE43FB7AC67DC71C655E5C16E4E97C2A3D4445E7E9B33FCF0780F989_cppui255),
+                            typename field_type::value_type(0x6222BD88BF2DF9D5D44B60CFB4A08A960078DB7ED51A35EB3E0B6B8FF4EDA202_cppui255),
+                            typename field_type::value_type(0x0325BB42EA4ED025DD6BDAED261B7C4F5410B608BA902B068F1EFA5782E45313_cppui255),
+                            typename field_type::value_type(0x023BC7ABC84CB4C4AE5FA62B25A0A8114E8406D9BB93F2091142AA2D8BDBA597_cppui255),
+                            typename field_type::value_type(0x4D2B97A739ECEB14C95020371D7206E904F94B8F2C620DCEED8511DF0F29C9EE_cppui255),
+                            typename field_type::value_type(0x132A065EDB5C4041C59A8B49CA8A61DF2CA8CAA6CCEA10D88007640E33263467_cppui255),
+                            typename field_type::value_type(0x534EF70A3532F780762D6B7B85E5CFD1B390B0DC31FE8EA59865FA3E1DD7DE2F_cppui255),
+                            typename field_type::value_type(0x6D5066CF7137B4A5980AA453B672C84797FC6856F0EF5CF0C4BE33FBBD39D169_cppui255),
+                            typename field_type::value_type(0x54BB8CD82A0A87C883ABE35ABEB81857F95200B4222EA95B5CB347115219A417_cppui255),
+                            typename field_type::value_type(0x35FF8F7CDB0869347F58215A74BA0A8F63C0310FB99A0B275072429C7B04C2CD_cppui255),
+                            typename field_type::value_type(0x50E1CC6871155F055469E86953BB606B4E1B5717DFE1A8A90FC49CBAA6CE8B8A_cppui255),
+                            typename field_type::value_type(0x6C6365C17F4BB26F6B4E87079A8328E54012BC64947385A12AF2120A622E0213_cppui255),
+                            typename field_type::value_type(0x1C5703A9D3D1A968C8320A0056A9EC8E08DC332A60B8D3EB0309499E5494C782_cppui255),
+                            typename field_type::value_type(0x68B818A50B31D52CB8300141BE7CEA83479DE51848C1E18F3B944C675BD887D1_cppui255),
+                            typename field_type::value_type(0x1E8B233EC00766B228EE74D7536D8F439685965535ADDC774728E4DFED398826_cppui255),
+                            typename field_type::value_type(0x6B66159AC8702D4E34073B76629DEAB2D3AA50942DB5B00E4A73E8BE859362A9_cppui255),
+                            typename field_type::value_type(0x19DD4BEF38EFD504E49B3A5D584432B9CE630883226031E75FEE1A22C8CA96C5_cppui255),
+                            typename field_type::value_type(0x71AC99647B61B9ECA6F0C23432A518F738AEE708D5932D4EF0F172240250A226_cppui255),
+                            typename field_type::value_type(0x3A96C2C028EBE5F48913BE30147E41BC5E1CAB9595D5404138A9AA1B5574CF25_cppui255),
+                            typename field_type::value_type(0x221B138A1BBB6548D2EF719BBAEE436114E7CB6B3225DFB94C327667EC45772B_cppui255),
+                            typename field_type::value_type(0x7951B295FAB7FBFFA46C08F6979BB32060974FB037BF5998D0BA5A38180CAD84_cppui255),
+                            typename field_type::value_type(0x29773DDF76138729E33C8FA987B9725F5F673EC613FD5EB7A81CCF3D3659CE9E_cppui255),
+                            typename field_type::value_type(0x5D8FFDB97D47F63DFBEB779ABA112C7EFEDAB2C6ACCFE6417978EF909BF19006_cppui255),
+                            typename field_type::value_type(0x1C1B0D95DB6A057EB34F28BEEDA9F6BBB5315285DE2804D15C3B186BDB3F5C28_cppui255),
+                            typename field_type::value_type(0x57BD5DE4E0056CBB4D98ABEF9D1E0ED6CAB1628AC08E36073E31D00A9AC3C5D5_cppui255),
+                            typename field_type::value_type(0x32F5C53B3313BD7681017BBF237695368188187BEDFC94C02CA00D015FEA2B34_cppui255),
+                            typename field_type::value_type(0x4A5EAD73F1E476775C4B73B8678F048591E51CF470F893E5C4F4BD55932B52F5_cppui255),
+                            typename field_type::value_type(0x6EC452375E3039C82D6D27B41D99A18CA8A12646E049ABE18E94A9FDCE2721CC_cppui255),
+                            typename field_type::value_type(0x0FBF6BD46E7F4C6BDDDA7E0F3EEA6C430FAD3BD9021A141B843315B0E7F485A9_cppui255),
+                            typename field_type::value_type(0x6F4BC341E22F0BDACF6A9B01AF177AECBCDC594D2995A7F86495526FEE661CD3_cppui255),
+                            typename field_type::value_type(0x7149DB8AF360D4C44DDDBF23998A38D398AB2C6500DFBD74DDB09F3163C8A3CD_cppui255),
+                            typename field_type::value_type(0x4F846FAD2EEFB8C948A8BD3A87D8B4DFA0A0AB643E724EBB1C91437C567C9F47_cppui255),
+                            typename field_type::value_type(0x0A2640CCDE505DA1AA9227BACACA13D49A67A199F0E16AA9F86C2A7E1BF02D2D_cppui255),
+                            typename field_type::value_type(0x1F6A1FD8CC0E05B2742BA0FC0369B5247670543637DD033E64DBCE90B2F23E9F_cppui255),
+                            typename field_type::value_type(0x779964401EE869A9B31C0EF874A86440BA85D25C2CE932BD31A0865869605E19_cppui255),
+                            typename field_type::value_type(0x6F0A87AF6E0F4A05FA7067CFECD4F98DADA3791F714A66648DBB5CBBFD4F326C_cppui255),
+                            typename field_type::value_type(0x6B6013813505927DCBCB6A42E887CC1D5FCA175E4CD226BE6009248C6C6E36C6_cppui255),
+                            typename field_type::value_type(0x398C8C8C8E8DAC3256749DB66B66CB447486132EC414FD516B4EAF0A0FCD15F4_cppui255),
+                            typename field_type::value_type(0x7FC5E88A596B4265ADBFA221D1F69E234140E3FA1F3B5C39F76DEF111A7459CA_cppui255),
+                            typename field_type::value_type(0x1F90C7EF4610DD083B3D64BAC47574D9DA326B536B9A6EB0F6C3134A847A0564_cppui255),
+                            typename field_type::value_type(0x63344CCBE4169AB97A13C3CCB097C0F4FDFFBCF6284412303C79A1C8CE3A2F7B_cppui255),
+                            typename field_type::value_type(0x3D22B58C663EA91B49E95C17C7DA1563CDB6C6AD70A46DE9E2F59FD686603F08_cppui255),
+                            typename field_type::value_type(0x7240C7E82BA8372733D8BFE20D176ABDA80965F9F4B7C7799742B63FB03B0EB2_cppui255),
+                            typename field_type::value_type(0x6E6C09DB77EEDF33E50185BD1BBCC0B0EF7F4F4FDF4B79CA47645E86F1900608_cppui255),
+                            typename field_type::value_type(0x5640B667AC2D72E3EE569F906389CF8BBAD999A4F5393F0DC1E0ECEB9C916F07_cppui255),
+                            typename field_type::value_type(0x0A8728E5D785180354C86E453192F0F76EDC78727D7FFCD4B5009339D2475746_cppui255),
+                            typename field_type::value_type(0x7EF39552F5076702A3EA621039065565A0D37FB09323F708CCEFD41CDED490C8_cppui255),
+                            typename field_type::value_type(0x47AC42E7C59481A928348D7AAAADE88B00B7AAE4E73EBE0DD20E33092DD34E07_cppui255),
+                            typename field_type::value_type(0x28A6C1D1356C10EBEA15CBFD161AE974F3B2A4F51ED06403C2F09BB58F7A8924_cppui255),
+                            typename field_type::value_type(0x22E2C039067920C42980DCB3A905FC91601C2B34E819CE1532ADA4A5FC39D5CC_cppui255),
+                            typename field_type::value_type(0x631CF9945A09BF26D7E595B3F8E3390696870512820DF63C5418577089E1A8BB_cppui255),
+                            typename field_type::value_type(0x1A62E85BA4A14A3F24F9DCA8529CA842F5C7F18A3F429886D6B13673649AD53D_cppui255),
+                            typename field_type::value_type(0x1F6D17D9A1E5C5D8CBB98100757E5183551D00091183E6A5E1EB0DD514C8BDC5_cppui255),
+                            typename field_type::value_type(0x45D50507F0C2880AA1ACCFA52B8B6DD0FFBE97C93702B762F96BFA47EEA2DCF9_cppui255),
+                            typename field_type::value_type(0x554B5AAB954220E3E594352CF443543F504DA462C3952FC9AD2846057297EBE8_cppui255),
+                            typename field_type::value_type(0x36B566A2C0F8E36E760992EB83D509238731939DD9DD0D19513F52E1E9E4F9EA_cppui255),
+                            typename field_type::value_type(0x1BDE4AD0433EE4E19E734C558978DD945ED244E38414387A43E70232ED39BB3A_cppui255),
+                            typename field_type::value_type(0x41EAA719E14D96EF639A205F5F8D78CF83FC4E63D8223D18D6108263FE52730C_cppui255),
+                            typename field_type::value_type(0x77DF8F3C75CC33DFC39C1D2A6899718E6E10F23524844331B0B8EBED4D735D76_cppui255),
+                            typename field_type::value_type(0x17475A442C1755C3789079A6C205C172BE30121FFE7F3675F4547F66F297F048_cppui255),
+                            typename field_type::value_type(0x4D82DA48FE8104E9185C1CCF2C3F17F4999F39F5E4E1F06758BE20E47C0B4D5A_cppui255),
+                            typename field_type::value_type(0x465583D6EBD7379A2CFE99E81C5CE689249FEFF3B806EDAB74BB6F87F3EE8D61_cppui255),
+                            typename field_type::value_type(0x3BBFF70797FEEF25A225BEF35A4F1792CE42D2BB06866DE52DD550D94E6593B5_cppui255),
+                            typename field_type::value_type(0x0FC8F365BB4B04E275D358BD3C277745C565EEDFF84179EE72CBC5A3E38FE7B2_cppui255),
+                            typename field_type::value_type(0x16F91C8191DB1E7817455B6A395DE2B0F4396697920BA0CD4874E2B534937B24_cppui255),
+                            typename field_type::value_type(0x608DE273A9F6A534219D7AAEDE3CF65A81E4DC03D7A2765ECED1D2B7BE4610F4_cppui255),
+                            typename field_type::value_type(0x3B31D0113F98D81AB1312FB2837AA9C8DCC7960F84EB371358C6D841F67144FA_cppui255),
+                            typename field_type::value_type(0x08D1E75A33BF363F2EF64FAA0AB5F9582D1181B793EC9452EA93A3011634D581_cppui255),
+                            typename field_type::value_type(0x47DD939350F06A41EA9C3D889D127155D0275926D05B5BC43977B5CCAE42CF1A_cppui255),
+                            typename field_type::value_type(0x4B55DF555EF78CA29BB08CEBF74CE07115205182089D86EFA70C3F0DFD1DA83E_cppui255),
+                            typename field_type::value_type(0x2FAEBE97416B3B52A2E97EC02E0F2E684149BD6D58143AAD304E6E8CDCD6194D_cppui255),
+                            typename field_type::value_type(0x0B2FCB60A19E6A0A29BCC1E5224EE0ACFD648E6EE2143F90A5F5AA1C6D51C96F_cppui255),
+                            typename field_type::value_type(0x6301B568E9C613866D76B4C693DE25E83435344795FB78C3C5E944A1F33239DC_cppui255),
+                            typename field_type::value_type(0x6D187E11AEDFD714EE4DEA3643B18B006F965F8058EBF3484C38028DD62EC76E_cppui255),
+                            typename field_type::value_type(0x3607198A1819DC40A27D5237F93E5E31070512D561D0BC17E2E0464F0C1CE745_cppui255),
+                            typename field_type::value_type(0x4DB4418F87F778EB75185D9B62E977FA433393AA9D266F51081CD99764529A1F_cppui255),
+                            typename field_type::value_type(0x5140B9860C78EA8062554EC86E1EDC7AC76CF7CDDACFCA01EBAD13E93E82A813_cppui255),
+                            typename field_type::value_type(0x6E1A9BB685ADAD8D9971BEE76C48E9724966D0B285F58E0D44431DDA40465406_cppui255),
+                            typename field_type::value_type(0x31EF82C7B281AA8D9F2C7C3EBF401D507A4841751F3E2BCB19039E6ACA5E83E8_cppui255),
+                            typename field_type::value_type(0x0B216CEEC26C5CC827EBFF75A3B41630D8925BCF8AE53C7DEA348F4C0DD3AE27_cppui255),
+                            typename field_type::value_type(0x563053B0DEC5518F24C57A3F9138916EC287602E8A557819AD77AA2A5312BAC3_cppui255),
+                            typename field_type::value_type(0x3F748617CA63AB3E44C6E34F63E7328EA56A2A146DA34368A57DCA181254FE02_cppui255),
+                            typename field_type::value_type(0x0FED89E6420FC47B3938A2891BA9ACEE4CBB2899EE4E9CA15A13DC527DC1641E_cppui255),
+                            typename field_type::value_type(0x08F050E6E4BBB5E43B756C82A0FFD60723F78C3FDFB49C50378A1083808C3CF3_cppui255),
+                            typename field_type::value_type(0x38900048F0768542B4B9354736B6880632A94601A17A15ADF4F233924875EE62_cppui255),
+                            typename field_type::value_type(0x1024811DCACCA43BE00039025E7D2CA4B6D068C181159D64BB39D195C39D1551_cppui255),
+                            typename field_type::value_type(0x49E4FC36FF8A9225C4E7D0298AEEEFF491CFA5BF5B4DFE70CD5A46D937F929E7_cppui255),
+                            typename field_type::value_type(0x2583374456F20C85E78E820263E1507524897A5232050BD0EBFC357D04B900BD_cppui255),
+                            typename field_type::value_type(0x62D1C4FFFD5AC72C7E7DD52C2BC9EA4077EBB7032A39291E0212DA60CBCEA18F_cppui255),
+                            typename field_type::value_type(0x610152712122900AD67241CC8AC35AD35CCBDA17CFE315D236605E1A4073A50E_cppui255),
+                            typename field_type::value_type(0x2E7E246FC7ADF9EA242B6A5E95F9869C92054C446CF63C08E7A97B261703B175_cppui255),
+                            typename field_type::value_type(0x2FBA67CBC177C278004A74E9EAAD3DC2E2DD98359FB2D15680E32215421C92BA_cppui255),
+                            typename field_type::value_type(0x363948C10BAFB3E76CDDD46F83DD0D2D38D4894B87F4E50515C0F2D6E8EA91D7_cppui255),
+                            typename field_type::value_type(0x4D0892A3B61ECD0F86A1C0C056C0D36CE6EB3567637B542264833DB0B011B907_cppui255),
+                            typename field_type::value_type(0x38EC39469A1E53B1B30EFD344A8A0ECCA8BFA75077F5B7D8B095AAAA819FAB6F_cppui255),
+                            typename field_type::value_type(0x05B4079D8C7A5A10BB68984233B2726BD95196AE2B50E6052441FC4E5B98881D_cppui255),
+                            typename field_type::value_type(0x2329432253E9AA57901C1369E57E54E4A363D2CFE69069108C833FA8D79F612F_cppui255),
+                            typename field_type::value_type(0x69D98B5ECC35D56C97C0BF312955D199BEFE116B417D70F5F57E2DFD0AF81CE5_cppui255),
+                            typename field_type::value_type(0x3E26D487FBFE36AB44E0CA3B248FE94BCE92A69B8154D50E2D5481F8259F4E8E_cppui255),
+                            typename field_type::value_type(0x62A8A839F45660759F741C7892703326E4AD11BD9E102C0770AF6AD49DD4B6D9_cppui255),
+                            typename field_type::value_type(0x3D45D6C61B8A03C29D11CB1E9660112995FD3BC8C1553AE897448B613555BF3B_cppui255),
+                            typename field_type::value_type(0x5FF031A9E8F4A9A28D7EB3A97FE4334433112299C6B825D0A55D144BA1EE3347_cppui255),
+                            typename field_type::value_type(0x67C7CE2874DF5AB040EAE515EE26EB81252DAE3576FF40D732927F6F65C163F9_cppui255),
+                            typename field_type::value_type(0x4E1C036204E123F311E8DA4E3FA212FCF0ACAFBDED425B71A66B0DCCB2500E7E_cppui255),
+                            typename field_type::value_type(0x6A5908D961F00A62A2AC904FD824F6932F0E735F257A7D0D273D61736F1BB1C8_cppui255),
+                            typename field_type::value_type(0x2EC34149929644706035F41D422942C1E1FAB37C0D6EA35D040ADB65174136B3_cppui255),
+                            typename field_type::value_type(0x2ECB17530E69EA2CC55C3C54A78160F272E4FC3DD40E3E39B3A33C31999ABA40_cppui255),
+                            typename field_type::value_type(0x1216D39000EBE44CA69D80A6AC293855E1CF96C550E2E20D518A520AB77D56F3_cppui255),
+                            typename field_type::value_type(0x374132BE82D973BD7043AAB912324ED03B4BD0D9A649E3823E78F4FA151FD1D4_cppui255),
+                            typename field_type::value_type(0x3CBE5D79F358C7E60396980DD1058282EE0A12A7AC7EB90C6467F0362DEDB022_cppui255),
+                            typename field_type::value_type(0x2AAA635D3E22C2E6390FDA3222BE6CC5ACED55C60E849E2F696EDD1A92E82034_cppui255),
+                            typename field_type::value_type(0x7FE8906B455E9F3A49464810D3E6B8E5FEF5D17226DDEA3B18F08E2FF8552D6F_cppui255),
+                            typename field_type::value_type(0x1300FF9D28F135030203B137EA4A3EC18D5DD0DD6B29A6EE7040B97B336976D3_cppui255),
+                            typename field_type::value_type(0x1E34443347F9E627B3531157FAAB6EACA1BC3114DF4A1423CC12BF8417B5D622_cppui255),
+                            typename field_type::value_type(0x295955A5ED061ECA7F87B9485666BA9489EC20A9C484224DC920350BB4A6FC79_cppui255),
+                            typename field_type::value_type(0x4CAB819C06B2F861B4BE5B06A918BC314BF29F56CFF389AE2BA8ABD5F1F5E156_cppui255),
+                            typename field_type::value_type(0x1F10FB18BD5ECFE633B53936F70CE8E58B6A864E679297770F2B38160176681F_cppui255),
+                            typename field_type::value_type(0x7FBD4F7BF2D739BB2A5CF284EEDD5601C023198FC8E38C15E4C51CDC21D5601B_cppui255),
+                            typename field_type::value_type(0x66E0DD397F1C401BE00A7916CBB32033241E6B3037FFB0DEE4C6CFA94AA0696E_cppui255),
+                            typename field_type::value_type(0x7C686B90CF6FF6A3A59CC7D8A5E00A2C9B2204DECF83F96BB56B53EF630DF083_cppui255),
+                            typename field_type::value_type(0x000F1DEAB1D3A4A3D2528D9103D118FAFDA873CCF0A518C45821D51A7FD71533_cppui255),
+                            typename field_type::value_type(0x7CA24FF711CD60FA2139D4BB96735CAE4E34D071713C45B6A59292DC72B60244_cppui255),
+                            typename field_type::value_type(0x5A5EF6269A1161B07214231C12E44AAAD9B1F9F2A8932B1E522E2B56427E1418_cppui255),
+                            typename field_type::value_type(0x77A0B600EEF1AF8C7FE171CCD9231C4F68342459828BF9AA843FFDE5908348CC_cppui255),
+                            typename field_type::value_type(0x722750E8D420811F6C47056A7C027F4D451985014B6F69F2F4009D37F7611AF5_cppui255),
+                            typename field_type::value_type(0x072E29E2978856332CD7F4E45ABBB6B4A73D40B40959BE60AB79ECA8227777FB_cppui255),
+                            typename field_type::value_type(0x1ABC6445012E3157564F4F1267DF9489AF7C8413309F968BECCBB08198A36CD9_cppui255),
+                            typename field_type::value_type(0x0AECF4E5A0C4C4DA709921A44DCA45965F89A3215BB5445CF72DDDF4ADE53A2C_cppui255),
+                            typename field_type::value_type(0x19304020C00E6169712D6050734BF5C51BD0AF80B5BA4A6A0BA008E965216807_cppui255),
+                            typename field_type::value_type(0x51F4FF8C599B1C96DA82941520A9F5ABF4A31EB8B84FC95056145CEB3B5775D0_cppui255),
+                            typename field_type::value_type(0x35AC9588D46E41F3F6F99AEE3852EEB4B12E807807D4BD1B7F8406B0D7863AC1_cppui255),
+                            typename field_type::value_type(0x568DE690133CA63F63C08161D852682FA5696C0EE66BF8F3EC729B6A71BF9741_cppui255),
+                            typename field_type::value_type(0x4C48220992E8E64741DCDC433A0E65B43A5BAE7F4D743E3D1BFDB123773039E8_cppui255),
+                            typename field_type::value_type(0x4F2F4B477F6CA632750965A4F97D966F9BB1A9E6FAF03F479FB206C8B59F5785_cppui255),
+                            typename field_type::value_type(0x13115F873B8A8439A16D3208A70462C16AE38525C23CCCF25480269D9359E934_cppui255),
+                            typename field_type::value_type(0x3342C4717D55221DEF46B89FDD237CF4E9528170F9B524BC6E730CC4663403DA_cppui255),
+                            typename field_type::value_type(0x50676CDF00C935368D54CCF1FA7DD2671CD7EA46686E61FCA49DC6A85B6937C5_cppui255),
+                            typename field_type::value_type(0x282A400973B64ED0A93070FDBA88D599FA2FD0541F48DF6E99FB0FB8F1ECCCCB_cppui255),
+                            typename field_type::value_type(0x5A8A95D8CEDDBA93595C9FE01AC6BFCD9ACEA0D1E0C3150C7F562DD27AA84686_cppui255),
+                            typename field_type::value_type(0x7AAF48F59F15C20D43E5BCC0A9F0D58952BB338E8186376520C29D9ED297DBD3_cppui255),
+                            typename field_type::value_type(0x2765BA6A9E76638C36149C63BFE62DE38A8F0AC8E8E0934DAC69896BF1A58D6E_cppui255),
+                            typename field_type::value_type(0x0336498FBD2B4355CE5F8C55891B959133745F4CD49F7C39BD4D979BAA2329B4_cppui255),
+                            typename field_type::value_type(0x653338B616279CE7E44B1C37969B109FAFE0FD52FFF48D9AA1E08A7C5DD5CBD8_cppui255),
+                            typename field_type::value_type(0x3396978BFC50B33D58EB8DCCC52201EF36DFD27B914D8AA86F6BA45D29424D9A_cppui255),
+                            typename field_type::value_type(0x5CCF1359113C127DCB9D35BF9107CCCB453EAC7CA7DDBDABB1D0CA4AC8073393_cppui255),
+                            typename field_type::value_type(0x3FAA2A093A19A02424F65A10955101F4DC015C43B2DFCE8E001507ABD741B845_cppui255),
+                            typename field_type::value_type(0x7A1DE10DACFDA389CA663B15574BDC8AE8C5B6E7CEE647E77B11DDBFC6EB8EDC_cppui255),
+                            typename field_type::value_type(0x30F9CD3076C51C96A9BAEDA10EC893105D920F022947716064E32717AEE8E3C5_cppui255),
+                            typename field_type::value_type(0x2CAEDFAA420120C6711921684F9F5A2B8079045FBF3A4EFD7E4FA7BC8CBDB095_cppui255),
+                            typename field_type::value_type(0x0044CF64898EDAE2590019BD66B9F4F3DE3C90A5CAE64389DF86496B1083BC71_cppui255),
+                            typename field_type::value_type(0x63D5742D68935F7F4B1D2EB09EC01E28F2BFEB5670F7796DA066B1529FC7E51D_cppui255),
+                            typename field_type::value_type(0x6070951E96E618BE7D750FA819593ECBFE9C26972471EBED72C093714B7E6E90_cppui255),
+                            typename field_type::value_type(0x7BB8B8086B2C8F273841DE642871DC22C7ADB51944D64304C0FE5F4C1D3E6689_cppui255),
+                            typename field_type::value_type(0x1C59139BC853C6FB3CA29D2C719071DBB4CE4E11A0DCB68FF9919F7C2B60D152_cppui255),
+                            typename field_type::value_type(0x278D3AB8504CC6EF603F4A31DD50FD3436615C7AE71575A816031F01DED37E33_cppui255),
+                            typename field_type::value_type(0x0E8E013676831C14B9F5C6B45D0F6AED3B0D833DDE62DE6001EA6628AAD1112F_cppui255),
+                            typename field_type::value_type(0x43A150E8A845646A465A67BA7DC72F45FA10184E942EC902F1D9568E739F6AC7_cppui255),
+                            typename field_type::value_type(0x256553A8F6110C7625402EB19AC812A5E2DD4EB33DFD81F3F311AA4C2565B695_cppui255),
+                            typename field_type::value_type(0x35EB4E4EB9BBF441673460E568B03D58730A629459AE64D1B56F97A0CA1E74D6_cppui255),
+                            typename field_type::value_type(0x1EC0EB040164DD81F57EBC3A26C3E8606154303A1E5DE3AF27B1AFD99D27703D_cppui255),
+                            typename field_type::value_type(0x3DF62C38B3077C694268ED7AAE9A3329999E190EB81F07326E5CC3A1D1A42CDA_cppui255),
+                            typename field_type::value_type(0x1924416956EA2C1269062588569B18178011EA7CBA1A3266284F48AA01D5A90F_cppui255),
+                            typename field_type::value_type(0x0C8E28127B7DCDD206FB6FEE96EB88CFC7DB7319826AC8CDB8B1FB8ADAF021DE_cppui255),
+                            typename field_type::value_type(0x2898FFAAB663ED49EC57038CECD898FB84076BF49BF6F5C4403AFF28CE974493_cppui255),
+                            typename field_type::value_type(0x094F3B96AB6C9477E759D6BCB9934557E613A0F4FA4FB6C6F4B3BC46F335163D_cppui255),
+                            typename field_type::value_type(0x59DE4B2305D8B7AF6DA1769D1B27473CA5CED8B84B82A54CEBFED2E98C19A76A_cppui255),
+                            typename field_type::value_type(0x4078B0875CE149844FE1A6462DECA6E4316BE1259C1726E94477E2F9F1DBE4D5_cppui255),
+                            typename field_type::value_type(0x34E2DDF5115701105D5D590F6617CCD7716C01B247948470C1514F12016BF75A_cppui255),
+                            typename field_type::value_type(0x1BDAEA88B78EB71777558F7452CD868E6D7FC33A0F85C3D2038BAC585C1FD926_cppui255),
+                            typename field_type::value_type(0x55EAF5FEA101C94FC2B9234F2B62C5786056BFA6BC8A23E59979B303EAAC5B05_cppui255),
+                            typename field_type::value_type(0x644F4F10C2A13C7E312A68927484D2041CF62A6B2E579FFB291E32FC1E0E6D82_cppui255),
+                            typename field_type::value_type(0x5726E2ADC5BBDBF0CC76250D1C69ED6F77F96D075A84616A35792093400EEAB6_cppui255),
+                            typename field_type::value_type(0x79735F155FD92F05890EF8F0D6EF865E8498A950D9A93CD127ED7D966B0EE8CF_cppui255),
+                            typename field_type::value_type(0x2FAB7584F9EBAFA144803F10DE981ADBFDCE1F5EB97C95D29927C6B674FD1963_cppui255),
+                            typename field_type::value_type(0x27B70248F415F448DAF44F5AB0B237645218EE698B29652BCF59DA2698C7F981_cppui255),
+                            typename field_type::value_type(0x4CB56BD83D7BB25558C34ECE98DD878CA5FE850AA79F4BF656269FEDFE165CC8_cppui255),
+                            typename field_type::value_type(0x5D1F6FB463251914535BD81A9F9A8AEA4D5EA5309B86C4EB8FB4A7FA15A03865_cppui255),
+                            typename field_type::value_type(0x49761C57CE3C8C4F1435D495903E2F536F3BE3712E76AF8D0B5A8B7D1EBC8FAC_cppui255),
+                            typename field_type::value_type(0x3225035E1065094EF32D7F3E7A6F8FF2748025F96E0C0B44EB35576B61E150A8_cppui255),
+                            typename field_type::value_type(0x654B39F4650804BFB7C76A3D254377050002240E2F794F8DE21DE5640FDC60A9_cppui255),
+                            typename field_type::value_type(0x50CE7BE2F1011218849A34CE62654414A8DCAEA8B4DB9B45DCE3B76A6B121996_cppui255),
+                            typename field_type::value_type(0x34219355B9A290FD59918830F05BF632F060A3BD5782D818B701471B53302141_cppui255),
+                            typename field_type::value_type(0x514BFF4E806AB6905290C8301D1C99A8008263EC296BE873D66EF96AEB9E6797_cppui255),
+                            typename field_type::value_type(0x091605B338EA1BD98BDFAE06BA25BD540525A3B02EFA65DF30DE5C6E8C637D0F_cppui255),
+                            typename field_type::value_type(0x1DF405521E9A2232BAF654AA3D2F66BDD6D57FD5BAC96F5AA5F8AD2864BF8CC7_cppui255),
+                            typename field_type::value_type(0x10FBDC33AFF0A0A15B015DF933372A78807DDB575815347ED293F174CFE85241_cppui255),
+                            typename field_type::value_type(0x03B79914CEC43E62E564C538B969184BE4FE1F9B27291F776E331869F08E725E_cppui255),
+                            typename field_type::value_type(0x6F2F3269991F14EFF06F7F94C93D707BD4EECAF9495696D74C465D2274CCC819_cppui255),
+                            typename field_type::value_type(0x797CB6DAA4EB6044D7A7AF350813D7EF75F8F787FBE75E532DB6C4AA4CE61A13_cppui255),
+                            typename field_type::value_type(0x495FC2C075BD1A86BF87E688F12CD9D687E4FC27FB5361DC50D029498E895B32_cppui255),
+                            typename field_type::value_type(0x48D8F25D9C570DB854D64DB0A2511E56D2BEF7850A0258D953B5A38BAB5B91AD_cppui255),
+                            typename field_type::value_type(0x4606FDEC56D46970938A8F9FA5F24624F5B9C6F488B72CB1FC87E4FEEBBB1FAA_cppui255),
+                            typename field_type::value_type(0x0F00D9E6656D8243E0350FA5B89BEEFA58E9AF955ED650A6D90CCE344ECF664E_cppui255),
+                            typename field_type::value_type(0x4339FA86A23242851A16AFC3AB05B352A7B4BF53599A49DD7E29D364FC3A757B_cppui255),
+                            typename field_type::value_type(0x6D07CC3462BAE9160BBEBB997510817040767FAA9DBD13F158A5FE8A63A34B0E_cppui255),
+                            typename field_type::value_type(0x62332EE4F8EE5E56398DD304ECA6FFBCDE556467BA2C0D5FABB64E9736C701EB_cppui255),
+                            typename field_type::value_type(0x3E1BFB3C0218CF9F7E6A2F47F179F29B0AD68235929B4921FDA74BC89FB8EF65_cppui255),
+                            typename field_type::value_type(0x33287CD3C57F3DCD485FEB019177D1E96976C619395D27326D1A396AEF810769_cppui255),
+                            typename field_type::value_type(0x70F3E2BE1882489B3126FF2BF72CF74C5F70358F5633299EAC146FEA1C371CDE_cppui255),
+                            typename field_type::value_type(0x7B9E0081B2E20F4F3D3F6D57F7BF977B2F192142A2A9E40B1AACD15140C88B2F_cppui255),
+                            typename field_type::value_type(0x093854716EF9794D2057036FF3F97DA686FA3A1784C42279E8ABF1FCC42B858C_cppui255),
+                            typename field_type::value_type(0x1C70927AA306EAF587C3CA6FC2D4C6F02AF2119E03129631180E4D47A7C2E55B_cppui255),
+                            typename field_type::value_type(0x2E259EC780DA033E55C0BAF4C3B4D80268E870D26E6EB1C10CB5654A077444F0_cppui255),
+                            typename field_type::value_type(0x1E22F8E8551EAEA83B689B626AC089595EB5FF9C9BFB4C3C44E14989F13C72EC_cppui255),
+                            typename field_type::value_type(0x121FD5FD0C3AB08F0D82A53987AAC64D85A071F32EF0D6DAEC0117E4D3609883_cppui255),
+                            typename field_type::value_type(0x6237E93647E5E784102427171F6AACE9270584072224661A326062A41118F91A_cppui255),
+                            typename field_type::value_type(0x438C3CAF8E404F0C55D817948230E504BE55872B056D36C7975D165245F5B2FB_cppui255),
+                            typename field_type::value_type(0x7ECFA6B215265291F32D21771E88699AAC3133FDB93EF3A479F95E2FA8742940_cppui255),
+                            typename field_type::value_type(0x10958B5CDAF36AFE557B7E60184207CE6D81883EDF035BEA63CB7DA46C4720C6_cppui255),
+                            typename field_type::value_type(0x6BDA13918DCBAF8529D6326AE7A9C278B72417C2188C5EA4F062FC50639295FB_cppui255),
+                            typename field_type::value_type(0x2C3FA803B162EE887D0D97A6734866F992F846625F314117075DA54BB6C20A36_cppui255),
+                            typename field_type::value_type(0x19AF956D2B5B4AC28B0C67889F19AD66A40F4BCA1625E2007963E8A98A70B14A_cppui255),
+                            typename field_type::value_type(0x5E228BB5FBAE687754307287833C3245A1AB34684A5A69174F72B460CCB69D8B_cppui255),
+                            typename field_type::value_type(0x7DC0F940A4CA84F90C1F32A644818011F28584BC0ADECA9C8D35BED74D873FA2_cppui255),
+                            typename field_type::value_type(0x202A2836390D43D89DE6F3405DB6DCE0AC61963AC0D2CC540D1BCC6337FFB90A_cppui255),
+                            typename field_type::value_type(0x45BF322997C4469AAC6D1E4251FB3490E60E7C0CD5CDD6F5CFB9BBC53587B9F1_cppui255),
+                            typename field_type::value_type(0x529D884884075753FD9A2F9BA021FF427FEA7B9773F0D4885DA5EDC024C69E66_cppui255),
+                            typename field_type::value_type(0x3330669D9C50D5CD1EA2C6F80206F88EFC31DB49882E8E7C78879C2DDC90ECC1_cppui255),
+                            typename field_type::value_type(0x472F41DBAE4412C9D8A2F5D0C3F1F2174A2F8382733B662B97259389D412536E_cppui255),
+                            typename field_type::value_type(0x067C7289E5840CFA293EA2352FC85E42C221C0F2CF1AF43D94AF062A344896C6_cppui255),
+                            typename field_type::value_type(0x341113F48B7B5CE6F5B5BEF94D4B145D8B5622FEEBCA8E5BB36EA689E5036532_cppui255),
+                            typename field_type::value_type(0x11429E2F0B19D6700FA48CA0F830E08629D1E3188B427ABCBA595026C359E253_cppui255),
+                            typename field_type::value_type(0x0ECAAF5D583E9D0623DB065AE865CA227922E4B7B4878C5BC8626D85A4F1AB90_cppui255),
+                            typename field_type::value_type(0x39632228D7D1471800E549128F91A680C9A64E37AE27D919A2609CE21522C607_cppui255),
+                            typename field_type::value_type(0x6F59557CABBD86E8E4D546E2AAE6AC26B27B671EBD049539991E9EF27E00E2E8_cppui255),
+                            typename field_type::value_type(0x4DA4821314574D4FED4DCF692C8B15B99B73F13633210333CE7871359B6E6424_cppui255),
+                            typename field_type::value_type(0x314016034673D2D20529BC93A2DAB6E462BCB5F66E1F4A6BF2170759A40A6E65_cppui255),
+                            typename field_type::value_type(0x22423CB8E82129DA6655D94354181FEB5B1C789806240B135C4DA1BD156D734C_cppui255),
+                            typename field_type::value_type(0x627DCF9BE9BE798EB639F6B776CE9EF34573C7A7F1D1ED220B1A23156F08CDB4_cppui255),
+                            typename field_type::value_type(0x32BEB4E36411F53E324DDBD920D42BD403E93F61E3957CA6FDF1BAFD72FC5B92_cppui255),
+                            typename field_type::value_type(0x425A36157C40B8503CB9A0E61ADA1359E9A6C43BD0392D6AA5101FC9E7901786_cppui255),
+                            typename field_type::value_type(0x04230253B946F9C176EA49E7FE2B913A35738999750B1E21555104DCAB320BB4_cppui255),
+                            typename field_type::value_type(0x04DB9DD92F8D939E6E4D0B0245EF57A62D793B173E977B8FA69558741D1E5AFC_cppui255),
+                            typename field_type::value_type(0x65F711807E58866DEFE3423611CCA254BF4382FB1E50E54F50833C62B35F9F4F_cppui255),
+                            typename field_type::value_type(0x066F79CCC68C4D222542315ABE148D5FA57F5AD3D0B2733FD35616D7F9D9637A_cppui255),
+                            typename field_type::value_type(0x115B217EA5058247E884BDC6A11628B6B2122A7249ABD7F6851AA4052F89D69A_cppui255),
+                            typename field_type::value_type(0x0D6E86F3A086B7479BD12EF37DD90D3EB65F06E7A9E6C90BD2804137E9279F1A_cppui255),
+                            typename field_type::value_type(0x1E90739A6BBF8455CBECCFE11A1FCE59C64F2315B4C51D17ED1CA0B1D181A9AA_cppui255),
+                            typename field_type::value_type(0x43299D97384722CA513FD249D8D69FE0C92F1282AB313CD498A5F82287B7869C_cppui255),
+                            typename field_type::value_type(0x63B06E648BF7AA8E8BBF75C0F3E0BC5D438683B063BE9F4F09DE91589756D7C0_cppui255),
+                            typename field_type::value_type(0x1B17D88ED99541BF1B2CFD50B7D4D87FFD627BB708D0C2445C68249BE08BAE16_cppui255),
+                            typename field_type::value_type(0x0B2CEA0029EE963C0034B61BF19E384435F14554A7D297B5144838C38E375586_cppui255),
+                            typename field_type::value_type(0x47EA95DA28D39AAADE5EDB8ED941C687603CFDD1508776E96D6683199E99DAEA_cppui255),
+                            typename field_type::value_type(0x06E3D157D1CD96BB4ED4CB069497E6041334D698B1640A59A44A45CDE613AABD_cppui255),
+                            typename field_type::value_type(0x72F5CE3C9CE0C93D9339B91978F1D9C688B56B3A3850627C7D7F93C427456C7A_cppui255),
+                            typename field_type::value_type(0x7C65B0AE1E629369D961DDF48DAA421BDB33CEBB32ACE7E29793DC6BC1C4350B_cppui255),
+                            typename field_type::value_type(0x23D893F2FF35FDF196B1BDED87AC89C674ED51DBCC42CEE58064DDFC793E6B29_cppui255),
+                            typename field_type::value_type(0x1F13202C95083F854583FF4CDA13EF4B1E745A880460850E59E22C567D23EA24_cppui255),
+                            typename field_type::value_type(0x66336D356C381B7EF21109E7FDFD7FFA0085087EB55C4778AD42025C90275F48_cppui255),
+                            typename field_type::value_type(0x11899251CDA7EADAFD67C3A43E7F2D64C03F8DFC0607BCA3EC5926508A9CFF07_cppui255),
+                            typename field_type::value_type(0x1DBECC336F79BB0326B5A26D01A63FE7716B7854F0A6ED38C01B471AFB7DE672_cppui255),
+                            typename field_type::value_type(0x714CA9E746B2D415B0A92F41B184AD187C9EA4943CC77393F2D937B252316E5C_cppui255),
+                            typename field_type::value_type(0x2443A8334B22341BE7059296211F3E8F612CB571719C943C8EE9676984D77FD0_cppui255),
+                            typename field_type::value_type(0x7C76EC6277377B7FF9BC00132714DA21FDF1324A457F47A5F2C649A28C30925C_cppui255),
+                            typename field_type::value_type(0x62377E50B35438494B7EC669C764A0CE2B50CF09258C7B67DC9822F34005E20D_cppui255),
+                            typename field_type::value_type(0x1D4E70E7FA35C13EC61EFE8D7B8AE9E621144C1EB2454C350920E4AC81360393_cppui255),
+                            typename field_type::value_type(0x7B2807A91CE09FF20A518D85BE729E118AE448B51763E880ABD15795DDC22E61_cppui255),
+                            typename field_type::value_type(0x4C27AFFF3C45F32C952D3984E14E29A098E685C9C2E723E5FC8047AE60B7E824_cppui255),
+                            typename field_type::value_type(0x5F2C99E6526DC87D95F11EB626C29C3A90D0BE1E51A4C49E5BBABD114BF5A66B_cppui255),
+                            typename field_type::value_type(0x786BE30733EFDAF7A08157F7907D6EE4F6952C728FBFA269FCEFD1B43224E085_cppui255),
+                            typename field_type::value_type(0x653A5F772F34985B34270ECDD4FD08472A7C08BEB39D69BE4EAB0712C63E2736_cppui255),
+                            typename field_type::value_type(0x09C186AFB833951CA2FD3AA58B84F09BAEA4BACC8756D94B3125CA89F193C7C7_cppui255),
+                            typename field_type::value_type(0x6137B0746027B353934695B149864A1E02A82A6BBED54FF11A349A357F7B062F_cppui255),
+                            typename field_type::value_type(0x21FEE4804968A933DF8957815BC8DD9CC6A4D06BEB4D19B36CB822F04C2EAA13_cppui255),
+                            typename field_type::value_type(0x500B7740072CB51D416C5DA150858339BDA5367A8972C2313060D3E930901700_cppui255),
+                            typename field_type::value_type(0x4A2E1F96EEE4E082B813E0365C89C9E8EDA10CE5973C99554919E3A2B12D4F17_cppui255),
+                            typename field_type::value_type(0x6C3F24822E185C5B8C951188BFDF0DA8DC229E517335A66444D4B832AC846FC4_cppui255),
+                            typename field_type::value_type(0x5DBD3BF95494D7466AF195BD869D2435462530EA6D0536A0AF41449EC0EC3464_cppui255),
+                            typename field_type::value_type(0x56F5F77776E9FBB0863CD8C0A8992AB9A342CE2A7B7B9F8C137CE1C737E25B77_cppui255),
+                            typename field_type::value_type(0x4B3702044575D3C0F1F2D57DF9771CEBB58E011AFD275E119370BADC76ED5685_cppui255),
+                            typename field_type::value_type(0x54333C50ACF332F52F427A80E5606AAFE36DCB0FAFCCE292482027ACD289B820_cppui255),
+                            typename field_type::value_type(0x77FE8A5D490AFB6AE4A198065E9488F8C358ADACF1DD564E28B7136E1146B3DF_cppui255),
+                            typename field_type::value_type(0x3C530F01E039F3168AC0033395218D9122ACC9FE0A3545BA6D75C5AFA5F50246_cppui255),
+                            typename field_type::value_type(0x53E2A4ED1BBB48BD016C524A02F797654CFC969849F867681DA94E341F377534_cppui255),
+                            typename field_type::value_type(0x5A2334FDDA642732A3C9520CE06581AA7F0F082882554C37B8D390A25A9BD559_cppui255),
+                            typename field_type::value_type(0x2618676F8FB18EF8C0FF9E057C9CCA37104CBAE666398A1FC8237BB34D0CB0B5_cppui255),
+                            typename field_type::value_type(0x2AA05B60A232EC56C8F2F51B1EB6CB7EBB2415FC4B1E8BA94EA41A235413414B_cppui255),
+                            typename field_type::value_type(0x281E0F83FFA5C79BB08F011F1133E2C8B9A63ED55CB2F34F114F922E864729A4_cppui255),
+                            typename field_type::value_type(0x5D2E7C59511740A4AD7C2B8B7D3BC8CFA51C2974606802EAADB58EECA17A291D_cppui255),
+                            typename field_type::value_type(0x566DCD766740CB27BCCFF752AD6B8FD3C2F7BF3849C1131A4AE7323EBC4F6C0A_cppui255),
+                            typename field_type::value_type(0x51E9F19FC00F3D398F7539196F459EF37E0AB795233ADE63B5F29BBEAD27B0E5_cppui255),
+                            typename field_type::value_type(0x0FE1BDE10F994AAA407844A9D7D2ED609E03B4FACBF4527D3FB94A661A498FB2_cppui255),
+                            typename field_type::value_type(0x3D162F25F41C04E45AB499860DA5DEBB12EFF05D2F8D64B4E4FA7E21ACC131AC_cppui255),
+                            typename field_type::value_type(0x5BE3378416605F1AB009A3960C797381D094FD862E3BEBD49ECC2E08CB1E63BD_cppui255),
+                            typename field_type::value_type(0x3D724FDA9E6CEE9D8BF398B8F49D3F02132F7394A58C86907967996B167182F0_cppui255),
+                            typename field_type::value_type(0x6158E3C0DA573E2C5AFB1009DC22F6BE392D1AF464298CFC9A372237B02CD3D0_cppui255),
+                            typename field_type::value_type(0x0A504C288881D0ADD389D4C215FDB962BA3B4639756280BF2062ED43E2190E45_cppui255),
+                            typename field_type::value_type(0x2151B330947C9F7B22FB8D7258BA6D9CD59CE0BBCCB51A3E121194862414AA88_cppui255),
+                            typename field_type::value_type(0x2A01507EE46F38350A3DFC49FBA49ADC907025FCC96B237C031ED0AFF23D74F6_cppui255),
+                            typename field_type::value_type(0x7B8D2C823BAAFE0D878A55E8AF1DB150DEC85B1424A4901F9BEFFD3A6196E3D6_cppui255),
+                            typename field_type::value_type(0x1C45A557B3624F9B89ED15B3C3E1A065F1B453D948F7CF45D9494483F8AF0C85_cppui255),
+                            typename field_type::value_type(0x5FA2B1DFEC51BCF38DE2510ADEDCC695952F36B9900F13EFB45D1C3CD099C188_cppui255),
+                            typename field_type::value_type(0x3F81FAA56DC388BD64DE21B25252D72F40D64B90BF427B8569409B7D23A1682E_cppui255),
+                            typename field_type::value_type(0x3780A1D4B6B5AC99A5A263D5965A5A96A82361031F6A4C8E2A8AC70BC7009528_cppui255),
+                            typename field_type::value_type(0x3AA8DC131E63258CB6FC9F36900EF3B98DE318D6652CEF6D83B95FEA238825FE_cppui255),
+                            typename field_type::value_type(0x1F878C9BB777A0586A03DD7C310986D8F6EC21F7EF82642E799E668A7B47FDFB_cppui255),
+                            typename field_type::value_type(0x59479937CAE12DF41A31892AC4BF58B9C5DBEAF4E0AE1DAB3421553DA8E44755_cppui255),
+                            typename field_type::value_type(0x58458308EF6C0A563E6A18FD5DD19E38BEC30919D58BD5A3E5F5571A8E1C47FF_cppui255),
+                            typename field_type::value_type(0x259D664D2B336B78964952D0CE2309727544E8326BEEE6860FD626FC2BB1C02E_cppui255),
+                            typename field_type::value_type(0x333F8EEF2B1F715F8F719C5733005103407D7994A7BCD3E50763FF13E0665CB0_cppui255),
+                            typename field_type::value_type(0x131883D8FC4CAFAA36D64A9B19EE223097B2A1B287FC33B67087F4107B4C7B5A_cppui255),
+                            typename field_type::value_type(0x7B10E1D26D95F4A3ED81D68D5B08E51DC82286E11EAA0224979E22AFD443EC39_cppui255),
+                            typename field_type::value_type(0x36663875E8DD133DC940C67FD902B27F69F1A18D2489F1A8605E817CA6919549_cppui255),
+                            typename field_type::value_type(0x08E60479F7F51F3AB2119B5875DEAC32F750073264DA7E554535A949C163CAC7_cppui255),
+                            typename field_type::value_type(0x1B2B6C48C2EEADCDB2115BF4EE5F90861BE7C49767BA67FC96FEE1FA4B22FA46_cppui255),
+                            typename field_type::value_type(0x78877B5D8777410997DACAEEA59400FC9DB4421FAC02C4282301C67D35FB7FFE_cppui255),
+                            typename field_type::value_type(0x0341B46C328333E4484CE8607619014D41775C408C88856D2F9E19812D90FBF5_cppui255),
+                            typename field_type::value_type(0x1787C129A60520114B3687D43367DAB6A3BA1D1C7BCA7EDFD2F46E4F09C210FF_cppui255),
+                            typename field_type::value_type(0x0BA4E0F55131C2B6DEB4A1FA4B5D6A2B47E28908FE7DCAFC1BA738DA2FCA96F6_cppui255),
+                            typename field_type::value_type(0x52F8C9EEC853AB7C38725D0AF6D1325EEEE1D736B3DCC724C196CFCDF3065ACC_cppui255),
+                            typename field_type::value_type(0x5F8A40D84D2B0277A724B6E0DFA95F682585AE0E78B05E3B6D64D444AD682027_cppui255),
+                            typename field_type::value_type(0x01F54318884A9A29932EB2D5AA126ED3A94FBEB7CB238538BE572B8E04C6E55C_cppui255),
+                            typename field_type::value_type(0x0B704F0AA8DD40EC8405EF01634D0DC797D01A872FAE337EBD8D2159A2DBFC50_cppui255),
+                            typename field_type::value_type(0x43A8478C1726D149CACD206F3F840B08BD6231058C015A2D608F765BBE902C82_cppui255),
+                            typename field_type::value_type(0x2941361FE0B228C80B7672123D4B2171D7F16063C726E62164986859DDEC85BB_cppui255),
+                            typename field_type::value_type(0x06589763FB5CE7C2B626965681CBB539013E67D157D13FCFC58AD35C67016941_cppui255),
+                            typename field_type::value_type(0x367E10EE9A052A4FB0F1C169BA8A9CF2BE24899B20C67757B2BAE5F0BAF30E0C_cppui255),
+                            typename field_type::value_type(0x52886C08793934882B9CCFE2D0ADE35D4214046157A9D14CC9370D85E258626D_cppui255),
+                            typename field_type::value_type(0x33487C541FCFE0E136F879C84630C14E6A764BB652292524C921B2140C6BB446_cppui255),
+                            typename field_type::value_type(0x2FCD57C067C348AEE6EABD76E66D27DE79846089D1E0916906AD03E940E9263F_cppui255),
+                            typename field_type::value_type(0x1A3DA7ACFABF171A0B078F4D602A67BCF8C74DFB7A284B553D86BCC7B9DCC17F_cppui255),
+                            typename field_type::value_type(0x2B556BBC070B5C4BAE9E575836D1D68EE9FBE800448C0D2C233F78185EED3F91_cppui255),
+                            typename field_type::value_type(0x7BA01332807EBD892E00DDB368C0FA1B3F19B5B32EFD90B178D984E1D7174D6F_cppui255),
+                            typename field_type::value_type(0x3F5C47B490BE4E04F8915CC5F3C1FE8E5D190BC41ED00D8F43B04444AF406F1A_cppui255),
+                            typename field_type::value_type(0x537CE98E07428214D28BF2B41039CB54EA8DA86045BAAA3F077132FEF32C3BB0_cppui255),
+                            typename field_type::value_type(0x1E2B1D5578437B24454BE3005D3FE26AF5A83CA079BAEF777AB98FC98DC1AEB0_cppui255),
+                            typename field_type::value_type(0x41C6747FF756A8D26636C73FF49F128B2F773731A7A458E1B915A06716D6B801_cppui255),
+                            typename field_type::value_type(0x614118E22068C64A823B4A570572D49131B2F8D1D8CAD3A538CCDD30A8B4F85D_cppui255),
+                            typename field_type::value_type(0x63EBE5283599FEC22B8D9733A9548505FAA5A3CBB5477811B0651229478DD419_cppui255),
+                            typename field_type::value_type(0x233475488522F3B085400F1056F312186B541C4C21761E46B7E92E2AEF773C8A_cppui255),
+                            typename field_type::value_type(0x37E8D773BE2A47153E03B94795D65EB7C01AB125BDE0FAC72A9D6B97A812B288_cppui255),
+                            typename field_type::value_type(0x318AC05007AD4D2D9A4A5E75F9A9A73CD0EF25238D9EE25F10BF037BCD22844C_cppui255),
+                            typename field_type::value_type(0x6BF5A299DFB3F82734752A977BD9B6A42C0F19CD1C2CF57F1D53AAC8823222A2_cppui255),
+                            typename field_type::value_type(0x1B76BF6BDB2579AB5EFEF8A6A3486F82FA109F44C95D04C02C73FCCB0D152C96_cppui255),
+                            typename field_type::value_type(0x502F67AC28825E30F3173E20D3F03EED459A686F427275365706761EFD0C3948_cppui255),
+                            typename field_type::value_type(0x13AEA1849989FFCC18795FF824240B157052292B065060A0B3FCF4D8EF3F3FB1_cppui255),
+                            typename field_type::value_type(0x0884949C8CA12B70FBDDBFF21B25E570672D6CA4106005551930C101C2B81F44_cppui255),
+                            typename field_type::value_type(0x0F72556998B0044799F0FD03210DED3D984E3843BBAF3C1D5D692BC94D43C4E7_cppui255),
+                            typename field_type::value_type(0x16C19C5037C103D447CAEF4EFE6BD81A490E7C668F6870F1B080863B5315DF5E_cppui255),
+                            typename field_type::value_type(0x25AEA0BC0827815B535D8C110E694B9247811FF43682E72A2CEA9EF5E347371B_cppui255),
+                            typename field_type::value_type(0x5DDCC7DCCC9E41754112BBFD9B9DA05D50E2138B624DAC59D200421105A13269_cppui255),
+                            typename field_type::value_type(0x3C56AEE69CB88840068E9F63DA0C61EF08009717CBBA66469749FD66106414F0_cppui255),
+                            typename field_type::value_type(0x4DE567DF25C390AD6464647ADA130671444581620EC2F13DBC3B389ADFA46A20_cppui255),
+                            typename field_type::value_type(0x4EECFCA39170C07DE4669BAE23B0068D294ED225FF7949285E8270460638E3D9_cppui255),
+                            typename field_type::value_type(0x5E9E7C4381074BEA73E24638AAAC0508E76A81B70E0D5C14FB1EF6306A371262_cppui255),
+                            typename field_type::value_type(0x7CAB69A181869F75083088B3462197125A80065C7126D4C8AAA0BB3BAF72D4B7_cppui255),
+                            typename field_type::value_type(0x6A47F43C5C1E9A21A054E30CF11C51FD8F2CE6BF7150B65B660AD465FDBFDD06_cppui255),
+                            typename field_type::value_type(0x0056CBD312F96072B3BEB2E9CB877CB5284706D2785C8EFDD53415AFC8304B4F_cppui255),
+                            typename field_type::value_type(0x38D497D27862D5851C5B269E4482A6FB172E6CE33520A067D9D59C651E83911C_cppui255),
+                            typename field_type::value_type(0x4E02CCB947E565178B32100106BA897969B6C485DE37F3306B4EE7AB4A86E33D_cppui255),
+                            typename field_type::value_type(0x076605FE122179417D35FB69102250A5BF592B80FB0C56396B6192AA37442AFF_cppui255),
+                            typename field_type::value_type(0x2884187FA61140983062669218C62A3017BE9D32437760281F9B762E4F21F9FC_cppui255),
+                            typename field_type::value_type(0x3200426867DF5F3D9F57FD086CC32A17850B08EAC3492DCA3CA1768AF4D3AB3F_cppui255),
+                            typename field_type::value_type(0x1CD96EF237B213CD446F13B3EC40D32ECC593BC6EA71E77EFC284341A5F3DA1A_cppui255),
+                            typename field_type::value_type(0x7A626AEB91EFCB5F9777264F5E17CED8B411F68C713673EF0F184A5CCD60DBE3_cppui255),
+                            typename field_type::value_type(0x275D04F2B3510C56664A8098FAFB5B4C950DEC7E83F0CCC4832D810897A24A18_cppui255),
+                            typename field_type::value_type(0x57DD6527DA326EBCA62DDEAD9B4863DAA69C1F11A39C3782C3FE2E5A06B8B93B_cppui255),
+                            typename field_type::value_type(0x5DC17A1192DDF8B87994675371D8535A425CC54D3ACC37195E2DA501BB5309C5_cppui255),
+                            typename field_type::value_type(0x68538E31BEE79120E2F97FD30121EDD15E38ACDC2B9884B63E86F21CAD653D78_cppui255),
+                            typename field_type::value_type(0x3C3B6A92EFB1B73A190AABDEA635754EEB5FFC376B2A0787ADBC2E7D31374F84_cppui255),
+                            typename field_type::value_type(0x126D49709E40CB07B122E980B9452A94055C87763B1A81E7EEAC60396D94B23B_cppui255),
+                            typename field_type::value_type(0x496222725424359A98342DEFFB0324830E99572C6C578ED90FF3883000762536_cppui255),
+                            typename field_type::value_type(0x0B370634DE2B0CE61AAC36EE698FD3C1C45DBF61C9DF9FCB2FDC1925FD7CE64F_cppui255),
+                            typename field_type::value_type(0x2201BFEFF751535D6B14F21329C1512E84A619F174E5A6596E7D4CA8847818FD_cppui255),
+                            typename field_type::value_type(0x2AF4F8C0BFB0380A171FB165F5BA2A76687C12BDF2FC81F20772FDE64C624BA4_cppui255),
+                            typename field_type::value_type(0x13E4B9507E542650B23268777E255C6253A91D6ADE2AAA93368E9E8A4550BBB3_cppui255),
+                            typename field_type::value_type(0x79CF2E8F8E6B970A797A8B9B4AAA5BEDD1D695916AD5FDED36DAD4BB274A03D8_cppui255),
+                            typename field_type::value_type(0x3CDE77866CC73B07A52A9ECE4832E2A02C9A85A6709F5B9D4C711DE45B556055_cppui255),
+                            typename field_type::value_type(0x79F2B3D77F3F44C771F685B6D3D352D7E4F20072B64EFC55A957437E967A18F7_cppui255),
+                            typename field_type::value_type(0x31A75B21CB532622A7CAF9E29E652AC4E47B1450EDF6655ACAF3797B55A7CA46_cppui255),
+                            typename field_type::value_type(0x77006E7CF104982F8865081A2FF8A6911546755E31C3586353B0BD0826C5D790_cppui255),
+                            typename field_type::value_type(0x507FDDB828993775917EB8D147C94B420E54C787736163EE92F14EF609612181_cppui255),
+                            typename field_type::value_type(0x5FFA5D8998F8DF1974F1133FC878D7BB58987B3ACE819DF0A09FD65DBEC08F89_cppui255),
+                            typename field_type::value_type(0x1FFD35207E22C09CDC5875F4D727864263F7808AED84D02615901F479485359E_cppui255),
+                            typename field_type::value_type(0x0F4876BA440F6E4699A8336C23D0E6F847DCA2F4120BE50EA3BB70BA976F0E68_cppui255),
+                            typename field_type::value_type(0x247AB53368A2D4AFF8EB158B291EA4796942C0AE4364BA270E1259E237612AA3_cppui255),
+                            typename field_type::value_type(0x33CBED49442E2EED384D45782A002D3DEA88062B42F823B001ECAB1BDD33192C_cppui255),
+                            typename field_type::value_type(0x74482EECC00CE092114689B2B1BC16841F5D768E8CE2305B58E8F416161E29E6_cppui255),
+                            typename field_type::value_type(0x5CA360EE533EE36F8389329151B542FF03B8B4B748731763289F767C132C9FEF_cppui255),
+                            typename field_type::value_type(0x1CBD5594BAA90375CB56ECD50965353A6D6AF4B57DD5A967C24ADD3F90947AE0_cppui255),
+                            typename field_type::value_type(0x5BF3A53F63F1A0C2DCA5F93FD3E14B1E24F1FAA1CB167D79718623FF0ADF2A82_cppui255),
+                            typename field_type::value_type(0x42DB47AB34FAA7A1F5007F7C9F2F091F5084565EE675C5FF2CC24A3F95DF4705_cppui255),
+                            typename field_type::value_type(0x0A4CFE006DDEFA3EB7E75041E64179D82BE88561CC1BB4B6FB72C23E3959A2FC_cppui255),
+                            typename field_type::value_type(0x7300F956C862BB5C5BCEDBEF880061A0ADEF30ABA72E901311F8918F41E868A0_cppui255),
+                            typename field_type::value_type(0x116D410AA365E041A43C071511113F1A4E09CC70E39F9E245828A32D82C1603F_cppui255),
+                            typename field_type::value_type(0x543D84CB04FB2BF787B7AA382EAAB5CD8D050AD8EE52AA8A285B945652014031_cppui255),
+                            typename field_type::value_type(0x0358FDC5B63ED49E693D838F182B275846F42DD49A42EC2E6E932BA4DE59EF20_cppui255),
+                            typename field_type::value_type(0x02AC4C0386A424B4A4272506180181C6363395B4094F551F6A70E1FB4F605EA1_cppui255),
+                            typename field_type::value_type(0x01A36C19FC30E5E46B07B2FF0721FB77FF4330E554FFA874F0074860D7DE3877_cppui255),
+                            typename field_type::value_type(0x2D2DD667A240FE9E15052C0F442E4F59A3788C3CA3989002F3B3A6DB62A039E9_cppui255),
+                            typename field_type::value_type(0x377BD9DB79C5D85227BA6D4639BF0C8D64AEFD115CB838DB76E8791506554DD1_cppui255),
+                            typename field_type::value_type(0x2816F8430D466B9B65D0990C2FD6F455861FB600A505F7297C8283D3AC2CC513_cppui255),
+                            typename field_type::value_type(0x5452C4B45430EA383524C90EF0C66AE08745DF0664AB5A184F89B17E74B47F1E_cppui255),
+                            typename field_type::value_type(0x1CAEBA6F06A2C5ACFB1587850560BFB1E47F47BFB9BCDA01ADC46A6FBA4BBEF3_cppui255),
+                            typename field_type::value_type(0x65FCDC11E7EA75774A0FCEF54225DC51A91EC180C6BBD59D39656A7BE98D85B8_cppui255),
+                            typename field_type::value_type(0x060C2952BF5ADEF4C8C4EAC720DD0967C6B9E902534C8C8CAC50F5D51935A5C7_cppui255),
+                            typename field_type::value_type(0x10EF5D494482524977C653DBB01FBDDF2B2CC571B01CAA4734A84B4205427F5B_cppui255),
+                            typename field_type::value_type(0x5D41698923F4E95516A15FDCC07651F9902E3591596E892C45A537B4701F0C00_cppui255),
+                            typename field_type::value_type(0x2D92794A28E9F2E8BEDADEAF0B8298FDE48AEE327DD41077C5364780EEF8BC11_cppui255),
+                            typename field_type::value_type(0x0CC495FE64BC4816637F94251DF4CDEE3CA74AFF90C1E427744489C13FDC9FE9_cppui255),
+                            typename field_type::value_type(0x42138E7B6CAB977EFEC0D3E669437AB9E0F228D3E38C1A6F6A5E06036E75198B_cppui255),
+                            typename field_type::value_type(0x0A2818F5F5D8937800C30AC6B847DB2CDEF655B864126302249144A5A15B205A_cppui255),
+                            typename field_type::value_type(0x187C76A49AF10851BB049BA97C0FBBB14B2621522A4E8D9670EA46E56C9A1BD6_cppui255),
+                            typename field_type::value_type(0x389973BE3632BBBDAC59F537AA63F28ABF7A33B915D53682A9EBD7D040F794FA_cppui255),
+                            typename field_type::value_type(0x4D6BB19304A47533A460358E9F3EAEF4B7984F8E99DAF4D2CA993DD87ADAB32C_cppui255),
+                            typename field_type::value_type(0x55742E80787A6CE586FC8935D801AF0999303FFED8EA5073C19E5891DA49CB23_cppui255),
+                            typename field_type::value_type(0x0AEABE3F0ABB8808439EDE792604D7E3AA8233EB3259731DEF6A31752836CE32_cppui255),
+                            typename field_type::value_type(0x68C0BFB003EEB945D29EC91BA57D6462C36B42A8FDEFA5E7B99D7B97CDA89D97_cppui255),
+                            typename field_type::value_type(0x4B0AD6BE2FCCB3042E2189C9F3EDAC9F6279599756876D246BA1D3F62C84B7ED_cppui255),
+                            typename field_type::value_type(0x2BE51A50EA193CAD9341080C3F2B075861461D7BF84E7B8A32B02DFC5CEA409D_cppui255),
+                            typename field_type::value_type(0x78798748D168DC54CDE79211B02CC31C905A402BBD812CBACA8069BFE420EE72_cppui255),
+                            typename field_type::value_type(0x0B4667CC7A19CCDB765AC883C61EE8468A006AF4550CCB1B5D8B8925ED056139_cppui255),
+                            typename field_type::value_type(0x016FE4EBB78F74660A2172B2FEE74276F88F6CF81CDEC98FCDF36AADA1C2CF53_cppui255),
+                            typename field_type::value_type(0x437E75B0C2E7B4DD6D7A99DA1FF67D66375366D3E5EABF1F0C52F681C76F9427_cppui255),
+                            typename field_type::value_type(0x260989BE9146302F6138ABB9FAE8CFFC18834C01BB3873746EE68F7C552F9074_cppui255),
+                            typename field_type::value_type(0x3710538D7CD7971D68F19272DCFE0D7A577B7E889977526E62704DFCBE6B8C22_cppui255),
+                            typename field_type::value_type(0x7D10827DB74AE0DC09323717542A2DEACA18AB2A48A8E245E5A827CA02778853_cppui255),
+                            typename field_type::value_type(0x7EFB45D3A2851109D7A8D50DDB08FE308BBF674C019B965CDAD4570A141E648A_cppui255),
+                            typename field_type::value_type(0x0FE1198B11A1BF56867091C69D71F8B7792257DDA321D43652E818ACD0C28CDA_cppui255),
+                            typename field_type::value_type(0x5D5225A5E2235C5216CEBD1847B2ED69E45DB93CF3EA8CF012AE918F2C983218_cppui255),
+                            typename field_type::value_type(0x7EC9E5494FEECD8D348A92636B5BABEEC6B5AB1982778140BBEEBC4E5DE7B1B9_cppui255),
+                            typename field_type::value_type(0x6DB3C0D1A1F27FB0927DA458C5094175BFABADBADEBD785EE99AC3CD228BAC21_cppui255),
+                            typename field_type::value_type(0x07B499ECB9B1BDB3F12E8FF00F1C4ED63D34986F92D8B8D77776BA7775D04F62_cppui255),
+                            typename field_type::value_type(0x6FDE98F557E3360932B5622351886A898E4639488C2433586E6B1D729A2E5760_cppui255),
+                            typename field_type::value_type(0x6994510FBDAD700AB9E84413C29CE02525E5B1D15BE55269875BF94A48002C8B_cppui255),
+                            typename field_type::value_type(0x73D4D9F5B9708FBDFA3457F84ED45D4FD9BD95F1A91F076407B07C406EE8B4D5_cppui255),
+                            typename field_type::value_type(0x256E14CEE7D41E0A865DF1A6A2D03716B20FA52B32CCE3736A17C7FCC669E516_cppui255),
+                            typename field_type::value_type(0x5C3370C184B6F61303B2B6A3CBBBFB9A2A154ED321328B0350BF43A6A211A8A9_cppui255),
+                            typename field_type::value_type(0x292A52D9E93324005D35AA45DD11AB1105896DD9390331387E76D7269A0AD07E_cppui255),
+                            typename field_type::value_type(0x0F9DF8EEF9562AB6F14C70C8BDA2F490D3B5F23743FB6D40F8BF09F014389C99_cppui255),
+                            typename field_type::value_type(0x42DDC05B73970FE43751B75A52F4C842B509EE407430296EDD9A674EB33BE730_cppui255),
+                            typename field_type::value_type(0x705BD9027E77D82D951C8205D33A5B3C3695FE7EE70833035FAC2D25A9ABDCA2_cppui255),
+                            typename field_type::value_type(0x1417FA0628EBC3A194CA46D423AD4A41CFF08879E02C8E51E0D6CD670C1BFEC2_cppui255),
+                            typename field_type::value_type(0x472E960DD122A534F52377235350549DF4A1DD7A08CFC580BFF5FB4B0A70AA7B_cppui255),
+                            typename field_type::value_type(0x10585D04FC529FEF4C0C0776154FC7EBBAEDBAE8A99937E47598D0578932B7CC_cppui255),
+                            typename field_type::value_type(0x3734C7D50AA73403B92723A944D6C90CEC86C737774DBC4418A1A6693DCCC58B_cppui255),
+                            typename field_type::value_type(0x416C8B45805EA84FA8247CFC6A0B0D0FCDC566E2D811ADFF2899F9EE663E7EF9_cppui255),
+                            typename field_type::value_type(0x3795778E98038EABC81D0F53ABB453ACAA4999522B6ECE1CC1E502ADD60372DD_cppui255),
+                            typename field_type::value_type(0x4EC9EF100BB13D1934D5DCE938AAF77CE420381B1DE161BE018390E390FED8D3_cppui255),
+                            typename field_type::value_type(0x3C3C51D3A301C63868A041B4210B71C3675EFFC0210360DBEAF2778DF7EC1EEF_cppui255),
+                            typename field_type::value_type(0x6C161EC4DE54D51B1A839D13F50E0274BD11C93F722EC44AB21342EF4BD6F892_cppui255),
+                            typename field_type::value_type(0x48CFAC0ADF54F4EDDBACD97467D3A342E24099A82F2D851C91ADC91A2695838D_cppui255),
+                            typename field_type::value_type(0x0D80CFFE71646D4D33D9F4CFBDFF732BD9370994E1D1DF44D6F483C97B40461F_cppui255),
+                            typename field_type::value_type(0x26EC5992DBB02B2765E4BFC17D1F734FB73651ED94C9F42C3B1112F3491AD290_cppui255),
+                            typename field_type::value_type(0x47DB6ADC7E176BEA3A9BEC06C6477BD81634E3BC2313325201C6A96E9EB37304_cppui255),
+                            typename field_type::value_type(0x6A4FBBED3E29C284CCDDBE46E7E038736B5125B7EB045C0C9415FEDC27B91F2B_cppui255),
+                            typename field_type::value_type(0x6C6310A5D02BE1BE94529F7B15A5FB9AD78AE737A917AAF3B9BBEE5933F74286_cppui255),
+                            typename field_type::value_type(0x2A4EBD1072842B788EA22727C676CCE2BDB6FAAC56C69C28C3E694AA63E45227_cppui255),
+                            typename field_type::value_type(0x49B857654A0E51927BCBBD26FD2DD718C3C8D1D196A56EC950806104EF23A7EA_cppui255),
+                            typename field_type::value_type(0x04892CFFF7F94FF7F07C1241E3AC4945BC46EA9D6A3C1C3ADBCE109A9AFCEB6A_cppui255),
+                            typename field_type::value_type(0x3AE2AA25E2555135A7A3251C11A3F8EEBE81758BC1C3E2CBC6E6CA461A543130_cppui255),
+                            typename field_type::value_type(0x60C497780D40C8B1BA4F5DC4A2262B84528083F770B07AF0FA76098A9F1048B4_cppui255),
+                            typename field_type::value_type(0x22FA44EE0EB502084F6CA208ED0757572FA5B25D76F30B5F733840C7086CB1D4_cppui255),
+                            typename field_type::value_type(0x7D7225DAFD9C43B59F53DE50A2232F2079FD512EC2CDC0401D094D528A5F7598_cppui255),
+                            typename field_type::value_type(0x63E030388D50AAFFA92EF62DDD0C7C6977336F22FF2EF9EDE19DB18D4EEBFB4E_cppui255),
+                            typename field_type::value_type(0x480D816072EB67BFB2AAA781FA5316978947E10DEB8B7F3165561904A63F000F_cppui255),
+                            typename field_type::value_type(0x552D0F1D6BDA43B57E73875B499952C016AF17AC436BAF671E5684A8CD33137E_cppui255),
+                            typename field_type::value_type(0x148A7D88B200DC224B62A923B9F58C9E323F4767053E57CBEB3B3F7E95221DA8_cppui255),
+                            typename field_type::value_type(0x4F4F0B1A20843403C646345BE083DA0F8F802AF55314659E2B1ADFEAD4E889B4_cppui255),
+                            typename field_type::value_type(0x130130D18B59CA9D78A8DD09FCF85F147E1975A56930E1CB1C933F84FF1F58E9_cppui255),
+                            typename field_type::value_type(0x29C224FB2DB0A7452B55D9DCEFFE465A8911D9D59C7059007099894BC50376FF_cppui255),
+                            typename field_type::value_type(0x36C2E3FA23DB337FCB93FBE309F54F2EF651BD54BB708FD5C9F838D46484879B_cppui255),
+                            typename field_type::value_type(0x0C5C488542844D3587D1934428EF0EB27C2F08A72787757C7DE13CE53EEB864D_cppui255),
+                            typename field_type::value_type(0x378E98824A6BC4F1F82D26F746906680086CABA8F7E0902B97C482AC0BF80638_cppui255),
+                            typename field_type::value_type(0x114214780D621D31B86D6E60FE7B92C48EA22834753D0AE01BB23FD4B8EEB48E_cppui255),
+                            typename field_type::value_type(0x2401D311A3ABFD2583F1C6AA519C1F18FF730A0ABF730DDCC9C9739B04D8A85E_cppui255),
+                            typename field_type::value_type(0x653224F3488CAE1AE19A414A9932035A2BF2C46803B5532BBB645E62387EE34D_cppui255),
+                            typename field_type::value_type(0x72964D278E0326E84801F12BFB0C0CB1EDBF8BEDF273E5B2B3F4EA8C3AADDDE8_cppui255),
+                            typename field_type::value_type(0x0EB4ACE1C6B7220C4211BB023C76443304C2263BA1D49CF27C4D26C9603B09C8_cppui255),
+                            typename field_type::value_type(0x4D432DEFB596B961EC8816F8A185625D6B542A7A7BE05ABFFC3067DEEFE7856F_cppui255),
+                            typename field_type::value_type(0x0C21C6405735C827084F1D1D57207F989769E9D8D1774780FF6CCFE4CC33317C_cppui255),
+                            typename field_type::value_type(0x5AA06A8B5DDB350D8C58306257ECBF219D0070CAA4F986C78FDF8E42FA9B8ED2_cppui255),
+                            typename field_type::value_type(0x7920277CEC6D1E37A5F267D8FCE232DFE38BF858973B895F2611DD200D7C58C1_cppui255),
+                            typename field_type::value_type(0x28939B072BD797553A714E5746F15DF65F1F4B9D90A3544D635550489174F306_cppui255),
+                            typename field_type::value_type(0x3CB9E38EFB1C2D4A7B6D2074F1CFC17E2F94B4C79E15C4F147E4A3A6D0464739_cppui255),
+                            typename field_type::value_type(0x019016D685CEF788DF023844B82B582ABB4500BE85DF80E1D2B24785586ED548_cppui255),
+                            typename field_type::value_type(0x7EB956EE0AB30C89F95CCB01AB0F5EDF02BB2315549812914D987350DE91D3E0_cppui255),
+                            typename field_type::value_type(0x35C57DAF7D76959225427DD6BA19325A01C0BAAFEE18265407BB316C55E0F8DF_cppui255),
+                            typename field_type::value_type(0x471CC91DCFE02C56B838DB27D74F9D93D019D03DC57C832DCDB435C18D436FBC_cppui255),
+                            typename field_type::value_type(0x0EBB89EFA79E3B56B75663D950362C441440CE1425792CF196234595FAC0E9D0_cppui255),
+                            typename field_type::value_type(0x0E5F7B80005248F80DA7D738DF4C11A70F30018D74E871780A1C82CC0ADC7FCE_cppui255),
+                            typename field_type::value_type(0x0EA2C846A535A115972161612A192588D92D68A3C9050EAE91B2817B94E68325_cppui255),
+                            typename field_type::value_type(0x3B82A8337B05F11BBAC176A113BE183A50A0331F3D3116F24B971B5A8B0D031B_cppui255),
+                            typename field_type::value_type(0x561D2C1D673A0E91876DAD49D7C6A6C6DDC4068445226D2A0E777DBCD25C5F3D_cppui255),
+                            typename field_type::value_type(0x2DAC09925D76226BDC776A3309CCECEC6DE6692370DBD0DE19E5D2D4CF747AFE_cppui255),
+                            typename field_type::value_type(0x70231A092565F0C7B906E37B3A2987D2B2D01CF9EFDE53F402C033C6E4AD2AF6_cppui255),
+                            typename field_type::value_type(0x1DF8DC634575BB9652A7C14BADF523565C5B6AE551176EE1A4610642C985A6C2_cppui255),
+                            typename field_type::value_type(0x140B6F1E4BAD46896617DBBC2D4B1BEDACCE412CAB91F0015E12DBD3EB171523_cppui255),
+                            typename field_type::value_type(0x444EB3598CCAFF53DC272B0ED8D7543E1270B04A5DA34F1822482D77B6BFCE11_cppui255),
+                            typename field_type::value_type(0x34BD49EDFA2DD7B810CA6BAE43163DFF4F4F945D01075475545652250AB38365_cppui255),
+                            typename field_type::value_type(0x73FEAA96BBE61E5E37897C4DEE6D4C8EEB3D675A060E0B678D1A217EDFD34C25_cppui255),
+                            typename field_type::value_type(0x70D99008FFCB5D61AE39921364A5A374810CD0E2157FE6F0BB5A8E8A83744EB5_cppui255),
+                            typename field_type::value_type(0x56B125243A0695932E329AF9219F827103983B62141DF7E8BC8EC54E726C32B9_cppui255),
+                            typename field_type::value_type(0x7B50476B0A33709BF8DD3260CBF7F16C2D41E6051131BA9CA3F3ABC449A3D1A4_cppui255),
+                            typename field_type::value_type(0x2448C3EC7026FD42509D9012A2F18623B4DDC9D21D8BDF5E57B12A1E8BAA33CC_cppui255),
+                            typename field_type::value_type(0x0A9FCF41F6EF7CCB545E615E1335443229A1822845ECC07E3921B2660F617607_cppui255),
+                            typename field_type::value_type(0x732FB4FAED1673A8D23B79B5AB9356C18C586F395D96D2249F8AE6C384DAF9DD_cppui255),
+                            typename field_type::value_type(0x0FB3F87C2C6C89C65B74299B77F3736546A8B9E41B19197476BFF27354E1C128_cppui255),
+                            typename field_type::value_type(0x1034D42C15A2BFE3E682FAD49DBC2812CAADF0C584BC30B51625B85D74E9D5F7_cppui255),
+                            typename field_type::value_type(0x7B6A55657786383D359C5B5F2F6CC814790F8527D9D67F6C67A5310EBA46B161_cppui255),
+                            typename field_type::value_type(0x0CB7ACEA0EAC739A61D526F6EDDB857114A32D8F09995826F1431B60663AB0D3_cppui255),
+                            typename field_type::value_type(0x05FF834D7F1A770A34FBEBB2708EFD737A71CACAC0F020F5698AB4666BA7DAEB_cppui255),
+                            typename field_type::value_type(0x3BCED52948988B4DFBD561CD9D6A8BE02E016F755B68581436E53206A44223E8_cppui255),
+                            typename field_type::value_type(0x5AD25870B2C161C671B014F548BFD24114E54BAC5C675F43E79F100E17E5F45E_cppui255),
+                            typename field_type::value_type(0x65C775EDCB82B0B26040F9F5ED43F8ED61BA00427FC92B50BDDC94920716BA2D_cppui255),
+                            typename field_type::value_type(0x32354220DB5726D33E67521A7397C317336034AE1213656693314A75A86D88BC_cppui255),
+                            typename field_type::value_type(0x4CEA7E04F510340C45E1763FF3458543E8ACB06C6911D5511A776C6A80D95267_cppui255),
+                            typename field_type::value_type(0x535864A2CE9FE8CE7F6C68EDE846C47853FB56BE667E3467A639A740090DBA80_cppui255),
+                            typename field_type::value_type(0x0988C3B9B733366FFD8A97C0D5E2153B89C12DAC2B7343E23321597BC2A9C1E8_cppui255),
+                            typename field_type::value_type(0x10421296CC4B00DF0BB59988584ED1BD31E3719EA203668D1AC3B949CDB61D31_cppui255),
+                            typename field_type::value_type(0x59E6C0C278A93583B44C31A8523F83601FCF76AB7D074E500E97633D293E2C8B_cppui255),
+                            typename field_type::value_type(0x3F18362FF22F583B16D40DA2F5E67645EF65016E5183A44475B3AE5C3056B6D0_cppui255),
+                            typename field_type::value_type(0x5CFC7A0F0D2FEC43237B88EFC4FB7E9F0A95B6352BD4CAA918C58C1E9BE02FFD_cppui255),
+                            typename field_type::value_type(0x1BC7AF1E38185E7C2D8D04371C7E177D7A9DDEE1B81D7D26DB7AD644C7DAD28D_cppui255),
+                            typename field_type::value_type(0x61D909D855661F2F7A5EEF87795DC0491D027E12631B270FCAF2F65900314833_cppui255),
+                            typename field_type::value_type(0x06BCE245F8C2596BD228355A6BB8A3D9F2FA8975D8DAA7D00799938218028354_cppui255),
+                            typename field_type::value_type(0x3D26989CDD0F6DA0C92ACD2F10754858C2C9418B0DE8789496FC955188A3C065_cppui255),
+                            typename field_type::value_type(0x7665908AAF4445EF643C3AC9C27FFCB40CB0EF0EB7DD6EEE7EBD89041B29662F_cppui255),
+                            typename field_type::value_type(0x4ED18A7C50DA4546CE17F8064F02B40965221938B8AFA4137083A00E4B704CA1_cppui255),
+                            typename field_type::value_type(0x0A09B36EB5A04AA90834F3F33BA4E630E5345CFE522B910F5D9D954E6C16D4F7_cppui255),
+                            typename field_type::value_type(0x3AA47FD60FA3110A24B6EB2BAEED533D06CE9EE4D4373B20F3A2EB0FA35ED926_cppui255),
+                            typename field_type::value_type(0x1C71CE37638E6D6A80C8B5A8BF5649860BA162D2BA6E7D20919CD5451113735E_cppui255),
+                            typename field_type::value_type(0x7880CC1C2003B2CD243DBAD79AA0CFB7D40D183F447A972CE3E8FEE129E406CB_cppui255),
+                            typename field_type::value_type(0x3C607A84C1DF2F7D897A82F895C2CFE5120E79446C852CB1931B9E7F74CBC8D6_cppui255),
+                            typename field_type::value_type(0x34518AD109941A3A2384BAB489DBEE184987E0A1731A060CEA779A86BA3CEA68_cppui255),
+                            typename field_type::value_type(0x089B6CD02000BC663FF938DD616EF7F13A17FC66A638E39C310AF417FFBE2DA0_cppui255),
+                            typename field_type::value_type(0x66EF7206AA36DFD8B438DEFD11CA657E43CBE4A7CDBB12A3E78816F13E8CEB88_cppui255),
+                            typename field_type::value_type(0x079E9D5B60917D60F87AB5434677906D2B72862D87067A522E1EB2D6FC2C9FDB_cppui255),
+                            typename field_type::value_type(0x16512951D2240A453126CA9450BFA225640064FCA385C7583901381C04C78797_cppui255),
+                            typename field_type::value_type(0x469D0960DBD0EF9C91C4597CCF7C209549B187FF63BD378B7DAC577198D74A4D_cppui255),
+                            typename field_type::value_type(0x0B5F21C7F86832241F2157C288BDC9394F83F8D57457F6D9F6B345E4909478CB_cppui255),
+                            typename field_type::value_type(0x5911ADE9998930A4CEB0B66EB93D7E9E4D94CA0A3AE3F095C5C4FFA156776792_cppui255),
+                            typename field_type::value_type(0x063AD2432A173E9DF4056A370DB21B2625D68AD21C0030BBA5B75F6FA19548F6_cppui255),
+                            typename field_type::value_type(0x783B5405BD8FC2B6059982D06BEDC64000A03EF52EC42DACB9BAA903E00BFDDD_cppui255),
+                            typename field_type::value_type(0x26E84CC1C09041D6CA408E5CD8859953812373D6C59101BF36F34AC5EBBE068D_cppui255),
+                            typename field_type::value_type(0x10B304FF67577ECB1C73A3E405D39A64B2D4F9DD4CB4BD16A9F3729AD1939932_cppui255),
+                            typename field_type::value_type(0x13B7FAA0F91CC1419BB0E7CCCD85E369D9EC65AAA934AFB423616DD0ADA44BB9_cppui255),
+                            typename field_type::value_type(0x44F735AAFD475D4CF098649109F40AF5E8CDCE755ED42BA0C7769B70253D502F_cppui255),
+                            typename field_type::value_type(0x41C6DB4AC7BF837D0EACC09ACC15F3E64B0D8F98AA5FFADAD798CAB9141566A0_cppui255),
+                            typename field_type::value_type(0x117D2478926A8A76040FB55FC4CE96A4A5D80B35603953F7D9604B434A55190C_cppui255),
+                            typename field_type::value_type(0x1B4D73B3CDF13B783076A7BF5771F6098E3F463147C6A6EE0EA29CC6F7DE8368_cppui255),
+                            typename field_type::value_type(0x6E8641BC34BBF671E21CA8C4F4D086BF1AC188A3A8CF509A8E4DE1A2D65E04B1_cppui255),
+                            typename field_type::value_type(0x3BC15C3546F5B7F27089722B9CC1AD26BCC6DFFB6D66F8C45E849B5EA7CC02A6_cppui255),
+                            typename field_type::value_type(0x1B795D9BE8DEC6DD3617F3F9BC33C580DEBBC3CC19064F515209D00C3C88FD04_cppui255),
+                            typename field_type::value_type(0x6C87F61B675C50C01E862A53CFBA384BAEFB8F95079B71087950AD5751BE0A65_cppui255),
+                            typename field_type::value_type(0x5E9AC4AB2F4A3C3526E1317F913D69E3826FE862EFD0C80D9310319170C5CBEB_cppui255),
+                            typename field_type::value_type(0x505F00FA8AEE03CCBD2F33529AE1E4E4BCF2644FE673D0B0290EC32BE5B51BAB_cppui255),
+                            typename field_type::value_type(0x2E5C4EF1A12730A9788953B5079A1184A9A237B9E281F0317514B53D220DDBF6_cppui255),
+                            typename field_type::value_type(0x5C1731365512A3965C5D5474A84E994EE44AFE8CB7FF403517CBDC4DFB54008B_cppui255),
+                            typename field_type::value_type(0x0E2606A00097A415AAE791B2311244CF33136B90A93AA9FD236C1F5395C68F4B_cppui255),
+                            typename field_type::value_type(0x2DDA446C4A628F1CB38FAD43D13B649B6B2B9D883B97A9890AD150DBC87749C3_cppui255),
+                            typename field_type::value_type(0x4C6C9A0E8A4EF16E4B55B6EB2E728CF2AFEF2D38877D5CE8770FF2867BEF24CE_cppui255),
+                            typename field_type::value_type(0x26D5711EE5A1E88273BE70D6D8B9054CC5ED2581668D5CA83EB74FD1C286EA25_cppui255),
+                            typename field_type::value_type(0x6A73B1E2A603E5FDE97EB6040168EC42F0699CC8829997F59CED5142C59D25F5_cppui255),
+                            typename field_type::value_type(0x6EA5CCC1EFDB4511057187354B075EB5FD814EBEBC00F19B915C3F6EBCFAFFCD_cppui255),
+                            typename field_type::value_type(0x728A71912CF9FF30CEC3335C38712A0186DC63F7F7167EA22645224FA7C36D4E_cppui255),
+                            typename field_type::value_type(0x4CE95D59305CDA0F62DD69C1A39357C7D2FF5E9AC64584F38FC923D52809448C_cppui255),
+                            typename field_type::value_type(0x5CA076F131F17330B476512BD0C5B4DB4D34765A46B672DC794544CB218AF30C_cppui255),
+                            typename field_type::value_type(0x314D831F8052D08837917B9EE34CEA2D110DB638BD1859D0D33C4971A4EBF223_cppui255),
+                            typename field_type::value_type(0x599BA21B65FFB36CF3151C6E8662AA6C8B35948435819669D60CD77227507E92_cppui255),
+                            typename field_type::value_type(0x07F59B350F668C2B6797E53F3FCDF6DDD497CA01445F6E3BBBFA50C48865A9E2_cppui255),
+                            typename field_type::value_type(0x11CD80E1FDCBC565EFED81D17F3F54643FFEED1CFF38F3825E115ADBD82759F1_cppui255),
+                            typename field_type::value_type(0x43F11943F7EF3FA68B980FEE45E98134F1DF22263B2D14419D61FFE62822DBE0_cppui255),
+                            typename field_type::value_type(0x068C33D8F33219A980EF7A4A10EDCD58B0D2314D3C8CE301B6C0DE50A100F3EE_cppui255),
+                            typename field_type::value_type(0x1032A93593881DA4DE11EEDF679416B57135344CF9061C393B12D830FF4F7DCB_cppui255),
+                            typename field_type::value_type(0x4847BABBF5A03D4DEC64DA934B5B6F3864AB0B3ABAE52FC9F9B2FC5C7BBCC3E9_cppui255),
+                            typename field_type::value_type(0x7E6FFE114A422C24512ECDD666E79A306754774F9997E676703BA2231F45BC60_cppui255),
+                            typename field_type::value_type(0x1EAC17C83EC7972FE82321BF2C4E6AA73565BE5CEF720AA9930C6FA3F0B1C087_cppui255),
+                            typename field_type::value_type(0x0419A160079A825B1B3C51E57C6E5A257A86757C7A97BDD6DC1ECC40E521EF7B_cppui255),
+                            typename field_type::value_type(0x7DDAF40ADA2C85053C653732422999AD71079B8153654AC237F085B7D9BD4F36_cppui255),
+                            typename field_type::value_type(0x44F594D1CDEF9C8D702CE7C578A9BF67D49E0DEF9E3F6CAF57EF3DC222370568_cppui255),
+                            typename field_type::value_type(0x39D5A04586D7398642565662F053CCF67F2A273D043B372C6AA7BE1DA7AF1F38_cppui255),
+                            typename field_type::value_type(0x2E986C4A9A9382DFBF6C9F59EC5DBECA11D02546D71DB1D22D85AFFC5B1121F7_cppui255),
+                            typename field_type::value_type(0x1B595D7292017131068B5B4F2AC40CCC53BB43CE3779353A403079B0706D2AC3_cppui255),
+                            typename field_type::value_type(0x2D515B166A907DE8E2181853F45D29E7ACE75CDC89D85337390B63CFAA41C09C_cppui255),
+                            typename field_type::value_type(0x4EE45AD6672F7B5DCE99D4F64C57742640FEB26AE734FEF8493AE38FABA68896_cppui255),
+                            typename field_type::value_type(0x7041A7FE4FACB6C6904101F856FBFF5B2BB15C7DC602A4936AF62555BDB3825C_cppui255),
+                            typename field_type::value_type(0x3328BC121616A9477165ED282053D203C24F4826076C638A2C6723D42C9BFADB_cppui255),
+                            typename field_type::value_type(0x2BBF3F26C21B5CB273E5F4F0114C6718C5EB7291939B7697C74333CDFAFAC039_cppui255),
+                            typename field_type::value_type(0x3646A62AD82BD1F37A32412D71C1DE8314637EEA177267A0A5176FC37C90A733_cppui255),
+                            typename field_type::value_type(0x24DD06031FDAA9E8E94D73ADC700CA86DA20EA738F7DD05C088BB8F97C6BCCAC_cppui255),
+                            typename field_type::value_type(0x65A10FF6A067CB76B0B02AF443C57243E6E78FA83379224172F3143712372646_cppui255),
+                            typename field_type::value_type(0x3607014F6A64ECBE1CBC8F1E297EECC6B94B13509C41E5D55EA669777C684D1B_cppui255),
+                            typename field_type::value_type(0x3C0C1E7BEB87A53457A69C0F5985DCBEE21E0ACB65ACA9EED7A52A980A61B29C_cppui255),
+                            typename field_type::value_type(0x74E826B2F1347631922C45546E2F1973FF349A34C6939E4BF0A0B50D6384BD2F_cppui255),
+                            typename field_type::value_type(0x579AC4B5218480A533397A94F4D3103725E654D0A8A53C31642748FE1A825C77_cppui255),
+                            typename field_type::value_type(0x62BFB93D6971CAFCEE57119862FC77423E0A1CB064FA2D095AE2B413D28A281D_cppui255),
+                            typename field_type::value_type(0x61EEE376F0DC885C9E95A047434C8072D23E2A4DF019163A72119EAF801C2154_cppui255),
+                            typename field_type::value_type(0x1F2ABF8D3ED6EC53F47428C9C745E01B8AAF781928F25CB833A97EFBF8B38931_cppui255),
+                            typename field_type::value_type(0x3D12191C75243C03D0861AC632E434B3E88C30E657B6ACE19257114D8A25906C_cppui255),
+                            typename field_type::value_type(0x467965880E34C78BC99B4E3C57EB5E3CC07FB918632C5FDBC5C44E5E9ACDFE83_cppui255),
+                            typename field_type::value_type(0x53B1CDFE23ED553C0443B14BBBA2119B58CD8C555EA7BDE6C0CC4C0C6D90670A_cppui255),
+                            typename field_type::value_type(0x5CA6DF45AD9630E4B8D5732BD06E5008A2677A342904FC587238AF01F575FB05_cppui255),
+                            typename field_type::value_type(0x0BA774BB605DD804CAE6887E81F6BD2C59E024FAC8BF5F5C48A841A037C28398_cppui255),
+                            typename field_type::value_type(0x54BA013AD2D04DCDFB5A151B7347EE9A10067DDD0A3907E9BC337A77BF911321_cppui255),
+                            typename field_type::value_type(0x6E6B14DF76458C45466BEF23B9377CF147C97C495E8207A0436A200B4A39D548_cppui255),
+                            typename field_type::value_type(0x30F3B35DC952BA9D6B5FDE2D131AB9B5B403F2583A7C2D8ADA37764C29CAC942_cppui255),
+                            typename field_type::value_type(0x6801C75B1A97E1AB7966DD463B6EE8EA6B0A5725745EDBD22A6237215A89114E_cppui255),
+                            typename field_type::value_type(0x43C48EDACE257242B8676374E08DA435B79CB7ED7FA4FC375448C57907F7AA57_cppui255),
+                            typename field_type::value_type(0x496490AF4080FEEB8E38F78E769308B124EDC07985B1EF7148D7620C6BFE6F4C_cppui255),
+                            typename field_type::value_type(0x7F6410727B65CAFA07E53AB1E775EF0408CD5F12B94BDB4E533C4498C1DA884A_cppui255),
+                            typename field_type::value_type(0x2AA4BC7D1D25FE0A4BC20190D29851C07161FCFA3F9E5282ADA13AB1D4233B6B_cppui255),
+                            typename field_type::value_type(0x1A91D65A2E22B33D4B167E6F414D5A8BD8F69514834B2769FC034E95BF1A6A51_cppui255),
+                            typename field_type::value_type(0x46B5F1C51F08E185998EE9456D33BB90EE8A2C20FB1A7C8D3358FD16EBF0813D_cppui255),
+                            typename field_type::value_type(0x20CB1DC94E7A0EE331FE96EC351174EDB8BDCEE63DAE17BA062B3FA04B43E7E4_cppui255),
+                            typename field_type::value_type(0x6A39B751F1562DAEBF6B1E9108A8FB08E3C775BCB7932D1393D559F33DF34B15_cppui255),
+                            typename field_type::value_type(0x727298B3E04D0380DBF9F7A5DAE53CC8859ADA6DFEC3ED5A194E9CE7AA3009A3_cppui255),
+                            typename field_type::value_type(0x075BF0EA1FB606D05DD67E0F313809AC9792DC903159D032B05C96DB7BE967E0_cppui255),
+                            typename field_type::value_type(0x43BA373488C317AAD659043F9BCA4C85D9B081903E7767143522416BDEC79F81_cppui255),
+                            typename field_type::value_type(0x1074FF0267662DC2B4CE65AAA0229C375A3D0D843CE9349233949581C869B64C_cppui255),
+                            typename field_type::value_type(0x299BE0DECB680EC28923DA4D049770107D42C180B460DA13A7B1EFC7E6D5B022_cppui255),
+                            typename field_type::value_type(0x3E63C4AE42121958F28E78E557E827A108156A81CC8B5C64362E2B362A42FE33_cppui255),
+                            typename field_type::value_type(0x3599286AAC87E88C8C857059A5EDBAC1265BC15C047CB18502AE80CAA79C9678_cppui255),
+                            typename field_type::value_type(0x1EADE2FA113B19D45106B3018D462EFB62E3E4CD9FDE382880DA87BE2808049F_cppui255),
+                            typename field_type::value_type(0x6CC8D8212E6CCA64A97C8D6D8055434354879C85B780644E70A3AE0A699920A0_cppui255),
+                            typename field_type::value_type(0x31DDFFCB76711DD76C6B48540967AB52CEB13E466FC3B2A44FC17508AD074A91_cppui255),
+                            typename field_type::value_type(0x221C9B9A258E4D271A0176119764072E484A3895D0508874076F36F0FDFA8836_cppui255),
+                            typename field_type::value_type(0x4AF6009911D4F531A9FF4CFB6949F6E0BECB4C0C8D61C0A9539DD57CCF82CD76_cppui255),
+                            typename field_type::value_type(0x1EA69BF6F0EE10457E3ED9EC0A54FA577C695E93A320CB086FE9A6E40365167C_cppui255),
+                            typename field_type::value_type(0x1ED4BFCC333A75F7FA18B2FABED6F3FD969279B611D11B8DE6B7A92BD11BBA55_cppui255),
+                            typename field_type::value_type(0x73D969F556BE73A2317109388E0A18C9F9A0FF26B34B97818CC3506E47909A5F_cppui255),
+                            typename field_type::value_type(0x3A4BA693D760AE2BC9A2C8E4241F9ED15C258B50162A3665C333683FCBA71031_cppui255),
+                            typename field_type::value_type(0x438B99022FC522FD174DBCBA6422821762BA1D0120AA1FF9790F961EF3ECBB5D_cppui255),
+                            typename field_type::value_type(0x6B265507695B3CB34C25CC44A95DD559EC0245102BAD71A3765EAC0F0EBD57BE_cppui255),
+                            typename field_type::value_type(0x3F7F093597ACEBFDCA9D151E67D5802B991DD62F822A757AF9E32951A7D46B30_cppui255),
+                            typename field_type::value_type(0x25ED76D78C87C3BD64B4331902C5A853734283E25F19F320295667B80A340D35_cppui255),
+                            typename field_type::value_type(0x179B5F92F545C7B326B3A63FB0B32A0F52B4159988436D5AF50C1D0D76373947_cppui255),
+                            typename field_type::value_type(0x71880463417E760ECB72E31789BDB017139AAF83EAF20FC20E423BAFA442B92C_cppui255),
+                            typename field_type::value_type(0x7BE598F9DE5BD5DC434F938EFD89E30D39E02CF1BF657054EE9FDD5786387875_cppui255),
+                            typename field_type::value_type(0x5A74CA175153C9E7D482BE47618664046798180DABF8DE437BA660090CBF61D9_cppui255),
+                            typename field_type::value_type(0x2CED7DA6BCDB6671BFD5F2E3B5B83AE282E89A121BAF2E1DB8160271196229A1_cppui255),
+                            typename field_type::value_type(0x76DB1D03F26FE3E7DD73951D7A58ABD8B6C1779E5C6F129463F2B2DF11653BE7_cppui255),
+                            typename field_type::value_type(0x24B91BA65C06F1DF0B18D1030726681714E1EBBD27BEA55A5ABC1B522C4E06AE_cppui255),
+                            typename field_type::value_type(0x18C4298EFDA7A7CDCBF6F7DEDA80FE046D7B5AD2B8FA9053550F5519106A1039_cppui255),
+                            typename field_type::value_type(0x2E5A2E070293B75BA8135245661F1D65FD0CEC4CF937F21D97D06E423860CE08_cppui255),
+                            typename field_type::value_type(0x2D456C2A45F5CB27A987D8CB8736FAF182E651BA04C67E92E3086ECDECB75B26_cppui255),
+                            typename field_type::value_type(0x4B04E7B34D3500D86B01999A6355249371A057CB87DE9C60ECE52E112E7A5E3E_cppui255),
+                            typename field_type::value_type(0x1918186A5F3D76324EB22F2A4FED703DCC01446ADBD2D60EB49415B46DEE3D70_cppui255),
+                            typename field_type::value_type(0x76BB693DB2687FCCFC4434B9B6765DEA3390FB88E01929503617FD1D0BF30BF5_cppui255),
+                            typename field_type::value_type(0x3D09F11B74381D32B6407D2F5F3305C5B6ECC5ED60B48431878C480E138066C5_cppui255),
+                            typename field_type::value_type(0x45F4A22FF69FC1DACBF100959BAB8026AF793C58551855753634F88DBC8269D4_cppui255),
+                            typename field_type::value_type(0x75D942C04210DCDE5D1BD4FABFC732D3F95568E399382C0423C83C41CB05DC3F_cppui255),
+                            typename field_type::value_type(0x696CC14856CDC13C8FD7E2C5771731CBF38E3FAD47A424679765C4874E35AB2D_cppui255),
+                            typename field_type::value_type(0x6D12E0DD1CD8BD76AD5A191A61920FD4A3C317245E8BB210DF90A57B885FAE14_cppui255),
+                            typename field_type::value_type(0x0D5C9E4B74FDE7802A0B836724057A5B810F20F7DAC4675A4D24A3028F70BD8E_cppui255),
+                            typename field_type::value_type(0x7D04264E36E8889EC5D591851013B99F3FA909B44E6B6D1C823B9F2D199B0017_cppui255),
+                            typename field_type::value_type(0x6CC9F269424B827F9C777978A9A333FABC278F15BF93FD8DE1A3319AE930F866_cppui255),
+                            typename field_type::value_type(0x16C1556C9A2BC1AF0B11CF369581A12D063081AD20F83407E1EBFBA21F5FD594_cppui255),
+                            typename field_type::value_type(0x23E38CD5158B0F891E19ADEBE973B5B805B393DEB8CF11D7281335745EF14F36_cppui255),
+                            typename field_type::value_type(0x1723BCB3E1D150C695796BFCE98ED8D56CEBA30DAA119302DB211AF2B10518F5_cppui255),
+                            typename field_type::value_type(0x5D4BA682E08EBB23403980DB0C7EBD78AAF775FB480250F556E689807682B3EA_cppui255),
+                            typename field_type::value_type(0x456BDF4C7423EB00E4455B4A695E9574304FBFC4AAA7A01593570FE618E77933_cppui255),
+                            typename field_type::value_type(0x579782C36C68E87C2BB0378EE474638079C7D097349B5C29C0DD0B42C46C2997_cppui255),
+                            typename field_type::value_type(0x2269A46CDF0AA2113B456BBB165D9E458D4588A83AB75CF5852EA339F4412193_cppui255),
+                            typename field_type::value_type(0x489CF3771FA997F21B8A11D9D82E1FA1CEA1E03841FFDFC027B68F85514C514E_cppui255),
+                            typename field_type::value_type(0x66E632DB15CC9B7695E73E2B94033B8D25FCA89B99EF5E24436B804BB683BE22_cppui255),
+                            typename field_type::value_type(0x534E3C9C194CCCC190FFEA06F048E7A6F65E6D5C7EF6074693FAD6A6134AF084_cppui255),
+                            typename field_type::value_type(0x5D9324F56975477D5945599EEECCEC67708C996CD3F3F2818BF2591507E3502A_cppui255),
+                            typename field_type::value_type(0x10985A3CFD573205281AEC24E2C8B41F5CD8CDFC9D7BE34675CF306BBE1B4F6A_cppui255),
+                            typename field_type::value_type(0x3C08B09976FA5B99270E861A71C0AB1FE4D91E80E522CED3E19AC2D830F7DBA3_cppui255),
+                            typename field_type::value_type(0x30A2BA28DFD74083DE7AA9ECB4443A3773366ABD33D1D1EEA65D6A1B85D2932A_cppui255),
+                            typename field_type::value_type(0x43A376DE4357D8931F91D1789B3663B0947C8AFCC9CA7C8D15F39F3F056DB5D3_cppui255),
+                            typename field_type::value_type(0x111B64ACD86AA4E1F7BF7AC4537E087F708F2F45E9702816BB1E323DA9E2359B_cppui255),
+                            typename field_type::value_type(0x27D83B61339890B9C8FBD00CB8657E01E08FE7E02CF1CC0C991F3E184647EBB2_cppui255),
+                            typename field_type::value_type(0x2AA089AF71E21DC6264ED78EEBEECAB46C08C7E4C593C801AB744B503A72BEA0_cppui255),
+                            typename field_type::value_type(0x218BABBF360A8AE4EB37A04AFBB6267DB429CBD6D9F160E77570915F917975D6_cppui255),
+                            typename field_type::value_type(0x45D5415AC167B4AE65CD81CF98CBC215045DFCD7FC8FF3AF49E7A390AC68E6ED_cppui255),
+                            typename field_type::value_type(0x5004CC1A512B71B70FB3B42C1D75C285F30ACDBF60F953E7BF5E3B1CAB57EC26_cppui255),
+                            typename field_type::value_type(0x0BF99D9ED24E9A41BB82F153E9ED00173FC23274B5C9FEA0F276F994211D19BB_cppui255),
+                            typename field_type::value_type(0x4342C43B3CC06B8504D1FB5E4D23317305A6BE2C10D128CCCB3F290D430CA902_cppui255),
+                            typename field_type::value_type(0x76F49A3D9F6CE7A6AD8F6ADBE45488D326913FD03E8A1DB18C35E05AA49D4FED_cppui255),
+                            typename field_type::value_type(0x4676D3812CC6B66E1F8C510F446AC562FF8A52086D52067482FAA8DBDEE40B98_cppui255),
+                            typename field_type::value_type(0x7D89E2B7744C57B1051450A0457FA0EB2A95C1BF8ED6BDF68F1AA7802E7429F4_cppui255),
+                            typename field_type::value_type(0x7511066C0E12105A7B937C7ECEF367D5AFE6E621E5CABF4E490B09B7ADA7EE07_cppui255),
+                            typename field_type::value_type(0x604DF365B8391CBCA8848F88DAA700B770DA5BB136F70BFB0A3EA33BA386FCD5_cppui255),
+                            typename field_type::value_type(0x668D5960C0B43B91185FC90D18AD46A4515235C7185BD5254981D26AE8619807_cppui255),
+                            typename field_type::value_type(0x7A66F757C21900B1E93C86E682114DE2B5D3A248850958D957AE246E53791B03_cppui255),
+                            typename field_type::value_type(0x158AF2B74882820FE0D48C352012A9C0E72508F00F08B496B362D8352E175264_cppui255),
+                            typename field_type::value_type(0x627E7CD734B0381D7D75CFFA833AEED64D2E0228CD3795254C72530BD1561746_cppui255),
+                            typename field_type::value_type(0x5089C58085E74644F85E2D03EF0759218DFF976D9E8DB4CA9F9522D70389E30F_cppui255),
+                            typename field_type::value_type(0x50CAB959CB2B604196FA7AB73094347BADCB954EC320FA01522986248653D88B_cppui255),
+                            typename field_type::value_type(0x7D5F6473E7C2F3943B367CEC6DE48D986DC0CEA56B0F6CFF9B5940ABDE7555F6_cppui255),
+                            typename field_type::value_type(0x3C49C73BC2BA82E625B27D7D595063F58544F85577B49BE10061179993DF2540_cppui255),
+                            typename field_type::value_type(0x5DDE3F530354C53C981DDBF84741EC31FEE533B10F88B9DA312A4E97E3F868A1_cppui255),
+                            typename field_type::value_type(0x759527498E0C4F3629C2C5CDEACE1048C641349374822F8AED2C84800427A7C8_cppui255),
+                            typename field_type::value_type(0x3D5A995A523D9D0503BD7090DA2084F7F34481462BCBB3FFDA87F4FBB4AA85B4_cppui255),
+                            typename field_type::value_type(0x706663D330B1D1A7534A73A725EB5D2BFFCD5F6AC4A613B190ECB566EDF58220_cppui255),
+                            typename field_type::value_type(0x0761AFFB1E0D408002CC427DC6FFF611536E2B989B0A5F94883A1B23789B5BC2_cppui255),
+                            typename field_type::value_type(0x3A6D110E6070153B7C42102C6DAC97695B4A45872CC47C04392EA170812FE6B0_cppui255),
+                            typename field_type::value_type(0x2596E5B3CF5494E60D2A750D03C66ABC2E0183AF53620B893F9CF9FC3B76DC26_cppui255),
+                            typename field_type::value_type(0x68A0A7AC9A0CC093884A6B84F45A2CDE595194E0F48DBD566FA78A3174B182FE_cppui255),
+                            typename field_type::value_type(0x249651CC143249F875C53D5AAC9CD3B818989387875C08C7AD104723C7D60D25_cppui255),
+                            typename field_type::value_type(0x028FDF17C15BB6B0C4DD06ABD210155B2BDECA64A5F02A6934F00437F05D9C65_cppui255),
+                            typename field_type::value_type(0x0A12DEAB65219D72F69C4E6C7DBDD46662895F17AE3F6198C3D34DD5C616E085_cppui255),
+                            typename field_type::value_type(0x53798A24DE9016BA3E997BB2D8F50214C7C0BDB72F1B5A5C295114C509531518_cppui255),
+                            typename field_type::value_type(0x0555439A0891500E49A25CCC1DC98FB600AD0F84600494322C44315CBF3D59BD_cppui255),
+                            typename field_type::value_type(0x5835C99533F44BCEFFFD61BC8926AF99AF9D0F669E428593EC19129BDF55935D_cppui255),
+                            typename field_type::value_type(0x604767086876592214D0CCF309616433DB612407566AB9F0DF85BF775B972B6B_cppui255),
+                            typename field_type::value_type(0x3A19A9AA7F5E5367AE7545375FD6DDFF484D59215F8ABFDFDC931D363FEB732E_cppui255),
+                            typename field_type::value_type(0x67AF872CB08F8BAA6E56849BA539A754602307E69AF9E257DCA744CBDAF95512_cppui255),
+                            typename field_type::value_type(0x0E934212A587570839FB11DC7A448E445D1FBA32494B007AA832F812B24CA900_cppui255),
+                            typename field_type::value_type(0x2FC81859C8E7F27A7924D6A161120EAD48E29E70A8B05F139BC23DC35C20750E_cppui255),
+                            typename field_type::value_type(0x519650677E82587D5CA07BA47A2BD4F1E7951094A40AFBBB727D81EC1D9FC534_cppui255),
+                            typename field_type::value_type(0x0DEC3676055D5DAFE7544EDD68B7A80CDA0443B311638B16A8AAD05972AEB417_cppui255),
+                            typename field_type::value_type(0x48FA8DC3A82049989F4CDCA7C6545513F02906FBC4C37D5B7457553832827C6D_cppui255),
+                            typename field_type::value_type(0x28BD38D44030DD9CA028B2A2F31A795F4C7A5E85A785DF7847E3D525E99D4787_cppui255),
+                            typename field_type::value_type(0x552DD7405C4183733AD3C4E7CCB999B4FED81B7A4444AAB499D41D6D78D5BBFC_cppui255),
+                            typename field_type::value_type(0x0EC8FE27A51E6F75D4197B4711B5F17D8FC023224426A7A17D3FDCE55F7BE126_cppui255),
+                            typename field_type::value_type(0x3DE83DAF93D8AA7F7675B8DF61C07B3C1CF8FE6B81327C3DB1ED2CEFAB3D11D3_cppui255),
+                            typename field_type::value_type(0x190BB443A02D3CD6DE2F5E1779B552A0EFFF52516904CEEF9B827EB68D4E5BFD_cppui255),
+                            typename field_type::value_type(0x5A601F556239715DC181F5303A8BB714A3E0F2F22FEA2D51189EF417484861C0_cppui255),
+                            typename field_type::value_type(0x393FB3D0B216D7A5F48DA1DBE2FAE37C1863636E599D725B0A4DDB6C768A89E5_cppui255),
+                            typename field_type::value_type(0x4E2107BC674405DA517BD3EF9605B5EF6BF72E94C7963A80241776F56C0960CE_cppui255),
+                            typename field_type::value_type(0x30D3831392A57AEEFB5EE5A2459E4D493D45A8933070387E8F0E9D00957C9907_cppui255),
+                            typename field_type::value_type(0x50E644A29BC8581CE7DC02008F6002EC89843FB2229E3AFB82EDCC64CFF559B9_cppui255),
+                            typename field_type::value_type(0x18B612324CCFB5F047AD256DC97F916CD76FCB9B9579F9EBDD1F3D7B00D6838C_cppui255),
+                            typename field_type::value_type(0x4B6DAFA36309CC7DD128036930B3D3617474F1760D0D1DA20553D75788F5A8BF_cppui255),
+                            typename field_type::value_type(0x6E847AF3AE32676A9CEA02217661091B33B24BFE6073C4B1D587B2ECA0B600C4_cppui255),
+                            typename field_type::value_type(0x362EA253BAEA269BC955B28365BBB4E83A6751CDEB917476E0D999F7A2182148_cppui255),
+                            typename field_type::value_type(0x1EDFF13D99073E0E6441DE58438FEB37C6E1EAA3103197EB7D22DEB9216F73E9_cppui255),
+                            typename field_type::value_type(0x2E42EB00CBC19262A6CAF1A51809D26674C878D718CD86A9E4E20617C243ADF8_cppui255),
+                            typename field_type::value_type(0x59233A3346F61135F431F96CF0197E24AD38240B222C010A6CE538CF4C24347B_cppui255),
+                            typename field_type::value_type(0x3CCE55908611D2B93F221613F09CFC4DBCD2E2B609233EEA5439AD1908A10B20_cppui255),
+                            typename field_type::value_type(0x4B82EBA78AF08DA395D2B48BF17F55F984D7991277777E29EC8E3C4AFDBFEA1A_cppui255),
+                            typename field_type::value_type(0x1437579645925F5D241C94C1C64C55C39F64033FF8234441E00ADEF63AF4282C_cppui255),
+                            typename field_type::value_type(0x21EBCDAFFD7C51DA7ED11D8CFE1B9042A0B7E0A974E6B4E07F0632622635E33B_cppui255),
+                            typename field_type::value_type(0x1975AADDB508A25A9769470957C93DA156E2AD45191614E8F5494201C30A5427_cppui255),
+                            typename field_type::value_type(0x1A2CD99D3D94ED5A186F69C4EBB16FB282A589F9237585A55BA076B96690CDC1_cppui255),
+                            typename field_type::value_type(0x4044BABE0B4DE497049F1A9E995AC6E6EF0BEDD2E822B0F8E037B70673E6B035_cppui255),
+                            typename field_type::value_type(0x0EA21D015E547D7333CE83B5D97B5A651C687135094BD536E958DDE3348BAD11_cppui255),
+                            typename field_type::value_type(0x48BC49F24F32FB1F95913C0AD89AB44170363DDEE14A66639A0535ACB84325B9_cppui255),
+                            typename field_type::value_type(0x731C295BF389B0DDBEA03B9BBB6C55E764036E0C1CE4A4DD3293A35F87C57EEB_cppui255),
+                            typename field_type::value_type(0x420AF866C950EB73830823963B5EC9607894B3D557F2E5943AEE8626E1C49AE2_cppui255),
+                            typename field_type::value_type(0x7DCA830010795B1535E6EBF43F628636318B89BAD13F525BADF3F2B196CB731E_cppui255),
+                            typename field_type::value_type(0x545C39F9B3C851D7AB5DE4083D9327EE05E6AB320A416BCFB0C3DE8B829F5202_cppui255),
+                            typename field_type::value_type(0x24497C51A639670F653076AA14EE826A4241D6B20A89886F54BB1F5F919656C1_cppui255),
+                            typename field_type::value_type(0x3B80F82901F17808A3D7A986367410548092CB5120DB4670D3750F11D178A335_cppui255),
+                            typename field_type::value_type(0x5830F025F1078D408948F73096AF97DE1E9E70B3BE85890ACB21132C34FF961F_cppui255),
+                            typename field_type::value_type(0x67D451752C2433FFE66E47242E301E56DB2B2F8203553CAB9DE717E25793D41E_cppui255),
+                            typename field_type::value_type(0x19929124AB5779C9A99E2D1716D8C07813132B29C69A3C1ED1F4E15DA1D9062B_cppui255),
+                            typename field_type::value_type(0x52C0CBEF541FE80C1E9B999483041E79950A13C4424073607D4975A69CA1FB69_cppui255),
+                            typename field_type::value_type(0x633198A5AF64EB253D99AB970C5962BDD15E0AEA2CC5BC27439B720F2C76158F_cppui255),
+                            typename field_type::value_type(0x0888E9E9DA049E768F20844740C28268F1EC273D0307CBBC4DC40DE64A7B0C18_cppui255),
+                            typename field_type::value_type(0x0849C9E6DA66D17BBF08DFDD339CF0C074ED671A2ED91DCF7A6A8737A1738914_cppui255),
+                            typename field_type::value_type(0x09F4DCBC5AE50392C92FAF402CC4F17A92573A80D42E5A4C21DE0AB0555EDDE9_cppui255),
+                            typename field_type::value_type(0x1DEB18E4D05B2CDDED11B25B88D03907396596ECDAFE8685C8A5CD31FD1E41BF_cppui255),
+                            typename field_type::value_type(0x4AC1D5C8CB78E44196A3F4BB6A0A807210348F2159FE69903A820912F604FD5F_cppui255),
+                            typename field_type::value_type(0x1E0990D03BCF64411334692CFFD1EFCDFD0C997E8FB4AD4A938086057C2BE1F3_cppui255),
+                            typename field_type::value_type(0x0EA9350F1881F5EA52C029B67D6284268CA29987345CAA15F4AA45E680D6459D_cppui255),
+                            typename field_type::value_type(0x1CB7A40C1D8D48C456FD58D2486DE95C65763A1EA5574C60F22BD3FB9791B943_cppui255),
+                            typename field_type::value_type(0x2835019689BE911D2041A2A561CCECC3137A695249ACCE48383EDBAEC67EF776_cppui255),
+                            typename field_type::value_type(0x03DEC05FA937ADB1796E9D70E892AE0F4636B0B2F1E35444525F946D7C7220E7_cppui255),
+                            typename field_type::value_type(0x15949F784D8472F5691129FEE55AFC39462588C4A4CA4F146D1C271CC6375515_cppui255),
+                            typename field_type::value_type(0x6A0C8B194571E874B82D904DA36D43096BBE36D512E24FF8DCB2B00B57FFD3EC_cppui255),
+                            typename field_type::value_type(0x5F85ADB7749CC735EC838BCCCFE7D4B52902C6132998D7AC8E032CAD031C42B8_cppui255),
+                            typename field_type::value_type(0x3491B2F25603BB1A9841E6E62596CBB7310333FF29B1B84F5A68694556E18478_cppui255),
+                            typename field_type::value_type(0x0988BEDA393EB3E3E57BF5875980DCBEAA11F81CD365BAB3396B62A466F76C2C_cppui255),
+                            typename field_type::value_type(0x06951222E8F2EA247C7D7EEA22D4BBD4511789D0007AC607E2B429DCF5A0F18B_cppui255),
+                            typename field_type::value_type(0x6F44C09D0CCF25EA991563D17FE244093629C0F1CA59B589E16EBAF40CA47CDA_cppui255),
+                            typename field_type::value_type(0x055F070D6C15FB0D96C033B175F5E2C810EDE0FB19FB128F251037F7CF4E861D_cppui255),
+                            typename field_type::value_type(0x511144A03A99B8559991E1B02ADB476F022F82391BAD83787C52AF2C97473E69_cppui255),
+                            typename field_type::value_type(0x1C1D4AFDD900049D853A5E4DB1EFA412915F38D416393641B7C04555F71F1CCC_cppui255),
+                            typename field_type::value_type(0x75B153737696017DB826882330597EC21E6F598AD0FDC93A7BC0C4CDC7E0EB8F_cppui255),
+                            typename field_type::value_type(0x53135B15E38B5BC47006BF792807081964F10D3B967C6EFA448B908DCBC71630_cppui255),
+                            typename field_type::value_type(0x1C90D397234D85E91FCB8F55DF312472F7CBB46678547FDBFA6A4387C822EBFE_cppui255),
+                            typename field_type::value_type(0x1F5E67574686ECCDD2B9562D9E278CB9513D9015A0DEEF764252424D7D28174C_cppui255),
+                            typename field_type::value_type(0x320988A39E8B795D2DE92355FA32EAAA198FC6B20D864701C4B2004AE0296477_cppui255),
+                            typename field_type::value_type(0x11F540171499D7D1DDADE06B6B7B5664E1A039172961513BEEEBB3837CFADF6C_cppui255),
+                            typename field_type::value_type(0x418B827FE0251682FD2C6901EB4B82A2EE53E97009AE688E8CBDA81CA4944B6E_cppui255),
+                            typename field_type::value_type(0x53B3F967BFF8760948DEC5E9282F35D1434A5503790B9012E17FAEFBE7C4D699_cppui255),
+                            typename field_type::value_type(0x404462283C8664A17DAA5B4059DCD10E2699FD86D0140DE9F3E8AD0566098AE5_cppui255),
+                            typename field_type::value_type(0x13840C701154B614AAB2274596F64818B226B1E19E94DAB6E33AEDB2C6B523F6_cppui255),
+                            typename field_type::value_type(0x10373F9724D0492159D484DC9591F1FDB865580C8F525F686C3CECDCEE9BE474_cppui255),
+                            typename field_type::value_type(0x543EDC9F290A0F9D56FAB28966C1432114B3D38E6214A4C17A06C9BE6CEF3BEF_cppui255),
+                            typename field_type::value_type(0x1B963169C01D9ADEC2533C6467DC709D306104946D4E0AB13823E97760F20688_cppui255),
+                            typename field_type::value_type(0x0BFA2F6D5466522FD6AEF2B655C407C072BFAF22DAE332E3DD30A124ED5583B3_cppui255),
+                            typename field_type::value_type(0x71E790FD449460A7B70387980B4E0B0D86C45EC02807646D2638F86F3BA9E11B_cppui255),
+                            typename field_type::value_type(0x41041026081F0F5FFB5628BC2CCDD1BA470D61F80F7BE4A1331AFB7C062B856E_cppui255),
+                            typename field_type::value_type(0x2EFE502B5B17BB7CF7AF0EB21927E6AB2AB4DE95697AF71F8B32317E60102835_cppui255),
+                            typename field_type::value_type(0x2AF23A5951D03470AF0D0A61023FBD4B83D8D60E081C8D68FCCCB6A03412566D_cppui255),
+                            typename field_type::value_type(0x3CD5816B395CAE805D804A18D5ACA0E65A06D4C99728D61B2598CEA4E7F42630_cppui255),
+                            typename field_type::value_type(0x1EC084B6A177D8697B915149C5D5DAE0870489ECA34B9132F86D4EA3AF1AEFC1_cppui255),
+                            typename field_type::value_type(0x62B221A966A0E724EE352995086C4D9E61F38FCA82155C4C2E2FD9A7486D1D78_cppui255),
+                            typename field_type::value_type(0x5F217249CC09CBF9795D76A55EA61345FE33577F3B42336201D1CA05E501D242_cppui255),
+                            typename field_type::value_type(0x30161F1AF4097B865AFB87AC22F1D8F744F3E7C68E909A976AF00D46B13BBF60_cppui255)};
+                };
+
+                constexpr std::size_t const generator_table_params<detail::curve25519_g1_params<forms::twisted_edwards>>::window;
+                constexpr std::size_t const generator_table_params<detail::curve25519_g1_params<forms::twisted_edwards>>::windows_count;
+                constexpr std::array<
+                    typename generator_table_params<detail::curve25519_g1_params<forms::twisted_edwards>>::field_type::value_type,
+                    2 * generator_table_params<detail::curve25519_g1_params<forms::twisted_edwards>>::windows_count *
+                        (std::size_t(1) << (generator_table_params<detail::curve25519_g1_params<forms::twisted_edwards>>::window - 1))> const
+                    generator_table_params<detail::curve25519_g1_params<forms::twisted_edwards>>::table;
+
+            }    // namespace curves
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_ED25519_GENERATOR_TABLE_PARAMS_HPP
@@ -0,0 +1,1118 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SECP_K1_GENERATOR_TABLE_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SECP_K1_GENERATOR_TABLE_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/params.hpp>
+
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+
+                template<typename ParamsType>
+                struct generator_table_params;
+
+                /************************* SECP256K1 ***********************************/
+
+                /**
+                 * Affine multiples (j + 1) * 2^(window * i) * G of the generator for j < 2^(window - 1),
+                 * i < windows_count, as consecutive x, y pairs. Generated by
+                 * "python3 scripts/generator_tables.py include/nil/crypto3/algebra/curves/params/generator",
+                 * do not edit.
+                 */
+                template<>
+                struct generator_table_params<detail::secp_k1_g1_params<256, forms::short_weierstrass>> {
+
+                    using field_type = typename detail::secp_k1_g1_params<256, forms::short_weierstrass>::field_type;
+
+                    constexpr static const std::size_t window = 4;
+                    constexpr static const std::size_t windows_count = 65;
+
+                    constexpr static const std::array<typename field_type::value_type,
+                                                      2 * windows_count * (std::size_t(1) << (window - 1))>
+                        table = {
+                            typename field_type::value_type(0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798_cppui256),
+                            typename field_type::value_type(0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8_cppui256),
+                            typename field_type::value_type(0xC6047F9441ED7D6D3045406E95C07CD85C778E4B8CEF3CA7ABAC09B95C709EE5_cppui256),
+                            typename field_type::value_type(0x1AE168FEA63DC339A3C58419466CEAEEF7F632653266D0E1236431A950CFE52A_cppui256),
+                            typename field_type::value_type(0xF9308A019258C31049344F85F89D5229B531C845836F99B08601F113BCE036F9_cppui256),
+                            typename field_type::value_type(0x388F7B0F632DE8140FE337E62A37F3566500A99934C2231B6CB9FD7584B8E672_cppui256),
+                            typename field_type::value_type(0xE493DBF1C10D80F3581E4904930B1404CC6C13900EE0758474FA94ABE8C4CD13_cppui256),
+                            typename field_type::value_type(0x51ED993EA0D455B75642E2098EA51448D967AE33BFBDFE40CFE97BDC47739922_cppui256),
+                            typename field_type::value_type(0x2F8BDE4D1A07209355B4A7250A5C5128E88B84BDDC619AB7CBA8D569B240EFE4_cppui256),
+                            typename field_type::value_type(0xD8AC222636E5E3D6D4DBA9DDA6C9C426F788271BAB0D6840DCA87D3AA6AC62D6_cppui256),
+                            typename field_type::value_type(0xFFF97BD5755EEEA420453A14355235D382F6472F8568A18B2F057A1460297556_cppui256),
+                            typename field_type::value_type(0xAE12777AACFBB620F3BE96017F45C560DE80F0F6518FE4A03C870C36B075F297_cppui256),
+                            typename field_type::value_type(0x5CBDF0646E5DB4EAA398F365F2EA7A0E3D419B7E0330E39CE92BDDEDCAC4F9BC_cppui256),
+                            typename field_type::value_type(0x6AEBCA40BA255960A3178D6D861A54DBA813D0B813FDE7B5A5082628087264DA_cppui256),
+                            typename field_type::value_type(0x2F01E5E15CCA351DAFF3843FB70F3C2F0A1BDD05E5AF888A67784EF3E10A2A01_cppui256),
+                            typename field_type::value_type(0x5C4DA8A741539949293D082A132D13B4C2E213D6BA5B7617B5DA2CB76CBDE904_cppui256),
+                            typename field_type::value_type(0xE60FCE93B59E9EC53011AABC21C23E97B2A31369B87A5AE9C44EE89E2A6DEC0A_cppui256),
+                            typename field_type::value_type(0xF7E3507399E595929DB99F34F57937101296891E44D23F0BE1F32CCE69616821_cppui256),
+                            typename field_type::value_type(0xD30199D74FB5A22D47B6E054E2F378CEDACFFCB89904A61D75D0DBD407143E65_cppui256),
+                            typename field_type::value_type(0x95038D9D0AE3D5C3B3D6DEC9E98380651F760CC364ED819605B3FF1F24106AB9_cppui256),
+                            typename field_type::value_type(0x6ECA335D9645307DB441656EF4E65B4BFC579B27452BEBC19BD870AA1118E5C3_cppui256),
+                            typename field_type::value_type(0xD50123B57A7A0710592F579074B875A03A496A3A3BF8EC34498A2F7805A08668_cppui256),
+                            typename field_type::value_type(0xBF23C1542D16EAB70B1051EAF832823CFC4C6F1DCDBAFD81E37918E6F874EF8B_cppui256),
+                            typename field_type::value_type(0x5CB3866FC33003737AD928A0BA5392E4C522FC54811E2F784DC37EFE66831D9F_cppui256),
+                            typename field_type::value_type(0xE9623BBEF1BF90EC0D7C744ED34659F010E6E638637161270ECD31E14F87F62E_cppui256),
+                            typename field_type::value_type(0x38A9743B4BC299E9E0FE953A8EDAA929FE6043C9DD68844E53013EAFA44EE737_cppui256),
+                            typename field_type::value_type(0x3F0E80E574456D8F8FA64E044B2EB72EA22EB53FE1EFE3A443933ACA7F8CB0E3_cppui256),
+                            typename field_type::value_type(0xCB66D7D7296CBC91E90B9C08485D01B39501253AA65B53A4CB0289E2EA5F404F_cppui256),
+                            typename field_type::value_type(0xBC82DD73E5161DBA0884A36F2080D682FFC274BF62FCA8F9EB0AADF82A8D733C_cppui256),
+                            typename field_type::value_type(0xE5F28C3A044B1CAC54A9B4BF719F02DFAE93A0BAE73897301E786104F47797F0_cppui256),
+                            typename field_type::value_type(0x34FF3BE4033F7A06696C3D09F7D1671CBCF55CD700535655647077456769A24E_cppui256),
+                            typename field_type::value_type(0x5D9D11623A236C553F6619D89832098C55DF16C3E8F8B6818491067A73CC2F1A_cppui256),
+                            typename field_type::value_type(0x8282263212C609D9EA2A6E3E172DE238D8C39CABD5AC1CA10646E23FD5F51508_cppui256),
+                            typename field_type::value_type(0x11F8A8098557DFE45E8256E830B60ACE62D613AC2F7B17BED31B6EAFF6E26CAF_cppui256),
+                            typename field_type::value_type(0x465370B287A79FF3905A857A9CF918D50ADBC968D9E159D0926E2C00EF34A24D_cppui256),
+                            typename field_type::value_type(0x35E531B38368C082A4AF8BDAFDEEC2C1588E09B215D37A10A2F8FB20B33887F4_cppui256),
+                            typename field_type::value_type(0x8262CF2FF0799C4C0D9A30F8ACA98CA009809191A3C7E184FCFC0CB9E57E8DFA_cppui256),
+                            typename field_type::value_type(0x83FD95E209109E4E66FEE22EC5B34F3457B6ED332B14C47835CFF8D8FBAC376A_cppui256),
+                            typename field_type::value_type(0x241FEBB8E23CBD77D664A18F66AD6240AAEC6ECDC813B088D5B901B2E285131F_cppui256),
+                            typename field_type::value_type(0x513378D9FF94F8D3D6C420BD13981DF8CD50FD0FBD0CB5AFABB3E66F2750026D_cppui256),
+                            typename field_type::value_type(0x19825C8B1DA0DDD5168105B24CE99C877CA41BD47B734B949052E48B026BDB6F_cppui256),
+                            typename field_type::value_type(0x6294310F0D4C878F320261CC94F59F6CEBE9EECC8CF6D3A6B5DF7084C49CFC9B_cppui256),
+                            typename field_type::value_type(0x1653A8A48D2C236DC60DD31A2B6717804998C4BEABC288D9D17CC1F27C70620C_cppui256),
+                            typename field_type::value_type(0x0338290935AF7F7AEAFA99474EFA701C012AF748DFD3DC526CA2E81D315B32CD_cppui256),
+                            typename field_type::value_type(0x6F12D86C1160191443C5F56EC6C2999EDFA58E345E1534E650ED09523D82824C_cppui256),
+                            typename field_type::value_type(0x5C4FF7F44AB3BFA0875994F3FD623769391C92410854BC5B8579C34806EB34D0_cppui256),
+                            typename field_type::value_type(0x5D1BDB4EA172FA79FCE4CC2983D8F8D9FC318B85F423DE0DEDCB63069B920471_cppui256),
+                            typename field_type::value_type(0x2843826779379E2E794BB99438A2265679EB1E9996C56E7B70330666F7B83103_cppui256),
+                            typename field_type::value_type(0x175E159F728B865A72F99CC6C6FC846DE0B93833FD2222ED73FCE5B551E5B739_cppui256),
+                            typename field_type::value_type(0xD3506E0D9E3C79EBA4EF97A51FF71F5EACB5955ADD24345C6EFA6FFEE9FED695_cppui256),
+                            typename field_type::value_type(0x423A013F03FF32D7A5FFBCC8E139C62130FDFEB5C6DA121BCE78049E46BC47D6_cppui256),
+                            typename field_type::value_type(0xB91AE00FE1E1D970A1179F7BBAF6B3C7720D8EC3524F009ED1236E6D8B548A34_cppui256),
+                            typename field_type::value_type(0xDA75317B21F7ACF4128B59EFDC2FED523F7335F6842B836A65B7F8F1C5041216_cppui256),
+                            typename field_type::value_type(0x73F8A046BF72D5F0DF19E21B342D7FC6E9AAC07AE77ACEDADAED32986E708572_cppui256),
+                            typename field_type::value_type(0x111D6A45AC1FB90508907A7ABCD6877649DF662F3B3E2741302DF6F78416824A_cppui256),
+                            typename field_type::value_type(0x0696911C478EAFFBB90D48DBFF065952F070008996DACA4CA9A111D42108E9D0_cppui256),
+                            typename field_type::value_type(0x1C71C5B48E9749D70573C58C4A82EB1E2587F1C16B1352FDB0143E71E465A930_cppui256),
+                            typename field_type::value_type(0x4A91C334E8F5FA0C2713F1F2824BB68C79345E3FB7174D471D873F6CC34638B5_cppui256),
+                            typename field_type::value_type(0x9530F0F9023F469C1364B7D2C3E8B70E19150DDF51F0AB069505324F3C62BAC0_cppui256),
+                            typename field_type::value_type(0x8F3C305A8F9F21E234DD2F7F59B333E0E25B32852F1FDC68478ABDA97618E309_cppui256),
+                            typename field_type::value_type(0xD84E4AFC1F31A566936E837A909B4C9C7850DD432744A077E318DAE5BADB6EE7_cppui256),
+                            typename field_type::value_type(0xE525809A7C7B79CE12A38D58F565DE4DFDD8AC974AA3E64982D556E6D42EBED2_cppui256),
+                            typename field_type::value_type(0x4A4A6DC97AC7C8B8AD795DBEBCB9DCFF7290B68A5EF74E56AB5EDDE01BCED775_cppui256),
+                            typename field_type::value_type(0x529911B016631E72943EF9F739C0F4571DE90CDB424742ACB2BF8F68A78DD66D_cppui256),
+                            typename field_type::value_type(0x363D90D447B00C9C99CEAC05B6262EE053441C7E55552FFE526BAD8F83FF4640_cppui256),
+                            typename field_type::value_type(0x04E273ADFC732221953B445397F3363145B9A89008199ECB62003C7F3BEE9DE9_cppui256),
+                            typename field_type::value_type(0x4C1B9866ED9A7E9B553973C6C93B02BF0B62FB012EDFB59DD2712A5CAF92C541_cppui256),
+                            typename field_type::value_type(0xC1F792D320BE8A0F7FBCB753CE56E69CC652EAD7E43EB1AD72C4F3FDC68FE020_cppui256),
+                            typename field_type::value_type(0x4431404790C5FFB2BA84A440C05094426FF95AB6EACA04394B891216F6E55DC8_cppui256),
+                            typename field_type::value_type(0x96B0C142E65366F8FE99837F5642FED7A66A29B79EAA2E5031D944AEDBE323B3_cppui256),
+                            typename field_type::value_type(0xA4083877BA83B12B529A2F3C0780B54E3233EDBC1A28F135E0C8F28CBEAAF3D1_cppui256),
+                            typename field_type::value_type(0x40E9F612FEEFBC79B8BF83D69361B3E22001E7576ED1EF90B12B534DF0B254B9_cppui256),
+                            typename field_type::value_type(0x9E22FE8D866CA87C126243D5B921089DAB7B7D470A87EE0ADFE9485D701B23A8_cppui256),
+                            typename field_type::value_type(0xFD2FF0E9CA122D10177F3F02099C1533C0F7C949FB511CECF7A413C50884EDAE_cppui256),
+                            typename field_type::value_type(0xE5380FE8575F26ADB7924AE0D58138D268112776B11BD34B3EB5E19633F0E9AA_cppui256),
+                            typename field_type::value_type(0xB97FD8739087B41D5B691363924C8E016FB94E5DF468318EC4BA41364082720F_cppui256),
+                            typename field_type::value_type(0x508DF6D503CE2A8D2EDD69E64705306DCD5EE51F5F5CF475DD7408BF071A70E4_cppui256),
+                            typename field_type::value_type(0x154C439B933BC42D777304AA733E49C54EC03228EE8AADFEDF2E5BF729950984_cppui256),
+                            typename field_type::value_type(0xA804C641D28CC0B53A4E3E1A2F56C86F6E0D880A454203B98CD3DB5A7940D33A_cppui256),
+                            typename field_type::value_type(0x95BE83252B2FA6D03DEC2842C16047E81AF18CA89CF736A943CE95FA6D46967A_cppui256),
+                            typename field_type::value_type(0x8B4B5F165DF3C2BE8C6244B5B745638843E4A781A15BCD1B69F79A55DFFDF80C_cppui256),
+                            typename field_type::value_type(0x4AAD0A6F68D308B4B3FBD7813AB0DA04F9E336546162EE56B3EFF0C65FD4FD36_cppui256),
+                            typename field_type::value_type(0xED0C5CE4E13291718CE17C7EC83C611071AF64EE417C997ABB3F26714755E4BE_cppui256),
+                            typename field_type::value_type(0x221A9FC7BC2345BDBF3DAD7F5A7EA68049D93925763DDAB163F9FA6EA07BF42F_cppui256),
+                            typename field_type::value_type(0x7029BD7A92FF352F0B6ABED6C058F78E3D446723552D30E2A0A2A582F55812DD_cppui256),
+                            typename field_type::value_type(0xB0EEFADAFDE8B3D27DD6544AE30683AC47DAE84243B2C73C721CC66B1A2D2927_cppui256),
+                            typename field_type::value_type(0xFAECB013C44CE694B3B15C3F83F1FAE8E53254566E0552CED4B6E6C807CEC8AB_cppui256),
+                            typename field_type::value_type(0xCC09B5E90E9ECB57FC2E02C6EC2FB13D9C32B286B85E2E2E8981DFD9AB155070_cppui256),
+                            typename field_type::value_type(0x9CCFEDCAEAE65C99009D4109D8CF75605745BEBA49565B6A49CE5683BD486ED1_cppui256),
+                            typename field_type::value_type(0x7C2F4D713D6A32CFB6122481200B34112421675969592AA24F6D59ED75E95D8D_cppui256),
+                            typename field_type::value_type(0xF42C102AF47E6E474AA264B818A34E7EDD2F62BB5CC62364DCDABFF9B181FDC2_cppui256),
+                            typename field_type::value_type(0x57503AB46CFE806C78FAD05CB86FE22A4C15502D9A2ACF2681F00093A485D7FD_cppui256),
+                            typename field_type::value_type(0xCD9A4B876341414335A8FDE33CA4DF19D0C74576BA2D4AB7A206B1A75BD0EACA_cppui256),
+                            typename field_type::value_type(0xF0455879A1E8F23E815488AE933EA08B0127B38EED6F634F6E6FAFB5ABFF4ACC_cppui256),
+                            typename field_type::value_type(0x09BB8A132DCAD2F2C8731A0B37CBCAFDB3B2DD824F23CD3E07F64EAE9AD1B1F7_cppui256),
+                            typename field_type::value_type(0x945BB2B2AFEEE3B9B6F9DD284F863E850F54A840F4752D5364130627C3811C80_cppui256),
+                            typename field_type::value_type(0x723CBAA6E5DB996D6BF771C00BD548C7B700DBFFA6C0E77BCB6115925232FCDA_cppui256),
+                            typename field_type::value_type(0x96E867B5595CC498A921137488824D6E2660A0653779494801DC069D9EB39F5F_cppui256),
+                            typename field_type::value_type(0x57EFA786437B744D343D7DC45773A3C62D240A43079849071FD383D60CA030D5_cppui256),
+                            typename field_type::value_type(0xD712DB0BD1B48518893627C928DE03EC689B6D2AE5E9974AB07AB44274B02F9E_cppui256),
+                            typename field_type::value_type(0x6DDE9CF317AACAD400C6273212181FCB575A224B69D021132567E09E80633CB1_cppui256),
+                            typename field_type::value_type(0x9188FBE7A707E41D5C99EF86A1BA66A880B27FDACF859EF357DD49AA67CE6B34_cppui256),
+                            typename field_type::value_type(0x264BBD436A28BC42A2DF7E9CD5226CB91080577E327B012A7FAFC7770C584DD5_cppui256),
+                            typename field_type::value_type(0xD87C6FA94EE093B4D4F75CE24C33BE226A118243717B8D8DE61227937704AB11_cppui256),
+                            typename field_type::value_type(0x486FA72CD5B5CDE813C4BB7F8E47B850085A0F7115F12522419A518D2933F3C5_cppui256),
+                            typename field_type::value_type(0x62E12319F56BDD43E48C48BAECC8F19F62D9B783CF0F23B79AD4A71ACAFB0F53_cppui256),
+                            typename field_type::value_type(0x97D064F0FC69A1222C21F62E0EC970E940908AB819BBFACE4D0BD76A44E5467D_cppui256),
+                            typename field_type::value_type(0x89974F2ED33402CC03F7C66FA850861FDA5FB3B854F17CCD797300FD1E9CB3FA_cppui256),
+                            typename field_type::value_type(0x24796974A894AF4FB664FF27B76A5303677375FBE6F12204EBD594225E99F728_cppui256),
+                            typename field_type::value_type(0xE3D78D44688F3001EC52E87E7D8D664A5ADBF3C09575A2D837A00516EBAAEBFF_cppui256),
+                            typename field_type::value_type(0xA94C6524BD40D2BBDAC85C056236A79DA78BC61FD5BDEC9D2BF26BD84B2438E8_cppui256),
+                            typename field_type::value_type(0xB5201FD992F96280FD79219505019E3A7E5D3C60A0E39B2BC2E2C8DBF18661F4_cppui256),
+                            typename field_type::value_type(0xEEBFA4D493BEBF98BA5FEEC812C2D3B50947961237A919839A533ECA0E7DD7FA_cppui256),
+                            typename field_type::value_type(0x5D9A8CA3970EF0F269EE7EDAF178089D9AE4CDC3A711F712DDFD4FDAE1DE8999_cppui256),
+                            typename field_type::value_type(0x381C4AD7A7A97BFDA61C6031C118495FC4EA4BC08F6766D676BEE90847D297FD_cppui256),
+                            typename field_type::value_type(0x936AF53B238EEEE48F3E5FA709915ECCF0451032DB939C0093ACE3187D493FC5_cppui256),
+                            typename field_type::value_type(0x437A86204276D45036FFB8126F6E681473A59F938897FAF0F3F678FFBB7CECEB_cppui256),
+                            typename field_type::value_type(0x0B916BA13EEAC32F69B8FEB699D297FF87220FCFDC8F97827363BCC356C181E1_cppui256),
+                            typename field_type::value_type(0xE1EFB9CD05ADC63BCCE10831D9538C479CF1D05FEFDD08B2448D70422EDE454C_cppui256),
+                            typename field_type::value_type(0x0ECB4530D8AF9BE7B0154C1FFE477123464E3244A7A2D4C6AD9FD233A8913797_cppui256),
+                            typename field_type::value_type(0xA9EF9F13E2A489BC83CB7E3B9A3CC27335823529D2C8735CD58D729E097F96F2_cppui256),
+                            typename field_type::value_type(0xE814CCE594559D7CD956EE160EBB613DB74F89AF5A9B4702C03D55B056C04BE4_cppui256),
+                            typename field_type::value_type(0xB89070AE96EAD4DC49BE16F6A1A30BC241B4E98BC18D02274C9D9D87DCBF00EB_cppui256),
+                            typename field_type::value_type(0x6F24C8C2C8A2D88F472294E4C1C4A766CB0D8B06B6B96A671B7F1BCD1B0E664E_cppui256),
+                            typename field_type::value_type(0x66D80541EE1D35BE553827D69FAA064207DBF57454A8AB0DBC0AB5A1350CF77E_cppui256),
+                            typename field_type::value_type(0x51CFDFE732FFFB42C3F1D420535613F69444B43AB7B1B76D2A5F97AFA0EAA3A6_cppui256),
+                            typename field_type::value_type(0x5318F9B1A2697010C5AC235E9AF475A8C7E5419F33D47B18D33FEEB329EB99A4_cppui256),
+                            typename field_type::value_type(0xF44CCFEB4BEDA4195772D93AEBB405E8A41F2B40D1E3EC652C726EEEFE91F92D_cppui256),
+                            typename field_type::value_type(0x100F44DA696E71672791D0A09B7BDE459F1215A29B3C03BFEFD7835B39A48DB0_cppui256),
+                            typename field_type::value_type(0xCDD9E13192A00B772EC8F3300C090666B7FF4A18FF5195AC0FBD5CD62BC65A09_cppui256),
+                            typename field_type::value_type(0x8C0989F2CEB5C771A8415DFF2B4C4199D8D9C8F9237D08084B05284F1E4DF706_cppui256),
+                            typename field_type::value_type(0xFB4DBD044F432034FFD2172CB9DC966C60DE6BF5156511AA736AC5A35D72FA98_cppui256),
+                            typename field_type::value_type(0x10E90E2E51EEADC9ED858EE9CED7CA8D9275028E465A2EE69CB9A13495BC15B4_cppui256),
+                            typename field_type::value_type(0xC68A370380D5E0424D57A8C616AD1F754CA5896302BB6A8834EBE60958AA258D_cppui256),
+                            typename field_type::value_type(0xFB8F153C5E266704C4A481743262C0259C528539BC95BC1BB1E63C33DC47BFFD_cppui256),
+                            typename field_type::value_type(0x6CA27A9DC5E0621816FA11D9B4BCCD531DDE1389AC542613090A45DDD949B095_cppui256),
+                            typename field_type::value_type(0xF7422F42DA5416384575B90B714B7DCDA377A3CC053D33182DD3FC303FE75269_cppui256),
+                            typename field_type::value_type(0x406C2F1A3313093FD18CE7DCB9F635977FB3A237F4A398E018980E8717E49BD5_cppui256),
+                            typename field_type::value_type(0xB6B15A68A614CCA5B17C9BE7002FF9C34D625158C65A9C740F62ABC87A1C0A80_cppui256),
+                            typename field_type::value_type(0xFAE62E14D6CDB61EA54E223EEF6536D49C9A12B3082E16EEB6CD011041CE0A03_cppui256),
+                            typename field_type::value_type(0x2D8CAD0417D43CFF72879A5582D5DEBBEDB8E771D31CF42A653B6696F5A7175F_cppui256),
+                            typename field_type::value_type(0xC73F3B83318CA94A7BB232FA612C9D377A846BFD9CB5E5E0CF37BB91BB9D592A_cppui256),
+                            typename field_type::value_type(0xE747333FD75D51755A0CC9F0A728708465A02C587737A7B8B8FA1B8B4BB2629A_cppui256),
+                            typename field_type::value_type(0xF2AFFE0145070C114CC43603804C2581C88376AA6E1A969A9F8D961A6946F6D6_cppui256),
+                            typename field_type::value_type(0xE1031BE262C7ED1B1DC9227A4A04C017A77F8D4464F3B3852C8ACDE6E534FD2D_cppui256),
+                            typename field_type::value_type(0x9D7061928940405E6BB6A4176597535AF292DD419E1CED79A44F18F29456A00D_cppui256),
+                            typename field_type::value_type(0xF4B93F224C8089EAB9F95DCD0F29B2C9028A6AC5DE94D85784E27E36A95C8356_cppui256),
+                            typename field_type::value_type(0xA67A92EC062962DFB0E5F6A7A40EEE90C37EF1344915609ABD5861B9BE001FD3_cppui256),
+                            typename field_type::value_type(0xA7EBF7C4E3C785EC6A5ABE5A15DE69DB6195926DBA743961579623AEEF028D83_cppui256),
+                            typename field_type::value_type(0x6205152FBFE362D5CFD9C7377044804B47A389274B0539199640392B99D0BED1_cppui256),
+                            typename field_type::value_type(0x09D1ACA1FCE55236B19622EA025B08B0D51E8512F97E696C20D62FE17B160E8A_cppui256),
+                            typename field_type::value_type(0x1153188F5101F0C63E56692CE0D8C27E6FE9E0EE9212B5E534E050C57CA04C44_cppui256),
+                            typename field_type::value_type(0x5B5CA08DCB024F4C1CDC6A53426346336A89C5137F09D4B5BAE0E40227DD5CFA_cppui256),
+                            typename field_type::value_type(0x3ECCB6F70AA15825E991F0CEA8869094BFD067CCAF3269D3E664A6F99E48E98C_cppui256),
+                            typename field_type::value_type(0xD4933230CC8721B8662638CD8974AE6EDA4F04E2FB1F0C13F28844137BB61EE5_cppui256),
+                            typename field_type::value_type(0x021C09ABF51A9D23EDCC5E9D1ECAFB5E1AD12C8C5A438DDC662DA4D0E5D694A8_cppui256),
+                            typename field_type::value_type(0x046F26ACC1114BB5CCEF3E7489C22C29FF51326BB10C2C9F2B9528E323531F82_cppui256),
+                            typename field_type::value_type(0x6B804B31635B82EACE2370AC2FC32579D025945CDAB55C7FA505FC8B0BCEDA07_cppui256),
+                            typename field_type::value_type(0xC66C59CC454C2B9E18A2AD793821CDE7518B3A93BFC39562E97D7D0475BA7FC2_cppui256),
+                            typename field_type::value_type(0xD9592FE2BFB30FCFBEA4F3CEAAC10CB2F00A60DDB15955977EC3C69CF75F5956_cppui256),
+                            typename field_type::value_type(0xFEEA6CAE46D55B530AC2839F143BD7EC5CF8B266A41D6AF52D5E688D9094696D_cppui256),
+                            typename field_type::value_type(0xE57C6B6C97DCE1BAB06E4E12BF3ECD5C981C8957CC41442D3155DEBF18090088_cppui256),
+                            typename field_type::value_type(0x4D000B621ADB87E1C53261AF9DB2E179141ECAE0B331A1870AA4040AEE752B08_cppui256),
+                            typename field_type::value_type(0x6A0D5B8F18E0D255CB6D825582D972CCCB7DF5F119C7293A3E72851F48302CEA_cppui256),
+                            typename field_type::value_type(0x5084B41BACF4508B34867AAA2CF5A12D5EC4BA38C9B02656079361BB48DFD587_cppui256),
+                            typename field_type::value_type(0x34A9631A1D980D31619AA6C8552927475DB6F5606891F5606E79E97F91470E89_cppui256),
+                            typename field_type::value_type(0x71F570CA203DA05DD6AA262114717128D657A0403E1F1B77F89962FD475C58EF_cppui256),
+                            typename field_type::value_type(0xEB42415B95DC880DD25557345BC95B8DF2445D00C3363E7DF8649A72D35D420E_cppui256),
+                            typename field_type::value_type(0x4F14C03E0642D5EA53FB3F1FD18D7128C80C29767CF30A12D08232617AB34CC6_cppui256),
+                            typename field_type::value_type(0x7B53D0A8CAA4E894C653A70F43A62540B9DE3CCE8E81DD0225EC252F987E681F_cppui256),
+                            typename field_type::value_type(0xA49ED10EAAAB93233A5F485D4BD18C0628AB2629F0B8C3DB4D05956D6C953FA9_cppui256),
+                            typename field_type::value_type(0xCC72B894660F5398E03476C0A0DFDDFB5AE87534968E181B67B2BD2246FB4C72_cppui256),
+                            typename field_type::value_type(0xA74DB87E49C79ED1D41436095EDDD363E81CF141DB2444F8342771011241D90D_cppui256),
+                            typename field_type::value_type(0xF78691CDAF23EEF327FDD08A588171C8A9EE509344A0A313F32518B83F7ADAD4_cppui256),
+                            typename field_type::value_type(0xA2B7B3629F7BD253B7D282B5C21DA01446B4821DC65E76516048B06043FF8359_cppui256),
+                            typename field_type::value_type(0x693038941695122D57A937A3F71E29C910D10835046F3835A2397FECFE86FEC2_cppui256),
+                            typename field_type::value_type(0xDA67A91D91049CDCB367BE4BE6FFCA3CFEED657D808583DE33FA978BC1EC6CB1_cppui256),
+                            typename field_type::value_type(0x9BACAA35481642BC41F463F7EC9780E5DEC7ADC508F740A17E9EA8E27A68BE1D_cppui256),
+                            typename field_type::value_type(0x4DBACD365FA1EF587C0C0CFAAF00D8718BBD9F35CCEA5A835EE3CC821FE741C9_cppui256),
+                            typename field_type::value_type(0x16C3540E8A51892E7FDCFD59E838299D0CC384A09FC0535F60BE10F8338EB623_cppui256),
+                            typename field_type::value_type(0x4D0180583CFCEDA3D38565A4BA5A5FC768410177CBE151A19EFDD06515BC8A44_cppui256),
+                            typename field_type::value_type(0x3A33C6C18CB4F5D367E9BA8007D63813969420468582DA362F1F94C91ADBC09E_cppui256),
+                            typename field_type::value_type(0x13D1FFC481509BEEE68F17D8FF41C2590F4C85F15268605087EDA8BAB4E218DA_cppui256),
+                            typename field_type::value_type(0x6008391FA991961DCECB9337B1B758BDA4AD01206D5BD127E0DB419DDB191C19_cppui256),
+                            typename field_type::value_type(0x2F661507DF5CF957082CB6A273B6E9D15923EB24CE645F76BC1AB52865DAEB00_cppui256),
+                            typename field_type::value_type(0xFD5C12136F52B33F6EF9537A8200ADD06ECDEE27195D308C12276789833992C0_cppui256),
+                            typename field_type::value_type(0xC11968E43ADF2256F0FF54A3CCAF2DCE07F557F1AB8B5A3CF52213E4935B4EB8_cppui256),
+                            typename field_type::value_type(0xBFF5E6937786458F8379D81FE6766F8242F8B49412A7149B7044996D6F911ADD_cppui256),
+                            typename field_type::value_type(0xF594117D05FE47D2254F174DA1835A383662C8B647702DCF182A90A0916AA6D9_cppui256),
+                            typename field_type::value_type(0xCAA761A56E971B12CF65DBDAB094BCEB7A9277883E6B5B86C7D0696EBF2E50CF_cppui256),
+                            typename field_type::value_type(0x219B4F9CEF6C60007659C79C45B0533B3CC9D916CE29DBFF133B40CAA2E96DB8_cppui256),
+                            typename field_type::value_type(0x24D9C605D959EFEAF5A44180C0372A6E394F8AC53E90576527DF01A78D3B6BC7_cppui256),
+                            typename field_type::value_type(0x53904FAA0B334CDDA6E000935EF22151EC08D0F7BB11069F57545CCC1A37B7C0_cppui256),
+                            typename field_type::value_type(0x5BC087D0BC80106D88C9ECCAC20D3C1C13999981E14434699DCB096B022771C8_cppui256),
+                            typename field_type::value_type(0x01A575AF9D4146753CF991196316995D2A6EE7AAAD0F85AD57CD0F1F38A47CA9_cppui256),
+                            typename field_type::value_type(0x3038F1CB8AB20DC3CC55FC52E1BB8698BDB93C5D9F4D7EA667C5DF2E77EBCDB7_cppui256),
+                            typename field_type::value_type(0x673724FD24BC731896B769CC6E479B89742EF557615F8A6771AC42FE48A2050E_cppui256),
+                            typename field_type::value_type(0xE4CF8257896A4A20203482C09A886B6DBE6BACFD43349CC2B90C9A49061D3D70_cppui256),
+                            typename field_type::value_type(0xF5F0E0437621D439CA71F5C1B76155D6D3A61A83D3C20C6EE309D755E315565B_cppui256),
+                            typename field_type::value_type(0x6B9F4E62BE5A052BF62189160DF7101AA5BF61BF3ED7E40A678430AFDD2ECC82_cppui256),
+                            typename field_type::value_type(0x4366EFA472DF4C309E598A631F6166A8E03AF53287261C66CBF6E48382DE63BF_cppui256),
+                            typename field_type::value_type(0x2E7DD909BEE2D7CE2EE2537E130268EAF33B0C525AAA6D6B02C6A408E17924CD_cppui256),
+                            typename field_type::value_type(0x995CA7F37081B8DC905A47336209ED9F6B50E905260D6AFE34CF601FA9A78179_cppui256),
+                            typename field_type::value_type(0xD9A059E95553573AB5E34D880492863ABBCC85569AB64E52931FBB4CAFEC1F47_cppui256),
+                            typename field_type::value_type(0x7BD753627991AB1F97BE5569667AA75FD1F02DE907C9525EF10527FF06F96190_cppui256),
+                            typename field_type::value_type(0x8336F2B3DBBA6309D5ED6474943827D6CE0FCC5C1E0EA695A3D17204ABDA00F6_cppui256),
+                            typename field_type::value_type(0x8F506F0B6C0B6E9A57A7F36D970CA4E347CBC92146227642CBE781D9F5362D33_cppui256),
+                            typename field_type::value_type(0x469F955D2AFA61719530C5424F1C336848CF925D43BB8EAF30487D0C87FA243F_cppui256),
+                            typename field_type::value_type(0x8E7BCD0BD35983A7719CCA7764CA906779B53A043A9B8BCAEFF959F43AD86047_cppui256),
+                            typename field_type::value_type(0x10B7770B2A3DA4B3940310420CA9514579E88E2E47FD68B3EA10047E8460372A_cppui256),
+                            typename field_type::value_type(0x33B35BAA195E729DC350F319996950DF3BC15B8D3D0389E777D2808BF13F0351_cppui256),
+                            typename field_type::value_type(0xA58A0185640ABF87F9464036248D52BCAA6560EFBC889B702BC503CCCB8D7418_cppui256),
+                            typename field_type::value_type(0xBFC90C0C8C8F337EC714734EFAFE76BE3A75EDFB691B03C1FFE8879A041EAD4B_cppui256),
+                            typename field_type::value_type(0x7A9481B1E09CDED24DBA718DD5042D36FB468EFF32E0AE3E7452C6F086FEDAED_cppui256),
+                            typename field_type::value_type(0x374DEEAE22C93F955CB83AD2071F7E2256F6E109CAD7BCA6D71DC7B24414BB36_cppui256),
+                            typename field_type::value_type(0x171165B64FCD4F9916032C06F806F7293828D66300E543217875BEA98DAF734A_cppui256),
+                            typename field_type::value_type(0x732DF11CBE3FAAA4DCA5993E8C2D3F5B50753617EF9F73CB26E7BD0775BB3B3E_cppui256),
+                            typename field_type::value_type(0x7F41903EDE8F9977CB7E255840253916E69DAD6D64C58436CC577E1ED7366693_cppui256),
+                            typename field_type::value_type(0x3A55690DABB5E00DC2D0D8A496D16C4476EE767CA9D0D1D3694C856EE5B7AD0D_cppui256),
+                            typename field_type::value_type(0xC3E28E1975A0657BFB21FBAC97EF99F301CACB8ACAC31218D6C98790B2E8C407_cppui256),
+                            typename field_type::value_type(0x4CE094B9603947B428DA8840CC97EF6019A66924E9774C99C5F5B3C1888DC3B9_cppui256),
+                            typename field_type::value_type(0x05390FBABF1A9B3ED57B4D80CA76ACA216205B20C9EA06502C14F7B6E5C0DE52_cppui256),
+                            typename field_type::value_type(0x2380C09C7F3AEAE57C46E07395AEB0DC944DBAF2B62A9F0C5E8A64AD6AE7D616_cppui256),
+                            typename field_type::value_type(0x6F8E86193464956AF1598AEFD509B09A93AF92148F8467560099BE48161BBC1A_cppui256),
+                            typename field_type::value_type(0x385EED34C1CDFF21E6D0818689B81BDE71A7F4F18397E6690A841E1599C43862_cppui256),
+                            typename field_type::value_type(0x283BEBC3E8EA23F56701DE19E9EBF4576B304EEC2086DC8CC0458FE5542E5453_cppui256),
+                            typename field_type::value_type(0xF6F622083DAF54800456BE134D5F67D147C82642BEFC1CE2DC83A27078F2827C_cppui256),
+                            typename field_type::value_type(0x1BCD4E817DE73A0FAF2C5715B367CEE7E657CA7448321BF6D15B20B520AAA102_cppui256),
+                            typename field_type::value_type(0x19A314F397C705E75E12EA6139CF845641DB92831B38D63514BD306AB6E2D9B3_cppui256),
+                            typename field_type::value_type(0x6CACD8F5DAC728DD234965F887F528B3A5021D1D2404BE56D552EE25CBAAAF33_cppui256),
+                            typename field_type::value_type(0xFB26E5188F953DE2BD70CB3C3D1FC255CD91C3CE7D8C6F369D893209715ADCB6_cppui256),
+                            typename field_type::value_type(0xF3E128811012A34D58E846A719D0176916D2CB31B8B7AB5449DBCA3B58BA68F3_cppui256),
+                            typename field_type::value_type(0x5840ED4B95A8DAA355DC986364F6721920358804A100DCEE7D8587EB12F00480_cppui256),
+                            typename field_type::value_type(0x670CDA6B220BF14107968DEAA15DD8DABA75225452AE38721592D5E2BE22CF9E_cppui256),
+                            typename field_type::value_type(0x85FFDC0DE8187FE9A806E2A9AAE51CFFD0ADFC0315400B3752E737D963A52264_cppui256),
+                            typename field_type::value_type(0x3FEE30187AE2948D0BE568F50554706C678182C92B179D0498C7D29A82DA2082_cppui256),
+                            typename field_type::value_type(0x9F5701A5346918FB1DC58C1F4ECE532545DC1A3C269A3DC8E484DEE823F54C42_cppui256),
+                            typename field_type::value_type(0xCE7B8FB8801D9E57BFB95B6B5729BFDD89EE784AB219E527860E1C492FEB6A21_cppui256),
+                            typename field_type::value_type(0x8991225911B9132D28F5C6BC763CEAB7D18C37060E8BD1D7ED44DB7560788C1E_cppui256),
+                            typename field_type::value_type(0xDA8B4D987CC9AC9B27B8763559B136FA36969C84FDEF9E11635C42228E8F0EF1_cppui256),
+                            typename field_type::value_type(0x06F9D9B803ECF191637C73A4413DFA180FDDF84A5947FBC9C606ED86C3FAC3A7_cppui256),
+                            typename field_type::value_type(0x7C80C68E603059BA69B8E2A30E45C4D47EA4DD2F5C281002D86890603A842160_cppui256),
+                            typename field_type::value_type(0xAE86EEEA252B411C1CDC36C284482939DA1745E5A7E4DA175C9D22744B7FD72D_cppui256),
+                            typename field_type::value_type(0x19E993C9707302F962AB0ACE589FF0E98D9211551472F7282334CB7A4EEE38BC_cppui256),
+                            typename field_type::value_type(0x43CA41D162B3C64FB8374D859CA6F72FB2A7258E426763D524ED75E8D21CE204_cppui256),
+                            typename field_type::value_type(0xDCEA5A82E37023FA1C650F9218DBA31F9AB6C7B33EA4A468E525044E934A8F6B_cppui256),
+                            typename field_type::value_type(0x2248C9F90BBFFF55E61D2F8C56DC2C488718BE75CF36F2EE7A1474267C169290_cppui256),
+                            typename field_type::value_type(0xFA0594692D21EED7A506BB55B435BA18E163750235DA2BE2369D8A12883EA257_cppui256),
+                            typename field_type::value_type(0x9C3E06EF22892BF5B666F723785A506D922D4FF3F872805964FCE92CEBE6EFDA_cppui256),
+                            typename field_type::value_type(0xA7B709E5E762923D8AF0B2D44CE26FD5D43BC8687B36FDF7DF140F32A7AEFC7D_cppui256),
+                            typename field_type::value_type(0x30ABF89B9CF231374978419990F92214CDD6E9AEF061613F5B3A432014978583_cppui256),
+                            typename field_type::value_type(0x4B035115477F7498CDF7B4F2D0E1AB8063120EA23BB584AC446180351DC75777_cppui256),
+                            typename field_type::value_type(0x5D6F8AA313E20F033BB72759D830775BEA2C7820D06EE5E279127AB5C6C88BE2_cppui256),
+                            typename field_type::value_type(0xADC4B18D8D56D4E8C71AAF33AB08BC20EDAB6F8EA6BF92C2892E553F0D7AD75D_cppui256),
+                            typename field_type::value_type(0xE11A6E16E05C44074AC11B48D94085D0A99F0877DD1C6F76FD0DAC4BB50964E3_cppui256),
+                            typename field_type::value_type(0x87D6065B87A2D430E1AD5E2596F0AF2417ADC6E138318C6F767FBF8B0682BFC8_cppui256),
+                            typename field_type::value_type(0x3322D401243C4E2582A2147C104D6ECBF774D163DB0F5E5313B7E0E742D0E6BD_cppui256),
+                            typename field_type::value_type(0x56E70797E9664EF5BFB019BC4DDAF9B72805F63EA2873AF624F3A2E96C28B2A0_cppui256),
+                            typename field_type::value_type(0x8D26200250CEBDAE120EF31B04C80CD50D4CDDC8EADBCF29FC696D32C0ADE462_cppui256),
+                            typename field_type::value_type(0xEBED3BB4715BF437D31F6F2DC3EE36BA1D4AFB4E72678B3AD8E0A8B90F26470C_cppui256),
+                            typename field_type::value_type(0x78BAAFF3015C05BA5D2196B3C67F01BC0B13299C6E73C330ABD9D3F2059AB499_cppui256),
+                            typename field_type::value_type(0xAD4BDCDBDB06C0AFAFCA84E0ED82082E91632EEE8D125199681D2318FEE097FD_cppui256),
+                            typename field_type::value_type(0x1238C0766EAEBEA9CE4068A1F594D03B8ED4930D072D9C8B9164643E1516E633_cppui256),
+                            typename field_type::value_type(0x8A9DB02DBB271359D6C979E2D1C3DC170946252DCC74022805CDB728C77B7805_cppui256),
+                            typename field_type::value_type(0x6F70F211A14AE3D4C20B84984929AB1A23709B36F83A20CA4493E16CFD06ACE6_cppui256),
+                            typename field_type::value_type(0x791E8A3094027B736F95D8F347B99F5075329566BE5AC5EE048BED34B602D5DE_cppui256),
+                            typename field_type::value_type(0x17C072D56BDD1382A782481B8AA4D2232DB794385870BCADC3063330A5CD5379_cppui256),
+                            typename field_type::value_type(0xD901BDF4283DA064E77C1247AF1D034F8959AC76265BAD0DF7CAE051B108CD25_cppui256),
+                            typename field_type::value_type(0xE1599DB29D6AA415F80949F19103CCD48CED485B71E96247DC8EE3EE60EE1B40_cppui256),
+                            typename field_type::value_type(0x793362232A81D4A0EFAF894AAA2FC7CFA6363A74BC32999DE1D6265ED78F93A6_cppui256),
+                            typename field_type::value_type(0x271D5B0770CB9C15E7B2EA758A6A11B9CDDCD7282B0EC21619B01552788E7A66_cppui256),
+                            typename field_type::value_type(0x5D3AA45834E7F491E457D09949AC877FE2A065E3508A824E7A8D7258E03C9727_cppui256),
+                            typename field_type::value_type(0x85672C7D2DE0B7DA2BD1770D89665868741B3F9AF7643397721D74D28134AB83_cppui256),
+                            typename field_type::value_type(0x7C481B9B5B43B2EB6374049BFA62C2E5E77F17FCC5298F44C8E3094F790313A6_cppui256),
+                            typename field_type::value_type(0x534CCF6B740F9EC036C1861215C8A61F3B89EA46DF2E6D96998B90BC1F17FC25_cppui256),
+                            typename field_type::value_type(0xD5715CB09C8B2DDB462AE3DD32D543550AE3D277BFDD28DDD71C7F6ECFE86E76_cppui256),
+                            typename field_type::value_type(0xAC3874F9FFF1D8C1684876075840143DC4872F9C6825E8B6FDF0723A83BA9000_cppui256),
+                            typename field_type::value_type(0xAA65E92308A1C069B862DDE894117F93085E350D7F66E9FA4DA3C7D96F10CF0A_cppui256),
+                            typename field_type::value_type(0xA91D1F5CEE87B7F3081E142018F8AAED79020D47ECFBC8D2C7170923E8BEE8B6_cppui256),
+                            typename field_type::value_type(0x748A324EE2DF8EE15A7189C8DDDAD3B2F800569F628CB225003D16AA410644C1_cppui256),
+                            typename field_type::value_type(0x570D5CE7AA6870139AD14075E9A3E729EC0E3F8578A20D081A606F66ED06DBD4_cppui256),
+                            typename field_type::value_type(0xA6AE5349420E02F605B66E6711D01BBBB683A36DC6460BED5A65BECEBD1ED495_cppui256),
+                            typename field_type::value_type(0x8E891B5CD18FA02A58BEAD0C4848E3C3C3B81A5C2D042989AE5D630B17BA402E_cppui256),
+                            typename field_type::value_type(0xE5D30E0E6A9EC6680B38D0E404F2A306AF650C242157A7EE8E1B6279C4FAD9E0_cppui256),
+                            typename field_type::value_type(0x75B5F87028268BB6F87C229EE0366EF5DAEE32A0D2933928434C1F92092D230E_cppui256),
+                            typename field_type::value_type(0x527CCE21E3A7852363D7874554DDFA8E0267A4B00511F8FB037CBDFBD51570B8_cppui256),
+                            typename field_type::value_type(0xC15C8C23D90C8E35C1A214DDE2D4383C0735AE45BEF61F10AA1A1C255984CF74_cppui256),
+                            typename field_type::value_type(0x2BA954D828522235C8DC6F45E25FD7BA47BF772D50B015A2C4A48CD839CCB000_cppui256),
+                            typename field_type::value_type(0x0948BF809B1988A46B06C9F1919413B10F9226C60F668832FFD959AF60C82A0A_cppui256),
+                            typename field_type::value_type(0x53A562856DCB6646DC6B74C5D1C3418C6D4DFF08C97CD2BED4CB7F88D8C8E589_cppui256),
+                            typename field_type::value_type(0x26952C7F372E59360D5CE4C66291F0B6EF16C1331E825E51396EB0457E8B000A_cppui256),
+                            typename field_type::value_type(0xF513EA4C5800A68862BC893D2D688422DEBE398F653D67318C3D401F05EF705A_cppui256),
+                            typename field_type::value_type(0x9945B2FBE3822BBCB5C3396D2056F849641242EE65E2AA527282FE5FB8C8AC7F_cppui256),
+                            typename field_type::value_type(0x3EEFED824B0F282D607DB44FFB28EFF5282F7A23EEDACDFA96D943A169AEA3B0_cppui256),
+                            typename field_type::value_type(0xC62E58E6FC23C5BDBEF2BE8B131FF243F521196572D6B0E9F102588976134F96_cppui256),
+                            typename field_type::value_type(0x4397827D45B1A1678C3D676753141FC5BCFB853563731C3E82277ED4D14CF97E_cppui256),
+                            typename field_type::value_type(0x2A314C6B205870E6235F82227107D5FE10A0440852BBE1F6ED1D79E3969E353A_cppui256),
+                            typename field_type::value_type(0x15A4AC0BF35A27AC1A463E476BAA1BA0138A54AADB2658BFC25926E1E5746067_cppui256),
+                            typename field_type::value_type(0x0C7D115C0EB4637DB068772C77C95DBF3BD278DE2581318E3BAA499892FCCF64_cppui256),
+                            typename field_type::value_type(0x4AA8747B1925B0447AA424B8478AF14548785D83959AE68D53F6D3B32878FEE0_cppui256),
+                            typename field_type::value_type(0x5959A500B703FC2D498B6FAF3A6B6C911B4F4106DD7F3FF989E2F49EE9B84966_cppui256),
+                            typename field_type::value_type(0x0370E6741F5CA897F94312820DC82A709100DCC08CFE242640A6632187473A6A_cppui256),
+                            typename field_type::value_type(0x107460520EEC5C741683329A716622B0B81C03200807DE973686F8800B188CBB_cppui256),
+                            typename field_type::value_type(0xABE5D4C09A21598C35326B9B9CF54A11242E0D748DCE3DA601D7B6361F272124_cppui256),
+                            typename field_type::value_type(0x6260CE7F461801C34F067CE0F02873A8F1B0E44DFC69752ACCECD819F38FD8E8_cppui256),
+                            typename field_type::value_type(0xBC2DA82B6FA5B571A7F09049776A1EF7ECD292238051C198C1A84E95B2B4AE17_cppui256),
+                            typename field_type::value_type(0x85D8DA4748AD1A73DEC8409BE84F1A1316E65C5196AAD27E0766746F3D477C2D_cppui256),
+                            typename field_type::value_type(0x58948B53665C6690586B536531EFC7BC94B0A02033C4D5A62079816FC7D1DD70_cppui256),
+                            typename field_type::value_type(0x87D127280482DFC33D058937F2333B3D38C46F480D9E3A5BBB0BA46541136602_cppui256),
+                            typename field_type::value_type(0x71CE24870A5A03DE926A276CFF67745387A884746FD3BF7C4F683C41D8AF6AAC_cppui256),
+                            typename field_type::value_type(0x8E2A7166E7EC4B968C0892E9CC3EE3EE4D1E7E100FDC47F04850312D6C0B80D9_cppui256),
+                            typename field_type::value_type(0xEADB0BA9AE2CBE592CEDD29B716A9D485297B688D706349A49C61F2AD6B29F50_cppui256),
+                            typename field_type::value_type(0xFD5D7D3FE261E9746B0ACC63DAB54AA13F5C440D535610F25B205D7348C5A916_cppui256),
+                            typename field_type::value_type(0x0DD83ED0EEB55B07D2B43CA679C7B52FE5D73814BDCF6FAAB14B37B07ADB8BDA_cppui256),
+                            typename field_type::value_type(0x28DF781D4EC05680590F4658713C8A91FEF2376387DDB6DD674A35C8B0E74459_cppui256),
+                            typename field_type::value_type(0xF1499EA66A130F17CB0DB17890F22794A3795BA501AE6F0A8DE07CC0EF5E656F_cppui256),
+                            typename field_type::value_type(0xDE0DD410981C26122BA453C32D34438138765B98B5BD51DD45D9909635F7529C_cppui256),
+                            typename field_type::value_type(0xD70A6E9D10A2145F9B2109822D7A3570178924C6889B774063C20C02E4CD88FE_cppui256),
+                            typename field_type::value_type(0x769BC75842BFF58EDC8366ECD78F8950EE4AB2E81359D90F9921FA3D2C4561BE_cppui256),
+                            typename field_type::value_type(0x4BF817362FE783BAC8DCE4CEF73F5D4741A177767B7873ADD5920BFFB0D9685F_cppui256),
+                            typename field_type::value_type(0xE5037DE0AFC1D8D43D8348414BBF4103043EC8F575BFDC432953CC8D2037FA2D_cppui256),
+                            typename field_type::value_type(0x4571534BAA94D3B5F9F98D09FB990BDDBD5F5B03EC481F10E0E5DC841D755BDA_cppui256),
+                            typename field_type::value_type(0xA5E00DA467FD5494F40B6CF7D2D61B3EC3AB217C792A2DDB8C63C8C79E3D34EF_cppui256),
+                            typename field_type::value_type(0x098FE5F5E5608555421726FE99BF43D25B60DCFE790900ACB855C5CE2F7ADB4C_cppui256),
+                            typename field_type::value_type(0x9D896A3AFF9633CEE58543BACF5291AEB5E1559388ED95F6388A8A6E177E7775_cppui256),
+                            typename field_type::value_type(0xDD91A9E43F49BF0B94E964ED7250927DE899CD7EE299253BEFCF6D3ABA056691_cppui256),
+                            typename field_type::value_type(0xA99415F5EF3A2B403519F4BB1C9BFBC46D4AFD2E4477572AE6737160D7B91252_cppui256),
+                            typename field_type::value_type(0x82D0E64CAE81F84BB9E2F10F24F6F6B6899A16AD590F4DDD73A377AC4BEDC264_cppui256),
+                            typename field_type::value_type(0x8327B8EE71163792D0EB0A573282F4CD5688B86EE903476C5FDE04DE3C2A3293_cppui256),
+                            typename field_type::value_type(0x04997E266EE0A98E18BB3EA66279708496AFDAB4EE326A416BC854E18E0DF9BD_cppui256),
+                            typename field_type::value_type(0x00CF8C2D2DB818DFF97F8E6431272384DF2A74589058578415957F1E8C904ED3_cppui256),
+                            typename field_type::value_type(0xAAAD000EA781D44119DD5C1BD51BD81122991D79D32F6827B009963B796F77C1_cppui256),
+                            typename field_type::value_type(0x5AE42AAA2A6DB16897D6661D8F9A8ED6092D23234B8DFB1A2421B26C4562C042_cppui256),
+                            typename field_type::value_type(0x99D93A7C05FF051EAB5C1DDC60389D4A94E0DB95107CD8DBF905CCDF8F79269C_cppui256),
+                            typename field_type::value_type(0xB56F4E9F9E4FD1FC7D8EDDE098F935F84C750D705F0C132BD8C465B66A540F17_cppui256),
+                            typename field_type::value_type(0x32E8E53429CCA856D3DC11ADF0582D1D21D42963CBCCA85446A2FCAE0200102D_cppui256),
+                            typename field_type::value_type(0xE06372B0F4A207ADF5EA905E8F1771B4E7E8DBD1C6A6C5B725866A0AE4FCE725_cppui256),
+                            typename field_type::value_type(0x7A908974BCE18CFE12A27BB2AD5A488CD7484A7787104870B27034F94EEE31DD_cppui256),
+                            typename field_type::value_type(0x0EAC134CA2046B8F9C8DBD304FAD3F3C045EBFDB4EC6ED3CFE09AEE43ED2FF3E_cppui256),
+                            typename field_type::value_type(0x49630DBE79359B4245BF103BF2B11799AC19F696B7F21376E17206207D210988_cppui256),
+                            typename field_type::value_type(0xC663C05BA6234E00A346899185B08FA7B24D773A95ADC18BDBAA8188DA328D6A_cppui256),
+                            typename field_type::value_type(0x3331E98D5F721C38D39AFDCF27571317DD8551EA512BF9CC23B0BB6ABEC9B8C0_cppui256),
+                            typename field_type::value_type(0xD6788590731FEA198392119D7ADBB41FF5948A7804C85B17476706E4DFBFA4DC_cppui256),
+                            typename field_type::value_type(0x28EAA8C89D5063C4940EF5C6D21C13AA6206F1C4DDC9A07CCA7BCD6BBD3B5406_cppui256),
+                            typename field_type::value_type(0xD3FC2682DFB86A459CEB30DEEA0FE4E977CEDF2EE0B25114BC91C8483996DE2F_cppui256),
+                            typename field_type::value_type(0xC4F0DF99A45F0A18F68B4754D4F781DA4E59B498DF7ABF168C492241D4526F8C_cppui256),
+                            typename field_type::value_type(0x292ADC1C33AF83790CFAFF3394799597A9FB92830BC205DD6DC35A6562143FB0_cppui256),
+                            typename field_type::value_type(0xA072661BCEE0B647F3F1968A0CC4ECF6D83E662D735E9D4D8A9DB63CE36AD01C_cppui256),
+                            typename field_type::value_type(0xC17A4B43FEB2C0237DCA1FEC9A3FABD19CE678FB985F83E85C6C48D103E697EA_cppui256),
+                            typename field_type::value_type(0x39355C2D55AB5954CAE178F719601FAE96E1A1B57F9F02AB0EE3B87DDEDC6C87_cppui256),
+                            typename field_type::value_type(0x6930FCCBD9A040974ABF210F12B71D4BC7B1A6205599B01A7275FB40E48FF9B3_cppui256),
+                            typename field_type::value_type(0x7F02AE94B94701EADA30FCDB875F6D78090F9B13E4ACC51ACFDDAB5F8EE96A4E_cppui256),
+                            typename field_type::value_type(0x213C7A715CD5D45358D0BBF9DC0CE02204B10BDDE2A3F58540AD6908D0559754_cppui256),
+                            typename field_type::value_type(0x4B6DAD0B5AE462507013AD06245BA190BB4850F5F36A7EEDDFF2C27534B458F2_cppui256),
+                            typename field_type::value_type(0x1C5E548132B49A7F66AE9FED8323480E0D1AB974622E7CF08993895E0EC87FAC_cppui256),
+                            typename field_type::value_type(0x4FFCF60F837F468F2BB959FA1D4C2AD3A3DEACEB26FE324C555D7B3D5FC2D4EF_cppui256),
+                            typename field_type::value_type(0xB8CEF6E1753DA0309546E096B953D172AE3FA3ED4C19A93E532D80119E05DCCC_cppui256),
+                            typename field_type::value_type(0x302B8A60A6CC9BBF6A4D4A74E4D2BD99DF757FC36A6B68133014A0CFCC6D5750_cppui256),
+                            typename field_type::value_type(0x46276D0602C5668DDEF6E94210BBC7CE1F901C19FED5C970E20FCBA1D4531DBC_cppui256),
+                            typename field_type::value_type(0x0E0F7F24D44C75B84A292287570DED99498BADFBFFE1BC99AF8730099686B8E2_cppui256),
+                            typename field_type::value_type(0x03FB33E779B47385E02A0BDE2EBB5F49701F7B6B5FDB97B485BDFEE1373BB31A_cppui256),
+                            typename field_type::value_type(0xF36AD952548EFE281E0C161AABBB572BC65A7C76C47640D4E34CBE697D215C9E_cppui256),
+                            typename field_type::value_type(0x3A571630935C1F02D6FD87442C082060CD5E792A1C6F92BD0C4EED01686DF50D_cppui256),
+                            typename field_type::value_type(0x85E13873B599F32F516F3FF2E570A0DDE0AAF81EBB781A11D2158B28E859679B_cppui256),
+                            typename field_type::value_type(0x4B177CD109EC3E1161F16F7B4D0F7A36717C36C1855BB7C0A5B515EBDD9A4AB4_cppui256),
+                            typename field_type::value_type(0x3EC966E9A5E2FA65FDA8F67293626B486E37E255F1741F558AADDFE4635AB6F7_cppui256),
+                            typename field_type::value_type(0xEFEA68ECA7A6C24F4E65EB211C3191636850E0ACDC78D8996114EF13522F001D_cppui256),
+                            typename field_type::value_type(0xAAB847869D583C14DA150307A3719A17E413959FB3848771C128419F73BC4415_cppui256),
+                            typename field_type::value_type(0x4E7C272A7AF4B34E8DBB9352A5419A87E2838C70ADC62CDDF0CC3A3B08FBD53C_cppui256),
+                            typename field_type::value_type(0x17749C766C9D0B18E16FD09F6DEF681B530B9614BFF7DD33E0B3941817DCAAE6_cppui256),
+                            typename field_type::value_type(0x899017B02696888F268A269F4E385D9C9B11F25A1BEF8790E2821E6E7C6E1B4D_cppui256),
+                            typename field_type::value_type(0x43AE2CDAB5B334F0BB45798336358BFAE4E51BC0F932B212009AEBDAD814AB2B_cppui256),
+                            typename field_type::value_type(0x02484E3010C9455C75E44D2BE9AE24A5233C0717E9AA750CEE298464E521B3FF_cppui256),
+                            typename field_type::value_type(0x9619D0A0AA23E30D07EC2B3C2B2D0EEBAD7006DE923AC8BBCC1AE4B90269DA7E_cppui256),
+                            typename field_type::value_type(0x67F644F76E905FD4A8F4728E63227F0E2831F5BF91B583A8AF2635A17E5F712F_cppui256),
+                            typename field_type::value_type(0xB833D68F66445D04F05ADEB7B586CF785E0E1488F7D36198D68ACB5E707160E5_cppui256),
+                            typename field_type::value_type(0x16C1C526CFB6CE57EF79B70D672C954E20D6A47030741751F96B79FA804BA7B9_cppui256),
+                            typename field_type::value_type(0xDB157F7C34031439062627459C8A94DEEC755C01BDC9A9CC475BE3A51C5BD741_cppui256),
+                            typename field_type::value_type(0x4E53C8B49901FF800E0AADEF4B1F190EDCF43C6CCBD90DFE2B26096140692FD1_cppui256),
+                            typename field_type::value_type(0xDD6E3E4F4D41A01E186CD709A7219DA1A87A50DA57FC9753934930E7328625E0_cppui256),
+                            typename field_type::value_type(0x03973CD753F931AF87A89CE774527B6695821B5380EC0825E836487AA36683FA_cppui256),
+                            typename field_type::value_type(0x38CF5A2CC30CA3A3643E12B632B5A26CD77884E18FE981DEDF5FB2B77F4A577F_cppui256),
+                            typename field_type::value_type(0x327F876C93652555FA80A054968B4712930DC93012EE6B8DC10263ED3B89A762_cppui256),
+                            typename field_type::value_type(0xB2D404EAB3524026B09969255E1997B975535070FEBD7DFE9C9FD959B9203301_cppui256),
+                            typename field_type::value_type(0xFEA74E3DBE778B1B10F238AD61686AA5C76E3DB2BE43057632427E2840FB27B6_cppui256),
+                            typename field_type::value_type(0x6E0568DB9B0B13297CF674DECCB6AF93126B596B973F7B77701D3DB7F23CB96F_cppui256),
+                            typename field_type::value_type(0xED9441C8304280FF180E03D850E8CD0EBB570EE5DE3730488FD97C961F9756E4_cppui256),
+                            typename field_type::value_type(0x3DBE9E9EFE8BFA19AFA176128B13911E09F23774FE4DE98BFF0E09F93F3ABFAE_cppui256),
+                            typename field_type::value_type(0x762E8BC33211FEA8226CD97B271899F3F27B64997B004BB25DD81AE9BE889756_cppui256),
+                            typename field_type::value_type(0xC02894260AF3E97C3C7CC4F14982E3471972DB314884FA5E25E259E07CA6B774_cppui256),
+                            typename field_type::value_type(0x29D9698EE67A7C3FC9FED3F624B487515B10BDD84FAB4D3015BAD033D51CF119_cppui256),
+                            typename field_type::value_type(0x7FD02C517DC82B45277A125404F1C96FB89C940E93A7C2963C88740575056339_cppui256),
+                            typename field_type::value_type(0xDF077D47DF6095348E19BDBB2308F4A91E52ACFA1014E8EA26F75E970975D2EA_cppui256),
+                            typename field_type::value_type(0xF8617A8800EF7F4424C8425C98A2527C8A1EC5B84FBDD277AA3C2D9E31936F95_cppui256),
+                            typename field_type::value_type(0x38B82A75579AD36B9D47EF64F1A5A85C247F21027E56C6C2875580A5A6714560_cppui256),
+                            typename field_type::value_type(0xF9D8A6976F261EF428BF5634616434597D94F23BEF716284ADA87334A774299E_cppui256),
+                            typename field_type::value_type(0x9F3E7D758BD3DA032E17DEA8334B142935DB4D6EE54391B45B8491FBBC4C92D7_cppui256),
+                            typename field_type::value_type(0xECD2841EA77D466B58862B21CBAB1502452A2303D694E1186CBBBFCFB14906DD_cppui256),
+                            typename field_type::value_type(0x126B57D05013936D6F3FB7BD33580A31FD453E4A86060CFF467C44537F422491_cppui256),
+                            typename field_type::value_type(0xC1A7DC13061662C2E3C4A3EBA2BF3FB0E148BAC30BF39347AFA31F199DA3EF84_cppui256),
+                            typename field_type::value_type(0x76E64113F677CF0E10A2570D599968D31544E179B760432952C02A4417BDDE39_cppui256),
+                            typename field_type::value_type(0xC90DDF8DEE4E95CF577066D70681F0D35E2A33D2B56D2032B4B1752D1901AC01_cppui256),
+                            typename field_type::value_type(0x708A530E9E52C73BEE87C9D88161C810005D57622C29AE691CF999A83A1187A5_cppui256),
+                            typename field_type::value_type(0x9B884811E1F9A897FA9656DCBB6D38283ECDA73C6D353E8A58A4F19B473DB9C0_cppui256),
+                            typename field_type::value_type(0xD08E57AD859DA9BE25FF7263AA9B4FF64EBF20CE506919442F05091CC078EE8D_cppui256),
+                            typename field_type::value_type(0x852E97984AB488D72D6172EE757E6DF4123EF7CF9422ED9DE997F4DC2DA63E86_cppui256),
+                            typename field_type::value_type(0x19CF034FC48B3BE219BD648395E462CF9F374B6D86B2B59E2E1B16C6CDE4F5BE_cppui256),
+                            typename field_type::value_type(0x28E32B06A15AB466C3B4BE68AB181947EF91D1C93F0F1C0C0A91532B6F321AF2_cppui256),
+                            typename field_type::value_type(0x7DA6C085E4D44D275F58BE80ECD31D080CAE3ACF1E48254815914670429129EC_cppui256),
+                            typename field_type::value_type(0xF498146BB9F41857511D0207491627BF0448C08654CA586AEB50AEE2ACD9FF0E_cppui256),
+                            typename field_type::value_type(0x5335CEA5E99EEB23765B3444D9BC7BE601DA67D691BCC42FD43AE5430E9C22BC_cppui256),
+                            typename field_type::value_type(0x3BF8D020769C5224A067F080F0CEB86AC8C30C236CA1F19B3C2C2672CBDACB60_cppui256),
+                            typename field_type::value_type(0x90D090CFF5C1BE6E21BE9001BE69D94FB2F7F394231AAEE94F83D49551654F22_cppui256),
+                            typename field_type::value_type(0xCD569A1D2BACF61A953F021E06BF70336DD635653DA3F8740F5DE057601A43E1_cppui256),
+                            typename field_type::value_type(0xAF6C44A078CB5F0D7C719C2F8397F576EE93BD034BEA2219E3ABC209D17CF3E8_cppui256),
+                            typename field_type::value_type(0x0784096FE85D4B30AF9E73153CB246DFEC362AEA7CA0D435B8ADD0601751BAEA_cppui256),
+                            typename field_type::value_type(0xC738C56B03B2ABE1E8281BAA743F8F9A8F7CC643DF26CBEE3AB150242BCBB891_cppui256),
+                            typename field_type::value_type(0x893FB578951AD2537F718F2EACBFBBBB82314EEF7880CFE917E735D9699A84C3_cppui256),
+                            typename field_type::value_type(0x5578845ECD7C037435B32A6992E7AA94647197EA49B8C9E4DDAAB0784662AB1B_cppui256),
+                            typename field_type::value_type(0xE61D07978B6DE2C3CEA6D0A51D2A4053F653A7746A5D64DE316D18F3056F3511_cppui256),
+                            typename field_type::value_type(0xB8C46127823F614610A240A35720DF7ACA4C9BE408D60E2F34BAAF338761D58D_cppui256),
+                            typename field_type::value_type(0x8F9ED96C5170E37D14A458F697F3C5053F7504785E107C5B638EA0BA9D1051A4_cppui256),
+                            typename field_type::value_type(0x47F3383888A364CC4ABFA3BC1D0CECCD22F12354FCE3996094F869B8948B6C29_cppui256),
+                            typename field_type::value_type(0x48CA9A8D0F032937190E48675B416C7118BB499588F994A81EDEE1120E537EF9_cppui256),
+                            typename field_type::value_type(0x08D56E9F710271F7A350C993FE9A3671F3F47DB9F0134ADC2DB0B304050B0040_cppui256),
+                            typename field_type::value_type(0xA12185AEBD0A9AA21FFD150A8D79B285F6D7C4720E1782BEB58E267A5B3FD0A1_cppui256),
+                            typename field_type::value_type(0x6B00403318818D2B7C78125D8E480A2ECAEEBF4A41FFF36DA14DEA1A1166FF40_cppui256),
+                            typename field_type::value_type(0x41CD1B3AE8AAFAC9968943A0590BF2F0076883F6E7F3EDE9EB74130E9D71B847_cppui256),
+                            typename field_type::value_type(0xDC13F232D42FCE6341E20F977BE65A37889A1C5ED30B6270F56563DF13573B7F_cppui256),
+                            typename field_type::value_type(0xC909BA80429E340C3C7410DA84A90A767045547017404B1C42ACD2284C1F2BA6_cppui256),
+                            typename field_type::value_type(0xC0C01F34AE41B8CFE466B4C9C6A5D5F614F570D6FCBEF768A81A6C8F05FF4ADB_cppui256),
+                            typename field_type::value_type(0x0B84F5BEE4357F5C7C937A0B4075B8CECDBC43D170D15B85FC4EFF73AC351065_cppui256),
+                            typename field_type::value_type(0xD895626548B65B81E264C7637C972877D1D72E5F3A925014372E9F6588F6C14B_cppui256),
+                            typename field_type::value_type(0xFEBFAA38F2BC7EAE728EC60818C340EB03428D632BB067E179363ED75D7D991F_cppui256),
+                            typename field_type::value_type(0xFD136EEF8971044E8A3A43622003A26703ECAF7A0EC40C3FBA5B594B77078424_cppui256),
+                            typename field_type::value_type(0x218DA834F3C652CC67A1D191B5C5EFA57CF2B1F78A2ADFA8CD61EEEFC671DDF1_cppui256),
+                            typename field_type::value_type(0x6D8C782F716DF12672D362DA5060B41603428BE4ABA0970480BA87FF6127B756_cppui256),
+                            typename field_type::value_type(0x99AEDF0896FDB9111459A82D36D34DAF4E3AA6DA2D7CDCCA6551F74ABF172571_cppui256),
+                            typename field_type::value_type(0xD99E8E9DD9638D140E9CCA5367519F861B7003A0D43F024A5F1D84EC8DB1CB3C_cppui256),
+                            typename field_type::value_type(0x36DC19AD1CC0A3A7A945BB321BCEBA6E6286FEF8FFC8765CD88A29E36B8637A7_cppui256),
+                            typename field_type::value_type(0xEBCABEDD95BF7ACA8D059AEF1B4097F8F1F85DCBA58823524DEE1A73758CF17A_cppui256),
+                            typename field_type::value_type(0x47D3CE0F8F22B9CB02C00A1B67C32E6B10FAD212D0ACE95C446CDC5F5CAA0CCD_cppui256),
+                            typename field_type::value_type(0x56C9DA9467CACD5B48CC1F2B4AAE67140DF701CA8ECEE258E4C4B2C551A3C43C_cppui256),
+                            typename field_type::value_type(0x38D46ACB42C79EC2F33C7964DDCB685241D40FF932EDCAA1824D8B7D20D7C9ED_cppui256),
+                            typename field_type::value_type(0xE8DF4D2E4BD4CE2445331A369E17FC281185621A017C8AFBBCEEE515AC855C5B_cppui256),
+                            typename field_type::value_type(0x6C57FD70C47F9B264444DB4F59EF32C59663B55F1E1E4D7D59D5E72C2E465650_cppui256),
+                            typename field_type::value_type(0x03FDF1619A198317A1BD8A54E5B09191D203351E0440E636FD46F68D3C385172_cppui256),
+                            typename field_type::value_type(0x408D02C06E5C12C3FE470C7D3C8573755B9B929E90E7232B79AC67F0FCCB9794_cppui256),
+                            typename field_type::value_type(0xB8DA94032A957518EB0F6433571E8761CEFFC73693E84EDD49150A564F676E03_cppui256),
+                            typename field_type::value_type(0x2804DFA44805A1E4D7C99CC9762808B092CC584D95FF3B511488E4E74EFDF6E7_cppui256),
+                            typename field_type::value_type(0x6D36D105ED8CC5CE53F2CB698AB620F9469A3E5CB25BF6E6D413F414C5AF726A_cppui256),
+                            typename field_type::value_type(0xE4BA5C34E377669E72D8C66C95C50029DCC59936B4108A35C570491A13F9FC7D_cppui256),
+                            typename field_type::value_type(0x069068FF0982D10BE54C761F14D152C05ABE7B10385AF1C5EA19849DC6E1346B_cppui256),
+                            typename field_type::value_type(0xB863E3E090BFDE26DA85DB2BD086442AA4F6893994C6026E7BB58A54D7226C13_cppui256),
+                            typename field_type::value_type(0x3AB6BDE10CD3AC0CD06883FA66F0B0E3EB1309C0534B812286E2A30CA540DB99_cppui256),
+                            typename field_type::value_type(0xBACA62079BE871D7FC3117A96A13E99C38D137B0E369C043E6873FE31BDA78A3_cppui256),
+                            typename field_type::value_type(0x898C3493CB2597615286DC5CB1E86CE1068CBD14348CFF1A30E691FCDCA1F6A1_cppui256),
+                            typename field_type::value_type(0x75F75986AB56A5549D84542452AC6E93B2A7CF979F2BD79CA4ADC20F164F647C_cppui256),
+                            typename field_type::value_type(0x063C462435EF974B393B05B37D1C89D70B0D8958EBD541D7584E2BBC7235C795_cppui256),
+                            typename field_type::value_type(0xE27F9BB913038404431F660D931C85B69E4ACBACFA49A9BD3F32DC095B110258_cppui256),
+                            typename field_type::value_type(0xB213E2FED2918BF01A5299D7022A274E5E56C8B917A04328AA69E03C3D1E3998_cppui256),
+                            typename field_type::value_type(0x229F8EC20F2D3C12C3D61EBF83A43BC3D534165BEBDED175EC2CBDC6325FB81E_cppui256),
+                            typename field_type::value_type(0x796634E3F1AD56F0FDBA069D9D07BCE2BA2FD4F373DDD3BA7777BF279F1048DA_cppui256),
+                            typename field_type::value_type(0x4D8EE2B6CFB20B8956DE74735A7927F2532576D8CFD74862E8F9BE24A106CF01_cppui256),
+                            typename field_type::value_type(0xE80FEA14441FB33A7D8ADAB9475D7FAB2019EFFB5156A792F1A11778E3C0DF5D_cppui256),
+                            typename field_type::value_type(0xEED1DE7F638E00771E89768CA3CA94472D155E80AF322EA9FCB4291B6AC9EC78_cppui256),
+                            typename field_type::value_type(0x440CA1F08EA41265981AC4ED1EFE7A37122DCC3877D2F9162DB0E78B0F83CD58_cppui256),
+                            typename field_type::value_type(0xA6C8B0D2CD5EE122AF8954DC9D4E2F02A21E4D4269C0A260B07BC069B88A3F4B_cppui256),
+                            typename field_type::value_type(0x5D2EC6DBC4A1052608AFEF69633CE3B106D5B94740E350192C0359ECD7592D55_cppui256),
+                            typename field_type::value_type(0x0A92CDF89C6E45EB58F710FA268CD6950E2A7BCDAD115174266E5D0EAF5183A7_cppui256),
+                            typename field_type::value_type(0xF694CBAF2B966C1CC5F7F829D3A907819BC70EBCC1B229D9E81BDA2712998B10_cppui256),
+                            typename field_type::value_type(0x40A63EBA61BEF03D633C5FFACC46D82AEB6C64C3183C2A47F6788B1700F05E51_cppui256),
+                            typename field_type::value_type(0xAC371DC3B11BF742FE2CAE34215F404D7361F1E159880A51991F4B49FE8F9F5C_cppui256),
+                            typename field_type::value_type(0xC51616C18709A477FF2101E73254E73522953458EE751E1D17A83FF3325A503C_cppui256),
+                            typename field_type::value_type(0x62782899CEB96CC8E5DD3C25223CAE4FD964C6ED570D9027A744B8F8E55BF84C_cppui256),
+                            typename field_type::value_type(0xD670ACA40911A28901C54972297267839A020DE7DDD176ED6F51CFAB5F15FA2A_cppui256),
+                            typename field_type::value_type(0x8942003A14F1840C9348C0BD0222A17A40893BC452AF385DF4A1C8D519E33446_cppui256),
+                            typename field_type::value_type(0xA9FD039595A5077A4D8B2D6D0EFDE4E06BFD773679E74F9840D38A00E6387689_cppui256),
+                            typename field_type::value_type(0x8B6E862A3556684850B6D4F439A2595047ABF695C08B6414F95A13358DD553FD_cppui256),
+                            typename field_type::value_type(0xEA5E08910ED11CB40D10BC2DF4EB9FA124AC3C5A183383D0D803DAD33E9BE5ED_cppui256),
+                            typename field_type::value_type(0xA301697BDFCD704313BA48E51D567543F2A182031EFD6915DDC07BBCC4E16070_cppui256),
+                            typename field_type::value_type(0x7370F91CFB67E4F5081809FA25D40F9B1735DBF7C0A11A130C0D1A041E177EA1_cppui256),
+                            typename field_type::value_type(0x27E1E59CFF79F049F3E8D2419E0BFF74B43965004C34B5D811420316F24BA5AE_cppui256),
+                            typename field_type::value_type(0x310B26A6C804E209EE1B5E3CFC79DF05DF48A1A69AFA63F784A5BFEE883A45B3_cppui256),
+                            typename field_type::value_type(0x6E8313A30815EB11156B133082200A4D83596A67AD72856267012700138011FC_cppui256),
+                            typename field_type::value_type(0xC147818BDC24F204C1A12DB201DAC30426AF915AE9C51F9A6ACB69FA3F15AB7D_cppui256),
+                            typename field_type::value_type(0xC712E7A5F6864AEE16588EC3892D7E4F5A39ADDE84FBFB4F9969175C9CAED7AE_cppui256),
+                            typename field_type::value_type(0x49644107516363B365ED4B82311DD9E5380D8E544B0CE63784D148AA46156294_cppui256),
+                            typename field_type::value_type(0xF952A9099784851F2BD1E038A4D9E1B43D36EC5B44916F7F53A749B8D00E6BA7_cppui256),
+                            typename field_type::value_type(0xD8A93A5B08ABCEBF861376A2E27FA0F65557167B4C62A2B98DBAEEE50175E4C1_cppui256),
+                            typename field_type::value_type(0xA5AC7D1D04CDA30C83A053AAD09876CDBEB32B53D38B2021F9549F5C595B6F7E_cppui256),
+                            typename field_type::value_type(0xDF0B8A0AB540F55B36CC3C9247D9EE1B99E39160F5818A4848DBB7308AB19C84_cppui256),
+                            typename field_type::value_type(0x94016D5E31D3FEE7504031A19D9E893A8F2E3943AEFB1F62690065A283AA0E93_cppui256),
+                            typename field_type::value_type(0x675032EE5C454D9640355D354EEE6FD7F484373BAA57B07A38EED26887ADDAC2_cppui256),
+                            typename field_type::value_type(0x0BFC0504A4B3235D065C0D426B8675FCB2C85D6F58275D791B43E1FE44A6DB03_cppui256),
+                            typename field_type::value_type(0x1955467A6C34F3453FB8EC7F94A6C99237427197345D4F0558AC8D1A464B8542_cppui256),
+                            typename field_type::value_type(0x90AD85B389D6B936463F9D0512678DE208CC330B11307FFFAB7AC63E3FB04ED4_cppui256),
+                            typename field_type::value_type(0x0E507A3620A38261AFFDCBD9427222B839AEFABE1582894D991D4D48CB6EF150_cppui256),
+                            typename field_type::value_type(0x7E2CD40EF8C94077F44B1D1548425E3D7E125BE646707BAD2818B0EDA7DC0151_cppui256),
+                            typename field_type::value_type(0x905B75082ADCFAB382A61A8B321EF95D889BEE40AEEE082C9A3BC53920721EC7_cppui256),
+                            typename field_type::value_type(0x186E497334E4231BA1986BCA426B6C76F13C4311BCF638166275DB33B0B7B678_cppui256),
+                            typename field_type::value_type(0xC0D460E49807BD84AA7FC825C0B7E67E11077225449535DCA7A076F2F8D91FC1_cppui256),
+                            typename field_type::value_type(0xA146F52195BEDACE21C975BBD1EF52A79C636BF9DB853CF90E103AE41345E597_cppui256),
+                            typename field_type::value_type(0xA5A99B0AB053FEB09AE95DD2DBB31B40EA67A5B221F094B07675676AF45A770A_cppui256),
+                            typename field_type::value_type(0x061C8D834F6DBF62E7E06B34C3B72412984971F2EF5A55D0CF06E5CBB3421FB8_cppui256),
+                            typename field_type::value_type(0x6DFC6AD99003B4B7BA9392590E05EB5C8067134B3A6FCDD2995EF6684E3CCD80_cppui256),
+                            typename field_type::value_type(0xFD9941CEE1C26864248F7035352787D1ABA9E93EF5EDD333D08C89B84BB9DC8F_cppui256),
+                            typename field_type::value_type(0x7A41EC75BD40E6F46DE97E05788859E67872B2FDEEFE938D743EAE53E59780D5_cppui256),
+                            typename field_type::value_type(0xF6A6B63A208EE513B7363240733A68AD889F37A6AB27FB487124BE18AF6B35A4_cppui256),
+                            typename field_type::value_type(0x3DF7C8A8002D138B1CAD3704F560186F19D5756E75EE1862CAEB6FEC81F422A6_cppui256),
+                            typename field_type::value_type(0xD24C75A1CF1993B9BCFBF9DAB25A8114DBDE421EFECCC4E20CBB53FC4CE45444_cppui256),
+                            typename field_type::value_type(0x58FE1D2DE84DC1D1CFCB7D1810E5A78ABF7593F499F1E524CB93246987DD4A57_cppui256),
+                            typename field_type::value_type(0x8F68B9D2F63B5F339239C1AD981F162EE88C5678723EA3351B7B444C9EC4C0DA_cppui256),
+                            typename field_type::value_type(0x662A9F2DBA063986DE1D90C2B6BE215DBBEA2CFE95510BFDF23CBF79501FFF82_cppui256),
+                            typename field_type::value_type(0x4D49AEFD784E8158FCAFEBE77FD9AF59D89858ADE7627EAEE6847DF84CF27076_cppui256),
+                            typename field_type::value_type(0xCD32FC59A10DD135E723F210359CA6F06E0F2D1A7DF4D8466B90B66203AA781E_cppui256),
+                            typename field_type::value_type(0x38381DBE2E509F228BA93363F2451F08FD845CB351D954BE18E2B8EDD23809FA_cppui256),
+                            typename field_type::value_type(0xE4A32D0A0FB917DCB09405A5520EB1CC3681FCCB32D8F24DBD707518331FED52_cppui256),
+                            typename field_type::value_type(0x7564539E85D56F8537D6619E1F5C5AA78D2A3DE0889D1D4EE8DBCB5729B62026_cppui256),
+                            typename field_type::value_type(0xC1D685413749B3C65231DF524A722925684AACD954B79F334172C8FADACE0CF3_cppui256),
+                            typename field_type::value_type(0x49262724E4372AE6F6921B82AA4699A1F186AEA5401226303EA4264897C2A310_cppui256),
+                            typename field_type::value_type(0x1337E773BCA7ABF95A2CFA569714303B6D163612A75FF8CE0C41B6815E27DED0_cppui256),
+                            typename field_type::value_type(0x6A664A356AA5705E6808A6ED7C44AA2BA5A362919F5D0B81F8166C1903663DA4_cppui256),
+                            typename field_type::value_type(0x449A125954FDE98B29F86EC196BF0CD5089916127E6C04C9C28313FB33FC22C4_cppui256),
+                            typename field_type::value_type(0xE306568C1A240C90D5E253B3E477E2F84DCC1A56FF06DB8D1384B079CEBD2D31_cppui256),
+                            typename field_type::value_type(0x0EAC6FE378934260888F2B107F7D0DB6FFBC8042BE373826692B408392546E44_cppui256),
+                            typename field_type::value_type(0x210A917AD9DF27796746FF301AD9CCC878F61A5F1FF4082B5364DACD57B4A278_cppui256),
+                            typename field_type::value_type(0x670E1B5450B5E57B7A39BE81F8D6737D3789E61AAFF20BFC7F2713FD0C7B2231_cppui256),
+                            typename field_type::value_type(0xE4F3FB0176AF85D65FF99FF9198C36091F48E86503681E3E6686FD5053231E11_cppui256),
+                            typename field_type::value_type(0x1E63633AD0EF4F1C1661A6D0EA02B7286CC7E74EC951D1C9822C38576FEB73BC_cppui256),
+                            typename field_type::value_type(0x4B30CBB7686773E01EC64110ABDB362F88531A825BA172953BFEE2233BCDAF2F_cppui256),
+                            typename field_type::value_type(0x74C6350265BB629B6F9E2C5777C3C4A91FDF3C81E434857568033D463D26B5B7_cppui256),
+                            typename field_type::value_type(0x900C3241BEE44FE90832F51FEB470DECA2F56E03212A99465399F04E6BF05BD6_cppui256),
+                            typename field_type::value_type(0x6C31F9E8E8B1F0F5F95C7204570B2439D69853583C4EFB15DE52AD3BF00D358B_cppui256),
+                            typename field_type::value_type(0xCBB434AA7AE1700DCD15B20B17464817EC11715050E0FA192FFE9C29A673059F_cppui256),
+                            typename field_type::value_type(0x4A1A200AB4DABD17562D492338B5DFAD41D45E4F0AD5F845B7DA9642227C070C_cppui256),
+                            typename field_type::value_type(0x5A8D0362AB0590AAD628CC3403C233CD82E0DEEF7B1385257A7C28CC9F105C50_cppui256),
+                            typename field_type::value_type(0xC059EAB113D4E536936A6B724143FF74A605F68A66D013C35C9B201838A4CDE9_cppui256),
+                            typename field_type::value_type(0x29DFE4805CD534B91A6289EAEDF7EDC6F158EBA3F00D0DD5BE6FB2F7A72E294D_cppui256),
+                            typename field_type::value_type(0xBF66D826D00672E19B434E7588A05E4DD1F1961C3929EE6944137260EC469B52_cppui256),
+                            typename field_type::value_type(0xD93F4D031232F60A48EF3A5776CBA4E83772F8A59292292C647E18B9B2D64FEB_cppui256),
+                            typename field_type::value_type(0x7925555D45CB2733A237311C54DC8C4D93E0430BEEC90DA37B0FBD5934698359_cppui256),
+                            typename field_type::value_type(0xF478056D9C102C1CD06D7B1E7557244C6D9CDAC5874610E94D4786E106DE12C0_cppui256),
+                            typename field_type::value_type(0x7F09E610F33E3946E68095E01068694C26C17EF609AB92D769A76CE6CA5361FE_cppui256),
+                            typename field_type::value_type(0x8C00FA9B18EBF331EB961537A45A4266C7034F2F0D4E1D0716FB6EAE20EAE29E_cppui256),
+                            typename field_type::value_type(0xEFA47267FEA521A1A9DC343A3736C974C2FADAFA81E36C54E7D2A4C66702414B_cppui256),
+                            typename field_type::value_type(0x24CFC0176DA2B46FA8BB5BF9636BE1EFFD7E297F29122FB3E84C9AB0C18ADA5F_cppui256),
+                            typename field_type::value_type(0xEBFF8FBB079C61A69868714D5DEDA927ED959CA1A4F814F268FA6139978A586B_cppui256),
+                            typename field_type::value_type(0x36362AA7E907DDF874D07A084C2A8D2050A680E6EE54C9EAC3F95603EBFD913D_cppui256),
+                            typename field_type::value_type(0x48F278676CB8AFD53416244370DA2A82D830BB10D6B2FAAFC44F9AEAC52E243D_cppui256),
+                            typename field_type::value_type(0x004A7D58D4B9BC82EA2DED72A1292EC616DDD67FC7F057EDF103189594679DA2_cppui256),
+                            typename field_type::value_type(0xB98AC5B76702CB75E6B1D8147EC71B3B71C3B494963FA28A4877F484779FFE26_cppui256),
+                            typename field_type::value_type(0x4487976DF32A1E02F295AD962DD9200DFCB1E3BAB7BC6C967CABABF9AD132896_cppui256),
+                            typename field_type::value_type(0x27BD5860D115AFE1EFC9A90774561A3306B40D5A6276AA7A48C01B12AF685248_cppui256),
+                            typename field_type::value_type(0x8F3CCF31F8B74B9B624A5D1B7CB1096E202FE5E7233777AA859864D3775732C0_cppui256),
+                            typename field_type::value_type(0x67F1CD3E2D39E53189EF46D997CE53D8A90E687754858825E73BDE5E65B9415B_cppui256),
+                            typename field_type::value_type(0x4A4D3AC28BCB83788B6A9CAA833503247400F82BA06273E6E08156F6BFA2670C_cppui256),
+                            typename field_type::value_type(0x70ABB91C01845A4F17E7711DDEF02B9D4930594CBF29BEED808B9FFDD6C1764D_cppui256),
+                            typename field_type::value_type(0xEE7D69C4CBD001C7FC76C5E2C066CE4996F8808A1E07B2A9CCF34EADC87C4B65_cppui256),
+                            typename field_type::value_type(0xECC8626EC1A413821A192ABF030F2EE2C33E8999BAE942E523E8F44ED136A95A_cppui256),
+                            typename field_type::value_type(0xE7A26CE69DD4829F3E10CEC0A9E98ED3143D084F308B92C0997FDDFC60CB3E41_cppui256),
+                            typename field_type::value_type(0x2A758E300FA7984B471B006A1AAFBB18D0A6B2C0420E83E20E8A9421CF2CFD51_cppui256),
+                            typename field_type::value_type(0xF5CAFABA036BF8D00D38BFB6772089F5203C35E4D6E32FA9D97E5B917B4AE861_cppui256),
+                            typename field_type::value_type(0x19E83B8A022A6D817BFF9904640839159B3B2A9C552F05F3CC9C239C0D82239C_cppui256),
+                            typename field_type::value_type(0xCC3427E7D9B59150FC7B6EDB91ECBFC1D9BBBC5B4730714A70F9FD2BFAEE42DB_cppui256),
+                            typename field_type::value_type(0xEA249841A521C6A1885E3FD3FB21520010E5CBAD8E72422DC6229C0115D87BDB_cppui256),
+                            typename field_type::value_type(0xE9389024CEB63F1F12DF5156D7E805428F9E509C494C982084FD4CD7BD2A9651_cppui256),
+                            typename field_type::value_type(0x8648688723726595F9287ABAF671AAF18D7110CEC6770BFEFEFDE2B75E786824_cppui256),
+                            typename field_type::value_type(0x948F05BACD98445DEC83C585FBCB5CF4B1D75C158E9C410EFF4366C67ED4A086_cppui256),
+                            typename field_type::value_type(0x864CA89FFB5A2A3382F450A6601139411C2328A71C3FA2D1A2A1800F9E2BCA4B_cppui256),
+                            typename field_type::value_type(0x56BB148F0198197E20177708335EFCCAFF5F01600AE80030CB0A71652E96E4F1_cppui256),
+                            typename field_type::value_type(0xA09584A561300A33BEB03ED8BE30EA9F7313D1D2004AF0EB5889F019EEB0582E_cppui256),
+                            typename field_type::value_type(0x2584196292919AC90656FC45451D6D43AE19F4D28EA64C15C0CBEA6CB7542C21_cppui256),
+                            typename field_type::value_type(0xFCB35B1F1CDB244801E5DAA4CC7513D5F3E3A186E4C2AD7B3BEBE319672BFABF_cppui256),
+                            typename field_type::value_type(0x264559D87829256BED116900D82D0C379F0E4D1253C68E6FCF2D41AE7CDDAB8B_cppui256),
+                            typename field_type::value_type(0x79E5BD1926D3512CEF7BC637034072D77A8631AF39CAF1E6C9F64B45001DE473_cppui256),
+                            typename field_type::value_type(0xB6459E0EE3662EC8D23540C223BCBDC571CBCB967D79424F3CF29EB3DE6B80EF_cppui256),
+                            typename field_type::value_type(0x067C876D06F3E06DE1DADF16E5661DB3C4B3AE6D48E35B2FF30BF0B61A71BA45_cppui256),
+                            typename field_type::value_type(0xE5D8E8F0D9823C88E4D36F7301F41593B6890576BE79C211253EF375033EB51F_cppui256),
+                            typename field_type::value_type(0x4DC1E9B7861E3E04ABB16A57D8FEEEF0E509DC46D9F0F54979D5BD965A62A2D9_cppui256),
+                            typename field_type::value_type(0x1F90EA773AC3A6E2DDE60D30296681673D12BA6BF2448A8B439CF279319888E9_cppui256),
+                            typename field_type::value_type(0x89BE367C15DAA10E958153D271EB96A8213751FEE59522E656FDFC97EF113B79_cppui256),
+                            typename field_type::value_type(0xA9CA27F77DBC8C3DC56B0F7321BAE0DDAB66BE4FA8A3011737A676480F155E64_cppui256),
+                            typename field_type::value_type(0xF4BB335678FB14D4D197D2246C02D004875D41821BCAF0AE1F3F333C561B3297_cppui256),
+                            typename field_type::value_type(0x13A4E54DEDFFE0AD6E702BAD334B52BADE03447991E6F2C6085EFB6F3562222C_cppui256),
+                            typename field_type::value_type(0xC9D67D4E5816E813B2CAC2F81D609A52D4F9C577ADC904C08CB1668CA8200145_cppui256),
+                            typename field_type::value_type(0xD02E1B3CD6C105C7EE74654816CEE74EF7793D9B1198875393EAB3DDC1BF6C42_cppui256),
+                            typename field_type::value_type(0x9A0B74F3CA8E225812732270D0D24526BCA5879B931B6AAC1336328F87BC54CC_cppui256),
+                            typename field_type::value_type(0x61991EBF233CAADD1D407C05D8455DBD12ED3A63FAC92525437E4DC0F43B46BB_cppui256),
+                            typename field_type::value_type(0x01C5E308F3FDE492952F387166FBADF11CA8729CA52ECD8EF48F5901CC20A848_cppui256),
+                            typename field_type::value_type(0x68FB71800686D7F25EBA105611CFE7591F478E847F51CEE06D4BC629D6EE247C_cppui256),
+                            typename field_type::value_type(0xCD12D23462DD963673735427501B0C079A8D580B04C73C9DAE1F822D1A01865D_cppui256),
+                            typename field_type::value_type(0xD68A80C8280BB840793234AA118F06231D6F1FC67E73C5A5DEDA0F5B496943E8_cppui256),
+                            typename field_type::value_type(0xDB8BA9FFF4B586D00C4B1F9177B0E28B5B0E7B8F7845295A294C84266B133120_cppui256),
+                            typename field_type::value_type(0xF16A409C677A40BE402F8EFB3752373CACED053C6F702B828BDA222CA412B6FD_cppui256),
+                            typename field_type::value_type(0x2A41311714532799D7A6A75A74E30E4E16540659249EBCA4268DAE77ECA052DA_cppui256),
+                            typename field_type::value_type(0x7815F78F22BD728C4C40B83DA61F16F44F4EFE34CAB7E28235B42AA18CA1C4F9_cppui256),
+                            typename field_type::value_type(0xC1C601E8CD39AF6A7DD93CF31458C35D5CB42DE61577D1E19AB1EA36B778BC15_cppui256),
+                            typename field_type::value_type(0x4154B506AB766F42FBE37F699976F84DB89F4F2F6BED98325C1A0B6E326DD4E4_cppui256),
+                            typename field_type::value_type(0x23AD075043C5988894C6E44D61025FF6414EA9D9D1E22DD46C859295075DED1C_cppui256),
+                            typename field_type::value_type(0xC39273CDA0EC40176E377C64016A6C6D512DF681EF8F4D8E6D26E1C3EE8C8530_cppui256),
+                            typename field_type::value_type(0x8C41BE4257433C8E9D01D39441C3199850EDFCBDA2EED715C4030F0F798446C7_cppui256),
+                            typename field_type::value_type(0x1A46B7E9FE99A4EA492FBC903281B9246831FE599360AF53BDE4CE8B43ED5996_cppui256),
+                            typename field_type::value_type(0x683CE81EA3F1DC570E3EE084A063EBF5508794A9EF52745C2EE4ED11E8C85CAE_cppui256),
+                            typename field_type::value_type(0xDA317447F58411B027522431C1D03B25166C6E58C0DBF6A531F240BB237A26C1_cppui256),
+                            typename field_type::value_type(0x753B97B87F5D8C69D2384167C259D8B7D36836C5D7A81525F51836ECECF74D6F_cppui256),
+                            typename field_type::value_type(0xB73C652769CC95C1080A8D4D0B5956EA93E86E49FC727DDF4C51A7A63F7F0246_cppui256),
+                            typename field_type::value_type(0x9A67DB107174CA9D4B535893C5B6C1EA1A0D72E4C6E554E5597E5164EA2A407B_cppui256),
+                            typename field_type::value_type(0x324AED7DF65C804252DC0270907A30B09612AEB973449CEA4095980FC28D3D5D_cppui256),
+                            typename field_type::value_type(0x648A365774B61F2FF130C0C35AEC1F4F19213B0C7E332843967224AF96AB7C84_cppui256),
+                            typename field_type::value_type(0x32C9331EA26F490228D32681880D7203F72B3E4A8DE0DB1FA8F38381B2919749_cppui256),
+                            typename field_type::value_type(0xD7CD272B34209CB5695A2F02B6F3DBB8268A4ABDAE39AB09631E97B0F290B5E3_cppui256),
+                            typename field_type::value_type(0x20840BD5996772AD5B8F60B931DF7C49163F74FB9DA56CCEF5C917582FD53ED3_cppui256),
+                            typename field_type::value_type(0xF2993497CEC18243487BD476A6BAFAC25487C47394E7089987143FE51A7A7132_cppui256),
+                            typename field_type::value_type(0xEB292F3B3B9837854A02F6A70FEC6B1C69C161B6E1846B8E1E1C22527B9795E4_cppui256),
+                            typename field_type::value_type(0x8C43C25A96EEBE801696634AF145835B57131D7509111C6F5B7E9D2FAE53A0FE_cppui256),
+                            typename field_type::value_type(0xE6B6BFF60EB339BBBD13D029E588EBFD1AB5D88A5C0A121EDBD2CBB588A35B35_cppui256),
+                            typename field_type::value_type(0x1A5FF2BD3300D2F3266F43E3835961DDFE3B6C9D3BE999C7C57293DB9C1007BD_cppui256),
+                            typename field_type::value_type(0x25AAC6BD9A6B2640ED2374CB31FF8F63CE566F50FA1FC6CCC48B8E292032F9A2_cppui256),
+                            typename field_type::value_type(0xF5A6C63BA644546C16F32F54F4F190F6559883BBC419F3D9E76230A12B51D4F0_cppui256),
+                            typename field_type::value_type(0xE05317745BE499B288B0B8086E0CE3BB47A8A836D850E2090D4EF8D2C0360DD3_cppui256),
+                            typename field_type::value_type(0xDC1C3B71A5D92F39CD809582B5B6A01461B987DE98103DC2B2AECD913C24F87B_cppui256),
+                            typename field_type::value_type(0xA65A3A01DF3B5EF2E620D4310049FBE14D71457F19D1ED35AEA39D5789303FDD_cppui256),
+                            typename field_type::value_type(0x798EA0940CFF5C6FB8F43D8D90ED2C7686861D024FAED3CADAD44A8D02E68703_cppui256),
+                            typename field_type::value_type(0x4DF9C14919CDE61F6D51DFDBE5FEE5DCEEC4143BA8D1CA888E8BD373FD054C96_cppui256),
+                            typename field_type::value_type(0x0035EC51092D8728050974C23A1D85D4B5D506CDC288490192EBAC06CAD10D5D_cppui256),
+                            typename field_type::value_type(0xED32CAD8D2CC998CD25317D4E4B87088E9DE4554E57A8D70C0C6B0FC1DA49E04_cppui256),
+                            typename field_type::value_type(0x129FEF5F1D030204A541CA375859D20B52DA9FACB49FAB7DB63120D17C1DB9E0_cppui256),
+                            typename field_type::value_type(0xA549A32DB27E2CAF20E0BD1C09E3B64B21F9BBD6989BA27EF4F225DA5DEF001D_cppui256),
+                            typename field_type::value_type(0x799B7A7906D966CBDF4CC30ED8A59456EB141E2A62C9705ADD5DB1A7F0624783_cppui256),
+                            typename field_type::value_type(0xE821AB724D6360F18049E4111C70366E28C36DCB63C34016CB7418D4E883F855_cppui256),
+                            typename field_type::value_type(0xADEFCBF863F53CE367D0D4115416CF598B3B19C614EC23EFED4E0C6A59852DDF_cppui256),
+                            typename field_type::value_type(0x7E798F30DA07ECD123F08BD983532E6EC954DEFB3C09EC5A05AEF1E5C52ED4CB_cppui256),
+                            typename field_type::value_type(0xD23DCCC4A24DAC83041A9549DEF2F057B173571BFF9F37A12571660794BB9462_cppui256),
+                            typename field_type::value_type(0xB526AB87F2868002CF4E83F46B5A274F4D8C18948C504731A24778AC4206E37A_cppui256),
+                            typename field_type::value_type(0x641F35D778100D8ED5CAACED60A6F18D28CE539B00FA392ABF3678FFF0C5CCAB_cppui256),
+                            typename field_type::value_type(0x224FA20031514783AD5B9E96BA8C81088463F12863DAC067FDF3A0FBD3630834_cppui256),
+                            typename field_type::value_type(0xBBE54E32BB3EDA5C3C4B70FA391D09F53D62924EC0A50F75CD3C4737C47A2272_cppui256),
+                            typename field_type::value_type(0x3F0D8994E51AD212F455452FBC9693A72F14A547AF3806E9FBFF59EEB441742E_cppui256),
+                            typename field_type::value_type(0xFBD76C23F28C3DC445E5CB0E847A6E0B1E205E2C3AD13D958C65363BCFECADBE_cppui256),
+                            typename field_type::value_type(0x9C3919A84A474870FAED8A9C1CC66021523489054D7F0308CBFC99C8AC1F98CD_cppui256),
+                            typename field_type::value_type(0xDDB84F0F4A4DDD57584F044BF260E641905326F76C64C8E6BE7E5E03D4FC599D_cppui256),
+                            typename field_type::value_type(0x2E3C05326255D80F0A42FC69D5C92AA40CD326A53E8535F0435EFB7B694A09EC_cppui256),
+                            typename field_type::value_type(0x001FF891656C6FB5BDDAE240B82FC1ABE048A53C707B66512534868188C7327E_cppui256),
+                            typename field_type::value_type(0xC114239229BDCCB740BBB83FBE53B8D6A7EDE4CA39DD538417B98D538FB64DB3_cppui256),
+                            typename field_type::value_type(0x1237F6DC5B486FC2A5CECDE4FE978BD1A87580904D4567D1E230CE9FFC0259BE_cppui256),
+                            typename field_type::value_type(0xE8E2A24CCFA41587AE15FB7E3E24DDA433710316A1908934205F19A2AB9C7CE6_cppui256),
+                            typename field_type::value_type(0x46C983CE0C6F5D1B4CAF2B2B3BEE20596E09E603B5C27A73B2C01EB68836267C_cppui256),
+                            typename field_type::value_type(0x6C5B4BF831A77224082D9C2C192634713A52218C554559EA1EDED83403081E46_cppui256),
+                            typename field_type::value_type(0xCB0513714926D42FB2347863CE2BE47841D0CF826AC22A62ED1F9CB80BFBCD70_cppui256),
+                            typename field_type::value_type(0xF8058324C6B9C2E7E62147E9A41AD78D60E3ECF417524C0580832ADDF11349E2_cppui256),
+                            typename field_type::value_type(0x95C60E5A0A8856CDCDE81AA60EA11223509498B5626DE88D5FAC469E5B2025FC_cppui256),
+                            typename field_type::value_type(0xE1E9A856670CADE4B5670665CAB10A450C30C7D59911C124DCAE5AEC464DCD4B_cppui256),
+                            typename field_type::value_type(0x562B0A954455C531B7AC43599B2577927F44D19AACA16B292D0B625EBB041F2C_cppui256),
+                            typename field_type::value_type(0xA7549AAC5D8573C2B2F0A38B170032A212ACAF92383D5B5F5B0D39668AC7B3C2_cppui256),
+                            typename field_type::value_type(0xBD17D1B90D1C2415335A1D70C1947D2B5D6B5115537116DFFA0C91719287EAEF_cppui256),
+                            typename field_type::value_type(0x6057170B1DD12FDF8DE05F281D8E06BB91E1493A8B91D4CC5A21382120A959E5_cppui256),
+                            typename field_type::value_type(0x9A1AF0B26A6A4807ADD9A2DAF71DF262465152BC3EE24C65E899BE932385A2A8_cppui256),
+                            typename field_type::value_type(0x6773FD677C52E0640394110A46DC85DF7C133F8DD4A28E661899CA5D82FD545C_cppui256),
+                            typename field_type::value_type(0x444EB6D8CD97652F0F0F25C9DD2B246BEAD780F5A1C6CF98E8C7F034947EB1AE_cppui256),
+                            typename field_type::value_type(0x71EBA8FCD6E002603DD11B5FDFC766C5FF6B668A17AFDC980D4DA162971C032B_cppui256),
+                            typename field_type::value_type(0xD2FF12624B61D39DEF660516F54CBB7F71931AD1774B4755E7AB5A8E1668359F_cppui256),
+                            typename field_type::value_type(0xE0F86D94D17CE565237C79AACE0C87C20374E43810468050373C616B0B86F021_cppui256),
+                            typename field_type::value_type(0x0C571C73730ABCF47A91E832F1C89A2C9A80BCC0115FC45B3B6B79CCB5BF325A_cppui256),
+                            typename field_type::value_type(0x855EC305B3249D232CA17442BAAA9DD0507868F469070574D06E47452A03A61C_cppui256),
+                            typename field_type::value_type(0x0DD85D2EC5F01C17F543CBFF9B42FB4ED332F74EA17E44965DFC6EAAC65DFC07_cppui256),
+                            typename field_type::value_type(0x417FE249D3C3AE287943EBC18C4671FF63EFBA0BEF786CD66DF0D9F73AAA138B_cppui256),
+                            typename field_type::value_type(0x023589D7BCD23E38C20A5D29F0FA9E57C19DAFDEC05566AFD1C91B334A1AE869_cppui256),
+                            typename field_type::value_type(0x3CE4486ABAB3FBF1F150D29A3095BFA20618CCA4746A0678B00C0A481F32D706_cppui256),
+                            typename field_type::value_type(0xE775408DAAE3785288EFD046B1094906EDD15643CD61E89F40B73637FC7FD9E4_cppui256),
+                            typename field_type::value_type(0x42CA15AB9F245041CE991E193D696F4F4C277DF908CAD6038AD0772C02DA6E03_cppui256),
+                            typename field_type::value_type(0x68D2EF26C81C57C9647CE4D1FCB800EED66E85A68106BEA7836889FA8C347793_cppui256),
+                            typename field_type::value_type(0xA576DF8E23A08411421439A4518DA31880CEF0FBA7D4DF12B1A6973EECB94266_cppui256),
+                            typename field_type::value_type(0x40A6BF20E76640B2C92B97AFE58CD82C432E10A7F514D9F3EE8BE11AE1B28EC8_cppui256),
+                            typename field_type::value_type(0x9E5DCC62EF3B5A3B546520867BE71BAE6F3BA063C9ACFB8DCEC5725BDA704896_cppui256),
+                            typename field_type::value_type(0x6FEDD12DDB925F3EA5FD3A2154C7612279605D186030F51248F2769DCA82C835_cppui256),
+                            typename field_type::value_type(0x0328336DCB74F53E80BFC187705EDD0EC24E745BC3D593D6B68AEB58CD9ED6C1_cppui256),
+                            typename field_type::value_type(0x71A8983812FD9F28C46D5943A20D7C8C265BF4DF25CB494ADEC6EBE6F8FAFEEE_cppui256),
+                            typename field_type::value_type(0xA7DE08375B8745ADF8D6E9F976F03B20E33625A05CEF5833953ED58744BF7EA0_cppui256),
+                            typename field_type::value_type(0xA63D96B057ADA5E52104A0B334888E9A645A47C0FEBC5AA2E04C05539BBCABAA_cppui256),
+                            typename field_type::value_type(0xCE4F4EAE8B911C54DC63926D70FE1531E38A1037013BCEB2919A9A8D3235983A_cppui256),
+                            typename field_type::value_type(0xF3C9F973C390FBBB3EADE0249E707543526C65228EBF740AECFD6B190D3CDECF_cppui256),
+                            typename field_type::value_type(0x690CDAE3983918B9DBDEA2A74631BC1E98C4996EFDCDD9F86B75648A66DA57E4_cppui256),
+                            typename field_type::value_type(0x840ADC79677B79A47A9FD91BF595894DF863D8FBCE95A3D42B6195B4933F33BB_cppui256),
+                            typename field_type::value_type(0x4DBEBFA54B98622278E28FB36DF8BCBDDB5FF9CF786E4C89A6DAAB6655B0E6C9_cppui256),
+                            typename field_type::value_type(0x10FEE7B03C913AEDF45A626E6E2229F3589311B2BC504EFAE94A78555EB2CC25_cppui256),
+                            typename field_type::value_type(0xC266658E689080C9C13C35AC01CFF4CBE68065FDE949E4A3A9F8FA104AD916FB_cppui256),
+                            typename field_type::value_type(0xE7E8593854E7DAAB0F798170B24627AB6B8FECDFEB61138856AEF52BA0887814_cppui256),
+                            typename field_type::value_type(0x7778A78C28DEC3E30A05FE9629DE8C38BB30D1F5CF9A3A208F763889BE58AD71_cppui256),
+                            typename field_type::value_type(0x34626D9AB5A5B22FF7098E12F2FF580087B38411FF24AC563B513FC1FD9F43AC_cppui256),
+                            typename field_type::value_type(0xE7B9796B5CA006D1632F482D7F0FE3932CF16A5AE104EEA7A7EA1C251073E879_cppui256),
+                            typename field_type::value_type(0x12B8988C19169E2FDF42102A737CC1CA9CB5BF25EDA98AF338E71089BAA89D98_cppui256),
+                            typename field_type::value_type(0x3018045D98173FC8D01839022FCCACDC18A9F95D761EB2702F7C6EAE3319C869_cppui256),
+                            typename field_type::value_type(0xAC5FC5782503B7B6F86624320D622E3BCA2A84CA4A3D9A7BFC0C76C9D2B856F0_cppui256),
+                            typename field_type::value_type(0x071BF01850876203C2C915A24BE09A7365423DAAF2AEE919865D722BF2628F0F_cppui256),
+                            typename field_type::value_type(0x527AA15D504DCF4AE33600BC1C084CE2098F9C6A231C80BBB57C5CBD45A1C334_cppui256),
+                            typename field_type::value_type(0x322881B61EE57EF343AB67DB9A63C885F5830B60712ADD1B4C66986FA5ED29B5_cppui256),
+                            typename field_type::value_type(0x1677028417A0344EB110B19DF41531E1CA83AEAB94EE7604EF4F126E7CD15AD2_cppui256),
+                            typename field_type::value_type(0x0A0B2B4FED0DDD238812806C0FCCDFA97FB3B42A748721AE6477DC9B18953133_cppui256),
+                            typename field_type::value_type(0xCDA1182CFB5ABF2F03C1C6CA86458C8D6FA384E8B0ED4BA94BC24A3734AF0FC9_cppui256),
+                            typename field_type::value_type(0x3F38473AC0FB1B9FFB43DD9B2DF3DBCCA163011AA6E9C8E63BFA840786C96100_cppui256),
+                            typename field_type::value_type(0x70C69C55F5D403952534C4462F079CE566571C7C0B75F1BCF1E2AC1BF2624707_cppui256),
+                            typename field_type::value_type(0x0218343ACB9BE56833A32E594C03C39E5B1911C8501213786F6376DFA39620E1_cppui256),
+                            typename field_type::value_type(0xBEA81D48970A50BEAF3F24FD602FBFC0443299A42F43C9EC5E0199F6506998B5_cppui256),
+                            typename field_type::value_type(0x0928955EE637A84463729FD30E7AFD2ED5F96274E5AD7E5CB09EDA9C06D903AC_cppui256),
+                            typename field_type::value_type(0xC25621003D3F42A827B78A13093A95EEAC3D26EFA8A8D83FC5180E935BCD091F_cppui256),
+                            typename field_type::value_type(0x4F89BDEE3771D350DAD163B04CB18AD67CE5E9C55B58F0E7231047A60F59DD9E_cppui256),
+                            typename field_type::value_type(0xCA7952D5227A1F695C4BAF4C043BB2471E4882506638DF5C1016AE320156B049_cppui256),
+                            typename field_type::value_type(0x3E03B81FC0E1E5A8053DF0DFB230B6AEBE4115B3953D2B41811128757874B839_cppui256),
+                            typename field_type::value_type(0xD13AE163DFF07F42C44F660757198F667DE5C5F0FDAB5B8DA0C1CE567C0594BA_cppui256),
+                            typename field_type::value_type(0xCB9E8304CAE3C5A80C396BACA2C3C4C994B668F079A245BF529C314CFFF01197_cppui256),
+                            typename field_type::value_type(0x62C7D2801EB80E6A127258CDFF08891741B2D18C015E0A24C334E0763B989C1D_cppui256),
+                            typename field_type::value_type(0xE662C0B7A2F4492CD62FA283AA2922C5F151BD1345B3023F3A3F78E68357A513_cppui256),
+                            typename field_type::value_type(0xAB0B193CE612452305DAE208A121A419D8035CD625538D89192A201CA017D07E_cppui256),
+                            typename field_type::value_type(0xC2C58A54280DF6394778FFE0A22C234B5E83A8C188EA59459BAE90D3B9A7D197_cppui256),
+                            typename field_type::value_type(0x72EA3288366E0927573041AB62ED39A60A47EC4545AD82484E41CCBF89EEB5E9_cppui256),
+                            typename field_type::value_type(0x40BF80B1C94CF6CB843862C7CBE3587DC29FECA6079C14B04995F7EFDF37D242_cppui256),
+                            typename field_type::value_type(0xB579DD35D856AAF04F53FE9B1B26FE1274321EBA42BD35583D1D8279A6405088_cppui256),
+                            typename field_type::value_type(0xE2F349B0F89C69BD3C8CF2A410730DC58E0BEED47048C58C15F9FFC2508D2CC2_cppui256),
+                            typename field_type::value_type(0x1FEB2F280F82723781860AEC760215BA42344BE8E09CBDB37E347BD8E0D4C04F_cppui256),
+                            typename field_type::value_type(0x85D0FEF3EC6DB109399064F3A0E3B2855645B4A907AD354527AAE75163D82751_cppui256),
+                            typename field_type::value_type(0x1F03648413A38C0BE29D496E582CF5663E8751E96877331582C237A24EB1F962_cppui256),
+                            typename field_type::value_type(0x6B790F4B19A4C4F4F607A6CFCD11DF0468B482E009711FF756356D141D5FCADE_cppui256),
+                            typename field_type::value_type(0xD03A981B2FF9EB3EF296661F9CAE09CBA83FA5B47BE26B0AB6FFF86FC338D3FF_cppui256),
+                            typename field_type::value_type(0x384DAB4AC11422C3BE7C2D26D15D9AE79340E535478A066AB9955061ECDE4CF3_cppui256),
+                            typename field_type::value_type(0xD6E3C5BCD1B9CA43BFB4ED6DA2B4C6F01F430A339751BA73B7C796B2252D0566_cppui256),
+                            typename field_type::value_type(0x41149B2C2D7EBED3C162C367ACC4F8FE3D2479DE85978BE0BB0CCDABE3A3E0CB_cppui256),
+                            typename field_type::value_type(0xC90D5B92DB7C30542B415C9B9902CF28B3EC7805EF490F2470E92E98339033A8_cppui256),
+                            typename field_type::value_type(0x14F0EC0EB7D415AA41B1610B4E82ED4840355F5C380ECB8B98AF3E921E5238C2_cppui256),
+                            typename field_type::value_type(0xAB12D53DD4835D80921FC73E3842747FD25C00D80304939D6E86A34792F07922_cppui256),
+                            typename field_type::value_type(0x8A31870949BFE15C8198C1EFCBC441A0E192160402521E1F8A4366A08A972627_cppui256),
+                            typename field_type::value_type(0x64BB7C8768F7A64D09577ED28587BAA41744365AC3EFCBCCE7B47B5646BB8AF9_cppui256),
+                            typename field_type::value_type(0xEB42F3BB782C287EC41C34678A5A0DDADD1302A756F98E188F6352EFD543E94D_cppui256),
+                            typename field_type::value_type(0x234A6D074F25D92DC9A0DD572FCDFB774CD8468DE60D6D4240559DE445924D89_cppui256),
+                            typename field_type::value_type(0xD1FAD4FA4E7C849DFAEC3DFE2872A7BA664A9B8205C29CEBF8DDDD28E3F3D3FC_cppui256),
+                            typename field_type::value_type(0x8FE19714A348FDFE5473F70E858B7818BAD37131EFF37326ED22343C50F3704D_cppui256),
+                            typename field_type::value_type(0xFF2B0DCE97EECE97C1C9B6041798B85DFDFB6D8882DA20308F5404824526087E_cppui256),
+                            typename field_type::value_type(0x493D13FEF524BA188AF4C4DC54D07936C7B7ED6FB90E2CEB2C951E01F0C29907_cppui256),
+                            typename field_type::value_type(0x2982DBBC5F366C9F78E29EBBECB1BB223DEB5C4EE638B4583BD3A9AF3149F8EF_cppui256),
+                            typename field_type::value_type(0xA61B5BE9AF66220AB9FA5339C7B5BC9D095DB99412E3ED8456E726B016C7A248_cppui256),
+                            typename field_type::value_type(0xC745FDF2775F230888B7FF25E02C94B066CE0EEFAC8FEB9FC59054FE79D681F9_cppui256),
+                            typename field_type::value_type(0x590222F2F6B9E5E78A71394C70E818678CDBD335C67D45C7603173437BBB1247_cppui256),
+                            typename field_type::value_type(0x1A28E5042AF0C0F6B436EB590497DB5860011F4580E1765885289F612380441B_cppui256),
+                            typename field_type::value_type(0x55779A7996C59DAB7C78329A8976F0ED04B3E75B46EE67AEB05F606A8452AF25_cppui256),
+                            typename field_type::value_type(0xABB279F3A975050B27A59E5EB672E7F2B34478E820CAC4815E04CEED35CD0EA3_cppui256),
+                            typename field_type::value_type(0x5DEE103BBF17970D9FB4BE0C03078ED47C9769059E02F3B6470931337C307BCE_cppui256),
+                            typename field_type::value_type(0xFD73C052B194C6C6DD46ACA9D640981AEC79600917A565EBE77FD534649A2115_cppui256),
+                            typename field_type::value_type(0x620768C1C8178844020ABAB026F7D6D904F601562E9D421F049CAB7BA6BA6CDA_cppui256),
+                            typename field_type::value_type(0x3F81150B59FC682827FAEAA74267ED11EA9FA1A963E7382C5C2E2F3F1BC9EE3E_cppui256),
+                            typename field_type::value_type(0x19C88A68FDBFA82D4671BEB3C47956627623B2DCFCDA81603CEADB0C599AAE06_cppui256),
+                            typename field_type::value_type(0x0C8B83E9535F30601D250CC0BD3F20142EDD5EB7985D83242EEF0E39621E30A7_cppui256),
+                            typename field_type::value_type(0x0DCC7077065FDAC7B850E3F17EFDC854AACAD237B987134DBEBF7BEB9FF688DE_cppui256),
+                            typename field_type::value_type(0x827FBBE4B1E880EA9ED2B2E6301B212B57F1EE148CD6DD28780E5E2CF856E241_cppui256),
+                            typename field_type::value_type(0xC60F9C923C727B0B71BEF2C67D1D12687FF7A63186903166D605B68BAEC293EC_cppui256),
+                            typename field_type::value_type(0xB77F12A7DCE56B973E2D7C8D576E6B3660470A9218B87461EF6E44B70CB1815D_cppui256),
+                            typename field_type::value_type(0x4B6F85B14F86ACC43F0CEFB373CC2E654C42F0F91A44816D6BA3D2BC8E57DBC5_cppui256),
+                            typename field_type::value_type(0x0857E31F6308C2FBC0D1A06BD320819F3AA7DA6BB7041388634485CB3BB80FA7_cppui256),
+                            typename field_type::value_type(0xF64393423AE0172092D7CC9D1DCB7147172E37043CD7016ABD98211F09366B2D_cppui256),
+                            typename field_type::value_type(0x48973B943018BF1247B308B2CB79F956D858D8DF4977C5970FE5DAD2C45565EC_cppui256),
+                            typename field_type::value_type(0x761F75684F3CDC1B6437BB3A01445AF1511B3596580477B83B879075FAED07E9_cppui256),
+                            typename field_type::value_type(0x28AACCEA56BD60043545C655764A672E9CBB8B78E753D496F5D02C3A09C70E63_cppui256),
+                            typename field_type::value_type(0x2B69322EF81A0E1567A89667C768EBB7F5FC59CE444DA1E8B9F03882F057DA4E_cppui256),
+                            typename field_type::value_type(0xEA1266167F2B818481A69B87056523973416611D0389378833A00ABE7B6D6CD3_cppui256),
+                            typename field_type::value_type(0x21A4E2E5078EE3FDAACE112BF1145E25B1C9752DEBBE1A88AAE62925F4F450BE_cppui256),
+                            typename field_type::value_type(0xA2F3B625A055A66145DDB2C9BCEB8A4F92D8F69CE7060AAC601DC52F73E674B5_cppui256),
+                            typename field_type::value_type(0x620EA159614C68AE80044A90F32A7C4B9222FA317C33FA53B0938C8E0E937941_cppui256),
+                            typename field_type::value_type(0xE931258E8EB5559C6D6972728A704C170B775A265B4527D4A4D4D742BBFD71FA_cppui256),
+                            typename field_type::value_type(0xFB1E33364C3FDEE0E85EB4169C954B40B3946CE1BB5E35F33D9BD0D3174D3307_cppui256),
+                            typename field_type::value_type(0xEAA649F21F51BDBAE7BE4AE34CE6E5217A58FDCE7F47F9AA7F3B58FA2120E2B3_cppui256),
+                            typename field_type::value_type(0xBE3279ED5BBBB03AC69A80F89879AA5A01A6B965F13F7E59D47A5305BA5AD93D_cppui256),
+                            typename field_type::value_type(0x3ADB9DB3BEB997EEC2623EA5002279EA9E337B5C705F3DB453DBC1CC1FC9B0A8_cppui256),
+                            typename field_type::value_type(0x374E2D6DAEE74E713C774DE07C095FF6AAD9C8F9870266CC61AE7975F05BBDDA_cppui256),
+                            typename field_type::value_type(0x4B72A5E9042F4ABFF48731C3B85047E229AAB71CC52A6A98F583FD3A3F2E070D_cppui256),
+                            typename field_type::value_type(0x599E1D4E1D6AE1CF60277BB36D0F3C10B0B465DDD2948C3DE44BA82EE96DD780_cppui256),
+                            typename field_type::value_type(0x129E53AC428E9CBB7E10955E56C5FC69FEFDFF56963E7CAF054E9E0C90AE86F9_cppui256),
+                            typename field_type::value_type(0x415ECB958AEE9A29B2DA2115B712183FB2A232FD16B3E01B822EFDCD1E89C85D_cppui256),
+                            typename field_type::value_type(0xA9FC93FC6539C8E285A6BFBEB5E1FD613EF54996585125A1E9CE7FD84A02591C_cppui256),
+                            typename field_type::value_type(0x9C2CE739DC5387173E84C17A1A9165E5CA888C415FCF7253790ADDEF69BEC2DC_cppui256),
+                            typename field_type::value_type(0xAA7121D4E3FB5B786AB499694AAF054327F9CA04E4609113428700A0F85912EC_cppui256),
+                            typename field_type::value_type(0xC690F077DAD09509C505266B96A2EDEBFEE134A8CE056CBDB114CB264AE35978_cppui256),
+                            typename field_type::value_type(0xC940017C1A6F9F0A6A7D7AC1209B027709A28BAE13CBBC2E11006E0E2D968B59_cppui256),
+                            typename field_type::value_type(0x39D922500C9B862013B8A1BFA5B5742CE2842CB64390C9C8FEFD76408DE572FB_cppui256),
+                            typename field_type::value_type(0x60144494C8F694485B85ECB6AEE10956C756267D12894711922243D5E855B8DA_cppui256),
+                            typename field_type::value_type(0x8BB5D669F681E6469E8BE1FD9132E65B543955C27E3F2A4BAD500590F34E4BBD_cppui256),
+                            typename field_type::value_type(0xE4A42D43C5CF169D9391DF6DECF42EE541B6D8F0C9A137401E23632DDA34D24F_cppui256),
+                            typename field_type::value_type(0x4D9F92E716D1C73526FC99CCFB8AD34CE886EEDFA8D8E4F13A7F7131DEBA9414_cppui256),
+                            typename field_type::value_type(0xFD6451FB84CFB18D3EF0ACF856C4EF4D0553C562F7AE4D2A303F2EA33E8F62BB_cppui256),
+                            typename field_type::value_type(0xE745CEB2B1871578B6FE7A5C1BC344CCFA2AB492D200E83FD0AD9086132C0911_cppui256),
+                            typename field_type::value_type(0x3E419634E156A3A24949BC8E8D396FAF09430123677B392B5C8410AF3BEA0C68_cppui256),
+                            typename field_type::value_type(0x0123C59D924B21F7F373CBFE370693062FA11946303CDA1ABCBB6FF71A45EDB6_cppui256),
+                            typename field_type::value_type(0x1EEE207CB24086BC716E81A06F9EDBBB0042E2D5DCF3C7A1FA1D1FB9D5FE696B_cppui256),
+                            typename field_type::value_type(0x652CBD19AEF6269CD2B196D12461C95F7A02062E0AFD694EBB45670E7429337B_cppui256),
+                            typename field_type::value_type(0x8D9438F5455D7508EED4A3E62F7F0B576EB7B64C351C9897AF75D23C939824D7_cppui256),
+                            typename field_type::value_type(0x3261E0734FEE6C2A2CA60BD31AB6EF6F8FB9E2B8326B063D8A004F489366489F_cppui256),
+                            typename field_type::value_type(0xF13A99E58DC72FCB0C62A492D2850704621DDF48F1F433E69A9814C417D4B84A_cppui256),
+                            typename field_type::value_type(0x33C2C8CD0F0BE995AA6B91CD1E3FE06EB6E37D4710F2D96285990FC553FD1C81_cppui256),
+                            typename field_type::value_type(0xB72524C558EE54420D4A912A2FE545439360C2FB7428E6208E48071A98D713DE_cppui256),
+                            typename field_type::value_type(0x4C51B39A8A283E451042D182E9D694150482D26FE44A5FCB76FFE5259B8350E9_cppui256),
+                            typename field_type::value_type(0xCC0EA33EA8A9EB14D465AB2C346E2111E1C0FC017C57257908D40F19EF94C0D5_cppui256),
+                            typename field_type::value_type(0xF9907A3B711C8A2FB23DD203B5FBE663F6074F266113F543DEABE597AF452FE6_cppui256),
+                            typename field_type::value_type(0x1EC80FEF360CBDD954160FADAB352B6B92B53576A88FEA4947173B9D4300BF19_cppui256),
+                            typename field_type::value_type(0xAEEFE93756B5340D2F3A4958A7ABBF5E0146E77F6295A07B671CDC1CC107CEFD_cppui256),
+                            typename field_type::value_type(0x5BE7EA3519F04BC6CBEEAA0344FC90BB8E8462F6EBD890560DAE805D414FF9E4_cppui256),
+                            typename field_type::value_type(0x32F32EC3F638E605477F890F655AB7FE0E99C6302119A3094030B07847E0BDBB_cppui256),
+                            typename field_type::value_type(0xA6DC880A55D1F2E83BCFDDAB67106531C4FF0B508C0452B94B17CBBC52FEA1F9_cppui256),
+                            typename field_type::value_type(0x7EF1A8547DC367C3038683A116ACBC50057B89DB7E68F7E63B1C14E47BC345E9_cppui256),
+                            typename field_type::value_type(0x58F099116EAE4E650813FC8698DF7F5CD50028649F853991E3FB545F4DDB7BB8_cppui256),
+                            typename field_type::value_type(0x7E07002AAFFE111A0D62FF7614638066507EE4062D174302BDEC73582E5B2D6E_cppui256),
+                            typename field_type::value_type(0xFE6BA93FEA4245992BDC229C78A481BA8C6C4CE874865637C8D40C3F06D6C9B3_cppui256),
+                            typename field_type::value_type(0x7EE918D740539872B6BB41B345413B56D980F1BF05C2E9B00C2C788FA948BDFB_cppui256),
+                            typename field_type::value_type(0x2320B5CAF7B59B7CE542842802F74C34134BFC495B9E2B108B613E771C7985C4_cppui256),
+                            typename field_type::value_type(0xC79F943DC88BE94318C721B81F9BCA93D96F10211CD9EB8D4FF4F1DF4C2C6D44_cppui256),
+                            typename field_type::value_type(0x15D5E2F146FC98BFB020C8C2DC08DED1B964806E442C4B64422F10730CF95151_cppui256),
+                            typename field_type::value_type(0xA5B72E31915FD4EC7F90E109789023F9BB204FB97DD8C0F9482A07CC2FF8ECF2_cppui256),
+                            typename field_type::value_type(0xB0F9E4B9B29790B633BCC04FD860CB0F823D8D1A4CC1A1C1413C1606CC9A8E2C_cppui256),
+                            typename field_type::value_type(0x49E82BF1843ADE6D41CBB0B906FDE3F03350CC02C171CEE76C2066C4DF3D0DB4_cppui256),
+                            typename field_type::value_type(0x146A778C04670C2F91B00AF4680DFA8BCE3490717D58BA889DDB5928366642BE_cppui256),
+                            typename field_type::value_type(0xB318E0EC3354028ADD669827F9D4B2870AAA971D2F7E5ED1D0B297483D83EFD0_cppui256),
+                            typename field_type::value_type(0x574EF0CE8A597E24E5670B5C0BCD14CFEEFC983C7ECB261911B2365579DE5CAC_cppui256),
+                            typename field_type::value_type(0x09B99930281F19C73BD6ADA0569B78451A260A7BEF10008CAE59AEA6C75A4805_cppui256),
+                            typename field_type::value_type(0xFC696C040660935FF42C899820A142A13D79BBD54AE867299D93873827315443_cppui256),
+                            typename field_type::value_type(0xE0CE27EBF83B5892BBF0E1CDD69677B5487FF486109BD1B17490D60B57D28960_cppui256),
+                            typename field_type::value_type(0xD3D97E799D8BF9F85D909397B98C835D10A770C1AEFF8645808C2D74260966D3_cppui256),
+                            typename field_type::value_type(0x8DDBB46376BAC95E6AAA89275D403AD3B5E48711BE8DC4EEBDDEB850833C2E52_cppui256),
+                            typename field_type::value_type(0x974AF221FF4FF2AD1AE56A3562BEB0928FA3DD79C62E6A79D1BB2F5C16FDB4EB_cppui256),
+                            typename field_type::value_type(0x5552387D535003CA64D1E43D02C090ED111C572A3BFFC2348409C3DFA9F6F484_cppui256),
+                            typename field_type::value_type(0xA0E8865700EF4338CDF587ED3BF200E54185C8AAED888B607F3615FD7C6B5B56_cppui256),
+                            typename field_type::value_type(0xF5BA46839FA9AD50B99A6B89B853DEAD526B871D70858A51A16BDE513A1D7518_cppui256),
+                            typename field_type::value_type(0x5BAAB59B49DE398B09121B3A669270C5E8284BC36658C81373904ADB5D5AEEE3_cppui256),
+                            typename field_type::value_type(0x8A577F617C0F7E856E5A008661FFDAF7215DDC9DABD31EED82D29AFB70F69717_cppui256),
+                            typename field_type::value_type(0xB1AA653288B318987B974E782CBBEE0AB2BE78CF8F494C120040FB93968C6D4B_cppui256),
+                            typename field_type::value_type(0x7ED6071C60810D712684AA8E2D63A83B100A1D909D623CC383D9E62AE891AC51_cppui256),
+                            typename field_type::value_type(0xFA50C0F61D22E5F07E3ACEBB1AA07B128D0012209A28B9776D76A8793180EEF9_cppui256),
+                            typename field_type::value_type(0x6B84C6922397EBA9B72CD2872281A68A5E683293A57A213B38CD8D7D3F4F2811_cppui256),
+                            typename field_type::value_type(0x63964EEE619074E0780140FE02E90836E72328D2448386D459C5BE23187F5048_cppui256),
+                            typename field_type::value_type(0x3B6CFB3A6B89CF41A39FF9B1C34BFBC93D580B934DDE6C84383A284D89309DF8_cppui256),
+                            typename field_type::value_type(0xF7502E3C4379E31BCDA329F93A1CA2B6A9C60A4015CACB2971EE0E3391DA5E12_cppui256),
+                            typename field_type::value_type(0x3C57F5EDD67CFAFD59970945C3D672047B86D32EF725CEBC7A4B9C5E8385F4EB_cppui256),
+                            typename field_type::value_type(0x5A3CE25B4D15B7E22D1469DDF0FC9F75AFD7F12AD3CBDA31F814BA1EBADB2A65_cppui256),
+                            typename field_type::value_type(0x8B34125B92E05F63873A6DBFBF3F99AF3EE28BC3D825FE8ED8B170CF1D327F1D_cppui256),
+                            typename field_type::value_type(0x12FE78F983AE5862A3A4F6624E3455B3F4CA5C4B94E57C9F2074933110B7D105_cppui256),
+                            typename field_type::value_type(0x2062F1A338D6BCF7786B5AA199A7CB771DECE265D6EE90B8458AC6FB9F794A60_cppui256),
+                            typename field_type::value_type(0xD42011D6010613880FEC6B7F3F332B2024AB318F2A9BA7ED237312073E32478E_cppui256),
+                            typename field_type::value_type(0xBAE5D4E9A37D4E0C1B2D5F5F44BF847B6FB24B2F35508CC31CE05681D04E88D4_cppui256),
+                            typename field_type::value_type(0x76AAC31347DF473D58C4BB1028084B1A480E6C50AA572DAFF621D8339E0C5D05_cppui256),
+                            typename field_type::value_type(0xEF5576EF0D5C70EFABEF32C83202625F4B1225CF015E6EE3556619B751ECE63E_cppui256),
+                            typename field_type::value_type(0x5CE605AF98F93EDA6910BE34F0DE41FF85DBCB6E69A8FA0016A733754A9F44D0_cppui256),
+                            typename field_type::value_type(0x4CDDCF9BEC226BFE7BA56BD031C76C58AB3CB1BFA32ECCC6C0D05F3489D30105_cppui256),
+                            typename field_type::value_type(0xDA1D61D0CA721A11B1A5BF6B7D88E8421A288AB5D5BBA5220E53D32B5F067EC2_cppui256),
+                            typename field_type::value_type(0x8157F55A7C99306C79C0766161C91E2966A73899D279B48A655FBA0F1AD836F1_cppui256),
+                            typename field_type::value_type(0x9C7BE00B4EF4C444DF85D5F61DC1283A23605483E1F8E934B3C210D22CD3C369_cppui256),
+                            typename field_type::value_type(0x9220C0DE74B20D2052A26D455CE401483E31153A16769CBD29EE3FEBA2329515_cppui256),
+                            typename field_type::value_type(0xE3E90DA46303DD0419E96646991B1723B83EC0C4479D36F615D87732FA95A8DB_cppui256),
+                            typename field_type::value_type(0xFBE53BC0056C178BB00FAA90C702E76AFBB1EF97CC984D3D1016CF7F1B0D1CF9_cppui256),
+                            typename field_type::value_type(0x0FCD83F42825263BB55664B238CCC49174DD06A70541178E76BCD92D7BB8C9E3_cppui256),
+                            typename field_type::value_type(0x6C0BC1CFEAC5FBCED1D8232DE5FDB683ADBEAECDF1627BF4E86D55FBDF4AA9AD_cppui256),
+                            typename field_type::value_type(0x9F4FFEC732E3D775A8B650DFD5C0C01C782A4E979593154017AAFD64112EE214_cppui256),
+                            typename field_type::value_type(0x639CE2E1318E2F2E60E96682FD75C69D9719B6930BC880283EF442225085F37A_cppui256),
+                            typename field_type::value_type(0x14295A2937F1A9412EE14CCE33A05FB2748992A2CF598D41F4FC3DCB541D0CE6_cppui256),
+                            typename field_type::value_type(0xFEA75363DF1150711B031C44844083B1310895601B5D241A52A81A8AD738BB86_cppui256),
+                            typename field_type::value_type(0x431F622D41134AC1B171A0A41F440B2C4B1253E1B3C14E3EF8B681451F61A0A5_cppui256),
+                            typename field_type::value_type(0xA298327FE7AA438F6D6DE6519723AA7241BAAA043556577246B7B7FE78CEF899_cppui256),
+                            typename field_type::value_type(0x7175407F1B58F010D4CDA4C62511E59DB7EDCF28F5476D995CF39944B26B64F1_cppui256),
+                            typename field_type::value_type(0x43B4554344E3D550F36D3401134CC86EB01FE8B774471D2A426E7EFAB24234D5_cppui256),
+                            typename field_type::value_type(0xA8E282FF0C9706907215FF98E8FD416615311DE0446F1E062A73B0610D064E13_cppui256),
+                            typename field_type::value_type(0x7F97355B8DB81C09ABFB7F3C5B2515888B679A3E50DD6BD6CEF7C73111F4CC0C_cppui256),
+                            typename field_type::value_type(0xCAC6F2E7E27FAECBCB876F805EA66E63EFBE9EAA753D67C1C15EB9EA7F7653A1_cppui256),
+                            typename field_type::value_type(0xF7D416E5E2AA6F194CDB65D9A42A345081E83AE5688103A068C10AD0FEC5E556_cppui256),
+                            typename field_type::value_type(0xAE2207C5CDADE26327F37F0B1EE40E50BA288F8DE67E829E22A199B0BA3979B5_cppui256),
+                            typename field_type::value_type(0xEA91FE510C079F71AD4C924523AD7060FCA87B7D37D4F88968F3CD668450FA6F_cppui256),
+                            typename field_type::value_type(0xE6DFDE46EE37D206EFBC5932E58E43254AB767294238CB11CC9F4AB08624003D_cppui256),
+                            typename field_type::value_type(0x8727B3B7BE9139498F2F48F7B88F92203B1CE5EA527FD7DD7548650E2216B93B_cppui256),
+                            typename field_type::value_type(0xCB8DED0CAD72ACE59CEC541006585461E0BE0C4FEA2164FAE41019100EFCA824_cppui256),
+                            typename field_type::value_type(0x33A5008F740D88C85B316C487A2CCBC496AD1FDFC7931742F140BD058F227361_cppui256),
+                            typename field_type::value_type(0x49DBE4F7B2792B64BC9ECA37E8D64C460A00E49CA3221CEF559E11E1ECE4DD6A_cppui256),
+                            typename field_type::value_type(0xB8B57298470481C72C5FE33DB692255A1C38552FCA05BB69B13B72A42A9E3EAE_cppui256),
+                            typename field_type::value_type(0xB0C53B298AF1836708E94900D7E76ED6B04E085221E4AAEE9411B4DA3BCBD327_cppui256),
+                            typename field_type::value_type(0xEE2A97401FBD7EA1638F6A601B66B2AFD82A220C74636A0F1616BC4A2D7BE436_cppui256),
+                            typename field_type::value_type(0x3C4E089CD9A6823D66A40CFC7AC96082E250E3149CF211D3B0E1103548DCE109_cppui256),
+                            typename field_type::value_type(0x43FBBE669FE191B480757BCA15764D379579E142D97FE697E2BF65923A19AEEA_cppui256),
+                            typename field_type::value_type(0x174A53B9C9A285872D39E56E6913CAB15D59B1FA512508C022F382DE8319497C_cppui256),
+                            typename field_type::value_type(0xCCC9DC37ABFC9C1657B4155F2C47F9E6646B3A1D8CB9854383DA13AC079AFA73_cppui256),
+                            typename field_type::value_type(0x20E6E2E796946BB630C7071EF1B92EA3D53D280E0E4501115F5DA36F840DD273_cppui256),
+                            typename field_type::value_type(0xD3AD7AFE4F1559E44A0BA1AD97874655811EC9793DA8693CC07CFD15BB46B593_cppui256),
+                            typename field_type::value_type(0x5E5A094AE446526E40CAA5D458436A5DB775B77D67D506BFE948073D754B8367_cppui256),
+                            typename field_type::value_type(0xAE8AF8C9A4795E05C2C901F1572A4B7A796AA9EF3DE5FFA445329A9D91CE85CA_cppui256),
+                            typename field_type::value_type(0x8E0CA824D7A351DBA80280A07E71DB7035AE68136CC24CA3E7B54F301A077674_cppui256),
+                            typename field_type::value_type(0x04EC560759192D41DC569D24DA62CF57CFF60419D2F910290B84CBEC12B7ED98_cppui256),
+                            typename field_type::value_type(0x00D4E0ADB9702E859DECCB83310CB82DE6A52F189D1F8FCAF198579397B10D9D_cppui256),
+                            typename field_type::value_type(0x87B801981837640947D2F846432287F70B5898C978E2D923E82100487140DCED_cppui256),
+                            typename field_type::value_type(0x2ED76C1152AC36007AA17C85A5F902F17C845A05A4E0AAA07B05E8360CBCAD59_cppui256),
+                            typename field_type::value_type(0x639F4D4043B85F222CDA6EAEC81767ED5F72C60130A7F94114AC7A89C4EA66FE_cppui256),
+                            typename field_type::value_type(0x0366521368EF74C0F6F7A19AEEC4A667632E2045B1A270BB20811A609C9CAEE8_cppui256),
+                            typename field_type::value_type(0x1F18C32B2A93DED99949FC681BA6944501CBA9893295BA7F0A9EC6A3B772B711_cppui256),
+                            typename field_type::value_type(0xF7BB50DA51C982D1C5FA63553E3D66C1AFDB5821A321B4AFE96AFC5EA8192441_cppui256),
+                            typename field_type::value_type(0x93CC3BE30334A526311BC63BDDE6485DB1CFDC1FBBC4C74BBC640EA1D45165AE_cppui256),
+                            typename field_type::value_type(0x959396981943785C3D3E57EDF5018CDBE039E730E4918B3D884FDFF09475B7BA_cppui256),
+                            typename field_type::value_type(0x2E7E552888C331DD8BA0386A4B9CD6849C653F64C8709385E9B8ABF87524F2FD_cppui256),
+                            typename field_type::value_type(0xCBEE1405FF0DA7DEAFE32CA7DD73D95ED702226B391747C707275A940BC8F53B_cppui256),
+                            typename field_type::value_type(0xF6211F4F4E75F902B51F3E689B8294CF0D9FF4F68126F7282922E6B278C87F45_cppui256),
+                            typename field_type::value_type(0x0AE97675CEB72F7E788F690DFBCCCF149F309CCB6DDF72AEA09C5DD90FD69985_cppui256),
+                            typename field_type::value_type(0x91219973F6E48D14E9B8DFEE051A54C5D0B99D417AEE1AFF89C8EB411409A003_cppui256),
+                            typename field_type::value_type(0xADD5BAD28FAAF5ACDD580BFA0BA252E03DE3BEAEFBD71B9CF377C88B14B311DD_cppui256),
+                            typename field_type::value_type(0xE9C43CF4DA3DC3A5974E434F8359814F52D4E1E7669B9B8902F982F349D6C38D_cppui256),
+                            typename field_type::value_type(0x2B15862A5AC1612EC9B65F1778025D1FB723C4C1FE3CC29A9DC193DFD9262B90_cppui256),
+                            typename field_type::value_type(0x2EB0053DAA0A33FAA7A30D52DA8749066F534970F99489A4991996E6483D7557_cppui256),
+                            typename field_type::value_type(0x209D6BCD766163B5248D4468C66D170714FF12C6C41261974E75AE796078AFB0_cppui256),
+                            typename field_type::value_type(0x1A2F13429E7B3280A0965BABA9898A5B01EDB79339F4E3E385D1B775A740B310_cppui256),
+                            typename field_type::value_type(0x6AF9EAED1A96EE677EE95C1616E4769AF2D2C89491040EE593F9714CA8E7BE40_cppui256),
+                            typename field_type::value_type(0xB3812A11690066496709EA428347DC8145E3F666A0F59569FA416E026E387E1C_cppui256),
+                            typename field_type::value_type(0x53F2432BA81717143FA9DF3DFF41CED24A29B314BC5A8C96F5F6400A0D7C0979_cppui256),
+                            typename field_type::value_type(0xBD52EFFBC1F079B7CCD4E3E0911B07DE4BD5A4F5C9E8B845F9F7E90C537B36A2_cppui256),
+                            typename field_type::value_type(0xD2A63A50AE401E56D645A1153B109A8FCCA0A43D561FBA2DBB51340C9D82B151_cppui256),
+                            typename field_type::value_type(0xE82D86FB6443FCB7565AEE58B2948220A70F750AF484CA52D4142174DCF89405_cppui256),
+                            typename field_type::value_type(0xBAF183A76100525E23BC7202033725F922B9CD6B36C413497C6C4BACCA72DA5F_cppui256),
+                            typename field_type::value_type(0xDEAC9FBE9CCB4D335688BD58DD69B1D18E2336C5CA739361377CE628A8F2A0CF_cppui256),
+                            typename field_type::value_type(0x41081105221FFB73BEFE170F31BF245F5C2ABEF5F18BF1F17859F635EE4B3BA0_cppui256),
+                            typename field_type::value_type(0xDC37F36976FF5668F2CA65AE1D6B84981336498565A06455486961DC17525595_cppui256),
+                            typename field_type::value_type(0xF7AEF8A7E38440238F9332906E48F6FD5ADBD02D56B76A5FFA5ACA58C56C3943_cppui256),
+                            typename field_type::value_type(0x4E3B0B44D5FFDA797C442BBDC3AB3FCFEEC30184A8DCD003431F627FACF442F1_cppui256),
+                            typename field_type::value_type(0x63A2A210A16CC0C8C8CF22990531D65EDBDF22833B8A02184629C9B893D98DED_cppui256),
+                            typename field_type::value_type(0x882B42E2E7FEC76FD065033254ED94461FABF6A009C7873A519197D4E0D1CFC2_cppui256),
+                            typename field_type::value_type(0x1CD276D793A2BDFF8E2C708627320F124513068BF5DA5DF02089E66A000E5485_cppui256),
+                            typename field_type::value_type(0x6615BDD18B2EAF738D4B34D4552E977F99D0E270B209A4ECCA5CF051885FBD7F_cppui256),
+                            typename field_type::value_type(0x0C15815D449D67CA3DF12E2E5D57BEF080FF7371901E8D7EEA861A50B8045445_cppui256),
+                            typename field_type::value_type(0x2F30D60A3AE94115D0A93C3B6663CD28BA3054E43658CEA3214F87D54054A206_cppui256),
+                            typename field_type::value_type(0xDFB547CB10019036C5A2E29F0DDDBB1F7AF2FA25A3C7A78C1FAC945711924459_cppui256),
+                            typename field_type::value_type(0x9ACCD2A9BA0F47088B8389CE9DC864CC22AF0930E5C031DCFA205E0DCC65FD9E_cppui256),
+                            typename field_type::value_type(0x64587E2335471EB890EE7896D7CFDC866BACBDBD3839317B3436F9B45617E073_cppui256),
+                            typename field_type::value_type(0xD99FCDD5BF6902E2AE96DD6447C299A185B90A39133AEAB358299E5E9FAF6589_cppui256),
+                            typename field_type::value_type(0xB866D6B142DF940F2CF28B54C92F0C1294E0B6A22A91F2EF44BCD88C4384480D_cppui256),
+                            typename field_type::value_type(0x1914B0B3426AEB7089A278D7EA9AD7AC24E522804B1D86D60E659B470C4CAFA8_cppui256),
+                            typename field_type::value_type(0xBC477BD55A4203F836A213CFC592A17AC34604C07C004859ADF714720E103DD6_cppui256),
+                            typename field_type::value_type(0xE31E1E2429A8DD526CBAC552C6DEA6395D293572C63B44AC639082D8D6F7C343_cppui256),
+                            typename field_type::value_type(0xEC2BB89085DE819EC4D9D1646102BA87E2D52AE4ED4FE455D229CDA81DB20D6C_cppui256),
+                            typename field_type::value_type(0xCCECC17661E013A1332F66F0650940C633A2364BE87EFA98A0E99C4D629CF4A0_cppui256),
+                            typename field_type::value_type(0x589DB4FE5A6BB8380303B423267BF8E80AC5AF1404E634907D0DC3B0D44EAB31_cppui256),
+                            typename field_type::value_type(0x6255445C108AA2A4F607062024BD90F31F610E552148F8DB941AEBE751361F6A_cppui256),
+                            typename field_type::value_type(0xB1D25D51B4558F5FD0CCB8683AF9A9CF62A169C691627FA592D80B1836695F94_cppui256),
+                            typename field_type::value_type(0x706DDA72030E90B1F7BEA0AC19ABA81760F6F18DAB863EDCA5B7EB9A5EE32736_cppui256),
+                            typename field_type::value_type(0x1339B337D16E2FA2EA8A1860AD6EDB7C42831C1C560336C67BF961729A0C2C41_cppui256),
+                            typename field_type::value_type(0x9F9B296362C7AE5BA7A3240FD113A3406B1227F87DE923A4185F054BA9F1BC2B_cppui256),
+                            typename field_type::value_type(0x71C4A7E389E296CED39D75EF5E545905E50050640F50BECF38A60ECB23B09D0F_cppui256),
+                            typename field_type::value_type(0x1313FADB737AF3BA0AF3E0A292F810AA786F2B084A62FFC7637B1F01720DDB62_cppui256),
+                            typename field_type::value_type(0x8481BDE0E4E4D885B3A546D3E549DE042F0AA6CEA250E7FD358D6C86DD45E458_cppui256),
+                            typename field_type::value_type(0x38EE7B8CBA5404DD84A25BF39CECB2CA900A79C42B262E556D64B1B59779057E_cppui256),
+                            typename field_type::value_type(0x9629A450BD383A8B9FD43C6CD1D492BF392ED605299561DDE54433526CE9F114_cppui256),
+                            typename field_type::value_type(0xBF439B280C5FB6D7576BEFD220CEF64DB925593E5C56AF8DCA3972C4A24AA391_cppui256),
+                            typename field_type::value_type(0x3BEAED1E0F518C5F0894E6B05FE00BC811DC13DB08D0646B160A0FA4152DA17D_cppui256),
+                            typename field_type::value_type(0xC3B0D7F55AFF7ACDFEF4A8BEBE80E1B554CDE77B8DFEC416CE704985ECC768D2_cppui256),
+                            typename field_type::value_type(0xB73B1C47EF1E4688EB1730DA7CC893DF1477D747E187E18383D38D9626CA6CC3_cppui256),
+                            typename field_type::value_type(0x584315CB294922A90A57D64BBCC805097322A25209757F5AFAC35D76A54FDBA3_cppui256),
+                            typename field_type::value_type(0x6E73DBA0CBDC9D618752DFC039275997E74E3221420311B7234FA17DBA4EDCC5_cppui256),
+                            typename field_type::value_type(0xEE0AC1FC49EECC48BEA4550888828693278A77DA700679037B31F7CDD59DA0E4_cppui256),
+                            typename field_type::value_type(0x131641D11D602B14722615253DBCF027A92429A2F7E39A75C1B9AD04D063E1BE_cppui256),
+                            typename field_type::value_type(0x4C3BDA61796039F06A42E30FCDBD2BEBBD0FAEC0F9745B77FDD1FF3E21FEC890_cppui256),
+                            typename field_type::value_type(0x7706DD8937E5B5927627D97EAA47C3100490F5FA329ABB31409C4C424A80B979_cppui256),
+                            typename field_type::value_type(0x8A02A9827D5BB7147778DD7991EA9C7117FA0A34FD7EFE3214CF48104126CFDE_cppui256),
+                            typename field_type::value_type(0xEDFE16B2DB40180311F9892007A2FEF7D05B2A3BB676899F9C6E2192D38F93E0_cppui256),
+                            typename field_type::value_type(0xEE6902F1FCA5DB3694D74FAA4B05D0D25B3D5100C46E227E3D01793DE29405AD_cppui256),
+                            typename field_type::value_type(0x13464A57A78102AA62B6979AE817F4637FFCFED3C4B1CE30BCD6303F6CAF666B_cppui256),
+                            typename field_type::value_type(0x69BE159004614580EF7E433453CCB0CA48F300A81D0942E13F495A907F6ECC27_cppui256),
+                            typename field_type::value_type(0xEB3CF8F532245362EC05C88C85FE12D19182BE7DCEABE577C75849C6065084AE_cppui256),
+                            typename field_type::value_type(0xC833C78222D9D70043FE63DCEFDCA4A1F52B45C5E7DBD2A66F67C1FFF96B9480_cppui256),
+                            typename field_type::value_type(0xDDE9D514DD9EE6962C6ED6B2BF05B5CFDDEA171B94FC9AEBF216B2098ECA5F51_cppui256),
+                            typename field_type::value_type(0xB84E69133CE28111D891F34B0A7F8F0950FEEBE8DE89571F9AD69A73D0C638F7_cppui256),
+                            typename field_type::value_type(0xBDF1A67D092D99974F7A60F2184519B2A576FCF984A201D9F8E5BCBCC2E9A5D0_cppui256),
+                            typename field_type::value_type(0x4095902BAB65A1AAA80BE54A86BF7BAAA6280B61E5626461CDB4F7018562FF7B_cppui256),
+                            typename field_type::value_type(0xFD1A6210236993736E9F406EB1204B179AED513E20AD46EC2F906B05999C88E4_cppui256),
+                            typename field_type::value_type(0x1AC97B54B9C8C20BFB13C06954977782DC6B71D495CC00F299C8C916595BC8DF_cppui256),
+                            typename field_type::value_type(0x0D538CB1DBB0F4C8D5C454F68A28DA59A345758924A4D6F01CCC6A55A09B0CCA_cppui256),
+                            typename field_type::value_type(0xC8196BAC7A3EC110CB0A8D5C40EED7CF8534CD99D89134C9731B147E0C929E05_cppui256),
+                            typename field_type::value_type(0x4EE48531D8C296B9F13FFCE4F2C86DC7CF2DA5738D892D68BD515B5B5F8018CE_cppui256),
+                            typename field_type::value_type(0xB68F9ED4810BF8B5FC7B4408D0C7C5E671074971B4E806013C35A61B1E48381F_cppui256),
+                            typename field_type::value_type(0x68856A6EDDC4EC29CD5BE267B64483B48C3B4196477DA62ABDE5FC173B27E771_cppui256),
+                            typename field_type::value_type(0x77A33DF14F79A1FB13B6FD49C19F7B4A331D22F293B0733A6118D62A07BBDAB6_cppui256),
+                            typename field_type::value_type(0xBC4A9DF5B713FE2E9AEF430BCC1DC97A0CD9CCEDE2F28588CADA3A0D2D83F366_cppui256),
+                            typename field_type::value_type(0x0D3A81CA6E785C06383937ADF4B798CAA6E8A9FBFA547B16D758D666581F33C1_cppui256),
+                            typename field_type::value_type(0xDA433D5E11CECCC0ABC5C7626CE7BAB42E89B221F785C409282DE545F3FCEB19_cppui256),
+                            typename field_type::value_type(0xE498DBD321A810301DEBBDC4AF95E5218E77FC2D9227B277684E7120A6F5CC64_cppui256),
+                            typename field_type::value_type(0x39D7349D9331B378D3C725DBAB0015347295F18EDA146A66B06A2E32F712BE3C_cppui256),
+                            typename field_type::value_type(0x8F929B4F56EF3BF7FB127554C66812E8EF5EF7A5ECA41644CC3019F41C6FF65C_cppui256),
+                            typename field_type::value_type(0x031E8E1EE9E8C7EC1C1C116981C16EFDBCC4838A72207E0654DE275C5ACF692A_cppui256),
+                            typename field_type::value_type(0xAD7E7F5B465B353DD9D0970290D6743B70649827C5BF73B09CC2A84EB16F667A_cppui256),
+                            typename field_type::value_type(0xF0CBA617F7DC1DD09E51CD6C2995AF26C699723994F82E035AAE4FBCDF77F22B_cppui256),
+                            typename field_type::value_type(0x1A25AB4313F9DF989EF326C36516D04004F18C7E90A095661FC8E2C75909A03C_cppui256),
+                            typename field_type::value_type(0xB4319CC90F3E0D3B313626AE5385796BC49B300C88BA4553DEC0AA4A77829372_cppui256),
+                            typename field_type::value_type(0x4707D4499A6F502BFFB7AFE09C21C5A2707B1215CA3E11BB7729CCC00ADD5427_cppui256),
+                            typename field_type::value_type(0x381D7AB9DB2154D321D170E8D87268ED8D6BFE235BD1F47658ACDCD4C6509C12_cppui256),
+                            typename field_type::value_type(0xA47AAB5B7FDA3DA9EB5D24573A6581E7205828586CE6EAF754642A8E2EB46102_cppui256),
+                            typename field_type::value_type(0xA9878607A88D61155D3E00D862657F73E9C9BF363FC7A91592BBD7FF81F488B6_cppui256),
+                            typename field_type::value_type(0xD181A1ABD58895D61C063E7C82157C2239D0F01964AD5C6D495A7BBB031DAB1D_cppui256),
+                            typename field_type::value_type(0x8C28A97BF8298BC0D23D8C749452A32E694B65E30A9472A3954AB30FE5324CAA_cppui256),
+                            typename field_type::value_type(0x40A30463A3305193378FEDF31F7CC0EB7AE784F0451CB9459E71DC73CBEF9482_cppui256),
+                            typename field_type::value_type(0xAB1AC1872A38A2F196BED5A6047F0DA2C8130FE8DE49FC4D5DFB201F7611D8E2_cppui256),
+                            typename field_type::value_type(0x13F4A37A324D17A1E9AA5F39DB6A42B6F7EF93D33E1E545F01A581F3C429D15B_cppui256),
+                            typename field_type::value_type(0x9729247032C0DFCF45B4841FCD72F6E9A2422631FC3466CF863E87154754DD40_cppui256),
+                            typename field_type::value_type(0x91D1A244265FEA1DCD15C75DCBD4DF3690DAE85255ACAF49384B492F2AA36143_cppui256),
+                            typename field_type::value_type(0x2564FE9B5BEEF82D3703A607253F31EF8EA1B365772DF434226AEE642651B3FA_cppui256),
+                            typename field_type::value_type(0x8AD9F7A60678389095FA14AE1203925F14F37DAB6B79816EDB82E6A301E5122D_cppui256),
+                            typename field_type::value_type(0x89637F97580A796E050791AD5A2F27AF1803645D95DF021A3C2D82EB8C2CA7FF_cppui256),
+                            typename field_type::value_type(0x2D1FE1248C888424D57B9CF154357489F87BC6A38E42EAB7BED415E170493E68_cppui256),
+                            typename field_type::value_type(0x71EFA4E26A4179E112860B88FC98658A4BDBC59C7AB6D4F8057C35330C7A89EE_cppui256),
+                            typename field_type::value_type(0x145FA81F8BB624AE9EFB2C32B17294A22AAAFAB88E5E9A0B4F489329C1366A2E_cppui256),
+                            typename field_type::value_type(0x308138E71BE25E092FDC9DA03D5357421BC7280356A1381A6186D63A0CA8DD7F_cppui256),
+                            typename field_type::value_type(0x28D1E2D28828FC925E39EC45D1408E18C8165646434AD915E415F2478A92C7F2_cppui256),
+                            typename field_type::value_type(0xFF3D6136FFAC5B0CBFC6C5C0C30DC01A7EA3D56C20BD3103B178E3D3AE180068_cppui256),
+                            typename field_type::value_type(0x133239BE84E4000E40D0372CDD96ADC1547676F24001F5E670A6BB6E188C6077_cppui256),
+                            typename field_type::value_type(0x08EA9666139527A8C1DD94CE4F071FD23C8B350C5A4BB33748C4BA111FACCAE0_cppui256),
+                            typename field_type::value_type(0x620EFABBC8EE2782E24E7C0CFB95C5D735B783BE9CF0F8E955AF34A30E62B945_cppui256),
+                            typename field_type::value_type(0xC25F637176220CD9F3A66DF315559D8263CF2A23A4AB5AB9A293131DA190B632_cppui256),
+                            typename field_type::value_type(0x53154FEDE94D2873989049903809D7980A9F04FF9E027A1D6EEBF3D6FC9590CF_cppui256),
+                            typename field_type::value_type(0x383B24FBEA14253AC37B0D421263B716A34192516EA0837021A40B5966A06F5E_cppui256),
+                            typename field_type::value_type(0x54CF706AC4EDBA2044CF566D54EA5A19E8F6AE74BB8C2B04089F4786D3C6E772_cppui256),
+                            typename field_type::value_type(0x2A9E8DFE3CCE6BAB3E82D82A5688544C0C7B55DC31978B4DE2CCB3B7D466D561_cppui256),
+                            typename field_type::value_type(0x01DFEDA5C16E651FBAC7B5AD608B96CF5E01EAEC17A02182F96CCF5252E76373_cppui256),
+                            typename field_type::value_type(0xE68432D03E02ED6D789E59C6B60D790C2B0D1CE336838195C7975C1D4638A136_cppui256),
+                            typename field_type::value_type(0xCA5BE41398E35A6624D2A7303A01E6472E09E3EBDB357336AAFD18108C6C2584_cppui256),
+                            typename field_type::value_type(0x95E62D4292E46218BD49E4C992FF998068114A105C1DC6C02139B408DBCF2DCE_cppui256),
+                            typename field_type::value_type(0x06B68184296C2875183A26E2B428D52E5E7B30603704D20E62BDDFDF58C86594_cppui256),
+                            typename field_type::value_type(0x395DD559E2FE5C2A0EEFBDECE7306E7FB472985F391BD6807CE87C4416E8C10C_cppui256),
+                            typename field_type::value_type(0xFD62DCD4B4592AC5D0413E87AFFA4E274C909C04DC66922CBC3D6D9305FE638E_cppui256),
+                            typename field_type::value_type(0xB23790A42BE63E1B251AD6C94FDEF07271EC0AADA31DB6C3E8BD32043F8BE384_cppui256),
+                            typename field_type::value_type(0xFC6B694919D55EDBE8D50F88AA81F94517F004F4149ECB58D10A473DEB19880E_cppui256),
+                            typename field_type::value_type(0xDD3625FAEF5BA06074669716BBD3788D89BDDE815959968092F76CC4EB9A9787_cppui256),
+                            typename field_type::value_type(0x7A188FA3520E30D461DA2501045731CA941461982883395937F68D00C644A573_cppui256),
+                            typename field_type::value_type(0x276B9EFF8F2AA88365A441507EEF123BE1520D4EBA9DAC5117F014D8F76A9A68_cppui256),
+                            typename field_type::value_type(0x39F8AAB0F2F7DB81BC0EBC0D08E5DAB73E845314A0D6029E81D66AC5B8E7EB15_cppui256),
+                            typename field_type::value_type(0x73DA00C11C7335A80442E4ABDCEB4DA15958D5C10099FBE81A9D2A73771E3A93_cppui256),
+                            typename field_type::value_type(0x7B0DA34C81FC00C9EE36877BFE96FEDC4F3F094ECA2AD66E8019418DCC8306CD_cppui256),
+                            typename field_type::value_type(0x580945B2798EE80C3BDF4209E24EA870A2C5D0525734FEED0B3079775CE776C1_cppui256),
+                            typename field_type::value_type(0x02E4965553D78E0217F1362101A62357D5F84CA2C9DA16F3EBE57358CA897C27_cppui256),
+                            typename field_type::value_type(0xDD729D244F6625660763F9AE2EF0775D77B02A336D35A081CA05C537C5621705_cppui256),
+                            typename field_type::value_type(0x038FD32C9B8984B3FF970CA1C4A8FCD1149B14E69CC030760CFF2CD1742720B6_cppui256),
+                            typename field_type::value_type(0x67E66AAA7AA0977FE26C36D236A10E8682D70DE9B325049C84D100C5C66BA283_cppui256),
+                            typename field_type::value_type(0x46F663A6FC79A6AF2D6E39D2B05C7B136FEB5D145BF69509D8793DFF53AF257F_cppui256),
+                            typename field_type::value_type(0x0C41E12BDC86C2437825B40DC391ADDFA6E740B879EF24D718455CB951F35C55_cppui256),
+                            typename field_type::value_type(0x9506FE1E627EB08874772E942639B51DFBCC9E2F482316C1312C2714210EF6B8_cppui256),
+                            typename field_type::value_type(0x711E24F1DF8ACFFA707CF699836250AEBE60E55EB70D4C520E1AB8297CFEA6FF_cppui256),
+                            typename field_type::value_type(0x5DE91A212BC52FA460F1F87B8FAC0DA8ED2105E24E5A4B6F8601982132BFEDB9_cppui256)};
+                };
+
+                constexpr std::size_t const generator_table_params<detail::secp_k1_g1_params<256, forms::short_weierstrass>>::window;
+                constexpr std::size_t const generator_table_params<detail::secp_k1_g1_params<256, forms::short_weierstrass>>::windows_count;
+                constexpr std::array<
+                    typename generator_table_params<detail::secp_k1_g1_params<256, forms::short_weierstrass>>::field_type::value_type,
+                    2 * generator_table_params<detail::secp_k1_g1_params<256, forms::short_weierstrass>>::windows_count *
+                        (std::size_t(1) << (generator_table_params<detail::secp_k1_g1_params<256, forms::short_weierstrass>>::window - 1))> const
+                    generator_table_params<detail::secp_k1_g1_params<256, forms::short_weierstrass>>::table;
+
+            }    // namespace curves
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_SECP_K1_GENERATOR_TABLE_PARAMS_HPP
@@ -0,0 +1,1118 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SECP_R1_GENERATOR_TABLE_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SECP_R1_GENERATOR_TABLE_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/params.hpp>
+
+#include <nil/crypto3/algebra/curves/secp_r1.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+
+                template<typename ParamsType>
+                struct generator_table_params;
+
+                /************************* SECP256R1 ***********************************/
+
+                /**
+                 * Affine multiples (j + 1) * 2^(window * i) * G of the generator for j < 2^(window - 1),
+                 * i < windows_count, as consecutive x, y pairs. Generated by
+                 * "python3 scripts/generator_tables.py include/nil/crypto3/algebra/curves/params/generator",
+                 * do not edit.
+                 */
+                template<>
+                struct generator_table_params<detail::secp_r1_g1_params<256, forms::short_weierstrass>> {
+
+                    using field_type = typename detail::secp_r1_g1_params<256, forms::short_weierstrass>::field_type;
+
+                    constexpr static const std::size_t window = 4;
+                    constexpr static const std::size_t windows_count = 65;
+
+                    constexpr static const std::array<typename field_type::value_type,
+                                                      2 * windows_count * (std::size_t(1) << (window - 1))>
+                        table = {
+                            typename field_type::value_type(0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296_cppui256),
+                            typename field_type::value_type(0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5_cppui256),
+                            typename field_type::value_type(0x7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978_cppui256),
+                            typename field_type::value_type(0x07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1_cppui256),
+                            typename field_type::value_type(0x5ECBE4D1A6330A44C8F7EF951D4BF165E6C6B721EFADA985FB41661BC6E7FD6C_cppui256),
+                            typename field_type::value_type(0x8734640C4998FF7E374B06CE1A64A2ECD82AB036384FB83D9A79B127A27D5032_cppui256),
+                            typename field_type::value_type(0xE2534A3532D08FBBA02DDE659EE62BD0031FE2DB785596EF509302446B030852_cppui256),
+                            typename field_type::value_type(0xE0F1575A4C633CC719DFEE5FDA862D764EFC96C3F30EE0055C42C23F184ED8C6_cppui256),
+                            typename field_type::value_type(0x51590B7A515140D2D784C85608668FDFEF8C82FD1F5BE52421554A0DC3D033ED_cppui256),
+                            typename field_type::value_type(0xE0C17DA8904A727D8AE1BF36BF8A79260D012F00D4D80888D1D0BB44FDA16DA4_cppui256),
+                            typename field_type::value_type(0xB01A172A76A4602C92D3242CB897DDE3024C740DEBB215B4C6B0AAE93C2291A9_cppui256),
+                            typename field_type::value_type(0xE85C10743237DAD56FEC0E2DFBA703791C00F7701C7E16BDFD7C48538FC77FE2_cppui256),
+                            typename field_type::value_type(0x8E533B6FA0BF7B4625BB30667C01FB607EF9F8B8A80FEF5B300628703187B2A3_cppui256),
+                            typename field_type::value_type(0x73EB1DBDE03318366D069F83A6F5900053C73633CB041B21C55E1A86C1F400B4_cppui256),
+                            typename field_type::value_type(0x62D9779DBEE9B0534042742D3AB54CADC1D238980FCE97DBB4DD9DC1DB6FB393_cppui256),
+                            typename field_type::value_type(0xAD5ACCBD91E9D8244FF15D771167CEE0A2ED51F6BBE76A78DA540A6A0F09957E_cppui256),
+                            typename field_type::value_type(0x76A94D138A6B41858B821C629836315FCD28392EFF6CA038A5EB4787E1277C6E_cppui256),
+                            typename field_type::value_type(0xA985FE61341F260E6CB0A1B5E11E87208599A0040FC78BAA0E9DDD724B8C5110_cppui256),
+                            typename field_type::value_type(0x2377C7D690A242CA6C45074E8EA5BEEFAA557FD5B68371D9D1475BD52A7ED0E1_cppui256),
+                            typename field_type::value_type(0x47A13FB98413A4393F8D90E9BF901B7E6658A6CDECF46716E7C067B1DDB8D2B2_cppui256),
+                            typename field_type::value_type(0x9482FB0E492539EC8CCE745BE070CDA11C2E92960A201A61ABFB9DC69E4536CA_cppui256),
+                            typename field_type::value_type(0x351D9CA745F157F91A5D638CA7534E63F63D5E295707BFBB1FAD863BF58CC1C8_cppui256),
+                            typename field_type::value_type(0x0A0643FB8FCC14DEF67A6A5EB1BF8E9125B35EDC7338D816AA4110A6B90EE785_cppui256),
+                            typename field_type::value_type(0x553438324A9E7955C520DACDA2920E700DA10D00E7012ED7BAC0D100861F9CC2_cppui256),
+                            typename field_type::value_type(0xB2E1B7C17AE931195B835A5153081EEB63764A1CDBD0633C49B1DAE295ECFF13_cppui256),
+                            typename field_type::value_type(0xE6C0441313A3EBCCF233A1A2AAD758C387DA1A9817DEA2E6A3BA4989B2187D44_cppui256),
+                            typename field_type::value_type(0x492003A35C8C3794D24451D361C37440E512FCB2ACBAC2F4AD24CB7AFC635A50_cppui256),
+                            typename field_type::value_type(0x1F1569CFB333B4DE4D832FF96BDC79A23C1BC670E0B2E049C9166B28B8188B9A_cppui256),
+                            typename field_type::value_type(0xB433462E7F1B6BC2CB34177DCBC6EE340703E87DFC2309E438BBB334EEF87286_cppui256),
+                            typename field_type::value_type(0xA0DA54526ED2B5FE383F4E72C1692E6F9DCE20806A2CEA4B7AC047F6841496D9_cppui256),
+                            typename field_type::value_type(0xAE3F7DBA0BDE8B6AD7CE2F8EEDE4B762C556DEA678F859626A9E6235A674C4F6_cppui256),
+                            typename field_type::value_type(0x1C0549FC0A69995A24B8C213249DB9A97940500D085F8A5C1EE0553E711F4B53_cppui256),
+                            typename field_type::value_type(0x34A2D4A3B009165987FFD1528603ED61190D0B710D6A564C2DB2E35F12D0441B_cppui256),
+                            typename field_type::value_type(0xBEAAED6A53A1E3C22BCA71046E777FC0E7D766B9DEDDD81DB424E7845E93B146_cppui256),
+                            typename field_type::value_type(0x04C490528BE759E4E8897BBD818D459AA416B9AE0B3C5DFC3469CEA39F3F98DE_cppui256),
+                            typename field_type::value_type(0x30E50B46405CC74FADE84C66242A8107471D9D7B4A4605EEEBD949434E8D6E96_cppui256),
+                            typename field_type::value_type(0xA98B0A07ADC359AA1B58C5FFA95D23ED3ABFB7AB74F644A9DCE4AE33BDA08424_cppui256),
+                            typename field_type::value_type(0x4754C64722499B66E5319E8C8E1D1320752BE80BA0DF582D361287A0E831800C_cppui256),
+                            typename field_type::value_type(0x16949B7287D4F481897299B9EB6FE80CCDC5849AE1D527E280E76BB98E61CA07_cppui256),
+                            typename field_type::value_type(0xE7A4146D770EDEDEBDF997B75B6012094D2D6AC6FEDF983AA09C2BE7A0420427_cppui256),
+                            typename field_type::value_type(0xA034F009C88DAAC5D21B6B78C85A696DD22F918D81BD29B3B52D7E5E883C2D6A_cppui256),
+                            typename field_type::value_type(0xFE1B0036CA899C1FB0CDB8545CECEB06BE06035F16267E7CF4336EF2C2C30E72_cppui256),
+                            typename field_type::value_type(0x3FB660A7F0E14DA3A8420FE520B265CBB71BDD3C3F3F923B6D61FDB48F6752CD_cppui256),
+                            typename field_type::value_type(0x6545851D4224637C4C2869C4D9577D598BC013BD1100A0C12F12E8C064C6017E_cppui256),
+                            typename field_type::value_type(0xB52226FF319D4401A076E2B40962E9A14A096CF82B793E4D716A51DD28BE8C78_cppui256),
+                            typename field_type::value_type(0x701EE0C9F539F540CA1B36697E92851A819F7FC8E5B58FF3203367CA51686903_cppui256),
+                            typename field_type::value_type(0xB01A67F716475F72886A8F4749B86176281B195FF46F925AE1404A861ABE45C0_cppui256),
+                            typename field_type::value_type(0x7C521BBF5A3956E2ACD56B13164EF99472FC676341B62C7FC72F0DBE0090106C_cppui256),
+                            typename field_type::value_type(0xE716AED2CF069E4D997789672E6D6BD2508676F2F4FD0A64F077E8DAA245573F_cppui256),
+                            typename field_type::value_type(0x353663E694FC72AB5912B06687B9A851D13D0DF2FA07C9B3505FC26B469218D1_cppui256),
+                            typename field_type::value_type(0x5A57C3E3548207EF2F4541CF25B5E81B6B2E5D2FCEC451F4B5113C2B357174B3_cppui256),
+                            typename field_type::value_type(0x077C7B303E69224601B1165729F3443328886700134BB92888CF5959383437E3_cppui256),
+                            typename field_type::value_type(0xD2BF898D6F507CE864E5558A4C1DA22D19CE1ECEE329EDFB7F987930657008AC_cppui256),
+                            typename field_type::value_type(0x69C0B1CB5A6B77AA3F8195DB3FA90C56679CE10AB5FF07988111534A727BEB55_cppui256),
+                            typename field_type::value_type(0x5CE96505EEF7208CD10920ADECFB86AD1A87A974797E4FC58937F00FACB006FF_cppui256),
+                            typename field_type::value_type(0xD16B6EBD381F5AD5EC56D1F22FDE7BC3669D20BEBD955C2B818DCDA107152613_cppui256),
+                            typename field_type::value_type(0x4D88304EE583CE6087FA57391F3064F8B0E4DDEE24203EB7FD0D7CA9782F1580_cppui256),
+                            typename field_type::value_type(0x28A94E709AB0636CE8D6800898FD6518AAFCA3BD68EB1E110C0FB16D5616EDD7_cppui256),
+                            typename field_type::value_type(0x541C97A5C80BE642B28AAA0AA37D9E1676754B6EBB642A20A0C1C454C543D986_cppui256),
+                            typename field_type::value_type(0x054D35662CD2B63254D48455EB64B1447FB3DDC8C61678BD7B0B8F98424B2EA7_cppui256),
+                            typename field_type::value_type(0x17C72727C8FC0EEB3267399202E5AF9E7156421BEA6E26BA5F84C3DAE0C38E11_cppui256),
+                            typename field_type::value_type(0x95C5A4F4FE664B3C40602FCCE901802E7E539945A60CDAE3CD8366BBAE90DECD_cppui256),
+                            typename field_type::value_type(0x71A5BD27C625CA1B4B2A3A4635B1043363A5B8311D31A91915261B05D0B79FBC_cppui256),
+                            typename field_type::value_type(0xC5BF524D066741FFB39452CA1A02F2EFC76B6051EBAA32D0C2E37CCC8F277F6B_cppui256),
+                            typename field_type::value_type(0xA018366F4E91E90D8E5C643340E586B4714AB749C9052A0503E8465C6EADE3C4_cppui256),
+                            typename field_type::value_type(0xE2BBEC1714110B167C6CE578349D8369D5F7284E44614F37F45C42026B26E8D0_cppui256),
+                            typename field_type::value_type(0xCD7CE65D707DA2A69EA25487EA254C45EB7D5ADFFE1CE3EEFEBCCEE647A9112D_cppui256),
+                            typename field_type::value_type(0x85E04A4B4C966F9789B9016AA5EE6708A190AA498BEE60A5FFBABE0D3A92B3AF_cppui256),
+                            typename field_type::value_type(0x9CDF1F00B88D896450BD3B5A6D45055C92F398A562ED958D6E1CDEAC59E0AF06_cppui256),
+                            typename field_type::value_type(0x916D25FED3F2AD664D958BBCDC8D94B0828522DC197CA5468D7A32DB6216ADE7_cppui256),
+                            typename field_type::value_type(0x0F5F0AEA099634718E67D4C73705AE59E8AF0BC36C998BEF6C88AD96C3212F1A_cppui256),
+                            typename field_type::value_type(0xF8A8B2B7C8593C955886AADD4BA16B784F5ED40DDE29AF7C755D7B1E7712B09A_cppui256),
+                            typename field_type::value_type(0x45BFD9D5D1A663EDAB6B1B2D0540448338D6170E843BA51981372B939305097E_cppui256),
+                            typename field_type::value_type(0x09D1DC12855AFD2BBAD88305470CE908683B9D33BFD2C15954BA058E908DDC04_cppui256),
+                            typename field_type::value_type(0x7784F06CF9BFB4003407FAE48FA79A96B0E2D44B1A7F80EF000349ACD95BCC47_cppui256),
+                            typename field_type::value_type(0xCCA2733EC3EDC43A3F8DE493B2FEE6CEF464B5CDD4F6FFB602FBDE0180FBB3B4_cppui256),
+                            typename field_type::value_type(0xB599AD156476693B671E9F9C02895E6FD1FC23C2DD66AEC3CD31F1A0B63BD6DF_cppui256),
+                            typename field_type::value_type(0x6979D1DEC4FAB3324637360B8B23C4166A40C4F691134B458EA1CEA38EFA09AC_cppui256),
+                            typename field_type::value_type(0x471AD0A8D57F5939F15F0D870AE25C9091428BF4E1E6E9172435158CFC4471BB_cppui256),
+                            typename field_type::value_type(0x2234CA62778E8E392A367AB48094D138B0D7E9FF7F23982C454318FA49693A0C_cppui256),
+                            typename field_type::value_type(0x0EC73885141FE54FFEF6A0B570CD98D530E431C1AAD5FCFE8F7DCECB7D96DFF1_cppui256),
+                            typename field_type::value_type(0xD6224F4E87AE875D91ACC4EF580652511D5264CE87ED78AA9EC841AC7C7B552C_cppui256),
+                            typename field_type::value_type(0x477778364E6E1CDE059A0E2532C8F0C69BA12B3112FB6DCFB183B5399660B7C9_cppui256),
+                            typename field_type::value_type(0x2DD89D00B8389E317373EFB6A7C89E8A5E0604C1F142EBCF5C205FA39918C3DF_cppui256),
+                            typename field_type::value_type(0x96DAC3FDC7064A86E992A46A7C42A7B6E94A5C1C64E3183851C324AB088D58E9_cppui256),
+                            typename field_type::value_type(0xCB1FAFF3AD46C1AD856CC4949382C439685BE89B9487E6E380349312AEBEBC5E_cppui256),
+                            typename field_type::value_type(0x353D458D3491B5A8C73D989017E14DD22EC38FAF35F45D260FD8013B26D69D8E_cppui256),
+                            typename field_type::value_type(0x9C7D37BF4F5BDE243130FDE40C040A8A825DFC12FB71A9A8842B9D0020F32B82_cppui256),
+                            typename field_type::value_type(0xE297B23CEB14F312A105DC378AEB8F811D21D271B947B2C58952AD132DB29F92_cppui256),
+                            typename field_type::value_type(0xE1372520F8CB70B4B480DBABB8CD91491223CEBB85ED414160F294C8A5E58DDB_cppui256),
+                            typename field_type::value_type(0xA737BB3DA35A3B5E3171BDB6D33F07E586679FDEA1D8DE803F4DACC55B5E6A6C_cppui256),
+                            typename field_type::value_type(0xC68F53E01F98FFD22B1E765D8E905F150D4E7D487692ED0AB730C7D69054745D_cppui256),
+                            typename field_type::value_type(0x1CD22338FB2B94B66B06BC920D24DA97D91AE394D9746BCAFD943B7B8AD88C33_cppui256),
+                            typename field_type::value_type(0xFC3ACDF838AB48B096C8640AB136BC2713FE51315ECA1E49628EA784248FB1B2_cppui256),
+                            typename field_type::value_type(0xDDAD6BF0172E2240D57180FF0B1BA76E28E6BF035DC617CCAF0D4E79E330C098_cppui256),
+                            typename field_type::value_type(0x0B1371E6935A21897530A4736125ADDAFA333BAD2DB9D1403E5A994D63B67B58_cppui256),
+                            typename field_type::value_type(0xF8F5DCCF4C6A93D7A4A54DAAFAA3449AA87A8069875405D43725C5DCE392D805_cppui256),
+                            typename field_type::value_type(0xE58176CF66D63054389D3E336461327351F3DA64A52143BA026619516CDA02FA_cppui256),
+                            typename field_type::value_type(0xA118B0F24BC45D9C9B317FE248AF581FFD42D88478182A90ACA7F0B2AC51D8A6_cppui256),
+                            typename field_type::value_type(0x698B53FD0F7E1798DF7B25AE09464D6A81922408E376967D8621B55D5C87B030_cppui256),
+                            typename field_type::value_type(0xE12C8E4A865883A94E084AC8946E2D4517110F390207309D19D4B3167FA046F7_cppui256),
+                            typename field_type::value_type(0x7CEC04610FD9A2F3433B3ED5393126F6DD0C04E11331193453A55A28A12646AD_cppui256),
+                            typename field_type::value_type(0xFCC8CA2E4E502D2EDE9EC29566D715EA7BD24BE788828675FA42E8729CF5250E_cppui256),
+                            typename field_type::value_type(0x30B57BCCEEF8BD04F6B9880A8B34DA5C9046BC05C03B2120602E0FBF730FD4A2_cppui256),
+                            typename field_type::value_type(0x394BD474179692093D08E2EFE3D1323648166C57AE22E466B9B127E8C2853C43_cppui256),
+                            typename field_type::value_type(0x2B4D6D52151DC6B9207E3FC2F1D60767D52F6712D90FCF0CB17828CCA064469D_cppui256),
+                            typename field_type::value_type(0x81341AE328B1909526A78CADBC7ED64E1F177E3ABC30F12018DA08BA74CB5CBF_cppui256),
+                            typename field_type::value_type(0xF2A47728B2DEB5F40DD25CFE06CF034980BABDC773BC3358461726673E856D6F_cppui256),
+                            typename field_type::value_type(0xCA8538DF38DE82E9445C6656C59404334ED810396D058961EC2DD739FC722E94_cppui256),
+                            typename field_type::value_type(0x3B27FC42EB9E05C311E73126A1FB9F12F20953A8A48B26A43A0A62DF1049A527_cppui256),
+                            typename field_type::value_type(0x24BBE05BFA35DDC0EE9A4B43CF2E4E3AF349F675D2AF3C3D2318AA0489A95E03_cppui256),
+                            typename field_type::value_type(0xD49405EE090A22CF17182D4DD2760FAAD40AA52E375AA14987DF45ED8D793C4D_cppui256),
+                            typename field_type::value_type(0x6D28B6BFFD4DAF313F85EAAD8E4D71B91CA631161F99218F984A23176F922DBD_cppui256),
+                            typename field_type::value_type(0xAF39D905141DD2FA40FBE1A61CCB4A1C4C24E9F0B84DA29944ABFF02A0EF3CFF_cppui256),
+                            typename field_type::value_type(0xD131E661DD93D815E613947F2D302F2F50EA585CAFB752509789404FC4FB240A_cppui256),
+                            typename field_type::value_type(0x34342C8461A95DA2E79B4C37F48F4FD47423D4EBCDEACDF422F60E1402501A57_cppui256),
+                            typename field_type::value_type(0x7CD3157A7FBFE3DDD3DF0905FC14467EA153D02AC586C840B590DFF99B168B64_cppui256),
+                            typename field_type::value_type(0x9CA08D2117292C6220568E78BCDBFAFB13AC4D9B72E02E35856C0D2B5ABBB16B_cppui256),
+                            typename field_type::value_type(0xAFFF5AF92C807615712E02810BE246A2D0434584477FE2E867E5FDD7B8087DDE_cppui256),
+                            typename field_type::value_type(0x659F6EA22CD060C2099A747EE10A2A22AACF175292DDABE7178346ACD44EB3A2_cppui256),
+                            typename field_type::value_type(0xED860BDB5F2DF8C456B243199D45356264DC554B09D9AEE3B2B1C6FA06EF29E8_cppui256),
+                            typename field_type::value_type(0xB837E74375D5A7FD7C6BF6B340417BB1E7630F5C2D8DAA33501A1C49B9B90F8F_cppui256),
+                            typename field_type::value_type(0x3E65FB3B08594F3A6A65739B8B079177C01974D056F6F88F3D8EF9236DBF52E9_cppui256),
+                            typename field_type::value_type(0xE79BB6600EF807C010BEA6890CF95987600D56D126AEBB433A52541EC710D348_cppui256),
+                            typename field_type::value_type(0x6868CC8FD1D21243735E1C2E7E272C9D47DCD03BC1F1CF599DF918B3F636E617_cppui256),
+                            typename field_type::value_type(0xEED008A5B91BF9E6B3C5903879313F0A60FE30C8A4384CD71C8DDCF3FCBB3D27_cppui256),
+                            typename field_type::value_type(0x8437A7CAB8F3E67C05B8000A73853A82E89DFDB368BC666999FB69A100371F53_cppui256),
+                            typename field_type::value_type(0x968FD75882812A40735483F43819BB8E10E124FEDBFBE259248872D7879CBBAB_cppui256),
+                            typename field_type::value_type(0x7FE36B40AF22AF8921656B32262C71DA1AB919365C65DFB63A5A9E22185A5943_cppui256),
+                            typename field_type::value_type(0xE697D45825B636249F09F40407DCA6F174B3D5867B8AF212D50D152C699CA101_cppui256),
+                            typename field_type::value_type(0x61779471478643436554CAA343ADFA5AA1DD10B8A60E47C0336DD1E7C68278C2_cppui256),
+                            typename field_type::value_type(0x4ECEE7D5A568791F03BFF005C8986473327969992317A1A69D03ECB2EFABD2CF_cppui256),
+                            typename field_type::value_type(0x4B656A405B4E2D7380924E56022F8B808E90E9D2545CF8D976A78091DF0922A8_cppui256),
+                            typename field_type::value_type(0xEE1EA31D12E7783920D04CC255D8C4D6D473B9E2B9850F694DADCAC5999A80BB_cppui256),
+                            typename field_type::value_type(0x521CF0CD89729D1A193D8758ABF96019F7221ABA0101B56BAEAB93965A7D9344_cppui256),
+                            typename field_type::value_type(0xD60220DACBF9E9BAC583FE0ED386371B7A1341CA5A95FBA14529F28196B7064A_cppui256),
+                            typename field_type::value_type(0x9D78956EBD65E13D93DB2BE0FB3D8E5EA09E7CA1F6A60C36B504F88869D07E9E_cppui256),
+                            typename field_type::value_type(0xD5149E6EF48EA8CD6542A89C1D3210CE7460A2DA3B94C7B2F4DD615AC3D8C8EE_cppui256),
+                            typename field_type::value_type(0x7C86B3AD8863A8DD4D56C2613639E7067CE5019BB0000E35BB430CF33B281418_cppui256),
+                            typename field_type::value_type(0xD958BACCEEBEFE954C62B97768DAA72F82EA7C317BC0861B79DD3EED3117E0EC_cppui256),
+                            typename field_type::value_type(0x4ACB1272E1353FA957236846E4DB63165741B2ADBD394207667750867DC4950F_cppui256),
+                            typename field_type::value_type(0x726CD20FB743CDAD8CF298F6CC71E29FDF9E4280B5866AC566C6E44463D8B4DF_cppui256),
+                            typename field_type::value_type(0x176C11C1328ED07B562FC9EFCE42700BBD4BBDEC1543D1A70B3184A32B3FCE8C_cppui256),
+                            typename field_type::value_type(0xD17F8DAE934B8A3589592180B7DE3B7E5C5D842A5BB51AB16EA68436A3C9F19F_cppui256),
+                            typename field_type::value_type(0x6965B6384D7061E685371FE7FF26519E76BBA9DDA2AEA7817AFF4FE1FDDE3445_cppui256),
+                            typename field_type::value_type(0xD1BCDAE39C482511325E496638732DBEF47CE6051A5F99D97CC4389E18855113_cppui256),
+                            typename field_type::value_type(0x9BA1E12F974AC9F39BA834FCB184097148526336679189F10375C0C6EDEE30EE_cppui256),
+                            typename field_type::value_type(0x03D2F132311BEA6C277C3EEA86A877BE62067EBB8C7D4F388A96B83B67B43C5E_cppui256),
+                            typename field_type::value_type(0xE1CBC51DDE75C7DA027E7DDBD4091A71B1EF589B36689789F5E40F96888ACFC5_cppui256),
+                            typename field_type::value_type(0xEC678397CDE7DAEDB312764FFDB9E23CE7D3292BEEBFBA523BC5FED5A249A225_cppui256),
+                            typename field_type::value_type(0xC90EA1FBE9020055485B544D9567E8635A1658F6D17C5B108AFBC67F51C57125_cppui256),
+                            typename field_type::value_type(0x05ACA66C710EDE6B19667AF636E660B1B6A3D07D6DE19A69C669A504DEFB8D94_cppui256),
+                            typename field_type::value_type(0x9C3F267971138AA1731E9D2845A900481D3897E1543C8228758EA53FE107CCC6_cppui256),
+                            typename field_type::value_type(0xDAEE0C1B64B51D9C8BE375F4BF3E6ECA51A8FD4E95F9B186840794CD3DEA9152_cppui256),
+                            typename field_type::value_type(0x67A51D096D01CB39AA47106437DC1824D1DF6426ED18D43361067DF977FC555D_cppui256),
+                            typename field_type::value_type(0xC1095AEA14BF7BE0E175487A3FA794F24363755443132B3E5D9AC5946C12C1D7_cppui256),
+                            typename field_type::value_type(0x5C30D9577C6B2D72796FAC17B140922B2FA2A034E53C2BE421C5EB4395A449E7_cppui256),
+                            typename field_type::value_type(0x8025E3B5B08E1B92164B65F799C592D0B75E4053C3CE790E770EA481AE2677D0_cppui256),
+                            typename field_type::value_type(0x0A88B8F77C8962303D3A1BB4A48C105B9CF25089F822DF8FC1BF1F2DAB3CD7FE_cppui256),
+                            typename field_type::value_type(0x15B63B6905525AC21D4D29D246CAA9900C491C0994D7154C6A3BD234F1661FD1_cppui256),
+                            typename field_type::value_type(0x0FBC341C8C669D7632CA9F0D41BC43DC1EFE47B273B95775258FCA6C4D9AEFBD_cppui256),
+                            typename field_type::value_type(0xBD8022632F360E3FE4014B1D4957D3D3950B069E200A9FF1ED3B6EA9D3E71CA0_cppui256),
+                            typename field_type::value_type(0x829019319D8F776A2DCB6C352620546C54DBEEFA7C1E27F7F3A6DB8A73E44B54_cppui256),
+                            typename field_type::value_type(0xE6A26E713EA8FA1D65888D6EAC1DD9A09F47A0A1011354846803F5E4FE5FE6AC_cppui256),
+                            typename field_type::value_type(0xD76D18ABC4A87AEDB1341C6FFB4FB06DADB3140B8620C1BB8796DFFEE9434837_cppui256),
+                            typename field_type::value_type(0xF6BC4DA32ED96644DE0E4214F7AB933290A458E775B7CCC24FAA04F9BB215B4C_cppui256),
+                            typename field_type::value_type(0xC48DBFA12299CF2A444CD57DB517AC92B41CA518E198A281A5E743CEEA394A20_cppui256),
+                            typename field_type::value_type(0xBC83CBA00E1380BA64FF2E411BDBD6CD9440B125991BB5E24A0580DBEA77A75B_cppui256),
+                            typename field_type::value_type(0xD5C0C6506167FF604F481D1A1F1753D1C5E21C63AC60FE7D02E89F219C07F222_cppui256),
+                            typename field_type::value_type(0x15A30B860817B8850CDE0C77F49F75B9BAF3F51A78813A86E2EF691E0C6FFD57_cppui256),
+                            typename field_type::value_type(0x1B71B816FCB527914439015B8BCE969C2233BC4FF408A8EF5BB8CBE596A178D4_cppui256),
+                            typename field_type::value_type(0x7E659D1DA48A8E2CDE6EF1C28D738FC0E0E5B6C1F6CC11714A2D7EBBB5507F51_cppui256),
+                            typename field_type::value_type(0x734C364E4A46F62CE549CBA66B4C9FE0D39D295A09A1362A4A4716A24E93BFA6_cppui256),
+                            typename field_type::value_type(0x09951503AAA79D049DE981E3520C5F48ECA13620890297C4FC6FA79998D10774_cppui256),
+                            typename field_type::value_type(0x987F256D58CFF9373BE71969FC3A9301E8F9257AE57FDC00CD013F88B049E7CD_cppui256),
+                            typename field_type::value_type(0x8E92695694EC505CE860EBD60007E39E47B4605207AAFFDBB7254BBC6EFA35D6_cppui256),
+                            typename field_type::value_type(0x6608C243773C85DCBC666B9BA97323B234A8BFE70A2E3338C6E3197AA3FE67B2_cppui256),
+                            typename field_type::value_type(0xA1A916BEC521C168846F640DA746E03FC22B159F40C543081923FE5CE5B47A28_cppui256),
+                            typename field_type::value_type(0x70C1FD6918000AA99979BC856E976E5358BC6E018BE062865FC1209B0378BC7F_cppui256),
+                            typename field_type::value_type(0xF7DAABC20D5BC522AAEDF6F122428543F5A9F32F61E1CB0D6D68171CA6AEB856_cppui256),
+                            typename field_type::value_type(0xF0956AE2A6C5DC23206A98117D5786318496614EEB65312C13E6EAAD2BC73E02_cppui256),
+                            typename field_type::value_type(0x433FE6601144E03C76E2058AF2839356672D048DBBAE94572D2CF6998611219D_cppui256),
+                            typename field_type::value_type(0x30AC8E52250D76B2C0733FDEACEC50AAFE32C900BFB0192CBC63B9F4E77E03C2_cppui256),
+                            typename field_type::value_type(0xD694B530C099785E69AA6584002E77A06704BA32CD8786DCA11914FED1DC3F83_cppui256),
+                            typename field_type::value_type(0xDB98EBEA3CA2A60CA52F249D7CF7283488B281A8387C0F597DE22DE51C5FE45C_cppui256),
+                            typename field_type::value_type(0xE0C0F30B75BD85A2DE15129DD8912C8CE983204FAA480E1C44A701C43EF45A22_cppui256),
+                            typename field_type::value_type(0x0B92902A077E8E4C785A855FF7C710084D9F8D7283DF687FCBA43ACB80C6C0BC_cppui256),
+                            typename field_type::value_type(0xDDBBD3CDAD5F6A8C0D6E697A2D161E2004785EE3D92ED23CD088E9D8BAF5DD22_cppui256),
+                            typename field_type::value_type(0x0A73C0160ADDA5F421BA6B3B7D6A51690C4758D5CCAF1CCBAF59E60DE2128EAC_cppui256),
+                            typename field_type::value_type(0x443FDA56044E838CA55CB6DD94F50A7C793759F17755D9CA3859291D64F1180D_cppui256),
+                            typename field_type::value_type(0x5BB99589230A0DF5EF5A97AE7339621236BBA6C05ECDB6AF2D86A63C3E689186_cppui256),
+                            typename field_type::value_type(0x189E83E977ED31595724D461A33C413E92643ED05BC1DCC4EDFB310D1BE3A018_cppui256),
+                            typename field_type::value_type(0xD8DE765227B7873763DE93C34D8B561CF73A835FBB8E9C71C2EBAF8017E55104_cppui256),
+                            typename field_type::value_type(0x2FD29465BE13F2D15C4C628AD1DCF924C2F73FCE1940DB1B2A02EF80E52E08CD_cppui256),
+                            typename field_type::value_type(0xD03EB26A9A38B79B6020F71756A0A320E9227BAB9467B68F06EB9409F722A81B_cppui256),
+                            typename field_type::value_type(0x50C5FCB02C21A3E76CE057045262D4129DFF1A286DF208F595E25F86D8A85767_cppui256),
+                            typename field_type::value_type(0xE3A5786FBD518E33551DFBEAFADDD19187C5472FF4C4284C6939C2C7E987BFD3_cppui256),
+                            typename field_type::value_type(0xF74BAD09535840E68477B9FF4AD8210CA3DCF2ECD928E0817ED31B6C8CC23E7D_cppui256),
+                            typename field_type::value_type(0xFE4091010EB8CDA72D3AD94E07C7976FFF6986D6F1790DD7E834110D03F61C13_cppui256),
+                            typename field_type::value_type(0x081759C1DA40403239486FAF093B0B79F986FBDB99E1D973C3D3CECDBDA0B3AE_cppui256),
+                            typename field_type::value_type(0x42A97041ECA520D411525FFCE96E5E480EDCB5A7E247A07CB67951D222D5056E_cppui256),
+                            typename field_type::value_type(0xF2FC7F66CF0087066EC36DD26B563B26B64E483D6E9FD1FD48414DC8B0F7DB11_cppui256),
+                            typename field_type::value_type(0x5873B9F32AA7B78D28A7CEBE93FC4323CA300C28D0D9E4B67BCA829E0A94A6B1_cppui256),
+                            typename field_type::value_type(0x17A7DBF4ED5E2EB5F4E0379CC39BB95A1F5054889FFB3DF052BF9F98DE524C9D_cppui256),
+                            typename field_type::value_type(0x0D6CA71B1C27964CFE232C2ED65379D66FB899F02DCB3956C6745F91D3DAFD3B_cppui256),
+                            typename field_type::value_type(0xA85130B38FDE293D9FE494A02707DE58A02248ABEE88771AD6ADF1421A6FE6E8_cppui256),
+                            typename field_type::value_type(0xC90E300839DD58951E80957063154403CB4E6644C774364813D00C248FA8EE41_cppui256),
+                            typename field_type::value_type(0x62F504176D19E73C9C0710C6538403625045534717ACCD6E47A63667C3D7C1AE_cppui256),
+                            typename field_type::value_type(0x54CCC9415026D73F20A845B72A58E5B18BD27F198542A0BEEEA6BC92071E5C83_cppui256),
+                            typename field_type::value_type(0x1C433F45B45145323A8F8715DAD2BF22929E0BCC5D8EE496CFD08EF7140916A1_cppui256),
+                            typename field_type::value_type(0x29E34B1BED8AA8149D841014DCFBE83383FD5B1E946F64B2831BB80C01287C25_cppui256),
+                            typename field_type::value_type(0xEA4397DF95EEB3A3C1417CDFCCD96B25CF3A198B6E15A4391D23AD1D75A7E46E_cppui256),
+                            typename field_type::value_type(0x87582EDCB73EFF9539C22C692DCCD9F22F2F422CC47467394C5E3622AF76167C_cppui256),
+                            typename field_type::value_type(0x075B94350AD64A7BFDE102C3C37236A888028F0677197BE86C6FBB616F4D7FF6_cppui256),
+                            typename field_type::value_type(0xD2A076367C5BA19EEA5B5F1D3C001919876F31533AB62409F3D5BE3A53A3A383_cppui256),
+                            typename field_type::value_type(0x79AA09B893B7FCC06643A0F5BB9DCE305981AEFF3F598BCE65F2ABB22E7E0640_cppui256),
+                            typename field_type::value_type(0x4A107ACA1F2736DB1C25B7363566F11E33F657394B821FB046723EE874DE6611_cppui256),
+                            typename field_type::value_type(0x809B26510063EF3934CE64E8F700052E075D547A5C2132AC0358EBEE58A805FE_cppui256),
+                            typename field_type::value_type(0x206084C4FE23394C13309D38E8962018A25280129DEC7B0CE7381D983BD73A10_cppui256),
+                            typename field_type::value_type(0x6133A0F86DA016970C08A9672CEB8393F5C315C424ECC0034912D18DD8D2F229_cppui256),
+                            typename field_type::value_type(0xFD402EB372AADFC9654A0E0D49BF49F6E983FD1D30A8D846FCBA4ED06DCFECB0_cppui256),
+                            typename field_type::value_type(0xD6B34030DDA63A22E9A626389BABA86B1A4B4C24BDE65E7910593F3DEDA08DE8_cppui256),
+                            typename field_type::value_type(0xC56DD686B0FD846A66DCEB631977D5BAD505671AE1ABB34A7748532D4FA43529_cppui256),
+                            typename field_type::value_type(0xF2ACAA85F3F1B263555D2C60A76B8C11619E467816FB7EEE59EDEDACF9A521F6_cppui256),
+                            typename field_type::value_type(0xC5440C597814A47D9F6CC7D1513D7F38E40CD02E32847F01C30FB77122D32936_cppui256),
+                            typename field_type::value_type(0xD27EE9BA383E1FA72EDC1E1D23ECF4ACD8A6D28631E41E5D9A42FA3747CABFD4_cppui256),
+                            typename field_type::value_type(0xD07E95892DAA15AFFF3E42D52F5BAB12F165803DFBD492C0CBE1A18D2C2E32B9_cppui256),
+                            typename field_type::value_type(0x774E4D6506724528731F0769F893EF4E23ED98F15228E81E5E78AD6A2C1A4F5C_cppui256),
+                            typename field_type::value_type(0x3E4D03C45CDFA79B7500E0479B9CFE0A7C1D96F374EE4BDD7D8501EC7989A8E1_cppui256),
+                            typename field_type::value_type(0x12F744D0815A6475AAC117CAD7CAA719FFAF18D5F3BD674098791388441C240A_cppui256),
+                            typename field_type::value_type(0x437F6E07B86FD8FC3A06AE0295829D324275A149E19D957C7601AEEEF79F7B91_cppui256),
+                            typename field_type::value_type(0x5FE8D37CA889F13ABF38B8289B15D63C589A77119139683364B6ACE375270033_cppui256),
+                            typename field_type::value_type(0x01B68449B3D610359A9A249E94485E9FD8C26C7286B7C73F6939A8D0D9BB7902_cppui256),
+                            typename field_type::value_type(0xE59063A1E9379C3E0BF198E5C36D1581FCEB260471836682CD7F44B1E03EE653_cppui256),
+                            typename field_type::value_type(0xD2EA9FB217FD7E77534665997D06E4635533528ADC6CFCBD360CDEED45046203_cppui256),
+                            typename field_type::value_type(0x16AD23B09F909A705B06420824500D4415DFF2D56A34C3F58599F27A3E8EA623_cppui256),
+                            typename field_type::value_type(0x952C3CB1ACCC9CA2335955A7C3AB3A4CF04B356C1999D6BBC29B56D4C371D9FE_cppui256),
+                            typename field_type::value_type(0x59B98546F7D62F06A7DF9136F6ECE5D0664464F11808C75ED76CE6D24189A13F_cppui256),
+                            typename field_type::value_type(0xCECDFF7A5CAB844F79CA1E2A6483EE28B80A7C8A3447DB8FA969ECFEC51CD9C7_cppui256),
+                            typename field_type::value_type(0x9323E54D2286800892AF68819C7D0F6B0D09D06B645E5A3FEB76EAC729389632_cppui256),
+                            typename field_type::value_type(0x241C567A4227F1C506C79B97A6BADCA61C37101CB8971583BF9F4172B066FD48_cppui256),
+                            typename field_type::value_type(0x40A62D93D4302D4B9363817C043203A48EA87138AEA366057F7D2C6792857B08_cppui256),
+                            typename field_type::value_type(0x4EA220C78BED1C8D609077A9243B173CA518B52EA200446642AE5B50783DFB7C_cppui256),
+                            typename field_type::value_type(0xC644DD2F1EC88D3A27417D9D954C829828C2A2B452324480E5D9E6E88415E13E_cppui256),
+                            typename field_type::value_type(0xDE2FD23B826978E9CBA0D3C4AB327218DCEC3AC242B4C82A861F7DB90DF9591D_cppui256),
+                            typename field_type::value_type(0x400D71133B6243F305ECB7EC84B92EBBDA9A8A1F88C036A4B4E1973D0457AD84_cppui256),
+                            typename field_type::value_type(0x9C8651CED75AE94EEB27E145F21C1935558DD9397551CE0D0F02E89487D70D2E_cppui256),
+                            typename field_type::value_type(0x9532E363AD04E53E3BB36E293A2454C8F3ED01A82D75CF129CD3DA9320F35D28_cppui256),
+                            typename field_type::value_type(0x8DF889B0304CCBDD993948B024E11340F02F3AF938FBC3772EA8254AF562282C_cppui256),
+                            typename field_type::value_type(0x74525B673205CEED6C741E63188AF35E247F7044CEF9BB157256ABD961D195CD_cppui256),
+                            typename field_type::value_type(0x211A671DAACF935D439D86DCA7A03FBBB2B21C2E5EDD208C9AE50A7E3DA4A543_cppui256),
+                            typename field_type::value_type(0xF46D47A89BFEF4A0436D68DCA868838A37810C54418A6CF7532117BB36B69C0B_cppui256),
+                            typename field_type::value_type(0xA0FD758CD98B80F8001FB80CF152F245078864CDCC2C0DA6F9D528950DDDB2DD_cppui256),
+                            typename field_type::value_type(0x53E5D835C13368D5F8691FD313B08F311C8CE96F89409A7C7FD94FF873EDE6B2_cppui256),
+                            typename field_type::value_type(0x298A401A6EE92414A708FBC0A52E5A71E93E7CA26BC0EC3617A4F678C5D62AF3_cppui256),
+                            typename field_type::value_type(0x18F9A3AA04FE0466E40985FFC80C90DF4866E6B9604ED6EF94763EF0AF0A3D96_cppui256),
+                            typename field_type::value_type(0x0FA822BC2811AAA58492592E326E25DE29493BAAAD651F7E90E75CB48E14DB63_cppui256),
+                            typename field_type::value_type(0xBFF44AE8F5DBA80D6F4AD4BCB3DF188B34B1A65050FE82F5E41124545F462EE7_cppui256),
+                            typename field_type::value_type(0x031A8747DF8DC746E4C13D030696080153FE448A57324591794A16BAA05F57B5_cppui256),
+                            typename field_type::value_type(0x883A2C64FDA8D58660E8AA6C1E387A321431C18C42B8DEF21827EE579C0343FD_cppui256),
+                            typename field_type::value_type(0x85B2C064FF912F5CE596645E7BEA4BC8DBEF3A12B228EBF5752C453F7DB3CDEC_cppui256),
+                            typename field_type::value_type(0xF64B278F39D1153663C7FA2D2FCC6D00DC980B34E64CF8E08F4D08204A03F81F_cppui256),
+                            typename field_type::value_type(0xA7163C2B9B973C17F9571975C0D5934A4ECCAC6096513CCA015E2E65580B2322_cppui256),
+                            typename field_type::value_type(0x308A9A797AF31FA563389991545A6B7AB841A4F4E09952D73933B2232197FFE9_cppui256),
+                            typename field_type::value_type(0x110B0376C40214677851FBACEC16F29C24DAFF63E584D673288A5AE48607B030_cppui256),
+                            typename field_type::value_type(0x84432B85318EE6734C6EB89F8461C70C87BE1556FB298749F43AA112B3617C3A_cppui256),
+                            typename field_type::value_type(0x3C714524875D4EEDE22A0772517690ACA18159998EF9AFB99AFBD3916A334020_cppui256),
+                            typename field_type::value_type(0x7F090565771AAF5C4889E729FF7F3D8C152FCAAFE7938C2C6102A85CBA701655_cppui256),
+                            typename field_type::value_type(0x18784E449F6471D714F6E1242B1CAAF83295F2538BBBED4E54EDD81C75A76F08_cppui256),
+                            typename field_type::value_type(0x8D76ED7F4A1E1AE71777A8FDAC71E671FC9D74A7A60A25320B39605D6B824993_cppui256),
+                            typename field_type::value_type(0x1BFFAB8C03AB8279811B3923EF4B991F02A50C382DB2670C6CB04A6A5C42A280_cppui256),
+                            typename field_type::value_type(0x2982B620CEB1D098332AC758529F1AAA982A369AA9D24FB6C9C742364DDB9261_cppui256),
+                            typename field_type::value_type(0x54BC18D7A99899547DDC6988D7EE1B3F2B481AB443DA43FF68F41305B76A6987_cppui256),
+                            typename field_type::value_type(0x4B2C8C1211E6EAF37391B851BA73E2FD52EB8ED4BB73B119FE457CD05B9AAE49_cppui256),
+                            typename field_type::value_type(0x1F380071781DFF16F33D8173A6FB4D96BA770F18355CCA4CB2A64C6196260250_cppui256),
+                            typename field_type::value_type(0xB1521EC4BA6C681DA33705176CA2CF621B8567660590D693B1519B2E6B011955_cppui256),
+                            typename field_type::value_type(0xBAFBBCF680C1C52AA863502262B1271B788785464876750038BF47F5FD1FD820_cppui256),
+                            typename field_type::value_type(0x1487997C9DB4DD812CE7BF5AC89BC0FDE81C34A1231FCAD6EAEDAD521BF074F0_cppui256),
+                            typename field_type::value_type(0x99EBA192AADB019F41E0BE2B789273A058E6EA55222034F3EA6D95D177AE84DA_cppui256),
+                            typename field_type::value_type(0xFC4DC4CDE1EFBFD9F4F806644530184DB630D866D7108D108DA39DBE02155CAC_cppui256),
+                            typename field_type::value_type(0x9B1938F7103389FE2A3C3BFC75C220EC24E79F2D0986E0D0E917081294299B7E_cppui256),
+                            typename field_type::value_type(0xFB12AA6EF17102833140E98E1CAA3EC90ACDE851F86B8232C57B2857447B84DE_cppui256),
+                            typename field_type::value_type(0x19B738FC965208DCE81EF0EA907BF3D8B46C5F5F8FA42E6ECA3A26BA0409CA06_cppui256),
+                            typename field_type::value_type(0x6FAAD12C8F69664BE02610B7E55A7ACF7CB418DF147531E7023530A35741156D_cppui256),
+                            typename field_type::value_type(0xA6771985CC0175907C381FDC06761B2CB71D35A2C4A53DA0FD410740D10CC4C4_cppui256),
+                            typename field_type::value_type(0x85506185F750DD98F29BD6601E5D9C3DBC745773A6FF3094C20F3B237C976570_cppui256),
+                            typename field_type::value_type(0x6D50856433968435FC5945CE21621E089D4E993B7604A5FA896BF7C7F7F96003_cppui256),
+                            typename field_type::value_type(0xCCF57357E968C6E7C6BC5D8AA2C7EEF9D6C0D6DC8263A0D90271CCAAAC7E969C_cppui256),
+                            typename field_type::value_type(0x1D35C9699761E3F285F248239267756F5194B85279F96B7C60AAFAD170AAE231_cppui256),
+                            typename field_type::value_type(0xC7226CB62DF608231D660AB622EBF810EDF58AA4729A66F15867063ACCD6AC71_cppui256),
+                            typename field_type::value_type(0x6F2B065A7800CDD89910E1C2A6397AB4D9C9823C2B473903501A327426432D92_cppui256),
+                            typename field_type::value_type(0x0ACFEB77E5E7A2E4EB1472CF700826C5093BF02DE33DBECB6D2D1C4963E17C9F_cppui256),
+                            typename field_type::value_type(0xDF3D4047A6D2234CE2CEBB45D60D803023AD869FC32B8193CE0D3FE18CFA3FAC_cppui256),
+                            typename field_type::value_type(0x48FA6F5229FD40DB24AA21F29C0F9DBFAFD63CE496882975F4626D938FC7D419_cppui256),
+                            typename field_type::value_type(0x870AC12BA3DD777468991DA7FDADD0AF2F3352569662876BE3065E088A6EDBF5_cppui256),
+                            typename field_type::value_type(0x7543728B999A76998DE7EFD769D05A67D03C64022E5F297E1906D2DCF02F8CE3_cppui256),
+                            typename field_type::value_type(0xDBB2AF6AB1F96144EA1E6C4CA311F822CB0A69404ACCDCBBAED925AE1F1322D4_cppui256),
+                            typename field_type::value_type(0xEBAE75B92F13561AA1B60D1ED6433F9D9A9FC9787B7E3A5FAA492B4F4A8C5311_cppui256),
+                            typename field_type::value_type(0x17B29FD1B522213409B667AA14226D09F3ADF06C6252D45BE8A58ADA373A6B7A_cppui256),
+                            typename field_type::value_type(0x15FB4490352F3D4EE9924E663EFEFBD239D03897D388CBAE0C1482074844EBAC_cppui256),
+                            typename field_type::value_type(0x1DBA7B597F261FD4CAFA8A267F9B5F0BC4C1C93E2DF2E8F2F069A33CA1138F7B_cppui256),
+                            typename field_type::value_type(0x6AAF7D3E5DE7EFC63AE19006BB8007F58136E6B7998232C0DC82D8C7A39BF268_cppui256),
+                            typename field_type::value_type(0xDBEC13E6DA0D5592A0BF5FEF8034DB346A9E8C749FDBF0F07AA6E46350C06AF3_cppui256),
+                            typename field_type::value_type(0xF859978FD619E5F8C0E57348B745E4D442243A3264EDB6647CAF0F7CB6D243ED_cppui256),
+                            typename field_type::value_type(0x55D9A959844B5AEF388FF0F7AA02F29ACBF5CA9AA567E0E65572AEA8750E4F5F_cppui256),
+                            typename field_type::value_type(0x69CB7F9AA5DAD203766D574FBCC8EC524C9810C633AD1B15C858EB76BCA97DB0_cppui256),
+                            typename field_type::value_type(0x8C76689BA78A166138F9434C2F72E662F517323E3F09B5D30758CB4D57C6F8FB_cppui256),
+                            typename field_type::value_type(0xCD3172990A409D3A288489B0C63D6DCDF0B11FC3136BC05F7DC5B39A9BCF2306_cppui256),
+                            typename field_type::value_type(0x4B0043EBE46F3E11794D86838FAED480C176EB064607FCFBC06A9887FEB142E9_cppui256),
+                            typename field_type::value_type(0x173CCF23A30DAC1ADB17884636222D870F23290F3A12588804B2C52D62C68552_cppui256),
+                            typename field_type::value_type(0x3FB5909A93DFE46AF0C6A4169281BF8746543768CE5E12441EE45F92ED69F1D5_cppui256),
+                            typename field_type::value_type(0x549991AC0BE8809F704A4E3A3BDF775425D35688FD0562B013D4FEFE99A56CC5_cppui256),
+                            typename field_type::value_type(0x79EAD27992AD6FC232728DCBB73463C513D7A5F734FF6481F6DD4AE717F1AA96_cppui256),
+                            typename field_type::value_type(0xA95DE9CFFBAADABF1A6E439356256542DE84D71111B3955A80BA71CE4B0A3FB7_cppui256),
+                            typename field_type::value_type(0xF01DEE116A3E4A414DA377C3236DC07445210457612D580666C3EB2F1637A274_cppui256),
+                            typename field_type::value_type(0x24CFADBC9AF48BF342615F231E1D01CAE6923F6ECF94C497743FD470839D3465_cppui256),
+                            typename field_type::value_type(0x318E0050F24DA1CEB5279E3631AD743F8EE0AA059C77F8ADC805CA72F93A9AE6_cppui256),
+                            typename field_type::value_type(0x2792EE1119CE9299F4D17CA51E504BD094536FDBAED3A8EE184B5694DC447D79_cppui256),
+                            typename field_type::value_type(0xC34ACE1CE5DD90408AE227E16FEAF2537FEABB0CBEED3E03506F1270BDE7BC7F_cppui256),
+                            typename field_type::value_type(0xE1EF3B3A009857E2E623B8BE80166F12D6554299BD55A442AEB63980697806C4_cppui256),
+                            typename field_type::value_type(0x6E29F959BE28C47FAE5ABCA185755C08346924376F5412C1D4D3D2DE4351964C_cppui256),
+                            typename field_type::value_type(0x34565D9F500F32F65052EC6CC184246DEF640C527A0BFB63118824BD563FD88F_cppui256),
+                            typename field_type::value_type(0x8EFA0F79B5909A0B10CFA381496E68943B09F0776ED90CAD61E0F0EFE5E84DA4_cppui256),
+                            typename field_type::value_type(0x242418E7934CD6139FA46F1C5DAAFD1479957C4897816035FDE19F42596969D3_cppui256),
+                            typename field_type::value_type(0xD691D4A978970F6EDD8288DECBB740ED41232DA85BC5400D3F9501038C0E49CC_cppui256),
+                            typename field_type::value_type(0x7A79E7874B78F397F7FBBDB5763E0C52AC5BE1D02AD043F2DD0BB4C1D00F4152_cppui256),
+                            typename field_type::value_type(0xD0D4AF73CB8FDB30B9D6D6D0F360DB2F1F8973E31EB3F3974ACAF2C0023AC4CE_cppui256),
+                            typename field_type::value_type(0xED90F8C8F15D7DDCBBE9CCEE3E52953061850B1C863AAE77E3DF0360A47DD6B9_cppui256),
+                            typename field_type::value_type(0x2A5D6846A2E0D7C5DEE5B7DF7A7BBC49DEB1352A4530F58F3D876B9F2B9B930A_cppui256),
+                            typename field_type::value_type(0xDC3D7C096876476DE5CCF03903C4AB58EA5B73435E27168586FF345F3B2CAECA_cppui256),
+                            typename field_type::value_type(0x8B277F8CE445915BFD851C4D332B75E3165CB495470922F00BC6E130B886719A_cppui256),
+                            typename field_type::value_type(0xCF44D77B164543BC6E4B52EE69EC913955213780CEA31A3D078B30FE6ED37C38_cppui256),
+                            typename field_type::value_type(0x8764496A389BB5262F0431412E275DF87679D056741DB59AFA7DCBD2816959EF_cppui256),
+                            typename field_type::value_type(0x599B69D61D002FFD9E0B412796ED961F2856AD4172F9E3F1660311CBE0CD5010_cppui256),
+                            typename field_type::value_type(0x829B8DD0ED5452E8A6D6F71B65B85F9038D1D60251256EACE399DA6192397D42_cppui256),
+                            typename field_type::value_type(0xD300EC543FCCF46D99E73C8A896241AF5C5ADC4263AD1A5D91B71631E3DF5612_cppui256),
+                            typename field_type::value_type(0xFF046A9EB2BFEED9C00F2EF0796F458EC141C259A845631128A7D4110CB71280_cppui256),
+                            typename field_type::value_type(0x432F55ACC0953A170A01EDDBDD4CFCC9012B6E6EBD28487A7EC3271F5EC33919_cppui256),
+                            typename field_type::value_type(0x5890C0F334DDC2B08FABBCCC41287DF4011745F856DE35ACB2BD41C7B0B3DA07_cppui256),
+                            typename field_type::value_type(0xCC9EAC788B1D9C045E4604FA4F79272655A279CE3E2A8166623D0AE88D3813E0_cppui256),
+                            typename field_type::value_type(0xF717C45D14D3DCD31A95BC1F5312231FEF2B1865AB6A77E25F2782AA33CA3CE3_cppui256),
+                            typename field_type::value_type(0x422C40768C99512DCA9B54ED0AADEE55AF53E2BDDC176DF06894CCDB50ED88E9_cppui256),
+                            typename field_type::value_type(0x6EEC95670D54650CC14B66DD02436893FFDC67942D666817FDC73E83BF780C2C_cppui256),
+                            typename field_type::value_type(0x14BB5350997732C2FC281DE065EA010579AB66153A07FF89089EC1A1EDBFCD32_cppui256),
+                            typename field_type::value_type(0x60E269B4F3370B20C2FEB5627F91B32C738E097502A9BD9AC368430D5B28CD88_cppui256),
+                            typename field_type::value_type(0xFE00175A6579F0A9609211889728DF7602456138C6C846B0E29BA8A42BE2066C_cppui256),
+                            typename field_type::value_type(0x2209938B8C24AD5601E037ACD13E8ACA06D74F465C3813B80DE04E8FF43FAE7A_cppui256),
+                            typename field_type::value_type(0x9BF8E087B32B55A528002F3A42008C8C53B8E6AF17AFD946866F6AA1C7E52306_cppui256),
+                            typename field_type::value_type(0x799297A1E67399490AA5BA05FCB46855964BDD1704D0536B153B1932861CC594_cppui256),
+                            typename field_type::value_type(0x132FF18CD523C9B0E1069118789FE50127DA86AE0BAC6E909E9110920F8D309E_cppui256),
+                            typename field_type::value_type(0xA0E2410CD09C01A1B79470F6AD3DA82908F69591EEB51BD853D6D6E9019FC555_cppui256),
+                            typename field_type::value_type(0x1E29648C71BFDED42AC3B57BA5B2FE898BBAF19F6B667930CF340818C1AC6D8D_cppui256),
+                            typename field_type::value_type(0xE486C7DFFEABB058C1F9AA2349EE7EFF8B2C7E63CF570CC5C7D0B24CC5852E50_cppui256),
+                            typename field_type::value_type(0x51FD75ED5606A12E9EE88A5C9F51E05A694463D63392EBD866BA3CADAECF107D_cppui256),
+                            typename field_type::value_type(0x69A16E245A5FCB8821FF1441906276E963AD9E86C339D0EA74502CA378692E20_cppui256),
+                            typename field_type::value_type(0xA7C968CD891AFC0106F01E9A4CDDBA10113D28620F7DA894996E69A9B3116C8F_cppui256),
+                            typename field_type::value_type(0x4ACF44BB8E2FFB7C964105CC66AE0415142C86735B00B1DAC66AA6455C881907_cppui256),
+                            typename field_type::value_type(0xAD99A8FE0FFD587B3544285AD10A545799352B2F7CD84B252926B456F63CDAFC_cppui256),
+                            typename field_type::value_type(0xDCAD8B2A7EEFB2C721190E12FA0E745A7A39F95BC79B0D1747BDE79706BC8D71_cppui256),
+                            typename field_type::value_type(0x8BF1287AB91FAF9B2211993CE07C0FA32726C4077B717B56470CFE2EA297FCF2_cppui256),
+                            typename field_type::value_type(0x4DDF22834188A649DD7AA292C8234EEC34FFA562B601A2AA82BAE0697439383F_cppui256),
+                            typename field_type::value_type(0xE71C627B0D91883D74ABAE97D38C0C6B3DD5D045131F8269632FA81823D52337_cppui256),
+                            typename field_type::value_type(0x89BE840A1731EB21F3F78331882EBA59EF4C1AD601C829F81F6B16A30EF15DB0_cppui256),
+                            typename field_type::value_type(0x70EC8C193CB32816F4C5644675E9016C53B9DF77CA29A81F791D68C71D0B8200_cppui256),
+                            typename field_type::value_type(0x58B065791379879E1334E9E0797BF39BA5353AFCF865DF8F26DC88155822B4F4_cppui256),
+                            typename field_type::value_type(0x55A98AA4145A2C37027CA55F0262836C1CA4A076FC4E52596607A8210C60FBCA_cppui256),
+                            typename field_type::value_type(0xD9F8B3771D318BC54DCA9848228C57C413FEA55AAD0E2F87D7273629AA99AD56_cppui256),
+                            typename field_type::value_type(0x07AAD641F0D22377C6551557FB70A4A3995DE59A31F63CB4D4E919385F5C61B9_cppui256),
+                            typename field_type::value_type(0xF41D7F4BB5E50430CFE08CF8B5E2EE0AB63B9998A43D1FC584B6B8EC2B519178_cppui256),
+                            typename field_type::value_type(0xE6A669BEBD9AF8D6F1046DE3FAA82347AB49ACC36919E1F9A7A1665DCA6A3551_cppui256),
+                            typename field_type::value_type(0x3B2369FF19DDD591F85BC3DA3881EC450D80E91BD6616F3D2A937E108F089B4B_cppui256),
+                            typename field_type::value_type(0x5DF102ECB29A762C2D22213DD27D78763970E7B02723E7C1F065556F67F00F4F_cppui256),
+                            typename field_type::value_type(0xD65F827ED62D4E7F3332D691D62D3E611BE82CE1BB61FC8B1A71313E1E3501D9_cppui256),
+                            typename field_type::value_type(0xF24B60FCF09A90FE537B7CA5166B87FC61C13AAD5D730BE1AB9446C6EB55759E_cppui256),
+                            typename field_type::value_type(0xECA3EEF00455B406C7661093249BFF8F997CD06E999C1020BB180BC7B8352AA1_cppui256),
+                            typename field_type::value_type(0x9E6BC281E78C25B8F6B863F37CA79007A8359B399B78ED2385F3AD39ECC12EA3_cppui256),
+                            typename field_type::value_type(0x55A9B5B6DEB05C385EE6C8B5782CC0ADE7994DF35FE2EA12CB62FE240F2ED84E_cppui256),
+                            typename field_type::value_type(0xC4F22196AC9F19AB29174D190ED7F43AE8FFB4D712A0D8F0579DC550546495A3_cppui256),
+                            typename field_type::value_type(0xF91386EBE69EF8CF41BB5A14A5E51CA1C20E8839A7615C7ED6D4D26B5E4C47D4_cppui256),
+                            typename field_type::value_type(0xF43574316FED3B26606F08DD4849F9C45B8E120559B73B3F37D18A490E9CDD72_cppui256),
+                            typename field_type::value_type(0x79DE576DC7DB71DA1F7ED60A62548BC49FDE1EB648BC00B29BD2CF87075495A2_cppui256),
+                            typename field_type::value_type(0x3B2D3D0E6B186A02785E6DAE47DC79C68314F5096493A746802C8C6AAAEC6FB8_cppui256),
+                            typename field_type::value_type(0x5C97699D44B7DAFFCBA214B7FB45EA98468F41CE1B0DAD7BFD94A8B61A93D03F_cppui256),
+                            typename field_type::value_type(0x4737A353A4CB0FB1238FF9A6CA28F2EC20680F327453615967499CA90E6F2BA7_cppui256),
+                            typename field_type::value_type(0x4A5B506612A677A657880B3A18A2E902E9A521B074CA0141A84AA9397512218E_cppui256),
+                            typename field_type::value_type(0xEB13461CEAC089F1C42604FBE1627D40626DB15419E26D9D0BEADA7A4C4F3840_cppui256),
+                            typename field_type::value_type(0xCC8FE9ECCCDAF543521473143EB337C5DA74BE4D8455B67C1B68EDCCBF8D5842_cppui256),
+                            typename field_type::value_type(0xC2A5D01CD9F2FC3F75CEC6140B91FB775DF1592D458677C8567E1AC9487100C7_cppui256),
+                            typename field_type::value_type(0x1064063233318BA085292AB99728A9E3BBB9026BC697339152EF40E2518473FD_cppui256),
+                            typename field_type::value_type(0x9C6832823B8BA2D8C8E7829E6585883CCFBE190D0C21D039AFA6162E785CF805_cppui256),
+                            typename field_type::value_type(0x11C881390823D8CE8006B50F37E8626171B0B96CBC1184DE23F389BE0C37DA54_cppui256),
+                            typename field_type::value_type(0x82F5CA516726BDA3A42AAF13CAF61AE4B3E32B21384D2ADF567C651408EE3DF5_cppui256),
+                            typename field_type::value_type(0x38C8AD8FF05F27BF5EDA410D54083F212B423ED2EDA238DD3567EEC8653F30F3_cppui256),
+                            typename field_type::value_type(0x83C2617876DCB116F3909654DDBD641F6583FA982959DF37A060E749EBE9217B_cppui256),
+                            typename field_type::value_type(0x3F789C12505A876C23A5D12E930F5E51280398B6E32D8D7762B66E34FD7046CC_cppui256),
+                            typename field_type::value_type(0xD0D9F1B3A291A6E564C974DD964E47A26320DE848E0B3FD61487856590683E4D_cppui256),
+                            typename field_type::value_type(0x6FCB8CBCE860BB095858FBE3FD35184277A9A2A38F920CBF543E6911B6EF1584_cppui256),
+                            typename field_type::value_type(0xA8F1A83D8B721D76D54C0823AC30459D5992F6D6928A4325C3C9F7C21D3110F2_cppui256),
+                            typename field_type::value_type(0x9C7A4EFA52A32680676E37E7FC8B8D71CB4CB3A72A5C98EA355C95A1FD698F73_cppui256),
+                            typename field_type::value_type(0xA2C4A71AB2150C7B16C424C1D0ADE69B94B07CD5EA879E7C122443BD120CF142_cppui256),
+                            typename field_type::value_type(0x2EB3910BDE2AB995012C29DF8BBE0F5032C3B2574328E5F76628D837008E2DF0_cppui256),
+                            typename field_type::value_type(0x3F29C02337474B3A77D37D348DA4999F9540D120ECF65F490910CC4ED274EAAE_cppui256),
+                            typename field_type::value_type(0xD32E851A25C965C2FBA2F5BDF8F0482610EC719690525DB1FE39D9ACA1DC428E_cppui256),
+                            typename field_type::value_type(0x6BEC05A1FCC5D64E45CC6D22A98A834031F58D904694F768B551D5B501CFE158_cppui256),
+                            typename field_type::value_type(0xF6E9DB88E64C7CE22AABD16A780900F0A21426E21B190A39BF02B84B682867F0_cppui256),
+                            typename field_type::value_type(0x53CA790B7AD2AB7481D93B76E8C0D5B127041BA5F970B623475B3AF10F1861EA_cppui256),
+                            typename field_type::value_type(0xE644041C2ED2CFF4F54D0746449C0331C681312779800DBF71FC28E6E42F662D_cppui256),
+                            typename field_type::value_type(0xBC79FFB9DE665ACF4BA0050D00C7B4D052E1678F917FD7C06711C11D66E6D591_cppui256),
+                            typename field_type::value_type(0xFD1DDB38760E449D785C15B9B6199A5EF06D5378A34539409ADD0438F20D6102_cppui256),
+                            typename field_type::value_type(0xCB54B8739050638AEDAA1F1F7883B700163E191211513983DA0A6491AE003B7C_cppui256),
+                            typename field_type::value_type(0xBB14B0B942C15AC6974719DA5058F18D77B825CFFA6774C660621D9F7E801AE2_cppui256),
+                            typename field_type::value_type(0x96AE967F4513A67487483CE636BAC7DE795E4FBB668561438B0DE51E5C1DC5F1_cppui256),
+                            typename field_type::value_type(0x61A273C22599901D9FE4A73E65EE698FEF6D940902DC15B6F3F7341DC2C77CB7_cppui256),
+                            typename field_type::value_type(0x5BBACD334D3AD3D3F4EA219F5EEB0CC9C5C5AD9A70AE1F74854611F81DDB25ED_cppui256),
+                            typename field_type::value_type(0xA626C3F311CB5315B59F52272CA6064B4C287DFB6F6E6AADDD030872B7314C65_cppui256),
+                            typename field_type::value_type(0xBB882A6B990EC04CD949B781E9EFC624EE365BD68035523AB6607DB5A63F1919_cppui256),
+                            typename field_type::value_type(0x7EF2EE3C5C792A0C0FEF6335224D9428A7D2C98F6743333EC739A5EA3ECCA7E0_cppui256),
+                            typename field_type::value_type(0xAFB6862730ACC011A4F67F51D5E609DB81B21450DFBD3D20302B22DD552AC094_cppui256),
+                            typename field_type::value_type(0x0646472486E68DB193539DEF6986C76B5E880BE50C09223C6DB02C92AB896D0F_cppui256),
+                            typename field_type::value_type(0xF1F4EE22FE7063BBF2B3F5CEF9047CFEDB1B895DC63B4F9090D74508A4F528EA_cppui256),
+                            typename field_type::value_type(0x3704572716887ACD7624A576C9D9C641CAE4CAC611807A4172F3583DA33F0FFA_cppui256),
+                            typename field_type::value_type(0x5C6408C61A71E74F841BB4BB8895FF4C57BA3EB7AA8BF2FC5FED3FC660FA35AC_cppui256),
+                            typename field_type::value_type(0x0D42E1F15292FC712EA713544FF03FD17BEB467E384D570B699C584DA8D5825E_cppui256),
+                            typename field_type::value_type(0xADDA2B0A21F69ACB2C1F17A55A85CA7E0C4CB2EC4B4340CBED1808977A8946B3_cppui256),
+                            typename field_type::value_type(0xC2A979E54298DB722D1EAA42C08BB697F6C64DC6814A00953C6F986532603513_cppui256),
+                            typename field_type::value_type(0xEF9DD74A1E6EB5C854278081935BCE7E8CC666DF4815144995755B2C3C3505B9_cppui256),
+                            typename field_type::value_type(0xAE67ECD7D603693A3FB48BE1F115D6874307AD9549CF786FDFB7DBF315FC7295_cppui256),
+                            typename field_type::value_type(0xD23CD2AEA5FAA6D2072B94B84A82D9C1FC3019722C2AEE3404FF9C5EFA4F5B62_cppui256),
+                            typename field_type::value_type(0xC9F4186AB1FC59E1172BB15CDB17AFB9681F97716C302E01E646FFB1D9FDEE3E_cppui256),
+                            typename field_type::value_type(0x09420A7F3CB3A3410DF73142B883214344E1531C7B58DF4F51E66CC5CCED22E7_cppui256),
+                            typename field_type::value_type(0x44DC4D9E945C7DB20E19D0C28F9AE7518C3B0DA6F68440E7F9C18A469AD780B2_cppui256),
+                            typename field_type::value_type(0xDBEB918745C2F9C9F8FD19DC683F5F95B47775E1C2CEC39D91437413AB93B11E_cppui256),
+                            typename field_type::value_type(0x0E51416421640AEB57802554EB5FA77AA9CB53529975E04A6701F090EC49E853_cppui256),
+                            typename field_type::value_type(0xCF331CEA65905469278EB4A53A91030DF568394190C9EE36336E3D1376405CB2_cppui256),
+                            typename field_type::value_type(0x8525D0B3EF76314283D8640F8DB563D543E17E0A2710F1A2BF7FBADB5AB7AA65_cppui256),
+                            typename field_type::value_type(0x0E63A7E111F91FD606CC431C1E676976D0DFCCC1923F092AF9BE830FDDE8648C_cppui256),
+                            typename field_type::value_type(0x977BA06765CACF25DE8ED25F64C0C6771BD3D92295F80F46C4A23F1C1DC6AFAD_cppui256),
+                            typename field_type::value_type(0x1BC3BC43AEDB8FA28833FAA0D081D9992F75A1241DDA1A154D62CDC51D7FAA09_cppui256),
+                            typename field_type::value_type(0x1B3E00B320971112B39E7D7665BC22D4D8432893C3D8180F29DD16ED044C1B21_cppui256),
+                            typename field_type::value_type(0x9B442543FAF3E2D2F11325D9C0DF76844FFF41A9F0B6A9E98DE24014B7F594C7_cppui256),
+                            typename field_type::value_type(0x3BC328612A123ABE4C3CB60771FFFACC10220FD02F8EAB7865F745D7DD81983B_cppui256),
+                            typename field_type::value_type(0xA6B5826DED0C8A20250B305CAAF00A7F4334885A8FBB848DBD99F28511A637B6_cppui256),
+                            typename field_type::value_type(0x02A3759B87C0C6228171864FBFA379A1E5E453919505C7294F30B43AE18CBD32_cppui256),
+                            typename field_type::value_type(0xA88356CC1F9F211F1EA5D75B001E1E1E6419A83A7C8DF6D0C327F4E1A6CF9EC4_cppui256),
+                            typename field_type::value_type(0x67CBA4E8E9EC04AC51BAEFE1CAF96C21CA8CACB7441F806175F76C1FF7C8537B_cppui256),
+                            typename field_type::value_type(0x5B65EDEDEA1C8984A1E1C61F2FB1CC047BDF043ED0403F6E1CEB5057385726DA_cppui256),
+                            typename field_type::value_type(0x778468F5252B48E4899DB93959F2E87626DDC475BBFA75B7C828BBEE5AB90065_cppui256),
+                            typename field_type::value_type(0x43341AB10EB39CA06F65136A7F01E2E927BBCAEF00ACDAAFC8F76AA2F2D79FF1_cppui256),
+                            typename field_type::value_type(0x224A02299EECC99A0634A786F116445779C3BB5B5501D267F0699BF9E2F2B734_cppui256),
+                            typename field_type::value_type(0xFA41A8D29B6D22B4149A08AD871D7FFF07B704B673C7AFD0840F585491EC7FDF_cppui256),
+                            typename field_type::value_type(0xAFD35B35BEA5BDA1760F78B8AF6B2261E310D10E196E11DEA8DF3DAE1991E607_cppui256),
+                            typename field_type::value_type(0x03555F48E204E99496D8EE266B81EC93BAB7D9872155AF415E0B73BC4308126F_cppui256),
+                            typename field_type::value_type(0xE63502EE153CEC59FCDADFA688B6F24078368280C2A4707AC9E92F475D254033_cppui256),
+                            typename field_type::value_type(0xA7C5837B1F621E11AD74E80F0709CE482C915A0C4BFCF3607E8AA88968F05E3F_cppui256),
+                            typename field_type::value_type(0xE5CEAC4035EB4955A0C7CC97B56175D505174DA42F93E68F7E16CC51F0B9A00A_cppui256),
+                            typename field_type::value_type(0x660CB9301FCD56B9854A459C3396D1E48CEDDB7586FE794F157FF80E67984A57_cppui256),
+                            typename field_type::value_type(0x5648DEC272EB968712AB45C533F000E2B1FD631DCB982CCA2B9609AFE1E08F33_cppui256),
+                            typename field_type::value_type(0x95FDDC70708F7043F478F5C64D77A2693E72BBF2E011795126EED9AC4269F1C9_cppui256),
+                            typename field_type::value_type(0xA643C538AFC5667B3E774B6D5268D6931F0EA68BA3187B918DAA3455E8A5C546_cppui256),
+                            typename field_type::value_type(0xA8D602EA4377DB0E460033011CFD35194893DB480DC64A7BEB1E337CD3FFF857_cppui256),
+                            typename field_type::value_type(0x1941C19F3380ED2695152F8ECBEC8F03C5BA57757E3E8AA4E3B8200BFAB98C43_cppui256),
+                            typename field_type::value_type(0x8E66B834595DB2B6E2B6DB2A48FB8C53D8F62D3DB8DF56398FA210DA22ABE217_cppui256),
+                            typename field_type::value_type(0x0E415C462BE679028EC64FD2A2B75F9C944995A27D329C764F556DB22343750B_cppui256),
+                            typename field_type::value_type(0xC3056E7177F984E227BCA21077F8CDDC6EF691A45FF7EC06A6097C15BECD56CC_cppui256),
+                            typename field_type::value_type(0x4A89A61457374B4CCDB5D111B56493FE167D5EE4D1041CE2EA6065AD7789B84D_cppui256),
+                            typename field_type::value_type(0x45B04E87ED480D5C08C2EA979FE677E6A72E280634711999EF9B7D7F018E3EA8_cppui256),
+                            typename field_type::value_type(0x55B66E6DC586296F8AA4BBA0AE54DDC73BDBBC488E7CDB0820049D0364E11F7E_cppui256),
+                            typename field_type::value_type(0x9043A91F1DD1419BC386CC04CCA223EBCCFE610621B594F904BDDC671C77D076_cppui256),
+                            typename field_type::value_type(0xCC9F9648A870EF92A2A9B30E781377C9834C5EBE073275936E76B23742E14C34_cppui256),
+                            typename field_type::value_type(0x829BFF2CB5F8C96F43116633DBE689DB299917F1828C7E058892157A94BE556B_cppui256),
+                            typename field_type::value_type(0xDB3EBC91CDCB79A8AB1D0013A1821A0B06614D6A97448F012046400ECC4BB506_cppui256),
+                            typename field_type::value_type(0xA95A64538A676683AF1A685E85539258B21826F5E8F7D202CBDD181F49B3E60A_cppui256),
+                            typename field_type::value_type(0x5C618DA1FAAD041AF4F58C1D0AD98A758D4286C82DE5E74E87DE6C8595DE4837_cppui256),
+                            typename field_type::value_type(0x4C719117BCF3A19D88B80E3849FD9671ECD36649642278CAC0B8583B634A7DEE_cppui256),
+                            typename field_type::value_type(0x22BDCB12AAE2C57F67DE7CEE87EEC09AF08DD2BB64E18D8CB6CA448B40DC67C0_cppui256),
+                            typename field_type::value_type(0x53EF0C95AB3E7DD1B9987A8F0D909C4775FCBF3B3B89C7748A9A5C843B0E7DDB_cppui256),
+                            typename field_type::value_type(0xAB8A886A915A06A2E585E2DDE671C11EF2CAE15A368A6C0C2589342656635396_cppui256),
+                            typename field_type::value_type(0xE773CF7C7DA843195668FF8248BCD5ABB9360583F7D2D6AD7E38FA6A3FC92C23_cppui256),
+                            typename field_type::value_type(0xDED37DD152738517B92174E3AA64A3BFDDFA9E91C66AB7024F5C2279ADE5D1B1_cppui256),
+                            typename field_type::value_type(0xB14E3C5A84E78C402B3CAAB3824544B8F43B076D5912844881CC777712C778BB_cppui256),
+                            typename field_type::value_type(0xE5E892363A31885CEDC2F995F36D1F90BA82337D0B1FC80D3438C84A72BD05A0_cppui256),
+                            typename field_type::value_type(0x77439DE4DA1B87D21301EB01E79B5C3ECA73995B9CD099AEC936DE2BE1A69F5D_cppui256),
+                            typename field_type::value_type(0xC827ED763FFEC8D144D95FECD3177C78FE6784FA0F696A510C665CF973B4DF41_cppui256),
+                            typename field_type::value_type(0x1E4C4475F2DA5ED560E17D7B66EF3CD3BFE9A6106C0047B32E5B6A2380F91F4A_cppui256),
+                            typename field_type::value_type(0x5D2393DF9435CCF5D1018611642CF1D8357D712952A24B514F09528101467D6B_cppui256),
+                            typename field_type::value_type(0xE66E63F263FD0F7D7ACBD85B2D5AF46D72A707A7510473A807C673C6B1BC5458_cppui256),
+                            typename field_type::value_type(0xB511001491B7465725ED93EEB3C1587D8998961B956E7DC2405904B346340D60_cppui256),
+                            typename field_type::value_type(0x9C3981F431FE4C4672AB899EF769F9788FB582B11859479168CD6178653ECAA6_cppui256),
+                            typename field_type::value_type(0x453657A53AAB893F3ADCFB2BD2FF873FECF93A9CF242E590F0B1E93C9D159F7A_cppui256),
+                            typename field_type::value_type(0xBFB5AEFF88023DC5DA2EF0913A01C7286F949BD4E81DDA5D99C22B708A02FB78_cppui256),
+                            typename field_type::value_type(0x27A0C221B72432F0FFC3DDA2E480E645A32F06E363CDCDE9973276C64CFB1A94_cppui256),
+                            typename field_type::value_type(0xC3F6AB3EB3A0A792F2F2EF8DC1821E9D91E3B03D78674297AB98F8C2D4098584_cppui256),
+                            typename field_type::value_type(0x435B54CB07B04C464D14ADEAA13D73E7BC052853A723909331EDEDF3D46CB42A_cppui256),
+                            typename field_type::value_type(0xD726C031E4718A1A49F4A54CC1E0585D5EDC4C79433949A6B7E24DEDDAF72DD0_cppui256),
+                            typename field_type::value_type(0x60AACAEEC40E84091CB2F03148E4774EC12883ED0E4C688FC193D479678E27D3_cppui256),
+                            typename field_type::value_type(0x9677DFFCC5DEF66DDA54F7C803DE04EE46D400783A680F4BFF7C610228C4D2DE_cppui256),
+                            typename field_type::value_type(0xE4107E431E221F5071E7474104FA90A45312F0C21FB084DE21579992FAB5C2CF_cppui256),
+                            typename field_type::value_type(0x1E5F11E6CF701C9A3948C668741C2B323C7892DCFF7B2410D028403F2B955C2B_cppui256),
+                            typename field_type::value_type(0x2D5295DB41E6F839A757F11164D63319A0654D2666872435510F99B4549E7A36_cppui256),
+                            typename field_type::value_type(0xF98ACF28068072323AF16CAC763B38C6EA7B44F99730BA3BDDB68195CE32EB67_cppui256),
+                            typename field_type::value_type(0x85DF9A65EE179F7DAACF9701DEBC1142766B7B2B911C3D485BB5B63C09B67B7E_cppui256),
+                            typename field_type::value_type(0xA6B4B7AA39AF6308BB6B7D5EFF0E297386FA949D1FBC6EA588B3869E830A36E3_cppui256),
+                            typename field_type::value_type(0x3877152E0BBFF37EFF26EC4601BFFCDA32242BC07EB98697CFED817743A29747_cppui256),
+                            typename field_type::value_type(0xCC70A7F9014BC61ABE16116CB99D37309FBD1F6ECFFEE641BA573E25F24D4637_cppui256),
+                            typename field_type::value_type(0x23C493FE7F9FCD08A8D8A1865C2D292885D3166704A1D6E4127CFDE60B3510D3_cppui256),
+                            typename field_type::value_type(0xADF456A9E43414230C275D9E4EFFE6D8F799E35E26B9DBD713462EC43AE89A47_cppui256),
+                            typename field_type::value_type(0xB8DC9073C673523C08D114540D125257C86B3488933E6F3C006A447C3B80AB86_cppui256),
+                            typename field_type::value_type(0xEC7787216FD41E684B5DC67E84141863CA4D4599DB3CE9E02F61194F048B4D6A_cppui256),
+                            typename field_type::value_type(0x94406D0B314DD0EDDE5993EBAAF235DDAC36EB6C64227C39ACC691808B49A71F_cppui256),
+                            typename field_type::value_type(0x61AAE77E864DF179CD207C90906FE897D0E27261CA63CF94471C1944D0B249A9_cppui256),
+                            typename field_type::value_type(0x437A6A6E40D04569A67834270A8E16495E3BFFBD135EA79F59469A0606BBA654_cppui256),
+                            typename field_type::value_type(0xC2911E15587F2492AB24825FF34DC5A014A7C3761938D4103755406037A7C0F3_cppui256),
+                            typename field_type::value_type(0x447D739BEEDB5E67FB982FD588C6766EFC35FF7DC297EAC357C84FC9D789BD85_cppui256),
+                            typename field_type::value_type(0x2D4825AB834131EEE12E9D953A4AAFF73D349B95A7FAE5000C7E33C972E25B32_cppui256),
+                            typename field_type::value_type(0xA263919B4945A1D447501F2A3C0804C3802F779EA7F6803AEB0421211A6B665E_cppui256),
+                            typename field_type::value_type(0x873200BD2AED20FC2E9D3C9DE60D60C5AC3F83DF4C00EFE29EE4040030BCDCFB_cppui256),
+                            typename field_type::value_type(0xF8B6533E03CA017F58B14DF965DEF4F6DDFAD856082632C273E1998EDEA6DB68_cppui256),
+                            typename field_type::value_type(0xC30F4EF5EC4454862F046DDA50AA3EC66BBD70DD9C5CA0ED69BD25B0AE760DA9_cppui256),
+                            typename field_type::value_type(0x2890D721E57E196118E63ADD579547F0ACAD16E63BE0AEA8F6F1D3AC4D771F0C_cppui256),
+                            typename field_type::value_type(0x69B5B8159DDC032AAF77E1D1416752EC7DC0E7F77EF540690A5728ECB5890D78_cppui256),
+                            typename field_type::value_type(0xF35289D35582847C548EF18729EDFB755F0173072CF8727C66D5D4EBF924E753_cppui256),
+                            typename field_type::value_type(0x75C1781EC5EC13FB93DF08A1B50E1BD8C562FC57292D0F04AA45B5C2EB13A20C_cppui256),
+                            typename field_type::value_type(0x929F5CFAEC5BE4805430C3C0595033CB946D1BF2AF7A9DA4F8B6930D2670213A_cppui256),
+                            typename field_type::value_type(0x29CD3692293320C6C5AC64BB51E390451B383964F7F20170A53059C5CD486F14_cppui256),
+                            typename field_type::value_type(0xCFD06B74DA4417164834185FB6734E01AF141FFFD6DF23D72395CB673018017E_cppui256),
+                            typename field_type::value_type(0xB647B7A9B72BA9138103B39587DA7950003030786B779777A0AE7BE4CE0DFF50_cppui256),
+                            typename field_type::value_type(0x7B8B8867DD4D9C6F81690628033DE305D4E3FF5E71DA17814F5822EFAC7E9E44_cppui256),
+                            typename field_type::value_type(0x8BC6273E511680B42246073C7DD5ADB564057E6DBBD723650767022AA8CD12C3_cppui256),
+                            typename field_type::value_type(0x9022E314949CCF3E8937542B8CDEC18EA2F8D5618688CE241EBD8BAC137DE736_cppui256),
+                            typename field_type::value_type(0x2FAE5E4F2904A39466D0BB045226CE087F49366C44EA7657F4EF5C0844C42ECC_cppui256),
+                            typename field_type::value_type(0xA77663F5FCDF189CC2731F7801B1133EE130A96964396297872E52CF757A603C_cppui256),
+                            typename field_type::value_type(0x4E139CBDADDAFC58DAE982FA5476A35A8AB86C568CBACE48D91745804CA8E468_cppui256),
+                            typename field_type::value_type(0x6E5872E3076FE945FB0F2D3F1AF7857AF73F35183273C05191706CB8D09B01F5_cppui256),
+                            typename field_type::value_type(0x4213C02EC8D7717180CC1D4AF3BEF0EBC13179D4E09A85A7C30758D9ABCD5FDE_cppui256),
+                            typename field_type::value_type(0x1A7098D2DB889A1112911D2965F2870EA93D696BF79B5582E83E2130461DFFE4_cppui256),
+                            typename field_type::value_type(0x39D474F5EE8B69FAE5A42C936F76F32768682783DE26B553F3BA5EED161315DA_cppui256),
+                            typename field_type::value_type(0x292220B1A5DA3F504AFD1E344C17DF827BD155FB2E6168C2B539B747EFE45B1F_cppui256),
+                            typename field_type::value_type(0xE316A0532BF175AEE37C795FFAE98D7FF7C344304CDD41045FE40B8B534BB026_cppui256),
+                            typename field_type::value_type(0x7DA5F99D3D6C3E86CD6CB74AB4E765C563B807E9A10215090493D0686DB76ED9_cppui256),
+                            typename field_type::value_type(0xDA269AC028102F19E529DD1342C75643191CBB6B8C72013180F1CF939752C9F4_cppui256),
+                            typename field_type::value_type(0x3644E14807A44F0AC3224F8721093A340E8040654B166DE43E850662A3ABD540_cppui256),
+                            typename field_type::value_type(0xEC5A9150DBC2797611C285309FA1E29300177CEDA66FA14DE1C6FE1CD55DA631_cppui256),
+                            typename field_type::value_type(0xFFD92260EA330BB7AC43FF1F15417FE91A078F4B263234F284100F6F2472C9AE_cppui256),
+                            typename field_type::value_type(0xCF4B93B0BA2111475999633225711E5F263D2E9C868B8A34A0CEC1D866D03AE4_cppui256),
+                            typename field_type::value_type(0x73BAFF0419EDA72389386CF2B5156DEDDC34C10619515EB5741145C144CD3397_cppui256),
+                            typename field_type::value_type(0x1E97DE634977AC5F6A00D1E8C18F825E779EF92CF826134941EF2A139ADCB8E4_cppui256),
+                            typename field_type::value_type(0x6FB5456391BA430536CA35ADA0F4871E140B55DC318D93BCACC1FD7CDFD83618_cppui256),
+                            typename field_type::value_type(0xF663D87766C6B8A3ED3B68C52109DABA2F1E6499AAE5D33E3F39F5CB02430626_cppui256),
+                            typename field_type::value_type(0x45F8330C33E60A18344388DE44BED04E3E10246156D312977EB0F952161FB913_cppui256),
+                            typename field_type::value_type(0xC212CF6DBFD6906EF80E8076D8BA7760F06D0879F6FC337370D4817C0C15C3BC_cppui256),
+                            typename field_type::value_type(0xD554DED0B2862113A145C7EBDF98E4B942D91E70B46EF479357BDB041CBD9A71_cppui256),
+                            typename field_type::value_type(0x74B8F94B6C36708EFF0F7AD45AC393145F29FEA9A7A61C99A43A4A8B3C8CC32E_cppui256),
+                            typename field_type::value_type(0x5544DC49ACD7BDAB65F5A01C8BCD5991965D4BE1F3EDD7C75AEF9691EE393654_cppui256),
+                            typename field_type::value_type(0xED3E85895087FD4AC04C05B5B8935192241EFE9703D58E7323610BBF8F53206F_cppui256),
+                            typename field_type::value_type(0x44130B2CE9E1013554E17C99D42EB14F44CE7343E662A7A0E8B93F55BAB5593A_cppui256),
+                            typename field_type::value_type(0x49197FC77907224F31CA51215B0580A1776D1BDECDCE2E3FE3A5763DBF5B8E89_cppui256),
+                            typename field_type::value_type(0x2757B790619EE7734B3D2ED55AE2F695741DBAC025FA9E5513F3599428A15DFD_cppui256),
+                            typename field_type::value_type(0xDF46D2D554C2B12E5CC975213CD5500D1768978A3CA7156DFC8E840CF042C341_cppui256),
+                            typename field_type::value_type(0xB889D78BCF05F1C763C4E454296251719F61776622130485DE82817F3BE28C8A_cppui256),
+                            typename field_type::value_type(0xBABB0B07FA511B9B182BE4A975C700EADFF631E5782FB8C33037FE51EAFDF89E_cppui256),
+                            typename field_type::value_type(0x9CF646B91A4C25BBC974446C2976FB982683BEC78B098CB30E2E5FB31FA4E33C_cppui256),
+                            typename field_type::value_type(0x37B0624DC1F65A891E408E258B821F319E205827EBC1603219C45E060E0D4563_cppui256),
+                            typename field_type::value_type(0xFE251903A452329835917F8D5547844F6CAE5469245E15F58C496939C224EF48_cppui256),
+                            typename field_type::value_type(0x4FAC9CAC97CA9BE0D836B9405A1B36A0455AAAA1C321E408AE6960A05136DFA7_cppui256),
+                            typename field_type::value_type(0x83CB43DE151B64999D7A653827764E0F4C566749FE5CAF63E98B618CC6BF1E67_cppui256),
+                            typename field_type::value_type(0xBCE28CA24B98F6F8EFB1806E624418F82874422CBDD1169EA27EE8B3099ACC97_cppui256),
+                            typename field_type::value_type(0xCC411E541368F9F2E2C3B6C3F6131016CEC29F6BBDD3E7A5BCCF5CB64D405A74_cppui256),
+                            typename field_type::value_type(0xFECB812FAC774584571527FC350186D0BE4FC2009F16FB0D645BE6B618D1BDDB_cppui256),
+                            typename field_type::value_type(0x3FF3B3E560CEB08C03340FC15E25022484E8628701D53DD8230AD748DC0F057E_cppui256),
+                            typename field_type::value_type(0x7F17AD6F3BB6578F6F7FD17057867843A010236EC47017622D41F7DAA817965E_cppui256),
+                            typename field_type::value_type(0x84D6E7F91E9D174F80DC73F390D4654FD64FED987E38C62B74D4780E769EBF5D_cppui256),
+                            typename field_type::value_type(0x0555F4E86E407C4DE4F7033DE50AD159B14A9F3AA8A268F2BB0586F1662CC379_cppui256),
+                            typename field_type::value_type(0x6E9EDB2DD8FFD83FDDA19DE173D6AF996367A8F2D422BCB515114B40325E69F1_cppui256),
+                            typename field_type::value_type(0xC0822216CEFF954EAB3556AB65F3BFF61C727454799F281B720E17E3402B7E9B_cppui256),
+                            typename field_type::value_type(0x8C6C923CF1A4351CCA356EF3EFC35DE10898022A45C4A1B196282910AEE1337B_cppui256),
+                            typename field_type::value_type(0xA1256FC84D40FF6A5EFBB2319EAA8E84845362C1C6DDFA2ACB451D5CD9C84ABE_cppui256),
+                            typename field_type::value_type(0xF81F5BE38B8CA534E8A5C7938D18DF9E0D238966F74E1A6B826FADC0523B716D_cppui256),
+                            typename field_type::value_type(0xDC7F49329C1F06DF1D56D29D380E0328660758503A878330464002F512632401_cppui256),
+                            typename field_type::value_type(0x7459E772C29C4C3F158EA76280D631820E4E1A713BD0572546E0C52790789539_cppui256),
+                            typename field_type::value_type(0x892BC7F5183444EAEC7E8E858A2EC1A9383AF5E04F7DB3913CDF5A471439D97F_cppui256),
+                            typename field_type::value_type(0xA6008450FB1286385AF6EC35C16D490A3B41278951A5521584C5685039D19D8A_cppui256),
+                            typename field_type::value_type(0x7B4B79C067A37C72C8F6D45E7BE9CA84F0FE008FA726573DFD95DBB3590D2C4F_cppui256),
+                            typename field_type::value_type(0x2E1C7C383D7F8492C604C9F87D2EFD3F345E4FD95B8881C4F4727E8C8EF2DFE7_cppui256),
+                            typename field_type::value_type(0xC629DC2B09F0BE266D9F4529FF7EA8F1C2D747D667B0C5BD3F85CCA2C55E5F2A_cppui256),
+                            typename field_type::value_type(0xDE5382B1967DF354C64C09798FEB0E1C59E38CEA5C44DE7226987B39496CAC9F_cppui256),
+                            typename field_type::value_type(0x9C47B678B69C918562C3B00991CF9F2BC2E3E29473D841157CE082FDAFA473D3_cppui256),
+                            typename field_type::value_type(0x74DFABECC5345E5340CB0798638B5965E2ED30366D621C903B4C7C0831BF35A9_cppui256),
+                            typename field_type::value_type(0x48341B4C8956A77069281E79C517CE993F5FA126C564848D3615B07B36A268E1_cppui256),
+                            typename field_type::value_type(0xA7227B0807F2A9085344B99D51194EC8400020516A25FF3E7CB2963786807A23_cppui256),
+                            typename field_type::value_type(0xF5507525D45D39E845DA847920A075ABE7BF8157B728CDC91C471983D4115894_cppui256),
+                            typename field_type::value_type(0x8C86799B36E7D519E63138A90228DC28022FC19D8429B019ACEBE833F2F21873_cppui256),
+                            typename field_type::value_type(0x5C0C2C12A5A3E85D61CE9FE475A272D15DBF4306E861F0EC8905B7D7E5159140_cppui256),
+                            typename field_type::value_type(0x85685474D77E08482397F463E53CDE1D022ECA56C3915C978ED9C7E787354B7A_cppui256),
+                            typename field_type::value_type(0x20B50EB50BF587B6EEBC913B2A6F728706A891DC1FD6FDBD8954402BD16E04C6_cppui256),
+                            typename field_type::value_type(0x80ECAB9F02B4CC6C691EC77B5AF1694C45FAF0843C5344C1186C5AE0464345E7_cppui256),
+                            typename field_type::value_type(0xF424148ACA6D55C6FB5FC8F83E19FC8432E500CA5BCCDBB497A3DE52E042E3EF_cppui256),
+                            typename field_type::value_type(0x617344C752B23E6549E9D2092FCC92DEA713A215F677137EAF6CC7FA7B26165D_cppui256),
+                            typename field_type::value_type(0xE9901617A437835A49B7D10BD18220B29899AC16E37171A4C49BFDCB86B2A286_cppui256),
+                            typename field_type::value_type(0xE15D0F2321CECF4433F1C0B1843EFF4F5D139A212F6BC03D2540306574362BD4_cppui256),
+                            typename field_type::value_type(0x9A84CBE2707EC22EC1BFE039308BE32623ED4BF8A4468269BE6ACCDAAFB46FB8_cppui256),
+                            typename field_type::value_type(0xF8AC03EE55FB6A22DA04C1DA9E40FC2E9018F7A6E101BAD1021BF76650442770_cppui256),
+                            typename field_type::value_type(0x5A358E65599D1E8EA436C751B34E6D17A97602BF95041D023A2864F11B00C82D_cppui256),
+                            typename field_type::value_type(0x0C1E3E83F22961A15BAA9060C6A031ABAA43DBFFE2AAF9DCC363877731EFFFE4_cppui256),
+                            typename field_type::value_type(0x59190DF64DD74B5DE869F22AAF60D21692F7DB6B5625B6535CCB48DA896A7824_cppui256),
+                            typename field_type::value_type(0x8A731FB525BC95C66C6CBCBE30CC8EA60C73F8D0AABF77B8FBE06D86F65460DE_cppui256),
+                            typename field_type::value_type(0x585855C5E2AB63198F52954BFFB04DC435867E3C52508EE3E9859A1DFF8DC207_cppui256),
+                            typename field_type::value_type(0xE7A38889DDB5553D58F94187DC6D34DC5B4273B92840CC66D376B93B369F9C65_cppui256),
+                            typename field_type::value_type(0x5437B5BAB121917208E37B26192145BD58A22B94187D1AB73B1BE4E0ACA7EE5C_cppui256),
+                            typename field_type::value_type(0x1136B759C12B3B11B319E52D6BF9597D9E3607554615622ADDC6DC1B12378C16_cppui256),
+                            typename field_type::value_type(0x7DEC0FCF45168FDD09F0ABC60FE9ECB29614AA28E751CCE379F59BD0B3488127_cppui256),
+                            typename field_type::value_type(0x11F1F5738159984D086F8C11B6445072D95C410A18D0145FD0E6DAFFF34D3977_cppui256),
+                            typename field_type::value_type(0xAB98C1B579C0B985CB829F87D3A748C7937E953F3DC6820614BC90EA00154B71_cppui256),
+                            typename field_type::value_type(0x53893EB71CDD4336CC4AD13793FAAD48F40F467D713DB134970E6D827B299740_cppui256),
+                            typename field_type::value_type(0x27728A7E9485FBD83841CE28EA75DC8DD8A132EF21FDE8CD51EA6F1B3FFF7509_cppui256),
+                            typename field_type::value_type(0x934C89B9AA1CDC489B8018B75E7D2586953B9A779A2E613FBE840CA84D6A6A96_cppui256),
+                            typename field_type::value_type(0x856AF4FFBCCAF40A4516D6D6B31B2E9D107D2DF0E2E4CA9FEBEF148533D838ED_cppui256),
+                            typename field_type::value_type(0xDD64E9DD754CDA2757E376BAF1FAE5604E1E27707BF03BC130B3C956738000FC_cppui256),
+                            typename field_type::value_type(0x432193EB0C2932C96DF89E3E19CA79FFBE45D022B91E48F8BFAA1C50DDF4AC12_cppui256),
+                            typename field_type::value_type(0xD1BD257B592C69435AA3227FB295F467DF7150B8829ED224FCE56020573AA9B8_cppui256),
+                            typename field_type::value_type(0x177CC0CC4BC60526D0B4922E396A0E4175CE33D784CF7342C16568492B51D81B_cppui256),
+                            typename field_type::value_type(0xFF9845A87EFFD516F2C69C60E4A91B21D883D03C8551C055EF82151733878C4A_cppui256),
+                            typename field_type::value_type(0x835B9AF4A4E2428F8FD8A48EDFF5E8DDF1F33746B65CFEBC6BA6847D7488DF68_cppui256),
+                            typename field_type::value_type(0x4D00885C9A9DF2158F5832665CDA09C3A8030F018D3A3511FEBF5EA4ACC506C8_cppui256),
+                            typename field_type::value_type(0x3F853C3A9671C7F214C0474409FE88A145D17ACAA56CE133D4FA660E1835AA2C_cppui256),
+                            typename field_type::value_type(0x0D2BF28BA7C2A51A90F573A82589F18E07E50AB01786DF709C762EF1943E832A_cppui256),
+                            typename field_type::value_type(0x0CAC3F4313BD00AC7087A10A94B4E7ED27EC9DB96055144648263AF15B20D37C_cppui256),
+                            typename field_type::value_type(0x84FEEDC3620EBAD8FBE9218BF89DB7610B63F06C8F9B6856FE43BD70A38305BD_cppui256),
+                            typename field_type::value_type(0xF199BBD5A9C7C1654A3F5B5C17DA39482568E12DDB32C53BFFF41FF86073BBA9_cppui256),
+                            typename field_type::value_type(0x34E5E85EB967F82CFD9BCC35B7D9531B1CF8C6C365FFCDF361EAC4BC112C9666_cppui256),
+                            typename field_type::value_type(0xC0CE68313221A36B82846575CCBC46330F47ED63C1E3A526B5A1853C992A3666_cppui256),
+                            typename field_type::value_type(0x5D890886CB475BD421501871DFD7FDEB3C399F34F03E03F0582554A2A1FAAF83_cppui256),
+                            typename field_type::value_type(0x970938BD84A2F69A46B14DEF6CB0616D755B7179214633D2498413FF2CE31FBA_cppui256),
+                            typename field_type::value_type(0x727362CC59F4D863A6C493EF0919E1545941720025D92665C1652BE351209502_cppui256),
+                            typename field_type::value_type(0x17B0F4229BABAB589F100B8C2CE91D20A18D37F9BB2760BBC677D1D3D7042B0D_cppui256),
+                            typename field_type::value_type(0xB5AFD1574FD7A9042EF73D190A70593B2065A28C35A2D166C5FA15BA3F891521_cppui256),
+                            typename field_type::value_type(0x7955A0AC880179CB71C573A608E6388FBDD4F9934E541D61AACE31C0F0D1ACF2_cppui256),
+                            typename field_type::value_type(0xA0C3F260054A6CEC973A14C4BB49EEE9F947DABA8271D368455E7928A447F959_cppui256),
+                            typename field_type::value_type(0x508C73090E4B2C4F382F8C10CB628208B1B5540258D272C9B039D248968B671F_cppui256),
+                            typename field_type::value_type(0xA6E1C5814699E69CF5D74845410E16291BC3CAFC1640D35E0604C5B8BDFF8874_cppui256),
+                            typename field_type::value_type(0x0C25AE34DFA827E624B1E0A9EF5A2EFDB789999F3812B2141885D8EF93076DAF_cppui256),
+                            typename field_type::value_type(0x8A535F566EC73617F5622DF4373713269E4C35874AFDF43AAEE9C75DF7F82F2A_cppui256),
+                            typename field_type::value_type(0x0455C08468B08BD737E02819085A92BFCDE533864C8C7669C5F9A0AC223094B7_cppui256),
+                            typename field_type::value_type(0x4EAFA17A88814D84D36E2C6048BDFA175799C8F19419149BE8B043C401CD7F36_cppui256),
+                            typename field_type::value_type(0xA47974D851EC201FEE45531527EFC47B5036A58CAD4543D2C778C64A0B2D1C43_cppui256),
+                            typename field_type::value_type(0x86EAC93DDDEB882DC2A223236C24B4BCE0FE2459051541DDFB14F217AB348FA0_cppui256),
+                            typename field_type::value_type(0x948F3853CBBC4D8D5A436F9E8D6F46716C26D96351CFEE8A4EE380954DA51CEE_cppui256),
+                            typename field_type::value_type(0xC6122FC44FBFDB25CDA9E496CDF1C58971DC987A8FEBC765CC319D54B96214FB_cppui256),
+                            typename field_type::value_type(0xEA205BEC8343AC419031C9868877F91F08A6E48C1E271F8A3702BD8FB7ADFFF7_cppui256),
+                            typename field_type::value_type(0x8BF09EBAF9FB3AAE3F5E7D784859F407948CE77E87E5E1037AF41FFC99222C03_cppui256),
+                            typename field_type::value_type(0x509CBAAFE2E27A733B48B1DBE7E5BA309C9EC0E1DE20E1D4A145F742EA72BB54_cppui256),
+                            typename field_type::value_type(0x8B4FCEBE1F52629E85B6220EA2D65D248BE074267F1462B71686977A8D215BFD_cppui256),
+                            typename field_type::value_type(0x1F3307A9A822157EF96FB1CADA9254FFF9D502D09D21ADD606EAF00A475EC26B_cppui256),
+                            typename field_type::value_type(0xE85E2DCBB7E70FC619130BADA2F3735B5E1C470475C48280B453A2C1D1AE9300_cppui256),
+                            typename field_type::value_type(0x451AAFA6D51CE0BFC7BA7B5B823C2707DEB7E185DF8C31BB72A0DFDD1546E25E_cppui256),
+                            typename field_type::value_type(0xB6D94022C181213724B4042C13019FDA6F4FFFDDEE86B987E97BE9ED0E9D6B84_cppui256),
+                            typename field_type::value_type(0x93FF3F41629287238634478884D77AD3C23273EAEC4F382AE1BCAA0FBCA7CB21_cppui256),
+                            typename field_type::value_type(0xAD6090DFDCB41A019AF7CD273DA8A366B7A3030E99E53D5E9C837F4FE476C81D_cppui256),
+                            typename field_type::value_type(0x77B5D1DD48F4C91EACCD75C2CC5BD8A8393FDC364F3048DF818ABC84EE6705DD_cppui256),
+                            typename field_type::value_type(0x7E4573DA81BC84DC2626F6CA66F6A11F227F1D7586BD4CB5AD180DC0CAED764B_cppui256),
+                            typename field_type::value_type(0x8CBBEFFD96069F25F1BB9FC93651B20B2FEDF3C7D11E7FB49C83115F17C2F2F7_cppui256),
+                            typename field_type::value_type(0xD90B45BB71AD697CA2ADAA533B09863C4AC3240623CB59900A24737CE2725490_cppui256),
+                            typename field_type::value_type(0x3326928EC1BB350F09D8B5687378CBD80CDC07BFF3C466CCB0F84F84AFEB1299_cppui256),
+                            typename field_type::value_type(0xAF13583CBF65021F7977AAC8FC30C25F1A9C655F50187A3DB5252B56C3F0E03E_cppui256),
+                            typename field_type::value_type(0xF8FE31F81A9B57B3DBF60BE46D83D6F8CA20EDFFA3E1DC84BB2F5BFC575CCB22_cppui256),
+                            typename field_type::value_type(0xAC25921731213FC7AC05393AFA1F06BEFB02D84CF86BABF0A76B3A657E933668_cppui256),
+                            typename field_type::value_type(0x6C79A03870DBA8BA850EC13EEBD8ED7C6F864189C69E1E7A16E77F6732776FB5_cppui256),
+                            typename field_type::value_type(0xD32A0D2C402577AF9CD9C99C12311DAFC3677BFD6DC6CEE6560B276CB62CA483_cppui256),
+                            typename field_type::value_type(0x0D17D4AD78A74B3073A262470597D0D96D4C582B760D3D174959A5DDFA435B18_cppui256),
+                            typename field_type::value_type(0x7BC3374AE979F3A887320FBDA7B431BF86842AC3ABEA996D9A617C12128DE7E3_cppui256),
+                            typename field_type::value_type(0xB431F02460854E5DE00C77AE6E4BACBD55F2DB39B4C0CCF067A0B32EAE6E5E29_cppui256),
+                            typename field_type::value_type(0xDA2535F6CDA744D628E91651ABE7ADD0B2A3A6939881B969142FBC118FC3FCB9_cppui256),
+                            typename field_type::value_type(0xE756083C27486DF224454C68510DCDD3ED8DF5246A0960D978086193902A869F_cppui256),
+                            typename field_type::value_type(0xB6E06C516305BBC4E466557075B929FCDE1ADF89F510A848A52F2C3693C4A205_cppui256),
+                            typename field_type::value_type(0xBDB4277C21B323F5C5E1F126E79ED73B63F99419A82A9F87537F4D865DB36D05_cppui256),
+                            typename field_type::value_type(0xA61727A4F5F8DDBFE55703A07BEE1E8DAF3674C6D797EB1329F315F9FCDCFC44_cppui256),
+                            typename field_type::value_type(0x03FD9E4F9B02696ADE692D5A2BBAE158C1B9010462F080F393B82A7F0EF3D60E_cppui256),
+                            typename field_type::value_type(0x0ED9E43F84241C4E6B395D5D6FDFBD68771AD4B388D9E4D692F821F6F9E27907_cppui256),
+                            typename field_type::value_type(0xB5AF874AFF6B2347F5BC0FD8EB120E0CE9151CFEB8BA1905F13F4F506E78C4FB_cppui256),
+                            typename field_type::value_type(0x27708F23E8BDB74F8C89F34B7CBF6A9E324A7181C96B10C893FA154A553FAEA4_cppui256),
+                            typename field_type::value_type(0x575F186149CAA4A4300225D66CC2C973FC6D68B3D1965BD1B21ADE75D0802D2F_cppui256),
+                            typename field_type::value_type(0x57A7E410076D8F7DC55268DB48FEE1F92E2A860E5CAF07CE36D0572535B38F54_cppui256),
+                            typename field_type::value_type(0xFD7F0F03C8ECAD24194C8A23BC82DD21DFD76E39A907EBA75FA781E6245F2809_cppui256),
+                            typename field_type::value_type(0x2ED8369AAE243BF757DD0CD934B55A4FCFC99D57B30C8656A8C081B7A0F69001_cppui256),
+                            typename field_type::value_type(0x8D916D516A90F28AF38A5DBAB4FDD7DE9E3959C55A9244F9616CA32A2DBA519E_cppui256),
+                            typename field_type::value_type(0x24799AE2F3EF5DBEF52D9B258CCA5CF3347A7249D25C497946FEBBF9A7A79593_cppui256),
+                            typename field_type::value_type(0x9436B5262EC87B7B32C3D1A9D363E3009994361F9BEB1398D6388D75D0920D55_cppui256),
+                            typename field_type::value_type(0x7CEE417FAA66DC6109BFE97CAB77AE6CB0844AECB2DA65107FB5BF4597445FB2_cppui256),
+                            typename field_type::value_type(0x3040EFEBE1E5B9F596D871E7F9CF0BB3A667E8569ED0E31F4FFFCD61A8223A26_cppui256),
+                            typename field_type::value_type(0x45A511C97F608BF76DBC4189D991ECE618C452B1B42A627F3CD5F4E4A9AA52DF_cppui256),
+                            typename field_type::value_type(0x73BE0EC773EA9B6D3FE3337FCB625AD25A919B27D22955CE7B52BD12125EC16C_cppui256),
+                            typename field_type::value_type(0x4CD2A0BAB6ACE28A2BF7CA0444AB1B75020688B6B3A0E5F213CC521BF003E44A_cppui256),
+                            typename field_type::value_type(0x6ADF08C371D224056D1310756218D126BDE2E7D1C97EA5D64993ECA97B19C38D_cppui256),
+                            typename field_type::value_type(0x0B57AC4FE72B93438EF40F1217CD4C7B95C7170DB6F7FB1F656753EFAE75BC7F_cppui256),
+                            typename field_type::value_type(0xCEEDBF8277A9F3B5F28C34CFA57E94FAB1F96C0E4049FC6204F172DD0972E9A9_cppui256),
+                            typename field_type::value_type(0x7451FE377B24776B323357A021C84544EDC4E459A0829DB27AD039A2F521BA40_cppui256),
+                            typename field_type::value_type(0x16396435FCC70940D69002198464EADE36B09EB9985D5439D0A61CD3E518DCF9_cppui256),
+                            typename field_type::value_type(0x1178B3FB6E4BD148CF4682D9CA1CAE99354557B05A5A8142137433CF833125FF_cppui256),
+                            typename field_type::value_type(0xDFD697EA9BABD95B382DE637EA310ED10DC8ADCD08E54D1BE80F9709D8486ABD_cppui256),
+                            typename field_type::value_type(0xC31F323D127261F91589068F2ACF1870008CB862FAE8019282155E1DA2152BDF_cppui256),
+                            typename field_type::value_type(0x2689DD48ABBE75809EC96DFD936414F1BFC9C1BE1030637DEDC121B6CCD2022D_cppui256),
+                            typename field_type::value_type(0x8AC7A0826F94E907F8A83B7E8D2756938444D685B48CE44F3B3695CCF662D955_cppui256),
+                            typename field_type::value_type(0xC80F40920F33231CC9D7E5234CB59AD9E3F481C5BD6C138DBC6A2DBE646B3DAE_cppui256),
+                            typename field_type::value_type(0x058FDC0DFE5DCAA324A33A3BB84EF35EE9D08BAB256A19046C47A8CBAB3F4576_cppui256),
+                            typename field_type::value_type(0x90EE3B9E9EA9E0E7C3DF9B4606B8871E1E801392607577593A45E3E1A0110E9E_cppui256),
+                            typename field_type::value_type(0x20E118564880C79CB927E3501CF2A53F030B86E3CECAC60728CF1AB99076F57B_cppui256),
+                            typename field_type::value_type(0xFF67B352AC437EF731BDC3E3FB6DE9979FE0DC9B40E1B71E8583BEDBADA7AFE6_cppui256),
+                            typename field_type::value_type(0x4EED0B4DFBB5C3073FEFE10D9289D72B62DF6C0F0BA0405B9E849544D4C20855_cppui256),
+                            typename field_type::value_type(0xACE0FB288A56693A1941D3287FC115C81136CCD32D34FE3F4C087A3F8BDFFD1F_cppui256),
+                            typename field_type::value_type(0xFFCA2A5BB86606CE8F7C7FD903061A21940A51AC64A84A5C849E3AED4B661DA4_cppui256),
+                            typename field_type::value_type(0xCE1CB0E32B71CDC8A53CC9A148F46C8C478F87ADE5687F6F8984835EAF9B8A5A_cppui256),
+                            typename field_type::value_type(0x42E0437C7ACA84F70A45B1168ED12D20FEB99F12E6A12DE783D637E60524722B_cppui256),
+                            typename field_type::value_type(0x2DE1DA0901D920EEBAFD84CCC9B4EA3EDBEA2A6DAF54265A766939C81FEA76C6_cppui256),
+                            typename field_type::value_type(0xFF209CEDFFC116AB636535150DAD354A4E2B0671B636BE583CAC1E139C8CFD22_cppui256),
+                            typename field_type::value_type(0xAD79F397469D0F7E207D41D24CCFF1C80D4F4B92C9684B942389B14E93BC5535_cppui256),
+                            typename field_type::value_type(0xB30DDEFBC268D8659025F8240670DFDE0E411D07935382A4C4AD7478ECDC9426_cppui256),
+                            typename field_type::value_type(0x7DBF4FD5C014C1534AB3871BC983D48B5B93309CAEC0238FF33E104B29C7275E_cppui256),
+                            typename field_type::value_type(0x33D5F02D0B079BA958604080D33B4B156D9E6EC87017F77CE807E5858F4E983E_cppui256),
+                            typename field_type::value_type(0x01EB5A76D39C478473C3D61655BBA1EB7A71AA9259630C956D70DB8791EA37A9_cppui256),
+                            typename field_type::value_type(0x070D96CCC51AFB00C499EA8FC2EF48C949A7CBF2445CC228C6F24FC37BCEC904_cppui256),
+                            typename field_type::value_type(0x9B915EF5FF0ABC21FC61582D55F0E97753BDEC7B34681BACF62F4DB2A3AB316F_cppui256),
+                            typename field_type::value_type(0x5C9CC4F8723A027B0318EC7FDFD7DAC93FDD478E694FD54ADD1452E899273A8F_cppui256),
+                            typename field_type::value_type(0x84EFE07A1DFED259A827589D3708AF964F003675A11ACAB5ADDACA695CE80D6E_cppui256),
+                            typename field_type::value_type(0x0E3EA757DEB82767A824A072E4C20A4B8BD467275C0F80D40F2E4327BCFC91DE_cppui256),
+                            typename field_type::value_type(0x13F2BF92FFAE215623F2ABF6056AAAB3BFAF0850149C5383145E8C5DF582F54C_cppui256),
+                            typename field_type::value_type(0x5AC8E192BBDFD85C5BE2403952007431D0604FCEF55536F38C8C98544883E382_cppui256),
+                            typename field_type::value_type(0xFCB7E5004C7A8C8039C8FFF2F0963976DE76ECA13D4D9D2E51373D9BDDFEAADC_cppui256),
+                            typename field_type::value_type(0x9A6CABE1F8C78B4F154A04034F63C34AF6BADA2932F50E57C5F483AAA556ED7A_cppui256),
+                            typename field_type::value_type(0xED9F5029FAD500451DE544FB7D555740FEB87EAFD12207162521483EA054A72E_cppui256),
+                            typename field_type::value_type(0x99DC0698B79121182D515D44E0D67362C6EB65432E48094EBCA43077EF01A3E8_cppui256),
+                            typename field_type::value_type(0x67C69CDD23B982BC697AC71171D80044B7A67034D7F8F294528645FE40F61114_cppui256),
+                            typename field_type::value_type(0x9CD44DC242811D04A5DDB4E150CB2609B9C96BD28139B2BCE73B8EC1FC74D145_cppui256),
+                            typename field_type::value_type(0x86ADCADAFC464E33045AD0BADD8443A33339B8FBFE816E5D5C6C406240D456F7_cppui256),
+                            typename field_type::value_type(0xABE2F3618E04061644024357CFCFB9F37724D883E8764DC3383F7B004CD535AB_cppui256),
+                            typename field_type::value_type(0x4F02D64CB755B293DE0DBF2B202DF7957FDE7A18C3AC8DD990711B34517B9C1A_cppui256),
+                            typename field_type::value_type(0xED19A56A1B59CF5CD880F08099A2E4DCF318DE811D6A8871BCC2887A735A8087_cppui256),
+                            typename field_type::value_type(0xCFBE683E6C3B56B630254512AB54AFE1A98CFD5AAE96DA46E56CA0873A9FE557_cppui256),
+                            typename field_type::value_type(0xBAFFD4EBF8A8B5AB46AC18444F3DCDE3351A3A75556C6C4AE7DD9AB328523EB3_cppui256),
+                            typename field_type::value_type(0x0FA93DC5DBC95E83003A8EB3795AC09C24511CCFBF48B6EE1978300CD5ACF387_cppui256),
+                            typename field_type::value_type(0xCAFB6C8657874A09751A418AE4EB8EEEE9817B137D07F1EEAE03AD0F9D2157FF_cppui256),
+                            typename field_type::value_type(0x2ADAFB1ED5C5C67A01A1CBB99AB4E2E09C6AB445913B9E0E16CEC08173CE8988_cppui256),
+                            typename field_type::value_type(0x91B44522441C89ED7778B51236563FB71AFAC0C166C2E13AD0099B4EF4737641_cppui256),
+                            typename field_type::value_type(0x3F4463BD37FDA9762C13235AB02FB428C9D7DC666E077D03F2512B29E101BBE0_cppui256),
+                            typename field_type::value_type(0x894890B2FAD37CCB9A879A27CF8EA9A337D28A48A4BF795C4700EB8CE51B2CF9_cppui256),
+                            typename field_type::value_type(0xD46800FF7C5B301188A0ABFDFD48E438498E7116A3BC2ECB0D187AC835979D3B_cppui256),
+                            typename field_type::value_type(0x296D135DE82DB07AA37EA6C7C8689165743EFF76538FEFB9C6A2BAB826DD01DF_cppui256),
+                            typename field_type::value_type(0x14054EDD92E145E42B87129776C777CADFFAF618E5E66F604950D320AA3A0DC8_cppui256),
+                            typename field_type::value_type(0x9B46D393AB8E7935B7C5E38255F2BDC5D15F33ED2466A2DF427ABB1CCFE63974_cppui256),
+                            typename field_type::value_type(0xF3CCEFE1918B71A20554F01E26B9C5D6BF7EED5FF5415950ABEDD0A2FCFB2502_cppui256),
+                            typename field_type::value_type(0x4B0942F391367A318F13C2F1F19E4A9654FFE1242191B2C8C67E6F06D650F5DD_cppui256),
+                            typename field_type::value_type(0x7432AAA6366CABC0E055C1015613C25F023C6782E4E73A62C2EA5BCC7AEDDC6D_cppui256),
+                            typename field_type::value_type(0x463D8E29E481AACDA1697678F8B8C55BA26E2A1E94139936BCFF60267E460D62_cppui256),
+                            typename field_type::value_type(0x400F734B7AE2A66EF1FD6C6724F852968F9EAC14DA469B0A226650888C11217F_cppui256),
+                            typename field_type::value_type(0x06AD2A098FCED766ED22A34D257E4C96479F0B1A76DB3C5F835208D8BA111101_cppui256),
+                            typename field_type::value_type(0x2D5B8B1C58F85E3559A4C01BB9EB62A0DE429D82B70E89AEC1A7BA9D5FB37EF4_cppui256),
+                            typename field_type::value_type(0xF657E9015F9855A5EB9ACB6EBFE5941A08FE3CDA3B36A5DC2B1F0BD0F65BB830_cppui256),
+                            typename field_type::value_type(0x8077A8BB3BCAAC496DC83CD25DA0E7FFC2ABBA9CF2C8E35AC3B9A74D87B193FB_cppui256),
+                            typename field_type::value_type(0xF1A2CA556C3BCD7204F78BD66BD8D475BBAE4F184531EE4376FC3847702BEF6F_cppui256),
+                            typename field_type::value_type(0xB39B59AF0488313EDF455417DC020168B0B47EA81FD52B4011B2D1FD8F6C1CA3_cppui256),
+                            typename field_type::value_type(0xE46EABC9F8E2F20CF0EF002C94979625855719520EC5A6E7DB47FFCEEB3FA150_cppui256),
+                            typename field_type::value_type(0x2532CFC894C18963ADB002810C09FC3A50F68CC24C227E4BB934894C4A0B139F_cppui256),
+                            typename field_type::value_type(0xE924AD49FE3B8030EE1901658EBF1851E6C4F2C824D613E0806028FCA0455367_cppui256),
+                            typename field_type::value_type(0xFCC97D979A143ED5752085393D6FBB6F52DA31AA4FA6752B5FD18CF828257E92_cppui256),
+                            typename field_type::value_type(0x38136959C7525F69DFCB04E096395097A0ACB88E2294AF94E0F0BCEA876AB854_cppui256),
+                            typename field_type::value_type(0x20136AC6A0B1841139E0257CFAC06A9E5AA59636DE810FE6F615B5AADFEF276B_cppui256),
+                            typename field_type::value_type(0xF49D9C7DC5F7026FA00B935105FB22F68DD4AA5D4DD1F9E2E91F093942F8F1E7_cppui256),
+                            typename field_type::value_type(0xF5585D4203E3ACAE6AE5D3B3B994F67901B0013C4E4D7A8392228AB1914D9972_cppui256),
+                            typename field_type::value_type(0x107A4485AA07FE2E14BB5AF4516750F0E06A970759ACDC147724967E5833C4BE_cppui256),
+                            typename field_type::value_type(0x6EA22142B8E4D7CD813794EC48E680074D3A4FC91D760C4A6566EC48C87C80DC_cppui256),
+                            typename field_type::value_type(0xA6D39677A78492762736FF8344315FC596439591A3C6B94A6CF20FFB313728BE_cppui256),
+                            typename field_type::value_type(0x674F84749B0B881666B8BABD2D27ECDF824A920C2284059BF2BAB833C357F5F4_cppui256),
+                            typename field_type::value_type(0x3F06DCD2CE62E80D4A661CAA2D2A108675F3B0CAAEEADD251583948C5974BB08_cppui256),
+                            typename field_type::value_type(0x08BC2550CE1922DB985807BE931D9B2E831606905E88F53E89655DA995083C99_cppui256),
+                            typename field_type::value_type(0x07EF66D7C5DEDB0DAFC8ECE7BE26CF352406FDC6A1CC8D3CC054B569CF15D864_cppui256),
+                            typename field_type::value_type(0x2DB3325DB89DE6A506D40C5221FD505E9F470E3B1CCE4A8B54625427740907FE_cppui256),
+                            typename field_type::value_type(0xEC61FF29918A1D05E0C05B31527E97B7EB3228B94BDC794C1C101B8FD5C7C27C_cppui256),
+                            typename field_type::value_type(0x02FA1D3DC1B257A1D0960F82C7759298FE3C46C47690233DADF01167D9DDFE51_cppui256),
+                            typename field_type::value_type(0x82DF4E5FC06DC46014F3A72F75F28C0BB283CB952CE5416AC695143C17C7C05E_cppui256),
+                            typename field_type::value_type(0xE4E188C98C96420A275216211217CBD1CF15D946842DB300B9613D02D8FFF26B_cppui256),
+                            typename field_type::value_type(0x5BB18BCDFF79176169A3FB20E7D116D1C54F84D4C1B00E1AC23E42E21D7DD05C_cppui256),
+                            typename field_type::value_type(0x42AD92172DEA4874F81B6DD5D7F5821595187587A4D2A41656C549F2CB96A309_cppui256),
+                            typename field_type::value_type(0x261EFC9BC12B0C6A7D9E5B8D38E47A621324C22F8FEE949D80AE1D41540368B0_cppui256),
+                            typename field_type::value_type(0x8A9D2ADBE386FCE9FDC8852CD64FFF797E340BE1E39B5D3013AD2559BDEB011F_cppui256),
+                            typename field_type::value_type(0x9A79BFBFE71E347F4D6C6698316797E2F5AC2A3900F5ABF0C409332DE46E2050_cppui256),
+                            typename field_type::value_type(0xE98B4DE6D316E200B6F671F3B224EFA9CA94FACCB6DFDE317A3F4781926250D2_cppui256),
+                            typename field_type::value_type(0xAC25DA80089CF4E033D4DB5710FF5936FD683B4D0DAB013E6EEF62FF4514C6FD_cppui256),
+                            typename field_type::value_type(0xEBC69D985CB44C7B883DA9312A1B338C810983E8243BF37A60B5397705830541_cppui256),
+                            typename field_type::value_type(0xB467CD65660C13B84AEC42B5296BC037C1E6B5EA71A0D289B456511069962F3C_cppui256),
+                            typename field_type::value_type(0xDC91B9BC4D36FFEABB3F5D2A011664AC3CB212DF6CBDA472F75584CB22877596_cppui256),
+                            typename field_type::value_type(0xEEA7E66C49BA3C8BB4D748671E165547E631E4DC5427AD6081941C7E32FD0E3D_cppui256),
+                            typename field_type::value_type(0x83FED45B9F88926128843F27BE9B7D985ACBADA23019E3CC10411F68D91D5868_cppui256),
+                            typename field_type::value_type(0x92F9A6F93FA37761979280DE26DA6CDE08533ABEEF2160F4919B1597B43C7E8D_cppui256),
+                            typename field_type::value_type(0xBF618D715147AFE8ED41D3A6F5E542DF7309284ECEA312897746055552BF1285_cppui256),
+                            typename field_type::value_type(0x9A3DE2D3E93E21BDBAD194B35403C67B7DDFFE6C44408E5D119F14F26CCB63B3_cppui256),
+                            typename field_type::value_type(0x2F809B90611112C8809F2736EE813C4C49C01D9FEF58226001C532977DF93FCF_cppui256),
+                            typename field_type::value_type(0x3CC4767A0677248665FBB469F6E48D447DB4BA1F065935FBB5CD34F827D3C9FF_cppui256),
+                            typename field_type::value_type(0x557C538D8CD381AD94F22765E37B7EDF772241168378473A3016C53CC5AA7383_cppui256),
+                            typename field_type::value_type(0xA7C382F4B53B92DB05100D30123FADAF34896F70BA7F6D8BE4ECA34DD63F1117_cppui256),
+                            typename field_type::value_type(0x1B91E5116761BF880459F777705DCFB5AE4EB76ED3C4A68CC1220C5E1934CB9A_cppui256),
+                            typename field_type::value_type(0x5CE4FD836044BAF3A1623065BCE83B11FD7516A5B209D887D79A7081AFAEFC6A_cppui256),
+                            typename field_type::value_type(0x61042108AA50F3681E31BC1EA832C7144ABFBD4AB9E4ACCE38606DFBBF9DB9A6_cppui256),
+                            typename field_type::value_type(0x285250EDC3BCFCD9027BBA12176D343A26035672D5B4A81155D4E37A2FD20BAE_cppui256),
+                            typename field_type::value_type(0x7866C086F4AD7EA83F7284AD1046C1716E9B1A2CF1EFF323F9DE455A54E0AB97_cppui256),
+                            typename field_type::value_type(0xDBC091D89944B44EB651D0CC325161C03840E563817C6662F0F2EFDB220CA9A7_cppui256),
+                            typename field_type::value_type(0x092D80EAAE8567952D57926D1E4AA5FC6367309FE96192C84D20588316C8E76B_cppui256),
+                            typename field_type::value_type(0xF1E3C56545D5A75C5836FA12FC78BAF65D2EF616ABB75196CC8876ABA636A50B_cppui256),
+                            typename field_type::value_type(0x12B8847A6E1EFCE76C736A67F6A5F3136B7FA576D22D7A6EDF77914EAB3128B6_cppui256),
+                            typename field_type::value_type(0x9018BAA11E938F23B322489C6EE06D88AD3A6DD5F518E8D7D6BE4FD07EF7D72D_cppui256),
+                            typename field_type::value_type(0xC9C382D871F9C6C9E8C147F743BF00B74EB56D8002736AEB1267044FC036CE68_cppui256),
+                            typename field_type::value_type(0x584D729C81E134A76D87CDABFA9B228CF45C1B6B5D34F3B2517F13214E583340_cppui256),
+                            typename field_type::value_type(0x2FDD80A4560D80ABCD307C593030AFFA8F1770A66494C07072F6E5E974FB24B9_cppui256),
+                            typename field_type::value_type(0xA77F7298D5478DDE28A8842DDE8AD36C86C0E6EEB2AD008B08E24680B5182E0F_cppui256),
+                            typename field_type::value_type(0xFA48A69C911B4FCB0F1E64BBCA515F6A3368AC6E2475B42CA2B37F28C4B82D57_cppui256),
+                            typename field_type::value_type(0xBAAEAE00C837DF7D1E2E028DC2383C453C572DF0B5EB817392C83EDE0235809B_cppui256),
+                            typename field_type::value_type(0x325788833F324B80B4A2307BCB49F299835C3C42A1D2E7E5CD61D8A5C154FD62_cppui256),
+                            typename field_type::value_type(0xEDD513BBFEF3FB2463336038135004A3DD2F1E9BFF60A8A607596C1F536BA602_cppui256),
+                            typename field_type::value_type(0x257B598C3BB3F7A97C592CA290F0188B61854D442DA5DCAC3B8086F945DBF993_cppui256),
+                            typename field_type::value_type(0xC472C1062ED0366F818DEBC07EF8890E1FC5147DD0DC267C171F3A2A3E07E4F1_cppui256),
+                            typename field_type::value_type(0x41820E01945F70E96432AB5A84D667D885F3B7B1E22B5D8A571C683D86B0DAA9_cppui256),
+                            typename field_type::value_type(0x454E27CBFA01CBE542CDDF6FBA29971EF8C49096987F88EFC0512999FA863437_cppui256),
+                            typename field_type::value_type(0x134A4B214CF01E9E9E7E5F8F2F81017C6B8D88D5C651B986179B00E551A6BBE6_cppui256),
+                            typename field_type::value_type(0x86F88F399545E3D685E1B7A4B8ECC31EB39D6554613F053F4369534AA2F8ACB1_cppui256),
+                            typename field_type::value_type(0x2CCFDD69A68238D6B37C978FB591B1214EEA62BEE916527114B042D105098A19_cppui256),
+                            typename field_type::value_type(0x0ECFEF25FBC3698C06226D5629C51FFFB94130623C2C03173828179C8084A599_cppui256),
+                            typename field_type::value_type(0x8132B98BF295F2C0B2471C839F9A7982EE9D57DF992F62B23DCB4C13D520E922_cppui256),
+                            typename field_type::value_type(0xA2A3BE1FC9948E747DF7669660D9F9A0E1C6A33C3DD35602D88377B6FCADAB66_cppui256),
+                            typename field_type::value_type(0xA93BD8E6B524BE6706507ED74D235EE1FB2DE8A53480AD25EF4A12484C1AEB12_cppui256),
+                            typename field_type::value_type(0x4366CD148FD0C312CC8936952B904BBF896DEC1320EB0A985CB709DEE63E9E1D_cppui256),
+                            typename field_type::value_type(0x2BA2AD81E31075C1E86995697BB39803FBE7CC19E0DF40456A57ED87DB364BF4_cppui256),
+                            typename field_type::value_type(0x354E7CED56E78DB9367E124677C080BE82FBC777BE2D8097B89D2213207C25BF_cppui256),
+                            typename field_type::value_type(0x629D62E9BB994070E6EBD824A5CFE5585FD756CB05A0AA215123A3995A864211_cppui256),
+                            typename field_type::value_type(0xF11F5D1DDCBBE3469EC2C0FECC2F9B18075969944B3B7EDB644630BA41330C21_cppui256),
+                            typename field_type::value_type(0xD20045D6570278C2B3E3750F788716610CAF2CBD5792771554E06C7749EE7AE0_cppui256),
+                            typename field_type::value_type(0x55D5398D1666432B557582C99AD534580101FB06A050E62C320F09C3839BB85F_cppui256),
+                            typename field_type::value_type(0x576E229049FF8E2D059C6A9E8EBAA72AD90D6A7F1833D9E1F7F631184FED936F_cppui256),
+                            typename field_type::value_type(0x419A4F03AE7617CCFD23639585D56F8D28B1EB93FFF3C118F642E95B4F491155_cppui256),
+                            typename field_type::value_type(0x237C2D343A6E835B2E334B1484804545C7AB4A22074C68894B91BA6AD489BBC7_cppui256),
+                            typename field_type::value_type(0x1BB46408814F888B7858058DDDC0A7A39F01C1E6F7B910D1C07E2B9212EA285A_cppui256),
+                            typename field_type::value_type(0x8A3016BFAFAE1125A40FD9B892B4A4FC1E52A34B992FA94EDC0C8A79907DC702_cppui256),
+                            typename field_type::value_type(0xA2157EB3DADF2828372304AD31ABF75EC3E61DAE0B35D0FCC0841BA9E49E8F34_cppui256),
+                            typename field_type::value_type(0x0817697DA70DF31D0FB42577CCFBE5A2064BBBA35B187F4E1A8E983289EEBEF3_cppui256),
+                            typename field_type::value_type(0x04BC4E70E02FA14EE0973E2678627A548C88D076B8297F0145012900D539785A_cppui256),
+                            typename field_type::value_type(0x5729F224B8CB4CC3A5F5A1CF3F3DFB4F877017727A3275C353990475CA62E3BB_cppui256),
+                            typename field_type::value_type(0xB76F40233E918CE57E54F059669A910E4C3758A2B96EE4B24E9C6714B80F772A_cppui256),
+                            typename field_type::value_type(0x05197211A7AED93C9618F274CEB0999856BA24196B16AE252B481D7C72EEFF74_cppui256),
+                            typename field_type::value_type(0xD3E492FDC1F88173587739E1B7DF0876D136189AA3D5A6A3112D4BB1E114CFB5_cppui256),
+                            typename field_type::value_type(0x3604A70A73F8C48B1FEE2676BF15FEA39C88F06E46754EEFBCEB9AA5697F7045_cppui256),
+                            typename field_type::value_type(0xDC386DB7F409D9E0FB28652A88C376D227FCE62D1DF14515D4EB281C2D5C502E_cppui256),
+                            typename field_type::value_type(0x526C6376CF20188AE7E69C459D7AD72B372C3DB3CC760B7B23B47A257BFC1E4F_cppui256),
+                            typename field_type::value_type(0x884286463CA0872694FEBAB24BFC3383CC268940EFEC85ECC62DBC9C32513926_cppui256),
+                            typename field_type::value_type(0xF778429C01C2DD5A69660DB365D81207CE0EB122EBDBC15A0EE4282AAFB8A54D_cppui256),
+                            typename field_type::value_type(0x789BBEB0199B2C38B48C9AD4808A2E9F0F3D27B94CD4417F005791EA7C2AE635_cppui256),
+                            typename field_type::value_type(0x14357E6199189BC68680B79F62F1217A7FEF5A9C2CA1550FB781DFECBFE96DB6_cppui256),
+                            typename field_type::value_type(0x3BAD9D36F76F0819D5A5FD168CCF6F4AD7F1B49E647F7DA4ED2BAC196520F1F1_cppui256),
+                            typename field_type::value_type(0x49F99DE33E24E659BCD9FA7D9DEC0E80499981A24EB672586A1970725698DF4D_cppui256),
+                            typename field_type::value_type(0x87C1D99C5EAD72DE2CBC4A513A0A9BBD5156B3FD89B84639B1F11F16F529B1CC_cppui256),
+                            typename field_type::value_type(0x7E1654C6985D0BCDB8617A6CA55EF683BB0D0EB2C5B275E3CF26978DD5A94D6C_cppui256),
+                            typename field_type::value_type(0xA6B3A4B1ADB0C46D67A7DF53D124118BA6EC16DBEFA783DF0B1E44A8B185AE66_cppui256),
+                            typename field_type::value_type(0x0CB6E8D7638896231361A91CD969E8D8BCBF0A5DF5B248DD7BEB553F8BFBF21B_cppui256),
+                            typename field_type::value_type(0x1EC07B834F2A5EE0550651821D38468F5DC7FC279D6F25A3201391BC2FA4E24F_cppui256),
+                            typename field_type::value_type(0x83FC544920187511F73485CF787EDC58ECCD3C9377755DFC318910FD4D270725_cppui256),
+                            typename field_type::value_type(0x1F848F5A6C9114A4E227E3A7D87F10C1F61060C17FF3F1C2A9684CE4EC630E3A_cppui256),
+                            typename field_type::value_type(0xA028552CCD06F9638629C83D1A9DA4264BA3926BFE359724AEED9FF686CA610A_cppui256),
+                            typename field_type::value_type(0x2800043ADA0982E22DDB6C3DDC7F43D53719A8B66BB19BE6F0F679F10B79847D_cppui256),
+                            typename field_type::value_type(0x0F99174667E82909B6C0796584A4DC3BA87058DBB8513AE9FE5B0083908D9EDA_cppui256),
+                            typename field_type::value_type(0xB4958C4E21DE21D47FB60C55EDB925559EAA8520A5ED115E3E0B5D5AD4441FBB_cppui256),
+                            typename field_type::value_type(0xFCD6E7BF996640EFE5C041FBC38CB7E12DB9F6132D4638414C7E3C9F4ADD7118_cppui256),
+                            typename field_type::value_type(0xA41E9E9ED5876481E77CEB19F84DF2582CDD704DBC1A71C7FC4DA1176BD00B59_cppui256),
+                            typename field_type::value_type(0x50DC31723B30F2B6DA4E1ED1EFC739B85CD253563DD4359FE8DD28CDCF2E6F15_cppui256),
+                            typename field_type::value_type(0xB3A43F5E7B20444D232EA0B64606684B878CEDB730D70C4A5AED684C371F07F1_cppui256),
+                            typename field_type::value_type(0x34C64F5B248FD6B84183227369975EE7EC7877A0CDCB0ECC53CD22F4E01DFDA5_cppui256),
+                            typename field_type::value_type(0xC02A0F2E94CC35AC2C5F09A87D6886DF32A6D94EBF58E793AB0C96EF401403F9_cppui256),
+                            typename field_type::value_type(0x8EBAA8A18E491AAE0F716D457C5CD473ABB913066000ADB521F59639A7ED80B0_cppui256),
+                            typename field_type::value_type(0x452E9869A46BE14AC2662FFD84C008B148E1B4690DDC9B44FF7C97A46B559D49_cppui256),
+                            typename field_type::value_type(0x8C5E8A8F195F80D0F5C0057B6761EE525982856C3B1EE425747C6046DA0D6BA7_cppui256),
+                            typename field_type::value_type(0x9F170A79D27219B8276C8D6312B7D65F6AF2B72D39C2B06FFEE1FA912975566A_cppui256),
+                            typename field_type::value_type(0x54A6AA2DE8864A0CC799B0077D4E8578A0A6A793F5DB695F5A576C88ECF3E6D8_cppui256),
+                            typename field_type::value_type(0x19A7F5D48C6D62BB51CDE0DC3AC474EE8BB24F4256829E60537A67EB53CE94DA_cppui256),
+                            typename field_type::value_type(0xA2504BA7A93075C32F6A51D44200A2E8FB625306AE25EB03730447163025E7BB_cppui256),
+                            typename field_type::value_type(0xB8D550A10D9265571A765DE14913E26B9A6C22E3ECA47658A69173875F7A8D33_cppui256),
+                            typename field_type::value_type(0xDED908E0ED161C307D1790C97073E188541C3AAF586F670D1777B77BFEC3ABEE_cppui256),
+                            typename field_type::value_type(0xD0E0919688E932B64134BF13B346027CD8A7FD0B7D761D04AC24E6436E12E1DF_cppui256),
+                            typename field_type::value_type(0x069C9A59FE7D1452B4EB60B691DBF867544CC4BD9846B8DF6A6544DB9FD28FBE_cppui256),
+                            typename field_type::value_type(0x49C696AD84A3A2CC66D8C6BE3C064ABE8F7137DDF287BE11E27B29CC18DAC2D8_cppui256),
+                            typename field_type::value_type(0xFB7CBEDAE854B6DF578962C7088DDE4B4D0FEC2ACFC3E019BA5CF21DE3A6AEE8_cppui256),
+                            typename field_type::value_type(0xB517A454A13308EB398A7DACBFC1FA8509C10140A96E3E02BB0D8510084AA098_cppui256),
+                            typename field_type::value_type(0x0A3D877D0C1F879A60EA3E2FB0F26FA3A4D48B54692447FD6004B59F4540EFBF_cppui256),
+                            typename field_type::value_type(0xE7FE1A77506AEBC71C42027371D3AC4795F5BBF94BF153888EB8B6730050F080_cppui256),
+                            typename field_type::value_type(0x6A87C46D10E65DAF1DE51E7893CB5838F8EDFB37676496A848C989DA99E9E32B_cppui256),
+                            typename field_type::value_type(0xF8EC14384B5166F67BC22712D8F3E387CC26D27CE093643D6D95ACAA4744BFA1_cppui256),
+                            typename field_type::value_type(0x761134B2113FB9A632368FB269D60F610A637AC5C3900060C6924E6332B65F6D_cppui256),
+                            typename field_type::value_type(0xA019B49AB61C68029B684BEED1B4BC5EB71B993348271EF1C11746E5260AAFF5_cppui256),
+                            typename field_type::value_type(0x5CF47CC5D82A6289AD17385454F78688C2226B31F87A019395C6DD62D5027088_cppui256),
+                            typename field_type::value_type(0x320CFF78DB7BFAE794E74EAD21D4F2E64BE6B1F00F8D99F2F62C3BE93227A4BB_cppui256),
+                            typename field_type::value_type(0xAF9FE8D4072A8692AB7796A254FF62996047237409E2F970581CC906B0F3D2D4_cppui256),
+                            typename field_type::value_type(0x9E02FB86B5061741069F16F419B123085A47FD7BFA47B09505EC3921FA72672F_cppui256),
+                            typename field_type::value_type(0xD622305FEEA9F183265AB8CE550B0C1E11741A026ED5C3DEB24F5D49F4B7502D_cppui256),
+                            typename field_type::value_type(0x68F6B8542783DFEEEB5B06E70CE08FFEFD75F3FA01876BD86A703F10E895DF07_cppui256),
+                            typename field_type::value_type(0xCBE1FEBA92E40CE6FBC8044DFDA45028CF5293D2F310BF7F90C76F8A78712655_cppui256),
+                            typename field_type::value_type(0xE1B40C548C1C0D5FF3CF09CD0E55E541666623F172E992589D10531D80C15FC7_cppui256),
+                            typename field_type::value_type(0x1EA8AAAC3F384FF9F47D811207F4708F00924520DE9BB62417CA84682A318024_cppui256),
+                            typename field_type::value_type(0x3BDFCA7181668F4DE996E6412418A776713B08D6F94C2308E418FA233AA89692_cppui256),
+                            typename field_type::value_type(0x0A721F68565167B849426151AEDA5333C7DC0C6345E2EF1393DBDB431A510308_cppui256),
+                            typename field_type::value_type(0x963E315DBA2A02DF4201BBA7BC72A37EF1E49C2570989E56A25B597E831EBA7E_cppui256),
+                            typename field_type::value_type(0x5C02BA13C84A3935A2A3CB7C52167E11869D0AE5C0D5F13C3DFA4B328E7C79C0_cppui256),
+                            typename field_type::value_type(0xACA8AC95B752105635328552518D9E4FB2393658F89AAE4D079B2342C37EA1D7_cppui256),
+                            typename field_type::value_type(0x7F12C567DD75CC2094304C4B92872189E1EDBFDC413935E9DDEFB1049BA973A2_cppui256),
+                            typename field_type::value_type(0x79CC32165D5941A28C0821207C82521E163C1B41B3D25D4402D58A93ED8D3763_cppui256),
+                            typename field_type::value_type(0x9CF893E8073053D027CC1D59942FFC3EADABC17581D3626B36AAB0F0BC5F6BFC_cppui256),
+                            typename field_type::value_type(0xFA904704DB667C0E206C21AF98D85311A37D669690597FBF5DB2781CD3245B7F_cppui256),
+                            typename field_type::value_type(0x1A1C8C3674A836A42D6FA3ED40F1C189CB9EECD2624F1D47EF833DF14DDF6BEF_cppui256),
+                            typename field_type::value_type(0x6FA2D990059943937BE369478640DA20B3E960FD626F217C6C38BA21348560A9_cppui256),
+                            typename field_type::value_type(0x9EBA0CC3915AC7E83754A352A6985C3AFE39CDABC551C5EEB9609377BAE52757_cppui256),
+                            typename field_type::value_type(0x7F9460A23D474B66C3B41D1793B353D6646BD35404739E0DD34DAB1767EA1F34_cppui256),
+                            typename field_type::value_type(0xD0D516778FB0618769F1F2BF8F076661C6FF815124E34FFC58BEC2CACD9063EC_cppui256),
+                            typename field_type::value_type(0x02292B0887DB3C979F796A57E0321EFC800D59722771BC762E45A0052B8C5BDB_cppui256),
+                            typename field_type::value_type(0x10B668847507E38270CF0501CF4185F634C8F01116662D894BCFE7B5207256F2_cppui256),
+                            typename field_type::value_type(0xDB43E7F84C329E022A60E3646AE0A2A2DE44235B14F77AA0DC5B74C9BDFC0A9D_cppui256),
+                            typename field_type::value_type(0xB0168DA2BE36B591B8A56C814CEF9FA48839047356D2F054F0B1093A9E9AD713_cppui256),
+                            typename field_type::value_type(0xF6A16B6054BF7AC1E01EFCE48208425EEAF7DEB95DAE05A07BCFFB0D1840A484_cppui256),
+                            typename field_type::value_type(0x716C92116B36D29159CF3E324C399409ACDC817C6FE7AE3587DC4E6E638F9111_cppui256),
+                            typename field_type::value_type(0xE9AF3081EE0D21AEB8515E9121FA78980F8F07CE35643A8930BCB1774283808D_cppui256),
+                            typename field_type::value_type(0xA976C8489C47126085AF26550FEF4971976B925115136D19966C2F8E39B39D33_cppui256),
+                            typename field_type::value_type(0x3AFFA9B5CB5E8730995B8A7F7ABCE4BBA45D77FD9B76F4961495C285FFCD7198_cppui256),
+                            typename field_type::value_type(0x2D4D554F8EAC633D75C98089BF7859CD10A58F03876B2F02029F302430EB6635_cppui256),
+                            typename field_type::value_type(0x6EB733632C806980703AC9383BF883590F41395A4E6F8A0A2692F42CAD8426DF_cppui256),
+                            typename field_type::value_type(0x96C56EC117307A9A030E4B2CECC08E8D9252E97C83FE1B833FF759EE200B4267_cppui256),
+                            typename field_type::value_type(0x948F395D3E8454456A3EFDD5AD2652C1BC7C0ED17FF78B361617ACDCDBC10BA4_cppui256),
+                            typename field_type::value_type(0x98BA0006D11AE9B572A41300A1B5A9EF5A63D297FFD0987C1A6B40CA6DA2BE0F_cppui256),
+                            typename field_type::value_type(0x9C39CB60A33D563D2958F49F1B6EE94582F2D7A846967F0DCEC9B4D78E6D8483_cppui256),
+                            typename field_type::value_type(0xF097BF1EE493E51003D196B7BCA16546BBADE52F3DBE436894B3356F6B2C50FB_cppui256),
+                            typename field_type::value_type(0xCBC809AE94D7802F33E8A4EB3B323ED141067A6336FE96A71363784B6C7F27BF_cppui256),
+                            typename field_type::value_type(0xBD9CBB0E18115C85D7AACEB5DFDCDB0507AD4DD8903DAA9AECC69D63CAA30FA6_cppui256),
+                            typename field_type::value_type(0x18F37ACC90EADAD7443768F724013083606D0429674B4DF3F55C31F847A14DDA_cppui256),
+                            typename field_type::value_type(0x2F944BBAAA092C26D7BBFFECEE1BCD0B77D8F7C78A8536CBE22FCDC325AC8364_cppui256),
+                            typename field_type::value_type(0x8BFBEE24C6E5261837151EF349506CF4822C3C1CB43B223BBE5CC18760A81CAD_cppui256),
+                            typename field_type::value_type(0xD75127CAA3409B590CFD289FE71BE1518D9FC8ECACFD23766986B9515FF0013E_cppui256),
+                            typename field_type::value_type(0x5413358C281E79DA4EC5FFEE4772736B98EA18588E0932FB5674E8E8CC7D59BE_cppui256),
+                            typename field_type::value_type(0x680FD4DE969CB024E7C48FD20164515A53E25B15C900B3672D7EA1F6E4F80590_cppui256),
+                            typename field_type::value_type(0x0B1C1B0327FFEC73FEB5C7E72FD64CACDC769CED171B57DDC22849804F58B08E_cppui256),
+                            typename field_type::value_type(0x6E8FB87A8D35412795A16812870A6A7C0D8BEB6CF7B955AA0F1C83ACF5023AB2_cppui256),
+                            typename field_type::value_type(0x4E2FD12691B194F05DCFC1A3C1B85280BED773963A457EA58EB80C9F876051A8_cppui256),
+                            typename field_type::value_type(0x122ABBDBF5F4FBB2371B35A1508A31BCEBB8BAA592C4FE2E6AFEC74FE9CC9005_cppui256),
+                            typename field_type::value_type(0xB8181BC6BADBE124C07879421041E8F176B07B2BD63AFC5CC21115782FB33B93_cppui256),
+                            typename field_type::value_type(0xBB012F5118CCE7CADEEF104BE967DD75F9ACC5B14BF627DC911A5E167A54EAD6_cppui256),
+                            typename field_type::value_type(0x3D9285261122993897566E7430181E25E2FD65F1B1B173747DDA97C55C38D4E4_cppui256),
+                            typename field_type::value_type(0xD32CA0A5D468EAB53FF057035C2869EACC0AB138197ABC7F6FAAEF00C0CCF0D3_cppui256),
+                            typename field_type::value_type(0x5551C1B53B0878EAE3FEDCFBD314C30F0D23B7FE32845DC2D9DE4A8BD4904297_cppui256),
+                            typename field_type::value_type(0x2FAAF850DEF03FFA2DC6F85E00E65A5CF2BE7383DB6967A6DDBDEC1A85153809_cppui256),
+                            typename field_type::value_type(0x3B180E372B902FC3F7C159A25E76DFF891C81B6519BE4E4ED07232580DD7718A_cppui256),
+                            typename field_type::value_type(0xF2B6B117F36B58AAFAA4BC9D2905211E58491156702D14D0726626299AFD82DB_cppui256),
+                            typename field_type::value_type(0x6A9CB41F4E7D95CD6BF7491E6EF96A09274B136A6BEB56C9B1488FE58E2058C2_cppui256),
+                            typename field_type::value_type(0xEDD93D45EC97A96602B907A608A21208050886AA9AA7F367EA95AB2BC86B1495_cppui256),
+                            typename field_type::value_type(0xF352FF0391D69C9F45EF4F4098A83EB2134EC4B274E467D5FA81A51193D3653D_cppui256),
+                            typename field_type::value_type(0x4472626CCB6C5EBD020BD73DFDA6D5055C1995F972C582D079E6678C8A44F28E_cppui256),
+                            typename field_type::value_type(0xE46AE49AAC77CFBB8EABD472366F4340911CDE8A1D8392DF78D15204D94B75A2_cppui256),
+                            typename field_type::value_type(0x9AA6EBEBE5F5335E845017EFFE90F85B816766C987D4A6F44799FD908A81C0D6_cppui256),
+                            typename field_type::value_type(0x670EE471034D8C230AFB45CDBF793CA1F15CF6C2240E0154D661DF1AED4478DA_cppui256),
+                            typename field_type::value_type(0x5CA0C7425BA022CA2546605B138750E81CC3B8160FF24770628FFE4FF4F563F0_cppui256),
+                            typename field_type::value_type(0xDAB5FC7FE5706D90B6AC29ED3F203ADD378C76B944D45159245CDFD17A53CBF5_cppui256),
+                            typename field_type::value_type(0x97F6CC216D0557B45039598FD8B4919787B15173C166C997BF8C1D4B3052FB1A_cppui256),
+                            typename field_type::value_type(0xF50B99B7468810B73A5A7DCF08BD17915C08966A2ECC1E07606304B1A44E8DE3_cppui256),
+                            typename field_type::value_type(0xE2B5061E55F18F0C8789973A2DEDCEBBE975F18D21721E854A3F3BA6DB7F3588_cppui256),
+                            typename field_type::value_type(0x2A148954227198C9B09C743020A46E97D83321FBA27AD800A9103A2D60DC749C_cppui256),
+                            typename field_type::value_type(0xAA215A188974E422EA3C2440A37608C4BEF92DCDC39B6F01F2E1F28FF0FA3CF2_cppui256),
+                            typename field_type::value_type(0x598D7F61A5505770645F30E25139430481D2999182816FA7DDDC6B6B82ACCF8B_cppui256),
+                            typename field_type::value_type(0x9F3121F74F8F2609546C5162B273EBCAD2289A8F353540B91B84673C0F6CB808_cppui256),
+                            typename field_type::value_type(0x0A5A4878F4CC4453CC7A3EC58A642C871EBB7D208E87BDCC1E0CC372DD962ABC_cppui256),
+                            typename field_type::value_type(0xF7148B2288B0DC574D72B14DF29030175832A64C8E50A9FAE85DAABC9E2CC3FA_cppui256),
+                            typename field_type::value_type(0x715A2012F49F4C4D64FD2091541C581013C4EF1B056C9CEA9FB39A5464AA7B3E_cppui256),
+                            typename field_type::value_type(0x5922B3B1AA606C0A1F79288F8A913B62421BC588A88B47D0D9A33944BC7D081D_cppui256),
+                            typename field_type::value_type(0xF8093CA11AC87D03AA74356789578652CB07ADEF81B3E0D685C3FA7018AE2298_cppui256),
+                            typename field_type::value_type(0x32074F216EF49C10B16129EC307E9CF3E4509A0F6DB6006F06C36192D35C93B0_cppui256),
+                            typename field_type::value_type(0x49EC8C5E6AA9B125C409CE897FB87876C71CCB101687ACE4D1BDB697620DB220_cppui256),
+                            typename field_type::value_type(0x99A97D4FE5EA629B3DA9CC34865F5429842C3073E53B9CCE99B8ACA0677338C2_cppui256),
+                            typename field_type::value_type(0xF5E3EFCB5A92F1B320FEB9FBDD6C93FCCECEAF38ED9768E793925B40128AA5CD_cppui256),
+                            typename field_type::value_type(0x76CFA2899BF3DE054E51E2DFEB07BD2B84E0A6F4B110CEC9AB2799C7CEAA0FB4_cppui256),
+                            typename field_type::value_type(0x042531823FF5ED0B0D77F4880DA0B0E07400F246C3CDAA859E1994056037CFB4_cppui256),
+                            typename field_type::value_type(0xC90E8BCCFAE00F7E628CA4D0C8661FACEEA3E4F534EC5DD400B7325ED8775D23_cppui256),
+                            typename field_type::value_type(0xB0D7A6DBED426D40DBAA6C128D47DF6637385A1378241662FD6E1483E66B5A8B_cppui256),
+                            typename field_type::value_type(0xF652634815ABF316FD1C0D687EF4A316239B77371572068BF6C4FB12CC550AE3_cppui256),
+                            typename field_type::value_type(0x27557AA0E30BCA48B1F5E308E8C0E4BDE6409EC8E6A52AF7784F673546C34577_cppui256),
+                            typename field_type::value_type(0x8399C75846105B3B77C8D75A49FD34F318A2CA7374C4380BADFEB9B80416193C_cppui256),
+                            typename field_type::value_type(0x040BF36BDEA2DE0A4542CB5C539A534C68723275964AA5EB9C1A74B282375988_cppui256),
+                            typename field_type::value_type(0xE8B5B2B681DAD75337D16867767EE3C5977ABE33AE04F7F080D2A3D4793301CB_cppui256),
+                            typename field_type::value_type(0x8E687817D25873648E50783BF561D7DECF6C2E50EA95B301EE58FDB6A401F4D3_cppui256),
+                            typename field_type::value_type(0x989CAB886E2C9BFA62F809A0506D3CAE900B96F12EA1912890281E944294D86B_cppui256),
+                            typename field_type::value_type(0xAE3648928593BC5DA2F5127CCEE442F3496DF469A485672BED413AA6D4D4EE9C_cppui256),
+                            typename field_type::value_type(0xBA85F10C8713F5ADB736B39D4B8D57B7ED5BCC4A2D7F35E7CD0ACCCEF9A54FFF_cppui256),
+                            typename field_type::value_type(0x98A41746253E5CF6D1036803CA67DBEE205359FC40EFFE2DC5963DE26D2AA8E6_cppui256),
+                            typename field_type::value_type(0x579AC6947E3463D6B11542F5A2F5CEC9E30217FAAB7ED21969740BED606CF75B_cppui256),
+                            typename field_type::value_type(0x3754E99F0786E2E13D70139BFCD5CE698BE44E3392EB68E10E789E3FF0CDB59D_cppui256),
+                            typename field_type::value_type(0x24C2F87496ADDCBE012F3C27206480DB61019B6F632734F04239C0FFEB6A8499_cppui256),
+                            typename field_type::value_type(0x9BBF06DAD9AB5905E05471CE16D5222C89C2CAA39F26267AC0747129885FBD44_cppui256),
+                            typename field_type::value_type(0x1BCC7FA84DE120A36755DAF30A6F47E8C0D4BDDC15036ED2A3447DFA7A1D3E88_cppui256),
+                            typename field_type::value_type(0xF8EF49B4BBEDF4164ADAAB192FBFB78C90599D29A4C5181F3CE59840D8490005_cppui256),
+                            typename field_type::value_type(0x979E67A7EE97216402BBD77665A4B73A58F2128837DEEE671A462E83BD62AFDE_cppui256),
+                            typename field_type::value_type(0x646FF7F65B3B5BD3429CFB2AE7500EE922758BBAE7860BE08B7AE792B4A7B506_cppui256),
+                            typename field_type::value_type(0xBC112A9D064A18A55A61E331804A8FE8492DFC4FC08E6995C979C1252B36F946_cppui256),
+                            typename field_type::value_type(0xBE63AB41D2C743F01B3A9B22D66D9101FE44D4FC2E04EBA7EDDEEA19F87B338B_cppui256),
+                            typename field_type::value_type(0x1F125F145E22F4758D3021BBB90B353B7053CB7E45930DAF9D212F2591B00A85_cppui256),
+                            typename field_type::value_type(0x7CC0547AA617D39A9D0C1000B27E507EBE60EA2783385A80154B71C9C103B553_cppui256),
+                            typename field_type::value_type(0x7B329EBD2328045ABDD728CB39FC94C400185A0AAC228B7D5799CBA3CD45A526_cppui256),
+                            typename field_type::value_type(0x1516534B9EFE26DEE62280C7EBC5FD4A6BEB2FFE723B53109890459558583600_cppui256),
+                            typename field_type::value_type(0x60E343B6A7CE88EAB0E74299ECAA5C592BAB43C9E74E0C0908428E0CC3A0131B_cppui256),
+                            typename field_type::value_type(0x946851990BC1DB4E0563ED536DAEE15468DA2BDAACF01B81AC2EF45419E717A4_cppui256),
+                            typename field_type::value_type(0xCA5C78420DC591A8B3B8D0E6B2667DC057999590F70ACD9CA75F0FD1B526DEA3_cppui256),
+                            typename field_type::value_type(0xFC1D6F42B05D00E6AEDA82DF286EB6E2578042F6CAEBE72144342466113BD81E_cppui256),
+                            typename field_type::value_type(0x6D2CDF43AC02382A93D74BD97FD76CE63976B531546DC8DC41E3D4415D7EE1EA_cppui256),
+                            typename field_type::value_type(0xB12FADF52943DFA54943FCCB3B7893E796357686C10319E31EAD3233444C0448_cppui256),
+                            typename field_type::value_type(0x02E2459599B0F4ACE96F8F6677B2A6A71D05E70332FC4DF296575E76B369DE57_cppui256),
+                            typename field_type::value_type(0x6054B2225E75B6A4BE2DF29F6CEA3B793BF2D82D8D98B36858627E5E8B47E27B_cppui256),
+                            typename field_type::value_type(0x6E7106F3B190D8EDB0760CD1F574E0F81D789CF5AFAD1987001829E764AE4B62_cppui256),
+                            typename field_type::value_type(0x48388E34F1C5056843255DDA91D8FB3E67EA3399C80D8418F536C45464E9151F_cppui256),
+                            typename field_type::value_type(0xB0EC63ABF4E44E9E6A25339315482BCC99B1411153DE83101BEE49EDCD7A9434_cppui256),
+                            typename field_type::value_type(0x01EE7FC202708CFEB0C2BF930BF33A68AD086D4CE99A11E38D93CA698EB99805_cppui256),
+                            typename field_type::value_type(0x9655CEF01B024882124BE02EF3455711811836EA35BE799B09FD5F4E10EECCAF_cppui256),
+                            typename field_type::value_type(0xDE8E6447AE1453DA5E65DF81050109C9593A0073CA0B2419D7DFB4A58E5B833D_cppui256),
+                            typename field_type::value_type(0x05E1463C150913D8E332288CBD6DE265987E03132901C6C9F0FCC19AA14C5CC7_cppui256),
+                            typename field_type::value_type(0x016CF2EEE40A0EE4CED279A2FDD4B0E94A403A59C9330E24754205712BF6F44E_cppui256),
+                            typename field_type::value_type(0xB8E9CF624EA7D5A8B52E38390DCE53BDAFCF53E490868B9B53225C3F611603A8_cppui256),
+                            typename field_type::value_type(0xB18B12D0A4EC7E9E8E555B4E4E58F385B267473EB871317B3E2593EAC1F7DF48_cppui256),
+                            typename field_type::value_type(0xFF531922A359FB445CEC426BC5ACC33B3C83F7E483D1E55991B3D590E846B546_cppui256),
+                            typename field_type::value_type(0x77B20A912E6B23135066E911891524BC4EFE3560E3E92350B52DEC8F375F2B54_cppui256),
+                            typename field_type::value_type(0xA3DC291825CEA3F7F7B10BFCDD038A72DF623DA1E850E0F1CAA801FCD6CC67FF_cppui256),
+                            typename field_type::value_type(0x0B197A2E1E67A44B5AFB62DE48ADDE6400B60867487CAB5739912513C420924A_cppui256),
+                            typename field_type::value_type(0xA4A03B30F39453E2566F385D67C641FC0F5F54EFB8BFB340B9E53B38D1045A5F_cppui256),
+                            typename field_type::value_type(0x1DE4D76CD10A793B504023D8A4AFBA595C1FDF971D53F9E22378719781868BA1_cppui256),
+                            typename field_type::value_type(0x71821762743848A6BECB359B3ED71DF4988C00B97A4E620DFC55FA88CDDE321B_cppui256),
+                            typename field_type::value_type(0x1F256F8C50AA067710237E11061A94C5E0CE938158FEF2B1C6771B1E117F3422_cppui256),
+                            typename field_type::value_type(0x20D65BF45BA69832756DF03E73032F9D22C6AE055D459464AA1697BA9F4262F0_cppui256),
+                            typename field_type::value_type(0x6EB5732A096496C0CFC407F390D8319A4F12820443A1CF744056283EBBDFB796_cppui256),
+                            typename field_type::value_type(0xD77D1C9326B5938498A505A9FC3CDCE0367F83874BD0AB9A1DFED66913896DCC_cppui256),
+                            typename field_type::value_type(0x43B373D51F0AA42EF3E15132476F4CF0CA1DC00FD49D411E13D7D10640410675_cppui256),
+                            typename field_type::value_type(0xFFEC0D9AB81F710C014A2F9C0B40585B457BF8FB338B97866663ACA459220B1E_cppui256),
+                            typename field_type::value_type(0x76B5E935ECD8F44235BB9BE6C5CA86327C17C2174A125C0EAE2C08A8A2EF15A8_cppui256),
+                            typename field_type::value_type(0x432F257C245CECAF94B887F23072CACC41DB04DB37A5FCFE4986841DEB1B6A5D_cppui256),
+                            typename field_type::value_type(0x0F4B0083ADFC37163651639DEC5DCD854E5DA8BD354CC7031BC52BFB79EDD558_cppui256),
+                            typename field_type::value_type(0x8DC30254CD7247656FAAADFF134CD65937F4721823D4E6563E636C8A8A632321_cppui256),
+                            typename field_type::value_type(0x518C254C3DF2D2B6E08530E06875F6419C6C6F9D39D174F879B2929FFF83AB89_cppui256),
+                            typename field_type::value_type(0xBF8462A0C959430033F1250FC8E2877F1C7347350EBA0EEE9ECAFD1A3594EAD2_cppui256)};
+                };
+
+                constexpr std::size_t const generator_table_params<detail::secp_r1_g1_params<256, forms::short_weierstrass>>::window;
+                constexpr std::size_t const generator_table_params<detail::secp_r1_g1_params<256, forms::short_weierstrass>>::windows_count;
+                constexpr std::array<
+                    typename generator_table_params<detail::secp_r1_g1_params<256, forms::short_weierstrass>>::field_type::value_type,
+                    2 * generator_table_params<detail::secp_r1_g1_params<256, forms::short_weierstrass>>::windows_count *
+                        (std::size_t(1) << (generator_table_params<detail::secp_r1_g1_params<256, forms::short_weierstrass>>::window - 1))> const
+                    generator_table_params<detail::secp_r1_g1_params<256, forms::short_weierstrass>>::table;
+
+            }    // namespace curves
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_SECP_R1_GENERATOR_TABLE_PARAMS_HPP
@@ -37,8 +37,12 @@
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 #include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
 
+#include <boost/assert.hpp>
 #include <boost/type_traits/is_integral.hpp>
 
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
 
 namespace nil {
@@ -61,6 +65,13 @@ namespace nil {
                         constexpr static const modular_params_type modulus_params = policy_type::modulus_params;
                         constexpr static const integral_type modulus = policy_type::modulus;
 
+                        typedef multiprecision::limb_type limb_type;
+                        constexpr static const std::size_t limb_bits = sizeof(limb_type) * 8;
+                        constexpr static const std::size_t limbs_count =
+                            (policy_type::modulus_bits + limb_bits - 1) / limb_bits;
+                        /// Longest input accepted by from_wide_bytes(), two Montgomery words
+                        constexpr static const std::size_t wide_bytes_max = 2 * limbs_count * sizeof(limb_type);
+
                         using data_type = modular_type;
                         data_type data;
 
@@ -91,6 +102,37 @@ namespace nil {
                             return element_fp(1);
                         }
 
+                        /**
+                         * @brief Reduces a big-endian byte string of at most wide_bytes_max bytes modulo p
+                         * without any division, e.g. for hash_to_field or for hashing to a scalar.
+                         *
+                         * With R = 2^(limbs_count * limb_bits) the input is split as hi * R + lo. Each half,
+                         * taken in as raw Montgomery limbs, stands for half * R^{-1}, so one Montgomery
+                         * multiplication by R^2 (resp. R^3) in Montgomery form yields lo (resp. hi * R).
+                         */
+                        template<typename InputIterator>
+                        static element_fp from_wide_bytes(InputIterator first, InputIterator last) {
+                            std::array<std::uint8_t, wide_bytes_max> bytes;
+                            std::size_t size = 0;
+                            for (; first != last; ++first) {
+                                BOOST_ASSERT(size < wide_bytes_max);
+                                bytes[size++] = static_cast<std::uint8_t>(*first);
+                            }
+
+                            std::array<limb_type, 2 * limbs_count> limbs {0};
+                            for (std::size_t i = 0; i < size; ++i) {
+                                const std::size_t weight = size - 1 - i;
+                                limbs[weight / sizeof(limb_type)] |= static_cast<limb_type>(bytes[i])
+                                                                     << (8 * (weight % sizeof(limb_type)));
+                            }
+
+                            element_fp result = from_raw_montgomery_limbs(limbs.data()) * montgomery_r2();
+                            if (size > limbs_count * sizeof(limb_type)) {
+                                result += from_raw_montgomery_limbs(limbs.data() + limbs_count) * montgomery_r3();
+                            }
+                            return result;
+                        }
+
                         constexpr bool is_zero() const {
                             return data == data_type(0, modulus_params);
                         }
@@ -233,6 +275,32 @@ namespace nil {
                             pow(const multiprecision::number<Backend, ExpressionTemplates> &pwr) const {
                             return element_fp(multiprecision::powm(data, pwr));
                         }
+
+                    private:
+                        /// R^2 in Montgomery form, i.e. the element R
+                        static const element_fp &montgomery_r2() {
+                            static const element_fp r = element_fp(2).pow(limbs_count * limb_bits);
+                            return r;
+                        }
+
+                        /// R^3 in Montgomery form, i.e. the element R^2
+                        static const element_fp &montgomery_r3() {
+                            static const element_fp r = montgomery_r2().squared();
+                            return r;
+                        }
+
+                        /// Uses limbs_count limbs as the Montgomery representation as is, without reducing them
+                        /// first. The result is only fit to be the left factor of a product with a reduced element:
+                        /// REDC(a * b) < 2p for any a < R and b < p, and the final conditional subtraction of the
+                        /// Montgomery multiplication brings it below p.
+                        static element_fp from_raw_montgomery_limbs(const limb_type *in) {
+                            element_fp result;
+                            auto &base = result.data.backend().base_data();
+                            base.resize(limbs_count, limbs_count);
+                            std::memcpy(base.limbs(), in, limbs_count * sizeof(limb_type));
+                            base.normalize();
+                            return result;
+                        }
                     };
 
                     template<typename FieldParams>
@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_MONTGOMERY_LIMBS_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_MONTGOMERY_LIMBS_HPP
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /**
+                     * Raw access to the Montgomery representation of field elements. Values are stored as a
+                     * fixed number of native limbs per base field component, least significant limb first,
+                     * so loading is a plain copy without any conversion or reduction.
+                     */
+                    template<typename FieldType, typename = void>
+                    struct montgomery_limbs {
+                        typedef multiprecision::limb_type limb_type;
+                        typedef typename FieldType::value_type value_type;
+
+                        constexpr static const std::size_t limb_bits = sizeof(limb_type) * 8;
+                        constexpr static const std::size_t limbs_count =
+                            (FieldType::modulus_bits + limb_bits - 1) / limb_bits;
+
+                        static inline void store(const value_type &value, limb_type *out) {
+                            const auto &base = value.data.backend().base_data();
+                            const std::size_t size = base.size();
+                            std::memcpy(out, base.limbs(), size * sizeof(limb_type));
+                            std::memset(out + size, 0, (limbs_count - size) * sizeof(limb_type));
+                        }
+
+                        static inline void load(value_type &value, const limb_type *in) {
+                            auto &base = value.data.backend().base_data();
+                            base.resize(limbs_count, limbs_count);
+                            std::memcpy(base.limbs(), in, limbs_count * sizeof(limb_type));
+                            base.normalize();
+                        }
+                    };
+
+                    template<typename FieldType>
+                    struct montgomery_limbs<FieldType, typename std::enable_if<is_extended_field<FieldType>::value>::type> {
+                        typedef multiprecision::limb_type limb_type;
+                        typedef typename FieldType::value_type value_type;
+                        typedef montgomery_limbs<typename FieldType::underlying_field_type> underlying_type;
+
+                        constexpr static const std::size_t data_dimension =
+                            FieldType::arity / FieldType::underlying_field_type::arity;
+                        constexpr static const std::size_t limbs_count = data_dimension * underlying_type::limbs_count;
+
+                        static inline void store(const value_type &value, limb_type *out) {
+                            for (std::size_t i = 0; i < data_dimension; ++i) {
+                                underlying_type::store(value.data[i], out + i * underlying_type::limbs_count);
+                            }
+                        }
+
+                        static inline void load(value_type &value, const limb_type *in) {
+                            for (std::size_t i = 0; i < data_dimension; ++i) {
+                                underlying_type::load(value.data[i], in + i * underlying_type::limbs_count);
+                            }
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_MONTGOMERY_LIMBS_HPP
@@ -0,0 +1,411 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIXED_BASE_TABLE_HPP
+#define CRYPTO3_ALGEBRA_FIXED_BASE_TABLE_HPP
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/fields/detail/montgomery_limbs.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/params.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /** @brief Builds a group element with Z = 1 from affine coordinates x, y.
+                 *  Covers Jacobian and projective short Weierstrass coordinates, and extended twisted
+                 *  Edwards coordinates, where T = x * y.
+                 */
+                template<typename GroupValueType, typename FieldValueType>
+                GroupValueType from_affine_coordinates(const FieldValueType &x, const FieldValueType &y) {
+                    if constexpr (has_t_coordinate<GroupValueType>::value) {
+                        return GroupValueType(x, y, x * y, FieldValueType::one());
+                    } else {
+                        return GroupValueType(x, y, FieldValueType::one());
+                    }
+                }
+
+                /** @brief Coordinates for which from_affine_coordinates and mixed additions are available
+                 */
+                template<typename Coordinates>
+                struct is_fixed_base_table_coordinates
+                    : std::integral_constant<
+                          bool,
+                          std::is_same<Coordinates, curves::coordinates::jacobian>::value ||
+                              std::is_same<Coordinates, curves::coordinates::jacobian_with_a4_0>::value ||
+                              std::is_same<Coordinates, curves::coordinates::jacobian_with_a4_minus_3>::value ||
+                              std::is_same<Coordinates, curves::coordinates::projective>::value ||
+                              std::is_same<Coordinates, curves::coordinates::projective_with_a4_minus_3>::value ||
+                              std::is_same<Coordinates, curves::coordinates::projective_complete_with_a4_0>::value ||
+                              std::is_same<Coordinates, curves::coordinates::projective_complete_with_a4_minus_3>::value ||
+                              std::is_same<Coordinates, curves::coordinates::extended>::value ||
+                              std::is_same<Coordinates, curves::coordinates::extended_with_a_minus_1>::value> { };
+
+                /** @brief Writes affine x, y of each point as raw Montgomery limbs, points one after another,
+                 *  with a single field inversion for all of them (Montgomery's trick). The twisted Edwards
+                 *  identity is written as its affine point (0, 1), short Weierstrass points at infinity as
+                 *  (0, 0), which is on none of the supported curves.
+                 */
+                template<typename FieldType, typename GroupValueType>
+                void store_affine_limbs(const std::vector<GroupValueType> &points,
+                                        typename fields::detail::montgomery_limbs<FieldType>::limb_type *out) {
+                    typedef fields::detail::montgomery_limbs<FieldType> coordinate_limbs;
+                    typedef typename FieldType::value_type field_value_type;
+                    typedef typename GroupValueType::coordinates coordinates;
+                    constexpr bool is_jacobian =
+                        std::is_same<coordinates, curves::coordinates::jacobian>::value ||
+                        std::is_same<coordinates, curves::coordinates::jacobian_with_a4_0>::value ||
+                        std::is_same<coordinates, curves::coordinates::jacobian_with_a4_minus_3>::value;
+                    constexpr std::size_t point_limbs = 2 * coordinate_limbs::limbs_count;
+
+                    std::vector<field_value_type> prefix(points.size());
+                    field_value_type acc = field_value_type::one();
+                    for (std::size_t i = 0; i < points.size(); ++i) {
+                        if (!points[i].is_zero()) {
+                            acc *= points[i].Z;
+                        }
+                        prefix[i] = acc;
+                    }
+
+                    field_value_type acc_inv = acc.inversed();
+                    for (std::size_t i = points.size(); i > 0; --i) {
+                        auto *p = out + (i - 1) * point_limbs;
+                        const GroupValueType &point = points[i - 1];
+                        if (point.is_zero()) {
+                            coordinate_limbs::store(field_value_type::zero(), p);
+                            coordinate_limbs::store(has_t_coordinate<GroupValueType>::value ?
+                                                        field_value_type::one() :
+                                                        field_value_type::zero(),
+                                                    p + coordinate_limbs::limbs_count);
+                            continue;
+                        }
+
+                        const field_value_type z_inv = i > 1 ? acc_inv * prefix[i - 2] : acc_inv;
+                        acc_inv *= point.Z;
+                        if constexpr (is_jacobian) {
+                            const field_value_type z_inv2 = z_inv.squared();
+                            coordinate_limbs::store(point.X * z_inv2, p);
+                            coordinate_limbs::store(point.Y * z_inv2 * z_inv, p + coordinate_limbs::limbs_count);
+                        } else {
+                            coordinate_limbs::store(point.X * z_inv, p);
+                            coordinate_limbs::store(point.Y * z_inv, p + coordinate_limbs::limbs_count);
+                        }
+                    }
+                }
+
+                /**
+                 * Signed fixed-window multiplication by a precomputed base. lookup(i, j) has to return the
+                 * affine point (j + 1) * 2^(window * i) * base with Z = 1, for j < 2^(window - 1).
+                 */
+                template<typename GroupValueType, typename IntegralType, typename Lookup>
+                GroupValueType fixed_base_mul(const IntegralType &scalar, std::size_t window,
+                                              std::size_t windows_count, const Lookup &lookup) {
+                    const std::size_t half = std::size_t(1) << (window - 1);
+
+                    GroupValueType result = GroupValueType::zero();
+                    std::size_t carry = 0;
+                    for (std::size_t i = 0; i < windows_count; ++i) {
+                        std::size_t digit = carry;
+                        for (std::size_t j = 0; j < window; ++j) {
+                            if (multiprecision::bit_test(scalar, i * window + j)) {
+                                digit += std::size_t(1) << j;
+                            }
+                        }
+                        carry = digit > half;
+                        if (digit == 0 || digit == (std::size_t(1) << window)) {
+                            continue;
+                        }
+
+                        const GroupValueType multiple =
+                            carry ? -lookup(i, (std::size_t(1) << window) - digit - 1) : lookup(i, digit - 1);
+
+                        // mixed_add handles O and P == +-Q, the multiples all have Z = 1
+                        result = result.mixed_add(multiple);
+                    }
+
+                    return result;
+                }
+            }    // namespace detail
+
+            template<typename GroupType>
+            struct is_fixed_base_table_supported
+                : detail::is_fixed_base_table_coordinates<typename GroupType::value_type::coordinates> { };
+
+            /** @brief Whether curves::generator_table_params is specialized for the group among the headers
+             *  included so far
+             */
+            template<typename GroupType, typename = void>
+            struct has_generator_table_params : std::false_type { };
+
+            template<typename GroupType>
+            struct has_generator_table_params<
+                GroupType,
+                decltype(void(curves::generator_table_params<typename GroupType::params_type>::table))>
+                : std::true_type { };
+
+            /**
+             * Precomputed multiples of a fixed base for signed fixed-window scalar multiplication.
+             *
+             * For window size w the scalar is split into windows_count signed digits
+             * d_i in [-2^(w - 1), 2^(w - 1)], and the table holds the affine points
+             * j * 2^(w * i) * base for j = 1 .. 2^(w - 1). A multiplication is then windows_count table
+             * lookups and mixed additions, without doublings.
+             *
+             * Points are kept as raw Montgomery limbs in one contiguous buffer that starts with a small
+             * header, which is the serialized format as well. A buffer written by save() may be mapped
+             * into memory and used in place through view() without any deserialization. The format uses
+             * native limbs and byte order, so it is only portable between hosts of the same kind.
+             */
+            template<typename GroupType>
+            class fixed_base_table {
+                static_assert(is_fixed_base_table_supported<GroupType>::value, "unsupported coordinates");
+
+            public:
+                typedef GroupType group_type;
+                typedef typename group_type::value_type value_type;
+                typedef typename group_type::field_type field_type;
+                typedef typename field_type::value_type field_value_type;
+                typedef typename group_type::curve_type::scalar_field_type scalar_field_type;
+                typedef typename scalar_field_type::integral_type integral_type;
+
+                typedef fields::detail::montgomery_limbs<field_type> coordinate_limbs;
+                typedef typename coordinate_limbs::limb_type limb_type;
+
+                constexpr static const std::size_t default_window = 8;
+                constexpr static const std::size_t scalar_bits = scalar_field_type::modulus_bits;
+                constexpr static const std::size_t point_limbs = 2 * coordinate_limbs::limbs_count;
+
+                // "FBT" magic, format version, limb size, window, windows count, limbs per point
+                constexpr static const limb_type magic = 0x464254;
+                constexpr static const limb_type version = 1;
+                constexpr static const std::size_t header_limbs = 6;
+
+            private:
+                std::vector<limb_type> storage;
+                const limb_type *view_data = nullptr;
+                std::size_t view_size = 0;
+
+                static std::size_t windows_count_for(std::size_t window) {
+                    // one extra window takes the carry out of the top digit
+                    return (scalar_bits + window - 1) / window + 1;
+                }
+
+                static std::size_t expected_size(std::size_t window) {
+                    return header_limbs + windows_count_for(window) * (std::size_t(1) << (window - 1)) * point_limbs;
+                }
+
+                static bool is_valid(const limb_type *data, std::size_t size) {
+                    if (size < header_limbs || data[0] != magic || data[1] != version ||
+                        data[2] != sizeof(limb_type) || data[5] != point_limbs || data[3] < 1 || data[3] > 16) {
+                        return false;
+                    }
+                    const std::size_t window = data[3];
+                    return data[4] == windows_count_for(window) && size == expected_size(window);
+                }
+
+                value_type point(std::size_t window_index, std::size_t index) const {
+                    const std::size_t half = std::size_t(1) << (window_size() - 1);
+                    const limb_type *p = data() + header_limbs + (window_index * half + index) * point_limbs;
+                    field_value_type x, y;
+                    coordinate_limbs::load(x, p);
+                    coordinate_limbs::load(y, p + coordinate_limbs::limbs_count);
+                    if (x.is_zero() && y.is_zero()) {
+                        return value_type::zero();
+                    }
+                    return detail::from_affine_coordinates<value_type>(x, y);
+                }
+
+            public:
+                /** @brief Empty table, only useful as a target for assignment
+                 */
+                fixed_base_table() = default;
+
+                explicit fixed_base_table(const value_type &base, std::size_t window = default_window) {
+                    BOOST_ASSERT(window >= 1 && window <= 16);
+
+                    const std::size_t half = std::size_t(1) << (window - 1);
+                    const std::size_t windows_count = windows_count_for(window);
+
+                    storage.resize(expected_size(window));
+                    storage[0] = magic;
+                    storage[1] = version;
+                    storage[2] = sizeof(limb_type);
+                    storage[3] = window;
+                    storage[4] = windows_count;
+                    storage[5] = point_limbs;
+
+                    // Multiples of one window in projective form, normalized with one inversion per window
+                    std::vector<value_type> multiples(half);
+                    value_type window_base = base;
+                    for (std::size_t i = 0; i < windows_count; ++i) {
+                        multiples[0] = window_base;
+                        for (std::size_t j = 1; j < half; ++j) {
+                            multiples[j] = multiples[j - 1] + window_base;
+                        }
+                        detail::store_affine_limbs<field_type>(multiples,
+                                                               storage.data() + header_limbs + i * half * point_limbs);
+                        for (std::size_t j = 0; j < window; ++j) {
+                            window_base = window_base.doubled();
+                        }
+                    }
+                }
+
+                /** @brief Uses an existing serialized table in place, e.g. a mapped file. The memory is not
+                 *  copied and has to outlive the returned table.
+                 *  @return false and an empty table if the buffer does not hold a table for this group
+                 */
+                static std::pair<bool, fixed_base_table> view(const limb_type *data, std::size_t size) {
+                    fixed_base_table result;
+                    if (!is_valid(data, size)) {
+                        return std::make_pair(false, result);
+                    }
+                    result.view_data = data;
+                    result.view_size = size;
+                    return std::make_pair(true, result);
+                }
+
+                static std::pair<bool, fixed_base_table> load(std::istream &is) {
+                    fixed_base_table result;
+                    result.storage.resize(header_limbs);
+                    is.read(reinterpret_cast<char *>(result.storage.data()), header_limbs * sizeof(limb_type));
+                    if (!is || result.storage[3] < 1 || result.storage[3] > 16) {
+                        return std::make_pair(false, fixed_base_table());
+                    }
+
+                    result.storage.resize(expected_size(result.storage[3]));
+                    is.read(reinterpret_cast<char *>(result.storage.data() + header_limbs),
+                            (result.storage.size() - header_limbs) * sizeof(limb_type));
+                    if (!is || !is_valid(result.storage.data(), result.storage.size())) {
+                        return std::make_pair(false, fixed_base_table());
+                    }
+                    return std::make_pair(true, result);
+                }
+
+                void save(std::ostream &os) const {
+                    os.write(reinterpret_cast<const char *>(data()), size() * sizeof(limb_type));
+                }
+
+                const limb_type *data() const {
+                    return view_data ? view_data : storage.data();
+                }
+
+                /** @brief Size of the serialized table in limbs
+                 */
+                std::size_t size() const {
+                    return view_data ? view_size : storage.size();
+                }
+
+                bool empty() const {
+                    return size() == 0;
+                }
+
+                std::size_t window_size() const {
+                    return data()[3];
+                }
+
+                std::size_t windows_count() const {
+                    return data()[4];
+                }
+
+                /** @brief scalar * base
+                 *  @pre scalar < 2^scalar_bits
+                 */
+                value_type mul(const integral_type &scalar) const {
+                    BOOST_ASSERT(!empty());
+                    BOOST_ASSERT(scalar.is_zero() || multiprecision::msb(scalar) < scalar_bits);
+
+                    return detail::fixed_base_mul<value_type>(
+                        scalar, window_size(), windows_count(),
+                        [this](std::size_t i, std::size_t j) { return point(i, j); });
+                }
+
+                value_type mul(const typename scalar_field_type::value_type &scalar) const {
+                    // Leave Montgomery form once, digits are then read with bit_test
+                    return mul(scalar.data.template convert_to<integral_type>());
+                }
+            };
+
+            /** @brief Table for the generator one() of the group, built once on first use
+             */
+            template<typename GroupType>
+            const fixed_base_table<GroupType> &generator_table() {
+                static const fixed_base_table<GroupType> table(GroupType::value_type::one());
+                return table;
+            }
+
+            /** @brief scalar * one() for the group.
+             *  @tparam TableParams compiled-in table of generator multiples, e.g.
+             *  curves::generator_table_params<typename GroupType::params_type> from curves/params/generator,
+             *  so nothing is computed at startup. With void, generator_table() is built on first use.
+             */
+            template<typename GroupType, typename TableParams = void>
+            typename GroupType::value_type
+                mul_generator(const typename GroupType::curve_type::scalar_field_type::integral_type &scalar) {
+                typedef typename GroupType::value_type value_type;
+
+                BOOST_ASSERT(scalar.is_zero() ||
+                             multiprecision::msb(scalar) < GroupType::curve_type::scalar_field_type::modulus_bits);
+
+                if constexpr (std::is_void<TableParams>::value) {
+                    return generator_table<GroupType>().mul(scalar);
+                } else {
+                    static_assert(std::is_same<typename TableParams::field_type, typename GroupType::field_type>::value,
+                                  "generator table of another group");
+
+                    constexpr std::size_t half = std::size_t(1) << (TableParams::window - 1);
+                    return detail::fixed_base_mul<value_type>(
+                        scalar, TableParams::window, TableParams::windows_count, [](std::size_t i, std::size_t j) {
+                            const std::size_t index = 2 * (i * half + j);
+                            return detail::from_affine_coordinates<value_type>(TableParams::table[index],
+                                                                               TableParams::table[index + 1]);
+                        });
+                }
+            }
+
+            template<typename GroupType, typename TableParams = void>
+            typename GroupType::value_type
+                mul_generator(const typename GroupType::curve_type::scalar_field_type::value_type &scalar) {
+                return mul_generator<GroupType, TableParams>(
+                    scalar.data.template convert_to<
+                        typename GroupType::curve_type::scalar_field_type::integral_type>());
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIXED_BASE_TABLE_HPP
@@ -36,6 +36,7 @@
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 
 #include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+#include <nil/crypto3/algebra/raw_marshalling.hpp>
 #include <type_traits>
 
 namespace nil {
@@ -0,0 +1,274 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_CALIBRATION_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_CALIBRATION_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/scalar_digits.hpp>
+#include <nil/crypto3/algebra/multiexp/tuning.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            struct multiexp_calibration_options {
+                /// @brief Multiexps of 2, 4, ..., 2^max_log2_length terms are timed
+                std::size_t max_log2_length = 16;
+                /// @brief Least time spent on one measurement, longer is less noisy
+                double min_seconds = 0.05;
+                /// @brief Largest fixed-base window considered, the built-in tables stop at 22
+                std::size_t max_fixed_base_window = 22;
+            };
+
+            namespace detail {
+                /// @brief Average time of one call of f, repeated for at least min_seconds
+                template<typename Function>
+                double time_per_call_ns(const Function &f, double min_seconds) {
+                    typedef std::chrono::steady_clock clock_type;
+
+                    std::size_t calls = 0;
+                    std::size_t batch = 1;
+                    const auto start = clock_type::now();
+                    double elapsed;
+                    do {
+                        for (std::size_t i = 0; i < batch; ++i) {
+                            f();
+                        }
+                        calls += batch;
+                        batch *= 2;
+                        elapsed = std::chrono::duration<double>(clock_type::now() - start).count();
+                    } while (elapsed < min_seconds);
+
+                    return elapsed * 1e9 / calls;
+                }
+
+                /**
+                 * Threshold table for candidates of cost fixed_i + n * per_term_i for n terms: entry i is where
+                 * candidate i becomes the cheapest, rounded to the nearest integer, 0 if it never is.
+                 */
+                inline std::vector<std::size_t> linear_cost_thresholds(const std::vector<double> &fixed,
+                                                                       const std::vector<double> &per_term) {
+                    std::vector<std::size_t> thresholds(fixed.size(), 0);
+                    for (std::size_t i = 0; i < fixed.size(); ++i) {
+                        double lo = -std::numeric_limits<double>::infinity();
+                        double hi = std::numeric_limits<double>::infinity();
+                        bool never = false;
+                        for (std::size_t j = 0; j < fixed.size(); ++j) {
+                            if (j == i) {
+                                continue;
+                            }
+                            if (per_term[j] == per_term[i]) {
+                                never = never || fixed[j] < fixed[i] || (fixed[j] == fixed[i] && j < i);
+                            } else if (per_term[j] > per_term[i]) {
+                                lo = std::max(lo, (fixed[i] - fixed[j]) / (per_term[j] - per_term[i]));
+                            } else {
+                                hi = std::min(hi, (fixed[j] - fixed[i]) / (per_term[i] - per_term[j]));
+                            }
+                        }
+                        if (!never && lo <= hi && hi >= 1) {
+                            thresholds[i] = lo < 1 ? 1 : std::size_t(std::llround(lo));
+                        }
+                    }
+                    return thresholds;
+                }
+
+                /// @brief Threshold table from the best choice at increasing sampled lengths, made monotone
+                inline std::vector<std::size_t> sampled_thresholds(const std::vector<std::size_t> &lengths,
+                                                                   const std::vector<std::size_t> &best,
+                                                                   std::size_t choices_count) {
+                    std::vector<std::size_t> thresholds(choices_count, 0);
+                    std::size_t current = 0;
+                    for (std::size_t i = 0; i < lengths.size(); ++i) {
+                        if (i == 0 || best[i] > current) {
+                            current = best[i];
+                            // the first sample stands for all shorter lengths too
+                            thresholds[current] = i == 0 ? 1 : lengths[i];
+                        }
+                    }
+                    return thresholds;
+                }
+            }    // namespace detail
+
+            /**
+             * Measures multi-scalar multiplication in GroupType on the running machine and derives a tuning
+             * for it, to be stored with multiexp_tuning::write() and loaded at startup with
+             * load_multiexp_tuning().
+             *
+             * Fixed-base windows follow from the measured costs of an addition and a doubling, as the
+             * built-in tables do. Bucket windows and the method crossovers are timed at lengths 2, 4, ...,
+             * 2^max_log2_length, so they account for the caches of the machine; beyond the largest length
+             * the last choice is kept.
+             */
+            template<typename GroupType>
+            multiexp_tuning calibrate_multiexp(const multiexp_calibration_options &options = {}) {
+                typedef typename GroupType::value_type group_value_type;
+                typedef typename GroupType::curve_type::scalar_field_type scalar_field_type;
+                typedef typename scalar_field_type::value_type scalar_value_type;
+
+                constexpr bool is_short_weierstrass =
+                    std::is_same<typename group_value_type::form, curves::forms::short_weierstrass>::value;
+                const std::size_t scalar_bits = scalar_field_type::value_bits;
+                const std::size_t max_length = std::size_t(1) << options.max_log2_length;
+
+                // random points are expensive, sums of a few of them are as good for timing
+                std::vector<group_value_type> bases;
+                std::vector<scalar_value_type> scalars;
+                for (std::size_t i = 0; i < max_length; ++i) {
+                    bases.push_back(i < 16 ? random_element<GroupType>() : bases[i - 16] + bases[i - 1]);
+                    scalars.push_back(random_element<scalar_field_type>());
+                }
+
+                multiexp_tuning tuning;
+                tuning.base_field_bits = GroupType::field_type::value_bits;
+                tuning.scalar_field_bits = scalar_bits;
+
+                group_value_type sink = bases[0];
+                tuning.addition_ns =
+                    detail::time_per_call_ns([&] { sink = sink + bases[1]; }, options.min_seconds);
+                tuning.doubling_ns = detail::time_per_call_ns([&] { sink = sink.doubled(); }, options.min_seconds);
+
+                // windowed_exp: a table of 2^w points and w doublings per window, then one addition per
+                // window and scalar
+                std::vector<double> fixed, per_term;
+                for (std::size_t w = 1; w <= options.max_fixed_base_window; ++w) {
+                    const double outerc = double((scalar_bits + w - 1) / w);
+                    fixed.push_back(outerc * (std::ldexp(1.0, int(w)) * tuning.addition_ns + w * tuning.doubling_ns));
+                    per_term.push_back(outerc * tuning.addition_ns);
+                }
+                tuning.fixed_base_exp_window_table = detail::linear_cost_thresholds(fixed, per_term);
+
+                std::vector<std::size_t> lengths;
+                for (std::size_t length = 2; length <= max_length; length *= 2) {
+                    lengths.push_back(length);
+                }
+
+                // bucket windows, a few around the operation count estimate
+                std::vector<std::size_t> best_bucket_bits;
+                std::size_t max_bucket_bits = 1;
+                for (std::size_t length : lengths) {
+                    std::size_t estimate = 1;
+                    double estimate_cost = std::numeric_limits<double>::infinity();
+                    for (std::size_t b = 1; b <= 20; ++b) {
+                        const double windows = double((scalar_bits + b) / (b + 1) + 1);
+                        const double cost =
+                            windows * (length + std::ldexp(2.0, int(b))) * tuning.addition_ns +
+                            (windows - 1) * (b + 1) * tuning.doubling_ns;
+                        if (cost < estimate_cost) {
+                            estimate = b;
+                            estimate_cost = cost;
+                        }
+                    }
+
+                    std::size_t best = 0;
+                    double best_time = std::numeric_limits<double>::infinity();
+                    for (std::size_t b = std::max<std::size_t>(estimate, 3) - 2; b <= estimate + 2; ++b) {
+                        const scalar_digits<scalar_field_type> digits(scalars.cbegin(), scalars.cbegin() + length,
+                                                                      b + 1, true);
+                        const double time = detail::time_per_call_ns(
+                            [&] { sink = policies::multiexp_method_BDLO12_signed::process(bases.cbegin(), digits); },
+                            options.min_seconds);
+                        if (time < best_time) {
+                            best = b;
+                            best_time = time;
+                        }
+                    }
+                    best_bucket_bits.push_back(best - 1);
+                    max_bucket_bits = std::max(max_bucket_bits, best);
+                }
+                tuning.bucket_window_table = detail::sampled_thresholds(lengths, best_bucket_bits, max_bucket_bits);
+
+                // crossovers: naive, Bos-Coster, signed buckets, affine buckets, each at its best window
+                enum { naive, bos_coster, pippenger, batched_affine, methods_count };
+                std::vector<bool> active = {true, true, true, is_short_weierstrass};
+                std::vector<std::size_t> best_method;
+                for (std::size_t i = 0; i < lengths.size(); ++i) {
+                    const std::size_t length = lengths[i];
+                    const std::size_t c = best_bucket_bits[i] + 2;
+                    auto prepared = [&] {
+                        return scalar_digits<scalar_field_type>(scalars.cbegin(), scalars.cbegin() + length, c, true);
+                    };
+
+                    std::vector<double> times(methods_count, std::numeric_limits<double>::infinity());
+                    if (active[naive]) {
+                        times[naive] = detail::time_per_call_ns(
+                            [&] {
+                                sink = policies::multiexp_method_naive_plain::process(
+                                    bases.cbegin(), bases.cbegin() + length, scalars.cbegin(),
+                                    scalars.cbegin() + length);
+                            },
+                            options.min_seconds);
+                    }
+                    if (active[bos_coster]) {
+                        times[bos_coster] = detail::time_per_call_ns(
+                            [&] {
+                                sink = policies::multiexp_method_bos_coster::process(
+                                    bases.cbegin(), bases.cbegin() + length, scalars.cbegin(),
+                                    scalars.cbegin() + length);
+                            },
+                            options.min_seconds);
+                    }
+                    times[pippenger] = detail::time_per_call_ns(
+                        [&] { sink = policies::multiexp_method_BDLO12_signed::process(bases.cbegin(), prepared()); },
+                        options.min_seconds);
+                    if constexpr (is_short_weierstrass) {
+                        times[batched_affine] = detail::time_per_call_ns(
+                            [&] {
+                                sink = policies::multiexp_method_batched_affine::process(bases.cbegin(), prepared());
+                            },
+                            options.min_seconds);
+                    }
+
+                    const std::size_t best = std::min_element(times.begin(), times.end()) - times.begin();
+                    best_method.push_back(best);
+                    // methods far behind only fall further back on longer inputs
+                    for (std::size_t m = 0; m < methods_count; ++m) {
+                        if (m != pippenger && times[m] > 4 * times[best]) {
+                            active[m] = false;
+                        }
+                    }
+                }
+
+                const std::vector<std::size_t> crossovers =
+                    detail::sampled_thresholds(lengths, best_method, methods_count);
+                tuning.bos_coster_threshold = crossovers[bos_coster];
+                tuning.pippenger_threshold = crossovers[pippenger];
+                tuning.batched_affine_threshold = crossovers[batched_affine];
+
+                return tuning;
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_CALIBRATION_HPP
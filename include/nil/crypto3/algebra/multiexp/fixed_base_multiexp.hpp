@@ -0,0 +1,412 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_FIXED_BASE_MULTIEXP_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_FIXED_BASE_MULTIEXP_HPP
+
+#include <nil/crypto3/algebra/fixed_base_table.hpp>
+#include <nil/crypto3/algebra/raw_marshalling.hpp>
+#include <nil/crypto3/algebra/fields/detail/montgomery_limbs.hpp>
+#include <nil/crypto3/algebra/multiexp/scalar_digits.hpp>
+#include <nil/crypto3/algebra/multiexp/thread_pool.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            /**
+             * Multi-scalar multiplication against a fixed vector of bases, e.g. the SRS of a polynomial
+             * commitment scheme.
+             *
+             * Scalars are split into W signed c-bit digits, and the table holds the affine points
+             * 2^(k * c) * G_j for k < shifts_count. With shifts_count == W, every digit of every scalar
+             * adds straight into one shared set of 2^(c - 1) buckets, so a multiexp is a single bucket
+             * pass without doublings. A smaller memory budget keeps fewer shifts; the windows are then
+             * processed in rounds of shifts_count, with shifts_count * c doublings between rounds.
+             * Scalar ranges shorter than the bases use the leading bases.
+             *
+             * The storage and serialized format follow fixed_base_table: raw Montgomery limbs in one
+             * buffer behind a small header, usable in place through view(). The header carries a
+             * fingerprint of the group, so a table is never loaded for another curve.
+             */
+            template<typename GroupType>
+            class fixed_base_multiexp {
+                static_assert(is_fixed_base_table_supported<GroupType>::value, "unsupported coordinates");
+
+            public:
+                typedef GroupType group_type;
+                typedef typename group_type::value_type value_type;
+                typedef typename group_type::field_type field_type;
+                typedef typename field_type::value_type field_value_type;
+                typedef typename group_type::curve_type::scalar_field_type scalar_field_type;
+
+                typedef fields::detail::montgomery_limbs<field_type> coordinate_limbs;
+                typedef typename coordinate_limbs::limb_type limb_type;
+
+                constexpr static const std::size_t scalar_bits = scalar_field_type::modulus_bits;
+                constexpr static const std::size_t point_limbs = 2 * coordinate_limbs::limbs_count;
+                constexpr static const std::size_t max_window = 20;
+                // bound on the bases of a loaded table, far above any SRS in use
+                constexpr static const std::size_t max_bases_count = std::numeric_limits<std::uint32_t>::max();
+
+                // "FBM" magic, format version, limb size, group fingerprint, window, windows count, shifts
+                // count, bases count, limbs per point
+                constexpr static const limb_type magic = 0x4d4246;
+                constexpr static const limb_type version = 1;
+                constexpr static const std::size_t header_limbs = 9;
+
+            private:
+                std::vector<limb_type> storage;
+                const limb_type *view_data = nullptr;
+                std::size_t view_size = 0;
+
+                static limb_type type_id() {
+                    return nil::marshalling::raw::detail::group_traits<group_type>::type_id();
+                }
+
+                static std::size_t windows_count_for(std::size_t window) {
+                    // one extra window takes the carry out of the top digit
+                    return (scalar_bits + window - 1) / window + 1;
+                }
+
+                static std::size_t shifts_count_for(std::size_t bases_count, std::size_t window,
+                                                    std::size_t max_bytes) {
+                    const std::size_t windows_count = windows_count_for(window);
+                    if (max_bytes == 0 || bases_count == 0) {
+                        return windows_count;
+                    }
+                    const std::size_t copies = max_bytes / (bases_count * point_limbs * sizeof(limb_type));
+                    return std::min(std::max<std::size_t>(copies, 1), windows_count);
+                }
+
+                /// @brief Window with the fewest group operations per multiexp within the budget
+                static std::size_t best_window(std::size_t bases_count, std::size_t max_bytes) {
+                    std::size_t best = 2;
+                    double best_cost = std::numeric_limits<double>::infinity();
+                    for (std::size_t c = 2; c <= max_window; ++c) {
+                        const std::size_t windows_count = windows_count_for(c);
+                        const std::size_t shifts_count = shifts_count_for(bases_count, c, max_bytes);
+                        const std::size_t rounds = (windows_count + shifts_count - 1) / shifts_count;
+                        const double cost = double(bases_count) * windows_count +
+                                            double(rounds) * (std::size_t(1) << c) +
+                                            double(rounds - 1) * shifts_count * c;
+                        if (cost < best_cost) {
+                            best = c;
+                            best_cost = cost;
+                        }
+                    }
+                    return best;
+                }
+
+                static std::size_t expected_size(std::size_t shifts_count, std::size_t bases_count) {
+                    return header_limbs + shifts_count * bases_count * point_limbs;
+                }
+
+                /// @brief Checks the header alone, including that the table size it implies is representable
+                static bool is_valid_header(const limb_type *data) {
+                    if (data[0] != magic || data[1] != version || data[2] != sizeof(limb_type) ||
+                        data[3] != type_id() || data[8] != point_limbs || data[4] < 2 || data[4] > max_window) {
+                        return false;
+                    }
+                    if (data[5] != windows_count_for(data[4]) || data[6] < 1 || data[6] > data[5] ||
+                        data[7] > max_bases_count) {
+                        return false;
+                    }
+                    // shifts_count <= windows_count is small, so only the product with bases_count can overflow
+                    const std::size_t max_limbs = std::numeric_limits<std::size_t>::max() / sizeof(limb_type);
+                    return std::size_t(data[7]) <= (max_limbs - header_limbs) / (std::size_t(data[6]) * point_limbs);
+                }
+
+                static bool is_valid(const limb_type *data, std::size_t size) {
+                    return size >= header_limbs && is_valid_header(data) &&
+                           size == expected_size(data[6], data[7]);
+                }
+
+                const limb_type *point_data(std::size_t shift, std::size_t index) const {
+                    return data() + header_limbs + (shift * bases_count() + index) * point_limbs;
+                }
+
+                /// @brief 2^(shift * c) * G_index with Z = 1; see detail::store_affine_limbs for the identity
+                value_type point(std::size_t shift, std::size_t index) const {
+                    const limb_type *p = point_data(shift, index);
+                    field_value_type x, y;
+                    coordinate_limbs::load(x, p);
+                    coordinate_limbs::load(y, p + coordinate_limbs::limbs_count);
+                    if (x.is_zero() && y.is_zero()) {
+                        return value_type::zero();
+                    }
+                    return detail::from_affine_coordinates<value_type>(x, y);
+                }
+
+                template<typename InputIterator, typename Runner>
+                void build(InputIterator first, InputIterator last, std::size_t max_bytes, std::size_t window,
+                           const Runner &run) {
+                    const std::size_t bases_count = std::distance(first, last);
+                    if (window == 0) {
+                        window = best_window(bases_count, max_bytes);
+                    }
+                    BOOST_ASSERT(window >= 2 && window <= max_window);
+
+                    const std::size_t shifts_count = shifts_count_for(bases_count, window, max_bytes);
+
+                    storage.resize(expected_size(shifts_count, bases_count));
+                    storage[0] = magic;
+                    storage[1] = version;
+                    storage[2] = sizeof(limb_type);
+                    storage[3] = type_id();
+                    storage[4] = window;
+                    storage[5] = windows_count_for(window);
+                    storage[6] = shifts_count;
+                    storage[7] = bases_count;
+                    storage[8] = point_limbs;
+
+                    const std::size_t chunks_count = std::min<std::size_t>(bases_count, 256);
+                    auto chunk_begin = [&](std::size_t chunk) { return chunk * bases_count / chunks_count; };
+                    run(chunks_count, [&](std::size_t chunk) {
+                        std::vector<value_type> points(std::next(first, chunk_begin(chunk)),
+                                                       std::next(first, chunk_begin(chunk + 1)));
+                        for (std::size_t k = 0; k < shifts_count; ++k) {
+                            if (k > 0) {
+                                for (value_type &point : points) {
+                                    for (std::size_t i = 0; i < window; ++i) {
+                                        point = point.doubled();
+                                    }
+                                }
+                            }
+                            limb_type *out =
+                                storage.data() + header_limbs + (k * bases_count + chunk_begin(chunk)) * point_limbs;
+                            detail::store_affine_limbs<field_type>(points, out);
+                        }
+                    });
+                }
+
+                /// @brief Contribution of the bases [begin, end) to the multiexp, Horner's rule over rounds
+                value_type range_sum(const scalar_digits<scalar_field_type> &digits, std::size_t begin,
+                                     std::size_t end) const {
+                    const std::size_t shifts_count = this->shifts_count();
+                    const std::size_t rounds = (digits.windows_count() + shifts_count - 1) / shifts_count;
+                    const std::size_t buckets_count = std::size_t(1) << (window_size() - 1);
+
+                    value_type result = value_type::zero();
+                    std::vector<value_type> buckets(buckets_count);
+                    for (std::size_t r = rounds; r > 0; --r) {
+                        if (r < rounds) {
+                            for (std::size_t i = 0; i < shifts_count * window_size(); ++i) {
+                                result = result.doubled();
+                            }
+                        }
+
+                        std::fill(buckets.begin(), buckets.end(), value_type::zero());
+                        const std::size_t first_window = (r - 1) * shifts_count;
+                        const std::size_t last_window = std::min(r * shifts_count, digits.windows_count());
+                        for (std::size_t k = first_window; k < last_window; ++k) {
+                            const auto *window_digits = digits.window(k);
+                            for (std::size_t j = begin; j < end; ++j) {
+                                const std::int32_t digit = window_digits[j];
+                                if (digit == 0) {
+                                    continue;
+                                }
+                                const value_type multiple = point(k - first_window, j);
+                                value_type &bucket = buckets[(digit > 0 ? digit : -digit) - 1];
+                                // mixed_add handles O and P == +-Q, the table points all have Z = 1
+                                bucket = bucket.mixed_add(digit > 0 ? multiple : -multiple);
+                            }
+                        }
+
+                        value_type running_sum = value_type::zero();
+                        value_type round_sum = value_type::zero();
+                        for (std::size_t i = buckets_count; i > 0; --i) {
+                            if (!buckets[i - 1].is_zero()) {
+                                running_sum = running_sum + buckets[i - 1];
+                            }
+                            if (!running_sum.is_zero()) {
+                                round_sum = round_sum + running_sum;
+                            }
+                        }
+                        result = result + round_sum;
+                    }
+
+                    return result;
+                }
+
+            public:
+                /** @brief Empty table, only useful as a target for assignment
+                 */
+                fixed_base_multiexp() = default;
+
+                /**
+                 * @param max_bytes bound on the size of the table, 0 for all shifts. One copy of the bases is
+                 * always kept
+                 * @param window digit size c, 0 to pick the one with the fewest operations
+                 */
+                template<typename InputIterator>
+                fixed_base_multiexp(InputIterator first, InputIterator last, std::size_t max_bytes = 0,
+                                    std::size_t window = 0) {
+                    build(first, last, max_bytes, window, [](std::size_t tasks_count, const auto &task) {
+                        for (std::size_t i = 0; i < tasks_count; ++i) {
+                            task(i);
+                        }
+                    });
+                }
+
+                template<typename InputIterator>
+                fixed_base_multiexp(InputIterator first, InputIterator last, std::size_t max_bytes,
+                                    std::size_t window, thread_pool &pool) {
+                    build(first, last, max_bytes, window,
+                          [&pool](std::size_t tasks_count, const auto &task) { pool.run(tasks_count, task); });
+                }
+
+                /** @brief Uses an existing serialized table in place, e.g. a mapped file. The memory is not
+                 *  copied and has to outlive the returned table.
+                 *  @return false and an empty table if the buffer does not hold a table for this group
+                 */
+                static std::pair<bool, fixed_base_multiexp> view(const limb_type *data, std::size_t size) {
+                    fixed_base_multiexp result;
+                    if (!is_valid(data, size)) {
+                        return std::make_pair(false, result);
+                    }
+                    result.view_data = data;
+                    result.view_size = size;
+                    return std::make_pair(true, result);
+                }
+
+                /** @brief Reads a table written by save()
+                 *  @return false and an empty table if the stream does not hold a table for this group. The
+                 *  storage grows with the data actually read, so a forged header cannot force a large
+                 *  allocation.
+                 */
+                static std::pair<bool, fixed_base_multiexp> load(std::istream &is) {
+                    fixed_base_multiexp result;
+                    result.storage.resize(header_limbs);
+                    is.read(reinterpret_cast<char *>(result.storage.data()), header_limbs * sizeof(limb_type));
+                    if (!is || !is_valid_header(result.storage.data())) {
+                        return std::make_pair(false, fixed_base_multiexp());
+                    }
+
+                    const std::size_t size = expected_size(result.storage[6], result.storage[7]);
+                    constexpr std::size_t chunk_limbs = std::size_t(1) << 20;
+                    while (result.storage.size() < size) {
+                        const std::size_t offset = result.storage.size();
+                        const std::size_t count = std::min(size - offset, chunk_limbs);
+                        result.storage.resize(offset + count);
+                        is.read(reinterpret_cast<char *>(result.storage.data() + offset), count * sizeof(limb_type));
+                        if (!is) {
+                            return std::make_pair(false, fixed_base_multiexp());
+                        }
+                    }
+                    return std::make_pair(true, result);
+                }
+
+                void save(std::ostream &os) const {
+                    os.write(reinterpret_cast<const char *>(data()), size() * sizeof(limb_type));
+                }
+
+                const limb_type *data() const {
+                    return view_data ? view_data : storage.data();
+                }
+
+                /** @brief Size of the serialized table in limbs
+                 */
+                std::size_t size() const {
+                    return view_data ? view_size : storage.size();
+                }
+
+                bool empty() const {
+                    return size() == 0;
+                }
+
+                std::size_t window_size() const {
+                    return data()[4];
+                }
+
+                std::size_t windows_count() const {
+                    return data()[5];
+                }
+
+                /// @brief Number of precomputed shifts of the bases, windows_count() for a single round
+                std::size_t shifts_count() const {
+                    return data()[6];
+                }
+
+                std::size_t bases_count() const {
+                    return data()[7];
+                }
+
+                /// @brief sum_j s_j * G_j over the given scalars and as many leading bases
+                /// @throws std::out_of_range if there are more scalars than bases or the table is empty
+                template<typename InputFieldIterator>
+                value_type multiexp(InputFieldIterator first, InputFieldIterator last) const {
+                    if (empty() || std::size_t(std::distance(first, last)) > bases_count()) {
+                        throw std::out_of_range("fixed_base_multiexp: more scalars than bases");
+                    }
+
+                    const scalar_digits<scalar_field_type> digits(first, last, window_size(), true);
+                    return range_sum(digits, 0, digits.size());
+                }
+
+                /**
+                 * @brief Same as above on the pool. The bases are split into ranges with buckets of their
+                 * own, as long as each range is long enough to pay for its bucket reduction; the partial
+                 * sums are added in a fixed order.
+                 */
+                template<typename InputFieldIterator>
+                value_type multiexp(InputFieldIterator first, InputFieldIterator last, thread_pool &pool) const {
+                    if (empty() || std::size_t(std::distance(first, last)) > bases_count()) {
+                        throw std::out_of_range("fixed_base_multiexp: more scalars than bases");
+                    }
+
+                    const scalar_digits<scalar_field_type> digits(first, last, window_size(), true, pool);
+                    const std::size_t length = digits.size();
+                    const std::size_t ranges_count = std::max<std::size_t>(
+                        std::min<std::size_t>(pool.size(), length >> window_size()), 1);
+
+                    std::vector<value_type> partial_sums(ranges_count);
+                    pool.run(ranges_count, [&](std::size_t i) {
+                        partial_sums[i] =
+                            range_sum(digits, i * length / ranges_count, (i + 1) * length / ranges_count);
+                    });
+
+                    value_type result = value_type::zero();
+                    for (const value_type &partial_sum : partial_sums) {
+                        result = result + partial_sum;
+                    }
+                    return result;
+                }
+            };
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_FIXED_BASE_MULTIEXP_HPP
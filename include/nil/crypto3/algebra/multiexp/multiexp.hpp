@@ -27,45 +27,94 @@
 #ifndef CRYPTO3_ALGEBRA_MULTIEXP_HPP
 #define CRYPTO3_ALGEBRA_MULTIEXP_HPP
 
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/scalar_digits.hpp>
+#include <nil/crypto3/algebra/multiexp/thread_pool.hpp>
+#include <nil/crypto3/algebra/multiexp/tuning.hpp>
+#include <nil/crypto3/algebra/fixed_base_table.hpp>
 #include <nil/crypto3/algebra/curves/params.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
+            namespace detail {
+                /** @brief Whether MultiexpMethod parallelises a single process() call on its own, taking the
+                 *  pool as a fifth argument
+                 */
+                template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator,
+                         typename = void>
+                struct is_pool_aware_multiexp_method : std::false_type { };
+
+                template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator>
+                struct is_pool_aware_multiexp_method<
+                    MultiexpMethod, InputBaseIterator, InputFieldIterator,
+                    decltype(void(MultiexpMethod::process(
+                        std::declval<InputBaseIterator>(), std::declval<InputBaseIterator>(),
+                        std::declval<InputFieldIterator>(), std::declval<InputFieldIterator>(),
+                        std::declval<thread_pool &>())))> : std::true_type { };
+            }    // namespace detail
+
+            /**
+             * @brief Multi-scalar multiplication on the given thread pool.
+             *
+             * chunks_count == 1 runs the method on the calling thread only, 0 stands for one chunk per
+             * thread of the pool. Methods that parallelise internally, like BDLO12 over its windows, get the
+             * whole input and the pool. Other methods get the input split into chunks_count ranges which run
+             * concurrently; the partial sums are added in chunk order, so the result does not depend on the
+             * scheduling.
+             */
             template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator>
             typename std::iterator_traits<InputBaseIterator>::value_type
                 multiexp(InputBaseIterator vec_start, InputBaseIterator vec_end, InputFieldIterator scalar_start,
-                         InputFieldIterator scalar_end, const std::size_t chunks_count) {
+                         InputFieldIterator scalar_end, std::size_t chunks_count = 0,
+                         thread_pool &pool = thread_pool::default_pool()) {
 
                 typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
 
                 const std::size_t total_size = std::distance(vec_start, vec_end);
 
-                if ((total_size < chunks_count) || (chunks_count == 1)) {
-                    // no need to split into "chunks_count", can call implementation directly
+                if (chunks_count == 0) {
+                    chunks_count = pool.size();
+                }
+
+                if (chunks_count == 1 || total_size < 2) {
                     return MultiexpMethod::process(vec_start, vec_end, scalar_start, scalar_end);
                 }
 
-                const std::size_t one_chunk_size = total_size / chunks_count;
+                if constexpr (detail::is_pool_aware_multiexp_method<MultiexpMethod, InputBaseIterator,
+                                                                    InputFieldIterator>::value) {
+                    return MultiexpMethod::process(vec_start, vec_end, scalar_start, scalar_end, pool);
+                } else {
+                    if (total_size < chunks_count) {
+                        // no need to split into "chunks_count", can call implementation directly
+                        return MultiexpMethod::process(vec_start, vec_end, scalar_start, scalar_end);
+                    }
 
-                base_value_type result = base_value_type::zero();
+                    const std::size_t one_chunk_size = total_size / chunks_count;
 
-                for (std::size_t i = 0; i < chunks_count; ++i) {
-                    result =
-                        result + MultiexpMethod::process(
-                                     vec_start + i * one_chunk_size,
-                                     (i == chunks_count - 1 ? vec_end : vec_start + (i + 1) * one_chunk_size),
-                                     scalar_start + i * one_chunk_size,
-                                     (i == chunks_count - 1 ? scalar_end : scalar_start + (i + 1) * one_chunk_size));
-                }
+                    std::vector<base_value_type> partial_sums(chunks_count);
+                    pool.run(chunks_count, [&](std::size_t i) {
+                        partial_sums[i] = MultiexpMethod::process(
+                            vec_start + i * one_chunk_size,
+                            (i == chunks_count - 1 ? vec_end : vec_start + (i + 1) * one_chunk_size),
+                            scalar_start + i * one_chunk_size,
+                            (i == chunks_count - 1 ? scalar_end : scalar_start + (i + 1) * one_chunk_size));
+                    });
 
-                return result;
+                    base_value_type result = base_value_type::zero();
+                    for (const base_value_type &partial_sum : partial_sums) {
+                        result = result + partial_sum;
+                    }
+
+                    return result;
+                }
             }
 
             template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator>
@@ -114,25 +163,23 @@ namespace nil {
             template<typename GroupType>
             using window_table = std::vector<std::vector<typename GroupType::value_type>>;
 
+            /// @brief Fixed-base window for num_scalars, from the tuning loaded for GroupType if any
             template<typename GroupType>
             std::size_t get_exp_window_size(const std::size_t num_scalars) {
-                if (curves::multiexp_params<GroupType>::fixed_base_exp_window_table.empty()) {
+                const auto tuning = get_multiexp_tuning<GroupType>();
+                std::size_t window;
+
+                if (tuning && !tuning->fixed_base_exp_window_table.empty()) {
+                    window = multiexp_tuning::window_for(tuning->fixed_base_exp_window_table, num_scalars);
+                } else if (curves::multiexp_params<GroupType>::fixed_base_exp_window_table.empty()) {
 #ifdef LOWMEM
                     return 14;
 #else
                     return 17;
 #endif
-                }
-
-                std::size_t window = 1;
-
-                for (std::size_t i = curves::multiexp_params<GroupType>::fixed_base_exp_window_table.size() - 1; i >= 0;
-                     --i) {
-                    if (curves::multiexp_params<GroupType>::fixed_base_exp_window_table[i] != 0 &&
-                        num_scalars >= curves::multiexp_params<GroupType>::fixed_base_exp_window_table[i]) {
-                        window = i + 1;
-                        break;
-                    }
+                } else {
+                    window = multiexp_tuning::window_for(
+                        curves::multiexp_params<GroupType>::fixed_base_exp_window_table, num_scalars);
                 }
 
 #ifdef LOWMEM
@@ -177,20 +224,17 @@ namespace nil {
                                                         const window_table<GroupType> &powers_of_g,
                                                         const typename FieldType::value_type &pow) {
 
-                typedef typename FieldType::modular_type modular_type;
+                typedef typename FieldType::integral_type integral_type;
 
                 const std::size_t outerc = (scalar_size + window - 1) / window;
-                const modular_type pow_val = pow.data;
+                // out of Montgomery form once, then whole windows straight from the limbs
+                const integral_type pow_val = pow.data.template convert_to<integral_type>();
                 /* exp */
                 typename GroupType::value_type res = powers_of_g[0][0];
 
                 for (std::size_t outer = 0; outer < outerc; ++outer) {
-                    std::size_t inner = 0;
-                    for (std::size_t i = 0; i < window; ++i) {
-                        if (multiprecision::bit_test(pow_val, outer * window + i)) {
-                            inner |= 1u << i;
-                        }
-                    }
+                    const std::size_t inner = detail::window_bits(pow_val.backend().limbs(), pow_val.backend().size(),
+                                                                  outer * window, window);
 
                     res = res + powers_of_g[outer][inner];
                 }
@@ -232,6 +276,22 @@ namespace nil {
                 return res;
             }
 
+            /** @brief Fixed-base exponentiation of a whole range against a precomputed table, e.g. for SRS
+             *  generation. The table can be built once and stored, see fixed_base_table.
+             */
+            template<typename GroupType, typename InputRange>
+            std::vector<typename GroupType::value_type> batch_exp(const fixed_base_table<GroupType> &table,
+                                                                  const InputRange &v) {
+                std::vector<typename GroupType::value_type> res;
+                res.reserve(std::distance(v.begin(), v.end()));
+
+                for (const auto &scalar : v) {
+                    res.emplace_back(table.mul(scalar));
+                }
+
+                return res;
+            }
+
             template<typename GroupType, typename InputRange>
             typename std::enable_if<
                 std::is_same<typename InputRange::value_type, typename GroupType::value_type>::value, void>::type
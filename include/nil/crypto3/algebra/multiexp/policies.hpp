@@ -27,12 +27,21 @@
 #ifndef CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 #define CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
 #include <vector>
 
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 #include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/fixed_base_table.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/multiexp/straus.hpp>
+#include <nil/crypto3/algebra/multiexp/scalar_digits.hpp>
+#include <nil/crypto3/algebra/multiexp/thread_pool.hpp>
+#include <nil/crypto3/algebra/multiexp/tuning.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -88,116 +97,503 @@ namespace nil {
                 };
 
                 /**
-                 * A special case of Pippenger's algorithm from Page 15 of
-                 * Bernstein, Doumen, Lange, Oosterwijk,
-                 * "Faster batch forgery identification", INDOCRYPT 2012
-                 * (https://eprint.iacr.org/2012/549.pdf)
-                 * When compiled with USE_MIXED_ADDITION, assumes input is in special form.
-                 * Requires that base_value_type implements .dbl() (and, if USE_MIXED_ADDITION is defined,
-                 * .to_projective(), .mixed_add(), and batch_to_projective()).
+                 * Straus-Shamir interleaved wNAF multi-exponentiation, one doubling chain shared
+                 * by up to 8 terms at a time. Best suited to the few terms of signature verification,
+                 * where bucket methods do not amortize.
                  */
-                struct multiexp_method_BDLO12 {
+                struct multiexp_method_straus {
                     template<typename InputBaseIterator, typename InputFieldIterator>
                     static inline typename std::iterator_traits<InputBaseIterator>::value_type
-                        process(InputBaseIterator bases,
-                                InputBaseIterator bases_end,
-                                InputFieldIterator exponents,
-                                InputFieldIterator exponents_end) {
-
-                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
-
-                        std::size_t length = std::distance(bases, bases_end);
-                        std::size_t scalars_length = std::distance(exponents, exponents_end);
-
-                        assert(length == scalars_length);
+                        process(InputBaseIterator vec_start,
+                                InputBaseIterator vec_end,
+                                InputFieldIterator scalar_start,
+                                InputFieldIterator scalar_end) {
+                        return straus_multiexp(vec_start, vec_end, scalar_start, scalar_end);
+                    }
+                };
 
-                        // empirically, this seems to be a decent estimate of the optimal value of c
+                namespace detail {
+                    /// @brief Window size for length terms, empirically a decent estimate of the optimal value
+                    inline std::size_t bdlo12_window_size(std::size_t length) {
                         std::size_t log2_length = std::log2(length);
-                        std::size_t c = log2_length - (log2_length / 3 - 2);
-
-                        std::size_t num_bits = 0;
+                        return log2_length - (log2_length / 3 - 2);
+                    }
 
-                        for (std::size_t i = 0; i < length; i++) {
-                            // Should be
-                            // std::size_t bn_exponents_i_msb = multiprecision::msb(exponents[i].data) + 1;
-                            // But multiprecision::msb doesn't work for zero value
-                            std::size_t bn_exponents_i_msb = 1;
-                            if (exponents[i].data != 0) {
-                                bn_exponents_i_msb = multiprecision::msb(exponents[i].data) + 1;
+                    /**
+                     * Driver shared by the bucket methods. Method provides signed_digits, window_size(length),
+                     * prepare_bases(bases, length) and window_sum<BaseValueType>(prepared bases, digits of one
+                     * window, length, c), the driver prepares the scalars, evaluates the windows, serially or on
+                     * a pool, and combines them.
+                     */
+                    template<typename Method>
+                    struct bucket_multiexp {
+                        /// @brief Window for length terms in the group of BaseValueType, from the loaded tuning if any
+                        template<typename BaseValueType>
+                        static inline std::size_t window_size_for(std::size_t length) {
+                            const auto tuning = algebra::detail::multiexp_tuning_slot<BaseValueType>::get();
+                            if (!tuning || tuning->bucket_window_table.empty()) {
+                                return Method::window_size(length);
                             }
-                            num_bits = std::max(num_bits, bn_exponents_i_msb);
+
+                            // the table counts buckets, a signed window has one bit more for as many of them
+                            const std::size_t bucket_bits =
+                                multiexp_tuning::window_for(tuning->bucket_window_table, length);
+                            return Method::signed_digits ? bucket_bits + 1 : bucket_bits;
+                        }
+
+                        /// @brief Scalar digits as Method uses them, reusable for several ranges of bases. Uses the
+                        /// built-in window, construct scalar_digits with window_size_for() for a tuned one
+                        template<typename InputFieldIterator>
+                        static inline scalar_digits<
+                            typename std::iterator_traits<InputFieldIterator>::value_type::field_type>
+                            prepare(InputFieldIterator exponents, InputFieldIterator exponents_end) {
+                            return scalar_digits<
+                                typename std::iterator_traits<InputFieldIterator>::value_type::field_type>(
+                                exponents, exponents_end, Method::window_size(std::distance(exponents, exponents_end)),
+                                Method::signed_digits);
                         }
 
-                        std::size_t num_groups = (num_bits + c - 1) / c;
+                        template<typename InputFieldIterator>
+                        static inline scalar_digits<
+                            typename std::iterator_traits<InputFieldIterator>::value_type::field_type>
+                            prepare(InputFieldIterator exponents, InputFieldIterator exponents_end,
+                                    thread_pool &pool) {
+                            return scalar_digits<
+                                typename std::iterator_traits<InputFieldIterator>::value_type::field_type>(
+                                exponents, exponents_end, Method::window_size(std::distance(exponents, exponents_end)),
+                                Method::signed_digits, pool);
+                        }
 
-                        base_value_type result;
-                        bool result_nonzero = false;
+                        /// @brief sum_k 2^(k * c) * W_k, Horner's rule from the top window down
+                        template<typename BaseValueType>
+                        static inline BaseValueType combine_windows(const std::vector<BaseValueType> &window_sums,
+                                                                    std::size_t c) {
+                            if (window_sums.empty()) {
+                                return BaseValueType::zero();
+                            }
 
-                        for (std::size_t k = num_groups - 1; k <= num_groups; k--) {
-                            if (result_nonzero) {
+                            BaseValueType result = window_sums.back();
+                            for (std::size_t k = window_sums.size() - 1; k > 0; k--) {
                                 for (std::size_t i = 0; i < c; i++) {
                                     result = result.doubled();
                                 }
+                                result = result + window_sums[k - 1];
                             }
+                            return result;
+                        }
 
-                            std::vector<base_value_type> buckets(1 << c);
-                            std::vector<bool> bucket_nonzero(1 << c);
+                        /// @brief Multiexp against scalars prepared with prepare()
+                        template<typename InputBaseIterator, typename FieldType>
+                        static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                            process(InputBaseIterator bases, const scalar_digits<FieldType> &digits) {
 
-                            for (std::size_t i = 0; i < length; i++) {
-                                std::size_t id = 0;
-                                for (std::size_t j = 0; j < c; j++) {
-                                    if (multiprecision::bit_test(exponents[i].data, k * c + j)) {
-                                        id |= 1 << j;
-                                    }
-                                }
+                            typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                            BOOST_ASSERT(digits.is_signed() == Method::signed_digits);
 
-                                if (id == 0) {
-                                    continue;
-                                }
+                            const auto prepared_bases = Method::prepare_bases(bases, digits.size());
 
-                                if (bucket_nonzero[id]) {
+                            std::vector<base_value_type> window_sums;
+                            window_sums.reserve(digits.windows_count());
+                            for (std::size_t k = 0; k < digits.windows_count(); k++) {
+                                window_sums.emplace_back(Method::template window_sum<base_value_type>(
+                                    prepared_bases, digits.window(k), digits.size(), digits.window_size()));
+                            }
+
+                            return combine_windows(window_sums, digits.window_size());
+                        }
+
+                        /**
+                         * @brief Same as above with the windows spread over the pool. Every window is a full
+                         * pass over the input, so all threads contribute even when the input is too small to be
+                         * split by range. The window sums are combined in a fixed order, the result does not
+                         * depend on the number of threads.
+                         */
+                        template<typename InputBaseIterator, typename FieldType>
+                        static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                            process(InputBaseIterator bases, const scalar_digits<FieldType> &digits,
+                                    thread_pool &pool) {
+
+                            typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                            BOOST_ASSERT(digits.is_signed() == Method::signed_digits);
+
+                            const auto prepared_bases = Method::prepare_bases(bases, digits.size());
+
+                            std::vector<base_value_type> window_sums(digits.windows_count());
+                            pool.run(digits.windows_count(), [&](std::size_t k) {
+                                window_sums[k] = Method::template window_sum<base_value_type>(
+                                    prepared_bases, digits.window(k), digits.size(), digits.window_size());
+                            });
+
+                            return combine_windows(window_sums, digits.window_size());
+                        }
+
+                        template<typename InputBaseIterator, typename InputFieldIterator>
+                        static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                            process(InputBaseIterator bases,
+                                    InputBaseIterator bases_end,
+                                    InputFieldIterator exponents,
+                                    InputFieldIterator exponents_end) {
+                            BOOST_ASSERT(std::distance(bases, bases_end) == std::distance(exponents, exponents_end));
+
+                            typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                            typedef typename std::iterator_traits<InputFieldIterator>::value_type::field_type
+                                field_type;
+
+                            return process(bases, scalar_digits<field_type>(
+                                                      exponents, exponents_end,
+                                                      window_size_for<base_value_type>(
+                                                          std::distance(exponents, exponents_end)),
+                                                      Method::signed_digits));
+                        }
+
+                        template<typename InputBaseIterator, typename InputFieldIterator>
+                        static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                            process(InputBaseIterator bases,
+                                    InputBaseIterator bases_end,
+                                    InputFieldIterator exponents,
+                                    InputFieldIterator exponents_end,
+                                    thread_pool &pool) {
+                            BOOST_ASSERT(std::distance(bases, bases_end) == std::distance(exponents, exponents_end));
+
+                            typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                            typedef typename std::iterator_traits<InputFieldIterator>::value_type::field_type
+                                field_type;
+
+                            return process(bases,
+                                           scalar_digits<field_type>(exponents, exponents_end,
+                                                                     window_size_for<base_value_type>(
+                                                                         std::distance(exponents, exponents_end)),
+                                                                     Method::signed_digits, pool),
+                                           pool);
+                        }
+                    };
+                }    // namespace detail
+
+                /**
+                 * A special case of Pippenger's algorithm from Page 15 of
+                 * Bernstein, Doumen, Lange, Oosterwijk,
+                 * "Faster batch forgery identification", INDOCRYPT 2012
+                 * (https://eprint.iacr.org/2012/549.pdf)
+                 * When compiled with USE_MIXED_ADDITION, assumes input is in special form.
+                 * Requires that base_value_type implements .dbl() (and, if USE_MIXED_ADDITION is defined,
+                 * .to_projective(), .mixed_add(), and batch_to_projective()).
+                 */
+                struct multiexp_method_BDLO12 : detail::bucket_multiexp<multiexp_method_BDLO12> {
+                    constexpr static const bool signed_digits = false;
+
+                    static inline std::size_t window_size(std::size_t length) {
+                        return detail::bdlo12_window_size(length);
+                    }
+
+                    template<typename InputBaseIterator>
+                    static inline InputBaseIterator prepare_bases(InputBaseIterator bases, std::size_t) {
+                        return bases;
+                    }
+
+                    /// @brief sum_j j * B_j over the 2^c buckets of one window
+                    template<typename BaseValueType, typename InputBaseIterator>
+                    static inline BaseValueType window_sum(InputBaseIterator bases, const std::int32_t *digits,
+                                                           std::size_t length, std::size_t c) {
+                        std::vector<BaseValueType> buckets(1 << c);
+                        std::vector<bool> bucket_nonzero(1 << c);
+
+                        for (std::size_t i = 0; i < length; i++) {
+                            const std::size_t id = digits[i];
+                            if (id == 0) {
+                                continue;
+                            }
+
+                            if (bucket_nonzero[id]) {
 #ifdef USE_MIXED_ADDITION
-                                    buckets[id] = buckets[id].mixed_add(bases[i]);
+                                buckets[id] = buckets[id].mixed_add(bases[i]);
 #else
-                                    buckets[id] = buckets[id] + bases[i];
+                                buckets[id] = buckets[id] + bases[i];
 #endif
-                                } else {
-                                    buckets[id] = bases[i];
-                                    bucket_nonzero[id] = true;
-                                }
+                            } else {
+                                buckets[id] = bases[i];
+                                bucket_nonzero[id] = true;
                             }
+                        }
 
 #ifdef USE_MIXED_ADDITION
-                            batch_to_special(buckets);
+                        batch_to_special(buckets);
 #endif
 
-                            base_value_type running_sum;
-                            bool running_sum_nonzero = false;
+                        BaseValueType result = BaseValueType::zero();
+                        BaseValueType running_sum;
+                        bool running_sum_nonzero = false;
 
-                            for (std::size_t i = (1u << c) - 1; i > 0; i--) {
-                                if (bucket_nonzero[i]) {
-                                    if (running_sum_nonzero) {
+                        for (std::size_t i = (1u << c) - 1; i > 0; i--) {
+                            if (bucket_nonzero[i]) {
+                                if (running_sum_nonzero) {
 #ifdef USE_MIXED_ADDITION
-                                        running_sum = running_sum.mixed_add(buckets[i]);
+                                    running_sum = running_sum.mixed_add(buckets[i]);
 #else
-                                        running_sum = running_sum + buckets[i];
+                                    running_sum = running_sum + buckets[i];
 #endif
-                                    } else {
-                                        running_sum = buckets[i];
-                                        running_sum_nonzero = true;
-                                    }
+                                } else {
+                                    running_sum = buckets[i];
+                                    running_sum_nonzero = true;
                                 }
+                            }
+
+                            if (running_sum_nonzero) {
+                                result = result + running_sum;
+                            }
+                        }
+
+                        return result;
+                    }
+                };
 
+                /**
+                 * Pippenger with signed c-bit digits in [-2^(c - 1), 2^(c - 1)]. A negative digit adds the
+                 * negated base to the bucket of its absolute value, so a window needs 2^(c - 1) buckets
+                 * instead of 2^c. For the same memory as BDLO12 the window is one bit wider, which saves a
+                 * window worth of bucket reductions. The top window takes the final carry.
+                 */
+                struct multiexp_method_BDLO12_signed : detail::bucket_multiexp<multiexp_method_BDLO12_signed> {
+                    constexpr static const bool signed_digits = true;
+
+                    /// @brief One bit more than BDLO12 for the same number of buckets
+                    static inline std::size_t window_size(std::size_t length) {
+                        return std::max<std::size_t>(detail::bdlo12_window_size(length) + 1, 2);
+                    }
+
+                    template<typename InputBaseIterator>
+                    static inline InputBaseIterator prepare_bases(InputBaseIterator bases, std::size_t) {
+                        return bases;
+                    }
+
+                    /// @brief sum_j j * B_j over the 2^(c - 1) buckets of one window
+                    template<typename BaseValueType, typename InputBaseIterator>
+                    static inline BaseValueType window_sum(InputBaseIterator bases, const std::int32_t *digits,
+                                                           std::size_t length, std::size_t c) {
+                        const std::size_t buckets_count = std::size_t(1) << (c - 1);
+                        std::vector<BaseValueType> buckets(buckets_count);
+                        std::vector<bool> bucket_nonzero(buckets_count);
+
+                        for (std::size_t i = 0; i < length; i++) {
+                            const std::int32_t digit = digits[i];
+                            if (digit == 0) {
+                                continue;
+                            }
+
+                            const std::size_t id = (digit > 0 ? digit : -digit) - 1;
+                            if (bucket_nonzero[id]) {
+                                buckets[id] = digit > 0 ? buckets[id] + bases[i] : buckets[id] - bases[i];
+                            } else {
+                                buckets[id] = digit > 0 ? bases[i] : -bases[i];
+                                bucket_nonzero[id] = true;
+                            }
+                        }
+
+                        BaseValueType result = BaseValueType::zero();
+                        BaseValueType running_sum;
+                        bool running_sum_nonzero = false;
+
+                        for (std::size_t i = buckets_count; i > 0; i--) {
+                            if (bucket_nonzero[i - 1]) {
                                 if (running_sum_nonzero) {
-                                    if (result_nonzero) {
-                                        result = result + running_sum;
-                                    } else {
-                                        result = running_sum;
-                                        result_nonzero = true;
-                                    }
+                                    running_sum = running_sum + buckets[i - 1];
+                                } else {
+                                    running_sum = buckets[i - 1];
+                                    running_sum_nonzero = true;
+                                }
+                            }
+
+                            if (running_sum_nonzero) {
+                                result = result + running_sum;
+                            }
+                        }
+
+                        return result;
+                    }
+                };
+
+                /**
+                 * Signed-digit Pippenger with the bucket accumulation done in affine coordinates.
+                 *
+                 * The bases are brought to affine form once with a batched inversion. Within a window,
+                 * independent bucket additions are collected into batches of batch_size and evaluated with
+                 * the affine formulas, sharing one inversion per batch (Montgomery's trick): about 6
+                 * multiplications per addition instead of 11 or more for projective additions. An addition
+                 * whose bucket already takes part in the open batch goes to a per-bucket projective
+                 * accumulator instead, as do additions of a point to itself or to its negation, which would
+                 * need a doubling. Each window is a single pass over the points, so scalars sharing a digit,
+                 * e.g. 0/1 witnesses, cost projective additions rather than extra passes and inversions.
+                 *
+                 * Only for short Weierstrass curves.
+                 */
+                struct multiexp_method_batched_affine : detail::bucket_multiexp<multiexp_method_batched_affine> {
+                    constexpr static const bool signed_digits = true;
+                    constexpr static const std::size_t batch_size = 512;
+
+                    static inline std::size_t window_size(std::size_t length) {
+                        return std::max<std::size_t>(detail::bdlo12_window_size(length) + 1, 2);
+                    }
+
+                    template<typename FieldValueType>
+                    struct affine_points {
+                        std::vector<FieldValueType> x;
+                        std::vector<FieldValueType> y;
+                        std::vector<bool> nonzero;
+                    };
+
+                    /// @brief Affine coordinates of all bases with a single inversion, shared by all windows
+                    template<typename InputBaseIterator>
+                    static inline affine_points<typename std::iterator_traits<
+                        InputBaseIterator>::value_type::field_type::value_type>
+                        prepare_bases(InputBaseIterator bases, std::size_t length) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                        static_assert(
+                            std::is_same<typename base_value_type::form, curves::forms::short_weierstrass>::value,
+                            "affine bucket additions are for short Weierstrass curves");
+                        typedef typename base_value_type::field_type::value_type field_value_type;
+                        typedef typename base_value_type::coordinates coordinates;
+
+                        constexpr bool is_jacobian =
+                            std::is_same<coordinates, curves::coordinates::jacobian>::value ||
+                            std::is_same<coordinates, curves::coordinates::jacobian_with_a4_0>::value ||
+                            std::is_same<coordinates, curves::coordinates::jacobian_with_a4_minus_3>::value;
+
+                        affine_points<field_value_type> result;
+                        result.x.resize(length);
+                        result.y.resize(length);
+                        result.nonzero.resize(length);
+
+                        std::vector<field_value_type> prefix(length);
+                        field_value_type acc = field_value_type::one();
+                        for (std::size_t i = 0; i < length; i++) {
+                            result.nonzero[i] = !bases[i].is_zero();
+                            if (result.nonzero[i]) {
+                                acc *= bases[i].Z;
+                            }
+                            prefix[i] = acc;
+                        }
+
+                        field_value_type acc_inv = acc.inversed();
+                        for (std::size_t i = length; i > 0; i--) {
+                            if (!result.nonzero[i - 1]) {
+                                continue;
+                            }
+                            const base_value_type &base = bases[i - 1];
+                            const field_value_type z_inv = i > 1 ? acc_inv * prefix[i - 2] : acc_inv;
+                            acc_inv *= base.Z;
+
+                            if constexpr (is_jacobian) {
+                                const field_value_type z_inv2 = z_inv.squared();
+                                result.x[i - 1] = base.X * z_inv2;
+                                result.y[i - 1] = base.Y * z_inv2 * z_inv;
+                            } else {
+                                result.x[i - 1] = base.X * z_inv;
+                                result.y[i - 1] = base.Y * z_inv;
+                            }
+                        }
+
+                        return result;
+                    }
+
+                    /// @brief sum_j j * B_j over the 2^(c - 1) buckets of one window, see above
+                    template<typename BaseValueType, typename FieldValueType>
+                    static inline BaseValueType window_sum(const affine_points<FieldValueType> &points,
+                                                           const std::int32_t *digits, std::size_t length,
+                                                           std::size_t c) {
+                        const std::size_t buckets_count = std::size_t(1) << (c - 1);
+
+                        std::vector<FieldValueType> bucket_x(buckets_count);
+                        std::vector<FieldValueType> bucket_y(buckets_count);
+                        std::vector<bool> bucket_nonzero(buckets_count);
+                        std::vector<BaseValueType> extra(buckets_count);
+                        std::vector<bool> extra_nonzero(buckets_count);
+                        // last batch a bucket takes part in, batches are numbered from 1
+                        std::vector<std::size_t> bucket_batch(buckets_count, 0);
+                        std::size_t batch_index = 1;
+
+                        std::vector<std::size_t> batch;
+                        std::vector<FieldValueType> batch_y;
+                        std::vector<FieldValueType> prefix;
+                        batch.reserve(batch_size);
+                        batch_y.reserve(batch_size);
+                        prefix.reserve(batch_size);
+
+                        auto bucket_of = [&](std::size_t i) {
+                            return std::size_t(digits[i] > 0 ? digits[i] : -digits[i]) - 1;
+                        };
+
+                        auto flush = [&]() {
+                            if (batch.empty()) {
+                                return;
+                            }
+
+                            // Montgomery's trick over the denominators x_P - x_B
+                            prefix.clear();
+                            FieldValueType acc = FieldValueType::one();
+                            for (std::size_t j = 0; j < batch.size(); j++) {
+                                acc *= points.x[batch[j]] - bucket_x[bucket_of(batch[j])];
+                                prefix.push_back(acc);
+                            }
+
+                            FieldValueType acc_inv = acc.inversed();
+                            for (std::size_t j = batch.size(); j > 0; j--) {
+                                const std::size_t i = batch[j - 1];
+                                const std::size_t id = bucket_of(i);
+                                const FieldValueType dx = points.x[i] - bucket_x[id];
+                                const FieldValueType dx_inv = j > 1 ? acc_inv * prefix[j - 2] : acc_inv;
+                                acc_inv *= dx;
+
+                                const FieldValueType lambda = (batch_y[j - 1] - bucket_y[id]) * dx_inv;
+                                const FieldValueType x3 = lambda.squared() - bucket_x[id] - points.x[i];
+                                bucket_y[id] = lambda * (bucket_x[id] - x3) - bucket_y[id];
+                                bucket_x[id] = x3;
+                            }
+
+                            batch.clear();
+                            batch_y.clear();
+                            ++batch_index;
+                        };
+
+                        for (std::size_t i = 0; i < length; i++) {
+                            if (digits[i] == 0 || !points.nonzero[i]) {
+                                continue;
+                            }
+                            const std::size_t id = bucket_of(i);
+                            const FieldValueType y = digits[i] > 0 ? points.y[i] : -points.y[i];
+
+                            if (!bucket_nonzero[id]) {
+                                bucket_x[id] = points.x[i];
+                                bucket_y[id] = y;
+                                bucket_nonzero[id] = true;
+                            } else if (bucket_batch[id] == batch_index || bucket_x[id] == points.x[i]) {
+                                // the bucket is busy in the open batch, or P == +-B would need a doubling
+                                const BaseValueType p =
+                                    algebra::detail::from_affine_coordinates<BaseValueType>(points.x[i], y);
+                                extra[id] = extra_nonzero[id] ? extra[id] + p : p;
+                                extra_nonzero[id] = true;
+                            } else {
+                                bucket_batch[id] = batch_index;
+                                batch.push_back(i);
+                                batch_y.push_back(y);
+                                if (batch.size() == batch_size) {
+                                    flush();
                                 }
                             }
                         }
+                        flush();
+
+                        BaseValueType result = BaseValueType::zero();
+                        BaseValueType running_sum = BaseValueType::zero();
+                        for (std::size_t i = buckets_count; i > 0; i--) {
+                            if (bucket_nonzero[i - 1]) {
+                                running_sum = running_sum + algebra::detail::from_affine_coordinates<BaseValueType>(
+                                                                bucket_x[i - 1], bucket_y[i - 1]);
+                            }
+                            if (extra_nonzero[i - 1]) {
+                                running_sum = running_sum + extra[i - 1];
+                            }
+                            result = result + running_sum;
+                        }
 
                         return result;
                     }
@@ -321,6 +717,73 @@ namespace nil {
                         return opt_result;
                     }
                 };
+
+                /**
+                 * Picks the method by the number of terms, from the crossovers of the tuning loaded for the
+                 * group (see multiexp_tuning), or from conservative defaults when there is none. The affine
+                 * bucket method is only considered for short Weierstrass curves.
+                 */
+                struct multiexp_method_tuned {
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator vec_start,
+                                InputBaseIterator vec_end,
+                                InputFieldIterator scalar_start,
+                                InputFieldIterator scalar_end) {
+                        return dispatch(vec_start, vec_end, scalar_start, scalar_end, nullptr);
+                    }
+
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator vec_start,
+                                InputBaseIterator vec_end,
+                                InputFieldIterator scalar_start,
+                                InputFieldIterator scalar_end,
+                                thread_pool &pool) {
+                        return dispatch(vec_start, vec_end, scalar_start, scalar_end, &pool);
+                    }
+
+                private:
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        dispatch(InputBaseIterator vec_start,
+                                 InputBaseIterator vec_end,
+                                 InputFieldIterator scalar_start,
+                                 InputFieldIterator scalar_end,
+                                 thread_pool *pool) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+
+                        const std::size_t length = std::distance(vec_start, vec_end);
+                        const auto loaded = algebra::detail::multiexp_tuning_slot<base_value_type>::get();
+                        const multiexp_tuning tuning = loaded ? *loaded : multiexp_tuning();
+
+                        auto takes_over = [length](std::size_t threshold) {
+                            return threshold != 0 && length >= threshold;
+                        };
+
+                        if constexpr (std::is_same<typename base_value_type::form,
+                                                   curves::forms::short_weierstrass>::value) {
+                            if (takes_over(tuning.batched_affine_threshold)) {
+                                return pool ? multiexp_method_batched_affine::process(vec_start, vec_end, scalar_start,
+                                                                                      scalar_end, *pool) :
+                                              multiexp_method_batched_affine::process(vec_start, vec_end, scalar_start,
+                                                                                      scalar_end);
+                            }
+                        }
+                        if (takes_over(tuning.pippenger_threshold) || takes_over(tuning.batched_affine_threshold)) {
+                            return pool ? multiexp_method_BDLO12_signed::process(vec_start, vec_end, scalar_start,
+                                                                                 scalar_end, *pool) :
+                                          multiexp_method_BDLO12_signed::process(vec_start, vec_end, scalar_start,
+                                                                                 scalar_end);
+                        }
+                        // short inputs, not worth spreading over threads
+                        if (takes_over(tuning.bos_coster_threshold)) {
+                            return multiexp_method_bos_coster::process(vec_start, vec_end, scalar_start, scalar_end);
+                        }
+                        return multiexp_method_naive_plain::process(vec_start, vec_end, scalar_start, scalar_end);
+                    }
+                };
             }    // namespace policies
         }        // namespace algebra
     }            // namespace crypto3
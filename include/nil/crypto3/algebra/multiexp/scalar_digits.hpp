@@ -0,0 +1,191 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_SCALAR_DIGITS_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_SCALAR_DIGITS_HPP
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/multiexp/thread_pool.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /** @brief Bits [offset, offset + c) of a little-endian limb array, c < limb bits
+                 */
+                template<typename LimbType>
+                inline std::size_t window_bits(const LimbType *limbs, std::size_t limbs_count, std::size_t offset,
+                                               std::size_t c) {
+                    constexpr std::size_t limb_bits = sizeof(LimbType) * 8;
+                    const std::size_t index = offset / limb_bits;
+                    const std::size_t shift = offset % limb_bits;
+                    if (index >= limbs_count) {
+                        return 0;
+                    }
+
+                    LimbType value = limbs[index] >> shift;
+                    if (shift + c > limb_bits && index + 1 < limbs_count) {
+                        value |= limbs[index + 1] << (limb_bits - shift);
+                    }
+                    return static_cast<std::size_t>(value & ((LimbType(1) << c) - 1));
+                }
+            }    // namespace detail
+
+            /**
+             * Window digits of a range of scalars, computed once and shared by all windows of a bucket
+             * multiexp and by several multiexps over the same scalars, e.g. against G1 and G2 bases.
+             *
+             * Every scalar is converted from Montgomery form to canonical limbs once, then cut into c-bit
+             * digits, either unsigned in [0, 2^c) or signed in [-2^(c - 1), 2^(c - 1)]. Digits are stored
+             * window-major, so the digits of window k for all scalars are one contiguous array. Signed
+             * digits take one extra window for the final carry. Both stages run over chunks of scalars on
+             * the pool when one is given.
+             */
+            template<typename FieldType>
+            class scalar_digits {
+            public:
+                typedef FieldType field_type;
+                typedef typename field_type::value_type field_value_type;
+                typedef typename field_type::integral_type integral_type;
+                typedef multiprecision::limb_type limb_type;
+                typedef std::int32_t digit_type;
+
+                constexpr static const std::size_t limb_bits = sizeof(limb_type) * 8;
+                constexpr static const std::size_t limbs_count = (field_type::modulus_bits + limb_bits - 1) / limb_bits;
+
+                scalar_digits() = default;
+
+                template<typename InputFieldIterator>
+                scalar_digits(InputFieldIterator first, InputFieldIterator last, std::size_t window, bool is_signed) {
+                    init(first, last, window, is_signed, [](std::size_t tasks_count, const auto &task) {
+                        for (std::size_t i = 0; i < tasks_count; ++i) {
+                            task(i);
+                        }
+                    });
+                }
+
+                template<typename InputFieldIterator>
+                scalar_digits(InputFieldIterator first, InputFieldIterator last, std::size_t window, bool is_signed,
+                              thread_pool &pool) {
+                    init(first, last, window, is_signed,
+                         [&pool](std::size_t tasks_count, const auto &task) { pool.run(tasks_count, task); });
+                }
+
+                /// @brief Number of scalars
+                std::size_t size() const {
+                    return scalars_count;
+                }
+
+                std::size_t window_size() const {
+                    return c;
+                }
+
+                std::size_t windows_count() const {
+                    return num_windows;
+                }
+
+                bool is_signed() const {
+                    return signed_digits;
+                }
+
+                /// @brief Digits of window k, one per scalar
+                const digit_type *window(std::size_t k) const {
+                    BOOST_ASSERT(k < num_windows);
+                    return digits.data() + k * scalars_count;
+                }
+
+            private:
+                template<typename InputFieldIterator, typename Runner>
+                void init(InputFieldIterator first, InputFieldIterator last, std::size_t window, bool is_signed,
+                          const Runner &run) {
+                    BOOST_ASSERT(window >= 1 && window < 31 && window < limb_bits);
+
+                    c = window;
+                    signed_digits = is_signed;
+                    scalars_count = std::distance(first, last);
+
+                    const std::size_t chunks_count = std::min<std::size_t>(scalars_count, 256);
+                    auto chunk_begin = [&](std::size_t chunk) { return chunk * scalars_count / chunks_count; };
+
+                    // canonical limbs, once per scalar
+                    std::vector<limb_type> limbs(scalars_count * limbs_count, 0);
+                    std::vector<std::size_t> chunk_bits(chunks_count, 0);
+                    run(chunks_count, [&](std::size_t chunk) {
+                        InputFieldIterator it = std::next(first, chunk_begin(chunk));
+                        for (std::size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i, ++it) {
+                            const integral_type value = it->data.template convert_to<integral_type>();
+                            if (value.is_zero()) {
+                                continue;
+                            }
+                            std::memcpy(limbs.data() + i * limbs_count, value.backend().limbs(),
+                                        std::min<std::size_t>(value.backend().size(), limbs_count) * sizeof(limb_type));
+                            chunk_bits[chunk] =
+                                std::max<std::size_t>(chunk_bits[chunk], multiprecision::msb(value) + 1);
+                        }
+                    });
+
+                    const std::size_t num_bits = std::max<std::size_t>(
+                        chunks_count ? *std::max_element(chunk_bits.begin(), chunk_bits.end()) : 0, 1);
+                    num_windows = (num_bits + c - 1) / c + (signed_digits ? 1 : 0);
+
+                    digits.assign(num_windows * scalars_count, 0);
+                    const digit_type full = digit_type(1) << c;
+                    const digit_type half = full >> 1;
+                    run(chunks_count, [&](std::size_t chunk) {
+                        for (std::size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+                            const limb_type *scalar = limbs.data() + i * limbs_count;
+                            digit_type carry = 0;
+                            for (std::size_t k = 0; k < num_windows; ++k) {
+                                digit_type digit =
+                                    carry + static_cast<digit_type>(detail::window_bits(scalar, limbs_count, k * c, c));
+                                if (signed_digits) {
+                                    carry = digit > half;
+                                    digit = carry ? digit - full : digit;
+                                }
+                                digits[k * scalars_count + i] = digit;
+                            }
+                        }
+                    });
+                }
+
+                std::vector<digit_type> digits;
+                std::size_t scalars_count = 0;
+                std::size_t num_windows = 0;
+                std::size_t c = 0;
+                bool signed_digits = false;
+            };
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_SCALAR_DIGITS_HPP
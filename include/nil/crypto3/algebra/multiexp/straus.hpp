@@ -0,0 +1,164 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_STRAUS_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_STRAUS_HPP
+
+#include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/fixed_base_table.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /**
+                 * Number of terms evaluated over one shared doubling chain. Every term keeps its own table of
+                 * odd multiples, so beyond a handful of terms bucket methods are cheaper.
+                 */
+                constexpr static const std::size_t straus_max_terms = 8;
+
+                /**
+                 * Largest window of a single term. Tables are per term, so the optimum is one below the
+                 * single-scalar wNAF window for common scalar sizes.
+                 */
+                constexpr static const std::size_t straus_max_window = 5;
+
+                /** @brief Interleaved wNAF evaluation of sum scalars[i] * bases[i], i < count <= straus_max_terms.
+                 *  Each term is recoded on its own, the doublings are shared by all of them.
+                 */
+                template<typename BaseValueType, typename IntegralType>
+                BaseValueType straus_evaluate(const BaseValueType *bases, const IntegralType *scalars,
+                                              std::size_t count) {
+                    constexpr std::size_t digits_capacity = wnaf_digits_capacity<IntegralType>::value;
+                    static_assert(digits_capacity != 0, "straus_evaluate needs a fixed precision integral type");
+                    constexpr std::size_t table_size = std::size_t(1) << (straus_max_window - 1);
+                    BOOST_ASSERT(count <= straus_max_terms);
+
+                    std::array<std::array<std::int8_t, digits_capacity>, straus_max_terms> digits;
+                    std::array<std::size_t, straus_max_terms> lengths;
+                    std::vector<BaseValueType> tables(count * table_size);
+
+                    std::size_t max_length = 0;
+                    for (std::size_t t = 0; t < count; ++t) {
+                        lengths[t] = 0;
+                        if (scalars[t].is_zero() || bases[t].is_zero()) {
+                            continue;
+                        }
+
+                        const std::size_t bits = multiprecision::msb(scalars[t]) + 1;
+                        const std::size_t window_size = std::max<std::size_t>(
+                            1, std::min(wnaf_window_size<typename BaseValueType::group_type>(bits), straus_max_window));
+                        wnaf_odd_multiples(tables.data() + t * table_size, window_size, bases[t]);
+                        lengths[t] = wnaf_recode(digits[t], window_size, scalars[t]);
+                        max_length = std::max(max_length, lengths[t]);
+                    }
+
+                    BaseValueType res = BaseValueType::zero();
+                    bool found_nonzero = false;
+                    for (std::size_t i = max_length; i-- > 0;) {
+                        if (found_nonzero) {
+                            res = res.doubled();
+                        }
+
+                        for (std::size_t t = 0; t < count; ++t) {
+                            if (i >= lengths[t] || digits[t][i] == 0) {
+                                continue;
+                            }
+
+                            const std::int8_t digit = digits[t][i];
+                            const BaseValueType &multiple = tables[t * table_size + (digit > 0 ? digit : -digit) / 2];
+                            if (digit > 0) {
+                                res = found_nonzero ? res + multiple : multiple;
+                            } else {
+                                res = found_nonzero ? res - multiple : -multiple;
+                            }
+                            found_nonzero = true;
+                        }
+                    }
+
+                    return res;
+                }
+            }    // namespace detail
+
+            /** @brief Straus-Shamir simultaneous multi-scalar multiplication sum scalars[i] * bases[i].
+             *  All terms share one chain of doublings, which makes it the method of choice for the few
+             *  terms of a signature verification. Longer inputs are processed straus_max_terms at a time.
+             *  @tparam InputFieldIterator iterator over scalar field elements, as for multiexp
+             */
+            template<typename InputBaseIterator, typename InputFieldIterator>
+            typename std::iterator_traits<InputBaseIterator>::value_type
+                straus_multiexp(InputBaseIterator bases, InputBaseIterator bases_end,
+                                InputFieldIterator scalars, InputFieldIterator scalars_end) {
+                typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                typedef typename std::iterator_traits<InputFieldIterator>::value_type::field_type::integral_type
+                    integral_type;
+
+                BOOST_ASSERT(std::distance(bases, bases_end) == std::distance(scalars, scalars_end));
+
+                base_value_type result = base_value_type::zero();
+                std::array<base_value_type, detail::straus_max_terms> chunk_bases;
+                std::array<integral_type, detail::straus_max_terms> chunk_scalars;
+
+                while (bases != bases_end) {
+                    std::size_t count = 0;
+                    for (; count < detail::straus_max_terms && bases != bases_end; ++count, ++bases, ++scalars) {
+                        chunk_bases[count] = *bases;
+                        chunk_scalars[count] = scalars->data.template convert_to<integral_type>();
+                    }
+                    result = result + detail::straus_evaluate(chunk_bases.data(), chunk_scalars.data(), count);
+                }
+
+                return result;
+            }
+
+            /** @brief u1 * one() + u2 * base, e.g. the ECDSA verification equation, or s * B - k * A for
+             *  EdDSA with u2 = -k. The generator part runs over the fixed-base table and costs no
+             *  doublings, only the variable base goes through the wNAF chain.
+             *  @tparam TableParams generator table, see mul_generator
+             */
+            template<typename GroupType, typename TableParams = void>
+            typename GroupType::value_type double_scalar_mul_generator(
+                const typename GroupType::curve_type::scalar_field_type::value_type &u1,
+                const typename GroupType::value_type &base,
+                const typename GroupType::curve_type::scalar_field_type::value_type &u2) {
+                typedef typename GroupType::curve_type::scalar_field_type::integral_type integral_type;
+
+                const integral_type k1 = u1.data.template convert_to<integral_type>();
+                const integral_type k2 = u2.data.template convert_to<integral_type>();
+
+                return mul_generator<GroupType, TableParams>(k1) + detail::straus_evaluate(&base, &k2, 1);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_STRAUS_HPP
@@ -0,0 +1,182 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_THREAD_POOL_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            /**
+             * A fixed set of worker threads for the parallel multiexp paths. run() hands out the indices of
+             * a batch of tasks to the workers and to the calling thread and returns once all of them are
+             * done. Calls from within a task, and concurrent calls while the pool is busy, run serially on
+             * the calling thread, so nested multiexps cannot deadlock. If a task throws, the tasks not yet
+             * started are skipped and run() rethrows the first exception once every thread is done.
+             */
+            class thread_pool {
+            public:
+                /// @param threads_count total number of threads including the caller, 0 for hardware concurrency
+                explicit thread_pool(std::size_t threads_count = 0) {
+                    if (threads_count == 0) {
+                        threads_count = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+                    }
+                    for (std::size_t i = 1; i < threads_count; ++i) {
+                        workers.emplace_back([this] { work(); });
+                    }
+                }
+
+                thread_pool(const thread_pool &) = delete;
+                thread_pool &operator=(const thread_pool &) = delete;
+
+                ~thread_pool() {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        stopping = true;
+                    }
+                    wake.notify_all();
+                    for (std::thread &worker : workers) {
+                        worker.join();
+                    }
+                }
+
+                /// @brief Number of threads taking part in run(), the caller included
+                std::size_t size() const {
+                    return workers.size() + 1;
+                }
+
+                /// @brief Calls task(i) for every i in [0, tasks_count), in no particular order
+                template<typename Task>
+                void run(std::size_t tasks_count, const Task &task) {
+                    std::unique_lock<std::mutex> busy(run_mutex, std::try_to_lock);
+                    if (workers.empty() || tasks_count < 2 || inside_task() || !busy.owns_lock()) {
+                        for (std::size_t i = 0; i < tasks_count; ++i) {
+                            task(i);
+                        }
+                        return;
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        job = std::cref(task);
+                        job_size = tasks_count;
+                        next_task = 0;
+                        active = workers.size();
+                        ++generation;
+                    }
+                    wake.notify_all();
+
+                    drain();
+
+                    std::exception_ptr failure;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        done.wait(lock, [this] { return active == 0; });
+                        job = nullptr;
+                        std::swap(failure, error);
+                    }
+                    if (failure) {
+                        std::rethrow_exception(failure);
+                    }
+                }
+
+                /// @brief Pool with one thread per hardware thread, created on first use
+                static thread_pool &default_pool() {
+                    static thread_pool pool;
+                    return pool;
+                }
+
+            private:
+                static bool &inside_task() {
+                    static thread_local bool flag = false;
+                    return flag;
+                }
+
+                void drain() {
+                    const bool outer = inside_task();
+                    inside_task() = true;
+                    try {
+                        for (std::size_t i = next_task++; i < job_size; i = next_task++) {
+                            job(i);
+                        }
+                    } catch (...) {
+                        next_task = job_size;
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!error) {
+                            error = std::current_exception();
+                        }
+                    }
+                    inside_task() = outer;
+                }
+
+                void work() {
+                    std::size_t seen = 0;
+                    for (;;) {
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            wake.wait(lock, [&] { return stopping || generation != seen; });
+                            if (stopping) {
+                                return;
+                            }
+                            seen = generation;
+                        }
+
+                        drain();
+
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (--active == 0) {
+                            done.notify_one();
+                        }
+                    }
+                }
+
+                std::vector<std::thread> workers;
+                std::mutex run_mutex;
+                std::mutex mutex;
+                std::condition_variable wake;
+                std::condition_variable done;
+
+                std::function<void(std::size_t)> job;
+                std::exception_ptr error;
+                std::size_t job_size = 0;
+                std::atomic<std::size_t> next_task {0};
+                std::size_t active = 0;
+                std::size_t generation = 0;
+                bool stopping = false;
+            };
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_THREAD_POOL_HPP
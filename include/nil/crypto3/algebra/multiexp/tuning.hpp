@@ -0,0 +1,239 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_TUNING_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_TUNING_HPP
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            /**
+             * Window tables and method crossovers for multi-scalar multiplication in one group, measured on
+             * the target machine with calibrate_multiexp() (see the multiexp_calibration example). Once
+             * loaded for a group, they take precedence over the built-in estimates: get_exp_window_size()
+             * reads fixed_base_exp_window_table, the bucket methods read bucket_window_table and
+             * multiexp_method_tuned picks the method by the crossovers.
+             *
+             * The text form written by write() is what load_multiexp_tuning() reads.
+             */
+            struct multiexp_tuning {
+                constexpr static const std::size_t version = 1;
+
+                /// @brief Bit sizes of the base and scalar fields, to reject tables measured for another group
+                std::size_t base_field_bits = 0;
+                std::size_t scalar_field_bits = 0;
+
+                /// @brief Measured cost of one addition and one doubling, for reference only
+                double addition_ns = 0;
+                double doubling_ns = 0;
+
+                /// @brief Entry i is the smallest number of scalars for which fixed-base window i + 1 is the
+                /// fastest, 0 if it never is. Same layout as multiexp_params::fixed_base_exp_window_table
+                std::vector<std::size_t> fixed_base_exp_window_table;
+
+                /// @brief Entry i is the smallest length for which 2^(i + 1) buckets per window are the fastest,
+                /// 0 if they never are. Unsigned digits then take i + 1 bits per window, signed ones i + 2
+                std::vector<std::size_t> bucket_window_table;
+
+                /// @brief Longest tables read() accepts. Signed bucket windows take one bit more than the table
+                /// size, and scalar_digits only takes windows below 31 bits
+                constexpr static const std::size_t max_fixed_base_exp_window_table_size = 31;
+                constexpr static const std::size_t max_bucket_window_table_size = 29;
+
+                /// @brief Smallest length from which each method is the fastest, 0 if it never is. Below all of
+                /// them multiexp_method_tuned uses the naive method
+                std::size_t bos_coster_threshold = 0;
+                std::size_t pippenger_threshold = 8;
+                std::size_t batched_affine_threshold = 1024;
+
+                /// @brief Window for length from a table of thresholds, 1 below all of them
+                template<typename ThresholdTable>
+                static std::size_t window_for(const ThresholdTable &table, std::size_t length) {
+                    for (std::size_t i = table.size(); i > 0; --i) {
+                        if (table[i - 1] != 0 && length >= table[i - 1]) {
+                            return i;
+                        }
+                    }
+                    return 1;
+                }
+
+                void write(std::ostream &os) const {
+                    os << "multiexp_tuning " << version << '\n';
+                    os << "group " << base_field_bits << ' ' << scalar_field_bits << '\n';
+                    os << "costs " << addition_ns << ' ' << doubling_ns << '\n';
+                    write_table(os, "fixed_base_exp_window_table", fixed_base_exp_window_table);
+                    write_table(os, "bucket_window_table", bucket_window_table);
+                    os << "crossovers " << bos_coster_threshold << ' ' << pippenger_threshold << ' '
+                       << batched_affine_threshold << '\n';
+                }
+
+                /// @brief Reads the form written by write(), returns false and leaves *this as is on malformed
+                /// input. Empty lines and lines starting with '#' are skipped
+                bool read(std::istream &is) {
+                    multiexp_tuning result;
+                    bool has_version = false, has_group = false;
+                    std::string line;
+                    while (std::getline(is, line)) {
+                        std::istringstream fields(line);
+                        std::string key;
+                        if (!(fields >> key) || key[0] == '#') {
+                            continue;
+                        }
+
+                        bool ok;
+                        if (key == "multiexp_tuning") {
+                            std::size_t file_version;
+                            ok = bool(fields >> file_version) && file_version == version;
+                            has_version = ok;
+                        } else if (key == "group") {
+                            ok = bool(fields >> result.base_field_bits >> result.scalar_field_bits);
+                            has_group = ok;
+                        } else if (key == "costs") {
+                            ok = bool(fields >> result.addition_ns >> result.doubling_ns);
+                        } else if (key == "fixed_base_exp_window_table") {
+                            ok = read_table(fields, result.fixed_base_exp_window_table,
+                                            max_fixed_base_exp_window_table_size);
+                        } else if (key == "bucket_window_table") {
+                            ok = read_table(fields, result.bucket_window_table, max_bucket_window_table_size);
+                        } else if (key == "crossovers") {
+                            ok = bool(fields >> result.bos_coster_threshold >> result.pippenger_threshold >>
+                                      result.batched_affine_threshold);
+                        } else {
+                            ok = false;
+                        }
+
+                        if (!ok) {
+                            return false;
+                        }
+                    }
+
+                    if (!has_version || !has_group) {
+                        return false;
+                    }
+                    *this = std::move(result);
+                    return true;
+                }
+
+            private:
+                static void write_table(std::ostream &os, const char *name, const std::vector<std::size_t> &table) {
+                    os << name << ' ' << table.size();
+                    for (std::size_t threshold : table) {
+                        os << ' ' << threshold;
+                    }
+                    os << '\n';
+                }
+
+                static bool read_table(std::istream &is, std::vector<std::size_t> &table, std::size_t max_size) {
+                    std::size_t size;
+                    if (!(is >> size) || size > max_size) {
+                        return false;
+                    }
+                    table.resize(size);
+                    for (std::size_t &threshold : table) {
+                        if (!(is >> threshold)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            };
+
+            namespace detail {
+                /// @brief Tuning loaded for the group of GroupValueType, shared by all threads
+                template<typename GroupValueType>
+                struct multiexp_tuning_slot {
+                    static std::shared_ptr<const multiexp_tuning> get() {
+                        std::lock_guard<std::mutex> lock(mutex());
+                        return value();
+                    }
+
+                    static void set(std::shared_ptr<const multiexp_tuning> tuning) {
+                        std::lock_guard<std::mutex> lock(mutex());
+                        value() = std::move(tuning);
+                    }
+
+                private:
+                    static std::mutex &mutex() {
+                        static std::mutex instance;
+                        return instance;
+                    }
+
+                    static std::shared_ptr<const multiexp_tuning> &value() {
+                        static std::shared_ptr<const multiexp_tuning> instance;
+                        return instance;
+                    }
+                };
+            }    // namespace detail
+
+            /// @brief Whether tuning was measured for a group of the same shape as GroupType
+            template<typename GroupType>
+            bool is_multiexp_tuning_for(const multiexp_tuning &tuning) {
+                return tuning.base_field_bits == GroupType::field_type::value_bits &&
+                       tuning.scalar_field_bits == GroupType::curve_type::scalar_field_type::value_bits;
+            }
+
+            /// @brief Makes tuning the one used for GroupType from now on, false if it is for another group
+            template<typename GroupType>
+            bool set_multiexp_tuning(const multiexp_tuning &tuning) {
+                if (!is_multiexp_tuning_for<GroupType>(tuning)) {
+                    return false;
+                }
+                detail::multiexp_tuning_slot<typename GroupType::value_type>::set(
+                    std::make_shared<const multiexp_tuning>(tuning));
+                return true;
+            }
+
+            /// @brief Reads a tuning written by multiexp_tuning::write() and sets it for GroupType
+            template<typename GroupType>
+            bool load_multiexp_tuning(std::istream &is) {
+                multiexp_tuning tuning;
+                return tuning.read(is) && set_multiexp_tuning<GroupType>(tuning);
+            }
+
+            /// @brief Tuning in use for GroupType, null when the built-in estimates are used
+            template<typename GroupType>
+            std::shared_ptr<const multiexp_tuning> get_multiexp_tuning() {
+                return detail::multiexp_tuning_slot<typename GroupType::value_type>::get();
+            }
+
+            /// @brief Back to the built-in estimates for GroupType
+            template<typename GroupType>
+            void clear_multiexp_tuning() {
+                detail::multiexp_tuning_slot<typename GroupType::value_type>::set(nullptr);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_TUNING_HPP
@@ -27,6 +27,13 @@
 #define CRYPTO3_ALGEBRA_RANDOM_ELEMENT_HPP
 
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/fixed_base_table.hpp>
+
+#include <nil/crypto3/algebra/curves/params/generator/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/params/generator/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/generator/ed25519.hpp>
+#include <nil/crypto3/algebra/curves/params/generator/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/params/generator/secp_r1.hpp>
 
 #include <nil/crypto3/multiprecision/debug_adaptor.hpp>
 #include <nil/crypto3/multiprecision/cpp_bin_float.hpp>
@@ -96,6 +103,9 @@ namespace nil {
                 return typename field_type::value_type(data);
             }
 
+            /** @brief scalar * one() for a random scalar. Groups with a compiled-in generator table from
+             *  curves/params/generator go through mul_generator, the others through scalar_mul.
+             */
             template<typename CurveGroupType,
                      typename DistributionType =
                          boost::random::uniform_int_distribution<typename CurveGroupType::field_type::integral_type>,
@@ -109,8 +119,16 @@ namespace nil {
                 using distribution_type = boost::random::uniform_int_distribution<typename field_type::integral_type>;
                 using generator_type = GeneratorType;
 
-                return random_element<typename curve_type::scalar_field_type, distribution_type, generator_type>(rng) *
-                       CurveGroupType::value_type::one();
+                const typename field_type::value_type scalar =
+                    random_element<typename curve_type::scalar_field_type, distribution_type, generator_type>(rng);
+
+                if constexpr (is_fixed_base_table_supported<CurveGroupType>::value &&
+                              has_generator_table_params<CurveGroupType>::value) {
+                    return mul_generator<CurveGroupType,
+                                         curves::generator_table_params<typename CurveGroupType::params_type>>(scalar);
+                } else {
+                    return scalar * CurveGroupType::value_type::one();
+                }
             }
 
         }    // namespace algebra
@@ -0,0 +1,268 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_RAW_MARSHALLING_HPP
+#define CRYPTO3_ALGEBRA_RAW_MARSHALLING_HPP
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/fixed_base_table.hpp>
+#include <nil/crypto3/algebra/fields/detail/montgomery_limbs.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nil {
+    namespace marshalling {
+        /**
+         * Trusted internal format: sequences of field or group elements stored as their raw Montgomery
+         * limbs, so that saving and loading is a plain copy without any conversion to and from the
+         * canonical representation. Meant for caches such as proving keys written and read by the same
+         * build; it is not a wire format.
+         *
+         * A buffer starts with a header of header_limbs limbs: magic, format version, limb size, type id,
+         * limbs per element and the number of elements. The type id is a fingerprint of the modulus (and
+         * of the generator for groups), so a buffer is never loaded as elements of another field or curve.
+         * The format uses native limbs and byte order, like fixed_base_table.
+         */
+        namespace raw {
+            namespace detail {
+                typedef crypto3::multiprecision::limb_type limb_type;
+
+                // "RAW" magic, format version
+                constexpr static const limb_type magic = 0x574152;
+                constexpr static const limb_type version = 1;
+                constexpr static const std::size_t header_limbs = 6;
+
+                /// FNV-1a over the bytes of the given limbs, folded into one limb
+                inline limb_type fingerprint(const limb_type *limbs, std::size_t count,
+                                             std::uint64_t seed = 0xcbf29ce484222325ULL) {
+                    std::uint64_t h = seed;
+                    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(limbs);
+                    for (std::size_t i = 0; i < count * sizeof(limb_type); ++i) {
+                        h = (h ^ bytes[i]) * 0x100000001b3ULL;
+                    }
+                    return static_cast<limb_type>(h ^ (h >> 32));
+                }
+
+                /**
+                 * Header handling and bulk copies shared by the field and group formats. Traits provide
+                 * value_type, element_limbs, type_id(), store() and load().
+                 */
+                template<typename Traits>
+                struct raw_sequence {
+                    typedef typename Traits::value_type value_type;
+
+                    constexpr static const std::size_t element_limbs = Traits::element_limbs;
+                    /// Bound on the element count of a buffer, so that its size in bytes is representable
+                    constexpr static const std::size_t max_count =
+                        (std::numeric_limits<std::size_t>::max() / sizeof(limb_type) - header_limbs) / element_limbs;
+
+                    /// @brief Size in limbs of the buffer holding count elements
+                    static std::size_t size(std::size_t count) {
+                        return header_limbs + count * element_limbs;
+                    }
+
+                    /// @brief Checks the header fields alone, without the size of the buffer
+                    static bool is_valid_header(const limb_type *data) {
+                        return data[0] == magic && data[1] == version && data[2] == sizeof(limb_type) &&
+                               data[3] == Traits::type_id() && data[4] == element_limbs && data[5] <= max_count;
+                    }
+
+                    static bool is_valid_header(const limb_type *data, std::size_t size) {
+                        return size >= header_limbs && is_valid_header(data) && size == raw_sequence::size(data[5]);
+                    }
+
+                    /// @brief Writes the header and the elements of [first, last) to out
+                    /// @return end of the written buffer, out + size(std::distance(first, last))
+                    template<typename InputIterator>
+                    static limb_type *to_raw(InputIterator first, InputIterator last, limb_type *out) {
+                        out[0] = magic;
+                        out[1] = version;
+                        out[2] = sizeof(limb_type);
+                        out[3] = Traits::type_id();
+                        out[4] = element_limbs;
+
+                        limb_type *p = out + header_limbs;
+                        for (; first != last; ++first, p += element_limbs) {
+                            Traits::store(*first, p);
+                        }
+                        out[5] = (p - out - header_limbs) / element_limbs;
+                        return p;
+                    }
+
+                    /// @brief Loads all elements of a buffer written by to_raw() into out
+                    /// @return false and nothing written if the buffer does not hold elements of this type
+                    template<typename OutputIterator>
+                    static std::pair<bool, OutputIterator> from_raw(const limb_type *data, std::size_t size,
+                                                                    OutputIterator out) {
+                        if (!is_valid_header(data, size)) {
+                            return std::make_pair(false, out);
+                        }
+
+                        const limb_type *p = data + header_limbs;
+                        value_type value;
+                        for (std::size_t i = 0; i < data[5]; ++i, p += element_limbs) {
+                            Traits::load(value, p);
+                            *out++ = value;
+                        }
+                        return std::make_pair(true, out);
+                    }
+
+                    template<typename InputIterator>
+                    static void save(std::ostream &os, InputIterator first, InputIterator last) {
+                        std::vector<limb_type> buffer(size(std::distance(first, last)));
+                        to_raw(first, last, buffer.data());
+                        os.write(reinterpret_cast<const char *>(buffer.data()), buffer.size() * sizeof(limb_type));
+                    }
+
+                    /**
+                     * @brief Reads a buffer written by save() with bulk reads of the header and the payload.
+                     * The payload is read in chunks and the buffer only grows with the data actually read, so
+                     * a forged element count fails on the short stream instead of allocating for it.
+                     */
+                    static std::pair<bool, std::vector<value_type>> load(std::istream &is) {
+                        std::vector<limb_type> buffer(header_limbs);
+                        is.read(reinterpret_cast<char *>(buffer.data()), header_limbs * sizeof(limb_type));
+                        if (!is || !is_valid_header(buffer.data())) {
+                            return std::make_pair(false, std::vector<value_type>());
+                        }
+
+                        const std::size_t buffer_size = size(buffer[5]);
+                        constexpr std::size_t chunk_limbs = std::size_t(1) << 20;
+                        while (buffer.size() < buffer_size) {
+                            const std::size_t offset = buffer.size();
+                            const std::size_t count = std::min(buffer_size - offset, chunk_limbs);
+                            buffer.resize(offset + count);
+                            is.read(reinterpret_cast<char *>(buffer.data() + offset), count * sizeof(limb_type));
+                            if (!is) {
+                                return std::make_pair(false, std::vector<value_type>());
+                            }
+                        }
+
+                        std::vector<value_type> result;
+                        result.reserve(buffer[5]);
+                        from_raw(buffer.data(), buffer.size(), std::back_inserter(result));
+                        return std::make_pair(true, result);
+                    }
+                };
+
+                template<typename FieldType>
+                struct field_traits {
+                    typedef typename FieldType::value_type value_type;
+                    typedef crypto3::algebra::fields::detail::montgomery_limbs<FieldType> limbs_type;
+
+                    constexpr static const std::size_t element_limbs = limbs_type::limbs_count;
+
+                    static limb_type type_id() {
+                        static const limb_type id = [] {
+                            const limb_type shape[] = {FieldType::arity, FieldType::modulus_bits};
+                            const auto &modulus = FieldType::modulus.backend();
+                            return fingerprint(modulus.limbs(), modulus.size(), fingerprint(shape, 2));
+                        }();
+                        return id;
+                    }
+
+                    static void store(const value_type &value, limb_type *out) {
+                        limbs_type::store(value, out);
+                    }
+
+                    static void load(value_type &value, const limb_type *in) {
+                        limbs_type::load(value, in);
+                    }
+                };
+
+                template<typename GroupType>
+                struct group_traits {
+                    static_assert(crypto3::algebra::is_fixed_base_table_supported<GroupType>::value,
+                                  "unsupported coordinates");
+
+                    typedef typename GroupType::value_type value_type;
+                    typedef typename GroupType::field_type field_type;
+                    typedef field_traits<field_type> coordinate_traits;
+
+                    constexpr static const bool has_t = crypto3::algebra::has_t_coordinate<value_type>::value;
+                    constexpr static const std::size_t coordinates_count = has_t ? 4 : 3;
+                    constexpr static const std::size_t element_limbs =
+                        coordinates_count * coordinate_traits::element_limbs;
+
+                    static limb_type type_id() {
+                        static const limb_type id = [] {
+                            std::vector<limb_type> generator(element_limbs);
+                            store(value_type::one(), generator.data());
+                            return fingerprint(generator.data(), generator.size(),
+                                               coordinate_traits::type_id() + coordinates_count);
+                        }();
+                        return id;
+                    }
+
+                    static void store(const value_type &value, limb_type *out) {
+                        constexpr std::size_t n = coordinate_traits::element_limbs;
+                        coordinate_traits::store(value.X, out);
+                        coordinate_traits::store(value.Y, out + n);
+                        if constexpr (has_t) {
+                            coordinate_traits::store(value.T, out + 2 * n);
+                            coordinate_traits::store(value.Z, out + 3 * n);
+                        } else {
+                            coordinate_traits::store(value.Z, out + 2 * n);
+                        }
+                    }
+
+                    static void load(value_type &value, const limb_type *in) {
+                        constexpr std::size_t n = coordinate_traits::element_limbs;
+                        coordinate_traits::load(value.X, in);
+                        coordinate_traits::load(value.Y, in + n);
+                        if constexpr (has_t) {
+                            coordinate_traits::load(value.T, in + 2 * n);
+                            coordinate_traits::load(value.Z, in + 3 * n);
+                        } else {
+                            coordinate_traits::load(value.Z, in + 2 * n);
+                        }
+                    }
+                };
+            }    // namespace detail
+
+            using detail::header_limbs;
+            using detail::limb_type;
+
+            /// @brief Raw format for elements of a prime or extension field
+            template<typename FieldType>
+            struct field : public detail::raw_sequence<detail::field_traits<FieldType>> { };
+
+            /// @brief Raw format for group elements, all projective coordinates as they are
+            template<typename GroupType>
+            struct group : public detail::raw_sequence<detail::group_traits<GroupType>> { };
+        }    // namespace raw
+    }        // namespace marshalling
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_RAW_MARSHALLING_HPP
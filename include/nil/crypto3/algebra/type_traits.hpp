@@ -27,6 +27,8 @@
 #define CRYPTO3_ALGEBRA_TYPE_TRAITS_HPP
 
 #include <complex>
+#include <type_traits>
+#include <utility>
 
 #include <boost/type_traits.hpp>
 #include <boost/tti/tti.hpp>
@@ -74,6 +76,15 @@ namespace nil {
             BOOST_TTI_HAS_FUNCTION(is_well_formed)
             BOOST_TTI_HAS_FUNCTION(doubled)
 
+            /** @brief Extended twisted Edwards elements carry the extra coordinate T = X * Y / Z
+             */
+            template<typename GroupValueType, typename = void>
+            struct has_t_coordinate : std::false_type { };
+
+            template<typename GroupValueType>
+            struct has_t_coordinate<GroupValueType, decltype(void(std::declval<GroupValueType>().T))>
+                : std::true_type { };
+
             template<typename T>
             struct is_curve {
                 static const bool value = has_type_base_field_type<T>::value && has_type_scalar_field_type<T>::value &&
@@ -22,6 +22,7 @@
 // SOFTWARE.
 //---------------------------------------------------------------------------//
 
+
 #ifndef CRYPTO3_ALGEBRA_WNAF_HPP
 #define CRYPTO3_ALGEBRA_WNAF_HPP
 
@@ -29,40 +30,182 @@
 
 #include <nil/crypto3/algebra/curves/params.hpp>
 
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
-            template<typename BaseValueType, typename Backend,
-                     multiprecision::expression_template_option ExpressionTemplates>
-            BaseValueType fixed_window_wnaf_exp(const std::size_t window_size, const BaseValueType &base,
-                                                const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
-                std::vector<long> naf = multiprecision::find_wnaf(window_size, scalar);
-                std::vector<BaseValueType> table(1ul << (window_size - 1));
-                BaseValueType tmp = base;
-                BaseValueType dbl = base.doubled();
-                for (size_t i = 0; i < 1ul << (window_size - 1); ++i) {
-                    table[i] = tmp;
-                    tmp = tmp + dbl;
+            namespace detail {
+                /**
+                 * Largest window used for the table of odd multiples. Windows above it are clamped: the
+                 * table would cost more additions than the recoding saves for scalars below ~1800 bits.
+                 */
+                constexpr static const std::size_t wnaf_max_window = 6;
+
+                /** @brief Window size for a scalar of scalar_bits bits, 0 if wNAF does not pay off.
+                 */
+                template<typename GroupType>
+                constexpr std::size_t wnaf_window_size(const std::size_t scalar_bits) {
+                    const auto &table = curves::wnaf_params<GroupType>::wnaf_window_table;
+                    for (std::size_t i = table.size(); i > 0; --i) {
+                        if (scalar_bits >= table[i - 1]) {
+                            return i;
+                        }
+                    }
+                    return 0;
                 }
 
-                BaseValueType res = BaseValueType::zero();
-                bool found_nonzero = false;
-                for (long i = naf.size() - 1; i >= 0; --i) {
-                    if (found_nonzero) {
-                        res = res.doubled();
+                /**
+                 * Number of digits needed to recode any value of NumberType, 0 for unbounded types.
+                 */
+                template<typename NumberType>
+                struct wnaf_digits_capacity {
+                    constexpr static const std::size_t value =
+                        std::numeric_limits<NumberType>::is_bounded ?
+                            static_cast<std::size_t>(std::numeric_limits<NumberType>::digits) + 2 :
+                            0;
+                };
+
+                /** @brief Width-(w + 1) NAF recoding into a caller-provided digit buffer, no allocation.
+                 *  Nonzero digits are odd, |d| < 2^w, and are followed by at least w zeros.
+                 *  Bits are read in place with bit_test, the scalar is never modified.
+                 *  @return number of significant digits
+                 */
+                template<std::size_t N, typename Backend,
+                         multiprecision::expression_template_option ExpressionTemplates>
+                constexpr std::size_t wnaf_recode(std::array<std::int8_t, N> &digits, const std::size_t window_size,
+                                                  const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                    const std::size_t width = window_size + 1;
+                    const std::size_t length = multiprecision::msb(scalar) + 2;
+                    BOOST_ASSERT(length <= N);
+
+                    std::size_t result_length = 0;
+                    std::size_t carry = 0;
+                    for (std::size_t bit = 0; bit < length;) {
+                        if (static_cast<std::size_t>(multiprecision::bit_test(scalar, bit)) == carry) {
+                            digits[bit++] = 0;
+                            continue;
+                        }
+
+                        const std::size_t now = std::min(width, length - bit);
+                        long word = static_cast<long>(carry);
+                        for (std::size_t j = 0; j < now; ++j) {
+                            if (multiprecision::bit_test(scalar, bit + j)) {
+                                word += 1l << j;
+                            }
+                        }
+                        carry = (word >> (width - 1)) & 1;
+                        word -= static_cast<long>(carry) << width;
+
+                        digits[bit] = static_cast<std::int8_t>(word);
+                        for (std::size_t j = 1; j < now; ++j) {
+                            digits[bit + j] = 0;
+                        }
+                        bit += now;
+                        result_length = bit;
                     }
 
-                    if (naf[i] != 0) {
-                        found_nonzero = true;
-                        if (naf[i] > 0) {
-                            res = res + table[naf[i] / 2];
-                        } else {
-                            res = res - table[(-naf[i]) / 2];
+                    return result_length;
+                }
+
+                /** @brief Evaluates a signed-digit representation using a table of odd multiples.
+                 *  Negative digits subtract, which is a field negation of Y away from an addition.
+                 */
+                template<typename BaseValueType, typename DigitsType>
+                constexpr BaseValueType wnaf_evaluate(const BaseValueType *table, const DigitsType &digits,
+                                                      std::size_t length) {
+                    BaseValueType res = BaseValueType::zero();
+                    bool found_nonzero = false;
+                    for (std::size_t i = length; i-- > 0;) {
+                        if (found_nonzero) {
+                            res = res.doubled();
+                        }
+
+                        if (digits[i] != 0) {
+                            if (digits[i] > 0) {
+                                res = found_nonzero ? res + table[digits[i] / 2] : table[digits[i] / 2];
+                            } else {
+                                res = found_nonzero ? res - table[(-digits[i]) / 2] : -table[(-digits[i]) / 2];
+                            }
+                            found_nonzero = true;
                         }
                     }
+
+                    return res;
                 }
 
-                return res;
+                /** @brief table[i] = (2 * i + 1) * base for i < 2^(window_size - 1)
+                 */
+                template<typename BaseValueType, typename TableType>
+                constexpr void wnaf_odd_multiples(TableType &table, const std::size_t window_size,
+                                                  const BaseValueType &base) {
+                    table[0] = base;
+                    if (window_size > 1) {
+                        const BaseValueType dbl = base.doubled();
+                        for (std::size_t i = 1; i < 1ul << (window_size - 1); ++i) {
+                            table[i] = table[i - 1] + dbl;
+                        }
+                    }
+                }
+
+                /** @brief scalar * base with a table of 2^(Window - 1) odd multiples
+                 */
+                template<std::size_t Window, typename BaseValueType, typename Backend,
+                         multiprecision::expression_template_option ExpressionTemplates>
+                constexpr BaseValueType wnaf_exp(const BaseValueType &base,
+                                                 const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                    typedef multiprecision::number<Backend, ExpressionTemplates> number_type;
+                    constexpr std::size_t digits_capacity = wnaf_digits_capacity<number_type>::value;
+
+                    // Sized to the window and value-initialised, so that bounded scalars stay usable in
+                    // constant expressions without constructing entries that are never read
+                    std::array<BaseValueType, std::size_t(1) << (Window - 1)> table {};
+                    wnaf_odd_multiples(table, Window, base);
+
+                    if constexpr (digits_capacity != 0) {
+                        std::array<std::int8_t, digits_capacity> digits {};
+                        std::size_t length = wnaf_recode(digits, Window, scalar);
+                        return wnaf_evaluate(table.data(), digits, length);
+                    } else {
+                        // Unbounded integers have no static digit count
+                        std::vector<long> naf = multiprecision::find_wnaf(Window, scalar);
+                        return wnaf_evaluate(table.data(), naf, naf.size());
+                    }
+                }
+
+                /** @brief wnaf_exp for the run-time window_size, at most Window
+                 */
+                template<std::size_t Window, typename BaseValueType, typename Backend,
+                         multiprecision::expression_template_option ExpressionTemplates>
+                constexpr BaseValueType
+                    wnaf_exp(std::size_t window_size, const BaseValueType &base,
+                             const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                    if constexpr (Window > 1) {
+                        if (window_size < Window) {
+                            return wnaf_exp<Window - 1>(window_size, base, scalar);
+                        }
+                    }
+                    return wnaf_exp<Window>(base, scalar);
+                }
+            }    // namespace detail
+
+            template<typename BaseValueType, typename Backend,
+                     multiprecision::expression_template_option ExpressionTemplates>
+            constexpr BaseValueType
+                fixed_window_wnaf_exp(std::size_t window_size, const BaseValueType &base,
+                                      const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                if (scalar.is_zero()) {
+                    return BaseValueType::zero();
+                }
+
+                return detail::wnaf_exp<detail::wnaf_max_window>(std::max<std::size_t>(1, window_size), base, scalar);
             }
 
             // TODO: check, that CurveGroupValueType is a curve group element. Otherwise it has no wnaf_window_table
@@ -71,17 +214,7 @@ namespace nil {
             CurveGroupValueType opt_window_wnaf_exp(const CurveGroupValueType &base,
                                                     const multiprecision::number<Backend, ExpressionTemplates> &scalar,
                                                     const std::size_t scalar_bits) {
-                std::size_t best = 0;
-                for (long i =
-                         curves::wnaf_params<typename CurveGroupValueType::group_type>::wnaf_window_table.size() - 1;
-                     i >= 0;
-                     --i) {
-                    if (scalar_bits >=
-                        curves::wnaf_params<typename CurveGroupValueType::group_type>::wnaf_window_table[i]) {
-                        best = i + 1;
-                        break;
-                    }
-                }
+                std::size_t best = detail::wnaf_window_size<typename CurveGroupValueType::group_type>(scalar_bits);
 
                 if (best > 0) {
                     return fixed_window_wnaf_exp(best, base, scalar);
@@ -92,4 +225,4 @@ namespace nil {
         }    // namespace algebra
     }        // namespace crypto3
 }    // namespace nil
-#endif    // CRYPTO3_ALGEBRA_RANDOM_ELEMENT_HPP
+#endif    // CRYPTO3_ALGEBRA_WNAF_HPP
@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+"""Generates the compiled-in generator tables of include/nil/crypto3/algebra/curves/params/generator.
+
+Run from the repository root:
+
+    python3 scripts/generator_tables.py include/nil/crypto3/algebra/curves/params/generator
+
+Every header holds the affine multiples (j + 1) * 2^(W * i) * G of the group generator G for j < 2^(W - 1) and
+i < windows_count, in the layout read by mul_generator() in fixed_base_table.hpp. Only the Python standard library
+is needed.
+"""
+
+import sys
+
+W = 4
+HALF = 1 << (W - 1)
+LIC = '''//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+'''
+
+def inv(a, p): return pow(a, p - 2, p)
+
+class SW:
+    def __init__(s, p, a, b): s.p, s.a, s.b = p, a % p, b % p
+    def on(s, P): x, y = P; return (y*y - x*x*x - s.a*x - s.b) % s.p == 0
+    def add(s, P, Q):
+        p = s.p
+        if P is None: return Q
+        if Q is None: return P
+        (x1, y1), (x2, y2) = P, Q
+        if x1 == x2:
+            if (y1 + y2) % p == 0: return None
+            l = (3*x1*x1 + s.a) * inv(2*y1, p) % p
+        else:
+            l = (y2 - y1) * inv(x2 - x1, p) % p
+        x3 = (l*l - x1 - x2) % p
+        return (x3, (l*(x1 - x3) - y1) % p)
+
+class TE:
+    def __init__(s, p, a, d): s.p, s.a, s.d = p, a % p, d % p
+    def on(s, P): x, y = P; p = s.p; return (s.a*x*x + y*y - 1 - s.d*x*x*y*y) % p == 0
+    def add(s, P, Q):
+        p = s.p
+        if P is None: return Q
+        if Q is None: return P
+        (x1, y1), (x2, y2) = P, Q
+        t = s.d * x1 * x2 * y1 * y2 % p
+        x3 = (x1*y2 + y1*x2) * inv(1 + t, p) % p
+        y3 = (y1*y2 - s.a*x1*x2) * inv(1 - t, p) % p
+        return (x3, y3)
+
+def mul(C, P, k):
+    R = None
+    for bit in bin(k)[2:]:
+        R = C.add(R, R)
+        if bit == '1': R = C.add(R, P)
+    return R
+
+def table(C, G, scalar_bits):
+    count = (scalar_bits + W - 1) // W + 1
+    out = []
+    base = G
+    for i in range(count):
+        m = base
+        for j in range(HALF):
+            assert m is not None and C.on(m)
+            out.append(m)
+            m = C.add(m, base)
+        for _ in range(W):
+            base = C.add(base, base)
+    return count, out
+
+def emit(fname, guard, includes, title, params_type, bits, C, G, scalar_bits, n):
+    # sanity: G has order n
+    assert mul(C, G, n) in (None, (0, 1))
+    count, pts = table(C, G, scalar_bits)
+    # spot check
+    assert pts[HALF * 3 + 5] == mul(C, G, 6 * 16**3)
+    vt = 'typename field_type::value_type'
+    lines = []
+    for (x, y) in pts:
+        digits = 64 if bits <= 256 else 96
+        lines.append('                            %s(0x%0*X_cppui%d),' % (vt, digits, x, bits))
+        lines.append('                            %s(0x%0*X_cppui%d),' % (vt, digits, y, bits))
+    lines[-1] = lines[-1].rstrip(',')
+    body = '\n'.join(lines)
+    s = LIC + '''
+#ifndef {guard}
+#define {guard}
+
+#include <nil/crypto3/algebra/curves/params.hpp>
+
+{includes}
+
+#include <array>
+#include <cstddef>
+
+namespace nil {{
+    namespace crypto3 {{
+        namespace algebra {{
+            namespace curves {{
+
+                template<typename ParamsType>
+                struct generator_table_params;
+
+                /************************* {title} ***********************************/
+
+                /**
+                 * Affine multiples (j + 1) * 2^(window * i) * G of the generator for j < 2^(window - 1),
+                 * i < windows_count, as consecutive x, y pairs. Generated by
+                 * "python3 scripts/generator_tables.py include/nil/crypto3/algebra/curves/params/generator",
+                 * do not edit.
+                 */
+                template<>
+                struct generator_table_params<{params_type}> {{
+
+                    using field_type = typename {params_type}::field_type;
+
+                    constexpr static const std::size_t window = {W};
+                    constexpr static const std::size_t windows_count = {count};
+
+                    constexpr static const std::array<typename field_type::value_type,
+                                                      2 * windows_count * (std::size_t(1) << (window - 1))>
+                        table = {{
+{body}}};
+                }};
+
+                constexpr std::size_t const generator_table_params<{params_type}>::window;
+                constexpr std::size_t const generator_table_params<{params_type}>::windows_count;
+                constexpr std::array<
+                    typename generator_table_params<{params_type}>::field_type::value_type,
+                    2 * generator_table_params<{params_type}>::windows_count *
+                        (std::size_t(1) << (generator_table_params<{params_type}>::window - 1))> const
+                    generator_table_params<{params_type}>::table;
+
+            }}    // namespace curves
+        }}        // namespace algebra
+    }}            // namespace crypto3
+}}    // namespace nil
+
+#endif    // {guard}
+'''.format(guard=guard, includes=includes, title=title, params_type=params_type, W=W, count=count, body=body)
+    open(fname, 'w').write(s)
+
+if len(sys.argv) != 2:
+    sys.exit('usage: generator_tables.py <output directory>')
+D = sys.argv[1]
+# secp256k1
+p = 2**256 - 2**32 - 977
+n = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141
+emit(D + '/secp_k1.hpp', 'CRYPTO3_ALGEBRA_CURVES_SECP_K1_GENERATOR_TABLE_PARAMS_HPP',
+     '#include <nil/crypto3/algebra/curves/secp_k1.hpp>', 'SECP256K1', 'detail::secp_k1_g1_params<256, forms::short_weierstrass>', 256,
+     SW(p, 0, 7), (0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798, 0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8), 256, n)
+# secp256r1
+p = 0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff
+n = 0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551
+emit(D + '/secp_r1.hpp', 'CRYPTO3_ALGEBRA_CURVES_SECP_R1_GENERATOR_TABLE_PARAMS_HPP',
+     '#include <nil/crypto3/algebra/curves/secp_r1.hpp>', 'SECP256R1', 'detail::secp_r1_g1_params<256, forms::short_weierstrass>', 256,
+     SW(p, -3, 0x5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b),
+     (0x6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296, 0x4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5), 256, n)
+# ed25519
+p = 2**255 - 19
+n = 2**252 + 27742317777372353535851937790883648493
+d = 0x52036cee2b6ffe738cc740797779e89800700a4d4141d8ab75eb4dca135978a3
+emit(D + '/ed25519.hpp', 'CRYPTO3_ALGEBRA_CURVES_ED25519_GENERATOR_TABLE_PARAMS_HPP',
+     '#include <nil/crypto3/algebra/curves/ed25519.hpp>', 'ED25519', 'detail::curve25519_g1_params<forms::twisted_edwards>', 255,
+     TE(p, -1, d), (0x216936D3CD6E53FEC0A4E231FDD6DC5C692CC7609525A7B2C9562D608F25D51A, 0x6666666666666666666666666666666666666666666666666666666666666658), 253, n)
+# bls12-381
+p = 0x1A0111EA397FE69A4B1BA7B6434BACD764774B84F38512BF6730D2A0F6B0F6241EABFFFEB153FFFFB9FEFFFFFFFFAAAB
+n = 0x73EDA753299D7D483339D80809A1D80553BDA402FFFE5BFEFFFFFFFF00000001
+emit(D + '/bls12.hpp', 'CRYPTO3_ALGEBRA_CURVES_BLS12_GENERATOR_TABLE_PARAMS_HPP',
+     '#include <nil/crypto3/algebra/curves/bls12.hpp>', 'BLS12-381', 'detail::bls12_g1_params<381, forms::short_weierstrass>', 381,
+     SW(p, 0, 4), (0x17F1D3A73197D7942695638C4FA9AC0FC3688C4F9774B905A14E3A3F171BAC586C55E83FF97A1AEFFB3AF00ADB22C6BB, 0x08B3F481E3AAA0F1A09E30ED741D8AE4FCF5E095D5D00AF600DB18CB2C04B3EDD03CC744A2888AE40CAA232946C5E7E1), 255, n)
+# alt_bn128
+p = 21888242871839275222246405745257275088696311157297823662689037894645226208583
+n = 21888242871839275222246405745257275088548364400416034343698204186575808495617
+emit(D + '/alt_bn128.hpp', 'CRYPTO3_ALGEBRA_CURVES_ALT_BN128_GENERATOR_TABLE_PARAMS_HPP',
+     '#include <nil/crypto3/algebra/curves/alt_bn128.hpp>', 'ALT_BN128-254', 'detail::alt_bn128_g1_params<254, forms::short_weierstrass>', 254,
+     SW(p, 0, 3), (1, 2), 254, n)
@@ -26,7 +26,11 @@
 
 #define BOOST_TEST_MODULE algebra_curves_test
 
+#include <array>
 #include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
 #include <type_traits>
 
 #include <boost/test/included/unit_test.hpp>
@@ -64,6 +68,15 @@
 #include <nil/crypto3/algebra/fields/fp3.hpp>
 
 #include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/ct_scalar_mul.hpp>
+#include <nil/crypto3/algebra/fixed_base_table.hpp>
+#include <nil/crypto3/algebra/raw_marshalling.hpp>
+
+#include <nil/crypto3/algebra/curves/params/generator/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/params/generator/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/generator/ed25519.hpp>
+#include <nil/crypto3/algebra/curves/params/generator/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/params/generator/secp_r1.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
@@ -522,7 +535,342 @@ void curve_operation_test_montgomery(const TestSet &test_set,
     check_montgomery_twisted_edwards_conversion(points, constants);
 }
 
+template<typename CurveGroup>
+void ct_scalar_mul_test() {
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+
+    typename CurveGroup::value_type base = CurveGroup::value_type::one();
+    for (std::size_t i = 0; i < 16; ++i) {
+        typename scalar_field_type::value_type k = algebra::random_element<scalar_field_type>();
+        BOOST_CHECK(algebra::ct_scalar_mul(base, k) == k * base);
+        BOOST_CHECK(algebra::ct_scalar_mul<4>(base, k) == k * base);
+        base = base.doubled();
+    }
+    BOOST_CHECK(algebra::ct_scalar_mul(base, typename scalar_field_type::value_type(1)) == base);
+    BOOST_CHECK(algebra::ct_scalar_mul(base, typename scalar_field_type::value_type(2)) == base.doubled());
+    BOOST_CHECK(algebra::ct_scalar_mul(base, -typename scalar_field_type::value_type(1)) == -base);
+}
+
+template<typename CurveGroup>
+void fixed_base_table_test() {
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    using table_type = algebra::fixed_base_table<CurveGroup>;
+
+    typename CurveGroup::value_type base = CurveGroup::value_type::one().doubled();
+    table_type table(base, 5);
+
+    std::stringstream ss;
+    table.save(ss);
+    auto loaded = table_type::load(ss);
+    BOOST_CHECK(loaded.first);
+    auto view = table_type::view(table.data(), table.size());
+    BOOST_CHECK(view.first);
+    BOOST_CHECK(!table_type::view(table.data(), table.size() - 1).first);
+
+    for (std::size_t i = 0; i < 16; ++i) {
+        typename scalar_field_type::value_type k = algebra::random_element<scalar_field_type>();
+        BOOST_CHECK(table.mul(k) == k * base);
+        BOOST_CHECK(loaded.second.mul(k) == k * base);
+        BOOST_CHECK(view.second.mul(k) == k * base);
+    }
+    BOOST_CHECK(table.mul(scalar_field_type::value_type::zero()).is_zero());
+    BOOST_CHECK(table.mul(-scalar_field_type::value_type::one()) == -base);
+    BOOST_CHECK(algebra::generator_table<CurveGroup>().mul(scalar_field_type::value_type(3)) ==
+                CurveGroup::value_type::one() * 3u);
+
+    // every multiple is the identity
+    const table_type zero_table(CurveGroup::value_type::zero(), 4);
+    BOOST_CHECK(zero_table.mul(algebra::random_element<scalar_field_type>()).is_zero());
+    BOOST_CHECK(zero_table.mul(scalar_field_type::value_type(5)).is_zero());
+
+    if constexpr (algebra::has_t_coordinate<typename CurveGroup::value_type>::value) {
+        // (0, -1) has order 2, so the table holds the identity in every other entry of the first window
+        using field_value_type = typename CurveGroup::field_type::value_type;
+        const typename CurveGroup::value_type order_two =
+            algebra::detail::from_affine_coordinates<typename CurveGroup::value_type>(field_value_type::zero(),
+                                                                                      -field_value_type::one());
+        const table_type order_two_table(order_two, 4);
+        for (unsigned k = 1; k < 20; ++k) {
+            BOOST_CHECK(order_two_table.mul(scalar_field_type::value_type(k)) == order_two * k);
+        }
+    }
+}
+
+template<typename CurveGroup>
+void raw_marshalling_test() {
+    using field_type = typename CurveGroup::field_type;
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    using group_format = nil::marshalling::raw::group<CurveGroup>;
+    using field_format = nil::marshalling::raw::field<field_type>;
+
+    std::vector<typename CurveGroup::value_type> points {CurveGroup::value_type::zero()};
+    std::vector<typename field_type::value_type> coordinates;
+    for (std::size_t i = 0; i < 8; ++i) {
+        points.push_back(algebra::random_element<CurveGroup>());
+        coordinates.push_back(algebra::random_element<field_type>());
+    }
+
+    std::stringstream ss;
+    group_format::save(ss, points.begin(), points.end());
+    auto loaded_points = group_format::load(ss);
+    BOOST_CHECK(loaded_points.first);
+    BOOST_CHECK(loaded_points.second == points);
+
+    std::vector<nil::marshalling::raw::limb_type> buffer(field_format::size(coordinates.size()));
+    BOOST_CHECK(field_format::to_raw(coordinates.begin(), coordinates.end(), buffer.data()) ==
+                buffer.data() + buffer.size());
+    std::vector<typename field_type::value_type> loaded_coordinates;
+    BOOST_CHECK(field_format::from_raw(buffer.data(), buffer.size(), std::back_inserter(loaded_coordinates)).first);
+    BOOST_CHECK(loaded_coordinates == coordinates);
+
+    // truncated buffers and buffers of another field are rejected
+    BOOST_CHECK(
+        !field_format::from_raw(buffer.data(), buffer.size() - 1, std::back_inserter(loaded_coordinates)).first);
+    BOOST_CHECK(!nil::marshalling::raw::field<scalar_field_type>::from_raw(
+                     buffer.data(), buffer.size(), std::back_inserter(loaded_coordinates))
+                     .first);
+
+    // so are element counts the data does not hold, including counts whose size wraps around
+    using limb_type = nil::marshalling::raw::limb_type;
+    for (limb_type count : {limb_type(coordinates.size() + 1), std::numeric_limits<limb_type>::max(),
+                            limb_type(coordinates.size() +
+                                      std::numeric_limits<limb_type>::max() / field_format::element_limbs + 1)}) {
+        std::vector<limb_type> forged(buffer);
+        forged[5] = count;
+        BOOST_CHECK(
+            !field_format::from_raw(forged.data(), forged.size(), std::back_inserter(loaded_coordinates)).first);
+        std::stringstream forged_stream(
+            std::string(reinterpret_cast<const char *>(forged.data()), forged.size() * sizeof(limb_type)));
+        BOOST_CHECK(!field_format::load(forged_stream).first);
+    }
+}
+
+template<typename CurveGroup, typename TableParams = void>
+void mul_generator_test() {
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    const typename CurveGroup::value_type one = CurveGroup::value_type::one();
+
+    for (std::size_t i = 0; i < 16; ++i) {
+        typename scalar_field_type::value_type k = algebra::random_element<scalar_field_type>();
+        BOOST_CHECK(algebra::mul_generator<CurveGroup, TableParams>(k) == k * one);
+    }
+    BOOST_CHECK(algebra::mul_generator<CurveGroup, TableParams>(scalar_field_type::value_type::zero()).is_zero());
+    BOOST_CHECK(algebra::mul_generator<CurveGroup, TableParams>(scalar_field_type::value_type::one()) == one);
+    BOOST_CHECK(algebra::mul_generator<CurveGroup, TableParams>(-scalar_field_type::value_type::one()) == -one);
+}
+
+template<typename CurveGroup>
+void random_element_generator_test() {
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+
+    // Same seed on both sides: random_element<CurveGroup> draws exactly the scalar random_element<Field> does
+    boost::random::mt19937 scalar_rng(0x5eed), point_rng(0x5eed);
+    for (std::size_t i = 0; i < 8; ++i) {
+        const typename scalar_field_type::value_type k = algebra::random_element<scalar_field_type>(scalar_rng);
+        BOOST_CHECK(algebra::random_element<CurveGroup>(point_rng) == k * CurveGroup::value_type::one());
+    }
+}
+
+template<typename AffineGroup, typename ExtendedGroup>
+void twisted_edwards_extended_test() {
+    using scalar_field_type = typename AffineGroup::curve_type::scalar_field_type;
+    using field_value_type = typename AffineGroup::field_type::value_type;
+    using extended_value_type = typename ExtendedGroup::value_type;
+
+    auto to_extended = [](const typename AffineGroup::value_type &p) {
+        return extended_value_type(p.X, p.Y, p.X * p.Y, field_value_type::one());
+    };
+
+    const typename AffineGroup::value_type P = AffineGroup::value_type::one();
+    const typename AffineGroup::value_type Q = P.doubled() + P;
+    const extended_value_type eP = to_extended(P), eQ = to_extended(Q);
+
+    BOOST_CHECK(extended_value_type::one() == eP);
+    BOOST_CHECK((eP + eQ).to_affine() == P + Q);
+    BOOST_CHECK((eP - eQ).to_affine() == P - Q);
+    BOOST_CHECK((eP + eP).to_affine() == P.doubled());
+    BOOST_CHECK(eP.doubled().to_affine() == P.doubled());
+    BOOST_CHECK(eP.doubled().mixed_add(eQ).to_affine() == P.doubled() + Q);
+    BOOST_CHECK(eP.doubled().add_cached(eQ.doubled().to_cached()) == eP.doubled() + eQ.doubled());
+    BOOST_CHECK(eP.add_cached(-eQ.to_cached()) == eP - eQ);
+    BOOST_CHECK(eP.add_cached(eP.to_cached()) == eP.doubled());
+    BOOST_CHECK(extended_value_type::zero().add_cached(eQ.to_cached()) == eQ);
+    BOOST_CHECK((eP - eP).is_zero());
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        typename scalar_field_type::value_type k = algebra::random_element<scalar_field_type>();
+        BOOST_CHECK((eP * k).to_affine() == P * k);
+    }
+}
+
+template<typename ReferenceGroup, typename CompleteGroup>
+void projective_complete_test() {
+    using scalar_field_type = typename ReferenceGroup::curve_type::scalar_field_type;
+    using field_value_type = typename ReferenceGroup::field_type::value_type;
+    using complete_value_type = typename CompleteGroup::value_type;
+
+    const typename ReferenceGroup::value_type P = ReferenceGroup::value_type::one();
+    const typename ReferenceGroup::value_type Q = P.doubled() + P;
+    const complete_value_type cP = complete_value_type::one();
+    const complete_value_type cQ = cP.doubled() + cP;
+    const complete_value_type O = complete_value_type::zero();
+    const auto aQ = cQ.to_affine();
+    const complete_value_type mQ(aQ.X, aQ.Y, field_value_type::one());
+
+    BOOST_CHECK(cP.is_well_formed());
+    BOOST_CHECK(cQ.to_affine() == Q.to_affine());
+    BOOST_CHECK((cP + cQ).to_affine() == (P + Q).to_affine());
+    BOOST_CHECK((cP - cQ).to_affine() == (P - Q).to_affine());
+    BOOST_CHECK((cP + cP).to_affine() == P.doubled().to_affine());
+    BOOST_CHECK((cP - cP).is_zero());
+    BOOST_CHECK(O + cQ == cQ);
+    BOOST_CHECK(cQ + O == cQ);
+    BOOST_CHECK((O + O).is_zero());
+    BOOST_CHECK(O.doubled().is_zero());
+    BOOST_CHECK(cP.mixed_add(mQ) == cP + cQ);
+    BOOST_CHECK(cQ.mixed_add(mQ) == cQ.doubled());
+    BOOST_CHECK((-cQ).mixed_add(mQ).is_zero());
+    BOOST_CHECK(O.mixed_add(mQ) == cQ);
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        typename scalar_field_type::value_type k = algebra::random_element<scalar_field_type>();
+        BOOST_CHECK((cP * k).to_affine() == (P * k).to_affine());
+        BOOST_CHECK(algebra::ct_scalar_mul(cP, k) == cP * k);
+    }
+}
+
+template<typename CurveGroup>
+void equal_points_addition_test() {
+    using field_value_type = typename CurveGroup::field_type::value_type;
+    using group_value_type = typename CurveGroup::value_type;
+
+    const group_value_type P = group_value_type::one().doubled() + group_value_type::one();
+    const auto aP = P.to_affine();
+    const group_value_type mP(aP.X, aP.Y, field_value_type::one());
+
+    BOOST_CHECK(P + P == P.doubled());
+    BOOST_CHECK((P + (-P)).is_zero());
+    BOOST_CHECK((P - P).is_zero());
+    BOOST_CHECK(P + mP == P.doubled());
+    BOOST_CHECK(P.mixed_add(mP) == P.doubled());
+    BOOST_CHECK(P.mixed_add(-mP).is_zero());
+    BOOST_CHECK(P.doubled().mixed_add(mP) == P.doubled() + P);
+}
+
 BOOST_AUTO_TEST_SUITE(curves_manual_tests)
+
+BOOST_AUTO_TEST_CASE(fixed_base_table_test_case) {
+    fixed_base_table_test<curves::bls12<381>::g1_type<>>();
+    fixed_base_table_test<curves::bls12<381>::g2_type<>>();
+    fixed_base_table_test<curves::secp_k1<256>::g1_type<>>();
+    fixed_base_table_test<curves::secp_r1<256>::g1_type<>>();
+    fixed_base_table_test<curves::ed25519::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(raw_marshalling_test_case) {
+    raw_marshalling_test<curves::bls12<381>::g1_type<>>();
+    raw_marshalling_test<curves::bls12<381>::g2_type<>>();
+    raw_marshalling_test<curves::secp_k1<256>::g1_type<>>();
+    raw_marshalling_test<curves::ed25519::g1_type<>>();
+}
+
+template<typename CurveGroup>
+using compiled_generator_table = curves::generator_table_params<typename CurveGroup::params_type>;
+
+BOOST_AUTO_TEST_CASE(mul_generator_test_case) {
+    mul_generator_test<curves::alt_bn128<254>::g1_type<>>();
+    mul_generator_test<curves::bls12<381>::g1_type<>>();
+    mul_generator_test<curves::secp_k1<256>::g1_type<>>();
+    mul_generator_test<curves::secp_r1<256>::g1_type<>>();
+    mul_generator_test<curves::ed25519::g1_type<>>();
+    mul_generator_test<curves::bls12<381>::g2_type<>>();
+
+    mul_generator_test<curves::alt_bn128<254>::g1_type<>,
+                       compiled_generator_table<curves::alt_bn128<254>::g1_type<>>>();
+    mul_generator_test<curves::bls12<381>::g1_type<>, compiled_generator_table<curves::bls12<381>::g1_type<>>>();
+    mul_generator_test<curves::secp_k1<256>::g1_type<>, compiled_generator_table<curves::secp_k1<256>::g1_type<>>>();
+    mul_generator_test<curves::secp_r1<256>::g1_type<>, compiled_generator_table<curves::secp_r1<256>::g1_type<>>>();
+    mul_generator_test<curves::ed25519::g1_type<>, compiled_generator_table<curves::ed25519::g1_type<>>>();
+
+    BOOST_CHECK(algebra::has_generator_table_params<curves::bls12<381>::g1_type<>>::value);
+    BOOST_CHECK(!algebra::has_generator_table_params<curves::bls12<381>::g2_type<>>::value);
+    random_element_generator_test<curves::alt_bn128<254>::g1_type<>>();
+    random_element_generator_test<curves::bls12<381>::g1_type<>>();
+    random_element_generator_test<curves::secp_k1<256>::g1_type<>>();
+    random_element_generator_test<curves::secp_r1<256>::g1_type<>>();
+    random_element_generator_test<curves::ed25519::g1_type<>>();
+    random_element_generator_test<curves::bls12<381>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(curve25519_xz_ladder_test_case) {
+    using affine_group_type = curves::curve25519::g1_type<curves::coordinates::affine>;
+    using xz_group_type = curves::curve25519::g1_type<>;
+    using scalar_field_type = curves::curve25519::scalar_field_type;
+
+    for (std::size_t i = 0; i < 8; ++i) {
+        typename scalar_field_type::value_type k = algebra::random_element<scalar_field_type>();
+        BOOST_CHECK((affine_group_type::value_type::one() * k).to_xz() == xz_group_type::value_type::one() * k);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(x25519_test_case) {
+    auto from_hex = [](const std::string &hex) {
+        std::array<std::uint8_t, 32> out;
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = static_cast<std::uint8_t>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+        }
+        return out;
+    };
+
+    // RFC 7748, section 5.2
+    BOOST_CHECK(algebra::x25519(from_hex("a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4"),
+                                from_hex("e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c")) ==
+                from_hex("c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552"));
+    BOOST_CHECK(algebra::x25519(from_hex("4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d"),
+                                from_hex("e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493")) ==
+                from_hex("95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957"));
+}
+
+BOOST_AUTO_TEST_CASE(twisted_edwards_extended_test_case) {
+    twisted_edwards_extended_test<curves::jubjub::g1_type<>,
+                                  curves::jubjub::g1_type<curves::coordinates::extended_with_a_minus_1>>();
+    twisted_edwards_extended_test<curves::jubjub::g1_type<>, curves::jubjub::g1_type<curves::coordinates::extended>>();
+    twisted_edwards_extended_test<curves::babyjubjub::g1_type<>,
+                                  curves::babyjubjub::g1_type<curves::coordinates::extended>>();
+}
+
+BOOST_AUTO_TEST_CASE(equal_points_addition_test_case) {
+    equal_points_addition_test<curves::bls12<381>::g1_type<>>();
+    equal_points_addition_test<curves::bls12<381>::g2_type<>>();
+    equal_points_addition_test<curves::secp_r1<256>::g1_type<>>();
+    equal_points_addition_test<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian>>();
+    equal_points_addition_test<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3>>();
+    equal_points_addition_test<curves::secp_r1<256>::g1_type<curves::coordinates::projective_with_a4_minus_3>>();
+    equal_points_addition_test<curves::mnt4<298>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(projective_complete_test_case) {
+    projective_complete_test<curves::secp_k1<256>::g1_type<>,
+                             curves::secp_k1<256>::g1_type<curves::coordinates::projective_complete_with_a4_0>>();
+    projective_complete_test<curves::secp_r1<256>::g1_type<>,
+                             curves::secp_r1<256>::g1_type<curves::coordinates::projective_complete_with_a4_minus_3>>();
+    projective_complete_test<curves::alt_bn128<254>::g1_type<>,
+                             curves::alt_bn128<254>::g1_type<curves::coordinates::projective_complete_with_a4_0>>();
+    projective_complete_test<curves::bls12<381>::g1_type<>,
+                             curves::bls12<381>::g1_type<curves::coordinates::projective_complete_with_a4_0>>();
+    projective_complete_test<curves::pallas::g1_type<>,
+                             curves::pallas::g1_type<curves::coordinates::projective_complete_with_a4_0>>();
+    projective_complete_test<curves::vesta::g1_type<>,
+                             curves::vesta::g1_type<curves::coordinates::projective_complete_with_a4_0>>();
+}
+
+BOOST_AUTO_TEST_CASE(ct_scalar_mul_test_case) {
+    ct_scalar_mul_test<curves::bls12<381>::g1_type<>>();
+    ct_scalar_mul_test<curves::bls12<381>::g2_type<>>();
+    ct_scalar_mul_test<curves::secp_k1<256>::g1_type<>>();
+    ct_scalar_mul_test<curves::secp_r1<256>::g1_type<>>();
+    ct_scalar_mul_test<curves::ed25519::g1_type<>>();
+}
 /**/
 
 BOOST_DATA_TEST_CASE(curve_operation_test_jubjub_g1, string_data("curve_operation_test_jubjub_g1"), data_set) {
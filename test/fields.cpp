@@ -28,6 +28,7 @@
 
 #include <iostream>
 #include <cstdint>
+#include <random>
 #include <string>
 
 #include <boost/test/included/unit_test.hpp>
@@ -463,6 +464,34 @@ void field_not_square_test(const std::vector<std::array<const char *, 3>> &test_
     }
 }
 
+template<typename FieldType>
+void field_from_wide_bytes_test() {
+    typedef typename FieldType::value_type value_type;
+    constexpr std::size_t wide_bytes_max = value_type::wide_bytes_max;
+
+    std::mt19937 rng(1234);
+    std::vector<std::vector<std::uint8_t>> inputs;
+    for (std::size_t size = 1; size <= wide_bytes_max; size += 7) {
+        std::vector<std::uint8_t> bytes(size);
+        for (auto &b : bytes) {
+            b = static_cast<std::uint8_t>(rng());
+        }
+        inputs.push_back(bytes);
+    }
+    inputs.push_back(std::vector<std::uint8_t>(wide_bytes_max, 0xff));
+    inputs.push_back(std::vector<std::uint8_t>(wide_bytes_max, 0x00));
+
+    std::vector<std::uint8_t> modulus_bytes;
+    nil::crypto3::multiprecision::export_bits(FieldType::modulus, std::back_inserter(modulus_bytes), 8);
+    inputs.push_back(modulus_bytes);
+
+    for (const auto &bytes : inputs) {
+        nil::crypto3::multiprecision::cpp_int e;
+        nil::crypto3::multiprecision::import_bits(e, bytes.begin(), bytes.end());
+        BOOST_CHECK(value_type::from_wide_bytes(bytes.begin(), bytes.end()) == value_type(e));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(fields_manual_tests)
 
 BOOST_AUTO_TEST_CASE(field_operation_perf_test_pallas, *boost::unit_test::disabled()) {
@@ -564,6 +593,19 @@ BOOST_DATA_TEST_CASE(field_operation_test_bls12_381_fq12,
     field_operation_test<policy_type>(data_set);
 }
 
+BOOST_AUTO_TEST_CASE(field_from_wide_bytes_test_case) {
+    field_from_wide_bytes_test<fields::bls12_fq<381>>();
+    field_from_wide_bytes_test<fields::bls12_fr<381>>();
+    field_from_wide_bytes_test<fields::pallas_base_field>();
+    field_from_wide_bytes_test<fields::secp_k1_fq<256>>();
+    field_from_wide_bytes_test<fields::secp_k1_fr<256>>();
+    field_from_wide_bytes_test<fields::curve25519_scalar_field>();
+    field_from_wide_bytes_test<fields::mnt4<298>>();
+    field_from_wide_bytes_test<fields::mnt6<298>>();
+    field_from_wide_bytes_test<fields::secp_k1_fq<160>>();
+    field_from_wide_bytes_test<fields::secp_k1_fq<224>>();
+}
+
 BOOST_AUTO_TEST_CASE(field_operation_test_maxprime){
     using maxprime_field_type = fields::maxprime<64>;
     typename maxprime_field_type::value_type zero = maxprime_field_type::value_type::zero();
@@ -28,6 +28,7 @@
 #include <iostream>
 #include <cstdint>
 #include <vector>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <tuple>
@@ -40,9 +41,17 @@
 
 #include <nil/crypto3/algebra/curves/detail/h2c/ep.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/ep2.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/ell2.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_expand.hpp>
+#include <nil/crypto3/algebra/multiexp/thread_pool.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
 
 #include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
 
@@ -108,6 +117,56 @@ namespace boost {
                 }
             };
 
+            template<>
+            struct print_log_value<typename curves::secp_k1<256>::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::secp_k1<256>::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::pallas::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::pallas::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::vesta::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::vesta::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::alt_bn128<254>::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::alt_bn128<254>::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::alt_bn128<254>::g2_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::alt_bn128<254>::g2_type<>::value_type const &e) {
+                    print_fp2_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::curve25519::g1_type<curves::coordinates::affine>::value_type> {
+                void operator()(std::ostream &os,
+                                typename curves::curve25519::g1_type<curves::coordinates::affine>::value_type const &e) {
+                    os << "( " << e.X.data << " : " << e.Y.data << " )";
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::ed25519::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::ed25519::g1_type<>::value_type const &e) {
+                    os << "( " << e.X.data << " : " << e.Y.data << " : " << e.T.data << " : " << e.Z.data << " )";
+                }
+            };
+
             template<template<typename, typename> class P, typename K, typename V>
             struct print_log_value<P<K, V>> {
                 void operator()(std::ostream &, P<K, V> const &) {
@@ -139,6 +198,14 @@ void check_expand_message(std::size_t len_in_bytes, const DstType &dst, const Ms
     std::vector<std::uint8_t> uniform_bytes(len_in_bytes, 0);
     Expander::template process(len_in_bytes, msg, dst, uniform_bytes);
     BOOST_CHECK(result_compare(uniform_bytes));
+
+    // streaming path with the DST state prepared once, writing into a raw buffer
+    const typename Expander::dst_context dst_ctx(dst);
+    std::array<std::uint8_t, 0x100> buffer {0};
+    BOOST_CHECK(Expander::process(len_in_bytes, msg, dst_ctx, buffer.data()) == buffer.data() + len_in_bytes);
+    BOOST_CHECK(std::equal(result.begin(), result.end(), buffer.begin()));
+    Expander::process(len_in_bytes, msg, dst_ctx, buffer.data());
+    BOOST_CHECK(std::equal(result.begin(), result.end(), buffer.begin()));
 }
 
 template<std::size_t N,
@@ -166,6 +233,40 @@ void check_hash_to_curve(const std::string &msg_str, const GroupValueType &expec
     BOOST_CHECK_EQUAL(result, expected);
 }
 
+template<typename GroupType>
+void check_sqrt_ratio(const typename GroupType::field_type::value_type &u,
+                      const typename GroupType::field_type::value_type &v) {
+    using field_value_type = typename GroupType::field_type::value_type;
+
+    field_value_type r;
+    bool is_qr = sqrt_ratio<GroupType>::process(u, v, r);
+    if (!u.is_zero()) {
+        BOOST_CHECK_EQUAL(is_qr, (u * v.inversed()).is_square());
+    }
+    BOOST_CHECK_EQUAL(r.squared() * v, is_qr ? u : h2c_suite<GroupType>::Z * u);
+}
+
+template<typename BatchExpander, typename SamplesType, typename DstType>
+void check_expand_message_batch(const SamplesType &samples, const DstType &dst) {
+    const typename BatchExpander::dst_context dst_ctx(dst);
+    for (const auto &s : samples) {
+        const std::size_t len_in_bytes = std::get<0>(s);
+
+        std::vector<std::vector<std::uint8_t>> msgs;
+        std::vector<std::uint8_t> expected;
+        for (const auto &t : samples) {
+            if (std::get<0>(t) == len_in_bytes) {
+                msgs.push_back(std::get<1>(t));
+                expected.insert(expected.end(), std::get<2>(t).begin(), std::get<2>(t).end());
+            }
+        }
+
+        std::vector<std::uint8_t> uniform_bytes(msgs.size() * len_in_bytes, 0);
+        BatchExpander::process(len_in_bytes, msgs.begin(), msgs.end(), dst_ctx, uniform_bytes.data());
+        BOOST_CHECK(uniform_bytes == expected);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(h2c_manual_tests)
 
 BOOST_AUTO_TEST_CASE(expand_message_xmd_sha256_test) {
@@ -318,6 +419,80 @@ BOOST_AUTO_TEST_CASE(expand_message_xmd_sha256_test) {
     for (const auto &s : samples) {
         check_expand_message<expand_message>(std::get<0>(s), DST, std::get<1>(s), std::get<2>(s));
     }
+
+    // multi-buffer expansion must give the same bytes, whatever the number of lanes
+    check_expand_message_batch<expand_message_xmd_batch<128, hash_type>>(samples, DST);
+    check_expand_message_batch<expand_message_xmd_batch<128, hash_type, sha256_portable_lanes<3>>>(samples, DST);
+
+    sha256_lane_message message;
+    for (std::size_t i = 0; i < message.max_pieces; ++i) {
+        message.append(DST.data(), DST.size());
+    }
+    BOOST_CHECK_EQUAL(message.length(), message.max_pieces * DST.size());
+    BOOST_CHECK_THROW(message.append(DST.data(), DST.size()), std::length_error);
+}
+
+BOOST_AUTO_TEST_CASE(expand_message_xmd_sha256_long_dst_test) {
+    // https://www.rfc-editor.org/rfc/rfc9380#appendix-K.1, DST longer than 255 bytes
+    using hash_type = hashes::sha2<256>;
+    using expand_message = expand_message_xmd<128, hash_type>;
+
+    std::string DST_str("QUUX-V01-CS02-with-expander-SHA256-128-long-DST-");
+    DST_str.append(208, '1');
+    std::vector<std::uint8_t> DST(DST_str.begin(), DST_str.end());
+
+    // {len_in_bytes, msg, uniform_bytes}
+    using samples_type = std::vector<std::tuple<std::size_t, std::vector<std::uint8_t>, std::vector<std::uint8_t>>>;
+    samples_type samples {
+        {0x20,
+         {},
+         {0xe8, 0xdc, 0x0c, 0x8b, 0x68, 0x6b, 0x7e, 0xf2, 0x07, 0x40, 0x86, 0xfb, 0xdd, 0x2f, 0x30, 0xe3,
+          0xf8, 0xbf, 0xbd, 0x3b, 0xdf, 0x17, 0x7f, 0x73, 0xf0, 0x4b, 0x97, 0xce, 0x61, 0x8a, 0x3e, 0xd3}},
+        {0x20,
+         {0x61, 0x62, 0x63},
+         {0x52, 0xdb, 0xf4, 0xf3, 0x6c, 0xf5, 0x60, 0xfc, 0xa5, 0x7d, 0xed, 0xec, 0x2a, 0xd9, 0x24, 0xee,
+          0x9c, 0x26, 0x63, 0x41, 0xd8, 0xf3, 0xd6, 0xaf, 0xe5, 0x17, 0x17, 0x33, 0xb1, 0x6b, 0xbb, 0x12}},
+        {0x20,
+         {0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39},
+         {0x35, 0x38, 0x7d, 0xcf, 0x22, 0x61, 0x8f, 0x37, 0x28, 0xe6, 0xc6, 0x86, 0x49, 0x0f, 0x8b, 0x43,
+          0x1f, 0x76, 0x55, 0x0b, 0x0b, 0x2c, 0x61, 0xcb, 0xc1, 0xce, 0x70, 0x01, 0x53, 0x6f, 0x45, 0x21}},
+        {0x80,
+         {},
+         {0x14, 0x60, 0x4d, 0x85, 0x43, 0x2c, 0x68, 0xb7, 0x57, 0xe4, 0x85, 0xc8, 0x89, 0x4d, 0xb3, 0x11,
+          0x79, 0x92, 0xfc, 0x57, 0xe0, 0xe1, 0x36, 0xf7, 0x1a, 0xd9, 0x87, 0xf7, 0x89, 0xa0, 0xab, 0xc2,
+          0x87, 0xc4, 0x78, 0x76, 0x97, 0x8e, 0x23, 0x88, 0xa0, 0x2a, 0xf8, 0x6b, 0x1e, 0x8d, 0x13, 0x42,
+          0xe5, 0xce, 0x4f, 0x7a, 0xaa, 0x07, 0xa8, 0x73, 0x21, 0xe6, 0x91, 0xf6, 0xfb, 0xa7, 0xe0, 0x07,
+          0x2e, 0xec, 0xc1, 0x21, 0x8a, 0xeb, 0xb8, 0x9f, 0xb1, 0x4a, 0x06, 0x62, 0x32, 0x2d, 0x5e, 0xdb,
+          0xd8, 0x73, 0xf0, 0xeb, 0x35, 0x26, 0x01, 0x45, 0xcd, 0x4e, 0x64, 0xf7, 0x48, 0xc5, 0xdf, 0xe6,
+          0x05, 0x67, 0xe1, 0x26, 0x60, 0x4b, 0xca, 0xb1, 0xa3, 0xee, 0x2d, 0xc0, 0x77, 0x81, 0x02, 0xae,
+          0x8a, 0x5c, 0xfd, 0x14, 0x29, 0xeb, 0xc0, 0xfa, 0x6b, 0xf1, 0xa5, 0x3c, 0x36, 0xf5, 0x5d, 0xfc}}};
+
+    for (const auto &s : samples) {
+        check_expand_message<expand_message>(std::get<0>(s), DST, std::get<1>(s), std::get<2>(s));
+    }
+    check_expand_message_batch<expand_message_xmd_batch<128, hash_type>>(samples, DST);
+}
+
+BOOST_AUTO_TEST_CASE(expand_message_xmd_sha512_batch_test) {
+    using hash_type = hashes::sha2<512>;
+    using expand_message = expand_message_xmd<128, hash_type>;
+
+    std::string DST_str("QUUX-V01-CS02-with-expander-SHA512-256");
+    std::vector<std::uint8_t> DST(DST_str.begin(), DST_str.end());
+
+    // message lengths around the 128-byte SHA-512 block, expected bytes from the single-message expander
+    std::vector<std::tuple<std::size_t, std::vector<std::uint8_t>, std::vector<std::uint8_t>>> samples;
+    for (std::size_t len_in_bytes : {0x20, 0x60, 0x80}) {
+        for (std::size_t msg_size : {0, 3, 16, 110, 111, 112, 127, 128, 129, 300}) {
+            std::vector<std::uint8_t> msg(msg_size, static_cast<std::uint8_t>(0x61 + msg_size % 26));
+            std::vector<std::uint8_t> uniform_bytes(len_in_bytes);
+            expand_message::process(len_in_bytes, msg, DST, uniform_bytes);
+            samples.emplace_back(len_in_bytes, msg, uniform_bytes);
+        }
+    }
+
+    check_expand_message_batch<expand_message_xmd_batch<128, hash_type>>(samples, DST);
+    check_expand_message_batch<expand_message_xmd_batch<128, hash_type, sha512_portable_lanes<3>>>(samples, DST);
 }
 
 BOOST_AUTO_TEST_CASE(hash_to_field_bls12_381_g1_h2c_sha256_test) {
@@ -597,4 +772,276 @@ BOOST_AUTO_TEST_CASE(hash_to_curve_bls12_381_g2_h2c_sha256_test) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(clear_cofactor_bls12_381_test) {
+    // Fast cofactor clearing must agree with multiplication by h_eff on points outside the subgroup
+    using g1_type = typename bls12_381::g1_type<>;
+    using g2_type = typename bls12_381::g2_type<>;
+    typedef typename g1_type::field_type::value_type g1_field_value_type;
+    typedef typename g2_type::field_type::value_type g2_field_value_type;
+
+    for (std::size_t i = 1; i < 5; i++) {
+        typename g1_type::value_type P1 = map_to_curve<g1_type>::process(g1_field_value_type(i));
+        BOOST_CHECK_EQUAL(cofactor_clearing<g1_type>::process(P1), clear_cofactor_h_eff<g1_type>::process(P1));
+
+        typename g2_type::value_type P2 = map_to_curve<g2_type>::process(g2_field_value_type(i, i + 1));
+        BOOST_CHECK_EQUAL(cofactor_clearing<g2_type>::process(P2), clear_cofactor_h_eff<g2_type>::process(P2));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sqrt_ratio_bls12_381_test) {
+    using g1_type = typename bls12_381::g1_type<>;
+    using g2_type = typename bls12_381::g2_type<>;
+    typedef typename g1_type::field_type::value_type g1_field_value_type;
+    typedef typename g2_type::field_type::value_type g2_field_value_type;
+
+    for (std::size_t i = 1; i < 9; i++) {
+        check_sqrt_ratio<g1_type>(g1_field_value_type(i), g1_field_value_type(i + 3));
+        check_sqrt_ratio<g2_type>(g2_field_value_type(i, i + 1), g2_field_value_type(i + 3, 2 * i));
+    }
+    check_sqrt_ratio<g1_type>(g1_field_value_type::zero(), g1_field_value_type(5));
+    check_sqrt_ratio<g2_type>(g2_field_value_type::zero(), g2_field_value_type(5, 7));
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_batch_bls12_381_test) {
+    using g1_type = typename bls12_381::g1_type<>;
+    using g2_type = typename bls12_381::g2_type<>;
+
+    const std::string dst_str = "QUUX-V01-CS02-with-BLS12381G1_XMD:SHA-256_SSWU_RO_";
+    std::vector<std::uint8_t> dst(dst_str.begin(), dst_str.end());
+
+    std::vector<std::vector<std::uint8_t>> msgs;
+    for (std::size_t i = 0; i < 7; i++) {
+        msgs.emplace_back(i * 5, static_cast<std::uint8_t>(0x61 + i));
+    }
+
+    thread_pool pool(3);
+
+    std::vector<typename g1_type::value_type> P1;
+    ep_map<g1_type>::hash_to_curve_batch(msgs, dst, std::back_inserter(P1), false, pool);
+    std::vector<typename g1_type::value_type> P1_affine;
+    ep_map<g1_type>::hash_to_curve_batch(msgs, dst, std::back_inserter(P1_affine), true);
+
+    std::vector<typename g2_type::value_type> P2;
+    ep2_map<g2_type>::hash_to_curve_batch(msgs, dst, std::back_inserter(P2), false, pool);
+    std::vector<typename g2_type::value_type> P2_affine;
+    ep2_map<g2_type>::hash_to_curve_batch(msgs, dst, std::back_inserter(P2_affine), true, pool);
+
+    BOOST_CHECK_EQUAL(P1.size(), msgs.size());
+    BOOST_CHECK_EQUAL(P2.size(), msgs.size());
+    for (std::size_t i = 0; i < msgs.size(); i++) {
+        BOOST_CHECK_EQUAL(P1[i], ep_map<g1_type>::hash_to_curve(msgs[i], dst));
+        BOOST_CHECK_EQUAL(P1_affine[i], P1[i]);
+        BOOST_CHECK(P1_affine[i].Z == g1_type::field_type::value_type::one());
+
+        BOOST_CHECK_EQUAL(P2[i], ep2_map<g2_type>::hash_to_curve(msgs[i], dst));
+        BOOST_CHECK_EQUAL(P2_affine[i], P2[i]);
+        BOOST_CHECK(P2_affine[i].Z == g2_type::field_type::value_type::one());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_secp256k1_h2c_sha256_test) {
+    // https://datatracker.ietf.org/doc/html/rfc9380#appendix-J.8.1
+    using group_type = typename secp_k1<256>::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"", group_value_type(integral_type("0xc1cae290e291aee617ebaef1be6d73861479c48b841eaba9b7b5852ddfeb1346"),
+                              integral_type("0x64fa678e07ae116126f08b022a94af6de15985c996c3a91b64c406a960e51067"),
+                              1)},
+        {"abc", group_value_type(integral_type("0x3377e01eab42db296b512293120c6cee72b6ecf9f9205760bd9ff11fb3cb2c4b"),
+                                 integral_type("0x7f95890f33efebd1044d382a01b1bee0900fb6116f94688d487c6c7b9c8371f6"),
+                                 1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_pasta_h2c_blake2b_test) {
+    // There are no published vectors for these suites that could be checked here, so only properties that do not
+    // depend on reference outputs are tested: the points are well formed and do not depend on the evaluation path.
+    using pallas_group_type = typename pallas::g1_type<>;
+    using vesta_group_type = typename vesta::g1_type<>;
+
+    std::string default_tag_str = "z.cash:test-";
+    std::vector<std::uint8_t> pallas_dst(default_tag_str.begin(), default_tag_str.end());
+    pallas_dst.insert(pallas_dst.end(), h2c_suite<pallas_group_type>::suite_id.begin(),
+                      h2c_suite<pallas_group_type>::suite_id.end());
+    std::vector<std::uint8_t> vesta_dst(default_tag_str.begin(), default_tag_str.end());
+    vesta_dst.insert(vesta_dst.end(), h2c_suite<vesta_group_type>::suite_id.begin(),
+                     h2c_suite<vesta_group_type>::suite_id.end());
+
+    std::vector<std::vector<std::uint8_t>> msgs;
+    for (std::size_t i = 0; i < 5; i++) {
+        msgs.emplace_back(i * 17, static_cast<std::uint8_t>(0x61 + i));
+    }
+
+    std::vector<typename pallas_group_type::value_type> P;
+    ep_map<pallas_group_type>::hash_to_curve_batch(msgs, pallas_dst, std::back_inserter(P), true);
+    std::vector<typename vesta_group_type::value_type> Q;
+    ep_map<vesta_group_type>::hash_to_curve_batch(msgs, vesta_dst, std::back_inserter(Q), true);
+
+    for (std::size_t i = 0; i < msgs.size(); i++) {
+        BOOST_CHECK(P[i].is_well_formed());
+        BOOST_CHECK(!P[i].is_zero());
+        BOOST_CHECK_EQUAL(P[i], ep_map<pallas_group_type>::hash_to_curve(msgs[i], pallas_dst));
+        BOOST_CHECK(P[i] != ep_map<pallas_group_type>::hash_to_curve(msgs[i], vesta_dst));
+
+        BOOST_CHECK(Q[i].is_well_formed());
+        BOOST_CHECK(!Q[i].is_zero());
+        BOOST_CHECK_EQUAL(Q[i], ep_map<vesta_group_type>::hash_to_curve(msgs[i], vesta_dst));
+        for (std::size_t j = 0; j < i; j++) {
+            BOOST_CHECK(P[i] != P[j]);
+            BOOST_CHECK(Q[i] != Q[j]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_alt_bn128_h2c_sha256_test) {
+    // gnark-crypto, ecc/bn254/hash_vectors_test.go
+    using g1_type = typename alt_bn128<254>::g1_type<>;
+    using g2_type = typename alt_bn128<254>::g2_type<>;
+    typedef typename g1_type::value_type g1_value_type;
+    typedef typename g2_type::value_type g2_value_type;
+    typedef typename g1_type::field_type::value_type g1_field_value_type;
+    typedef typename g2_type::field_type::value_type g2_field_value_type;
+    typedef typename g1_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> g1_dst(default_tag_str.begin(), default_tag_str.end());
+    g1_dst.insert(g1_dst.end(), h2c_suite<g1_type>::suite_id.begin(), h2c_suite<g1_type>::suite_id.end());
+    std::vector<std::uint8_t> g2_dst(default_tag_str.begin(), default_tag_str.end());
+    g2_dst.insert(g2_dst.end(), h2c_suite<g2_type>::suite_id.begin(), h2c_suite<g2_type>::suite_id.end());
+
+    std::array<g1_field_value_type, 2> u {
+        g1_field_value_type(integral_type("0x2f87b81d9d6ef05ad4d249737498cc27e1bd485dca804487844feb3c67c1a9b5")),
+        g1_field_value_type(integral_type("0x06de2d0d7c0d9c7a5a6c0b74675e7543f5b98186b5dbf831067449000b2b1f8e"))};
+    check_hash_to_field_ro<2, ep_map<g1_type>>("", u, g1_dst);
+
+    std::vector<std::tuple<std::string, g1_value_type>> g1_samples {
+        {"", g1_value_type(integral_type("0x0a976ab906170db1f9638d376514dbf8c42aef256a54bbd48521f20749e59e86"),
+                           integral_type("0x02925ead66b9e68bfc309b014398640ab55f6619ab59bc1fab2210ad4c4d53d5"),
+                           1)},
+        {"abc", g1_value_type(integral_type("0x23f717bee89b1003957139f193e6be7da1df5f1374b26a4643b0378b5baf53d1"),
+                              integral_type("0x04142f826b71ee574452dbc47e05bc3e1a647478403a7ba38b7b93948f4e151d"),
+                              1)},
+    };
+    std::vector<std::tuple<std::string, g2_value_type>> g2_samples {
+        {"", g2_value_type(
+                 g2_field_value_type(
+                     integral_type("0x1192005a0f121921a6d5629946199e4b27ff8ee4d6dd4f9581dc550ade851300"),
+                     integral_type("0x1747d950a6f23c16156e2171bce95d1189b04148ad12628869ed21c96a8c9335")),
+                 g2_field_value_type(
+                     integral_type("0x0498f6bb5ac309a07d9a8b88e6ff4b8de0d5f27a075830e1eb0e68ea318201d8"),
+                     integral_type("0x2c9755350ca363ef2cf541005437221c5740086c2e909b71d075152484e845f4")),
+                 g2_field_value_type::one())},
+    };
+
+    for (auto &s : g1_samples) {
+        check_hash_to_curve<ep_map<g1_type>>(std::get<0>(s), std::get<1>(s), g1_dst);
+    }
+    for (auto &s : g2_samples) {
+        check_hash_to_curve<ep2_map<g2_type>>(std::get<0>(s), std::get<1>(s), g2_dst);
+    }
+
+    // The batched path covers the new suites as well
+    std::vector<std::vector<std::uint8_t>> msgs;
+    for (std::size_t i = 0; i < 5; i++) {
+        msgs.emplace_back(i * 3, static_cast<std::uint8_t>(0x61 + i));
+    }
+    thread_pool pool(2);
+    std::vector<g2_value_type> P2;
+    ep2_map<g2_type>::hash_to_curve_batch(msgs, g2_dst, std::back_inserter(P2), true, pool);
+    for (std::size_t i = 0; i < msgs.size(); i++) {
+        BOOST_CHECK_EQUAL(P2[i], ep2_map<g2_type>::hash_to_curve(msgs[i], g2_dst));
+        BOOST_CHECK((P2[i] * alt_bn128<254>::scalar_field_type::modulus).is_zero());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_25519_h2c_sha512_test) {
+    // https://datatracker.ietf.org/doc/html/rfc9380#appendix-J.4.1
+    // https://datatracker.ietf.org/doc/html/rfc9380#appendix-J.5.1
+    using montgomery_group_type = typename curve25519::g1_type<curves::coordinates::affine>;
+    using edwards_group_type = typename ed25519::g1_type<>;
+    typedef typename montgomery_group_type::value_type montgomery_value_type;
+    typedef typename edwards_group_type::value_type edwards_value_type;
+    typedef typename edwards_group_type::field_type::value_type field_value_type;
+    typedef typename edwards_group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> montgomery_dst(default_tag_str.begin(), default_tag_str.end());
+    montgomery_dst.insert(montgomery_dst.end(), h2c_suite<montgomery_group_type>::suite_id.begin(),
+                          h2c_suite<montgomery_group_type>::suite_id.end());
+    std::vector<std::uint8_t> edwards_dst(default_tag_str.begin(), default_tag_str.end());
+    edwards_dst.insert(edwards_dst.end(), h2c_suite<edwards_group_type>::suite_id.begin(),
+                       h2c_suite<edwards_group_type>::suite_id.end());
+
+    std::vector<std::tuple<std::string, montgomery_value_type>> montgomery_samples {
+        {"", montgomery_value_type(
+                 field_value_type(integral_type("0x2de3780abb67e861289f5749d16d3e217ffa722192d16bbd9d1bfb9d112b98c0")),
+                 field_value_type(integral_type("0x3b5dc2a498941a1033d176567d457845637554a2fe7a3507d21abd1c1bd6e878")))},
+        {"abc", montgomery_value_type(
+                    field_value_type(integral_type("0x2b4419f1f2d48f5872de692b0aca72cc7b0a60915dd70bde432e826b6abc526d")),
+                    field_value_type(integral_type("0x1b8235f255a268f0a6fa8763e97eb3d22d149343d495da1160eff9703f2d07dd")))},
+    };
+
+    std::vector<std::tuple<std::string, field_value_type, field_value_type>> edwards_samples {
+        {"", field_value_type(integral_type("0x3c3da6925a3c3c268448dcabb47ccde5439559d9599646a8260e47b1e4822fc6")),
+         field_value_type(integral_type("0x09a6c8561a0b22bef63124c588ce4c62ea83a3c899763af26d795302e115dc21"))},
+        {"abc", field_value_type(integral_type("0x608040b42285cc0d72cbb3985c6b04c935370c7361f4b7fbdb1ae7f8c1a8ecad")),
+         field_value_type(integral_type("0x1a8395b88338f22e435bbd301183e7f20a5f9de643f11882fb237f88268a5531"))},
+    };
+
+    for (auto &s : montgomery_samples) {
+        check_hash_to_curve<ell2_map<montgomery_group_type>>(std::get<0>(s), std::get<1>(s), montgomery_dst);
+    }
+    for (auto &s : edwards_samples) {
+        const field_value_type &x = std::get<1>(s);
+        const field_value_type &y = std::get<2>(s);
+        check_hash_to_curve<ell2_map<edwards_group_type>>(
+            std::get<0>(s), edwards_value_type(x, y, x * y, field_value_type::one()), edwards_dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_batch_25519_test) {
+    using montgomery_group_type = typename curve25519::g1_type<curves::coordinates::affine>;
+    using edwards_group_type = typename ed25519::g1_type<>;
+
+    const std::string dst_str = "QUUX-V01-CS02-with-edwards25519_XMD:SHA-512_ELL2_RO_";
+    std::vector<std::uint8_t> dst(dst_str.begin(), dst_str.end());
+
+    std::vector<std::vector<std::uint8_t>> msgs;
+    for (std::size_t i = 0; i < 7; i++) {
+        msgs.emplace_back(i * 23, static_cast<std::uint8_t>(0x61 + i));
+    }
+
+    thread_pool pool(3);
+
+    std::vector<typename edwards_group_type::value_type> P;
+    ell2_map<edwards_group_type>::hash_to_curve_batch(msgs, dst, std::back_inserter(P), false, pool);
+    std::vector<typename edwards_group_type::value_type> P_affine;
+    ell2_map<edwards_group_type>::hash_to_curve_batch(msgs, dst, std::back_inserter(P_affine), true, pool);
+    std::vector<typename montgomery_group_type::value_type> Q;
+    ell2_map<montgomery_group_type>::hash_to_curve_batch(msgs, dst, std::back_inserter(Q), true);
+
+    BOOST_CHECK_EQUAL(P.size(), msgs.size());
+    BOOST_CHECK_EQUAL(Q.size(), msgs.size());
+    for (std::size_t i = 0; i < msgs.size(); i++) {
+        BOOST_CHECK_EQUAL(P[i], ell2_map<edwards_group_type>::hash_to_curve(msgs[i], dst));
+        BOOST_CHECK_EQUAL(P_affine[i], P[i]);
+        BOOST_CHECK(P_affine[i].Z == edwards_group_type::field_type::value_type::one());
+        BOOST_CHECK(P_affine[i].T == P_affine[i].X * P_affine[i].Y);
+
+        BOOST_CHECK_EQUAL(Q[i], ell2_map<montgomery_group_type>::hash_to_curve(msgs[i], dst));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -29,16 +29,27 @@
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
 
+#include <atomic>
 #include <cstdio>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
 #include <vector>
 #include <chrono>
 #include <ctime>
 
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/scalar_digits.hpp>
+#include <nil/crypto3/algebra/multiexp/tuning.hpp>
+#include <nil/crypto3/algebra/multiexp/calibration.hpp>
+#include <nil/crypto3/algebra/multiexp/fixed_base_multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/straus.hpp>
+#include <nil/crypto3/algebra/multiexp/thread_pool.hpp>
 
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
 //#include <nil/crypto3/algebra/curves/bn128.hpp>
 // #include <nil/crypto3/algebra/curves/brainpool_r1.hpp>
 #include <nil/crypto3/algebra/curves/edwards.hpp>
@@ -52,6 +63,7 @@
 // #include <nil/crypto3/algebra/curves/p384.hpp>
 // #include <nil/crypto3/algebra/curves/p521.hpp>
 // #include <nil/crypto3/algebra/curves/secp.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
 // #include <nil/crypto3/algebra/curves/sm2p_v1.hpp>
 // #include <nil/crypto3/algebra/curves/x962_p.hpp>
 
@@ -73,6 +85,7 @@
 // #include <nil/crypto3/algebra/curves/params/multiexp/sm2p_v1.hpp>
 // #include <nil/crypto3/algebra/curves/params/multiexp/x962_p.hpp>
 #include <nil/crypto3/algebra/curves/params/wnaf/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/generator/secp_k1.hpp>
 
 #include <nil/crypto3/algebra/random_element.hpp>
 
@@ -179,6 +192,354 @@ void print_performance_csv(size_t expn_start, std::size_t expn_end_fast, std::si
     }
 }
 
+template<typename GroupType, typename FieldType>
+void print_bucket_performance_csv(std::size_t expn_start, std::size_t expn_end) {
+    printf("log2(n)\tBDLO12\tsigned\tbatched affine\n");
+    for (size_t expn = expn_start; expn <= expn_end; expn++) {
+        printf("%ld", expn);
+        fflush(stdout);
+
+        test_instances_t<GroupType> group_elements = generate_group_elements<GroupType>(4, 1 << expn);
+        test_instances_t<FieldType> scalars = generate_scalars<FieldType>(4, 1 << expn);
+
+        run_result_t<GroupType> result_djb =
+            profile_multiexp<GroupType, FieldType, policies::multiexp_method_BDLO12>(group_elements, scalars);
+        printf("\t%lld", result_djb.first);
+        fflush(stdout);
+
+        run_result_t<GroupType> result_signed =
+            profile_multiexp<GroupType, FieldType, policies::multiexp_method_BDLO12_signed>(group_elements, scalars);
+        printf("\t%lld", result_signed.first);
+        fflush(stdout);
+
+        run_result_t<GroupType> result_affine =
+            profile_multiexp<GroupType, FieldType, policies::multiexp_method_batched_affine>(group_elements, scalars);
+        printf("\t%lld", result_affine.first);
+        fflush(stdout);
+
+        BOOST_CHECK(result_djb.second == result_signed.second);
+        BOOST_CHECK(result_djb.second == result_affine.second);
+
+        printf("\n");
+    }
+}
+
+template<typename GroupType, typename GeneratorTableParams = void>
+void straus_test() {
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using group_value_type = typename GroupType::value_type;
+
+    for (std::size_t n = 1; n <= 10; ++n) {
+        std::vector<group_value_type> bases;
+        std::vector<typename scalar_field_type::value_type> scalars;
+        for (std::size_t i = 0; i < n; ++i) {
+            bases.push_back(random_element<GroupType>());
+            scalars.push_back(random_element<scalar_field_type>());
+        }
+        scalars[0] = scalar_field_type::value_type::zero();
+        if (n > 2) {
+            scalars[2] = -scalar_field_type::value_type::one();
+            bases[1] = bases[2];
+        }
+
+        BOOST_CHECK(multiexp<policies::multiexp_method_straus>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                               scalars.cend(), 1) ==
+                    multiexp<policies::multiexp_method_naive_plain>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                                    scalars.cend(), 1));
+    }
+
+    const typename scalar_field_type::value_type u1 = random_element<scalar_field_type>();
+    const typename scalar_field_type::value_type u2 = random_element<scalar_field_type>();
+    const group_value_type Q = random_element<GroupType>();
+    const auto double_mul = [](const typename scalar_field_type::value_type &a, const group_value_type &base,
+                               const typename scalar_field_type::value_type &b) {
+        return double_scalar_mul_generator<GroupType, GeneratorTableParams>(a, base, b);
+    };
+    BOOST_CHECK(double_mul(u1, Q, u2) == u1 * group_value_type::one() + u2 * Q);
+    BOOST_CHECK(double_mul(u1, Q, -u1) == u1 * (group_value_type::one() - Q));
+    BOOST_CHECK(double_mul(scalar_field_type::value_type::zero(), Q, u2) == u2 * Q);
+}
+
+template<typename GroupType>
+void parallel_multiexp_test() {
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using group_value_type = typename GroupType::value_type;
+
+    thread_pool pool(4);
+    for (std::size_t n : {1, 2, 7, 64, 300}) {
+        std::vector<group_value_type> bases;
+        std::vector<typename scalar_field_type::value_type> scalars;
+        for (std::size_t i = 0; i < n; ++i) {
+            bases.push_back(random_element<GroupType>());
+            scalars.push_back(random_element<scalar_field_type>());
+        }
+        if (n > 2) {
+            scalars[0] = scalar_field_type::value_type::zero();
+            scalars[1] = -scalar_field_type::value_type::one();
+        }
+        if (n > 4) {
+            // same bucket for P and -P, and for P twice
+            bases[3] = -bases[2];
+            scalars[3] = scalars[2];
+            bases[4] = bases[2];
+            scalars[4] = scalars[2];
+        }
+
+        const group_value_type expected = multiexp<policies::multiexp_method_naive_plain>(
+            bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 1);
+
+        BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                               scalars.cend(), 0, pool) == expected);
+        BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                               scalars.cend(), 1) == expected);
+        BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12_signed>(bases.cbegin(), bases.cend(),
+                                                                      scalars.cbegin(), scalars.cend(), 0,
+                                                                      pool) == expected);
+        BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12_signed>(bases.cbegin(), bases.cend(),
+                                                                      scalars.cbegin(), scalars.cend(),
+                                                                      1) == expected);
+        BOOST_CHECK(multiexp<policies::multiexp_method_bos_coster>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                                   scalars.cend(), 3, pool) == expected);
+        BOOST_CHECK(multiexp<policies::multiexp_method_batched_affine>(bases.cbegin(), bases.cend(),
+                                                                       scalars.cbegin(), scalars.cend(), 0,
+                                                                       pool) == expected);
+        BOOST_CHECK(multiexp<policies::multiexp_method_batched_affine>(bases.cbegin(), bases.cend(),
+                                                                       scalars.cbegin(), scalars.cend(),
+                                                                       1) == expected);
+        BOOST_CHECK(multiexp<policies::multiexp_method_straus>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                               scalars.cend()) == expected);
+    }
+}
+
+template<typename GroupType>
+void skewed_multiexp_test() {
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using group_value_type = typename GroupType::value_type;
+
+    // Scalars sharing digits put whole windows into one bucket
+    thread_pool pool(4);
+    const std::size_t n = 1024;
+    std::vector<group_value_type> bases;
+    group_value_type bases_sum = group_value_type::zero();
+    for (std::size_t i = 0; i < n; ++i) {
+        bases.push_back(random_element<GroupType>());
+        bases_sum = bases_sum + bases.back();
+    }
+
+    const typename scalar_field_type::value_type k = random_element<scalar_field_type>();
+    std::vector<typename scalar_field_type::value_type> equal_scalars(n, k);
+    BOOST_CHECK(multiexp<policies::multiexp_method_batched_affine>(bases.cbegin(), bases.cend(),
+                                                                   equal_scalars.cbegin(), equal_scalars.cend(),
+                                                                   1) == k * bases_sum);
+    BOOST_CHECK(multiexp<policies::multiexp_method_batched_affine>(bases.cbegin(), bases.cend(),
+                                                                   equal_scalars.cbegin(), equal_scalars.cend(), 0,
+                                                                   pool) == k * bases_sum);
+
+    std::vector<typename scalar_field_type::value_type> bit_scalars(n, scalar_field_type::value_type::one());
+    for (std::size_t i = 0; i < n; i += 37) {
+        bit_scalars[i] = i % 2 ? scalar_field_type::value_type::zero() : random_element<scalar_field_type>();
+    }
+    const group_value_type expected = multiexp<policies::multiexp_method_naive_plain>(
+        bases.cbegin(), bases.cend(), bit_scalars.cbegin(), bit_scalars.cend(), 1);
+    BOOST_CHECK(multiexp<policies::multiexp_method_batched_affine>(bases.cbegin(), bases.cend(),
+                                                                   bit_scalars.cbegin(), bit_scalars.cend(),
+                                                                   1) == expected);
+    BOOST_CHECK(multiexp<policies::multiexp_method_tuned>(bases.cbegin(), bases.cend(), bit_scalars.cbegin(),
+                                                          bit_scalars.cend(), 0, pool) == expected);
+}
+
+template<typename CurveType>
+void scalar_digits_test() {
+    using scalar_field_type = typename CurveType::scalar_field_type;
+    using integral_type = typename scalar_field_type::integral_type;
+    using g1_type = typename CurveType::template g1_type<>;
+    using g2_type = typename CurveType::template g2_type<>;
+
+    thread_pool pool(4);
+    const std::size_t n = 100;
+    std::vector<typename scalar_field_type::value_type> scalars;
+    std::vector<typename g1_type::value_type> g1_bases;
+    std::vector<typename g2_type::value_type> g2_bases;
+    for (std::size_t i = 0; i < n; ++i) {
+        scalars.push_back(i == 0 ? -scalar_field_type::value_type::one() : random_element<scalar_field_type>());
+        g1_bases.push_back(random_element<g1_type>());
+        g2_bases.push_back(random_element<g2_type>());
+    }
+
+    for (bool is_signed : {false, true}) {
+        for (std::size_t c : {2, 7, 16}) {
+            const scalar_digits<scalar_field_type> digits(scalars.cbegin(), scalars.cend(), c, is_signed, pool);
+            for (std::size_t i = 0; i < n; ++i) {
+                integral_type value = 0;
+                for (std::size_t k = digits.windows_count(); k > 0; --k) {
+                    const auto digit = digits.window(k - 1)[i];
+                    value <<= c;
+                    value = digit < 0 ? value - integral_type(-digit) : value + integral_type(digit);
+                }
+                BOOST_CHECK(value == scalars[i].data.template convert_to<integral_type>());
+            }
+        }
+    }
+
+    // one preparation of the scalars for both groups
+    const auto digits = policies::multiexp_method_BDLO12_signed::prepare(scalars.cbegin(), scalars.cend(), pool);
+    BOOST_CHECK(policies::multiexp_method_BDLO12_signed::process(g1_bases.cbegin(), digits, pool) ==
+                multiexp<policies::multiexp_method_naive_plain>(g1_bases.cbegin(), g1_bases.cend(),
+                                                                scalars.cbegin(), scalars.cend(), 1));
+    BOOST_CHECK(policies::multiexp_method_BDLO12_signed::process(g2_bases.cbegin(), digits) ==
+                multiexp<policies::multiexp_method_naive_plain>(g2_bases.cbegin(), g2_bases.cend(),
+                                                                scalars.cbegin(), scalars.cend(), 1));
+
+    const std::size_t window = 5;
+    const auto table = get_window_table<g1_type>(scalar_field_type::value_bits, window, g1_bases[0]);
+    BOOST_CHECK((windowed_exp<g1_type, scalar_field_type>(scalar_field_type::value_bits, window, table,
+                                                          scalars[1])) == scalars[1] * g1_bases[0]);
+}
+
+template<typename GroupType, typename OtherGroupType>
+void multiexp_tuning_test() {
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using group_value_type = typename GroupType::value_type;
+
+    multiexp_calibration_options options;
+    options.max_log2_length = 5;
+    options.min_seconds = 0.001;
+    const multiexp_tuning calibrated = calibrate_multiexp<GroupType>(options);
+    BOOST_CHECK(is_multiexp_tuning_for<GroupType>(calibrated));
+    BOOST_CHECK(!is_multiexp_tuning_for<OtherGroupType>(calibrated));
+    BOOST_CHECK_EQUAL(calibrated.fixed_base_exp_window_table.size(), options.max_fixed_base_window);
+    BOOST_CHECK(!calibrated.bucket_window_table.empty());
+
+    // tables from a file, with windows and crossovers that differ from the defaults
+    std::stringstream file;
+    file << "# test tuning\n";
+    calibrated.write(file);
+    file << "bucket_window_table 4 0 1 0 16\n";
+    file << "crossovers 2 4 16\n";
+    std::stringstream other_file(file.str());
+
+    BOOST_CHECK(!load_multiexp_tuning<OtherGroupType>(other_file));
+    BOOST_CHECK(!get_multiexp_tuning<OtherGroupType>());
+    BOOST_CHECK(load_multiexp_tuning<GroupType>(file));
+    const auto tuning = get_multiexp_tuning<GroupType>();
+    BOOST_REQUIRE(tuning);
+    BOOST_CHECK(tuning->bucket_window_table == std::vector<std::size_t>({0, 1, 0, 16}));
+    BOOST_CHECK_EQUAL(tuning->batched_affine_threshold, std::size_t(16));
+
+    // tables whose signed windows scalar_digits cannot take are rejected
+    for (std::size_t size : {multiexp_tuning::max_bucket_window_table_size,
+                             multiexp_tuning::max_bucket_window_table_size + 1}) {
+        std::stringstream wide_file;
+        calibrated.write(wide_file);
+        wide_file << "bucket_window_table " << size;
+        for (std::size_t i = 0; i < size; ++i) {
+            wide_file << ' ' << (i + 1 == size ? 1 : 0);
+        }
+        wide_file << '\n';
+        multiexp_tuning wide;
+        BOOST_CHECK_EQUAL(wide.read(wide_file), size <= multiexp_tuning::max_bucket_window_table_size);
+    }
+    for (std::size_t n : {1, 10, 1000, 100000}) {
+        BOOST_CHECK_EQUAL(get_exp_window_size<GroupType>(n),
+                          multiexp_tuning::window_for(calibrated.fixed_base_exp_window_table, n));
+    }
+
+    for (std::size_t n : {1, 3, 5, 20}) {
+        std::vector<group_value_type> bases;
+        std::vector<typename scalar_field_type::value_type> scalars;
+        for (std::size_t i = 0; i < n; ++i) {
+            bases.push_back(random_element<GroupType>());
+            scalars.push_back(random_element<scalar_field_type>());
+        }
+        const group_value_type expected = multiexp<policies::multiexp_method_naive_plain>(
+            bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 1);
+
+        BOOST_CHECK(multiexp<policies::multiexp_method_tuned>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                              scalars.cend(), 1) == expected);
+        BOOST_CHECK(multiexp<policies::multiexp_method_tuned>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                              scalars.cend(), 0) == expected);
+        BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                               scalars.cend(), 1) == expected);
+    }
+
+    clear_multiexp_tuning<GroupType>();
+    BOOST_CHECK(!get_multiexp_tuning<GroupType>());
+}
+
+template<typename GroupType, typename OtherGroupType>
+void fixed_base_multiexp_test() {
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using group_value_type = typename GroupType::value_type;
+    using table_type = fixed_base_multiexp<GroupType>;
+
+    const std::size_t n = 40;
+    std::vector<group_value_type> bases;
+    std::vector<typename scalar_field_type::value_type> scalars;
+    for (std::size_t i = 0; i < n; ++i) {
+        bases.push_back(random_element<GroupType>());
+        scalars.push_back(random_element<scalar_field_type>());
+    }
+    bases[3] = group_value_type::zero();
+    scalars[0] = scalar_field_type::value_type::zero();
+    scalars[1] = -scalar_field_type::value_type::one();
+
+    thread_pool pool(4);
+    const std::size_t point_bytes = table_type::point_limbs * sizeof(typename table_type::limb_type);
+    // all shifts, a single one, and three of them, i.e. one or several rounds
+    for (std::size_t max_bytes : {std::size_t(0), std::size_t(1), 3 * n * point_bytes}) {
+        for (std::size_t window : {0, 3, 9}) {
+            const table_type table(bases.cbegin(), bases.cend(), max_bytes, window, pool);
+            BOOST_CHECK_EQUAL(table.bases_count(), n);
+            const std::size_t shifts_count = max_bytes == 0 ? table.windows_count() : max_bytes == 1 ? 1 : 3;
+            BOOST_CHECK_EQUAL(table.shifts_count(), shifts_count);
+
+            for (std::size_t length : {std::size_t(1), std::size_t(10), n}) {
+                const group_value_type expected = multiexp<policies::multiexp_method_naive_plain>(
+                    bases.cbegin(), bases.cbegin() + length, scalars.cbegin(), scalars.cbegin() + length, 1);
+                BOOST_CHECK(table.multiexp(scalars.cbegin(), scalars.cbegin() + length) == expected);
+                BOOST_CHECK(table.multiexp(scalars.cbegin(), scalars.cbegin() + length, pool) == expected);
+            }
+        }
+    }
+
+    const table_type table(bases.cbegin(), bases.cend());
+    const group_value_type expected = table.multiexp(scalars.cbegin(), scalars.cend());
+
+    std::stringstream ss;
+    table.save(ss);
+    const std::string serialized = ss.str();
+    auto loaded = table_type::load(ss);
+    BOOST_CHECK(loaded.first);
+    BOOST_CHECK(loaded.second.multiexp(scalars.cbegin(), scalars.cend()) == expected);
+
+    auto viewed = table_type::view(table.data(), table.size());
+    BOOST_CHECK(viewed.first);
+    BOOST_CHECK(viewed.second.multiexp(scalars.cbegin(), scalars.cend(), pool) == expected);
+
+    // truncated tables and tables of another group are rejected
+    std::stringstream truncated(serialized.substr(0, serialized.size() - 1));
+    BOOST_CHECK(!table_type::load(truncated).first);
+    BOOST_CHECK(!table_type::view(table.data(), table.size() - 1).first);
+    std::stringstream other(serialized);
+    BOOST_CHECK(!fixed_base_multiexp<OtherGroupType>::load(other).first);
+
+    // so are headers claiming more bases than the data holds, including counts whose size overflows
+    typedef typename table_type::limb_type limb_type;
+    for (limb_type bases_count : {limb_type(n + 1), std::numeric_limits<limb_type>::max(),
+                                  std::numeric_limits<limb_type>::max() / table_type::point_limbs + 1}) {
+        std::vector<limb_type> forged(table.data(), table.data() + table.size());
+        forged[7] = bases_count;
+        std::stringstream forged_stream(
+            std::string(reinterpret_cast<const char *>(forged.data()), forged.size() * sizeof(limb_type)));
+        BOOST_CHECK(!table_type::load(forged_stream).first);
+        BOOST_CHECK(!table_type::view(forged.data(), forged.size()).first);
+    }
+
+    std::vector<typename scalar_field_type::value_type> too_many(n + 1);
+    BOOST_CHECK_THROW(table.multiexp(too_many.cbegin(), too_many.cend()), std::out_of_range);
+    BOOST_CHECK_THROW(table_type().multiexp(too_many.cbegin(), too_many.cbegin()), std::out_of_range);
+}
+
 BOOST_AUTO_TEST_SUITE(multiexp_test_suite)
 
 BOOST_AUTO_TEST_CASE(multiexp_test_case) {
@@ -190,4 +551,81 @@ BOOST_AUTO_TEST_CASE(multiexp_test_case) {
     print_performance_csv<curves::bls12<381>::g2_type<>, curves::bls12<381>::scalar_field_type>(2, 12, 14, true);
 }
 
+BOOST_AUTO_TEST_CASE(parallel_multiexp_test_case) {
+    parallel_multiexp_test<curves::bls12<381>::g1_type<>>();
+    parallel_multiexp_test<curves::alt_bn128<254>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(skewed_multiexp_test_case) {
+    skewed_multiexp_test<curves::bls12<381>::g1_type<>>();
+    skewed_multiexp_test<curves::alt_bn128<254>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(thread_pool_exception_test_case) {
+    thread_pool pool(4);
+    constexpr std::size_t tasks_count = 1000;
+
+    std::vector<std::atomic<std::size_t>> calls(tasks_count);
+    auto throwing = [&calls](std::size_t i) {
+        ++calls[i];
+        if (i % 97 == 13) {
+            throw std::runtime_error("task failed");
+        }
+    };
+    BOOST_CHECK_THROW(pool.run(tasks_count, throwing), std::runtime_error);
+    for (const auto &c : calls) {
+        BOOST_CHECK(c <= 1);
+    }
+
+    // the pool is idle again and the failed job is gone
+    std::vector<std::atomic<std::size_t>> after(tasks_count);
+    pool.run(tasks_count, [&after](std::size_t i) { ++after[i]; });
+    for (const auto &c : after) {
+        BOOST_CHECK(c == 1);
+    }
+
+    // serial fallback, inside a task
+    pool.run(2, [&](std::size_t) { BOOST_CHECK_THROW(pool.run(tasks_count, throwing), std::runtime_error); });
+}
+
+BOOST_AUTO_TEST_CASE(scalar_digits_test_case) {
+    scalar_digits_test<curves::bls12<381>>();
+    scalar_digits_test<curves::alt_bn128<254>>();
+}
+
+BOOST_AUTO_TEST_CASE(fixed_base_multiexp_test_case) {
+    fixed_base_multiexp_test<curves::bls12<381>::g1_type<>, curves::bls12<381>::g2_type<>>();
+    fixed_base_multiexp_test<curves::ed25519::g1_type<>, curves::bls12<381>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(multiexp_tuning_test_case) {
+    multiexp_tuning_test<curves::bls12<381>::g1_type<>, curves::bls12<381>::g2_type<>>();
+    multiexp_tuning_test<curves::alt_bn128<254>::g2_type<>, curves::alt_bn128<254>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(multiexp_signed_bucket_perf_test, *boost::unit_test::disabled()) {
+    std::cout << "BDLO12 against signed digits, BLS12-381 G1" << std::endl;
+    print_bucket_performance_csv<curves::bls12<381>::g1_type<>, curves::bls12<381>::scalar_field_type>(8, 16);
+
+    std::cout << "BDLO12 against signed digits, BLS12-381 G2" << std::endl;
+    print_bucket_performance_csv<curves::bls12<381>::g2_type<>, curves::bls12<381>::scalar_field_type>(8, 14);
+
+    std::cout << "BDLO12 against signed digits, BN254 G1" << std::endl;
+    print_bucket_performance_csv<curves::alt_bn128<254>::g1_type<>, curves::alt_bn128<254>::scalar_field_type>(8,
+                                                                                                               16);
+
+    std::cout << "BDLO12 against signed digits, BN254 G2" << std::endl;
+    print_bucket_performance_csv<curves::alt_bn128<254>::g2_type<>, curves::alt_bn128<254>::scalar_field_type>(8,
+                                                                                                               14);
+}
+
+BOOST_AUTO_TEST_CASE(straus_test_case) {
+    straus_test<curves::bls12<381>::g1_type<>>();
+    straus_test<curves::bls12<381>::g2_type<>>();
+    straus_test<curves::alt_bn128<254>::g1_type<>>();
+    straus_test<curves::secp_k1<256>::g1_type<>>();
+    straus_test<curves::secp_k1<256>::g1_type<>,
+                curves::generator_table_params<curves::secp_k1<256>::g1_type<>::params_type>>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()